@@ -94,6 +94,10 @@ currentTrackFunction getCurrentTrackFunctionFromId(int i) {
     }
 }
 
+int currentTrackWatch(void (*on_change)(void)) {
+    return -1;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -38,16 +38,71 @@ VUMeter::VUMeter(int X, int Y, int W, int H, const char *L) : Fl_Group(X, Y, W,
     tick_distance_px = width / num_of_ticks;
 
     vu_end_xpos = x_origin + width;
+
+    scale_img = 0;
+    bar_img = 0;
+    drawn = 0;
+    for (int chan = 0; chan < 2; chan++) {
+        bar_xpos[chan] = x_origin;
+        peak_xpos[chan] = -1;
+    }
+}
+
+VUMeter::~VUMeter()
+{
+    if (scale_img != 0) {
+        fl_delete_offscreen(scale_img);
+    }
+    if (bar_img != 0) {
+        fl_delete_offscreen(bar_img);
+    }
 }
 
 void VUMeter::value(float left, float right, float left_peak, float right_peak)
 {
+    float level_dB[2], peak_dB[2];
+    int changed = 0;
+
     left_dB = left;
     right_dB = right;
     left_peak_dB = left_peak;
     right_peak_dB = right_peak;
 
-    redraw();
+    level_dB[0] = left_dB;
+    level_dB[1] = right_dB;
+    peak_dB[0] = left_peak_dB;
+    peak_dB[1] = right_peak_dB;
+
+    for (int chan = 0; chan < 2; chan++) {
+        int bar = dB_to_xpos(level_dB[chan] < max_value ? level_dB[chan] : max_value);
+        int peak = -1;
+
+        // The last column belongs to the frame
+        if (bar > vu_end_xpos - 1) {
+            bar = vu_end_xpos - 1;
+        }
+
+        if (peak_dB[chan] >= level_dB[chan]) {
+            peak = dB_to_xpos(peak_dB[chan] < max_value ? peak_dB[chan] : max_value);
+            if (peak >= vu_end_xpos) {
+                peak -= peak_bar_width + 2; // The +2 assures that the peak bar is visible at 0 dB
+            }
+        }
+
+        if (bar != bar_xpos[chan] || peak != peak_xpos[chan]) {
+            bar_xpos[chan] = bar;
+            peak_xpos[chan] = peak;
+            changed = 1;
+        }
+    }
+
+    if (!cache_is_valid()) {
+        redraw();
+    }
+    else if (changed) {
+        // Nothing to do if no bar or peak has moved by at least one pixel
+        damage(FL_DAMAGE_USER1);
+    }
 }
 
 int VUMeter::dB_to_xpos(float dB)
@@ -63,214 +118,212 @@ int VUMeter::dB_to_xpos(float dB)
     return xpos;
 }
 
-void VUMeter::draw()
+// Color of the bar <xpos> pixels right of the widget origin
+Fl_Color VUMeter::bar_color(int xpos)
 {
-    Fl_Group::draw();
-
-    float offset = abs(min_value);
-    float left_vol = (left_dB + offset) / offset * width;
-    float right_vol = (right_dB + offset) / offset * width;
-
-    int x1;
-
-    double red, green, blue, gradient;
-
-    // Clear whole widget area
-    fl_rectf(x_origin, y_origin, width, height, bg_color);
+    int mid_xpos = dB_to_xpos(cfg.gui.vu_mid_range_start) - x_origin;
+    int high_xpos = dB_to_xpos(cfg.gui.vu_high_range_start) - x_origin;
+    int gradient_offset = 10;
+    int c1, c2, i;
+    uchar r1, g1, b1;
+    uchar r2, g2, b2;
+    uchar r, g, b;
 
     if (cfg.gui.vu_mode == VU_MODE_SOLID) {
-        fl_color(cfg.gui.vu_low_color);
-        fl_rectf(x_origin, left_chan_y1, dB_to_xpos(left_dB) - x_origin, channel_height - 1);
-
-        if (left_dB > cfg.gui.vu_mid_range_start) {
-            fl_color(cfg.gui.vu_mid_color);
-            fl_rectf(dB_to_xpos(cfg.gui.vu_mid_range_start), left_chan_y1, dB_to_xpos(left_dB) - dB_to_xpos(cfg.gui.vu_mid_range_start), channel_height - 1);
-        }
-        if (left_dB > cfg.gui.vu_high_range_start) {
-            fl_color(cfg.gui.vu_high_color);
-            fl_rectf(dB_to_xpos(cfg.gui.vu_high_range_start), left_chan_y1, dB_to_xpos(left_dB) - dB_to_xpos(cfg.gui.vu_high_range_start), channel_height - 1);
+        if (xpos >= high_xpos) {
+            return cfg.gui.vu_high_color;
         }
-
-        fl_color(cfg.gui.vu_low_color);
-        fl_rectf(x_origin, right_chan_y1, dB_to_xpos(right_dB) - x_origin, channel_height - 1);
-        if (right_dB > cfg.gui.vu_mid_range_start) {
-            fl_color(cfg.gui.vu_mid_color);
-            fl_rectf(dB_to_xpos(cfg.gui.vu_mid_range_start), right_chan_y1, dB_to_xpos(right_dB) - dB_to_xpos(cfg.gui.vu_mid_range_start), channel_height - 1);
-        }
-        if (right_dB > cfg.gui.vu_high_range_start) {
-            fl_color(cfg.gui.vu_high_color);
-            fl_rectf(dB_to_xpos(cfg.gui.vu_high_range_start), right_chan_y1, dB_to_xpos(right_dB) - dB_to_xpos(cfg.gui.vu_high_range_start),
-                     channel_height - 1);
+        if (xpos >= mid_xpos) {
+            return cfg.gui.vu_mid_color;
         }
+        return cfg.gui.vu_low_color;
     }
-    else { // Gradient
-        int gradient_offset = 10;
-        for (int x_pos = 0; x_pos <= width - 2; x_pos += 1) {
-            x1 = x_origin + x_pos;
-
-            // fl_color(bg_color);
-            if (left_vol > x_pos) {
-                if (x1 < dB_to_xpos(cfg.gui.vu_mid_range_start) - gradient_offset) {
-                    fl_color(cfg.gui.vu_low_color);
-                }
-                else if (x1 < dB_to_xpos(cfg.gui.vu_mid_range_start)) {
-                    uchar r1, g1, b1;
-                    uchar r2, g2, b2;
-                    uchar r, g, b;
-                    int c1 = cfg.gui.vu_low_color;
-                    int c2 = cfg.gui.vu_mid_color;
-                    r1 = (c1 & 0xFF000000) >> 24;
-                    g1 = (c1 & 0x00FF0000) >> 16;
-                    b1 = (c1 & 0x0000FF00) >> 8;
-                    r2 = (c2 & 0xFF000000) >> 24;
-                    g2 = (c2 & 0x00FF0000) >> 16;
-                    b2 = (c2 & 0x0000FF00) >> 8;
-
-                    // Interpolate color
-                    int i = x1 - (dB_to_xpos(cfg.gui.vu_mid_range_start) - gradient_offset);
-                    r = round(r1 + (float)i / gradient_offset * (r2 - r1));
-                    g = round(g1 + (float)i / gradient_offset * (g2 - g1));
-                    b = round(b1 + (float)i / gradient_offset * (b2 - b1));
-                    fl_color(fl_rgb_color(r, g, b));
-                }
-                else if (x1 < dB_to_xpos(cfg.gui.vu_high_range_start) - gradient_offset) {
-                    fl_color(cfg.gui.vu_mid_color);
-                }
-                else if (x1 < dB_to_xpos(cfg.gui.vu_high_range_start)) {
-                    uchar r1, g1, b1;
-                    uchar r2, g2, b2;
-                    uchar r, g, b;
-                    int c1 = cfg.gui.vu_mid_color;
-                    int c2 = cfg.gui.vu_high_color;
-                    int i = x1 - (dB_to_xpos(cfg.gui.vu_high_range_start) - gradient_offset);
-                    r1 = (c1 & 0xFF000000) >> 24;
-                    g1 = (c1 & 0x00FF0000) >> 16;
-                    b1 = (c1 & 0x0000FF00) >> 8;
-                    r2 = (c2 & 0xFF000000) >> 24;
-                    g2 = (c2 & 0x00FF0000) >> 16;
-                    b2 = (c2 & 0x0000FF00) >> 8;
-
-                    r = round(r1 + (float)i / gradient_offset * (r2 - r1));
-                    g = round(g1 + (float)i / gradient_offset * (g2 - g1));
-                    b = round(b1 + (float)i / gradient_offset * (b2 - b1));
-                    fl_color(fl_rgb_color(r, g, b));
-                }
-                else {
-                    fl_color(cfg.gui.vu_high_color);
-                }
-                fl_line(x1, left_chan_y1, x1, left_chan_y2);
-            }
 
-            // fl_color(bg_color);
-            if (right_vol > x_pos) {
-                if (x1 < dB_to_xpos(cfg.gui.vu_mid_range_start) - gradient_offset) {
-                    fl_color(cfg.gui.vu_low_color);
-                }
-                else if (x1 < dB_to_xpos(cfg.gui.vu_mid_range_start)) {
-                    uchar r1, g1, b1;
-                    uchar r2, g2, b2;
-                    uchar r, g, b;
-                    int c1 = cfg.gui.vu_low_color;
-                    int c2 = cfg.gui.vu_mid_color;
-                    r1 = (c1 & 0xFF000000) >> 24;
-                    g1 = (c1 & 0x00FF0000) >> 16;
-                    b1 = (c1 & 0x0000FF00) >> 8;
-                    r2 = (c2 & 0xFF000000) >> 24;
-                    g2 = (c2 & 0x00FF0000) >> 16;
-                    b2 = (c2 & 0x0000FF00) >> 8;
-
-                    int i = x1 - (dB_to_xpos(cfg.gui.vu_mid_range_start) - gradient_offset);
-                    r = round(r1 + (float)i / gradient_offset * (r2 - r1));
-                    g = round(g1 + (float)i / gradient_offset * (g2 - g1));
-                    b = round(b1 + (float)i / gradient_offset * (b2 - b1));
-                    fl_color(fl_rgb_color(r, g, b));
-                }
-                else if (x1 < dB_to_xpos(cfg.gui.vu_high_range_start) - gradient_offset) {
-                    fl_color(cfg.gui.vu_mid_color);
-                }
-                else if (x1 < dB_to_xpos(cfg.gui.vu_high_range_start)) {
-                    uchar r1, g1, b1;
-                    uchar r2, g2, b2;
-                    uchar r, g, b;
-                    int c1 = cfg.gui.vu_mid_color;
-                    int c2 = cfg.gui.vu_high_color;
-                    int i = x1 - (dB_to_xpos(cfg.gui.vu_high_range_start) - gradient_offset);
-                    r1 = (c1 & 0xFF000000) >> 24;
-                    g1 = (c1 & 0x00FF0000) >> 16;
-                    b1 = (c1 & 0x0000FF00) >> 8;
-                    r2 = (c2 & 0xFF000000) >> 24;
-                    g2 = (c2 & 0x00FF0000) >> 16;
-                    b2 = (c2 & 0x0000FF00) >> 8;
-
-                    r = round(r1 + (float)i / gradient_offset * (r2 - r1));
-                    g = round(g1 + (float)i / gradient_offset * (g2 - g1));
-                    b = round(b1 + (float)i / gradient_offset * (b2 - b1));
-                    fl_color(fl_rgb_color(r, g, b));
-                }
-                else {
-                    fl_color(cfg.gui.vu_high_color);
-                }
-                fl_line(x1, right_chan_y1, x1, right_chan_y2);
-            }
-        }
+    if (xpos < mid_xpos - gradient_offset) {
+        return cfg.gui.vu_low_color;
+    }
+    else if (xpos < mid_xpos) {
+        c1 = cfg.gui.vu_low_color;
+        c2 = cfg.gui.vu_mid_color;
+        i = xpos - (mid_xpos - gradient_offset);
+    }
+    else if (xpos < high_xpos - gradient_offset) {
+        return cfg.gui.vu_mid_color;
+    }
+    else if (xpos < high_xpos) {
+        c1 = cfg.gui.vu_mid_color;
+        c2 = cfg.gui.vu_high_color;
+        i = xpos - (high_xpos - gradient_offset);
+    }
+    else {
+        return cfg.gui.vu_high_color;
     }
 
-    int left_peak_pos, right_peak_pos;
+    r1 = (c1 & 0xFF000000) >> 24;
+    g1 = (c1 & 0x00FF0000) >> 16;
+    b1 = (c1 & 0x0000FF00) >> 8;
+    r2 = (c2 & 0xFF000000) >> 24;
+    g2 = (c2 & 0x00FF0000) >> 16;
+    b2 = (c2 & 0x0000FF00) >> 8;
 
-    fl_color(FL_BLACK);
-    if (left_peak_dB >= left_dB) {
-        left_peak_pos = dB_to_xpos(left_peak_dB);
-        if (left_peak_pos >= vu_end_xpos) {
-            left_peak_pos -= peak_bar_width + 2; // The +2 assures that the peak bar is visible at 0 dB
-        }
+    // Interpolate color
+    r = round(r1 + (float)i / gradient_offset * (r2 - r1));
+    g = round(g1 + (float)i / gradient_offset * (g2 - g1));
+    b = round(b1 + (float)i / gradient_offset * (b2 - b1));
 
-        fl_rectf(left_peak_pos, left_chan_y1, peak_bar_width, channel_height - 1);
-    }
+    return fl_rgb_color(r, g, b);
+}
+
+// Draws the meter with its top left corner at <ox>, <oy>. Both bars are at full level if <lit> is set
+void VUMeter::draw_meter(int ox, int oy, int lit)
+{
+    int left_y1 = oy + left_chan_y1 - y_origin;
+    int right_y1 = oy + right_chan_y1 - y_origin;
+    int bar_height = cfg.gui.vu_mode == VU_MODE_SOLID ? channel_height - 1 : channel_height;
 
-    if (right_peak_dB >= right_dB) {
-        right_peak_pos = dB_to_xpos(right_peak_dB);
-        if (right_peak_pos >= vu_end_xpos) {
-            right_peak_pos -= peak_bar_width + 2;
+    fl_rectf(ox, oy, width, height, bg_color);
+
+    if (lit) {
+        for (int x_pos = 0; x_pos <= width - 2; x_pos++) {
+            fl_color(bar_color(x_pos));
+            fl_line(ox + x_pos, left_y1, ox + x_pos, left_y1 + bar_height - 1);
+            fl_line(ox + x_pos, right_y1, ox + x_pos, right_y1 + bar_height - 1);
         }
-        fl_rectf(right_peak_pos, right_chan_y1, peak_bar_width, channel_height - 1);
     }
 
-    fl_draw_box(FL_THIN_DOWN_FRAME, x_origin, left_chan_y1, width, channel_height, bg_color);
-    fl_draw_box(FL_THIN_DOWN_FRAME, x_origin, right_chan_y1, width, channel_height, bg_color);
-    fl_draw_box(FL_THIN_DOWN_FRAME, x_origin, y_origin, width, height, FL_DARK1);
+    fl_draw_box(FL_THIN_DOWN_FRAME, ox, left_y1, width, channel_height, bg_color);
+    fl_draw_box(FL_THIN_DOWN_FRAME, ox, right_y1, width, channel_height, bg_color);
+    fl_draw_box(FL_THIN_DOWN_FRAME, ox, oy, width, height, FL_DARK1);
+
+    int tick_pos;
+    char dB_val[4];
 
     fl_color(FL_BLACK);
-    fl_font(FL_HELVETICA, 10);
+    fl_font(FL_HELVETICA, 9);
+    for (int n = 1; n <= num_of_ticks; n++) {
+        tick_pos = ox + n * tick_distance_px;
+
+        fl_line(tick_pos, oy, tick_pos, oy + 3);
+        fl_line(tick_pos, oy + height - 1, tick_pos, oy + height - 4);
+
+        snprintf(dB_val, sizeof(dB_val), "%d", (int)min_value + n * tick_distance_dB);
 
 #if defined(__APPLE__)
-    fl_draw("L", x_origin - 9, y_origin + 8);
-    fl_draw("R", x_origin - 9, y_origin + height - 3);
+        fl_draw(dB_val, tick_pos - 5, oy + height / 2 + 2);
 #else
-    fl_draw("L", x_origin - 9, y_origin + 9);
-    fl_draw("R", x_origin - 9, y_origin + height - 2);
+        fl_draw(dB_val, tick_pos - 5, oy + height / 2 + 3);
 #endif
+    }
+}
 
-    int tick_pos;
-    char dB_val[4];
-    fl_font(FL_HELVETICA, 9);
+int VUMeter::cache_is_valid(void)
+{
+    return scale_img != 0 && cached_mode == cfg.gui.vu_mode && cached_colors[0] == cfg.gui.vu_low_color &&
+           cached_colors[1] == cfg.gui.vu_mid_color && cached_colors[2] == cfg.gui.vu_high_color &&
+           cached_ranges[0] == cfg.gui.vu_mid_range_start && cached_ranges[1] == cfg.gui.vu_high_range_start;
+}
+
+void VUMeter::update_cache(void)
+{
+    if (scale_img == 0) {
+        scale_img = fl_create_offscreen(width, height);
+        bar_img = fl_create_offscreen(width, height);
+    }
+
+    fl_begin_offscreen(scale_img);
+    draw_meter(0, 0, 0);
+    fl_end_offscreen();
+
+    fl_begin_offscreen(bar_img);
+    draw_meter(0, 0, 1);
+    fl_end_offscreen();
+
+    cached_mode = cfg.gui.vu_mode;
+    cached_colors[0] = cfg.gui.vu_low_color;
+    cached_colors[1] = cfg.gui.vu_mid_color;
+    cached_colors[2] = cfg.gui.vu_high_color;
+    cached_ranges[0] = cfg.gui.vu_mid_range_start;
+    cached_ranges[1] = cfg.gui.vu_high_range_start;
+}
+
+// Restores the columns x1 <= x < x2 of a channel row from the cached images
+void VUMeter::copy_columns(int chan, int x1, int x2)
+{
+    int y1 = chan == 0 ? left_chan_y1 : right_chan_y1;
+    int bar_end = bar_xpos[chan];
+
+    if (x1 < x_origin) {
+        x1 = x_origin;
+    }
+    if (x2 > vu_end_xpos) {
+        x2 = vu_end_xpos;
+    }
+
+    if (x1 < bar_end) {
+        int end = x2 < bar_end ? x2 : bar_end;
+        fl_copy_offscreen(x1, y1, end - x1, channel_height, bar_img, x1 - x_origin, y1 - y_origin);
+        x1 = end;
+    }
+    if (x1 < x2) {
+        fl_copy_offscreen(x1, y1, x2 - x1, channel_height, scale_img, x1 - x_origin, y1 - y_origin);
+    }
+}
+
+void VUMeter::draw()
+{
+    int full = damage() != FL_DAMAGE_USER1 || !drawn || !cache_is_valid();
+
+    if (!cache_is_valid()) {
+        update_cache();
+    }
+
+    if (full) {
+        Fl_Group::draw();
+        fl_copy_offscreen(x_origin, y_origin, width, height, scale_img, 0, 0);
+        for (int chan = 0; chan < 2; chan++) {
+            copy_columns(chan, x_origin, bar_xpos[chan]);
+        }
+
+        fl_color(FL_BLACK);
+        fl_font(FL_HELVETICA, 10);
 
 #if defined(__APPLE__)
-    fl_draw("dB", x_origin - 13, y_origin + height / 2 + 2);
+        fl_draw("L", x_origin - 9, y_origin + 8);
+        fl_draw("R", x_origin - 9, y_origin + height - 3);
 #else
-    fl_draw("dB", x_origin - 13, y_origin + height / 2 + 3);
+        fl_draw("L", x_origin - 9, y_origin + 9);
+        fl_draw("R", x_origin - 9, y_origin + height - 2);
 #endif
-    for (int n = 1; n <= num_of_ticks; n++) {
-        tick_pos = x_origin + n * tick_distance_px;
 
-        fl_line(tick_pos, y_origin, tick_pos, y_origin + 3);
-        fl_line(tick_pos, y_origin + height - 1, tick_pos, y_origin + height - 4);
-
-        snprintf(dB_val, sizeof(dB_val), "%d", (int)min_value + n * tick_distance_dB);
+        fl_font(FL_HELVETICA, 9);
 
 #if defined(__APPLE__)
-        fl_draw(dB_val, tick_pos - 5, y_origin + height / 2 + 2);
+        fl_draw("dB", x_origin - 13, y_origin + height / 2 + 2);
 #else
-        fl_draw(dB_val, tick_pos - 5, y_origin + height / 2 + 3);
+        fl_draw("dB", x_origin - 13, y_origin + height / 2 + 3);
 #endif
     }
+    else {
+        for (int chan = 0; chan < 2; chan++) {
+            int old_bar = drawn_bar_xpos[chan];
+            int new_bar = bar_xpos[chan];
+
+            if (old_bar != new_bar) {
+                copy_columns(chan, old_bar < new_bar ? old_bar : new_bar, old_bar < new_bar ? new_bar : old_bar);
+            }
+            if (drawn_peak_xpos[chan] != -1) {
+                copy_columns(chan, drawn_peak_xpos[chan], drawn_peak_xpos[chan] + peak_bar_width);
+            }
+        }
+    }
+
+    fl_color(FL_BLACK);
+    for (int chan = 0; chan < 2; chan++) {
+        if (peak_xpos[chan] != -1) {
+            fl_rectf(peak_xpos[chan], chan == 0 ? left_chan_y1 : right_chan_y1, peak_bar_width, channel_height - 1);
+        }
+        drawn_bar_xpos[chan] = bar_xpos[chan];
+        drawn_peak_xpos[chan] = peak_xpos[chan];
+    }
+    drawn = 1;
 }
@@ -3,6 +3,7 @@
 #include <stdlib.h>
 #include <math.h>
 #include <FL/Fl.H>
+#include <FL/x.H>
 #include <FL/fl_draw.H>
 #include <FL/Fl_Double_Window.H>
 #include <FL/Fl_Group.H>
@@ -31,8 +32,29 @@ class VUMeter : public Fl_Group {
 
     Fl_Color bg_color;
 
+    // The static parts are rendered once into two offscreen images: the empty scale and the
+    // scale with both bars at full level. A frame copies the columns between the old and the new
+    // bar end from one of them and only draws the peak markers itself
+    Fl_Offscreen scale_img;
+    Fl_Offscreen bar_img;
+    int cached_mode;
+    int cached_colors[3];
+    int cached_ranges[2];
+
+    // Screen positions, index 0 = left channel, 1 = right channel. A peak position of -1 means hidden
+    int bar_xpos[2], peak_xpos[2];
+    int drawn_bar_xpos[2], drawn_peak_xpos[2];
+    int drawn;
+
+    Fl_Color bar_color(int xpos);
+    void draw_meter(int ox, int oy, int lit);
+    int cache_is_valid(void);
+    void update_cache(void);
+    void copy_columns(int chan, int x1, int x2);
+
   public:
     VUMeter(int X, int Y, int W, int H, const char *L = 0);
+    ~VUMeter();
 
     void value(float left, float right, float left_peak, float right_peak);
     int dB_to_xpos(float dB);
@@ -64,7 +64,10 @@
 #include "command.h"
 #include "url.h"
 #include "atom.h"
+#include "song_update.h"
+#include "song_file.h"
 #include "aes67_output.h"
+#include "multitrack.h"
 // Suppression de l'include Core Audio
 // #include "core_audio_output.h"
 #ifdef WITH_RADIOCO
@@ -77,8 +80,6 @@ int display_info = STREAM_TIME;
 
 pthread_t pt_connect_detached;
 
-ATOM_NEW_INT(is_updating_song, 0);
-
 int ask_user = 0;
 void *connect_thread(void *data)
 {
@@ -390,7 +391,8 @@ void button_connect_cb(void)
         Fl::add_timeout(0.5, &app_timer, &reset);
     }
 
-    reset_stream_silence_detection_timer();
+    reset_stream_silence_detection();
+    stop_stream_signal_detection();
 
     snd_start_streaming_thread();
 
@@ -417,7 +419,7 @@ void button_connect_cb(void)
     return;
 
 not_connected:
-    reset_stream_signal_detection_timer();
+    reset_stream_signal_detection();
     return;
 }
 
@@ -911,7 +913,7 @@ void button_disconnect_cb(bool ask)
     try_to_connect = 0;
     disconnect = 1;
 
-    reset_stream_signal_detection_timer();
+    reset_stream_signal_detection();
 
     activate_stream_ui_elements();
 
@@ -923,13 +925,14 @@ void button_disconnect_cb(bool ask)
     }
 
     Fl::remove_timeout(&songfile_timer);
+    song_file_watch_stop();
     Fl::remove_timeout(&app_timer);
     Fl::remove_timeout(&is_connected_timer);
     Fl::remove_timeout(&reconnect_timer);
     Fl::remove_timeout(&song_url_timer);
 
     if (connected) {
-        Fl::remove_timeout(&stream_silence_timer);
+        stop_stream_silence_detection();
         snd_stop_streaming_thread();
 
         if (cfg.srv[cfg.selected_srv]->type == ICECAST) {
@@ -974,7 +977,7 @@ bool stop_recording(bool ask)
             return false;
     }
 
-    Fl::remove_timeout(&record_silence_timer);
+    stop_record_silence_detection();
     snd_stop_recording_thread();
 
     activate_rec_ui_elements();
@@ -989,7 +992,7 @@ bool stop_recording(bool ask)
         display_info = cfg.gui.default_stream_info;
     }
 
-    reset_record_signal_detection_timer();
+    reset_record_signal_detection();
 
     fl_g->button_record->color(FL_BACKGROUND_COLOR);
     fl_g->button_record->redraw();
@@ -1022,6 +1025,7 @@ void button_record_cb(bool ask)
         switch (rc) {
         case 0: // overwrite pressed
             strcpy(mode, "wb+");
+            cfg.rec.mt_open_mode = MT_OPEN_OVERWRITE;
             break;
         case 1: // cancel pressed
             fl_alert(_("Recording canceled"));
@@ -1029,10 +1033,13 @@ void button_record_cb(bool ask)
             break;
         case 2: // append pressed
             strcpy(mode, "ab");
+            cfg.rec.mt_open_mode = MT_OPEN_APPEND;
         }
     }
     else { // selected file doesn't exist yet
         strcpy(mode, "wb+");
+        // The multitrack recording may exist even if the program recording doesn't
+        cfg.rec.mt_open_mode = cfg.rec.overwrite_files ? MT_OPEN_OVERWRITE : MT_OPEN_KEEP;
     }
 
     if ((cfg.rec.fd = fl_fopen(cfg.rec.path, mode)) == NULL) {
@@ -1061,8 +1068,8 @@ void button_record_cb(bool ask)
         split_recording_file_timer();
     }
 
-    reset_record_silence_detection_timer();
-    Fl::remove_timeout(&record_signal_timer);
+    reset_record_silence_detection();
+    stop_record_signal_detection();
 
     if (!connected) {
         display_info = REC_TIME;
@@ -1075,7 +1082,7 @@ void button_record_cb(bool ask)
     return;
 
 not_recording:
-    reset_record_signal_detection_timer();
+    reset_record_signal_detection();
     return;
 }
 
@@ -1124,8 +1131,28 @@ void choice_cfg_act_icy_cb(void)
     strcpy(cfg.main.icy, cfg.icy[cfg.selected_icy]->name);
 }
 
+// The server dialog is built on first use, features that are missing in this build are disabled once it exists
+static void make_add_srv_window(void)
+{
+    if (fl_g->window_add_srv != NULL) {
+        return;
+    }
+
+    fl_g->make_window_add_srv();
+
+#ifndef WITH_RADIOCO
+    fl_g->radio_add_srv_radioco->hide();
+#endif
+
+#ifndef HAVE_LIBDATACHANNEL
+    fl_g->radio_add_srv_webrtc->deactivate();
+    fl_g->radio_add_srv_webrtc->tooltip(_("butt was built without WebRTC support"));
+#endif
+}
+
 void button_cfg_add_srv_cb(void)
 {
+    make_add_srv_window();
     fl_g->window_add_srv->label(_("Add Server"));
     fl_g->radio_add_srv_shoutcast->setonly();
     fl_g->input_add_srv_mount->deactivate();
@@ -1179,6 +1206,7 @@ void button_cfg_edit_srv_cb(void)
         return;
     }
 
+    make_add_srv_window();
     fl_g->window_add_srv->label(_("Edit Server"));
 
     srv = fl_g->choice_cfg_act_srv->value();
@@ -1270,6 +1298,7 @@ void button_cfg_edit_srv_cb(void)
 
 void button_cfg_add_icy_cb(void)
 {
+    fl_g->make_window_add_icy();
     fl_g->window_add_icy->label(_("Add Server Infos"));
 
     fl_g->button_add_icy_save->hide();
@@ -1286,12 +1315,9 @@ void update_song(void *user_data)
 {
     int prefix_len = 0;
     int suffix_len = 0;
-    char text_buf[512];
     char song_buf[512];
     song_buf[0] = '\0';
 
-    int (*xc_update_song)(char *song_name) = NULL;
-
     int called_from_connect_cb;
     if (user_data != NULL) {
         called_from_connect_cb = *((int *)user_data);
@@ -1309,12 +1335,6 @@ void update_song(void *user_data)
         return;
     }
 
-    // Make sure that song update is not triggered from different places at the same time
-    if (atom_get_int(&is_updating_song) == 1) {
-        return;
-    }
-    atom_set_int(&is_updating_song, 1);
-
     if (cfg.main.song_prefix != NULL) {
         prefix_len = strlen(cfg.main.song_prefix);
         snprintf(song_buf, sizeof(song_buf), "%s", cfg.main.song_prefix);
@@ -1327,40 +1347,13 @@ void update_song(void *user_data)
         strncat(song_buf, cfg.main.song_suffix, sizeof(song_buf) - 1 - prefix_len - suffix_len);
     }
 
-    if (!strcmp(cfg.audio.codec, "flac")) {
-        if (called_from_connect_cb == 0) {
-            flac_update_song_title(&flac_stream, song_buf);
-        }
-        else {
-            flac_set_initial_song_title(&flac_stream, song_buf);
-        }
-    }
-
-    if (!strcmp(cfg.audio.codec, "opus")) {
-        opus_update_song_title(&opus_stream, song_buf);
-    }
-
-    if (cfg.srv[cfg.selected_srv]->type == ICECAST) {
-        xc_update_song = &ic_update_song;
-    }
-    else { // if(cfg.srv[cfg.selected_srv]->type == SHOUTCAST)
-        xc_update_song = &sc_update_song;
-    }
-
-    if (xc_update_song(song_buf) == 0) {
-        snprintf(text_buf, sizeof(text_buf), _("Updated songname to:\n%s\n"), song_buf);
-
-        print_info(text_buf, 0);
-#ifdef WIN32
-        tray_agent_set_song(song_buf);
-        tray_agent_send_cmd(TA_SONG_UPDATE);
-#endif
-    }
-    else {
-        print_info(_("Updating songname failed"), 1);
+    // The network i/o happens on the song update thread. Titles from the song file, song url,
+    // app and manual input that arrive in quick succession are coalesced there
+    if (song_update_init() != 0) {
+        print_info("Fatal error: Could not launch song update thread. Please restart BUTT", 1);
+        return;
     }
-
-    atom_set_int(&is_updating_song, 0);
+    song_update_submit(song_buf, timer_get_cur_time(), called_from_connect_cb);
 }
 
 void button_cfg_song_go_cb(void)
@@ -2662,6 +2655,7 @@ void button_cfg_edit_icy_cb(void)
 
     int icy = fl_g->choice_cfg_act_icy->value();
 
+    fl_g->make_window_add_icy();
     fl_g->window_add_icy->label(_("Edit Server Infos"));
 
     fl_g->button_add_icy_add->hide();
@@ -2719,7 +2713,7 @@ void choice_cfg_dev_cb(void)
 
     cfg.audio.dev_num = new_dev_num;
     update_samplerates_list();
-    if (snd_reopen_streams() != 0) {
+    if (snd_switch_primary_device() != 0 && snd_reopen_streams() != 0) {
         fl_alert(_("butt could not open selected audio device.\nPlease try another device.\n"));
 
         // Fall back to previous selected primary device
@@ -2815,7 +2809,7 @@ void button_cfg_rescan_devices_cb(void)
     snd_free_device_list(cfg.audio.pcm_list, cfg.audio.dev_count);
     snd_init();
 
-    cfg.audio.pcm_list = snd_get_devices(&dev_count);
+    cfg.audio.pcm_list = snd_get_devices(&dev_count, SND_DEVICES_CACHED);
     cfg.audio.dev_count = dev_count;
 
     fl_g->choice_cfg_dev->clear();
@@ -2843,6 +2837,7 @@ void button_cfg_rescan_devices_cb(void)
     }
 
     snd_open_streams();
+    refresh_audio_devices();
 
     fl_g->choice_cfg_dev->value(cfg.audio.dev_num);
     fl_g->choice_cfg_dev2->value(cfg.audio.dev2_num + 1);
@@ -2995,7 +2990,7 @@ void choice_cfg_codec_aac_cb(void)
 {
 #ifdef HAVE_LIBFDK_AAC
     if (g_aac_lib_available == 0) {
-        fl_g->window_missing_aac_lib->position(fl_g->window_cfg->x(), fl_g->window_cfg->y() + fl_g->window_cfg->h() / 2);
+        fl_g->make_window_missing_aac_lib()->position(fl_g->window_cfg->x(), fl_g->window_cfg->y() + fl_g->window_cfg->h() / 2);
         fl_g->window_missing_aac_lib->show();
         if (!strcmp(cfg.audio.codec, "ogg")) {
             fl_g->choice_cfg_codec->value(CHOICE_OGG);
@@ -3194,7 +3189,7 @@ void choice_rec_codec_aac_cb(void)
 {
 #ifdef HAVE_LIBFDK_AAC
     if (g_aac_lib_available == 0) {
-        fl_g->window_missing_aac_lib->position(fl_g->window_cfg->x(), fl_g->window_cfg->y() + fl_g->window_cfg->h() / 2);
+        fl_g->make_window_missing_aac_lib()->position(fl_g->window_cfg->x(), fl_g->window_cfg->y() + fl_g->window_cfg->h() / 2);
         fl_g->window_missing_aac_lib->show();
 
         if (!strcmp(cfg.rec.codec, "ogg")) {
@@ -3409,6 +3404,11 @@ void ILM216_cb(void)
             break;
 
         case STREAM_STATE:
+            display_info = LOUDNESS;
+            cfg.gui.default_stream_info = display_info;
+            break;
+
+        case LOUDNESS:
             if (recording) {
                 display_info = REC_DATA;
             }
@@ -3883,6 +3883,7 @@ void input_cfg_present_level_cb(void)
     }
 
     cfg.audio.signal_level = -fl_g->input_cfg_present_level->value();
+    update_level_detection_levels();
 }
 
 void input_cfg_absent_level_cb(void)
@@ -3898,6 +3899,7 @@ void input_cfg_absent_level_cb(void)
     }
 
     cfg.audio.silence_level = -fl_g->input_cfg_absent_level->value();
+    update_level_detection_levels();
 }
 
 void check_stream_signal_cb(void)
@@ -3909,10 +3911,10 @@ void check_stream_signal_cb(void)
             fl_g->input_cfg_signal->value(1);
             cfg.main.signal_threshold = fl_g->input_cfg_signal->value();
         }
-        reset_stream_signal_detection_timer();
+        reset_stream_signal_detection();
     }
     else {
-        Fl::remove_timeout(&stream_signal_timer);
+        stop_stream_signal_detection();
     }
 }
 
@@ -3925,10 +3927,10 @@ void check_stream_silence_cb(void)
             fl_g->input_cfg_silence->value(1);
             cfg.main.silence_threshold = fl_g->input_cfg_silence->value();
         }
-        reset_stream_silence_detection_timer();
+        reset_stream_silence_detection();
     }
     else {
-        Fl::remove_timeout(&stream_silence_timer);
+        stop_stream_silence_detection();
     }
 }
 
@@ -3939,8 +3941,8 @@ void input_cfg_signal_cb(void)
         fl_g->input_cfg_signal->value(0.1);
     }
 
-    reset_stream_signal_detection_timer();
     cfg.main.signal_threshold = fl_g->input_cfg_signal->value();
+    reset_stream_signal_detection();
 }
 
 void input_cfg_silence_cb(void)
@@ -3950,8 +3952,8 @@ void input_cfg_silence_cb(void)
         fl_g->input_cfg_silence->value(0.1);
     }
 
-    reset_stream_silence_detection_timer();
     cfg.main.silence_threshold = fl_g->input_cfg_silence->value();
+    reset_stream_silence_detection();
 }
 
 void input_cfg_reconnect_delay_cb(void)
@@ -3968,10 +3970,10 @@ void check_rec_signal_cb(void)
             fl_g->input_rec_signal->value(1);
             cfg.rec.signal_threshold = fl_g->input_rec_signal->value();
         }
-        reset_record_signal_detection_timer();
+        reset_record_signal_detection();
     }
     else {
-        Fl::remove_timeout(&record_signal_timer);
+        stop_record_signal_detection();
     }
 }
 
@@ -3984,11 +3986,10 @@ void check_rec_silence_cb(void)
             fl_g->input_rec_silence->value(1);
             cfg.rec.silence_threshold = fl_g->input_rec_silence->value();
         }
-        Fl::remove_timeout(&record_silence_timer);
-        Fl::add_timeout(1, &record_silence_timer);
+        reset_record_silence_detection();
     }
     else {
-        Fl::remove_timeout(&record_silence_timer);
+        stop_record_silence_detection();
     }
 }
 
@@ -3999,8 +4000,8 @@ void input_rec_signal_cb(void)
         fl_g->input_rec_signal->value(0.1);
     }
 
-    reset_record_signal_detection_timer();
     cfg.rec.signal_threshold = fl_g->input_rec_signal->value();
+    reset_record_signal_detection();
 }
 
 void input_rec_silence_cb(void)
@@ -4010,8 +4011,8 @@ void input_rec_silence_cb(void)
         fl_g->input_rec_silence->value(0.1);
     }
 
-    reset_record_silence_detection_timer();
     cfg.rec.silence_threshold = fl_g->input_rec_silence->value();
+    reset_record_silence_detection();
 }
 
 void check_song_update_active_cb(void)
@@ -4026,6 +4027,7 @@ void check_song_update_active_cb(void)
     }
     else {
         Fl::remove_timeout(&songfile_timer);
+        song_file_watch_stop();
         if (cfg.main.song != NULL) {
             free(cfg.main.song);
             cfg.main.song = NULL;
@@ -4327,10 +4329,6 @@ void window_main_close_cb(bool ask)
         extern void is_connected_timer(void *);
         extern void cfg_win_pos_timer(void *);
         extern void request_listener_count_timer(void *);
-        extern void stream_signal_timer(void *);
-        extern void record_signal_timer(void *);
-        extern void stream_silence_timer(void *);
-        extern void record_silence_timer(void *);
         extern void songfile_timer(void *);
         extern void song_url_timer(void *);
         extern void app_timer(void *);
@@ -4342,11 +4340,12 @@ void window_main_close_cb(bool ask)
         Fl::remove_timeout(&is_connected_timer);
         Fl::remove_timeout(&cfg_win_pos_timer);
         Fl::remove_timeout(&request_listener_count_timer);
-        Fl::remove_timeout(&stream_signal_timer);
-        Fl::remove_timeout(&record_signal_timer);
-        Fl::remove_timeout(&stream_silence_timer);
-        Fl::remove_timeout(&record_silence_timer);
+        stop_stream_signal_detection();
+        stop_record_signal_detection();
+        stop_stream_silence_detection();
+        stop_record_silence_detection();
         Fl::remove_timeout(&songfile_timer);
+        song_file_watch_stop();
         Fl::remove_timeout(&song_url_timer);
         Fl::remove_timeout(&app_timer);
         // VU flags
@@ -4480,10 +4479,6 @@ void window_main_close_cb(bool ask)
     extern void is_connected_timer(void *);
     extern void cfg_win_pos_timer(void *);
     extern void request_listener_count_timer(void *);
-    extern void stream_signal_timer(void *);
-    extern void record_signal_timer(void *);
-    extern void stream_silence_timer(void *);
-    extern void record_silence_timer(void *);
     extern void songfile_timer(void *);
     extern void song_url_timer(void *);
     extern void app_timer(void *);
@@ -4495,11 +4490,12 @@ void window_main_close_cb(bool ask)
     Fl::remove_timeout(&is_connected_timer);
     Fl::remove_timeout(&cfg_win_pos_timer);
     Fl::remove_timeout(&request_listener_count_timer);
-    Fl::remove_timeout(&stream_signal_timer);
-    Fl::remove_timeout(&record_signal_timer);
-    Fl::remove_timeout(&stream_silence_timer);
-    Fl::remove_timeout(&record_silence_timer);
+    stop_stream_signal_detection();
+    stop_record_signal_detection();
+    stop_stream_silence_detection();
+    stop_record_silence_detection();
     Fl::remove_timeout(&songfile_timer);
+    song_file_watch_stop();
     Fl::remove_timeout(&song_url_timer);
     Fl::remove_timeout(&app_timer);
     extern int g_stop_vu_meter_timer;
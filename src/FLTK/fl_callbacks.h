@@ -22,6 +22,7 @@ enum {
     SENT_DATA = 2,
     REC_DATA = 3,
     STREAM_STATE = 4,
+    LOUDNESS = 5,
 };
 
 enum {
@@ -40,6 +40,7 @@
 #include "icecast.h"
 #include "strfuncs.h"
 #include "fl_callbacks.h"
+#include "file_watch.h"
 #include "../aes67_output.h"
 
 pthread_mutex_t write_log_mutex = PTHREAD_MUTEX_INITIALIZER;
@@ -210,35 +211,9 @@ void populate_midi_dev_list(void)
     midi_free_device_list(dev_list);
 }
 
-void fill_cfg_widgets(void)
+void fill_srv_icy_widgets(void)
 {
     int i;
-    int stream_codec_idx = 0;
-    int rec_codec_idx = 0;
-
-#ifndef HAVE_LIBFDK_AAC
-    fl_g->menu_item_cfg_aac->hide();
-    fl_g->menu_item_rec_aac->hide();
-    Fl::check();
-#endif
-
-    // fill the main section
-    fl_g->choice_cfg_dev->textsize(14);
-    fl_g->choice_cfg_dev2->textsize(14);
-
-    fl_g->choice_cfg_dev2->add(_("None"));
-    for (i = 0; i < cfg.audio.dev_count; i++) {
-        unsigned long dev_name_len = strlen(cfg.audio.pcm_list[i]->name) + 10;
-        char *dev_name = (char *)malloc(dev_name_len);
-
-        snprintf(dev_name, dev_name_len, "%d: %s", i, cfg.audio.pcm_list[i]->name);
-        fl_g->choice_cfg_dev->add(dev_name);
-        fl_g->choice_cfg_dev2->add(dev_name);
-        free(dev_name);
-    }
-
-    fl_g->choice_cfg_dev->value(cfg.audio.dev_num);
-    fl_g->choice_cfg_dev2->value(cfg.audio.dev2_num + 1);
 
     fl_g->choice_cfg_act_srv->clear();
     fl_g->choice_cfg_act_srv->redraw();
@@ -275,6 +250,74 @@ void fill_cfg_widgets(void)
 
     fl_g->choice_cfg_act_srv->value(cfg.selected_srv);
     fl_g->choice_cfg_act_icy->value(cfg.selected_icy);
+}
+
+void fill_dsp_widgets(void)
+{
+    fl_g->check_stream_eq->value(cfg.dsp.equalizer_stream);
+    fl_g->check_rec_eq->value(cfg.dsp.equalizer_rec);
+
+    int choice_eq_idx;
+    if (strcmp(cfg.dsp.eq_preset, "Manual") == 0) {
+        choice_eq_idx = 0;
+    }
+    else {
+        choice_eq_idx = fl_g->choice_eq_preset->find_index(cfg.dsp.eq_preset);
+    }
+    fl_g->choice_eq_preset->value(choice_eq_idx);
+    fl_g->choice_eq_preset->do_callback();
+
+    fl_g->check_stream_drc->value(cfg.dsp.compressor_stream);
+    fl_g->check_rec_drc->value(cfg.dsp.compressor_rec);
+    fl_g->check_aggressive_mode->value(cfg.dsp.aggressive_mode);
+
+    slider_threshold_cb(cfg.dsp.threshold);
+    fl_g->thresholdSlider->value(cfg.dsp.threshold);
+
+    slider_ratio_cb(cfg.dsp.ratio);
+    fl_g->ratioSlider->value(cfg.dsp.ratio);
+
+    slider_attack_cb(cfg.dsp.attack);
+    fl_g->attackSlider->value(cfg.dsp.attack);
+
+    slider_release_cb(cfg.dsp.release);
+    fl_g->releaseSlider->value(cfg.dsp.release);
+
+    slider_makeup_cb(cfg.dsp.makeup_gain);
+    fl_g->makeupSlider->value(cfg.dsp.makeup_gain);
+}
+
+void fill_cfg_widgets(void)
+{
+    int i;
+    int stream_codec_idx = 0;
+    int rec_codec_idx = 0;
+
+#ifndef HAVE_LIBFDK_AAC
+    fl_g->menu_item_cfg_aac->hide();
+    fl_g->menu_item_rec_aac->hide();
+    Fl::check();
+#endif
+
+    // fill the main section
+    fl_g->choice_cfg_dev->textsize(14);
+    fl_g->choice_cfg_dev2->textsize(14);
+
+    fl_g->choice_cfg_dev2->add(_("None"));
+    for (i = 0; i < cfg.audio.dev_count; i++) {
+        unsigned long dev_name_len = strlen(cfg.audio.pcm_list[i]->name) + 10;
+        char *dev_name = (char *)malloc(dev_name_len);
+
+        snprintf(dev_name, dev_name_len, "%d: %s", i, cfg.audio.pcm_list[i]->name);
+        fl_g->choice_cfg_dev->add(dev_name);
+        fl_g->choice_cfg_dev2->add(dev_name);
+        free(dev_name);
+    }
+
+    fl_g->choice_cfg_dev->value(cfg.audio.dev_num);
+    fl_g->choice_cfg_dev2->value(cfg.audio.dev2_num + 1);
+
+    fill_srv_icy_widgets();
 
     fl_g->check_cfg_connect->value(cfg.main.connect_at_startup);
     fl_g->check_cfg_force_reconnecting->value(cfg.main.force_reconnecting);
@@ -472,38 +515,7 @@ void fill_cfg_widgets(void)
     update_samplerates_list();
     update_channel_lists();
 
-    // fill the DSP section
-    fl_g->check_stream_eq->value(cfg.dsp.equalizer_stream);
-    fl_g->check_rec_eq->value(cfg.dsp.equalizer_rec);
-
-    int choice_eq_idx;
-    if (strcmp(cfg.dsp.eq_preset, "Manual") == 0) {
-        choice_eq_idx = 0;
-    }
-    else {
-        choice_eq_idx = fl_g->choice_eq_preset->find_index(cfg.dsp.eq_preset);
-    }
-    fl_g->choice_eq_preset->value(choice_eq_idx);
-    fl_g->choice_eq_preset->do_callback();
-
-    fl_g->check_stream_drc->value(cfg.dsp.compressor_stream);
-    fl_g->check_rec_drc->value(cfg.dsp.compressor_rec);
-    fl_g->check_aggressive_mode->value(cfg.dsp.aggressive_mode);
-
-    slider_threshold_cb(cfg.dsp.threshold);
-    fl_g->thresholdSlider->value(cfg.dsp.threshold);
-
-    slider_ratio_cb(cfg.dsp.ratio);
-    fl_g->ratioSlider->value(cfg.dsp.ratio);
-
-    slider_attack_cb(cfg.dsp.attack);
-    fl_g->attackSlider->value(cfg.dsp.attack);
-
-    slider_release_cb(cfg.dsp.release);
-    fl_g->releaseSlider->value(cfg.dsp.release);
-
-    slider_makeup_cb(cfg.dsp.makeup_gain);
-    fl_g->makeupSlider->value(cfg.dsp.makeup_gain);
+    fill_dsp_widgets();
 
     // fill audio mixer
     slider_mixer_primary_device_cb(util_factor_to_db(cfg.mixer.primary_device_gain), (void *)CB_CALLED_BY_CODE);
@@ -915,6 +927,25 @@ void update_samplerates_list(void)
     }
 }
 
+static void device_refresh_cb(void *)
+{
+    if (snd_apply_device_refresh() == 1) {
+        update_samplerates_list();
+    }
+}
+
+static void device_refresh_done(void)
+{
+    Fl::awake(&device_refresh_cb, NULL);
+}
+
+// Probes the audio devices in the background, the samplerate list
+// is updated if the result differs from the device cache
+void refresh_audio_devices(void)
+{
+    snd_refresh_devices(&device_refresh_done);
+}
+
 void update_channel_lists(void)
 {
     int i;
@@ -1429,6 +1460,11 @@ void init_main_gui_and_audio(void)
     opus_stream.audio_type = cfg.opus_codec_stream.audio_type;
     opus_stream.quality = cfg.opus_codec_stream.quality;
     opus_stream.bandwidth = cfg.opus_codec_stream.bandwidth;
+    opus_stream.page_duration = cfg.opus_codec_stream.page_duration;
+    opus_stream.frame_size = cfg.opus_codec_stream.webrtc_frame_size;
+    opus_stream.fec = cfg.opus_codec_stream.webrtc_fec;
+    opus_stream.packet_loss = cfg.opus_codec_stream.webrtc_packet_loss;
+    opus_stream.dtx = cfg.opus_codec_stream.webrtc_dtx;
     opus_enc_alloc(&opus_stream);
     opus_enc_init(&opus_stream);
 
@@ -1439,6 +1475,7 @@ void init_main_gui_and_audio(void)
     opus_rec.audio_type = cfg.opus_codec_rec.audio_type;
     opus_rec.quality = cfg.opus_codec_rec.quality;
     opus_rec.bandwidth = cfg.opus_codec_rec.bandwidth;
+    opus_rec.page_duration = cfg.opus_codec_rec.page_duration;
     opus_enc_alloc(&opus_rec);
     opus_enc_init(&opus_rec);
 
@@ -2002,6 +2039,106 @@ int get_midi_ctrl_type(int midi_cmd)
     }
 }
 
+// Settings that were changed in the config file by another program or by hand are applied
+// while butt is running. Server and ICY settings are only replaced while disconnected
+static file_watch cfg_watch;
+
+static void update_song_widgets(void)
+{
+    fl_g->check_song_update_active->value(cfg.main.song_update);
+    fl_g->check_read_last_line->value(cfg.main.read_last_line);
+    fl_g->choice_cfg_song_delay->value(cfg.main.song_delay / 2);
+    fl_g->input_cfg_song_file->value(cfg.main.song_path);
+    fl_g->input_cfg_song_prefix->value(cfg.main.song_prefix);
+    fl_g->input_cfg_song_suffix->value(cfg.main.song_suffix);
+
+    fl_g->check_cfg_update_from_url->value(cfg.main.song_update_url_active);
+    fl_g->input_cfg_url_update_song_interval->value(cfg.main.song_update_url_interval);
+    fl_g->input_cfg_song_url->value(cfg.main.song_update_url);
+
+    // Restart the song timers with the new settings
+    check_song_update_active_cb();
+    check_cfg_update_from_url_cb();
+
+#if (__APPLE__ && __MACH__) || ((__linux__ || __FreeBSD__) && HAVE_DBUS)
+    fl_g->check_cfg_use_app->value(cfg.main.app_update);
+    fl_g->choice_cfg_app->value(cfg.main.app_update_service);
+    if (cfg.main.app_artist_title_order == APP_ARTIST_FIRST) {
+        fl_g->radio_cfg_artist_title->setonly();
+    }
+    else {
+        fl_g->radio_cfg_title_artist->setonly();
+    }
+    choice_cfg_app_cb();
+    check_cfg_use_app_cb();
+#endif
+}
+
+static void cfg_reload_pending_timer(void *);
+
+static void apply_cfg_changes(void)
+{
+    int applied, pending;
+    int allowed = CFG_RELOAD_SONG | CFG_RELOAD_DSP;
+
+    // A running connection keeps the server and ICY data it was started with
+    if (!connected && !try_to_connect) {
+        allowed |= CFG_RELOAD_SERVERS | CFG_RELOAD_ICY;
+    }
+
+    applied = cfg_reload(allowed, &pending);
+    if (applied == -1) {
+        print_info(_("Could not reload the changed config file"), 1);
+        return;
+    }
+
+    if (applied & (CFG_RELOAD_SERVERS | CFG_RELOAD_ICY)) {
+        fill_srv_icy_widgets();
+    }
+    if (applied & CFG_RELOAD_SONG) {
+        update_song_widgets();
+    }
+    if (applied & CFG_RELOAD_DSP) {
+        fill_dsp_widgets();
+    }
+
+    if (applied != 0) {
+        print_info(_("Config file has changed, settings reloaded"), 0);
+    }
+
+    Fl::remove_timeout(&cfg_reload_pending_timer);
+    if (pending != 0) {
+        print_info(_("Config file has changed, server and ICY settings will be reloaded after disconnecting"), 0);
+        Fl::add_timeout(1, &cfg_reload_pending_timer);
+    }
+}
+
+static void cfg_reload_pending_timer(void *)
+{
+    if (connected || try_to_connect) {
+        Fl::repeat_timeout(1, &cfg_reload_pending_timer);
+        return;
+    }
+    apply_cfg_changes();
+}
+
+static void cfg_changed_awake_cb(void *)
+{
+    apply_cfg_changes();
+}
+
+// Called from the watcher thread
+static void cfg_changed(void *, int)
+{
+    Fl::awake(&cfg_changed_awake_cb, NULL);
+}
+
+int start_cfg_watch(void)
+{
+    file_watch_stop(&cfg_watch);
+    return file_watch_start(&cfg_watch, cfg_path, CFG_WATCH_DEBOUNCE_MS, &cfg_changed, NULL);
+}
+
 // Fonction personnalisée pour vérifier les signaux de fermeture
 int gui_loop_with_signal_check(void)
 {
@@ -24,7 +24,10 @@ int gui_loop_with_signal_check(void);
 #define CHECK_EVENTS() Fl::check()
 
 void fill_cfg_widgets(void);
+void fill_srv_icy_widgets(void);
+void fill_dsp_widgets(void);
 void update_samplerates_list(void);
+void refresh_audio_devices(void);
 void update_codec_samplerates(void);
 void update_channel_lists(void);
 void print_info(const char *info, int info_type);
@@ -54,11 +57,20 @@ int get_bitrate_index(int codec, int bitrate);
 int get_codec_index(char *codec);
 int get_midi_ctrl_type(int midi_command);
 
+#define CFG_WATCH_DEBOUNCE_MS 200
+
+// Watches the config file and applies the settings that were changed by someone else, see cfg_reload().
+// Returns -1 if the platform can't watch files
+int start_cfg_watch(void);
+
 typedef const char *(*currentTrackFunction)(int);
 #ifdef __cplusplus
 extern "C" {
 #endif
 extern currentTrackFunction getCurrentTrackFunctionFromId(int i);
+// Starts listening for track changes of the music players. <on_change> is called from a background
+// thread whenever a player has changed. Returns -1 if the platform has to be polled
+extern int currentTrackWatch(void (*on_change)(void));
 #ifdef __cplusplus
 }
 #endif
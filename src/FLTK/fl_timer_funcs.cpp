@@ -38,6 +38,7 @@
 #include "butt.h"
 #include "util.h"
 #include "port_audio.h"
+#include "song_file.h"
 #include "timer.h"
 #include "flgui.h"
 #include "fl_funcs.h"
@@ -48,8 +49,11 @@
 #include "fl_timer_funcs.h"
 #include "fl_callbacks.h"
 #include "logos.h"
+#include "packbits.h"
 #include "Fl_LED.h"
 #include "command.h"
+#include "metrics.h"
+#include "level_detect.h"
 #include "url.h"
 #ifdef WITH_RADIOCO
 #include "radioco.h"
@@ -59,16 +63,22 @@
 #include "CurrentTrackOSX.h"
 #endif
 
+// cmd_timer interval while the command fifo holds more commands (seconds)
+#define CMD_TIMER_BUSY_INTERVAL 0.01
+
 const char *(*current_track_app)(int);
 
 void split_recording_file(void);
 
 pthread_t split_recording_file_thread_detached;
 pthread_t request_listener_count_thread_detached;
+int request_listener_count_thread_started = 0;
 pthread_t url_song_update_thread_detached;
 
 ATOM_NEW_INT(url_song_update_thread_running, 0);
 ATOM_NEW_INT(request_listener_count_thread_running, 0);
+ATOM_NEW_INT(request_listener_count_reset, 0);
+ATOM_NEW_COND(request_listener_count_cond);
 ATOM_NEW_INT(g_listener_count, -1);
 ATOM_NEW_INT(failed_get_listener_tries, 0);
 
@@ -93,11 +103,94 @@ void set_threshold_input_from_command(command_t *command, Fl_Value_Input *input,
     }
 }
 
+static int16_t loudness_to_status(double value)
+{
+    if (value <= -3276.7) { // Includes -inf
+        return STATUS_LOUDNESS_NONE;
+    }
+    if (value >= 3276.7) {
+        return INT16_MAX;
+    }
+    return (int16_t)round(10 * value);
+}
+
+// The command server answers status requests on its own thread.
+// It serves the status that is published here on every cmd_timer tick
+static void publish_command_status(void)
+{
+    status_packet_t status_packet;
+    loudness_values_t loudness;
+    status_packet.version = STATUS_PACKET_VERSION;
+
+    status_packet.status = (1 << STATUS_EXTENDED_PACKET) | (connected << STATUS_CONNECTED) | (try_to_connect << STATUS_CONNECTING) |
+                           (recording << STATUS_RECORDING) | (signal_detected << STATUS_SIGNAL_DETECTED) | (silence_detected << STATUS_SILENCE_DETECTED);
+
+    status_packet.volume_left = round(10 * fl_g->vumeter->left_dB);
+    status_packet.volume_right = round(10 * fl_g->vumeter->right_dB);
+
+    if (connected == 1) {
+        status_packet.stream_seconds = (uint32_t)timer_get_elapsed_time(&stream_timer);
+        status_packet.stream_kByte = kbytes_sent;
+        status_packet.listener_count = atom_get_int(&g_listener_count);
+    }
+    else {
+        status_packet.stream_seconds = 0;
+        status_packet.stream_kByte = 0;
+        status_packet.listener_count = -1;
+    }
+    metrics_set(METRIC_LISTENERS, status_packet.listener_count);
+
+    if (recording == 1) {
+        status_packet.record_seconds = (uint32_t)timer_get_elapsed_time(&rec_timer);
+        status_packet.record_kByte = kbytes_written;
+        status_packet.rec_path = strdup(cfg.rec.path);
+#ifdef WIN32
+        // Replace '/' with '\\'
+        // Note: strrpl(&status_packet.rec_path,...) must not be used at this point because addresses of packed struct members may be unaligned
+        char *p;
+        while ((p = strchr(status_packet.rec_path, '/')) != NULL) {
+            *p = '\\';
+        }
+#endif
+    }
+    else {
+        status_packet.record_seconds = 0;
+        status_packet.record_kByte = 0;
+        status_packet.rec_path = strdup("");
+    }
+    status_packet.rec_path_len = strlen(status_packet.rec_path) + 1;
+
+    if (cfg.main.song != NULL) {
+        status_packet.song = strdup(cfg.main.song);
+    }
+    else {
+        status_packet.song = strdup("");
+    }
+    status_packet.song_len = strlen(status_packet.song) + 1;
+
+    snd_get_loudness(&loudness);
+    status_packet.loudness[STATUS_LOUDNESS_MOMENTARY] = loudness_to_status(loudness.momentary);
+    status_packet.loudness[STATUS_LOUDNESS_SHORT_TERM] = loudness_to_status(loudness.short_term);
+    status_packet.loudness[STATUS_LOUDNESS_INTEGRATED] = loudness_to_status(loudness.integrated);
+    status_packet.loudness[STATUS_LOUDNESS_RANGE] = loudness_to_status(loudness.range);
+    status_packet.loudness[STATUS_LOUDNESS_TRUE_PEAK] = loudness_to_status(loudness.true_peak);
+
+    command_set_status(&status_packet);
+
+    free(status_packet.song);
+    free(status_packet.rec_path);
+}
+
+// Commands that arrive in a burst are executed back to back instead of one per 250 ms
 void cmd_timer(void *)
 {
     command_t command;
+
+    publish_command_status();
+
     if (command_get_cmd_from_fifo(&command) < (int)sizeof(command_t)) {
-        Fl::repeat_timeout(0.25, &cmd_timer);
+        // Status subscribers may ask for up to 20 events per second
+        Fl::repeat_timeout(command_has_subscribers() ? STATUS_SUB_MIN_INTERVAL / 1000.0 : 0.25, &cmd_timer);
         return;
     }
 
@@ -114,7 +207,7 @@ void cmd_timer(void *)
                     button_connect_cb();
                 }
                 else {
-                    Fl::repeat_timeout(0.25, &cmd_timer);
+                    Fl::repeat_timeout(CMD_TIMER_BUSY_INTERVAL, &cmd_timer);
                 }
 
                 if (command.param != NULL) {
@@ -127,7 +220,7 @@ void cmd_timer(void *)
             }
         }
         else {
-            Fl::repeat_timeout(0.25, &cmd_timer);
+            Fl::repeat_timeout(CMD_TIMER_BUSY_INTERVAL, &cmd_timer);
         }
         break;
     case CMD_DISCONNECT:
@@ -137,21 +230,21 @@ void cmd_timer(void *)
         else {
             try_to_connect = 0;
         }
-        Fl::repeat_timeout(0.25, &cmd_timer);
+        Fl::repeat_timeout(CMD_TIMER_BUSY_INTERVAL, &cmd_timer);
         break;
     case CMD_START_RECORDING:
         if (!recording) {
             button_record_cb(false);
         }
-        Fl::repeat_timeout(0.25, &cmd_timer);
+        Fl::repeat_timeout(CMD_TIMER_BUSY_INTERVAL, &cmd_timer);
         break;
     case CMD_STOP_RECORDING:
         stop_recording(false);
-        Fl::repeat_timeout(0.25, &cmd_timer);
+        Fl::repeat_timeout(CMD_TIMER_BUSY_INTERVAL, &cmd_timer);
         break;
     case CMD_SPLIT_RECORDING:
         split_recording_file();
-        Fl::repeat_timeout(0.25, &cmd_timer);
+        Fl::repeat_timeout(CMD_TIMER_BUSY_INTERVAL, &cmd_timer);
         break;
     case CMD_QUIT:
         window_main_close_cb(false);
@@ -162,85 +255,29 @@ void cmd_timer(void *)
          Fl::add_timeout(cfg.main.song_delay, &update_song);*/
         fl_g->input_cfg_song->value((const char *)command.param);
         fl_g->button_cfg_song_go->do_callback();
-        Fl::repeat_timeout(0.25, &cmd_timer);
+        Fl::repeat_timeout(CMD_TIMER_BUSY_INTERVAL, &cmd_timer);
         if (command.param != NULL) {
             free(command.param);
         }
         break;
     case CMD_SET_STREAM_SIGNAL_THRESHOLD:
         set_threshold_input_from_command(&command, fl_g->input_cfg_signal, fl_g->check_stream_signal);
-        Fl::repeat_timeout(0.25, &cmd_timer);
+        Fl::repeat_timeout(CMD_TIMER_BUSY_INTERVAL, &cmd_timer);
         break;
     case CMD_SET_STREAM_SILENCE_THRESHOLD:
         set_threshold_input_from_command(&command, fl_g->input_cfg_silence, fl_g->check_stream_silence);
-        Fl::repeat_timeout(0.25, &cmd_timer);
+        Fl::repeat_timeout(CMD_TIMER_BUSY_INTERVAL, &cmd_timer);
         break;
     case CMD_SET_RECORD_SIGNAL_THRESHOLD:
         set_threshold_input_from_command(&command, fl_g->input_rec_signal, fl_g->check_rec_signal);
-        Fl::repeat_timeout(0.25, &cmd_timer);
+        Fl::repeat_timeout(CMD_TIMER_BUSY_INTERVAL, &cmd_timer);
         break;
     case CMD_SET_RECORD_SILENCE_THRESHOLD:
         set_threshold_input_from_command(&command, fl_g->input_rec_silence, fl_g->check_rec_silence);
-        Fl::repeat_timeout(0.25, &cmd_timer);
-        break;
-    case CMD_GET_STATUS:
-        status_packet_t status_packet;
-        status_packet.version = STATUS_PACKET_VERSION;
-
-        status_packet.status = (1 << STATUS_EXTENDED_PACKET) | (connected << STATUS_CONNECTED) | (try_to_connect << STATUS_CONNECTING) |
-                               (recording << STATUS_RECORDING) | (signal_detected << STATUS_SIGNAL_DETECTED) | (silence_detected << STATUS_SILENCE_DETECTED);
-
-        status_packet.volume_left = round(10 * fl_g->vumeter->left_dB);
-        status_packet.volume_right = round(10 * fl_g->vumeter->right_dB);
-
-        if (connected == 1) {
-            status_packet.stream_seconds = (uint32_t)timer_get_elapsed_time(&stream_timer);
-            status_packet.stream_kByte = kbytes_sent;
-            status_packet.listener_count = atom_get_int(&g_listener_count);
-        }
-        else {
-            status_packet.stream_seconds = 0;
-            status_packet.stream_kByte = 0;
-            status_packet.listener_count = -1;
-        }
-
-        if (recording == 1) {
-            status_packet.record_seconds = (uint32_t)timer_get_elapsed_time(&rec_timer);
-            status_packet.record_kByte = kbytes_written;
-            status_packet.rec_path = strdup(cfg.rec.path);
-#ifdef WIN32
-            // Replace '/' with '\\'
-            // Note: strrpl(&status_packet.rec_path,...) must not be used at this point because addresses of packed struct members may be unaligned
-            char *p;
-            while ((p = strchr(status_packet.rec_path, '/')) != NULL) {
-                *p = '\\';
-            }
-#endif
-        }
-        else {
-            status_packet.record_seconds = 0;
-            status_packet.record_kByte = 0;
-            status_packet.rec_path = strdup("");
-        }
-        status_packet.rec_path_len = strlen(status_packet.rec_path) + 1;
-
-        if (cfg.main.song != NULL) {
-            status_packet.song = strdup(cfg.main.song);
-        }
-        else {
-            status_packet.song = strdup("");
-        }
-        status_packet.song_len = strlen(status_packet.song) + 1;
-
-        command_send_status_reply(&status_packet);
-
-        free(status_packet.song);
-        free(status_packet.rec_path);
-
-        Fl::repeat_timeout(0.25, &cmd_timer);
+        Fl::repeat_timeout(CMD_TIMER_BUSY_INTERVAL, &cmd_timer);
         break;
     default:
-        Fl::repeat_timeout(0.25, &cmd_timer);
+        Fl::repeat_timeout(CMD_TIMER_BUSY_INTERVAL, &cmd_timer);
     }
 }
 
@@ -389,6 +426,14 @@ void display_info_timer(void *reset)
         print_lcd(lcd_text_buf, strlen(lcd_text_buf), 0, 1);
     }
 
+    if (display_info == LOUDNESS) {
+        loudness_values_t loudness;
+        snd_get_loudness(&loudness);
+        snprintf(lcd_text_buf, sizeof(lcd_text_buf), "M %5.1f TP %4.1f\nI %5.1f LRA%4.1f", loudness.momentary, loudness.true_peak, loudness.integrated,
+                 loudness.range);
+        print_lcd(lcd_text_buf, strlen(lcd_text_buf), 0, 1);
+    }
+
     if (display_info == REC_TIME && timer_is_elapsed(&rec_timer)) {
         snprintf(lcd_text_buf, sizeof(lcd_text_buf), _("record time\n%s"), timer_get_time_str(&rec_timer));
         print_lcd(lcd_text_buf, strlen(lcd_text_buf), 0, 1);
@@ -411,6 +456,23 @@ void display_info_timer(void *reset)
     Fl::repeat_timeout(0.2, &display_info_timer);
 }
 
+// The logos are stored compressed, only the one that is shown is unpacked
+static Fl_Image *unpack_logo(const unsigned char *packed, int packed_len)
+{
+    unsigned char *pixels = new unsigned char[LOGO_WIDTH * LOGO_HEIGHT * LOGO_DEPTH];
+    Fl_RGB_Image *img;
+
+    if (packbits_decode_planar(packed, packed_len, pixels, LOGO_WIDTH, LOGO_HEIGHT, LOGO_DEPTH) != 0) {
+        delete[] pixels;
+        return NULL;
+    }
+
+    img = new Fl_RGB_Image(pixels, LOGO_WIDTH, LOGO_HEIGHT, LOGO_DEPTH, 0);
+    img->alloc_array = 1;
+
+    return img;
+}
+
 void rotate_sponsor_logo_timer(void *)
 {
     static int current_logo = rand() % 2;
@@ -421,14 +483,14 @@ void rotate_sponsor_logo_timer(void *)
     }
 
     if (current_logo == 0) {
-        sponsor_logo = new Fl_RGB_Image(radio_co_logo, 124, 61, 4, 0);
+        sponsor_logo = unpack_logo(radio_co_logo, sizeof(radio_co_logo));
         fl_g->sponsor_logo->callback([](Fl_Widget *w, void *u) {
             fl_open_uri("https://radio.co/?utm_source=butt&utm_medium=app");
         });
         current_logo = 1;
     }
     else if (current_logo == 1) {
-        sponsor_logo = new Fl_RGB_Image(live365_logo, 124, 61, 4, 0);
+        sponsor_logo = unpack_logo(live365_logo, sizeof(live365_logo));
         fl_g->sponsor_logo->callback([](Fl_Widget *w, void *u) {
             fl_open_uri("https://live365.com/broadcaster/radio-broadcasting?utm_source=butt&utm_medium=click&utm_campaign=onestopshop");
         });
@@ -453,6 +515,7 @@ void display_rotate_timer(void *)
 
     switch (display_info) {
     case STREAM_STATE:
+    case LOUDNESS:
     case STREAM_TIME:
         display_info = SENT_DATA;
         break;
@@ -488,6 +551,7 @@ void reconnect_timer(void *)
     if (disconnect == 1) {
         return;
     }
+    metrics_inc(METRIC_RECONNECTS);
     button_connect_cb();
 }
 
@@ -518,6 +582,7 @@ void is_connected_timer(void *)
         if (disconnect == 1) {
             return;
         }
+        metrics_inc(METRIC_CONNECTION_LOST);
 
         // Initiate delayed reconnect
         if (cfg.main.reconnect_delay > 1) {
@@ -593,14 +658,12 @@ void *split_recording_file_thread_func(void *init)
     return NULL;
 }
 
-void *request_listener_count_thread_func(void *reset)
+static void update_listener_count(int reset)
 {
     int listeners;
     static int got_listener_count = 0;
 
-    atom_set_int(&request_listener_count_thread_running, 1);
-
-    if (reset != NULL && *(int *)reset == 1) {
+    if (reset == 1) {
         got_listener_count = 0;
     }
 
@@ -648,7 +711,7 @@ void *request_listener_count_thread_func(void *reset)
     if (listeners == -1 && got_listener_count == 0) {
         int failed_tries = atom_get_int(&failed_get_listener_tries);
         atom_set_int(&failed_get_listener_tries, ++failed_tries);
-        goto return_thread;
+        return;
     }
 
     Fl::lock();
@@ -667,12 +730,29 @@ void *request_listener_count_thread_func(void *reset)
         atom_set_int(&g_listener_count, -1);
     }
     Fl::unlock();
+}
+
+// Long-lived worker: waits for request_listener_count_timer() to signal a tick.
+// Ticks that arrive while a request is in flight collapse into one, and the
+// http requests reuse the kept-alive connections of url.cpp
+void *request_listener_count_thread_func(void *data)
+{
+    (void)data;
 
-return_thread:
     // Detach thread (free ressources) because no one will call pthread_join() on it
     pthread_detach(pthread_self());
 
-    atom_set_int(&request_listener_count_thread_running, 0);
+    for (;;) {
+        atom_cond_wait(&request_listener_count_cond);
+
+        atom_set_int(&request_listener_count_thread_running, 1);
+        int reset = atom_get_int(&request_listener_count_reset);
+        atom_set_int(&request_listener_count_reset, 0);
+
+        update_listener_count(reset);
+
+        atom_set_int(&request_listener_count_thread_running, 0);
+    }
 
     return NULL;
 }
@@ -689,11 +769,20 @@ void request_listener_count_timer(void *reset)
         return;
     }
 
-    if (atom_get_int(&request_listener_count_thread_running) == 0) {
-        if (pthread_create(&request_listener_count_thread_detached, NULL, request_listener_count_thread_func, reset) != 0) {
+    if (request_listener_count_thread_started == 0) {
+        if (pthread_create(&request_listener_count_thread_detached, NULL, request_listener_count_thread_func, NULL) != 0) {
             print_info("Fatal error: Could not launch request listeners thread. Please restart BUTT", 1);
             return;
         }
+        request_listener_count_thread_started = 1;
+    }
+
+    if (reset != NULL && *(int *)reset == 1) {
+        atom_set_int(&request_listener_count_reset, 1);
+        atom_cond_signal(&request_listener_count_cond);
+    }
+    else if (atom_get_int(&request_listener_count_thread_running) == 0) {
+        atom_cond_signal(&request_listener_count_cond);
     }
 
     Fl::repeat_timeout(cfg.gui.listeners_update_rate, &request_listener_count_timer);
@@ -774,137 +863,101 @@ void split_recording_file(void)
     next_file = 1;
 }
 
-void reset_stream_signal_detection_timer(void)
+// Runs on the main thread for every detector that fired in the mixer
+static void level_event_cb(void *)
 {
-    if (cfg.main.signal_detection == 1 && cfg.main.signal_threshold > 0) {
-        Fl::remove_timeout(&stream_signal_timer);
-        Fl::add_timeout(1, &stream_signal_timer);
+    int event;
+
+    while ((event = level_detect_get_event()) != -1) {
+        switch (event) {
+        case LEVEL_STREAM_SIGNAL:
+            if (!connected && !try_to_connect) {
+                button_connect_cb();
+            }
+            break;
+        case LEVEL_STREAM_SILENCE:
+            if (connected == 1 || try_to_connect == 1) {
+                button_disconnect_cb(false);
+            }
+            break;
+        case LEVEL_REC_SIGNAL:
+            if (!recording) {
+                button_record_cb(false);
+            }
+            break;
+        case LEVEL_REC_SILENCE:
+            if (recording) {
+                stop_recording(false);
+            }
+            break;
+        default:
+            break;
+        }
     }
 }
 
-void stream_signal_timer(void *)
+static void level_events_ready(void)
 {
-    // printf("stream_signal_timer\n");
-    static timer_ms_t signal_timer;
-
-    if (signal_detected == true) {
-        if (signal_timer.is_running == false) {
-            timer_init(&signal_timer, cfg.main.signal_threshold);
-            timer_start(&signal_timer);
-        }
+    Fl::awake(&level_event_cb, NULL);
+}
 
-        if (timer_is_elapsed(&signal_timer)) {
-            button_connect_cb();
-            timer_stop(&signal_timer);
-            return;
-        }
-    }
-    else {
-        timer_stop(&signal_timer);
-    }
+void init_level_detection(void)
+{
+    update_level_detection_levels();
+    level_detect_set_notify(&level_events_ready);
+}
 
-    Fl::repeat_timeout(0.1, &stream_signal_timer);
+void update_level_detection_levels(void)
+{
+    level_detect_set_levels(-cfg.audio.silence_level, -cfg.audio.signal_level);
 }
 
-void reset_record_signal_detection_timer(void)
+void reset_stream_signal_detection(void)
 {
-    if (cfg.rec.signal_detection == 1 && cfg.rec.signal_threshold > 0) {
-        Fl::remove_timeout(&record_signal_timer);
-        Fl::add_timeout(1, &record_signal_timer);
+    if (cfg.main.signal_detection == 1 && cfg.main.signal_threshold > 0) {
+        level_detect_arm(LEVEL_STREAM_SIGNAL, cfg.main.signal_threshold);
     }
 }
 
-void record_signal_timer(void *)
+void stop_stream_signal_detection(void)
 {
-    // printf("record_signal_timer\n");
-
-    static timer_ms_t signal_timer;
-    if (signal_detected == true) {
-        if (signal_timer.is_running == false) {
-            timer_init(&signal_timer, cfg.rec.signal_threshold);
-            timer_start(&signal_timer);
-        }
+    level_detect_disarm(LEVEL_STREAM_SIGNAL);
+}
 
-        if (timer_is_elapsed(&signal_timer)) {
-            // print_info("Audio signal detected", 0);
-            button_record_cb(false);
-            timer_stop(&signal_timer);
-            return;
-        }
-    }
-    else {
-        timer_stop(&signal_timer);
+void reset_record_signal_detection(void)
+{
+    if (cfg.rec.signal_detection == 1 && cfg.rec.signal_threshold > 0) {
+        level_detect_arm(LEVEL_REC_SIGNAL, cfg.rec.signal_threshold);
     }
+}
 
-    Fl::repeat_timeout(0.1, &record_signal_timer);
+void stop_record_signal_detection(void)
+{
+    level_detect_disarm(LEVEL_REC_SIGNAL);
 }
 
-void reset_stream_silence_detection_timer(void)
+void reset_stream_silence_detection(void)
 {
     if (cfg.main.silence_detection == 1 && cfg.main.silence_threshold > 0) {
-        Fl::remove_timeout(&stream_silence_timer);
-        Fl::add_timeout(1, &stream_silence_timer);
+        level_detect_arm(LEVEL_STREAM_SILENCE, cfg.main.silence_threshold);
     }
 }
 
-void stream_silence_timer(void *)
+void stop_stream_silence_detection(void)
 {
-    // printf("stream_silence_timer\n");
-
-    static timer_ms_t silence_timer;
-    if (silence_detected == true) {
-        if (silence_timer.is_running == false) {
-            timer_init(&silence_timer, cfg.main.silence_threshold);
-            timer_start(&silence_timer);
-        }
-
-        if (timer_is_elapsed(&silence_timer)) {
-            // print_info("Streaming silence threshold has been reached", 0);
-            if (connected == 1 || try_to_connect == 1) {
-                button_disconnect_cb(false);
-            }
-            timer_stop(&silence_timer);
-            return;
-        }
-    }
-    else {
-        timer_stop(&silence_timer);
-    }
-
-    Fl::repeat_timeout(0.1, &stream_silence_timer);
+    level_detect_disarm(LEVEL_STREAM_SILENCE);
 }
 
-void reset_record_silence_detection_timer(void)
+void reset_record_silence_detection(void)
 {
     if (cfg.rec.silence_detection == 1 && cfg.rec.silence_threshold > 0) {
-        Fl::remove_timeout(&record_silence_timer);
-        Fl::add_timeout(1, &record_silence_timer);
+        level_detect_arm(LEVEL_REC_SILENCE, cfg.rec.silence_threshold);
     }
 }
 
-void record_silence_timer(void *)
+void stop_record_silence_detection(void)
 {
-    // printf("record_silence_timer\n");
-
-    static timer_ms_t silence_timer;
-    if (silence_detected == true) {
-        if (silence_timer.is_running == false) {
-            timer_init(&silence_timer, cfg.rec.silence_threshold);
-            timer_start(&silence_timer);
-        }
-
-        if (timer_is_elapsed(&silence_timer)) {
-            // print_info("Recording silence threshold has been reached", 0);
-            stop_recording(false);
-            timer_stop(&silence_timer);
-            return;
-        }
-    }
-    else {
-        timer_stop(&silence_timer);
-    }
-
-    Fl::repeat_timeout(0.1, &record_silence_timer);
+    level_detect_disarm(LEVEL_REC_SILENCE);
 }
 
 void wait_for_radioco_timer(void *)
@@ -959,14 +1012,56 @@ exit:
 #endif
 }
 
+static pthread_mutex_t songfile_mutex = PTHREAD_MUTEX_INITIALIZER;
+static char *songfile_title = NULL;
+
+static void set_songfile_title(char *title)
+{
+    cfg.main.song = (char *)realloc(cfg.main.song, strlen(title) + 1);
+    strcpy(cfg.main.song, title);
+    free(title);
+
+    Fl::add_timeout(cfg.main.song_delay, &update_song);
+}
+
+// Runs on the main thread after the song file watcher has found a new title
+static void songfile_title_awake_cb(void *data)
+{
+    char *title;
+    (void)data;
+
+    pthread_mutex_lock(&songfile_mutex);
+    title = songfile_title;
+    songfile_title = NULL;
+    pthread_mutex_unlock(&songfile_mutex);
+
+    if (title == NULL) {
+        return;
+    }
+
+    if (connected == 0 || cfg.main.song_update == 0) {
+        free(title);
+        return;
+    }
+
+    set_songfile_title(title);
+}
+
+// Called from the song file watcher thread. Only the latest title is kept until the main thread picks it up
+static void songfile_title_cb(char *title)
+{
+    pthread_mutex_lock(&songfile_mutex);
+    free(songfile_title);
+    songfile_title = title;
+    pthread_mutex_unlock(&songfile_mutex);
+
+    Fl::awake(songfile_title_awake_cb, NULL);
+}
+
 void songfile_timer(void *user_data)
 {
-    size_t len;
-    int num_of_lines;
-    int num_of_newlines;
-    char song[501];
     char msg[100];
-    char *fgets_ret;
+    char *title;
     float repeat_time = 1;
 
     int reset;
@@ -993,12 +1088,16 @@ void songfile_timer(void *user_data)
         old_t = 0;
     }
 
-    char *last_line = NULL;
-
     if ((cfg.main.song_path == NULL) || (connected == 0)) {
         goto exit;
     }
 
+    // Where inotify is available a watcher thread reports changes of the file within milliseconds.
+    // The timer only keeps the watcher on the currently configured path
+    if (song_file_watch(cfg.main.song_path, cfg.main.read_last_line, reset, songfile_title_cb) == 0) {
+        goto exit;
+    }
+
     if (fl_stat(cfg.main.song_path, (struct stat *)&s) != 0) {
         // File was probably locked by another application
         // retry in 5 seconds
@@ -1020,114 +1119,13 @@ void songfile_timer(void *user_data)
 
     old_t = s.st_mtime;
 
-    if (cfg.main.read_last_line == 1) {
-        /* Read last line instead of first */
-
-        fseek(cfg.main.song_fd, -100, SEEK_END);
-        len = fread(song, sizeof(char), 100, cfg.main.song_fd);
-
-        // Count number of lines within the last 100 characters of the file
-        // Some programs add a new line to the end of the file and some don't
-        // We have to take this into account when counting the number of lines
-        num_of_newlines = 0;
-        for (uint32_t i = 0; i < len; i++) {
-            if (song[i] == '\n') {
-                num_of_newlines++;
-            }
-        }
-
-        if (num_of_newlines == 0) {
-            num_of_lines = 1;
-        }
-        else if (num_of_newlines > 0 && song[len - 1] != '\n') {
-            num_of_lines = num_of_newlines + 1;
-        }
-        else {
-            num_of_lines = num_of_newlines;
-        }
-
-        if (num_of_lines > 1) { // file has multiple lines
-            // Remove newlines at end of file
-            if (song[len - 2] == '\r') { // Windows
-                song[len - 2] = '\0';
-            }
-            else if (song[len - 1] == '\n') { // OSX, Linux
-                song[len - 1] = '\0';
-            }
-            else {
-                song[len] = '\0';
-            }
-
-            last_line = strrchr(song, '\n') + 1;
-        }
-        else { // file has only one line
-            // Remove newlines at end of file
-            if (len > 1 && song[len - 2] == '\r') { // Windows
-                song[len - 2] = '\0';
-            }
-            else if (len > 0 && song[len - 1] == '\n') { // OSX, Linux
-                song[len - 1] = '\0';
-            }
-            else {
-                song[len] = '\0';
-            }
-
-            last_line = song;
-        }
-
-        // Remove UTF-8 BOM
-        if ((uint8_t)last_line[0] == 0xEF && (uint8_t)last_line[1] == 0xBB && (uint8_t)last_line[2] == 0xBF) {
-            cfg.main.song = (char *)realloc(cfg.main.song, strlen(last_line) + 1);
-            strcpy(cfg.main.song, last_line + 3);
-        }
-        else {
-            cfg.main.song = (char *)realloc(cfg.main.song, strlen(last_line) + 1);
-            strcpy(cfg.main.song, last_line);
-        }
-
-        Fl::add_timeout(cfg.main.song_delay, &update_song);
-    }
-    else {
-        // read first line
-        fgets_ret = fgets(song, 500, cfg.main.song_fd);
-
-        if (fgets_ret == NULL && feof(cfg.main.song_fd) != 0) { // file is empty (0 bytes)
-            len = 0;
-        }
-        else if (fgets_ret != NULL) { // Normal case
-            len = strlen(song);
-        }
-        else { // Some error occurred
-            fclose(cfg.main.song_fd);
-            goto exit;
-        }
-
-        // remove newline character
-        if (len > 1 && song[len - 2] == '\r') { // Windows
-            song[len - 2] = '\0';
-        }
-        else if (len > 0 && song[len - 1] == '\n') { // OSX, Linux
-            song[len - 1] = '\0';
-        }
-        else {
-            song[len] = '\0';
-        }
-
-        // Remove UTF-8 BOM
-        if ((uint8_t)song[0] == 0xEF && (uint8_t)song[1] == 0xBB && (uint8_t)song[2] == 0xBF) {
-            cfg.main.song = (char *)realloc(cfg.main.song, strlen(song) + 1);
-            strcpy(cfg.main.song, song + 3);
-        }
-        else {
-            cfg.main.song = (char *)realloc(cfg.main.song, strlen(song) + 1);
-            strcpy(cfg.main.song, song);
-        }
+    title = song_file_read(cfg.main.song_fd, cfg.main.read_last_line);
+    fclose(cfg.main.song_fd);
 
-        Fl::add_timeout(cfg.main.song_delay, &update_song);
+    if (title != NULL) {
+        set_songfile_title(title);
     }
 
-    fclose(cfg.main.song_fd);
-
 exit:
     Fl::repeat_timeout(repeat_time, &songfile_timer);
 }
@@ -1189,15 +1187,33 @@ void song_url_timer(void *user_data)
     Fl::repeat_timeout(cfg.main.song_update_url_interval, &song_url_timer);
 }
 
-void app_timer(void *user_data)
+static void check_app_track(int reset);
+
+// Runs on the main thread after a music player has announced a change
+static void app_track_changed_awake_cb(void *data)
 {
-    int reset;
+    (void)data;
 
-    if (user_data != NULL) {
-        reset = *((int *)user_data);
+    // The app timer only runs while connected with app updates enabled
+    if (Fl::has_timeout(&app_timer)) {
+        check_app_track(0);
     }
-    else {
-        reset = 0;
+}
+
+// Called from the player watcher thread
+static void app_track_changed_cb(void)
+{
+    Fl::awake(app_track_changed_awake_cb, NULL);
+}
+
+static void check_app_track(int reset)
+{
+    static int watching = 0;
+
+    // Players that report their changes are read from a cache, polling them is cheap then
+    if (!watching) {
+        watching = 1;
+        currentTrackWatch(app_track_changed_cb);
     }
 
     if (current_track_app != NULL) {
@@ -1218,6 +1234,20 @@ void app_timer(void *user_data)
             }
         }
     }
+}
+
+void app_timer(void *user_data)
+{
+    int reset;
+
+    if (user_data != NULL) {
+        reset = *((int *)user_data);
+    }
+    else {
+        reset = 0;
+    }
+
+    check_app_track(reset);
 
     Fl::repeat_timeout(1, &app_timer);
 }
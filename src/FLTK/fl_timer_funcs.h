@@ -28,10 +28,6 @@ void is_connected_timer(void *);
 void cfg_win_pos_timer(void *);
 void songfile_timer(void *);
 void song_url_timer(void *);
-void stream_silence_timer(void *);
-void record_silence_timer(void *);
-void stream_signal_timer(void *);
-void record_signal_timer(void *);
 void wait_for_radioco_timer(void *);
 void request_listener_count_timer(void *reset);
 void stereo_tool_status_timer(void *);
@@ -41,10 +37,19 @@ void app_timer(void *);
 
 void split_recording_file_timer(void);
 void split_recording_file(void);
-void reset_stream_signal_detection_timer(void);
-void reset_stream_silence_detection_timer(void);
-void reset_record_signal_detection_timer(void);
-void reset_record_silence_detection_timer(void);
+
+// Silence and signal detection runs in the mixer (level_detect.h), these functions arm and disarm the
+// detectors with the hold times from cfg. A detector that fires is handled on the main thread and must be armed again
+void init_level_detection(void);
+void update_level_detection_levels(void);
+void reset_stream_signal_detection(void);
+void reset_stream_silence_detection(void);
+void reset_record_signal_detection(void);
+void reset_record_silence_detection(void);
+void stop_stream_signal_detection(void);
+void stop_stream_silence_detection(void);
+void stop_record_signal_detection(void);
+void stop_record_silence_detection(void);
 
 extern const char *(*current_track_app)(int);
 extern int g_vu_meter_timer_is_active;
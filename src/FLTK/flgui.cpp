@@ -1801,158 +1801,13 @@ void flgui::cb_Apple(Fl_Button* o, void* v) {
 }
 
 void flgui::cb_Bitcoin_i(Fl_Button*, void*) {
-  this->window_donate_crypto->position(this->window_cfg->x(), this->window_cfg->y());
+  this->make_window_donate_crypto()->position(this->window_cfg->x(), this->window_cfg->y());
   this->window_donate_crypto->show();
 }
 void flgui::cb_Bitcoin(Fl_Button* o, void* v) {
   ((flgui*)(o->parent()->parent()->parent()->parent()->user_data()))->cb_Bitcoin_i(o,v);
 }
 
-void flgui::cb_button_cfg_show_pw_i(Fl_Button*, void*) {
-  button_add_srv_show_pwd_cb();
-}
-void flgui::cb_button_cfg_show_pw(Fl_Button* o, void* v) {
-  ((flgui*)(o->parent()->user_data()))->cb_button_cfg_show_pw_i(o,v);
-}
-
-void flgui::cb_radio_add_srv_shoutcast_i(Fl_Round_Button*, void*) {
-  radio_add_srv_shoutcast_cb();
-}
-void flgui::cb_radio_add_srv_shoutcast(Fl_Round_Button* o, void* v) {
-  ((flgui*)(o->parent()->parent()->user_data()))->cb_radio_add_srv_shoutcast_i(o,v);
-}
-
-void flgui::cb_radio_add_srv_icecast_i(Fl_Round_Button*, void*) {
-  radio_add_srv_icecast_cb();
-}
-void flgui::cb_radio_add_srv_icecast(Fl_Round_Button* o, void* v) {
-  ((flgui*)(o->parent()->parent()->user_data()))->cb_radio_add_srv_icecast_i(o,v);
-}
-
-void flgui::cb_radio_add_srv_webrtc_i(Fl_Round_Button*, void*) {
-  radio_add_srv_webrtc_cb();
-}
-void flgui::cb_radio_add_srv_webrtc(Fl_Round_Button* o, void* v) {
-  ((flgui*)(o->parent()->parent()->user_data()))->cb_radio_add_srv_webrtc_i(o,v);
-}
-
-void flgui::cb_radio_add_srv_radioco_i(Fl_Round_Button*, void*) {
-  radio_add_srv_radioco_cb();
-}
-void flgui::cb_radio_add_srv_radioco(Fl_Round_Button* o, void* v) {
-  ((flgui*)(o->parent()->parent()->user_data()))->cb_radio_add_srv_radioco_i(o,v);
-}
-
-void flgui::cb_Cancel_i(Fl_Button*, void*) {
-  button_add_srv_cancel_cb();
-}
-void flgui::cb_Cancel(Fl_Button* o, void* v) {
-  ((flgui*)(o->parent()->user_data()))->cb_Cancel_i(o,v);
-}
-
-void flgui::cb_button_add_srv_add_i(Fl_Button*, void*) {
-  button_add_srv_add_cb();
-}
-void flgui::cb_button_add_srv_add(Fl_Button* o, void* v) {
-  ((flgui*)(o->parent()->user_data()))->cb_button_add_srv_add_i(o,v);
-}
-
-void flgui::cb_button_add_srv_save_i(Fl_Button*, void*) {
-  button_add_srv_save_cb();
-}
-void flgui::cb_button_add_srv_save(Fl_Button* o, void* v) {
-  ((flgui*)(o->parent()->user_data()))->cb_button_add_srv_save_i(o,v);
-}
-
-void flgui::cb_button_add_srv_revoke_cert_i(Fl_Button*, void*) {
-  button_add_srv_revoke_cert_cb();
-}
-void flgui::cb_button_add_srv_revoke_cert(Fl_Button* o, void* v) {
-  ((flgui*)(o->parent()->parent()->user_data()))->cb_button_add_srv_revoke_cert_i(o,v);
-}
-
-void flgui::cb_button_add_srv_get_stations_i(Fl_Button*, void*) {
-  button_add_srv_get_stations_cb();
-}
-void flgui::cb_button_add_srv_get_stations(Fl_Button* o, void* v) {
-  ((flgui*)(o->parent()->user_data()))->cb_button_add_srv_get_stations_i(o,v);
-}
-
-void flgui::cb_button_add_srv_select_all_i(Fl_Button*, void*) {
-  button_add_srv_select_all_cb();
-}
-void flgui::cb_button_add_srv_select_all(Fl_Button* o, void* v) {
-  ((flgui*)(o->parent()->user_data()))->cb_button_add_srv_select_all_i(o,v);
-}
-
-void flgui::cb_button_add_srv_deselect_all_i(Fl_Button*, void*) {
-  button_add_srv_deselect_all_cb();
-}
-void flgui::cb_button_add_srv_deselect_all(Fl_Button* o, void* v) {
-  ((flgui*)(o->parent()->user_data()))->cb_button_add_srv_deselect_all_i(o,v);
-}
-
-void flgui::cb_Cancel1_i(Fl_Button*, void*) {
-  button_add_icy_cancel_cb();
-}
-void flgui::cb_Cancel1(Fl_Button* o, void* v) {
-  ((flgui*)(o->parent()->user_data()))->cb_Cancel1_i(o,v);
-}
-
-void flgui::cb_button_add_icy_add_i(Fl_Button*, void*) {
-  button_add_icy_add_cb();
-}
-void flgui::cb_button_add_icy_add(Fl_Button* o, void* v) {
-  ((flgui*)(o->parent()->user_data()))->cb_button_add_icy_add_i(o,v);
-}
-
-void flgui::cb_button_add_icy_save_i(Fl_Button*, void*) {
-  button_add_icy_save_cb();
-}
-void flgui::cb_button_add_icy_save(Fl_Button* o, void* v) {
-  ((flgui*)(o->parent()->user_data()))->cb_button_add_icy_save_i(o,v);
-}
-
-void flgui::cb_Copy_i(Fl_Button*, void*) {
-  int len = this->output_bitcoin_addr->size();
-  this->output_bitcoin_addr->position(0, len);
-  this->output_bitcoin_addr->copy(1);
-
-  fl_message(_("Bitcoin address has been copied to clipboard."));
-}
-void flgui::cb_Copy(Fl_Button* o, void* v) {
-  ((flgui*)(o->parent()->user_data()))->cb_Copy_i(o,v);
-}
-
-void flgui::cb_Copy1_i(Fl_Button*, void*) {
-  int len = this->output_litecoin_addr->size();
-  this->output_litecoin_addr->position(0, len);
-  this->output_litecoin_addr->copy(1);
-
-  fl_message(_("Litecoin address has been copied to clipboard."));
-}
-void flgui::cb_Copy1(Fl_Button* o, void* v) {
-  ((flgui*)(o->parent()->user_data()))->cb_Copy1_i(o,v);
-}
-
-void flgui::cb_Copy2_i(Fl_Button*, void*) {
-  int len = this->output_monero_addr->size();
-  this->output_monero_addr->position(0, len);
-  this->output_monero_addr->copy(1);
-
-  fl_message(_("Monero address has been copied to clipboard."));
-}
-void flgui::cb_Copy2(Fl_Button* o, void* v) {
-  ((flgui*)(o->parent()->user_data()))->cb_Copy2_i(o,v);
-}
-
-void flgui::cb_Close_i(Fl_Button*, void*) {
-  this->window_donate_crypto->hide();
-}
-void flgui::cb_Close(Fl_Button* o, void* v) {
-  ((flgui*)(o->parent()->user_data()))->cb_Close_i(o,v);
-}
-
 void flgui::cb_choice_stream_mp3_enc_quality_i(Fl_Choice*, void*) {
   choice_stream_mp3_enc_quality_cb();
 }
@@ -2809,24 +2664,11 @@ void flgui::cb_slider_mixer_cross_fader(Fl_My_Value_Slider* o, void* v) {
   ((flgui*)(o->parent()->parent()->user_data()))->cb_slider_mixer_cross_fader_i(o,v);
 }
 
-void flgui::cb_Open_i(Fl_Button*, void*) {
-  char uri[128];
-  snprintf(uri, sizeof(uri), "https://danielnoethen.de/butt/release/%s/butt-%s_manual.html", VERSION, VERSION);
-  fl_open_uri(uri);
-  this->window_missing_aac_lib->hide();
-}
-void flgui::cb_Open(Fl_Button* o, void* v) {
-  ((flgui*)(o->parent()->user_data()))->cb_Open_i(o,v);
-}
-
-void flgui::cb_Close3_i(Fl_Button*, void*) {
-  this->window_missing_aac_lib->hide();
-}
-void flgui::cb_Close3(Fl_Button* o, void* v) {
-  ((flgui*)(o->parent()->user_data()))->cb_Close3_i(o,v);
-}
-
 flgui::flgui() {
+  window_add_srv = NULL;
+  window_add_icy = NULL;
+  window_donate_crypto = NULL;
+  window_missing_aac_lib = NULL;
   { window_main = new Fl_My_Double_Window(430, 395);
     window_main->box(FL_FLAT_BOX);
     window_main->color(FL_BACKGROUND_COLOR);
@@ -4664,180 +4506,6 @@ flgui::flgui() {
     window_cfg->size_range(430, 640, 430, 800);
     window_cfg->end();
   } // Fl_My_Double_Window* window_cfg
-  { window_add_srv = new Fl_Double_Window(395, 522, gettext("Add server"));
-    window_add_srv->user_data((void*)(this));
-    { input_add_srv_name = new Fl_Input(70, 27, 245, 23, gettext("Name:"));
-      input_add_srv_name->align(Fl_Align(FL_ALIGN_TOP_LEFT));
-      this->input_add_srv_name->maximum_size(100);
-    } // Fl_Input* input_add_srv_name
-    { input_add_srv_addr = new Fl_Input(10, 216, 295, 25, gettext("Address:"));
-      input_add_srv_addr->align(Fl_Align(FL_ALIGN_TOP_LEFT));
-      this->input_add_srv_addr->maximum_size(100);
-    } // Fl_Input* input_add_srv_addr
-    { input_add_srv_port = new Fl_Int_Input(315, 216, 75, 25, gettext("Port:"));
-      input_add_srv_port->type(2);
-      input_add_srv_port->align(Fl_Align(FL_ALIGN_TOP_LEFT));
-    } // Fl_Int_Input* input_add_srv_port
-    { input_add_srv_pwd = new Fl_Input(10, 261, 295, 25, gettext("Password:"));
-      input_add_srv_pwd->type(5);
-      input_add_srv_pwd->align(Fl_Align(FL_ALIGN_TOP_LEFT));
-      this->input_add_srv_pwd->maximum_size(100);
-    } // Fl_Input* input_add_srv_pwd
-    { input_add_srv_mount = new Fl_Input(10, 311, 215, 25, gettext("Icecast mountpoint:"));
-      input_add_srv_mount->align(Fl_Align(FL_ALIGN_TOP_LEFT));
-      this->input_add_srv_mount->maximum_size(100);
-    } // Fl_Input* input_add_srv_mount
-    { input_add_srv_usr = new Fl_Input(235, 311, 155, 25, gettext("Icecast user:"));
-      input_add_srv_usr->align(Fl_Align(FL_ALIGN_TOP_LEFT));
-      this->input_add_srv_usr->maximum_size(100);
-    } // Fl_Input* input_add_srv_usr
-    { button_cfg_show_pw = new Fl_Button(315, 261, 75, 25, gettext("Show"));
-      button_cfg_show_pw->tooltip(gettext("show/hide password"));
-      button_cfg_show_pw->box(FL_ENGRAVED_BOX);
-      button_cfg_show_pw->callback((Fl_Callback*)cb_button_cfg_show_pw);
-    } // Fl_Button* button_cfg_show_pw
-    { Fl_Group* o = new Fl_Group(10, 96, 125, 97, gettext("Type"));
-      o->box(FL_ENGRAVED_BOX);
-      o->align(Fl_Align(FL_ALIGN_TOP_LEFT));
-      { radio_add_srv_shoutcast = new Fl_Round_Button(15, 105, 88, 15, gettext("Shoutcast"));
-        radio_add_srv_shoutcast->type(102);
-        radio_add_srv_shoutcast->down_box(FL_ROUND_DOWN_BOX);
-        radio_add_srv_shoutcast->callback((Fl_Callback*)cb_radio_add_srv_shoutcast);
-      } // Fl_Round_Button* radio_add_srv_shoutcast
-      { radio_add_srv_icecast = new Fl_Round_Button(15, 127, 80, 12, gettext("Icecast"));
-        radio_add_srv_icecast->type(102);
-        radio_add_srv_icecast->down_box(FL_ROUND_DOWN_BOX);
-        radio_add_srv_icecast->callback((Fl_Callback*)cb_radio_add_srv_icecast);
-      } // Fl_Round_Button* radio_add_srv_icecast
-      { radio_add_srv_webrtc = new Fl_Round_Button(15, 149, 80, 12, gettext("WebRTC"));
-        radio_add_srv_webrtc->type(102);
-        radio_add_srv_webrtc->down_box(FL_ROUND_DOWN_BOX);
-        radio_add_srv_webrtc->callback((Fl_Callback*)cb_radio_add_srv_webrtc);
-      } // Fl_Round_Button* radio_add_srv_webrtc
-      { radio_add_srv_radioco = new Fl_Round_Button(15, 171, 80, 12, gettext("Radio.co"));
-        radio_add_srv_radioco->type(102);
-        radio_add_srv_radioco->down_box(FL_ROUND_DOWN_BOX);
-        radio_add_srv_radioco->callback((Fl_Callback*)cb_radio_add_srv_radioco);
-      } // Fl_Round_Button* radio_add_srv_radioco
-      o->end();
-    } // Fl_Group* o
-    { Fl_Button* o = new Fl_Button(10, 478, 85, 25, gettext("&Cancel"));
-      o->box(FL_ENGRAVED_BOX);
-      o->callback((Fl_Callback*)cb_Cancel);
-    } // Fl_Button* o
-    { button_add_srv_add = new Fl_Button(305, 478, 85, 25, gettext("&ADD"));
-      button_add_srv_add->box(FL_ENGRAVED_BOX);
-      button_add_srv_add->callback((Fl_Callback*)cb_button_add_srv_add);
-    } // Fl_Button* button_add_srv_add
-    { button_add_srv_save = new Fl_Button(305, 478, 85, 25, gettext("&Save"));
-      button_add_srv_save->box(FL_ENGRAVED_BOX);
-      button_add_srv_save->callback((Fl_Callback*)cb_button_add_srv_save);
-    } // Fl_Button* button_add_srv_save
-    { frame_add_srv_tls = new Fl_Group(140, 96, 250, 97, gettext("SSL/TLS"));
-      frame_add_srv_tls->box(FL_ENGRAVED_BOX);
-      frame_add_srv_tls->align(Fl_Align(FL_ALIGN_TOP_LEFT));
-      { check_add_srv_tls = new Fl_Check_Button(148, 100, 190, 20, gettext("Use SSL/TLS"));
-        check_add_srv_tls->down_box(FL_DOWN_BOX);
-      } // Fl_Check_Button* check_add_srv_tls
-      { button_add_srv_revoke_cert = new Fl_Button(150, 157, 225, 25, gettext("Revoke certificate trust"));
-        button_add_srv_revoke_cert->box(FL_ENGRAVED_BOX);
-        button_add_srv_revoke_cert->callback((Fl_Callback*)cb_button_add_srv_revoke_cert);
-      } // Fl_Button* button_add_srv_revoke_cert
-      frame_add_srv_tls->end();
-    } // Fl_Group* frame_add_srv_tls
-    { browser_add_srv_station_list = new Fl_Check_Browser(140, 216, 250, 83, gettext("Radio.co Stations"));
-      browser_add_srv_station_list->align(Fl_Align(FL_ALIGN_TOP_LEFT));
-    } // Fl_Check_Browser* browser_add_srv_station_list
-    { button_add_srv_get_stations = new Fl_Button(10, 205, 120, 25, gettext("Get Stations"));
-      button_add_srv_get_stations->box(FL_ENGRAVED_BOX);
-      button_add_srv_get_stations->callback((Fl_Callback*)cb_button_add_srv_get_stations);
-    } // Fl_Button* button_add_srv_get_stations
-    { button_add_srv_select_all = new Fl_Button(140, 301, 120, 20, gettext("Select all"));
-      button_add_srv_select_all->box(FL_ENGRAVED_BOX);
-      button_add_srv_select_all->callback((Fl_Callback*)cb_button_add_srv_select_all);
-    } // Fl_Button* button_add_srv_select_all
-    { button_add_srv_deselect_all = new Fl_Button(265, 301, 125, 20, gettext("Deselect all"));
-      button_add_srv_deselect_all->box(FL_ENGRAVED_BOX);
-      button_add_srv_deselect_all->callback((Fl_Callback*)cb_button_add_srv_deselect_all);
-    } // Fl_Button* button_add_srv_deselect_all
-    { check_add_srv_protocol = new Fl_Check_Button(8, 345, 297, 15, gettext("Use legacy Icecast protocol"));
-      check_add_srv_protocol->tooltip(gettext("Activate this if you want to use the older SOURCE protocol instead of the new"
-"er PUT protocol"));
-      check_add_srv_protocol->down_box(FL_DOWN_BOX);
-    } // Fl_Check_Button* check_add_srv_protocol
-    { input_webrtc_icesrv_url = new Fl_Input(10, 215, 380, 25, gettext("ICE server (optional):"));
-      input_webrtc_icesrv_url->align(Fl_Align(FL_ALIGN_TOP_LEFT));
-    } // Fl_Input* input_webrtc_icesrv_url
-    { input_webrtc_whip_url = new Fl_Input(10, 260, 380, 25, gettext("WebRTC (WHIP) URL:"));
-      input_webrtc_whip_url->align(Fl_Align(FL_ALIGN_TOP_LEFT));
-    } // Fl_Input* input_webrtc_whip_url
-    { input_webrtc_auth_token = new Fl_Input(10, 305, 380, 25, gettext("Bearer token (optional):"));
-      input_webrtc_auth_token->align(Fl_Align(FL_ALIGN_TOP_LEFT));
-    } // Fl_Input* input_webrtc_auth_token
-    { input_add_srv_listener_url = new Fl_Input(10, 393, 380, 25, gettext("Custom listener URL (optional):"));
-      input_add_srv_listener_url->align(Fl_Align(FL_ALIGN_TOP_LEFT));
-      this->input_add_srv_listener_url->maximum_size(100);
-    } // Fl_Input* input_add_srv_listener_url
-    { input_add_srv_listener_mount = new Fl_Input(10, 441, 380, 25, gettext("Custom listener mountpoint (optional):"));
-      input_add_srv_listener_mount->align(Fl_Align(FL_ALIGN_TOP_LEFT));
-      this->input_add_srv_listener_mount->maximum_size(100);
-    } // Fl_Input* input_add_srv_listener_mount
-    window_add_srv->set_modal();
-    window_add_srv->end();
-  } // Fl_Double_Window* window_add_srv
-  { window_add_icy = new Fl_Double_Window(305, 380, gettext("Add stream info"));
-    window_add_icy->user_data((void*)(this));
-    { input_add_icy_name = new Fl_Input(10, 35, 285, 25, gettext("Name:"));
-      input_add_icy_name->tooltip(gettext("The name of your new ICY-entrie"));
-      input_add_icy_name->align(Fl_Align(FL_ALIGN_TOP_LEFT));
-      this->input_add_icy_name->maximum_size(100);
-    } // Fl_Input* input_add_icy_name
-    { input_add_icy_desc = new Fl_Input(10, 145, 170, 25, gettext("Description:"));
-      input_add_icy_desc->align(Fl_Align(FL_ALIGN_TOP_LEFT));
-      this->input_add_icy_desc->maximum_size(100);
-    } // Fl_Input* input_add_icy_desc
-    { input_add_icy_genre = new Fl_Input(185, 145, 110, 25, gettext("Genre:"));
-      input_add_icy_genre->align(Fl_Align(FL_ALIGN_TOP_LEFT));
-      this->input_add_icy_genre->maximum_size(100);
-    } // Fl_Input* input_add_icy_genre
-    { input_add_icy_url = new Fl_Input(10, 190, 170, 25, gettext("URL:"));
-      input_add_icy_url->align(Fl_Align(FL_ALIGN_TOP_LEFT));
-      this->input_add_icy_url->maximum_size(100);
-    } // Fl_Input* input_add_icy_url
-    { input_add_icy_icq = new Fl_Input(185, 190, 110, 25, gettext("ICQ:"));
-      input_add_icy_icq->align(Fl_Align(FL_ALIGN_TOP_LEFT));
-      this->input_add_icy_icq->maximum_size(100);
-    } // Fl_Input* input_add_icy_icq
-    { input_add_icy_irc = new Fl_Input(10, 235, 170, 25, gettext("IRC:"));
-      input_add_icy_irc->align(Fl_Align(FL_ALIGN_TOP_LEFT));
-      this->input_add_icy_irc->maximum_size(100);
-    } // Fl_Input* input_add_icy_irc
-    { input_add_icy_aim = new Fl_Input(185, 235, 110, 25, gettext("AIM:"));
-      input_add_icy_aim->align(Fl_Align(FL_ALIGN_TOP_LEFT));
-      this->input_add_icy_aim->maximum_size(100);
-    } // Fl_Input* input_add_icy_aim
-    { check_add_icy_pub = new Fl_Check_Button(10, 270, 235, 20, gettext("Make server public"));
-      check_add_icy_pub->down_box(FL_DOWN_BOX);
-    } // Fl_Check_Button* check_add_icy_pub
-    { check_expand_variables = new Fl_Check_Button(10, 295, 235, 20, gettext("Expand variables"));
-      check_expand_variables->tooltip(gettext("Activate to expand date variables in name and description"));
-      check_expand_variables->down_box(FL_DOWN_BOX);
-    } // Fl_Check_Button* check_expand_variables
-    { Fl_Button* o = new Fl_Button(10, 340, 74, 25, gettext("&Cancel"));
-      o->box(FL_ENGRAVED_BOX);
-      o->callback((Fl_Callback*)cb_Cancel1);
-    } // Fl_Button* o
-    { button_add_icy_add = new Fl_Button(224, 340, 74, 25, gettext("&ADD"));
-      button_add_icy_add->box(FL_ENGRAVED_BOX);
-      button_add_icy_add->callback((Fl_Callback*)cb_button_add_icy_add);
-    } // Fl_Button* button_add_icy_add
-    { button_add_icy_save = new Fl_Button(224, 340, 74, 25, gettext("&Save"));
-      button_add_icy_save->box(FL_ENGRAVED_BOX);
-      button_add_icy_save->callback((Fl_Callback*)cb_button_add_icy_save);
-    } // Fl_Button* button_add_icy_save
-    window_add_icy->set_modal();
-    window_add_icy->end();
-  } // Fl_Double_Window* window_add_icy
   Fl::scheme("standard");
   window_main->label(PACKAGE_STRING);
 
@@ -4850,50 +4518,6 @@ flgui::flgui() {
   info_visible = 1;
                   
   info_output->show();
-  { window_donate_crypto = new Fl_My_Double_Window(460, 255, gettext("Donate Cryptocurrency"));
-    window_donate_crypto->box(FL_FLAT_BOX);
-    window_donate_crypto->color(FL_BACKGROUND_COLOR);
-    window_donate_crypto->selection_color(FL_BACKGROUND_COLOR);
-    window_donate_crypto->labeltype(FL_NO_LABEL);
-    window_donate_crypto->labelfont(0);
-    window_donate_crypto->labelsize(14);
-    window_donate_crypto->labelcolor(FL_FOREGROUND_COLOR);
-    window_donate_crypto->user_data((void*)(this));
-    window_donate_crypto->align(Fl_Align(FL_ALIGN_TOP));
-    window_donate_crypto->when(FL_WHEN_RELEASE);
-    { output_bitcoin_addr = new Fl_Output(20, 40, 320, 22, gettext("Bitcoin"));
-      output_bitcoin_addr->box(FL_FLAT_BOX);
-      output_bitcoin_addr->align(Fl_Align(FL_ALIGN_TOP_LEFT));
-      output_bitcoin_addr->value("bc1q4uq7h464rsu2cudrmuuqmc4tcr98d0edrhe5au");
-    } // Fl_Output* output_bitcoin_addr
-    { Fl_Button* o = new Fl_Button(350, 40, 88, 22, gettext("Copy"));
-      o->box(FL_ENGRAVED_BOX);
-      o->callback((Fl_Callback*)cb_Copy);
-    } // Fl_Button* o
-    { output_litecoin_addr = new Fl_Output(20, 100, 320, 22, gettext("Litecoin"));
-      output_litecoin_addr->box(FL_FLAT_BOX);
-      output_litecoin_addr->align(Fl_Align(FL_ALIGN_TOP_LEFT));
-      output_litecoin_addr->value("Ld9gntf8fsYpmVcbstFkzz5R3sNPC3AhTx");
-    } // Fl_Output* output_litecoin_addr
-    { Fl_Button* o = new Fl_Button(350, 100, 88, 22, gettext("Copy"));
-      o->box(FL_ENGRAVED_BOX);
-      o->callback((Fl_Callback*)cb_Copy1);
-    } // Fl_Button* o
-    { output_monero_addr = new Fl_Output(20, 160, 320, 22, gettext("Monero"));
-      output_monero_addr->box(FL_FLAT_BOX);
-      output_monero_addr->align(Fl_Align(FL_ALIGN_TOP_LEFT));
-      output_monero_addr->value("85u8DacasxPNvKzY5kEiprBnbydDqg26yGAVEw7mdwccNFsrXMWCE4VQnV2JVfh5BTRheNnpDJqYjbqPrVRLEPAKP3dsYgc");
-    } // Fl_Output* output_monero_addr
-    { Fl_Button* o = new Fl_Button(350, 160, 88, 22, gettext("Copy"));
-      o->box(FL_ENGRAVED_BOX);
-      o->callback((Fl_Callback*)cb_Copy2);
-    } // Fl_Button* o
-    { Fl_Button* o = new Fl_Button(20, 217, 88, 22, gettext("&Close"));
-      o->box(FL_ENGRAVED_BOX);
-      o->callback((Fl_Callback*)cb_Close);
-    } // Fl_Button* o
-    window_donate_crypto->end();
-  } // Fl_My_Double_Window* window_donate_crypto
   { window_stream_codec_settings = new Fl_My_Double_Window(395, 385, gettext("Streaming Codec Settings"));
     window_stream_codec_settings->box(FL_FLAT_BOX);
     window_stream_codec_settings->color(FL_BACKGROUND_COLOR);
@@ -6212,6 +5836,413 @@ flgui::flgui() {
     } // Fl_Group* o
     window_mixer->end();
   } // Fl_My_Double_Window* window_mixer
+}
+
+void flgui::cb_button_cfg_show_pw_i(Fl_Button*, void*) {
+  button_add_srv_show_pwd_cb();
+}
+void flgui::cb_button_cfg_show_pw(Fl_Button* o, void* v) {
+  ((flgui*)(o->parent()->user_data()))->cb_button_cfg_show_pw_i(o,v);
+}
+
+void flgui::cb_radio_add_srv_shoutcast_i(Fl_Round_Button*, void*) {
+  radio_add_srv_shoutcast_cb();
+}
+void flgui::cb_radio_add_srv_shoutcast(Fl_Round_Button* o, void* v) {
+  ((flgui*)(o->parent()->parent()->user_data()))->cb_radio_add_srv_shoutcast_i(o,v);
+}
+
+void flgui::cb_radio_add_srv_icecast_i(Fl_Round_Button*, void*) {
+  radio_add_srv_icecast_cb();
+}
+void flgui::cb_radio_add_srv_icecast(Fl_Round_Button* o, void* v) {
+  ((flgui*)(o->parent()->parent()->user_data()))->cb_radio_add_srv_icecast_i(o,v);
+}
+
+void flgui::cb_radio_add_srv_webrtc_i(Fl_Round_Button*, void*) {
+  radio_add_srv_webrtc_cb();
+}
+void flgui::cb_radio_add_srv_webrtc(Fl_Round_Button* o, void* v) {
+  ((flgui*)(o->parent()->parent()->user_data()))->cb_radio_add_srv_webrtc_i(o,v);
+}
+
+void flgui::cb_radio_add_srv_radioco_i(Fl_Round_Button*, void*) {
+  radio_add_srv_radioco_cb();
+}
+void flgui::cb_radio_add_srv_radioco(Fl_Round_Button* o, void* v) {
+  ((flgui*)(o->parent()->parent()->user_data()))->cb_radio_add_srv_radioco_i(o,v);
+}
+
+void flgui::cb_Cancel_i(Fl_Button*, void*) {
+  button_add_srv_cancel_cb();
+}
+void flgui::cb_Cancel(Fl_Button* o, void* v) {
+  ((flgui*)(o->parent()->user_data()))->cb_Cancel_i(o,v);
+}
+
+void flgui::cb_button_add_srv_add_i(Fl_Button*, void*) {
+  button_add_srv_add_cb();
+}
+void flgui::cb_button_add_srv_add(Fl_Button* o, void* v) {
+  ((flgui*)(o->parent()->user_data()))->cb_button_add_srv_add_i(o,v);
+}
+
+void flgui::cb_button_add_srv_save_i(Fl_Button*, void*) {
+  button_add_srv_save_cb();
+}
+void flgui::cb_button_add_srv_save(Fl_Button* o, void* v) {
+  ((flgui*)(o->parent()->user_data()))->cb_button_add_srv_save_i(o,v);
+}
+
+void flgui::cb_button_add_srv_revoke_cert_i(Fl_Button*, void*) {
+  button_add_srv_revoke_cert_cb();
+}
+void flgui::cb_button_add_srv_revoke_cert(Fl_Button* o, void* v) {
+  ((flgui*)(o->parent()->parent()->user_data()))->cb_button_add_srv_revoke_cert_i(o,v);
+}
+
+void flgui::cb_button_add_srv_get_stations_i(Fl_Button*, void*) {
+  button_add_srv_get_stations_cb();
+}
+void flgui::cb_button_add_srv_get_stations(Fl_Button* o, void* v) {
+  ((flgui*)(o->parent()->user_data()))->cb_button_add_srv_get_stations_i(o,v);
+}
+
+void flgui::cb_button_add_srv_select_all_i(Fl_Button*, void*) {
+  button_add_srv_select_all_cb();
+}
+void flgui::cb_button_add_srv_select_all(Fl_Button* o, void* v) {
+  ((flgui*)(o->parent()->user_data()))->cb_button_add_srv_select_all_i(o,v);
+}
+
+void flgui::cb_button_add_srv_deselect_all_i(Fl_Button*, void*) {
+  button_add_srv_deselect_all_cb();
+}
+void flgui::cb_button_add_srv_deselect_all(Fl_Button* o, void* v) {
+  ((flgui*)(o->parent()->user_data()))->cb_button_add_srv_deselect_all_i(o,v);
+}
+
+Fl_Double_Window* flgui::make_window_add_srv() {
+  if (window_add_srv != NULL) {
+    return window_add_srv;
+  }
+  { window_add_srv = new Fl_Double_Window(395, 522, gettext("Add server"));
+    window_add_srv->user_data((void*)(this));
+    { input_add_srv_name = new Fl_Input(70, 27, 245, 23, gettext("Name:"));
+      input_add_srv_name->align(Fl_Align(FL_ALIGN_TOP_LEFT));
+      this->input_add_srv_name->maximum_size(100);
+    } // Fl_Input* input_add_srv_name
+    { input_add_srv_addr = new Fl_Input(10, 216, 295, 25, gettext("Address:"));
+      input_add_srv_addr->align(Fl_Align(FL_ALIGN_TOP_LEFT));
+      this->input_add_srv_addr->maximum_size(100);
+    } // Fl_Input* input_add_srv_addr
+    { input_add_srv_port = new Fl_Int_Input(315, 216, 75, 25, gettext("Port:"));
+      input_add_srv_port->type(2);
+      input_add_srv_port->align(Fl_Align(FL_ALIGN_TOP_LEFT));
+    } // Fl_Int_Input* input_add_srv_port
+    { input_add_srv_pwd = new Fl_Input(10, 261, 295, 25, gettext("Password:"));
+      input_add_srv_pwd->type(5);
+      input_add_srv_pwd->align(Fl_Align(FL_ALIGN_TOP_LEFT));
+      this->input_add_srv_pwd->maximum_size(100);
+    } // Fl_Input* input_add_srv_pwd
+    { input_add_srv_mount = new Fl_Input(10, 311, 215, 25, gettext("Icecast mountpoint:"));
+      input_add_srv_mount->align(Fl_Align(FL_ALIGN_TOP_LEFT));
+      this->input_add_srv_mount->maximum_size(100);
+    } // Fl_Input* input_add_srv_mount
+    { input_add_srv_usr = new Fl_Input(235, 311, 155, 25, gettext("Icecast user:"));
+      input_add_srv_usr->align(Fl_Align(FL_ALIGN_TOP_LEFT));
+      this->input_add_srv_usr->maximum_size(100);
+    } // Fl_Input* input_add_srv_usr
+    { button_cfg_show_pw = new Fl_Button(315, 261, 75, 25, gettext("Show"));
+      button_cfg_show_pw->tooltip(gettext("show/hide password"));
+      button_cfg_show_pw->box(FL_ENGRAVED_BOX);
+      button_cfg_show_pw->callback((Fl_Callback*)cb_button_cfg_show_pw);
+    } // Fl_Button* button_cfg_show_pw
+    { Fl_Group* o = new Fl_Group(10, 96, 125, 97, gettext("Type"));
+      o->box(FL_ENGRAVED_BOX);
+      o->align(Fl_Align(FL_ALIGN_TOP_LEFT));
+      { radio_add_srv_shoutcast = new Fl_Round_Button(15, 105, 88, 15, gettext("Shoutcast"));
+        radio_add_srv_shoutcast->type(102);
+        radio_add_srv_shoutcast->down_box(FL_ROUND_DOWN_BOX);
+        radio_add_srv_shoutcast->callback((Fl_Callback*)cb_radio_add_srv_shoutcast);
+      } // Fl_Round_Button* radio_add_srv_shoutcast
+      { radio_add_srv_icecast = new Fl_Round_Button(15, 127, 80, 12, gettext("Icecast"));
+        radio_add_srv_icecast->type(102);
+        radio_add_srv_icecast->down_box(FL_ROUND_DOWN_BOX);
+        radio_add_srv_icecast->callback((Fl_Callback*)cb_radio_add_srv_icecast);
+      } // Fl_Round_Button* radio_add_srv_icecast
+      { radio_add_srv_webrtc = new Fl_Round_Button(15, 149, 80, 12, gettext("WebRTC"));
+        radio_add_srv_webrtc->type(102);
+        radio_add_srv_webrtc->down_box(FL_ROUND_DOWN_BOX);
+        radio_add_srv_webrtc->callback((Fl_Callback*)cb_radio_add_srv_webrtc);
+      } // Fl_Round_Button* radio_add_srv_webrtc
+      { radio_add_srv_radioco = new Fl_Round_Button(15, 171, 80, 12, gettext("Radio.co"));
+        radio_add_srv_radioco->type(102);
+        radio_add_srv_radioco->down_box(FL_ROUND_DOWN_BOX);
+        radio_add_srv_radioco->callback((Fl_Callback*)cb_radio_add_srv_radioco);
+      } // Fl_Round_Button* radio_add_srv_radioco
+      o->end();
+    } // Fl_Group* o
+    { Fl_Button* o = new Fl_Button(10, 478, 85, 25, gettext("&Cancel"));
+      o->box(FL_ENGRAVED_BOX);
+      o->callback((Fl_Callback*)cb_Cancel);
+    } // Fl_Button* o
+    { button_add_srv_add = new Fl_Button(305, 478, 85, 25, gettext("&ADD"));
+      button_add_srv_add->box(FL_ENGRAVED_BOX);
+      button_add_srv_add->callback((Fl_Callback*)cb_button_add_srv_add);
+    } // Fl_Button* button_add_srv_add
+    { button_add_srv_save = new Fl_Button(305, 478, 85, 25, gettext("&Save"));
+      button_add_srv_save->box(FL_ENGRAVED_BOX);
+      button_add_srv_save->callback((Fl_Callback*)cb_button_add_srv_save);
+    } // Fl_Button* button_add_srv_save
+    { frame_add_srv_tls = new Fl_Group(140, 96, 250, 97, gettext("SSL/TLS"));
+      frame_add_srv_tls->box(FL_ENGRAVED_BOX);
+      frame_add_srv_tls->align(Fl_Align(FL_ALIGN_TOP_LEFT));
+      { check_add_srv_tls = new Fl_Check_Button(148, 100, 190, 20, gettext("Use SSL/TLS"));
+        check_add_srv_tls->down_box(FL_DOWN_BOX);
+      } // Fl_Check_Button* check_add_srv_tls
+      { button_add_srv_revoke_cert = new Fl_Button(150, 157, 225, 25, gettext("Revoke certificate trust"));
+        button_add_srv_revoke_cert->box(FL_ENGRAVED_BOX);
+        button_add_srv_revoke_cert->callback((Fl_Callback*)cb_button_add_srv_revoke_cert);
+      } // Fl_Button* button_add_srv_revoke_cert
+      frame_add_srv_tls->end();
+    } // Fl_Group* frame_add_srv_tls
+    { browser_add_srv_station_list = new Fl_Check_Browser(140, 216, 250, 83, gettext("Radio.co Stations"));
+      browser_add_srv_station_list->align(Fl_Align(FL_ALIGN_TOP_LEFT));
+    } // Fl_Check_Browser* browser_add_srv_station_list
+    { button_add_srv_get_stations = new Fl_Button(10, 205, 120, 25, gettext("Get Stations"));
+      button_add_srv_get_stations->box(FL_ENGRAVED_BOX);
+      button_add_srv_get_stations->callback((Fl_Callback*)cb_button_add_srv_get_stations);
+    } // Fl_Button* button_add_srv_get_stations
+    { button_add_srv_select_all = new Fl_Button(140, 301, 120, 20, gettext("Select all"));
+      button_add_srv_select_all->box(FL_ENGRAVED_BOX);
+      button_add_srv_select_all->callback((Fl_Callback*)cb_button_add_srv_select_all);
+    } // Fl_Button* button_add_srv_select_all
+    { button_add_srv_deselect_all = new Fl_Button(265, 301, 125, 20, gettext("Deselect all"));
+      button_add_srv_deselect_all->box(FL_ENGRAVED_BOX);
+      button_add_srv_deselect_all->callback((Fl_Callback*)cb_button_add_srv_deselect_all);
+    } // Fl_Button* button_add_srv_deselect_all
+    { check_add_srv_protocol = new Fl_Check_Button(8, 345, 297, 15, gettext("Use legacy Icecast protocol"));
+      check_add_srv_protocol->tooltip(gettext("Activate this if you want to use the older SOURCE protocol instead of the new"
+"er PUT protocol"));
+      check_add_srv_protocol->down_box(FL_DOWN_BOX);
+    } // Fl_Check_Button* check_add_srv_protocol
+    { input_webrtc_icesrv_url = new Fl_Input(10, 215, 380, 25, gettext("ICE server (optional):"));
+      input_webrtc_icesrv_url->align(Fl_Align(FL_ALIGN_TOP_LEFT));
+    } // Fl_Input* input_webrtc_icesrv_url
+    { input_webrtc_whip_url = new Fl_Input(10, 260, 380, 25, gettext("WebRTC (WHIP) URL:"));
+      input_webrtc_whip_url->align(Fl_Align(FL_ALIGN_TOP_LEFT));
+    } // Fl_Input* input_webrtc_whip_url
+    { input_webrtc_auth_token = new Fl_Input(10, 305, 380, 25, gettext("Bearer token (optional):"));
+      input_webrtc_auth_token->align(Fl_Align(FL_ALIGN_TOP_LEFT));
+    } // Fl_Input* input_webrtc_auth_token
+    { input_add_srv_listener_url = new Fl_Input(10, 393, 380, 25, gettext("Custom listener URL (optional):"));
+      input_add_srv_listener_url->align(Fl_Align(FL_ALIGN_TOP_LEFT));
+      this->input_add_srv_listener_url->maximum_size(100);
+    } // Fl_Input* input_add_srv_listener_url
+    { input_add_srv_listener_mount = new Fl_Input(10, 441, 380, 25, gettext("Custom listener mountpoint (optional):"));
+      input_add_srv_listener_mount->align(Fl_Align(FL_ALIGN_TOP_LEFT));
+      this->input_add_srv_listener_mount->maximum_size(100);
+    } // Fl_Input* input_add_srv_listener_mount
+    window_add_srv->set_modal();
+    window_add_srv->end();
+  } // Fl_Double_Window* window_add_srv
+  return window_add_srv;
+}
+
+void flgui::cb_Cancel1_i(Fl_Button*, void*) {
+  button_add_icy_cancel_cb();
+}
+void flgui::cb_Cancel1(Fl_Button* o, void* v) {
+  ((flgui*)(o->parent()->user_data()))->cb_Cancel1_i(o,v);
+}
+
+void flgui::cb_button_add_icy_add_i(Fl_Button*, void*) {
+  button_add_icy_add_cb();
+}
+void flgui::cb_button_add_icy_add(Fl_Button* o, void* v) {
+  ((flgui*)(o->parent()->user_data()))->cb_button_add_icy_add_i(o,v);
+}
+
+void flgui::cb_button_add_icy_save_i(Fl_Button*, void*) {
+  button_add_icy_save_cb();
+}
+void flgui::cb_button_add_icy_save(Fl_Button* o, void* v) {
+  ((flgui*)(o->parent()->user_data()))->cb_button_add_icy_save_i(o,v);
+}
+
+Fl_Double_Window* flgui::make_window_add_icy() {
+  if (window_add_icy != NULL) {
+    return window_add_icy;
+  }
+  { window_add_icy = new Fl_Double_Window(305, 380, gettext("Add stream info"));
+    window_add_icy->user_data((void*)(this));
+    { input_add_icy_name = new Fl_Input(10, 35, 285, 25, gettext("Name:"));
+      input_add_icy_name->tooltip(gettext("The name of your new ICY-entrie"));
+      input_add_icy_name->align(Fl_Align(FL_ALIGN_TOP_LEFT));
+      this->input_add_icy_name->maximum_size(100);
+    } // Fl_Input* input_add_icy_name
+    { input_add_icy_desc = new Fl_Input(10, 145, 170, 25, gettext("Description:"));
+      input_add_icy_desc->align(Fl_Align(FL_ALIGN_TOP_LEFT));
+      this->input_add_icy_desc->maximum_size(100);
+    } // Fl_Input* input_add_icy_desc
+    { input_add_icy_genre = new Fl_Input(185, 145, 110, 25, gettext("Genre:"));
+      input_add_icy_genre->align(Fl_Align(FL_ALIGN_TOP_LEFT));
+      this->input_add_icy_genre->maximum_size(100);
+    } // Fl_Input* input_add_icy_genre
+    { input_add_icy_url = new Fl_Input(10, 190, 170, 25, gettext("URL:"));
+      input_add_icy_url->align(Fl_Align(FL_ALIGN_TOP_LEFT));
+      this->input_add_icy_url->maximum_size(100);
+    } // Fl_Input* input_add_icy_url
+    { input_add_icy_icq = new Fl_Input(185, 190, 110, 25, gettext("ICQ:"));
+      input_add_icy_icq->align(Fl_Align(FL_ALIGN_TOP_LEFT));
+      this->input_add_icy_icq->maximum_size(100);
+    } // Fl_Input* input_add_icy_icq
+    { input_add_icy_irc = new Fl_Input(10, 235, 170, 25, gettext("IRC:"));
+      input_add_icy_irc->align(Fl_Align(FL_ALIGN_TOP_LEFT));
+      this->input_add_icy_irc->maximum_size(100);
+    } // Fl_Input* input_add_icy_irc
+    { input_add_icy_aim = new Fl_Input(185, 235, 110, 25, gettext("AIM:"));
+      input_add_icy_aim->align(Fl_Align(FL_ALIGN_TOP_LEFT));
+      this->input_add_icy_aim->maximum_size(100);
+    } // Fl_Input* input_add_icy_aim
+    { check_add_icy_pub = new Fl_Check_Button(10, 270, 235, 20, gettext("Make server public"));
+      check_add_icy_pub->down_box(FL_DOWN_BOX);
+    } // Fl_Check_Button* check_add_icy_pub
+    { check_expand_variables = new Fl_Check_Button(10, 295, 235, 20, gettext("Expand variables"));
+      check_expand_variables->tooltip(gettext("Activate to expand date variables in name and description"));
+      check_expand_variables->down_box(FL_DOWN_BOX);
+    } // Fl_Check_Button* check_expand_variables
+    { Fl_Button* o = new Fl_Button(10, 340, 74, 25, gettext("&Cancel"));
+      o->box(FL_ENGRAVED_BOX);
+      o->callback((Fl_Callback*)cb_Cancel1);
+    } // Fl_Button* o
+    { button_add_icy_add = new Fl_Button(224, 340, 74, 25, gettext("&ADD"));
+      button_add_icy_add->box(FL_ENGRAVED_BOX);
+      button_add_icy_add->callback((Fl_Callback*)cb_button_add_icy_add);
+    } // Fl_Button* button_add_icy_add
+    { button_add_icy_save = new Fl_Button(224, 340, 74, 25, gettext("&Save"));
+      button_add_icy_save->box(FL_ENGRAVED_BOX);
+      button_add_icy_save->callback((Fl_Callback*)cb_button_add_icy_save);
+    } // Fl_Button* button_add_icy_save
+    window_add_icy->set_modal();
+    window_add_icy->end();
+  } // Fl_Double_Window* window_add_icy
+  return window_add_icy;
+}
+
+void flgui::cb_Copy_i(Fl_Button*, void*) {
+  int len = this->output_bitcoin_addr->size();
+  this->output_bitcoin_addr->position(0, len);
+  this->output_bitcoin_addr->copy(1);
+
+  fl_message(_("Bitcoin address has been copied to clipboard."));
+}
+void flgui::cb_Copy(Fl_Button* o, void* v) {
+  ((flgui*)(o->parent()->user_data()))->cb_Copy_i(o,v);
+}
+
+void flgui::cb_Copy1_i(Fl_Button*, void*) {
+  int len = this->output_litecoin_addr->size();
+  this->output_litecoin_addr->position(0, len);
+  this->output_litecoin_addr->copy(1);
+
+  fl_message(_("Litecoin address has been copied to clipboard."));
+}
+void flgui::cb_Copy1(Fl_Button* o, void* v) {
+  ((flgui*)(o->parent()->user_data()))->cb_Copy1_i(o,v);
+}
+
+void flgui::cb_Copy2_i(Fl_Button*, void*) {
+  int len = this->output_monero_addr->size();
+  this->output_monero_addr->position(0, len);
+  this->output_monero_addr->copy(1);
+
+  fl_message(_("Monero address has been copied to clipboard."));
+}
+void flgui::cb_Copy2(Fl_Button* o, void* v) {
+  ((flgui*)(o->parent()->user_data()))->cb_Copy2_i(o,v);
+}
+
+void flgui::cb_Close_i(Fl_Button*, void*) {
+  this->window_donate_crypto->hide();
+}
+void flgui::cb_Close(Fl_Button* o, void* v) {
+  ((flgui*)(o->parent()->user_data()))->cb_Close_i(o,v);
+}
+
+Fl_My_Double_Window* flgui::make_window_donate_crypto() {
+  if (window_donate_crypto != NULL) {
+    return window_donate_crypto;
+  }
+  { window_donate_crypto = new Fl_My_Double_Window(460, 255, gettext("Donate Cryptocurrency"));
+    window_donate_crypto->box(FL_FLAT_BOX);
+    window_donate_crypto->color(FL_BACKGROUND_COLOR);
+    window_donate_crypto->selection_color(FL_BACKGROUND_COLOR);
+    window_donate_crypto->labeltype(FL_NO_LABEL);
+    window_donate_crypto->labelfont(0);
+    window_donate_crypto->labelsize(14);
+    window_donate_crypto->labelcolor(FL_FOREGROUND_COLOR);
+    window_donate_crypto->user_data((void*)(this));
+    window_donate_crypto->align(Fl_Align(FL_ALIGN_TOP));
+    window_donate_crypto->when(FL_WHEN_RELEASE);
+    { output_bitcoin_addr = new Fl_Output(20, 40, 320, 22, gettext("Bitcoin"));
+      output_bitcoin_addr->box(FL_FLAT_BOX);
+      output_bitcoin_addr->align(Fl_Align(FL_ALIGN_TOP_LEFT));
+      output_bitcoin_addr->value("bc1q4uq7h464rsu2cudrmuuqmc4tcr98d0edrhe5au");
+    } // Fl_Output* output_bitcoin_addr
+    { Fl_Button* o = new Fl_Button(350, 40, 88, 22, gettext("Copy"));
+      o->box(FL_ENGRAVED_BOX);
+      o->callback((Fl_Callback*)cb_Copy);
+    } // Fl_Button* o
+    { output_litecoin_addr = new Fl_Output(20, 100, 320, 22, gettext("Litecoin"));
+      output_litecoin_addr->box(FL_FLAT_BOX);
+      output_litecoin_addr->align(Fl_Align(FL_ALIGN_TOP_LEFT));
+      output_litecoin_addr->value("Ld9gntf8fsYpmVcbstFkzz5R3sNPC3AhTx");
+    } // Fl_Output* output_litecoin_addr
+    { Fl_Button* o = new Fl_Button(350, 100, 88, 22, gettext("Copy"));
+      o->box(FL_ENGRAVED_BOX);
+      o->callback((Fl_Callback*)cb_Copy1);
+    } // Fl_Button* o
+    { output_monero_addr = new Fl_Output(20, 160, 320, 22, gettext("Monero"));
+      output_monero_addr->box(FL_FLAT_BOX);
+      output_monero_addr->align(Fl_Align(FL_ALIGN_TOP_LEFT));
+      output_monero_addr->value("85u8DacasxPNvKzY5kEiprBnbydDqg26yGAVEw7mdwccNFsrXMWCE4VQnV2JVfh5BTRheNnpDJqYjbqPrVRLEPAKP3dsYgc");
+    } // Fl_Output* output_monero_addr
+    { Fl_Button* o = new Fl_Button(350, 160, 88, 22, gettext("Copy"));
+      o->box(FL_ENGRAVED_BOX);
+      o->callback((Fl_Callback*)cb_Copy2);
+    } // Fl_Button* o
+    { Fl_Button* o = new Fl_Button(20, 217, 88, 22, gettext("&Close"));
+      o->box(FL_ENGRAVED_BOX);
+      o->callback((Fl_Callback*)cb_Close);
+    } // Fl_Button* o
+    window_donate_crypto->end();
+  } // Fl_My_Double_Window* window_donate_crypto
+  return window_donate_crypto;
+}
+
+void flgui::cb_Open_i(Fl_Button*, void*) {
+  char uri[128];
+  snprintf(uri, sizeof(uri), "https://danielnoethen.de/butt/release/%s/butt-%s_manual.html", VERSION, VERSION);
+  fl_open_uri(uri);
+  this->window_missing_aac_lib->hide();
+}
+void flgui::cb_Open(Fl_Button* o, void* v) {
+  ((flgui*)(o->parent()->user_data()))->cb_Open_i(o,v);
+}
+
+void flgui::cb_Close3_i(Fl_Button*, void*) {
+  this->window_missing_aac_lib->hide();
+}
+void flgui::cb_Close3(Fl_Button* o, void* v) {
+  ((flgui*)(o->parent()->user_data()))->cb_Close3_i(o,v);
+}
+
+Fl_My_Double_Window* flgui::make_window_missing_aac_lib() {
+  if (window_missing_aac_lib != NULL) {
+    return window_missing_aac_lib;
+  }
   { window_missing_aac_lib = new Fl_My_Double_Window(390, 190, gettext("Alert"));
     window_missing_aac_lib->box(FL_FLAT_BOX);
     window_missing_aac_lib->color(FL_BACKGROUND_COLOR);
@@ -6238,6 +6269,7 @@ flgui::flgui() {
     window_missing_aac_lib->set_modal();
     window_missing_aac_lib->end();
   } // Fl_My_Double_Window* window_missing_aac_lib
+  return window_missing_aac_lib;
 }
 
 flgui::~flgui() {
@@ -919,121 +919,6 @@ private:
   static void cb_Apple(Fl_Button*, void*);
   inline void cb_Bitcoin_i(Fl_Button*, void*);
   static void cb_Bitcoin(Fl_Button*, void*);
-public:
-  Fl_Double_Window *window_add_srv;
-  Fl_Input *input_add_srv_name;
-  Fl_Input *input_add_srv_addr;
-  Fl_Int_Input *input_add_srv_port;
-  Fl_Input *input_add_srv_pwd;
-  Fl_Input *input_add_srv_mount;
-  Fl_Input *input_add_srv_usr;
-  Fl_Button *button_cfg_show_pw;
-private:
-  inline void cb_button_cfg_show_pw_i(Fl_Button*, void*);
-  static void cb_button_cfg_show_pw(Fl_Button*, void*);
-public:
-  Fl_Round_Button *radio_add_srv_shoutcast;
-private:
-  inline void cb_radio_add_srv_shoutcast_i(Fl_Round_Button*, void*);
-  static void cb_radio_add_srv_shoutcast(Fl_Round_Button*, void*);
-public:
-  Fl_Round_Button *radio_add_srv_icecast;
-private:
-  inline void cb_radio_add_srv_icecast_i(Fl_Round_Button*, void*);
-  static void cb_radio_add_srv_icecast(Fl_Round_Button*, void*);
-public:
-  Fl_Round_Button *radio_add_srv_webrtc;
-private:
-  inline void cb_radio_add_srv_webrtc_i(Fl_Round_Button*, void*);
-  static void cb_radio_add_srv_webrtc(Fl_Round_Button*, void*);
-public:
-  Fl_Round_Button *radio_add_srv_radioco;
-private:
-  inline void cb_radio_add_srv_radioco_i(Fl_Round_Button*, void*);
-  static void cb_radio_add_srv_radioco(Fl_Round_Button*, void*);
-  inline void cb_Cancel_i(Fl_Button*, void*);
-  static void cb_Cancel(Fl_Button*, void*);
-public:
-  Fl_Button *button_add_srv_add;
-private:
-  inline void cb_button_add_srv_add_i(Fl_Button*, void*);
-  static void cb_button_add_srv_add(Fl_Button*, void*);
-public:
-  Fl_Button *button_add_srv_save;
-private:
-  inline void cb_button_add_srv_save_i(Fl_Button*, void*);
-  static void cb_button_add_srv_save(Fl_Button*, void*);
-public:
-  Fl_Group *frame_add_srv_tls;
-  Fl_Check_Button *check_add_srv_tls;
-  Fl_Button *button_add_srv_revoke_cert;
-private:
-  inline void cb_button_add_srv_revoke_cert_i(Fl_Button*, void*);
-  static void cb_button_add_srv_revoke_cert(Fl_Button*, void*);
-public:
-  Fl_Check_Browser *browser_add_srv_station_list;
-  Fl_Button *button_add_srv_get_stations;
-private:
-  inline void cb_button_add_srv_get_stations_i(Fl_Button*, void*);
-  static void cb_button_add_srv_get_stations(Fl_Button*, void*);
-public:
-  Fl_Button *button_add_srv_select_all;
-private:
-  inline void cb_button_add_srv_select_all_i(Fl_Button*, void*);
-  static void cb_button_add_srv_select_all(Fl_Button*, void*);
-public:
-  Fl_Button *button_add_srv_deselect_all;
-private:
-  inline void cb_button_add_srv_deselect_all_i(Fl_Button*, void*);
-  static void cb_button_add_srv_deselect_all(Fl_Button*, void*);
-public:
-  Fl_Check_Button *check_add_srv_protocol;
-  Fl_Input *input_webrtc_icesrv_url;
-  Fl_Input *input_webrtc_whip_url;
-  Fl_Input *input_webrtc_auth_token;
-  Fl_Input *input_add_srv_listener_url;
-  Fl_Input *input_add_srv_listener_mount;
-  Fl_Double_Window *window_add_icy;
-  Fl_Input *input_add_icy_name;
-  Fl_Input *input_add_icy_desc;
-  Fl_Input *input_add_icy_genre;
-  Fl_Input *input_add_icy_url;
-  Fl_Input *input_add_icy_icq;
-  Fl_Input *input_add_icy_irc;
-  Fl_Input *input_add_icy_aim;
-  Fl_Check_Button *check_add_icy_pub;
-  Fl_Check_Button *check_expand_variables;
-private:
-  inline void cb_Cancel1_i(Fl_Button*, void*);
-  static void cb_Cancel1(Fl_Button*, void*);
-public:
-  Fl_Button *button_add_icy_add;
-private:
-  inline void cb_button_add_icy_add_i(Fl_Button*, void*);
-  static void cb_button_add_icy_add(Fl_Button*, void*);
-public:
-  Fl_Button *button_add_icy_save;
-private:
-  inline void cb_button_add_icy_save_i(Fl_Button*, void*);
-  static void cb_button_add_icy_save(Fl_Button*, void*);
-public:
-  Fl_My_Double_Window *window_donate_crypto;
-  Fl_Output *output_bitcoin_addr;
-private:
-  inline void cb_Copy_i(Fl_Button*, void*);
-  static void cb_Copy(Fl_Button*, void*);
-public:
-  Fl_Output *output_litecoin_addr;
-private:
-  inline void cb_Copy1_i(Fl_Button*, void*);
-  static void cb_Copy1(Fl_Button*, void*);
-public:
-  Fl_Output *output_monero_addr;
-private:
-  inline void cb_Copy2_i(Fl_Button*, void*);
-  static void cb_Copy2(Fl_Button*, void*);
-  inline void cb_Close_i(Fl_Button*, void*);
-  static void cb_Close(Fl_Button*, void*);
 public:
   Fl_My_Double_Window *window_stream_codec_settings;
   Fl_Tabs *tabs_stream_codec_settings;
@@ -1441,6 +1326,126 @@ private:
   inline void cb_slider_mixer_cross_fader_i(Fl_My_Value_Slider*, void*);
   static void cb_slider_mixer_cross_fader(Fl_My_Value_Slider*, void*);
 public:
+  Fl_Double_Window* make_window_add_srv();
+  Fl_Double_Window *window_add_srv;
+  Fl_Input *input_add_srv_name;
+  Fl_Input *input_add_srv_addr;
+  Fl_Int_Input *input_add_srv_port;
+  Fl_Input *input_add_srv_pwd;
+  Fl_Input *input_add_srv_mount;
+  Fl_Input *input_add_srv_usr;
+  Fl_Button *button_cfg_show_pw;
+private:
+  inline void cb_button_cfg_show_pw_i(Fl_Button*, void*);
+  static void cb_button_cfg_show_pw(Fl_Button*, void*);
+public:
+  Fl_Round_Button *radio_add_srv_shoutcast;
+private:
+  inline void cb_radio_add_srv_shoutcast_i(Fl_Round_Button*, void*);
+  static void cb_radio_add_srv_shoutcast(Fl_Round_Button*, void*);
+public:
+  Fl_Round_Button *radio_add_srv_icecast;
+private:
+  inline void cb_radio_add_srv_icecast_i(Fl_Round_Button*, void*);
+  static void cb_radio_add_srv_icecast(Fl_Round_Button*, void*);
+public:
+  Fl_Round_Button *radio_add_srv_webrtc;
+private:
+  inline void cb_radio_add_srv_webrtc_i(Fl_Round_Button*, void*);
+  static void cb_radio_add_srv_webrtc(Fl_Round_Button*, void*);
+public:
+  Fl_Round_Button *radio_add_srv_radioco;
+private:
+  inline void cb_radio_add_srv_radioco_i(Fl_Round_Button*, void*);
+  static void cb_radio_add_srv_radioco(Fl_Round_Button*, void*);
+  inline void cb_Cancel_i(Fl_Button*, void*);
+  static void cb_Cancel(Fl_Button*, void*);
+public:
+  Fl_Button *button_add_srv_add;
+private:
+  inline void cb_button_add_srv_add_i(Fl_Button*, void*);
+  static void cb_button_add_srv_add(Fl_Button*, void*);
+public:
+  Fl_Button *button_add_srv_save;
+private:
+  inline void cb_button_add_srv_save_i(Fl_Button*, void*);
+  static void cb_button_add_srv_save(Fl_Button*, void*);
+public:
+  Fl_Group *frame_add_srv_tls;
+  Fl_Check_Button *check_add_srv_tls;
+  Fl_Button *button_add_srv_revoke_cert;
+private:
+  inline void cb_button_add_srv_revoke_cert_i(Fl_Button*, void*);
+  static void cb_button_add_srv_revoke_cert(Fl_Button*, void*);
+public:
+  Fl_Check_Browser *browser_add_srv_station_list;
+  Fl_Button *button_add_srv_get_stations;
+private:
+  inline void cb_button_add_srv_get_stations_i(Fl_Button*, void*);
+  static void cb_button_add_srv_get_stations(Fl_Button*, void*);
+public:
+  Fl_Button *button_add_srv_select_all;
+private:
+  inline void cb_button_add_srv_select_all_i(Fl_Button*, void*);
+  static void cb_button_add_srv_select_all(Fl_Button*, void*);
+public:
+  Fl_Button *button_add_srv_deselect_all;
+private:
+  inline void cb_button_add_srv_deselect_all_i(Fl_Button*, void*);
+  static void cb_button_add_srv_deselect_all(Fl_Button*, void*);
+public:
+  Fl_Check_Button *check_add_srv_protocol;
+  Fl_Input *input_webrtc_icesrv_url;
+  Fl_Input *input_webrtc_whip_url;
+  Fl_Input *input_webrtc_auth_token;
+  Fl_Input *input_add_srv_listener_url;
+  Fl_Input *input_add_srv_listener_mount;
+public:
+  Fl_Double_Window* make_window_add_icy();
+  Fl_Double_Window *window_add_icy;
+  Fl_Input *input_add_icy_name;
+  Fl_Input *input_add_icy_desc;
+  Fl_Input *input_add_icy_genre;
+  Fl_Input *input_add_icy_url;
+  Fl_Input *input_add_icy_icq;
+  Fl_Input *input_add_icy_irc;
+  Fl_Input *input_add_icy_aim;
+  Fl_Check_Button *check_add_icy_pub;
+  Fl_Check_Button *check_expand_variables;
+private:
+  inline void cb_Cancel1_i(Fl_Button*, void*);
+  static void cb_Cancel1(Fl_Button*, void*);
+public:
+  Fl_Button *button_add_icy_add;
+private:
+  inline void cb_button_add_icy_add_i(Fl_Button*, void*);
+  static void cb_button_add_icy_add(Fl_Button*, void*);
+public:
+  Fl_Button *button_add_icy_save;
+private:
+  inline void cb_button_add_icy_save_i(Fl_Button*, void*);
+  static void cb_button_add_icy_save(Fl_Button*, void*);
+public:
+  Fl_My_Double_Window* make_window_donate_crypto();
+  Fl_My_Double_Window *window_donate_crypto;
+  Fl_Output *output_bitcoin_addr;
+private:
+  inline void cb_Copy_i(Fl_Button*, void*);
+  static void cb_Copy(Fl_Button*, void*);
+public:
+  Fl_Output *output_litecoin_addr;
+private:
+  inline void cb_Copy1_i(Fl_Button*, void*);
+  static void cb_Copy1(Fl_Button*, void*);
+public:
+  Fl_Output *output_monero_addr;
+private:
+  inline void cb_Copy2_i(Fl_Button*, void*);
+  static void cb_Copy2(Fl_Button*, void*);
+  inline void cb_Close_i(Fl_Button*, void*);
+  static void cb_Close(Fl_Button*, void*);
+public:
+  Fl_My_Double_Window* make_window_missing_aac_lib();
   Fl_My_Double_Window *window_missing_aac_lib;
 private:
   inline void cb_Open_i(Fl_Button*, void*);
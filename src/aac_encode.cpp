@@ -19,6 +19,7 @@
 #include "config.h"
 #include "fl_funcs.h"
 #include "aac_encode.h"
+#include "pcm_convert.h"
 #include "wav_header.h"
 
 int g_aac_lib_available = 0;
@@ -187,14 +188,7 @@ int aac_enc_encode(aac_enc *aac, float *pcm_float, char *enc_buf, int frames, in
     aac->state = AAC_BUSY;
 
     // Convert from float to int32
-    for (int i = 0; i < frames * aac->channel; i++) {
-        if (pcm_float[i] > 0) {
-            pcm_int32[i] = (int32_t)round(fmin(pcm_float[i] * INT32_MAX, INT32_MAX));
-        }
-        else {
-            pcm_int32[i] = (int32_t)round(fmax(-pcm_float[i] * INT32_MIN, INT32_MIN));
-        }
-    }
+    pcm_float_to_s32(pcm_float, pcm_int32, frames * aac->channel);
 
     if (aacEncEncode_butt(aac->handle, &in_buf, &out_buf, &in_args, &out_args) != AACENC_OK) {
         return 0;
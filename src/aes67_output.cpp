@@ -19,6 +19,8 @@
 #include <pthread.h>
 #include <time.h>
 #include "ringbuffer.h"
+#include "metrics.h"
+#include "trace.h"
 
 // Structure pour l'en-tête RTP
 typedef struct {
@@ -221,7 +223,8 @@ int aes67_output_init(aes67_output_t* output) {
     }
     // Ringbuffer doit pouvoir contenir au moins 200ms pour absorber les gros buffers du mixer
     // Le mixer peut envoyer jusqu'à ~100ms d'un coup (19200 bytes pour 48kHz stéréo)
-    output->input_rb_capacity = output->float_packet_buffer_size * 256; // ~256ms
+    // 256ms independent of the packet duration, which is shorter for many channels
+    output->input_rb_capacity = (size_t)output->config.sample_rate * output->config.channels * sizeof(float) * 256 / 1000;
     ringbuf_t* rb = (ringbuf_t*)malloc(sizeof(ringbuf_t));
     if (!rb) {
         fprintf(stderr, "AES67: Erreur alloc ringbuffer struct\n");
@@ -270,8 +273,8 @@ int aes67_output_send(aes67_output_t* output, const void* audio_data, size_t dat
     
     if (!output || !output->initialized || !audio_data || data_size == 0) {
         if (send_counter < 3) {
-            printf("❌ SEND: Invalid params (output=%p, init=%d, data=%p, size=%zu)\n",
-                   output, output ? output->initialized : 0, audio_data, data_size);
+            TRACE(TRACE_ERROR, "AES67 send: invalid params (output=%p, init=%d, data=%p, size=%zu)", (void *)output, output ? output->initialized : 0,
+                  audio_data, data_size);
             send_counter++;
         }
         return -1;
@@ -279,7 +282,7 @@ int aes67_output_send(aes67_output_t* output, const void* audio_data, size_t dat
 
     if (!output->config.active) {
         if (send_counter < 3) {
-            printf("⚠️  SEND: AES67 not active (config.active=false)\n");
+            TRACE(TRACE_INFO, "AES67 send: output not active (config.active=false)");
             send_counter++;
         }
         return 0; // Sortie désactivée, pas d'erreur
@@ -289,10 +292,8 @@ int aes67_output_send(aes67_output_t* output, const void* audio_data, size_t dat
     ringbuf_t* rb = (ringbuf_t*)output->input_rb_handle;
     int written = rb_write(rb, (char*)audio_data, (unsigned int)data_size);
     
-    if (send_counter < 5) {
-        int filled = rb_filled(rb);
-        printf("✅ SEND: Wrote %zu bytes to ringbuffer, result=%d, filled=%d\n",
-               data_size, written, filled);
+    if (TRACE_ON(TRACE_DEBUG) && send_counter < 5) {
+        TRACE(TRACE_DEBUG, "AES67 send: wrote %zu bytes to ringbuffer, result=%d, filled=%d", data_size, written, rb_filled(rb));
         send_counter++;
     }
     
@@ -311,7 +312,12 @@ static void* aes67_sender_thread(void* arg) {
     dest_addr.sin_port = htons(output->config.destination_port);
     dest_addr.sin_addr.s_addr = inet_addr(output->config.destination_ip);
 
-    printf("🎯 AES67 SENDER THREAD: Démarré (float_block_bytes=%zu)\n", float_block_bytes);
+    trace_set_thread_name("aes67");
+    TRACE(TRACE_INFO, "sender thread started (float_block_bytes=%zu)", float_block_bytes);
+
+    // Intervalle nominal entre deux paquets, pour la mesure de gigue (metrics)
+    uint64_t nominal_interval_us = (uint64_t)output->samples_per_packet * 1000000 / output->config.sample_rate;
+    uint64_t last_send_us = 0;
 
     // Attente avec vérification rapide du flag sender_running
     static int debug_counter = 0;
@@ -320,12 +326,15 @@ static void* aes67_sender_thread(void* arg) {
         int filled = rb_filled(rb);
         bool active = output->config.active;
         
-        if (debug_counter < 10) {
-            printf("🔍 SENDER: filled=%d, need=%zu, active=%d\n", filled, float_block_bytes, active);
+        if (TRACE_ON(TRACE_DEBUG) && debug_counter < 10) {
+            TRACE(TRACE_DEBUG, "filled=%d, need=%zu, active=%d", filled, float_block_bytes, active);
             debug_counter++;
         }
         
+        metrics_set(METRIC_RB_FILL_AES67, (double)filled / rb->size);
+
         if (!active) {
+            last_send_us = 0; // Pas de gigue mesurée sur une pause volontaire
             // Vérifier sender_running fréquemment pour sortie rapide
             usleep(10000); // 10ms au lieu de 1ms pour réduire la charge CPU
             continue;
@@ -336,7 +345,7 @@ static void* aes67_sender_thread(void* arg) {
         if (filled < (int)float_block_bytes) {
             if (filled > 0) {
                 // Il y a des données partielles, les traiter
-                printf("🔍 SENDER: Données partielles disponibles: %d/%zu bytes\n", filled, float_block_bytes);
+                TRACE(TRACE_DEBUG, "partial data available: %d/%zu bytes", filled, float_block_bytes);
             } else {
                 // Aucune donnée, attendre un peu
                 usleep(1000); // 1ms
@@ -367,6 +376,7 @@ static void* aes67_sender_thread(void* arg) {
         if (!has_audio) {
             // Pas d'audio, ne pas remettre dans le ringbuffer (cela causerait des boucles)
             // Juste attendre un peu et continuer
+            last_send_us = 0;
             usleep(1000); // 1ms
             continue;
         }
@@ -376,30 +386,17 @@ static void* aes67_sender_thread(void* arg) {
         
         // 🔍 DIAGNOSTIC: Confirmer que l'audio est détecté
         static int audio_detected_counter = 0;
-        if (audio_detected_counter < 5) {
+        if (TRACE_ON(TRACE_DEBUG) && audio_detected_counter < 5) {
             float max_audio = 0.0f;
             for (size_t i = 0; i < samples_block_total && i < 100; i++) {
                 if (fabs(temp_check_buffer[i]) > max_audio) {
                     max_audio = fabs(temp_check_buffer[i]);
                 }
             }
-            printf("🔍 AUDIO DETECTED %d: max_audio=%.6f, samples=%zu\n", 
-                   audio_detected_counter, max_audio, samples_block_total);
+            TRACE(TRACE_DEBUG, "audio detected %d: max_audio=%.6f, samples=%zu", audio_detected_counter, max_audio, samples_block_total);
             audio_detected_counter++;
         }
         
-        if (debug_counter == 10) {
-            printf("📤 SENDER: Audio détecté ! Processing %zu bytes and sending RTP...\n", float_block_bytes);
-            debug_counter++;
-        }
-        
-        // 🔍 DIAGNOSTIC: Log périodique pour confirmer l'envoi continu
-        static int continuous_send_counter = 0;
-        if (continuous_send_counter % 100 == 0) {
-            printf("🔄 SENDER: Envoi continu - paquet #%d\n", continuous_send_counter);
-        }
-        continuous_send_counter++;
-
         // Mise à jour du mini-PLL si activé
         static uint64_t pll_last_correction_time = 0;
         static double accumulated_correction_samples = 0.0;
@@ -425,8 +422,7 @@ static void* aes67_sender_thread(void* arg) {
                     // Log des corrections importantes seulement
                     if (abs(correction_samples) > 0 && 
                         (timestamp_ns - pll_last_correction_time) > 5000000000ULL) { // 5 secondes
-                        printf("AES67 PLL: Correction appliquée: %+d échantillons (%.2f PPM)\n", 
-                               correction_samples, correction_ppm);
+                        TRACE(TRACE_INFO, "PLL correction: %+d samples (%.2f PPM)", correction_samples, correction_ppm);
                         pll_last_correction_time = timestamp_ns;
                     }
                 }
@@ -446,7 +442,7 @@ static void* aes67_sender_thread(void* arg) {
 
         // 🔍 DIAGNOSTIC: Vérifier la qualité de la conversion audio
         static int diagnostic_counter = 0;
-        if (diagnostic_counter < 20) {
+        if (TRACE_ON(TRACE_DEBUG) && diagnostic_counter < 20) {
             // Vérifier les données d'entrée (float)
             float* input_samples = (float*)output->float_packet_buffer;
             float max_input = 0.0f, min_input = 0.0f;
@@ -463,14 +459,12 @@ static void* aes67_sender_thread(void* arg) {
                     if (output_samples[i] > max_output) max_output = output_samples[i];
                     if (output_samples[i] < min_output) min_output = output_samples[i];
                 }
-                printf("🔍 DIAGNOSTIC %d: Input float [%.6f, %.6f] → Output PCM16 [%d, %d]\n", 
-                       diagnostic_counter, min_input, max_input, min_output, max_output);
+                TRACE(TRACE_DEBUG, "conversion %d: input float [%.6f, %.6f] -> output PCM16 [%d, %d]", diagnostic_counter, min_input, max_input,
+                      min_output, max_output);
             } else {
                 uint8_t* output_bytes = (uint8_t*)output->output_buffer;
-                printf("🔍 DIAGNOSTIC %d: Input float [%.6f, %.6f] → Output L24 bytes [%02x %02x %02x, %02x %02x %02x]\n", 
-                       diagnostic_counter, min_input, max_input, 
-                       output_bytes[0], output_bytes[1], output_bytes[2],
-                       output_bytes[3], output_bytes[4], output_bytes[5]);
+                TRACE(TRACE_DEBUG, "conversion %d: input float [%.6f, %.6f] -> output L24 bytes [%02x %02x %02x, %02x %02x %02x]", diagnostic_counter,
+                      min_input, max_input, output_bytes[0], output_bytes[1], output_bytes[2], output_bytes[3], output_bytes[4], output_bytes[5]);
             }
             diagnostic_counter++;
         }
@@ -488,10 +482,9 @@ static void* aes67_sender_thread(void* arg) {
 
         // 🔍 DIAGNOSTIC: Vérifier les en-têtes RTP
         static int rtp_diagnostic_counter = 0;
-        if (rtp_diagnostic_counter < 10) {
-            printf("🔍 RTP HEADER %d: PT=%d, Seq=%d, TS=%u, SSRC=0x%08x\n", 
-                   rtp_diagnostic_counter, payload_type, ntohs(hdr->sequence_number), 
-                   ntohl(hdr->timestamp), ntohl(hdr->ssrc));
+        if (TRACE_ON(TRACE_DEBUG) && rtp_diagnostic_counter < 10) {
+            TRACE(TRACE_DEBUG, "RTP header %d: PT=%d, Seq=%d, TS=%u, SSRC=0x%08x", rtp_diagnostic_counter, payload_type, ntohs(hdr->sequence_number),
+                  ntohl(hdr->timestamp), ntohl(hdr->ssrc));
             rtp_diagnostic_counter++;
         }
 
@@ -508,21 +501,21 @@ static void* aes67_sender_thread(void* arg) {
         static int send_packet_counter = 0;
         if (send_packet_counter < 10) {
             if (sent < 0) {
-                printf("❌ SENDTO ERROR: errno=%d (%s), seq=%d, ts=%u\n",
-                       errno, strerror(errno), ntohs(hdr->sequence_number), ntohl(hdr->timestamp));
-            } else {
-                printf("📡 SENDTO: packet_size=%zu, sent=%zd, seq=%d, ts=%u, payload_bytes=%zu\n",
-                       packet_size, sent, ntohs(hdr->sequence_number), ntohl(hdr->timestamp), payload_bytes);
+                TRACE(TRACE_ERROR, "sendto failed: errno=%d (%s), seq=%d, ts=%u", errno, strerror(errno), ntohs(hdr->sequence_number),
+                      ntohl(hdr->timestamp));
+            } else if (TRACE_ON(TRACE_DEBUG)) {
+                TRACE(TRACE_DEBUG, "sendto: packet_size=%zu, sent=%zd, seq=%d, ts=%u, payload_bytes=%zu", packet_size, sent,
+                      ntohs(hdr->sequence_number), ntohl(hdr->timestamp), payload_bytes);
                 
                 // 🔍 DIAGNOSTIC: Vérifier le contenu du paquet envoyé
                 if (send_packet_counter < 3) {
                     uint8_t* packet_data = (uint8_t*)output->packet_buffer;
-                    printf("🔍 PACKET DATA %d: Header[0-11]=%02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x\n",
+                    TRACE(TRACE_DEBUG, "packet data %d: header[0-11]=%02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x",
                            send_packet_counter,
                            packet_data[0], packet_data[1], packet_data[2], packet_data[3],
                            packet_data[4], packet_data[5], packet_data[6], packet_data[7],
                            packet_data[8], packet_data[9], packet_data[10], packet_data[11]);
-                    printf("🔍 PACKET DATA %d: Payload[0-23]=%02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x\n",
+                    TRACE(TRACE_DEBUG, "packet data %d: payload[0-23]=%02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x %02x",
                            send_packet_counter,
                            packet_data[12], packet_data[13], packet_data[14], packet_data[15],
                            packet_data[16], packet_data[17], packet_data[18], packet_data[19],
@@ -539,11 +532,26 @@ static void* aes67_sender_thread(void* arg) {
             output->packets_sent++;
             output->bytes_sent += (unsigned long long)sent;
             aes67_timestamp += (uint32_t)output->samples_per_packet;
+
+            // L'envoi continu est visible via butt_aes67_packets_total au lieu d'un printf tous les 100 paquets
+            uint64_t now_us = metrics_now_us();
+            if (last_send_us != 0) {
+                uint64_t interval_us = now_us - last_send_us;
+                output->last_interval_us = (double)interval_us;
+                metrics_observe_us(METRIC_AES67_JITTER, interval_us > nominal_interval_us ? interval_us - nominal_interval_us
+                                                                                            : nominal_interval_us - interval_us);
+            }
+            last_send_us = now_us;
+            metrics_inc(METRIC_AES67_PACKETS);
+            metrics_add(METRIC_AES67_BYTES, (uint64_t)sent);
+        }
+        else {
+            metrics_inc(METRIC_AES67_SEND_ERRORS);
         }
     }
 
     output->sender_running = false; // Signaler la fin du thread
-    printf("AES67: Thread sender terminé proprement\n");
+    TRACE(TRACE_INFO, "sender thread finished");
     return NULL;
 }
 
@@ -763,6 +771,10 @@ int aes67_output_generate_sdp(aes67_output_t* output) {
         return -1;
     }
 
+    // The packet duration depends on the number of channels (see snd_init_aes67())
+    snprintf(output->sdp_state.config.media_ptime, sizeof(output->sdp_state.config.media_ptime), "%g", output->config.packet_duration_ms);
+    snprintf(output->sdp_state.config.media_maxptime, sizeof(output->sdp_state.config.media_maxptime), "%g", output->config.packet_duration_ms);
+
     if (sdp_generate_session_description(&output->sdp_state, 
                                        output->config.destination_ip,
                                        output->config.destination_port,
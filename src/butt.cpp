@@ -48,6 +48,8 @@
 
 #include "butt.h"
 #include "command.h"
+#include "metrics.h"
+#include "trace.h"
 #include "stereo_tool.h"
 #include "aes67_output.h"
 #include "sockfuncs.h"
@@ -168,10 +170,10 @@ void print_usage(void)
 {
 #ifndef BUILD_CLIENT
     printf(
-        "Usage: butt [-h | -v | -s [name] | -u <song name> | -M <streaming signal threshold> | -m <streaming silence threshold> | -O <recording signal threshold> | -o <recording silence threshold> | -SLdrtqn | -c <config_path>] [-A | -U | -x] [-a <addr>] [-p <port>]\n");
+        "Usage: butt [-h | -v | -s [name] | -u <song name> | -M <streaming signal threshold> | -m <streaming silence threshold> | -O <recording signal threshold> | -o <recording silence threshold> | -W <events per second> | -B <requests per second> | -SLdrtqn | -c <config_path>] [-A | -U | -x] [-T] [-a <addr>] [-p <port>]\n");
 #else
     printf(
-        "Usage: butt-client [-h | -v | -s [name] | -u <song name> | -M <streaming signal threshold> | -m <streaming silence threshold> | -O <recording signal threshold> | -o <recording silence threshold> | -USdrtqn ] [-a <addr>] [-p <port>]\n");
+        "Usage: butt-client [-h | -v | -s [name] | -u <song name> | -M <streaming signal threshold> | -m <streaming silence threshold> | -O <recording signal threshold> | -o <recording silence threshold> | -W <events per second> | -B <requests per second> | -USdrtqn ] [-a <addr>] [-p <port>]\n");
 #endif
     fflush(stdout);
 }
@@ -242,6 +244,83 @@ void load_AAC_lib(void)
 #endif
 }
 
+enum {
+    STARTUP_CONFIG_READ = 0,
+    STARTUP_GUI_BUILT,
+    STARTUP_GUI_SHOWN,
+    STARTUP_AUDIO_OPENED,
+    STARTUP_PHASES,
+};
+
+#define STARTUP_BENCH_TIMEOUT 10 // Seconds to wait for the first audio block
+
+static int startup_bench = 0;
+static uint64_t startup_begin_us;
+static uint64_t startup_phase_us[STARTUP_PHASES];
+
+static void startup_mark(int phase)
+{
+    startup_phase_us[phase] = metrics_now_us();
+}
+
+// Resident set size in kB, -1 if unknown
+static long startup_rss_kb(void)
+{
+#if !defined(__APPLE__) && !defined(WIN32) // LINUX
+    char line[128];
+    long rss = -1;
+    FILE *fd = fopen("/proc/self/status", "r");
+
+    if (fd == NULL) {
+        return -1;
+    }
+
+    while (fgets(line, sizeof(line), fd) != NULL) {
+        if (sscanf(line, "VmRSS: %ld", &rss) == 1) {
+            break;
+        }
+    }
+    fclose(fd);
+
+    return rss;
+#else
+    return -1;
+#endif
+}
+
+// Waits for the mixer to finish its first block, prints the startup phases and quits butt
+static void startup_bench_timer(void *)
+{
+    static const char *phase_names[STARTUP_PHASES] = {"config read", "GUI built", "GUI shown", "audio opened"};
+    uint64_t first_block_us = snd_get_first_block_us();
+    uint64_t now_us = metrics_now_us();
+    long rss_kb;
+
+    if (first_block_us == 0 && now_us - startup_begin_us < STARTUP_BENCH_TIMEOUT * 1000000ULL) {
+        Fl::repeat_timeout(0.01, &startup_bench_timer);
+        return;
+    }
+
+    printf(_("Startup benchmark:\n"));
+    for (int i = 0; i < STARTUP_PHASES; i++) {
+        printf("  %-18s %8.1f ms\n", phase_names[i], (startup_phase_us[i] - startup_begin_us) / 1000.0);
+    }
+    if (first_block_us != 0) {
+        printf("  %-18s %8.1f ms\n", "first audio block", (first_block_us - startup_begin_us) / 1000.0);
+    }
+    else {
+        printf(_("  No audio block within %d seconds\n"), STARTUP_BENCH_TIMEOUT);
+    }
+
+    rss_kb = startup_rss_kb();
+    if (rss_kb >= 0) {
+        printf("  %-18s %8ld kB\n", "resident memory", rss_kb);
+    }
+    fflush(stdout);
+
+    window_main_close_cb(false);
+}
+
 int read_cfg(void)
 {
     char *p;
@@ -487,6 +566,9 @@ void emergency_cleanup(int sig) {
 
 int main(int argc, char *argv[])
 {
+#ifndef BUILD_CLIENT
+    startup_begin_us = metrics_now_us();
+#endif
     DEBUG_LOG("Starting BUTT");
 
     // Install emergency signal handler
@@ -523,6 +605,8 @@ int main(int argc, char *argv[])
     sock_proto_t command_proto = SOCK_PROTO_TCP;
     char server_addr[128];
     uint32_t song_len;
+    int bench_rate = 0;
+    int watch_rate = 0;
 
     srand(time(NULL));
 
@@ -592,6 +676,10 @@ int main(int argc, char *argv[])
     DEBUG_LOG("Init sockets");
     sock_init();
 
+#ifndef BUILD_CLIENT
+    trace_init();
+#endif
+
 #ifdef BUILD_CLIENT
     if (argc < 2) {
         print_usage();
@@ -600,7 +688,7 @@ int main(int argc, char *argv[])
 
     // Parse command line parameters
     DEBUG_LOG("Parsing command line parameters");
-    while ((opt = getopt(argc, argv, ":vhc:AULxs:drtnqu:a:p:SM:m:O:o:")) != -1) {
+    while ((opt = getopt(argc, argv, ":vhc:AULTxs:drtnqu:a:p:SM:m:O:o:B:W:")) != -1) {
         switch (opt) {
 #ifndef BUILD_CLIENT
         case 'A':
@@ -617,6 +705,9 @@ int main(int argc, char *argv[])
             snd_print_devices();
             return 0;
             break;
+        case 'T':
+            startup_bench = 1;
+            break;
 #endif
         case 'U':
             command_proto = SOCK_PROTO_UDP;
@@ -698,6 +789,22 @@ int main(int argc, char *argv[])
             memset(server_addr, 0, sizeof(server_addr));
             snprintf(server_addr, sizeof(server_addr), "%s", optarg);
             break;
+        case 'B':
+            bench_rate = atoi(optarg);
+            if (bench_rate < 1) {
+                printf(_("Illegal argument: Request rate must be a positive number\n"));
+                fflush(stdout);
+                return 1;
+            }
+            break;
+        case 'W':
+            watch_rate = atoi(optarg);
+            if (watch_rate < 1 || watch_rate > 1000 / STATUS_SUB_MIN_INTERVAL) {
+                printf(_("Illegal argument: Event rate must be a number between 1 and %d\n"), 1000 / STATUS_SUB_MIN_INTERVAL);
+                fflush(stdout);
+                return 1;
+            }
+            break;
         case 'S':
             if (command.cmd != CMD_EMPTY) {
                 printf(_("Warning: You may only pass one control option. Option -%c has been ignored.\n"), opt);
@@ -726,6 +833,7 @@ int main(int argc, char *argv[])
             printf(_("\nOptions for operating mode:\n"
                      "-c\tPath to configuration file\n"
                      "-L\tPrint available audio devices\n"
+                     "-T\tStartup benchmark: print how long the startup phases took until the first audio block, then quit\n"
                      "-A\tCommand server will be accessible from your network/internet (default: localhost only)\n"
                      "-U\tCommand server will use UDP instead of TCP\n"
                      "-x\tDo not start a command server\n"
@@ -741,6 +849,8 @@ int main(int argc, char *argv[])
                      "-q\tQuit butt\n"
                      "-u\tupdate song name\n"
                      "-S\tRequest status\n"
+                     "-W\tWatch status: print status changes at the given rate (events per second) until butt quits\n"
+                     "-B\tBenchmark: send status requests at the given rate (per second) for 10 seconds and print the round-trip times\n"
                      "-M\tSet streaming signal threshold (seconds)\n"
                      "-m\tSet streaming silence threshold (seconds)\n"
                      "-O\tSet recording signal threshold (seconds)\n"
@@ -773,6 +883,30 @@ int main(int argc, char *argv[])
         }
     }
 
+    if (watch_rate > 0) {
+        int ret = command_subscribe_status(server_addr, port, 1000 / watch_rate);
+        if (ret == CMD_ERR_CONNECT) {
+            printf(_("No butt instance running on %s at port %d\n"), server_addr, port);
+        }
+        else if (ret < 0) {
+            printf(_("Status subscription failed: %d\n"), ret);
+        }
+        fflush(stdout);
+        return ret < 0 ? 1 : 0;
+    }
+
+    if (bench_rate > 0) {
+        int ret = command_benchmark(server_addr, port, bench_rate, 10 * bench_rate);
+        if (ret == CMD_ERR_CONNECT) {
+            printf(_("No butt instance running on %s at port %d\n"), server_addr, port);
+        }
+        else if (ret < 0) {
+            printf(_("Benchmark failed: %d\n"), ret);
+        }
+        fflush(stdout);
+        return ret < 0 ? 1 : 0;
+    }
+
     // Handle commands
     if (command.cmd != CMD_EMPTY) {
         int ret;
@@ -813,7 +947,7 @@ int main(int argc, char *argv[])
 
             ret = command_recv_status_reply(&status_packet, command_proto);
             if (ret == SOCK_ERR_RECV) {
-                printf(_("Error: You may only request one status packet per second\n"));
+                printf(_("Error: Status not available yet\n"));
                 return 1;
             }
             if (ret == CMD_ERR_RECV_STATUS) {
@@ -884,6 +1018,7 @@ int main(int argc, char *argv[])
         DEBUG_LOG("Failed to read config");
         return 1;
     }
+    startup_mark(STARTUP_CONFIG_READ);
 
     DEBUG_LOG("Init DSP modules");
     snd_init_dsp();
@@ -902,9 +1037,11 @@ int main(int argc, char *argv[])
     DEBUG_LOG("Setting up GUI");
     fl_g = new flgui();
     fl_g->window_main->xclass("butt_FLTK");
+    startup_mark(STARTUP_GUI_BUILT);
 
     DEBUG_LOG("Showing GUI");
     fl_g->window_main->show();
+    startup_mark(STARTUP_GUI_SHOWN);
     fl_font(fl_font(), 10);
 
     strcpy(lcd_buf, _("idle"));
@@ -966,25 +1103,43 @@ int main(int argc, char *argv[])
             fl_alert(_("butt could not open previously used audio device.\nThe system default audio device will be used.\n"));
         }
     }
+    startup_mark(STARTUP_AUDIO_OPENED);
+    refresh_audio_devices();
     vu_init();
 
     DEBUG_LOG("Initializing timers");
+    init_level_detection();
     Fl::add_timeout(5, &display_rotate_timer);
     Fl::add_timeout(0.25, &cmd_timer);
     Fl::add_timeout(0, &rotate_sponsor_logo_timer);
 
+    if (startup_bench == 1) {
+        Fl::add_timeout(0, &startup_bench_timer);
+    }
+
     if (cfg.main.connect_at_startup) {
         button_connect_cb();
     }
     else if (cfg.main.signal_detection == 1 && cfg.main.signal_threshold > 0) {
-        Fl::add_timeout(1, &stream_signal_timer);
+        reset_stream_signal_detection();
     }
 
     if (cfg.rec.rec_after_launch && !recording) {
         button_record_cb(false);
     }
     else if (cfg.rec.signal_detection == 1 && cfg.rec.signal_threshold > 0) {
-        Fl::add_timeout(1, &record_signal_timer);
+        reset_record_signal_detection();
+    }
+
+    metrics_set(METRIC_LISTENERS, -1);
+    if (cfg.main.metrics_port > 0) {
+        if (metrics_start_server(cfg.main.metrics_port) > 0) {
+            printf(_("Metrics available at http://127.0.0.1:%d/metrics\n"), cfg.main.metrics_port);
+        }
+        else {
+            snprintf(info_buf, sizeof(info_buf), _("Warning: could not start metrics server on port %d\n"), cfg.main.metrics_port);
+            print_info(info_buf, 0);
+        }
     }
 
     if (server_mode != SERVER_MODE_OFF) {
@@ -1041,6 +1196,9 @@ int main(int argc, char *argv[])
     DEBUG_LOG("Fill widgets with config data");
     fill_cfg_widgets();
 
+    // Apply changes that other programs make to the config file while butt is running
+    start_cfg_watch();
+
 #ifdef WIN32
     if (cfg.main.minimize_to_tray == 1) {
         fl_g->window_main->minimize_to_tray = true;
@@ -1056,15 +1214,6 @@ int main(int argc, char *argv[])
     fl_g->group_agent->deactivate();
 #endif
 
-#ifndef WITH_RADIOCO
-    fl_g->radio_add_srv_radioco->hide();
-#endif
-
-#ifndef HAVE_LIBDATACHANNEL
-    fl_g->radio_add_srv_webrtc->deactivate();
-    fl_g->radio_add_srv_webrtc->tooltip(_("butt was built without WebRTC support"));
-#endif
-
     if (cfg.gui.start_minimized == 1) {
         DEBUG_LOG("Starting minimized");
         fl_g->window_main->iconize();
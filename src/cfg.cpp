@@ -16,6 +16,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <limits.h>
+#include <stdarg.h>
 
 #include "config.h"
 #include "gettext.h"
@@ -27,6 +28,7 @@
 #include "fl_funcs.h"
 #include "strfuncs.h"
 #include "port_midi.h"
+#include "mp3_burst.h"
 
 #ifdef WIN32
 const char CONFIG_FILE[] = "buttrc";
@@ -40,6 +42,8 @@ const char *lang_array_old[] = {"system", "de", "en", "fr", "pt_BR"};
 config_t cfg;
 char *cfg_path;
 
+static void store_digests(void);
+
 int cfg_write_file(char *path)
 {
     int i;
@@ -146,6 +150,8 @@ int cfg_write_file(char *path)
     fprintf(cfg_fd, "connect_at_startup = %d\n", cfg.main.connect_at_startup);
     fprintf(cfg_fd, "force_reconnecting = %d\n", cfg.main.force_reconnecting);
     fprintf(cfg_fd, "reconnect_delay = %d\n", cfg.main.reconnect_delay);
+    fprintf(cfg_fd, "metrics_port = %d\n", cfg.main.metrics_port);
+    fprintf(cfg_fd, "pin_encoder_threads = %d\n", cfg.main.pin_encoder_threads);
 
     if (cfg.main.ic_charset != NULL) {
         fprintf(cfg_fd, "ic_charset = %s\n", cfg.main.ic_charset);
@@ -209,6 +215,14 @@ int cfg_write_file(char *path)
     fprintf(cfg_fd, "ptp = %d\n", cfg.aes67.ptp);
     fprintf(cfg_fd, "sap = %d\n\n", cfg.aes67.sap);
 
+    fprintf(cfg_fd, "[multitrack]\n");
+    fprintf(cfg_fd, "channels = %d\n", cfg.multitrack.channels);
+    fprintf(cfg_fd, "route = %s\n", cfg.multitrack.route ? cfg.multitrack.route : "");
+    fprintf(cfg_fd, "downmix = %s\n", cfg.multitrack.downmix ? cfg.multitrack.downmix : "");
+    fprintf(cfg_fd, "record = %d\n", cfg.multitrack.record);
+    fprintf(cfg_fd, "format = %s\n", cfg.multitrack.format ? cfg.multitrack.format : "wav");
+    fprintf(cfg_fd, "aes67 = %d\n\n", cfg.multitrack.aes67);
+
     fprintf(cfg_fd,
             "[record]\n"
             "bitrate = %d\n"
@@ -320,12 +334,14 @@ int cfg_write_file(char *path)
             "highpass_freq_active = %d\n"
             "highpass_freq = %f\n"
             "highpass_width_active = %d\n"
-            "highpass_width = %f\n\n",
+            "highpass_width = %f\n"
+            "burst_duration = %d\n\n",
             cfg.mp3_codec_stream.enc_quality, cfg.mp3_codec_stream.stereo_mode, cfg.mp3_codec_stream.bitrate_mode, cfg.mp3_codec_stream.vbr_quality,
             cfg.mp3_codec_stream.vbr_min_bitrate, cfg.mp3_codec_stream.vbr_max_bitrate, cfg.mp3_codec_stream.vbr_force_min_bitrate,
             cfg.mp3_codec_stream.resampling_freq, cfg.mp3_codec_stream.lowpass_freq_active, cfg.mp3_codec_stream.lowpass_freq,
             cfg.mp3_codec_stream.lowpass_width_active, cfg.mp3_codec_stream.lowpass_width, cfg.mp3_codec_stream.highpass_freq_active,
-            cfg.mp3_codec_stream.highpass_freq, cfg.mp3_codec_stream.highpass_width_active, cfg.mp3_codec_stream.highpass_width);
+            cfg.mp3_codec_stream.highpass_freq, cfg.mp3_codec_stream.highpass_width_active, cfg.mp3_codec_stream.highpass_width,
+            cfg.mp3_codec_stream.burst_duration);
 
     fprintf(cfg_fd,
             "[mp3_codec_rec]\n"
@@ -372,16 +388,25 @@ int cfg_write_file(char *path)
             "bitrate_mode = %d\n"
             "quality = %d\n"
             "audio_type = %d\n"
-            "bandwidth = %d\n\n",
-            cfg.opus_codec_stream.bitrate_mode, cfg.opus_codec_stream.quality, cfg.opus_codec_stream.audio_type, cfg.opus_codec_stream.bandwidth);
+            "bandwidth = %d\n"
+            "page_duration = %d\n"
+            "webrtc_frame_size = %d\n"
+            "webrtc_fec = %d\n"
+            "webrtc_packet_loss = %d\n"
+            "webrtc_dtx = %d\n\n",
+            cfg.opus_codec_stream.bitrate_mode, cfg.opus_codec_stream.quality, cfg.opus_codec_stream.audio_type, cfg.opus_codec_stream.bandwidth,
+            cfg.opus_codec_stream.page_duration, cfg.opus_codec_stream.webrtc_frame_size, cfg.opus_codec_stream.webrtc_fec,
+            cfg.opus_codec_stream.webrtc_packet_loss, cfg.opus_codec_stream.webrtc_dtx);
 
     fprintf(cfg_fd,
             "[opus_codec_rec]\n"
             "bitrate_mode = %d\n"
             "quality = %d\n"
             "audio_type = %d\n"
-            "bandwidth = %d\n\n",
-            cfg.opus_codec_rec.bitrate_mode, cfg.opus_codec_rec.quality, cfg.opus_codec_rec.audio_type, cfg.opus_codec_rec.bandwidth);
+            "bandwidth = %d\n"
+            "page_duration = %d\n\n",
+            cfg.opus_codec_rec.bitrate_mode, cfg.opus_codec_rec.quality, cfg.opus_codec_rec.audio_type, cfg.opus_codec_rec.bandwidth,
+            cfg.opus_codec_rec.page_duration);
 
     fprintf(cfg_fd,
             "[aac_codec_stream]\n"
@@ -580,211 +605,122 @@ int cfg_write_file(char *path)
 
     fclose(cfg_fd);
 
+    // The file watcher will see this write. Take the new digests as baseline so it does not reload our own changes
+    if (path == cfg_path && cfg_parse_file(path) != -1) {
+        store_digests();
+    }
+
     snprintf(info_buf, sizeof(info_buf), _("Config written to %s"), path);
     print_info(info_buf, 0);
 
     return 0;
 }
 
-int cfg_set_values(char *path)
-{
-    int i;
-    char *srv_ent;
-    char *icy_ent;
-    char *strtok_buf = NULL;
-
-    if (path == NULL) {
-        path = cfg_path;
-    }
-
-    if (cfg_parse_file(path) == -1) {
-        DEBUG_LOG("Parsing config failed");
-        return 1;
-    }
-
-    cfg.main.log_file = cfg_get_str("main", "log_file", NULL);
-    cfg.main.ic_charset = cfg_get_str("main", "ic_charset", NULL);
-    cfg.audio.pcm_list = snd_get_devices(&cfg.audio.dev_count);
-    cfg.audio.dev_num = cfg_get_int("audio", "device", 0);
-    cfg.audio.dev2_num = cfg_get_int("audio", "device2", -1);
-    cfg.audio.dev_name = cfg_get_str("audio", "dev_name", _("Default PCM device (default)"));
-    cfg.audio.dev2_name = cfg_get_str("audio", "dev2_name", _("None"));
-    cfg.audio.dev_remember = cfg_get_int("audio", "dev_remember", REMEMBER_BY_NAME);
-    cfg.audio.samplerate = cfg_get_int("audio", "samplerate", 44100);
-    cfg.audio.resolution = 16;
-    cfg.audio.bitrate = cfg_get_int("audio", "bitrate", 128);
-    cfg.audio.channel = cfg_get_int("audio", "channel", 2);
-    cfg.audio.left_ch = cfg_get_int("audio", "left_ch", 1);
-    cfg.audio.right_ch = cfg_get_int("audio", "right_ch", 2);
-    cfg.audio.left_ch2 = cfg_get_int("audio", "left_ch2", 1);
-    cfg.audio.right_ch2 = cfg_get_int("audio", "right_ch2", 2);
-    cfg.audio.buffer_ms = cfg_get_int("audio", "buffer_ms", 50);
-    cfg.audio.disable_dithering = cfg_get_int("audio", "disable_dithering", 0);
-    cfg.audio.resample_mode = cfg_get_int("audio", "resample_mode", 0); // 0 = SRC_SINC_BEST_QUALITY
-
-    cfg.audio.codec = cfg_get_str("audio", "codec", "mp3");
-
-    // AES67 defaults + parsing
-    cfg.aes67.active = cfg_get_int("aes67", "active", 0);  // Default: disabled
-    cfg.aes67.ip = cfg_get_str("aes67", "ip", (char*)"239.69.145.58");
-    cfg.aes67.port = cfg_get_int("aes67", "port", 5004);
-    cfg.aes67.ttl = cfg_get_int("aes67", "ttl", 32);
-    cfg.aes67.dscp = cfg_get_int("aes67", "dscp", 46);
-    cfg.aes67.iface = cfg_get_str("aes67", "iface", (char*)"");
-    cfg.aes67.loopback = cfg_get_int("aes67", "loopback", 0);
-    cfg.aes67.ptp = cfg_get_int("aes67", "ptp", 0);
-    cfg.aes67.sap = cfg_get_int("aes67", "sap", 0);
+static int reloading = 0;
 
-    // Audio performance options
-    cfg.audio_perf.use_vdsp = cfg_get_int("audio_perf", "use_vdsp", 1);
-    cfg.audio_perf.dither_type = cfg_get_int("audio_perf", "dither_type", 1); // TPDF par défaut
-    cfg.audio_perf.pll_enabled = cfg_get_int("audio_perf", "pll_enabled", 0);
-    cfg.audio_perf.pll_window_s = cfg_get_float("audio_perf", "pll_window_s", 2.0);
-    cfg.audio_perf.clip_protection = cfg_get_int("audio_perf", "clip_protection", 1);
-    // Make sure that also "opus" and "flac" fit into the codec char array
-    cfg.audio.codec = (char *)realloc((char *)cfg.audio.codec, 5 * sizeof(char));
-
-    if (!strcmp(cfg.audio.codec, "aac") && g_aac_lib_available == 0) {
-        strcpy(cfg.audio.codec, "mp3");
-    }
-
-    // Will be interpreted as negative value (-50 dB)
-    cfg.audio.silence_level = cfg_get_float("audio", "silence_level", 50.0);
-    cfg.audio.signal_level = cfg_get_float("audio", "signal_level", 50.0);
-
-    cfg.rec.bitrate = cfg_get_int("record", "bitrate", 192);
-    cfg.rec.start_rec = cfg_get_int("record", "start_rec", 0);
-    cfg.rec.stop_rec = cfg_get_int("record", "stop_rec", 0);
-    cfg.rec.rec_after_launch = cfg_get_int("record", "rec_after_launch", 0);
-    cfg.rec.overwrite_files = cfg_get_int("record", "overwrite_files", 0);
-    cfg.rec.sync_to_hour = cfg_get_int("record", "sync_to_hour", 0);
-    cfg.rec.split_time = cfg_get_int("record", "split_time", 0);
-    cfg.rec.filename = cfg_get_str("record", "filename", "rec_%Y%m%d-%H%M%S_%i.mp3");
-    cfg.rec.signal_threshold = cfg_get_float("record", "signal_threshold", 0);
-    cfg.rec.silence_threshold = cfg_get_float("record", "silence_threshold", 0);
-    cfg.rec.signal_detection = cfg_get_int("record", "signal_detection", -1);
-    cfg.rec.silence_detection = cfg_get_int("record", "silence_detection", -1);
-
-    // Backwards compatibility with versions < 0.1.41
-    if (cfg.rec.signal_detection == -1) {
-        cfg.rec.signal_detection = cfg.rec.signal_threshold > 0 ? 1 : 0;
-    }
-    if (cfg.rec.silence_detection == -1) {
-        cfg.rec.silence_detection = cfg.rec.silence_threshold > 0 ? 1 : 0;
-    }
-
-    cfg.rec.codec = cfg_get_str("record", "codec", "mp3");
-    // Make sure that also "opus" and "flac" fit into the codec char array
-    cfg.rec.codec = (char *)realloc((char *)cfg.rec.codec, 5 * sizeof(char));
-
-    if (!strcmp(cfg.rec.codec, "aac") && g_aac_lib_available == 0) {
-        strcpy(cfg.rec.codec, "mp3");
-    }
-
-    cfg.rec.path = NULL; // Set to NULL, button_record_cb() may use realloc()
-    cfg.rec.folder = cfg_get_str("record", "folder", NULL);
-    if (cfg.rec.folder == NULL) {
-        char *p;
-        cfg.rec.folder = (char *)malloc(PATH_MAX * sizeof(char));
-#ifdef WIN32
-        p = fl_getenv("USERPROFILE");
-        if (p != NULL) {
-            snprintf(cfg.rec.folder, PATH_MAX, "%s\\Music\\", p);
-        }
-        else {
-            snprintf(cfg.rec.folder, PATH_MAX, "./");
-        }
-#elif __APPLE__
-        p = fl_getenv("HOME");
-        if (p != NULL) {
-            snprintf(cfg.rec.folder, PATH_MAX, "%s/Music/", p);
-        }
-        else {
-            snprintf(cfg.rec.folder, PATH_MAX, "~/");
-        }
-#else // UNIX
-        p = fl_getenv("HOME");
-        if (p != NULL) {
-            snprintf(cfg.rec.folder, PATH_MAX, "%s/", p);
-        }
-        else {
-            snprintf(cfg.rec.folder, PATH_MAX, "~/");
+// Parse errors are shown in a dialog while butt starts. A hot reload keeps the
+// running settings instead, so its errors only go to the info area
+static void cfg_alert(const char *fmt, ...)
+{
+    char msg[512];
+    char *nl;
+    va_list ap;
+
+    va_start(ap, fmt);
+    vsnprintf(msg, sizeof(msg), fmt, ap);
+    va_end(ap);
+
+    if (reloading) {
+        // Drop the "butt will start with default settings" line
+        if ((nl = strchr(msg, '\n')) != NULL) {
+            *nl = '\0';
         }
-#endif
+        print_info(msg, 1);
     }
+    else {
+        fl_alert("%s", msg);
+    }
+}
 
-    cfg.tls.cert_file = cfg_get_str("tls", "cert_file", NULL);
-    cfg.tls.cert_dir = cfg_get_str("tls", "cert_dir", NULL);
+static int read_servers(void)
+{
+    int i;
+    char *srv_ent;
+    char *strtok_buf = NULL;
 
     cfg.selected_srv = 0;
+    cfg.srv = NULL;
+    cfg.main.srv = NULL;
+    cfg.main.srv_ent = NULL;
 
     cfg.main.num_of_srv = cfg_get_int("main", "num_of_srv", 0);
     if (cfg.main.num_of_srv > 0) {
         cfg.main.srv = cfg_get_str("main", "server", NULL);
         if (cfg.main.srv == NULL) {
-            fl_alert(_("error while parsing config. Missing main/server entry.\nbutt will start with default settings"));
+            cfg_alert(_("error while parsing config. Missing main/server entry.\nbutt will start with default settings"));
             return 1;
         }
 
         cfg.main.srv_ent = cfg_get_str("main", "srv_ent", NULL);
         if (cfg.main.srv_ent == NULL) {
-            fl_alert(_("error while parsing config. Missing main/srv_ent entry.\nbutt will start with default settings"));
+            cfg_alert(_("error while parsing config. Missing main/srv_ent entry.\nbutt will start with default settings"));
             return 1;
         }
 
         cfg.srv = (server_t **)malloc(sizeof(server_t *) * cfg.main.num_of_srv);
 
         for (i = 0; i < cfg.main.num_of_srv; i++) {
-            cfg.srv[i] = (server_t *)malloc(sizeof(server_t));
+            cfg.srv[i] = (server_t *)calloc(1, sizeof(server_t));
         }
 
         strtok_buf = strdup(cfg.main.srv_ent);
         srv_ent = strtok(strtok_buf, ";");
 
-        for (i = 0; srv_ent != NULL; i++) {
+        for (i = 0; srv_ent != NULL && i < cfg.main.num_of_srv; i++) {
             cfg.srv[i]->name = (char *)malloc(strlen(srv_ent) + 1);
             snprintf(cfg.srv[i]->name, strlen(srv_ent) + 1, "%s", srv_ent);
 
             cfg.srv[i]->type = cfg_get_int(srv_ent, "type", -1);
             if (cfg.srv[i]->type == -1) {
-                fl_alert(_("error while parsing config. Missing type entry for server \"%s\"."
-                           "\nbutt will start with default settings"),
-                         srv_ent);
+                cfg_alert(_("error while parsing config. Missing type entry for server \"%s\"."
+                            "\nbutt will start with default settings"),
+                          srv_ent);
+                free(strtok_buf);
                 return 1;
             }
 
             cfg.srv[i]->addr = cfg_get_str(srv_ent, "address", NULL);
             if ((cfg.srv[i]->addr) == NULL && (cfg.srv[i]->type != WEBRTC)) {
-                fl_alert(_("error while parsing config. Missing address entry for server \"%s\"."
-                           "\nbutt will start with default settings"),
-                         srv_ent);
+                cfg_alert(_("error while parsing config. Missing address entry for server \"%s\"."
+                            "\nbutt will start with default settings"),
+                          srv_ent);
                 free(strtok_buf);
                 return 1;
             }
 
             cfg.srv[i]->port = cfg_get_int(srv_ent, "port", -1);
             if ((cfg.srv[i]->port) == -1 && (cfg.srv[i]->type != WEBRTC)) {
-                fl_alert(_("error while parsing config. Missing port entry for server \"%s\"."
-                           "\nbutt will start with default settings"),
-                         srv_ent);
+                cfg_alert(_("error while parsing config. Missing port entry for server \"%s\"."
+                            "\nbutt will start with default settings"),
+                          srv_ent);
                 free(strtok_buf);
                 return 1;
             }
 
             cfg.srv[i]->pwd = cfg_get_str(srv_ent, "password", NULL);
             if ((cfg.srv[i]->pwd == NULL) && (cfg.srv[i]->type != WEBRTC)) {
-                fl_alert(_("error while parsing config. Missing password entry for server \"%s\"."
-                           "\nbutt will start with default settings"),
-                         srv_ent);
+                cfg_alert(_("error while parsing config. Missing password entry for server \"%s\"."
+                            "\nbutt will start with default settings"),
+                          srv_ent);
                 free(strtok_buf);
                 return 1;
             }
 
             cfg.srv[i]->mount = cfg_get_str(srv_ent, "mount", NULL);
             if ((cfg.srv[i]->mount == NULL) && (cfg.srv[i]->type == ICECAST)) {
-                fl_alert(_("error while parsing config. Missing mount entry for server \"%s\"."
-                           "\nbutt will start with default settings"),
-                         srv_ent);
+                cfg_alert(_("error while parsing config. Missing mount entry for server \"%s\"."
+                            "\nbutt will start with default settings"),
+                          srv_ent);
                 free(strtok_buf);
                 return 1;
             }
@@ -832,31 +768,43 @@ int cfg_set_values(char *path)
         cfg.main.srv = NULL;
     }
 
+    return 0;
+}
+
+static int read_icy(void)
+{
+    int i;
+    char *icy_ent;
+    char *strtok_buf = NULL;
+
     cfg.main.num_of_icy = cfg_get_int("main", "num_of_icy", 0);
 
     cfg.selected_icy = 0;
+    cfg.icy = NULL;
+    cfg.main.icy = NULL;
+    cfg.main.icy_ent = NULL;
     if (cfg.main.num_of_icy > 0) {
         cfg.main.icy = cfg_get_str("main", "icy", NULL);
         if (cfg.main.icy == NULL) {
-            fl_alert(_("error while parsing config. Missing main/icy entry.\nbutt will start with default settings"));
+            cfg_alert(_("error while parsing config. Missing main/icy entry.\nbutt will start with default settings"));
             return 1;
         }
         cfg.main.icy_ent = cfg_get_str("main", "icy_ent", NULL); // icy entries
         if (cfg.main.icy_ent == NULL) {
-            fl_alert(_("error while parsing config. Missing main/icy_ent entry.\nbutt will start with default settings"));
+            cfg_alert(_("error while parsing config. Missing main/icy_ent entry.\nbutt will start with default settings"));
             return 1;
         }
 
         cfg.icy = (icy_t **)malloc(sizeof(icy_t *) * cfg.main.num_of_icy);
 
         for (i = 0; i < cfg.main.num_of_icy; i++) {
-            cfg.icy[i] = (icy_t *)malloc(sizeof(icy_t));
+            cfg.icy[i] = (icy_t *)calloc(1, sizeof(icy_t));
         }
 
         strtok_buf = strdup(cfg.main.icy_ent);
         icy_ent = strtok(strtok_buf, ";");
 
-        for (i = 0; icy_ent != NULL; i++) {
+        for (i = 0; icy_ent != NULL && i < cfg.main.num_of_icy; i++) {
             cfg.icy[i]->name = (char *)malloc(strlen(icy_ent) + 1);
             snprintf(cfg.icy[i]->name, strlen(icy_ent) + 1, "%s", icy_ent);
 
@@ -869,9 +817,9 @@ int cfg_set_values(char *path)
             cfg.icy[i]->pub = cfg_get_str(icy_ent, "pub", NULL);
             cfg.icy[i]->expand_variables = cfg_get_int(icy_ent, "expand_variables", 0);
             if (cfg.icy[i]->pub == NULL) {
-                fl_alert(_("error while parsing config. Missing pub entry for icy \"%s\"."
-                           "\nbutt will start with default settings"),
-                         icy_ent);
+                cfg_alert(_("error while parsing config. Missing pub entry for icy \"%s\"."
+                            "\nbutt will start with default settings"),
+                          icy_ent);
                 free(strtok_buf);
                 return 1;
             }
@@ -888,6 +836,11 @@ int cfg_set_values(char *path)
         cfg.main.icy = NULL;
     }
 
+    return 0;
+}
+
+static void read_song(void)
+{
     cfg.main.song_path = cfg_get_str("main", "song_path", NULL);
 
     cfg.main.song_prefix = cfg_get_str("main", "song_prefix", NULL);
@@ -912,44 +865,10 @@ int cfg_set_values(char *path)
     cfg.main.app_update = cfg_get_int("main", "app_update", 0);
     cfg.main.app_update_service = cfg_get_int("main", "app_update_service", 0);
     cfg.main.app_artist_title_order = cfg_get_int("main", "app_artist_title_order", APP_TITLE_FIRST);
-    cfg.main.signal_threshold = cfg_get_float("main", "signal_threshold", 0);
-    cfg.main.silence_threshold = cfg_get_float("main", "silence_threshold", 0);
-    cfg.main.signal_detection = cfg_get_int("main", "signal_detection", -1);
-    cfg.main.silence_detection = cfg_get_int("main", "silence_detection", -1);
-
-    // Backwards compatibility with versions < 0.1.41
-    if (cfg.main.signal_detection == -1) {
-        cfg.main.signal_detection = cfg.main.signal_threshold > 0 ? 1 : 0;
-    }
-    if (cfg.main.silence_detection == -1) {
-        cfg.main.silence_detection = cfg.main.silence_threshold > 0 ? 1 : 0;
-    }
-
-    cfg.main.connect_at_startup = cfg_get_int("main", "connect_at_startup", 0);
-    cfg.main.force_reconnecting = cfg_get_int("main", "force_reconnecting", 0);
-    cfg.main.reconnect_delay = cfg_get_int("main", "reconnect_delay", 1);
-    cfg.main.check_for_update = cfg_get_int("main", "check_for_update", 1);
-    cfg.main.start_agent = cfg_get_int("main", "start_agent", 0);
-    cfg.main.minimize_to_tray = cfg_get_int("main", "minimize_to_tray", 0);
-
-    cfg.main.gain = cfg_get_float("main", "gain", 1.0);
-    if (cfg.main.gain > util_db_to_factor(24)) {
-        cfg.main.gain = util_db_to_factor(24);
-    }
-    if (cfg.main.gain < 0) {
-        cfg.main.gain = util_db_to_factor(-24);
-    }
-
-    // Mixer
-    cfg.mixer.primary_device_gain = cfg_get_float("mixer", "primary_device_gain", 1.0);
-    cfg.mixer.primary_device_muted = cfg_get_int("mixer", "primary_device_muted", 0);
-    cfg.mixer.secondary_device_gain = cfg_get_float("mixer", "secondary_device_gain", 1.0);
-    cfg.mixer.secondary_device_muted = cfg_get_int("mixer", "secondary_device_muted", 0);
-    cfg.mixer.streaming_gain = cfg_get_float("mixer", "streaming_gain", 1.0);
-    cfg.mixer.recording_gain = cfg_get_float("mixer", "recording_gain", 1.0);
-    cfg.mixer.cross_fader = cfg_get_float("mixer", "cross_fader", 0.0);
+}
 
-    // DSP
+static void read_dsp(void)
+{
     cfg.dsp.equalizer_stream = cfg_get_int("dsp", "equalizer", 0);
     cfg.dsp.equalizer_rec = cfg_get_int("dsp", "equalizer_rec", -1);
 
@@ -992,6 +911,426 @@ int cfg_set_values(char *path)
     cfg.dsp.attack = cfg_get_float("dsp", "attack", 0.01);
     cfg.dsp.release = cfg_get_float("dsp", "release", 1.0);
     cfg.dsp.makeup_gain = cfg_get_float("dsp", "makeup_gain", 0.0);
+}
+
+static void free_servers(server_t **srv, int count)
+{
+    if (srv == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < count; i++) {
+        if (srv[i] == NULL) {
+            continue;
+        }
+        free(srv[i]->name);
+        free(srv[i]->addr);
+        free(srv[i]->pwd);
+        free(srv[i]->mount);
+        free(srv[i]->usr);
+        free(srv[i]->cert_hash);
+        free(srv[i]->webrtc_ice);
+        free(srv[i]->webrtc_whip);
+        free(srv[i]->webrtc_auth);
+        free(srv[i]->custom_listener_url);
+        free(srv[i]->custom_listener_mount);
+        free(srv[i]);
+    }
+    free(srv);
+}
+
+static void free_icy(icy_t **icy, int count)
+{
+    if (icy == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < count; i++) {
+        if (icy[i] == NULL) {
+            continue;
+        }
+        free(icy[i]->name);
+        free(icy[i]->desc);
+        free(icy[i]->genre);
+        free(icy[i]->url);
+        free(icy[i]->irc);
+        free(icy[i]->icq);
+        free(icy[i]->aim);
+        free(icy[i]->pub);
+        free(icy[i]);
+    }
+    free(icy);
+}
+
+static const char *srv_keys[] = {"num_of_srv", "server", "srv_ent", NULL};
+static const char *icy_keys[] = {"num_of_icy", "icy", "icy_ent", NULL};
+static const char *song_keys[] = {"song_path",
+                                  "song_prefix",
+                                  "song_suffix",
+                                  "song_update_url_active",
+                                  "song_update_url_interval",
+                                  "song_update_url",
+                                  "song_update",
+                                  "song_delay",
+                                  "read_last_line",
+                                  "app_update",
+                                  "app_update_service",
+                                  "app_artist_title_order",
+                                  NULL};
+
+// Digests of the reload groups as they were last read or written by butt, indexed by group bit
+static unsigned int digests[4];
+
+// Folds the digests of the sections listed in the main/<list_key> entry into <h>
+static unsigned int sections_digest(unsigned int h, const char *list_key)
+{
+    char *list, *name, *strtok_buf;
+
+    list = cfg_get_str("main", list_key, NULL);
+    if (list == NULL) {
+        return h;
+    }
+
+    strtok_buf = list;
+    for (name = strtok(strtok_buf, ";"); name != NULL; name = strtok(NULL, ";")) {
+        h = (h ^ cfg_section_digest(name)) * 16777619u;
+    }
+    free(list);
+
+    return h;
+}
+
+static unsigned int group_digest(int group)
+{
+    switch (group) {
+    case CFG_RELOAD_SERVERS:
+        return sections_digest(cfg_entries_digest("main", srv_keys), "srv_ent");
+    case CFG_RELOAD_ICY:
+        return sections_digest(cfg_entries_digest("main", icy_keys), "icy_ent");
+    case CFG_RELOAD_SONG:
+        return cfg_entries_digest("main", song_keys);
+    default:
+        return cfg_section_digest("dsp");
+    }
+}
+
+// Must be called right after the config file has been parsed
+static void store_digests(void)
+{
+    for (int i = 0; i < 4; i++) {
+        digests[i] = group_digest(1 << i);
+    }
+}
+
+static int reload_servers(void)
+{
+    server_t **old_srv = cfg.srv;
+    char *old_name = cfg.main.srv;
+    char *old_ent = cfg.main.srv_ent;
+    int old_num = cfg.main.num_of_srv;
+    int old_selected = cfg.selected_srv;
+
+    if (read_servers() != 0) {
+        free_servers(cfg.srv, cfg.main.num_of_srv);
+        free(cfg.main.srv);
+        free(cfg.main.srv_ent);
+        cfg.srv = old_srv;
+        cfg.main.srv = old_name;
+        cfg.main.srv_ent = old_ent;
+        cfg.main.num_of_srv = old_num;
+        cfg.selected_srv = old_selected;
+        return 1;
+    }
+
+    free_servers(old_srv, old_num);
+    free(old_name);
+    free(old_ent);
+
+    return 0;
+}
+
+static int reload_icy(void)
+{
+    icy_t **old_icy = cfg.icy;
+    char *old_name = cfg.main.icy;
+    char *old_ent = cfg.main.icy_ent;
+    int old_num = cfg.main.num_of_icy;
+    int old_selected = cfg.selected_icy;
+
+    if (read_icy() != 0) {
+        free_icy(cfg.icy, cfg.main.num_of_icy);
+        free(cfg.main.icy);
+        free(cfg.main.icy_ent);
+        cfg.icy = old_icy;
+        cfg.main.icy = old_name;
+        cfg.main.icy_ent = old_ent;
+        cfg.main.num_of_icy = old_num;
+        cfg.selected_icy = old_selected;
+        return 1;
+    }
+
+    free_icy(old_icy, old_num);
+    free(old_name);
+    free(old_ent);
+
+    return 0;
+}
+
+static void reload_song(void)
+{
+    free(cfg.main.song_path);
+    free(cfg.main.song_prefix);
+    free(cfg.main.song_suffix);
+    free(cfg.main.song_update_url);
+
+    read_song();
+}
+
+static void reload_dsp(void)
+{
+    free(cfg.dsp.eq_preset);
+
+    read_dsp();
+}
+
+int cfg_reload(int allowed, int *pending)
+{
+    int group;
+    int applied = 0;
+    int ret;
+    unsigned int digest;
+
+    *pending = 0;
+
+    if (cfg_parse_file(cfg_path) == -1) {
+        return -1;
+    }
+
+    reloading = 1;
+    for (int i = 0; i < 4; i++) {
+        group = 1 << i;
+        digest = group_digest(group);
+        if (digest == digests[i]) {
+            continue;
+        }
+        if (!(allowed & group)) {
+            *pending |= group;
+            continue;
+        }
+
+        ret = 0;
+        switch (group) {
+        case CFG_RELOAD_SERVERS:
+            ret = reload_servers();
+            break;
+        case CFG_RELOAD_ICY:
+            ret = reload_icy();
+            break;
+        case CFG_RELOAD_SONG:
+            reload_song();
+            break;
+        case CFG_RELOAD_DSP:
+            reload_dsp();
+            break;
+        }
+
+        // A broken group is not retried until the file changes again
+        digests[i] = digest;
+        if (ret == 0) {
+            applied |= group;
+        }
+    }
+    reloading = 0;
+
+    return applied;
+}
+
+int cfg_set_values(char *path)
+{
+    int i;
+
+    if (path == NULL) {
+        path = cfg_path;
+    }
+
+    if (cfg_parse_file(path) == -1) {
+        DEBUG_LOG("Parsing config failed");
+        return 1;
+    }
+
+    cfg.main.log_file = cfg_get_str("main", "log_file", NULL);
+    cfg.main.ic_charset = cfg_get_str("main", "ic_charset", NULL);
+    cfg.audio.pcm_list = snd_get_devices(&cfg.audio.dev_count, SND_DEVICES_CACHED);
+    cfg.audio.dev_num = cfg_get_int("audio", "device", 0);
+    cfg.audio.dev2_num = cfg_get_int("audio", "device2", -1);
+    cfg.audio.dev_name = cfg_get_str("audio", "dev_name", _("Default PCM device (default)"));
+    cfg.audio.dev2_name = cfg_get_str("audio", "dev2_name", _("None"));
+    cfg.audio.dev_remember = cfg_get_int("audio", "dev_remember", REMEMBER_BY_NAME);
+    cfg.audio.samplerate = cfg_get_int("audio", "samplerate", 44100);
+    cfg.audio.resolution = 16;
+    cfg.audio.bitrate = cfg_get_int("audio", "bitrate", 128);
+    cfg.audio.channel = cfg_get_int("audio", "channel", 2);
+    cfg.audio.left_ch = cfg_get_int("audio", "left_ch", 1);
+    cfg.audio.right_ch = cfg_get_int("audio", "right_ch", 2);
+    cfg.audio.left_ch2 = cfg_get_int("audio", "left_ch2", 1);
+    cfg.audio.right_ch2 = cfg_get_int("audio", "right_ch2", 2);
+    cfg.audio.buffer_ms = cfg_get_int("audio", "buffer_ms", 50);
+    cfg.audio.disable_dithering = cfg_get_int("audio", "disable_dithering", 0);
+    cfg.audio.resample_mode = cfg_get_int("audio", "resample_mode", 0); // 0 = SRC_SINC_BEST_QUALITY
+
+    cfg.audio.codec = cfg_get_str("audio", "codec", "mp3");
+
+    // AES67 defaults + parsing
+    cfg.aes67.active = cfg_get_int("aes67", "active", 0);  // Default: disabled
+    cfg.aes67.ip = cfg_get_str("aes67", "ip", (char*)"239.69.145.58");
+    cfg.aes67.port = cfg_get_int("aes67", "port", 5004);
+    cfg.aes67.ttl = cfg_get_int("aes67", "ttl", 32);
+    cfg.aes67.dscp = cfg_get_int("aes67", "dscp", 46);
+    cfg.aes67.iface = cfg_get_str("aes67", "iface", (char*)"");
+    cfg.aes67.loopback = cfg_get_int("aes67", "loopback", 0);
+    cfg.aes67.ptp = cfg_get_int("aes67", "ptp", 0);
+    cfg.aes67.sap = cfg_get_int("aes67", "sap", 0);
+
+    cfg.multitrack.channels = cfg_get_int("multitrack", "channels", 0); // Default: no multitrack bus
+    cfg.multitrack.route = cfg_get_str("multitrack", "route", "");
+    cfg.multitrack.downmix = cfg_get_str("multitrack", "downmix", "");
+    cfg.multitrack.record = cfg_get_int("multitrack", "record", 0);
+    cfg.multitrack.format = cfg_get_str("multitrack", "format", "wav");
+    cfg.multitrack.aes67 = cfg_get_int("multitrack", "aes67", 0);
+
+    // Audio performance options
+    cfg.audio_perf.use_vdsp = cfg_get_int("audio_perf", "use_vdsp", 1);
+    cfg.audio_perf.dither_type = cfg_get_int("audio_perf", "dither_type", 1); // TPDF par défaut
+    cfg.audio_perf.pll_enabled = cfg_get_int("audio_perf", "pll_enabled", 0);
+    cfg.audio_perf.pll_window_s = cfg_get_float("audio_perf", "pll_window_s", 2.0);
+    cfg.audio_perf.clip_protection = cfg_get_int("audio_perf", "clip_protection", 1);
+    // Make sure that also "opus" and "flac" fit into the codec char array
+    cfg.audio.codec = (char *)realloc((char *)cfg.audio.codec, 5 * sizeof(char));
+
+    if (!strcmp(cfg.audio.codec, "aac") && g_aac_lib_available == 0) {
+        strcpy(cfg.audio.codec, "mp3");
+    }
+
+    // Will be interpreted as negative value (-50 dB)
+    cfg.audio.silence_level = cfg_get_float("audio", "silence_level", 50.0);
+    cfg.audio.signal_level = cfg_get_float("audio", "signal_level", 50.0);
+
+    cfg.rec.bitrate = cfg_get_int("record", "bitrate", 192);
+    cfg.rec.start_rec = cfg_get_int("record", "start_rec", 0);
+    cfg.rec.stop_rec = cfg_get_int("record", "stop_rec", 0);
+    cfg.rec.rec_after_launch = cfg_get_int("record", "rec_after_launch", 0);
+    cfg.rec.overwrite_files = cfg_get_int("record", "overwrite_files", 0);
+    cfg.rec.sync_to_hour = cfg_get_int("record", "sync_to_hour", 0);
+    cfg.rec.split_time = cfg_get_int("record", "split_time", 0);
+    cfg.rec.filename = cfg_get_str("record", "filename", "rec_%Y%m%d-%H%M%S_%i.mp3");
+    cfg.rec.signal_threshold = cfg_get_float("record", "signal_threshold", 0);
+    cfg.rec.silence_threshold = cfg_get_float("record", "silence_threshold", 0);
+    cfg.rec.signal_detection = cfg_get_int("record", "signal_detection", -1);
+    cfg.rec.silence_detection = cfg_get_int("record", "silence_detection", -1);
+
+    // Backwards compatibility with versions < 0.1.41
+    if (cfg.rec.signal_detection == -1) {
+        cfg.rec.signal_detection = cfg.rec.signal_threshold > 0 ? 1 : 0;
+    }
+    if (cfg.rec.silence_detection == -1) {
+        cfg.rec.silence_detection = cfg.rec.silence_threshold > 0 ? 1 : 0;
+    }
+
+    cfg.rec.codec = cfg_get_str("record", "codec", "mp3");
+    // Make sure that also "opus" and "flac" fit into the codec char array
+    cfg.rec.codec = (char *)realloc((char *)cfg.rec.codec, 5 * sizeof(char));
+
+    if (!strcmp(cfg.rec.codec, "aac") && g_aac_lib_available == 0) {
+        strcpy(cfg.rec.codec, "mp3");
+    }
+
+    cfg.rec.path = NULL; // Set to NULL, button_record_cb() may use realloc()
+    cfg.rec.folder = cfg_get_str("record", "folder", NULL);
+    if (cfg.rec.folder == NULL) {
+        char *p;
+        cfg.rec.folder = (char *)malloc(PATH_MAX * sizeof(char));
+#ifdef WIN32
+        p = fl_getenv("USERPROFILE");
+        if (p != NULL) {
+            snprintf(cfg.rec.folder, PATH_MAX, "%s\\Music\\", p);
+        }
+        else {
+            snprintf(cfg.rec.folder, PATH_MAX, "./");
+        }
+#elif __APPLE__
+        p = fl_getenv("HOME");
+        if (p != NULL) {
+            snprintf(cfg.rec.folder, PATH_MAX, "%s/Music/", p);
+        }
+        else {
+            snprintf(cfg.rec.folder, PATH_MAX, "~/");
+        }
+#else // UNIX
+        p = fl_getenv("HOME");
+        if (p != NULL) {
+            snprintf(cfg.rec.folder, PATH_MAX, "%s/", p);
+        }
+        else {
+            snprintf(cfg.rec.folder, PATH_MAX, "~/");
+        }
+#endif
+    }
+
+    cfg.tls.cert_file = cfg_get_str("tls", "cert_file", NULL);
+    cfg.tls.cert_dir = cfg_get_str("tls", "cert_dir", NULL);
+
+    if (read_servers() != 0) {
+        return 1;
+    }
+
+    if (read_icy() != 0) {
+        return 1;
+    }
+
+    read_song();
+    cfg.main.signal_threshold = cfg_get_float("main", "signal_threshold", 0);
+    cfg.main.silence_threshold = cfg_get_float("main", "silence_threshold", 0);
+    cfg.main.signal_detection = cfg_get_int("main", "signal_detection", -1);
+    cfg.main.silence_detection = cfg_get_int("main", "silence_detection", -1);
+
+    // Backwards compatibility with versions < 0.1.41
+    if (cfg.main.signal_detection == -1) {
+        cfg.main.signal_detection = cfg.main.signal_threshold > 0 ? 1 : 0;
+    }
+    if (cfg.main.silence_detection == -1) {
+        cfg.main.silence_detection = cfg.main.silence_threshold > 0 ? 1 : 0;
+    }
+
+    cfg.main.connect_at_startup = cfg_get_int("main", "connect_at_startup", 0);
+    cfg.main.force_reconnecting = cfg_get_int("main", "force_reconnecting", 0);
+    cfg.main.reconnect_delay = cfg_get_int("main", "reconnect_delay", 1);
+    cfg.main.metrics_port = cfg_get_int("main", "metrics_port", 0);
+    if (cfg.main.metrics_port < 0 || cfg.main.metrics_port > 65535) {
+        cfg.main.metrics_port = 0;
+    }
+    cfg.main.pin_encoder_threads = cfg_get_int("main", "pin_encoder_threads", 0);
+    cfg.main.check_for_update = cfg_get_int("main", "check_for_update", 1);
+    cfg.main.start_agent = cfg_get_int("main", "start_agent", 0);
+    cfg.main.minimize_to_tray = cfg_get_int("main", "minimize_to_tray", 0);
+
+    cfg.main.gain = cfg_get_float("main", "gain", 1.0);
+    if (cfg.main.gain > util_db_to_factor(24)) {
+        cfg.main.gain = util_db_to_factor(24);
+    }
+    if (cfg.main.gain < 0) {
+        cfg.main.gain = util_db_to_factor(-24);
+    }
+
+    // Mixer
+    cfg.mixer.primary_device_gain = cfg_get_float("mixer", "primary_device_gain", 1.0);
+    cfg.mixer.primary_device_muted = cfg_get_int("mixer", "primary_device_muted", 0);
+    cfg.mixer.secondary_device_gain = cfg_get_float("mixer", "secondary_device_gain", 1.0);
+    cfg.mixer.secondary_device_muted = cfg_get_int("mixer", "secondary_device_muted", 0);
+    cfg.mixer.streaming_gain = cfg_get_float("mixer", "streaming_gain", 1.0);
+    cfg.mixer.recording_gain = cfg_get_float("mixer", "recording_gain", 1.0);
+    cfg.mixer.cross_fader = cfg_get_float("mixer", "cross_fader", 0.0);
+
+    read_dsp();
 
     // MIDI
     cfg.midi.dev_name = cfg_get_str("midi", "dev_name", "Disabled");
@@ -1069,6 +1408,10 @@ int cfg_set_values(char *path)
     cfg.mp3_codec_stream.highpass_freq = cfg_get_float("mp3_codec_stream", "highpass_freq", 0);
     cfg.mp3_codec_stream.highpass_width_active = cfg_get_int("mp3_codec_stream", "highpass_width_active", 0);
     cfg.mp3_codec_stream.highpass_width = cfg_get_float("mp3_codec_stream", "highpass_width", 0);
+    cfg.mp3_codec_stream.burst_duration = cfg_get_int("mp3_codec_stream", "burst_duration", MP3_BURST_DEFAULT_DURATION);
+    if (cfg.mp3_codec_stream.burst_duration < 0 || cfg.mp3_codec_stream.burst_duration > MP3_BURST_MAX_DURATION) {
+        cfg.mp3_codec_stream.burst_duration = MP3_BURST_DEFAULT_DURATION;
+    }
 
     cfg.mp3_codec_rec.enc_quality = cfg_get_int("mp3_codec_rec", "enc_quality", 3);
     cfg.mp3_codec_rec.stereo_mode = cfg_get_int("mp3_codec_rec", "stereo_mode", 0);
@@ -1102,11 +1445,29 @@ int cfg_set_values(char *path)
     cfg.opus_codec_stream.quality = cfg_get_int("opus_codec_stream", "quality", 0);
     cfg.opus_codec_stream.audio_type = cfg_get_int("opus_codec_stream", "audio_type", CHOICE_TYPE_MUSIC);
     cfg.opus_codec_stream.bandwidth = cfg_get_int("opus_codec_stream", "bandwidth", 0);
+    cfg.opus_codec_stream.page_duration = cfg_get_int("opus_codec_stream", "page_duration", OPUS_DEFAULT_PAGE_DURATION_STREAM);
+    if (cfg.opus_codec_stream.page_duration < 0 || cfg.opus_codec_stream.page_duration > OPUS_MAX_PAGE_DURATION) {
+        cfg.opus_codec_stream.page_duration = OPUS_DEFAULT_PAGE_DURATION_STREAM;
+    }
+    cfg.opus_codec_stream.webrtc_frame_size = cfg_get_int("opus_codec_stream", "webrtc_frame_size", OPUS_RTP_DEFAULT_FRAME_SIZE);
+    if (!opus_enc_is_valid_rtp_frame_size(cfg.opus_codec_stream.webrtc_frame_size)) {
+        cfg.opus_codec_stream.webrtc_frame_size = OPUS_RTP_DEFAULT_FRAME_SIZE;
+    }
+    cfg.opus_codec_stream.webrtc_fec = cfg_get_int("opus_codec_stream", "webrtc_fec", 1) == 1;
+    cfg.opus_codec_stream.webrtc_packet_loss = cfg_get_int("opus_codec_stream", "webrtc_packet_loss", OPUS_RTP_DEFAULT_PACKET_LOSS);
+    if (cfg.opus_codec_stream.webrtc_packet_loss < 0 || cfg.opus_codec_stream.webrtc_packet_loss > 100) {
+        cfg.opus_codec_stream.webrtc_packet_loss = OPUS_RTP_DEFAULT_PACKET_LOSS;
+    }
+    cfg.opus_codec_stream.webrtc_dtx = cfg_get_int("opus_codec_stream", "webrtc_dtx", 0) == 1;
 
     cfg.opus_codec_rec.bitrate_mode = cfg_get_int("opus_codec_rec", "bitrate_mode", CHOICE_VBR);
     cfg.opus_codec_rec.quality = cfg_get_int("opus_codec_rec", "quality", 0);
     cfg.opus_codec_rec.audio_type = cfg_get_int("opus_codec_rec", "audio_type", CHOICE_TYPE_MUSIC);
     cfg.opus_codec_rec.bandwidth = cfg_get_int("opus_codec_rec", "bandwidth", 0);
+    cfg.opus_codec_rec.page_duration = cfg_get_int("opus_codec_rec", "page_duration", OPUS_DEFAULT_PAGE_DURATION_REC);
+    if (cfg.opus_codec_rec.page_duration < 0 || cfg.opus_codec_rec.page_duration > OPUS_MAX_PAGE_DURATION) {
+        cfg.opus_codec_rec.page_duration = OPUS_DEFAULT_PAGE_DURATION_REC;
+    }
 
     // read flac codec related stuff
     cfg.flac_codec_stream.bit_depth = cfg_get_int("flac_codec_stream", "bit_depth", 16);
@@ -1211,6 +1572,8 @@ int cfg_set_values(char *path)
 
 #endif
 
+    store_digests();
+
     return 0;
 }
 
@@ -1283,6 +1646,8 @@ int cfg_create_default(void)
                     "minimize_to_tray = 0\n"
                     "force_reconnecting = 0\n"
                     "reconnect_delay = 1\n"
+                    "metrics_port = 0\n"
+                    "pin_encoder_threads = 0\n"
                     "connect_at_startup = 0\n\n");
 
     fprintf(cfg_fd,
@@ -1373,7 +1738,8 @@ int cfg_create_default(void)
                     "highpass_freq_active = 0\n"
                     "highpass_freq = 0\n"
                     "highpass_width_active = 0\n"
-                    "highpass_width = 0\n\n");
+                    "highpass_width = 0\n"
+                    "burst_duration = 10\n\n");
 
     fprintf(cfg_fd, "[mp3_codec_rec]\n"
                     "enc_quality = 3\n"
@@ -1409,13 +1775,19 @@ int cfg_create_default(void)
                     "bitrate_mode = 1\n"
                     "quality = 0\n"
                     "audio_type = 0\n"
-                    "bandwidth = 0\n\n");
+                    "bandwidth = 0\n"
+                    "page_duration = 200\n"
+                    "webrtc_frame_size = 960\n"
+                    "webrtc_fec = 1\n"
+                    "webrtc_packet_loss = 10\n"
+                    "webrtc_dtx = 0\n\n");
 
     fprintf(cfg_fd, "[opus_codec_rec]\n"
                     "bitrate_mode = 1\n"
                     "quality = 0\n"
                     "audio_type = 0\n"
-                    "bandwidth = 0\n\n");
+                    "bandwidth = 0\n"
+                    "page_duration = 1000\n\n");
 
     fprintf(cfg_fd, "[aac_codec_stream]\n"
                     "bitrate_mode = 0\n"
@@ -106,6 +106,14 @@ enum {
     REMEMBER_BY_NAME = 1,
 };
 
+// Groups of settings that cfg_reload() can apply to a running butt
+enum {
+    CFG_RELOAD_SERVERS = 1 << 0,
+    CFG_RELOAD_ICY = 1 << 1,
+    CFG_RELOAD_SONG = 1 << 2,
+    CFG_RELOAD_DSP = 1 << 3,
+};
+
 extern const char *lang_array_new[];
 extern const char *lang_array_old[];
 extern const char CONFIG_FILE[];
@@ -179,6 +187,8 @@ typedef struct {
         int connect_at_startup;
         int force_reconnecting;
         int reconnect_delay;
+        int metrics_port; // Port of the local Prometheus endpoint, 0 = disabled
+        int pin_encoder_threads; // 1 = bind the encoder threads to their own cpus
         float silence_threshold; // timeout duration of automatic stream stop
         float signal_threshold;  // timeout duration of automatic stream start
         int signal_detection;
@@ -230,6 +240,7 @@ typedef struct {
         char *folder;
         char *path;
         FILE *fd;
+        int mt_open_mode; // MT_OPEN_* for the multitrack recording, set when a recording is started
         int start_rec;
         int stop_rec;
         int overwrite_files;
@@ -311,6 +322,7 @@ typedef struct {
         float highpass_freq;
         int highpass_width_active;
         float highpass_width;
+        int burst_duration; // seconds of encoded audio that are sent at once after a reconnect
 
     } mp3_codec_stream;
 
@@ -352,6 +364,11 @@ typedef struct {
         int quality;
         int audio_type;
         int bandwidth;
+        int page_duration; // Target duration of an Ogg page in ms
+        int webrtc_frame_size; // Samples per RTP packet at 48 kHz: 120, 240, 480 or 960
+        int webrtc_fec;
+        int webrtc_packet_loss; // Expected packet loss in percent
+        int webrtc_dtx;
     } opus_codec_stream;
 
     struct {
@@ -359,6 +376,7 @@ typedef struct {
         int quality;
         int audio_type;
         int bandwidth;
+        int page_duration; // Target duration of an Ogg page in ms
     } opus_codec_rec;
 
     struct {
@@ -421,6 +439,15 @@ typedef struct {
         int sap;         // SAP enabled (0/1)
     } aes67;
 
+    struct {
+        int channels;  // Channels of the multitrack bus, 0 = disabled (see multitrack.h)
+        char *route;   // Device channels of the bus channels, e.g. "1-8"
+        char *downmix; // "left:right" gains of the bus channels in the program, empty = program from left_ch/right_ch
+        int record;    // Record the bus next to the program (0/1)
+        char *format;  // Format of the multitrack recording: "wav" or "flac"
+        int aes67;     // Send the bus instead of the program to AES67 (0/1)
+    } multitrack;
+
 } config_t;
 
 extern char *cfg_path; // Path to config file
@@ -430,4 +457,9 @@ int cfg_write_file(char *path); // Writes current config_t struct to path or cfg
 int cfg_set_values(char *path); // Reads config file from path or cfg_path if path is NULL and fills the config_t struct
 int cfg_create_default(void);   // Creates a default config file, if there isn't one yet
 
+// Re-reads cfg_path and applies the groups in <allowed> that have changed since the config was last read or written by butt.
+// Changed groups outside <allowed> are returned in <*pending> and stay pending until a later call applies them.
+// Returns the applied groups or -1 if the file could not be parsed
+int cfg_reload(int allowed, int *pending);
+
 #endif
@@ -16,6 +16,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+#include <sys/time.h>
 
 #ifndef BUILD_CLIENT
 #include <pthread.h>
@@ -24,12 +26,10 @@
 #ifdef WIN32
 #include <winsock2.h>
 #define usleep(us) Sleep(us / 1000)
-#ifndef errno
-#define errno WSAGetLastError()
-#endif
-#ifndef EWOULDBLOCK
+#undef errno
+#undef EWOULDBLOCK
+#define errno       WSAGetLastError()
 #define EWOULDBLOCK WSAEWOULDBLOCK
-#endif
 #else
 #include <sys/types.h>
 #include <sys/socket.h>
@@ -40,6 +40,11 @@
 #include <errno.h>
 #endif
 
+#ifdef __linux__
+#include <sys/epoll.h>
+#define COMMAND_USE_EPOLL
+#endif
+
 #ifdef WIN32
 typedef int socklen_t;
 #endif
@@ -48,143 +53,665 @@ typedef int socklen_t;
 #include "sockfuncs.h"
 
 #ifndef BUILD_CLIENT
-#include "timer.h"
 #include "ringbuffer.h"
 #endif
 
 int client_sock;
 sock_proto_t server_proto;
 
+static double now_ms(void)
+{
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return tv.tv_sec * 1000.0 + tv.tv_usec / 1000.0;
+}
+
 #ifndef BUILD_CLIENT
 
+// Per-connection state of the TCP command server.
+// A client may keep its connection open and send any number of (pipelined) commands
+typedef struct cmd_client {
+    int sock; // -1 if the slot is unused
+    char recv_buf[COMMAND_PACKET_SIZE + COMMAND_MAX_PARAM_SIZE];
+    int recv_len;
+    char *send_buf; // Reply bytes the socket did not accept yet
+    int send_len;
+    int send_size;
+    time_t last_active;
+    int sub_interval;          // ms between status events, 0 if the client is not subscribed
+    double sub_next;           // Time of the next status event
+    double sub_last_sent;      // Time of the last status event
+    int sub_full;              // Next status event carries all fields
+    status_packet_t sub_last;  // Status as last seen by the client
+} cmd_client_t;
+
 pthread_t listen_thread_detached;
 int listen_sock = -1;
-int conn_sock;
-int connection_established;
 sock_udp_conn_t udp_conn;
 ringbuf_t command_fifo;
 
-void *listen_thread_func(void *data)
+static cmd_client_t clients[COMMAND_MAX_CLIENTS];
+#ifdef COMMAND_USE_EPOLL
+static int epoll_fd = -1;
+#endif
+
+// The latest serialized status_packet_t, published by the GUI thread via command_set_status().
+// Status requests are answered from here without waiting for the GUI
+static pthread_mutex_t status_mutex = PTHREAD_MUTEX_INITIALIZER;
+static char *status_buf = NULL;
+static int status_len = 0;
+static status_packet_t status_cur; // Same status, unserialized, for the status events
+static int num_subscribers = 0;
+
+static void client_set_write_interest(int idx, int enable)
 {
-    timer_ms_t status_timer;
-    timer_ms_t connection_timer;
-    command_t command;
-    int bytes_count;
-    struct sockaddr_in cli;
-    socklen_t len;
-    len = sizeof(cli);
-    char recv_buf[1024];
-    int response = 0;
+#ifdef COMMAND_USE_EPOLL
+    struct epoll_event ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN | (enable ? EPOLLOUT : 0);
+    ev.data.u32 = idx + 1;
+    epoll_ctl(epoll_fd, EPOLL_CTL_MOD, clients[idx].sock, &ev);
+#else
+    (void)idx;
+    (void)enable;
+#endif
+}
 
-    rb_init(&command_fifo, COMMAND_FIFO_LEN * sizeof(command_t));
+static void client_close(int idx)
+{
+    cmd_client_t *c = &clients[idx];
 
-    timer_init(&status_timer, 0.8); // Use 0.8 s instead of 1.0 s to allow small time fluctations
-    timer_init(&connection_timer, 5);
-    connection_established = 0;
+#ifdef COMMAND_USE_EPOLL
+    epoll_ctl(epoll_fd, EPOLL_CTL_DEL, c->sock, NULL);
+#endif
+    sock_close(c->sock);
+    free(c->send_buf);
+    if (c->sub_interval > 0) {
+        free(c->sub_last.song);
+        free(c->sub_last.rec_path);
+        c->sub_interval = 0;
+        pthread_mutex_lock(&status_mutex);
+        num_subscribers--;
+        pthread_mutex_unlock(&status_mutex);
+    }
+    c->sock = -1;
+    c->send_buf = NULL;
+    c->send_len = 0;
+    c->send_size = 0;
+    c->recv_len = 0;
+}
 
-    for (;;) {
-        //   printf("num of commands in fifo: %d\n", rb_filled(&command_fifo)/sizeof(command_t));
-        if (connection_established == 1 ||
-            rb_space(&command_fifo) < (int)sizeof(command_t)) { // Do not accept new connections while a connection is established or the command fifo is full
-            // To prevent a deadlock reset the connection in case it stays in "connection_established = 1" for // more then 5 seconds
-            if (timer_is_elapsed(&connection_timer) == 1) {
-                if (server_proto == SOCK_PROTO_TCP) {
-                    sock_close(conn_sock);
-                }
-                rb_clear(&command_fifo);
-                connection_established = 0;
+// Sends as much of the pending reply bytes as the socket accepts.
+// Returns -1 if the connection broke
+static int client_flush(int idx)
+{
+    cmd_client_t *c = &clients[idx];
+    int rc;
+    int sent = 0;
+
+    while (sent < c->send_len) {
+        rc = send(c->sock, c->send_buf + sent, c->send_len - sent, 0);
+        if (rc < 0) {
+            if (errno == EWOULDBLOCK) {
+                break;
             }
-            usleep(100 * 1000);
-            //      printf("continued\n");
+            return -1;
+        }
+        sent += rc;
+    }
+
+    if (sent > 0) {
+        memmove(c->send_buf, c->send_buf + sent, c->send_len - sent);
+        c->send_len -= sent;
+        if (c->send_len == 0) {
+            client_set_write_interest(idx, 0);
+        }
+    }
+
+    return 0;
+}
+
+static int client_reply(int idx, const char *data, int len)
+{
+    cmd_client_t *c = &clients[idx];
+    int was_empty = (c->send_len == 0);
+
+    // A client that doesn't read its replies is dropped instead of buffering forever
+    if (c->send_len + len > COMMAND_MAX_SEND_BUF) {
+        return -1;
+    }
+
+    if (c->send_len + len > c->send_size) {
+        int new_size = c->send_len + len + 1024;
+        char *p = (char *)realloc(c->send_buf, new_size);
+        if (p == NULL) {
+            return -1;
+        }
+        c->send_buf = p;
+        c->send_size = new_size;
+    }
+
+    memcpy(c->send_buf + c->send_len, data, len);
+    c->send_len += len;
+
+    if (client_flush(idx) < 0) {
+        return -1;
+    }
+
+    if (was_empty && c->send_len > 0) {
+        client_set_write_interest(idx, 1);
+    }
+
+    return 0;
+}
+
+// Returns the reply for <command> in <reply>. The caller frees it.
+// Returns 0 if a status was requested before the GUI published the first one
+static int handle_command(command_t *command, const char *param, char **reply)
+{
+    int response;
+
+    if (command->cmd == CMD_GET_STATUS) {
+        pthread_mutex_lock(&status_mutex);
+        response = status_len;
+        if (status_len > 0) {
+            *reply = (char *)malloc(status_len);
+            memcpy(*reply, status_buf, status_len);
+        }
+        pthread_mutex_unlock(&status_mutex);
+
+        return response;
+    }
+    else if (rb_space(&command_fifo) < (int)sizeof(command_t)) {
+        response = CMD_ERR_FIFO_FULL;
+    }
+    else {
+        command->param = NULL;
+        if (command->param_size > 0) {
+            command->param = (void *)calloc(command->param_size + 1, sizeof(uint8_t));
+            memcpy((char *)command->param, param, command->param_size);
+        }
+        command_add_cmd_to_fifo(*command);
+        response = 0;
+    }
+
+    *reply = (char *)malloc(sizeof(response));
+    memcpy(*reply, &response, sizeof(response));
+    return sizeof(response);
+}
+
+static char *put_field(char *p, const void *val, int len)
+{
+    memcpy(p, val, len);
+    return p + len;
+}
+
+static char *put_string(char *p, const char *str, uint16_t len)
+{
+    p = put_field(p, &len, sizeof(len));
+    return put_field(p, str, len);
+}
+
+// Writes the status event for subscriber <c> to <out> and remembers what was sent.
+// Must be called with status_mutex held. Returns the event size or 0 if there is nothing to send
+static int encode_status_event(cmd_client_t *c, char *out, double now)
+{
+    status_packet_t *cur = &status_cur;
+    status_packet_t *last = &c->sub_last;
+    status_event_hdr_t hdr;
+    char *p = out + sizeof(hdr);
+    // A full event doubles as heartbeat, a client that missed an event is back in sync with it
+    int full = c->sub_full || now - c->sub_last_sent >= STATUS_SUB_HEARTBEAT;
+
+    hdr.version = STATUS_EVENT_VERSION;
+    hdr.changed = 0;
+
+    if (full || cur->status != last->status) {
+        hdr.changed |= 1 << STATUS_FIELD_STATUS;
+        p = put_field(p, &cur->status, sizeof(cur->status));
+    }
+    if (full || cur->volume_left != last->volume_left || cur->volume_right != last->volume_right) {
+        hdr.changed |= 1 << STATUS_FIELD_VOLUME;
+        p = put_field(p, &cur->volume_left, sizeof(cur->volume_left));
+        p = put_field(p, &cur->volume_right, sizeof(cur->volume_right));
+    }
+    if (full || cur->stream_seconds != last->stream_seconds || cur->stream_kByte != last->stream_kByte) {
+        hdr.changed |= 1 << STATUS_FIELD_STREAM;
+        p = put_field(p, &cur->stream_seconds, sizeof(cur->stream_seconds));
+        p = put_field(p, &cur->stream_kByte, sizeof(cur->stream_kByte));
+    }
+    if (full || cur->record_seconds != last->record_seconds || cur->record_kByte != last->record_kByte) {
+        hdr.changed |= 1 << STATUS_FIELD_RECORD;
+        p = put_field(p, &cur->record_seconds, sizeof(cur->record_seconds));
+        p = put_field(p, &cur->record_kByte, sizeof(cur->record_kByte));
+    }
+    if (full || cur->listener_count != last->listener_count) {
+        hdr.changed |= 1 << STATUS_FIELD_LISTENERS;
+        p = put_field(p, &cur->listener_count, sizeof(cur->listener_count));
+    }
+    if (full || strcmp(cur->song, last->song) != 0) {
+        hdr.changed |= 1 << STATUS_FIELD_SONG;
+        p = put_string(p, cur->song, cur->song_len);
+        free(last->song);
+        last->song = strdup(cur->song);
+    }
+    if (full || strcmp(cur->rec_path, last->rec_path) != 0) {
+        hdr.changed |= 1 << STATUS_FIELD_REC_PATH;
+        p = put_string(p, cur->rec_path, cur->rec_path_len);
+        free(last->rec_path);
+        last->rec_path = strdup(cur->rec_path);
+    }
+    if (full || memcmp(cur->loudness, last->loudness, sizeof(cur->loudness)) != 0) {
+        hdr.changed |= 1 << STATUS_FIELD_LOUDNESS;
+        p = put_field(p, cur->loudness, sizeof(cur->loudness));
+    }
+
+    if (hdr.changed == 0) {
+        return 0;
+    }
+
+    char *song = last->song;
+    char *rec_path = last->rec_path;
+    *last = *cur;
+    last->song = song;
+    last->rec_path = rec_path;
+
+    c->sub_full = 0;
+    c->sub_last_sent = now;
+    memcpy(out, &hdr, sizeof(hdr));
+
+    return (int)(p - out);
+}
+
+static int client_subscribe(int idx, command_t *command, const char *param)
+{
+    cmd_client_t *c = &clients[idx];
+    uint32_t interval = 1000;
+    int response = 0;
+
+    if (command->param_size >= sizeof(interval)) {
+        memcpy(&interval, param, sizeof(interval));
+    }
+
+    pthread_mutex_lock(&status_mutex);
+    if (interval == 0) { // Unsubscribe
+        if (c->sub_interval > 0) {
+            free(c->sub_last.song);
+            free(c->sub_last.rec_path);
+            c->sub_interval = 0;
+            num_subscribers--;
+        }
+    }
+    else {
+        if (c->sub_interval == 0) {
+            c->sub_last.song = strdup("");
+            c->sub_last.rec_path = strdup("");
+            num_subscribers++;
+        }
+        c->sub_interval = interval < STATUS_SUB_MIN_INTERVAL ? STATUS_SUB_MIN_INTERVAL : interval;
+        c->sub_next = now_ms();
+        c->sub_full = 1;
+    }
+    pthread_mutex_unlock(&status_mutex);
+
+    return client_reply(idx, (char *)&response, sizeof(response));
+}
+
+// Sends the due status events. Returns the number of ms until the next one is due
+static int push_status_events(void)
+{
+    static char event_buf[STATUS_EVENT_MAX_SIZE];
+    double now = now_ms();
+    double next = now + 1000;
+    int len;
+
+    for (int idx = 0; idx < COMMAND_MAX_CLIENTS; idx++) {
+        cmd_client_t *c = &clients[idx];
+        if (c->sock == -1 || c->sub_interval == 0) {
             continue;
         }
-        if (server_proto == SOCK_PROTO_TCP) {
-            conn_sock = accept(listen_sock, (struct sockaddr *)&cli, &len);
-            if (conn_sock < 0) { // conn_sock < 0 if error
-                usleep(100 * 1000);
+
+        if (c->sub_next <= now) {
+            pthread_mutex_lock(&status_mutex);
+            len = status_len > 0 ? encode_status_event(c, event_buf, now) : 0;
+            pthread_mutex_unlock(&status_mutex);
+
+            // Keep the pace even if one event was late
+            c->sub_next += c->sub_interval;
+            if (c->sub_next <= now) {
+                c->sub_next = now + c->sub_interval;
+            }
+
+            if (len > 0 && client_reply(idx, event_buf, len) < 0) {
+                client_close(idx);
                 continue;
             }
         }
-        else {
-            conn_sock = listen_sock;
+
+        next = c->sub_next < next ? c->sub_next : next;
+    }
+
+    return next > now ? (int)(next - now) + 1 : 0;
+}
+
+// Handles all complete commands in the receive buffer of a client.
+// Returns -1 if the client has to be disconnected
+static int client_process(int idx)
+{
+    cmd_client_t *c = &clients[idx];
+    command_t command;
+    char *reply;
+    int reply_len;
+    int offset = 0;
+    int ret = 0;
+
+    while (c->recv_len - offset >= (int)COMMAND_PACKET_SIZE) {
+        memcpy((char *)&command, c->recv_buf + offset, COMMAND_PACKET_SIZE);
+        if (command.param_size > COMMAND_MAX_PARAM_SIZE) {
+            return -1; // Not a butt client
+        }
+        if (c->recv_len - offset < (int)(COMMAND_PACKET_SIZE + command.param_size)) {
+            break; // Wait for the rest of the parameter
+        }
+
+        if (command.cmd == CMD_SUBSCRIBE_STATUS) {
+            if (client_subscribe(idx, &command, c->recv_buf + offset + COMMAND_PACKET_SIZE) < 0) {
+                return -1;
+            }
+            offset += COMMAND_PACKET_SIZE + command.param_size;
+            continue;
+        }
+
+        reply_len = handle_command(&command, c->recv_buf + offset + COMMAND_PACKET_SIZE, &reply);
+        if (reply_len == 0) {
+            return -1; // Closing the connection tells the client that there is no status yet
+        }
+        ret = client_reply(idx, reply, reply_len);
+        free(reply);
+        if (ret < 0) {
+            return -1;
+        }
+
+        offset += COMMAND_PACKET_SIZE + command.param_size;
+    }
+
+    if (offset > 0) {
+        memmove(c->recv_buf, c->recv_buf + offset, c->recv_len - offset);
+        c->recv_len -= offset;
+    }
+
+    return 0;
+}
+
+static void client_read(int idx)
+{
+    cmd_client_t *c = &clients[idx];
+    int rc;
+
+    for (;;) {
+        rc = recv(c->sock, c->recv_buf + c->recv_len, sizeof(c->recv_buf) - c->recv_len, 0);
+        if (rc == 0) {
+            client_close(idx); // Closed by the client
+            return;
+        }
+        if (rc < 0) {
+            if (errno != EWOULDBLOCK) {
+                client_close(idx);
+            }
+            return;
+        }
+
+        c->recv_len += rc;
+        c->last_active = time(NULL);
+
+        if (client_process(idx) < 0) {
+            client_close(idx);
+            return;
         }
-        sock_nonblock(conn_sock);
+    }
+}
+
+#ifndef COMMAND_USE_EPOLL
+// select() takes at most FD_SETSIZE sockets on Windows and only socket numbers below FD_SETSIZE elsewhere.
+// One entry is needed for the listening socket
+static int select_can_add(int s)
+{
+    int count = 0;
 
-        if (server_proto == SOCK_PROTO_TCP) {
-            bytes_count = sock_recv(conn_sock, recv_buf, sizeof(recv_buf), COMMAND_TIMEOUT);
+    for (int idx = 0; idx < COMMAND_MAX_CLIENTS; idx++) {
+        if (clients[idx].sock != -1) {
+            count++;
         }
-        else {
-            bytes_count = sock_recvfrom(conn_sock, recv_buf, sizeof(recv_buf), &udp_conn, COMMAND_TIMEOUT);
+    }
+    if (count >= FD_SETSIZE - 1) {
+        return 0;
+    }
+
+#ifdef WIN32
+    (void)s;
+    return 1;
+#else
+    return s < FD_SETSIZE;
+#endif
+}
+#endif
+
+static void accept_clients(void)
+{
+    int s;
+    int idx;
+
+    for (;;) {
+        s = accept(listen_sock, NULL, NULL);
+        if (s < 0) {
+            return;
         }
 
-        if (bytes_count == SOCK_TIMEOUT) {
-            if (server_proto == SOCK_PROTO_TCP) {
-                sock_close(conn_sock);
+        for (idx = 0; idx < COMMAND_MAX_CLIENTS; idx++) {
+            if (clients[idx].sock == -1) {
+                break;
             }
-            connection_established = 0;
+        }
+        if (idx == COMMAND_MAX_CLIENTS) {
+            sock_close(s);
             continue;
         }
 
-        connection_established = 1;
-        timer_start(&connection_timer);
-
-        if (bytes_count > 0) {
-            memcpy((char *)&command, recv_buf, COMMAND_PACKET_SIZE);
-            if (command.param_size > 0) {
-                // Limit parameter size to COMMAND_MAX_PARAM_SIZE
-                command.param_size = command.param_size > COMMAND_MAX_PARAM_SIZE ? COMMAND_MAX_PARAM_SIZE : command.param_size;
-
-                int expected_bytes = COMMAND_PACKET_SIZE + command.param_size;
-                if (bytes_count < expected_bytes) {
-                    int remaining_bytes = expected_bytes - bytes_count;
-                    bytes_count += sock_recv(conn_sock, recv_buf + bytes_count, remaining_bytes, COMMAND_TIMEOUT);
-                    if (bytes_count != expected_bytes) {
-                        if (server_proto == SOCK_PROTO_TCP) {
-                            sock_close(conn_sock);
-                        }
-                        connection_established = 0;
-                        continue; // Still not all bytes received -> dismiss this command
-                    }
-                }
-                command.param = (void *)calloc(command.param_size + 1, sizeof(uint8_t));
-                memcpy((char *)command.param, recv_buf + COMMAND_PACKET_SIZE, command.param_size);
+#ifndef COMMAND_USE_EPOLL
+        if (!select_can_add(s)) {
+            sock_close(s);
+            continue;
+        }
+#endif
+
+        sock_nonblock(s);
+        clients[idx].sock = s;
+        clients[idx].recv_len = 0;
+        clients[idx].send_len = 0;
+        clients[idx].last_active = time(NULL);
+        clients[idx].sub_interval = 0;
+
+#ifdef COMMAND_USE_EPOLL
+        struct epoll_event ev;
+        memset(&ev, 0, sizeof(ev));
+        ev.events = EPOLLIN;
+        ev.data.u32 = idx + 1;
+        if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, s, &ev) != 0) {
+            sock_close(s);
+            clients[idx].sock = -1;
+        }
+#endif
+    }
+}
+
+static void close_idle_clients(void)
+{
+    time_t now = time(NULL);
+
+    for (int idx = 0; idx < COMMAND_MAX_CLIENTS; idx++) {
+        // Subscribers only listen, a broken subscriber connection is detected when sending
+        if (clients[idx].sock != -1 && clients[idx].sub_interval == 0 && now - clients[idx].last_active > COMMAND_IDLE_TIMEOUT) {
+            client_close(idx);
+        }
+    }
+}
+
+// Event loop of the TCP command server. All connections are served by this one thread;
+// commands for the GUI are handed over through the command fifo
+static void tcp_server_loop(void)
+{
+    time_t last_idle_check = time(NULL);
+    int timeout = 1000;
+
+    sock_nonblock(listen_sock);
+
+#ifdef COMMAND_USE_EPOLL
+    struct epoll_event events[64];
+    struct epoll_event ev;
+
+    epoll_fd = epoll_create1(0);
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.u32 = 0;
+    epoll_ctl(epoll_fd, EPOLL_CTL_ADD, listen_sock, &ev);
+
+    for (;;) {
+        int n = epoll_wait(epoll_fd, events, 64, timeout);
+
+        for (int i = 0; i < n; i++) {
+            if (events[i].data.u32 == 0) {
+                accept_clients();
+                continue;
             }
-            if (command.cmd == CMD_GET_STATUS) {
-                if (status_timer.is_running == false) {
-                    timer_start(&status_timer);
-                }
-                else if (timer_is_elapsed(&status_timer) == 0) { // Limit status request to approx. one per second
-                    if (server_proto == SOCK_PROTO_TCP) {
-                        sock_close(conn_sock);
-                    }
-                    else {
-                        response = SOCK_ERR_RECV;
-                        sock_sendto(conn_sock, (char *)&response, sizeof(response), &udp_conn, SEND_TIMEOUT);
-                    }
-                    connection_established = 0;
+
+            int idx = events[i].data.u32 - 1;
+            if (clients[idx].sock == -1) {
+                continue;
+            }
+            if (events[i].events & (EPOLLERR | EPOLLHUP)) {
+                client_close(idx);
+                continue;
+            }
+            if ((events[i].events & EPOLLOUT) && client_flush(idx) < 0) {
+                client_close(idx);
+                continue;
+            }
+            if (events[i].events & EPOLLIN) {
+                client_read(idx);
+            }
+        }
+#else
+    fd_set rd, wr;
+    struct timeval tv;
+    int max_fd;
+
+    for (;;) {
+        FD_ZERO(&rd);
+        FD_ZERO(&wr);
+        FD_SET(listen_sock, &rd);
+        max_fd = listen_sock;
+        for (int idx = 0; idx < COMMAND_MAX_CLIENTS; idx++) {
+            if (clients[idx].sock == -1) {
+                continue;
+            }
+            FD_SET(clients[idx].sock, &rd);
+            if (clients[idx].send_len > 0) {
+                FD_SET(clients[idx].sock, &wr);
+            }
+            max_fd = clients[idx].sock > max_fd ? clients[idx].sock : max_fd;
+        }
+
+        tv.tv_sec = timeout / 1000;
+        tv.tv_usec = (timeout % 1000) * 1000;
+        if (select(max_fd + 1, &rd, &wr, NULL, &tv) > 0) {
+            if (FD_ISSET(listen_sock, &rd)) {
+                accept_clients();
+            }
+            for (int idx = 0; idx < COMMAND_MAX_CLIENTS; idx++) {
+                int s = clients[idx].sock;
+                if (s == -1) {
                     continue;
                 }
-            }
-            else { // (command.cmd != CMD_GET_STATUS)
-                response = 0;
-                if (server_proto == SOCK_PROTO_TCP) {
-                    sock_send(conn_sock, (char *)&response, sizeof(response), SEND_TIMEOUT);
-                    sock_close(conn_sock);
-                    connection_established = 0;
+                if (FD_ISSET(s, &wr) && client_flush(idx) < 0) {
+                    client_close(idx);
+                    continue;
                 }
-                else {
-                    sock_sendto(conn_sock, (char *)&response, sizeof(response), &udp_conn, SEND_TIMEOUT);
-                    connection_established = 0;
+                if (FD_ISSET(s, &rd)) {
+                    client_read(idx);
                 }
             }
+        }
+#endif
+
+        timeout = push_status_events();
+
+        if (time(NULL) - last_idle_check >= 1) {
+            close_idle_clients();
+            last_idle_check = time(NULL);
+        }
+    }
+}
+
+// Every datagram carries exactly one command and gets one reply datagram
+static void udp_server_loop(void)
+{
+    char recv_buf[COMMAND_PACKET_SIZE + COMMAND_MAX_PARAM_SIZE];
+    command_t command;
+    char *reply;
+    int reply_len;
+    int bytes_count;
+
+    sock_nonblock(listen_sock);
+
+    for (;;) {
+        bytes_count = sock_recvfrom(listen_sock, recv_buf, sizeof(recv_buf), &udp_conn, COMMAND_TIMEOUT);
+        if (bytes_count < (int)COMMAND_PACKET_SIZE) {
+            continue;
+        }
+
+        memcpy((char *)&command, recv_buf, COMMAND_PACKET_SIZE);
+        if (command.param_size > COMMAND_MAX_PARAM_SIZE || bytes_count < (int)(COMMAND_PACKET_SIZE + command.param_size)) {
+            continue;
+        }
+
+        if (command.cmd == CMD_SUBSCRIBE_STATUS) { // Needs a connection
+            int response = CMD_ERR_UNSUPPORTED;
+            sock_sendto(listen_sock, (char *)&response, sizeof(response), &udp_conn, SEND_TIMEOUT);
+            continue;
+        }
 
-            command_add_cmd_to_fifo(command);
+        reply_len = handle_command(&command, recv_buf + COMMAND_PACKET_SIZE, &reply);
+        if (reply_len == 0) {
+            int response = SOCK_ERR_RECV;
+            sock_sendto(listen_sock, (char *)&response, sizeof(response), &udp_conn, SEND_TIMEOUT);
+            continue;
         }
+        sock_sendto(listen_sock, reply, reply_len, &udp_conn, SEND_TIMEOUT);
+        free(reply);
     }
+}
+
+void *listen_thread_func(void *data)
+{
+    (void)data;
 
     // Detach thread (free ressources) because no one will call pthread_join() on it
     pthread_detach(pthread_self());
 
+    rb_init(&command_fifo, COMMAND_FIFO_LEN * sizeof(command_t));
+
+    for (int idx = 0; idx < COMMAND_MAX_CLIENTS; idx++) {
+        clients[idx].sock = -1;
+        clients[idx].send_buf = NULL;
+    }
+
+    if (server_proto == SOCK_PROTO_TCP) {
+        tcp_server_loop();
+    }
+    else {
+        udp_server_loop();
+    }
+
     return NULL;
 }
 
@@ -249,38 +776,51 @@ int command_start_server(int port, int search_port, int mode, sock_proto_t proto
     }
 
     if (proto == SOCK_PROTO_TCP) {
-        if ((listen(listen_sock, 1)) != 0) {
+        if ((listen(listen_sock, COMMAND_LISTEN_BACKLOG)) != 0) {
             return SOCK_ERR_LISTEN;
         }
     }
 
+    server_proto = proto;
+
     if (pthread_create(&listen_thread_detached, NULL, listen_thread_func, NULL) != 0) {
         return 0;
     }
 
-    server_proto = proto;
-
     return p;
 }
 
-void command_send_status_reply(status_packet_t *status_packet)
+void command_set_status(status_packet_t *status_packet)
 {
-    if (server_proto == SOCK_PROTO_TCP) {
-        sock_send(conn_sock, (char *)status_packet, STATUS_PACKET_SIZE, COMMAND_TIMEOUT);
-        sock_send(conn_sock, status_packet->song, status_packet->song_len, COMMAND_TIMEOUT);
-        sock_send(conn_sock, status_packet->rec_path, status_packet->rec_path_len, COMMAND_TIMEOUT);
-        sock_close(conn_sock);
-        connection_established = 0;
-    }
-    else {
-        char *udp_buf = (char *)malloc(STATUS_PACKET_SIZE + status_packet->song_len + status_packet->rec_path_len);
-        memcpy(udp_buf, status_packet, STATUS_PACKET_SIZE);
-        memcpy(udp_buf + STATUS_PACKET_SIZE, status_packet->song, status_packet->song_len);
-        memcpy(udp_buf + STATUS_PACKET_SIZE + status_packet->song_len, status_packet->rec_path, status_packet->rec_path_len);
-        sock_sendto(conn_sock, udp_buf, STATUS_PACKET_SIZE + status_packet->song_len + status_packet->rec_path_len, &udp_conn, COMMAND_TIMEOUT);
-        connection_established = 0;
-        free(udp_buf);
-    }
+    int len = STATUS_PACKET_SIZE + status_packet->song_len + status_packet->rec_path_len;
+    char *buf = (char *)malloc(len);
+
+    memcpy(buf, status_packet, STATUS_PACKET_SIZE);
+    memcpy(buf + STATUS_PACKET_SIZE, status_packet->song, status_packet->song_len);
+    memcpy(buf + STATUS_PACKET_SIZE + status_packet->song_len, status_packet->rec_path, status_packet->rec_path_len);
+
+    pthread_mutex_lock(&status_mutex);
+    free(status_buf);
+    status_buf = buf;
+    status_len = len;
+
+    free(status_cur.song);
+    free(status_cur.rec_path);
+    status_cur = *status_packet;
+    status_cur.song = strdup(status_packet->song);
+    status_cur.rec_path = strdup(status_packet->rec_path);
+    pthread_mutex_unlock(&status_mutex);
+}
+
+int command_has_subscribers(void)
+{
+    int ret;
+
+    pthread_mutex_lock(&status_mutex);
+    ret = num_subscribers > 0;
+    pthread_mutex_unlock(&status_mutex);
+
+    return ret;
 }
 
 void command_stop_server(void)
@@ -421,3 +961,303 @@ int command_recv_status_reply(status_packet_t *status_packet, sock_proto_t proto
 
     return STATUS_PACKET_SIZE;
 }
+
+static int bench_cmp(const void *a, const void *b)
+{
+    double d = *(const double *)a - *(const double *)b;
+    return (d > 0) - (d < 0);
+}
+
+// Sends <count> status requests at <rate> requests per second over one persistent TCP connection
+// and prints the round-trip latency distribution
+int command_benchmark(char *addr, int port, int rate, int count)
+{
+    command_t command;
+    status_packet_t status_packet;
+    char buf[COMMAND_PACKET_SIZE];
+    char *payload;
+    double *rtt;
+    double start, next, sent_at, sum = 0;
+    int ret = 0;
+    int late = 0;
+
+    if (rate < 1 || count < 1) {
+        return CMD_ERR_SEND_CMD;
+    }
+
+    client_sock = sock_connect(addr, port, SOCK_PROTO_TCP, COMMAND_TIMEOUT);
+    if (client_sock < 0) {
+        return CMD_ERR_CONNECT;
+    }
+
+    memset(&command, 0, sizeof(command));
+    command.cmd = CMD_GET_STATUS;
+    memcpy(buf, &command, COMMAND_PACKET_SIZE);
+
+    rtt = (double *)malloc(count * sizeof(double));
+    payload = (char *)malloc(2 * 0xFFFF);
+
+    start = now_ms();
+    next = start;
+    for (int i = 0; i < count; i++) {
+        // Pace the requests. A request that is already overdue is sent immediately
+        while (now_ms() < next) {
+            usleep(100);
+        }
+        if (now_ms() - next > 1000.0 / rate) {
+            late++;
+        }
+        next += 1000.0 / rate;
+
+        sent_at = now_ms();
+        if (sock_send(client_sock, buf, COMMAND_PACKET_SIZE, COMMAND_TIMEOUT) < 0) {
+            ret = CMD_ERR_SEND_CMD;
+            break;
+        }
+
+        // Receive the fixed size part and then the variable length strings
+        int got = 0;
+        while (got < (int)STATUS_PACKET_SIZE) {
+            int rc = sock_recv(client_sock, (char *)&status_packet + got, STATUS_PACKET_SIZE - got, COMMAND_TIMEOUT);
+            if (rc < 0) {
+                ret = CMD_ERR_RECV_STATUS;
+                break;
+            }
+            got += rc;
+        }
+        if (ret < 0) {
+            break;
+        }
+        int remaining = status_packet.song_len + status_packet.rec_path_len;
+        got = 0;
+        while (got < remaining) {
+            int rc = sock_recv(client_sock, payload + got, remaining - got, COMMAND_TIMEOUT);
+            if (rc < 0) {
+                ret = CMD_ERR_RECV_STATUS;
+                break;
+            }
+            got += rc;
+        }
+        if (ret < 0) {
+            break;
+        }
+
+        rtt[i] = now_ms() - sent_at;
+        sum += rtt[i];
+    }
+
+    sock_close(client_sock);
+
+    if (ret == 0) {
+        double duration = (now_ms() - start) / 1000.0;
+        qsort(rtt, count, sizeof(double), bench_cmp);
+        printf("requests: %d in %.2f s (%.0f req/s, %d late)\n", count, duration, count / duration, late);
+        printf("rtt ms: min %.3f  avg %.3f  p50 %.3f  p99 %.3f  max %.3f\n", rtt[0], sum / count, rtt[count / 2], rtt[(int)(count * 0.99)],
+               rtt[count - 1]);
+        fflush(stdout);
+    }
+
+    free(payload);
+    free(rtt);
+
+    return ret;
+}
+
+static int recv_all(int s, char *buf, int len, int timeout_ms)
+{
+    int got = 0;
+    int rc;
+
+    while (got < len) {
+        rc = sock_recv(s, buf + got, len - got, timeout_ms);
+        if (rc < 0) {
+            return rc;
+        }
+        got += rc;
+    }
+
+    return got;
+}
+
+static int recv_string(char **str, uint16_t *len)
+{
+    int ret;
+
+    if ((ret = recv_all(client_sock, (char *)len, sizeof(*len), COMMAND_TIMEOUT)) < 0) {
+        return ret;
+    }
+
+    *str = (char *)realloc(*str, *len + 1);
+    if ((ret = recv_all(client_sock, *str, *len, COMMAND_TIMEOUT)) < 0) {
+        return ret;
+    }
+    (*str)[*len] = '\0';
+
+    return 0;
+}
+
+// Receives the next status event from a subscription and applies it to <status_packet>.
+// The song and rec_path members must be NULL or malloc'ed before the first call.
+// Waits up to two heartbeat intervals for the event
+int command_recv_status_event(status_packet_t *status_packet, uint16_t *changed)
+{
+    status_event_hdr_t hdr;
+    int timeout = 2 * STATUS_SUB_HEARTBEAT;
+    int ret;
+
+    if ((ret = recv_all(client_sock, (char *)&hdr, sizeof(hdr), timeout)) < 0) {
+        return ret;
+    }
+    if (hdr.version != STATUS_EVENT_VERSION) {
+        return 0; // Version missmatch
+    }
+
+    // Fixed size fields, in bit order
+    struct {
+        int bit;
+        void *a;
+        int a_size;
+        void *b;
+        int b_size;
+    } fields[] = {
+        {STATUS_FIELD_STATUS, &status_packet->status, sizeof(status_packet->status), NULL, 0},
+        {STATUS_FIELD_VOLUME, &status_packet->volume_left, sizeof(status_packet->volume_left), &status_packet->volume_right,
+         sizeof(status_packet->volume_right)},
+        {STATUS_FIELD_STREAM, &status_packet->stream_seconds, sizeof(status_packet->stream_seconds), &status_packet->stream_kByte,
+         sizeof(status_packet->stream_kByte)},
+        {STATUS_FIELD_RECORD, &status_packet->record_seconds, sizeof(status_packet->record_seconds), &status_packet->record_kByte,
+         sizeof(status_packet->record_kByte)},
+        {STATUS_FIELD_LISTENERS, &status_packet->listener_count, sizeof(status_packet->listener_count), NULL, 0},
+    };
+
+    for (unsigned int i = 0; i < sizeof(fields) / sizeof(fields[0]); i++) {
+        if ((hdr.changed & (1 << fields[i].bit)) == 0) {
+            continue;
+        }
+        if ((ret = recv_all(client_sock, (char *)fields[i].a, fields[i].a_size, COMMAND_TIMEOUT)) < 0) {
+            return ret;
+        }
+        if (fields[i].b != NULL && (ret = recv_all(client_sock, (char *)fields[i].b, fields[i].b_size, COMMAND_TIMEOUT)) < 0) {
+            return ret;
+        }
+    }
+
+    // Addresses of packed struct members may be unaligned, so the strings go through locals
+    if (hdr.changed & (1 << STATUS_FIELD_SONG)) {
+        char *song = status_packet->song;
+        uint16_t len;
+        if ((ret = recv_string(&song, &len)) < 0) {
+            return ret;
+        }
+        status_packet->song = song;
+        status_packet->song_len = len;
+    }
+    if (hdr.changed & (1 << STATUS_FIELD_REC_PATH)) {
+        char *rec_path = status_packet->rec_path;
+        uint16_t len;
+        if ((ret = recv_string(&rec_path, &len)) < 0) {
+            return ret;
+        }
+        status_packet->rec_path = rec_path;
+        status_packet->rec_path_len = len;
+    }
+    if (hdr.changed & (1 << STATUS_FIELD_LOUDNESS)) {
+        if ((ret = recv_all(client_sock, (char *)status_packet->loudness, sizeof(status_packet->loudness), COMMAND_TIMEOUT)) < 0) {
+            return ret;
+        }
+    }
+
+    status_packet->version = hdr.version;
+    *changed = hdr.changed;
+
+    return sizeof(hdr);
+}
+
+// Subscribes to status events with <interval_ms> between events and prints them until the connection breaks
+int command_subscribe_status(char *addr, int port, int interval_ms)
+{
+    command_t command;
+    status_packet_t status_packet;
+    uint32_t interval = interval_ms;
+    char send_buf[COMMAND_PACKET_SIZE + sizeof(interval)];
+    uint16_t changed;
+    int response;
+    int ret;
+
+    client_sock = sock_connect(addr, port, SOCK_PROTO_TCP, COMMAND_TIMEOUT);
+    if (client_sock < 0) {
+        return CMD_ERR_CONNECT;
+    }
+
+    memset(&command, 0, sizeof(command));
+    command.cmd = CMD_SUBSCRIBE_STATUS;
+    command.param_size = sizeof(interval);
+    memcpy(send_buf, &command, COMMAND_PACKET_SIZE);
+    memcpy(send_buf + COMMAND_PACKET_SIZE, &interval, sizeof(interval));
+
+    if (sock_send(client_sock, send_buf, sizeof(send_buf), COMMAND_TIMEOUT) < 0) {
+        sock_close(client_sock);
+        return CMD_ERR_SEND_CMD;
+    }
+    if (recv_all(client_sock, (char *)&response, sizeof(response), COMMAND_TIMEOUT) < 0) {
+        sock_close(client_sock);
+        return CMD_ERR_RECV_RESPONSE;
+    }
+    if (response != 0) {
+        sock_close(client_sock);
+        return response;
+    }
+
+    memset(&status_packet, 0, sizeof(status_packet));
+    for (;;) {
+        ret = command_recv_status_event(&status_packet, &changed);
+        if (ret <= 0) {
+            break;
+        }
+
+        printf("%.3f", now_ms() / 1000.0);
+        if (changed & (1 << STATUS_FIELD_STATUS)) {
+            printf(" connected=%d connecting=%d recording=%d signal=%d silence=%d", (status_packet.status >> STATUS_CONNECTED) & 1,
+                   (status_packet.status >> STATUS_CONNECTING) & 1, (status_packet.status >> STATUS_RECORDING) & 1,
+                   (status_packet.status >> STATUS_SIGNAL_DETECTED) & 1, (status_packet.status >> STATUS_SILENCE_DETECTED) & 1);
+        }
+        if (changed & (1 << STATUS_FIELD_VOLUME)) {
+            printf(" vu=%0.1f/%0.1f", status_packet.volume_left / 10.0, status_packet.volume_right / 10.0);
+        }
+        if (changed & (1 << STATUS_FIELD_STREAM)) {
+            printf(" stream=%lus/%lukB", (unsigned long)status_packet.stream_seconds, (unsigned long)status_packet.stream_kByte);
+        }
+        if (changed & (1 << STATUS_FIELD_RECORD)) {
+            printf(" record=%lus/%lukB", (unsigned long)status_packet.record_seconds, (unsigned long)status_packet.record_kByte);
+        }
+        if (changed & (1 << STATUS_FIELD_LISTENERS)) {
+            printf(" listeners=%d", status_packet.listener_count);
+        }
+        if (changed & (1 << STATUS_FIELD_SONG)) {
+            printf(" song=\"%s\"", status_packet.song);
+        }
+        if (changed & (1 << STATUS_FIELD_REC_PATH)) {
+            printf(" rec_path=\"%s\"", status_packet.rec_path);
+        }
+        if (changed & (1 << STATUS_FIELD_LOUDNESS)) {
+            const char *names[STATUS_LOUDNESS_COUNT] = {"M", "S", "I", "LRA", "TP"};
+            printf(" loudness=");
+            for (int i = 0; i < STATUS_LOUDNESS_COUNT; i++) {
+                if (status_packet.loudness[i] == STATUS_LOUDNESS_NONE) {
+                    printf("%s%s:-inf", i > 0 ? "," : "", names[i]);
+                }
+                else {
+                    printf("%s%s:%0.1f", i > 0 ? "," : "", names[i], status_packet.loudness[i] / 10.0);
+                }
+            }
+        }
+        printf("\n");
+        fflush(stdout);
+    }
+
+    free(status_packet.song);
+    free(status_packet.rec_path);
+    sock_close(client_sock);
+
+    return ret < 0 ? CMD_ERR_RECV_STATUS : 0;
+}
@@ -1,11 +1,16 @@
 #ifndef COMMAND_H
 #define COMMAND_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include "sockfuncs.h"
 
 #define COMMAND_TIMEOUT        2000
 #define COMMAND_FIFO_LEN       32
+#define COMMAND_MAX_CLIENTS    256
+#define COMMAND_LISTEN_BACKLOG 64
+#define COMMAND_MAX_SEND_BUF   (64 * 1024) // Clients with more unread reply bytes are disconnected
+#define COMMAND_IDLE_TIMEOUT   60          // Seconds without a command until a client is disconnected
 #define COMMAND_PACKET_SIZE    (sizeof(command_t) - sizeof(void *))
 #define COMMAND_MAX_PARAM_SIZE 1000
 
@@ -18,7 +23,36 @@
 #define STATUS_SILENCE_DETECTED 4
 #define STATUS_EXTENDED_PACKET  31
 #define STATUS_PACKET_VERSION   3
-#define STATUS_PACKET_SIZE      (sizeof(status_packet_t) - 2 * sizeof(char *))
+#define STATUS_PACKET_SIZE      offsetof(status_packet_t, song)
+
+// Status events pushed to subscribed clients (CMD_SUBSCRIBE_STATUS).
+// An event is a status_event_hdr_t followed by the fields whose bit is set in <changed>, in bit order.
+// The first event after subscribing carries all fields, later ones only what changed.
+// Polled status packets stay at STATUS_PACKET_VERSION so older clients keep working
+#define STATUS_EVENT_VERSION      (STATUS_PACKET_VERSION + 2)
+#define STATUS_FIELD_STATUS       0 // uint32_t status register (connect state, recording, signal/silence)
+#define STATUS_FIELD_VOLUME       1 // int16_t volume_left, int16_t volume_right
+#define STATUS_FIELD_STREAM       2 // uint32_t stream_seconds, uint32_t stream_kByte
+#define STATUS_FIELD_RECORD       3 // uint32_t record_seconds, uint32_t record_kByte
+#define STATUS_FIELD_LISTENERS    4 // int32_t listener_count
+#define STATUS_FIELD_SONG         5 // uint16_t song_len, song (incl. trailing '\0')
+#define STATUS_FIELD_REC_PATH     6 // uint16_t rec_path_len, rec_path (changes on every recording split)
+#define STATUS_FIELD_LOUDNESS     7 // int16_t loudness[STATUS_LOUDNESS_COUNT]
+#define STATUS_EVENT_MAX_SIZE \
+    (sizeof(status_event_hdr_t) + STATUS_PACKET_SIZE + 2 * sizeof(uint16_t) + 2 * 0xFFFF + STATUS_LOUDNESS_COUNT * sizeof(int16_t))
+#define STATUS_SUB_MIN_INTERVAL   50   // ms, fastest event rate (20 Hz)
+#define STATUS_SUB_HEARTBEAT      5000 // ms, a full event is sent if no event was sent for this long
+#define STATUS_LOUDNESS_NONE      INT16_MIN // Not measured yet or below the absolute gate
+
+// Index into status_packet_t.loudness
+enum {
+    STATUS_LOUDNESS_MOMENTARY = 0,
+    STATUS_LOUDNESS_SHORT_TERM = 1,
+    STATUS_LOUDNESS_INTEGRATED = 2,
+    STATUS_LOUDNESS_RANGE = 3,
+    STATUS_LOUDNESS_TRUE_PEAK = 4,
+    STATUS_LOUDNESS_COUNT = 5,
+};
 
 enum {
     CMD_EMPTY = 0,
@@ -34,6 +68,7 @@ enum {
     CMD_SET_STREAM_SILENCE_THRESHOLD = 10,
     CMD_SET_RECORD_SIGNAL_THRESHOLD = 11,
     CMD_SET_RECORD_SILENCE_THRESHOLD = 12,
+    CMD_SUBSCRIBE_STATUS = 13, // param: uint32_t event interval in ms (0 = unsubscribe), TCP only
 };
 
 enum {
@@ -43,6 +78,7 @@ enum {
     CMD_ERR_RECV_STATUS = -4,
     CMD_ERR_FIFO_EMPTY = -5,
     CMD_ERR_FIFO_FULL = -6,
+    CMD_ERR_UNSUPPORTED = -7,
 };
 
 enum {
@@ -72,15 +108,25 @@ typedef struct status_packet {
     int32_t listener_count;
     char *song;
     char *rec_path;
+    int16_t loudness[STATUS_LOUDNESS_COUNT]; // Status events only, LUFS/LU/dBTP * 10
 } __attribute__((packed)) status_packet_t;
 
+typedef struct status_event_hdr {
+    uint16_t version;
+    uint16_t changed; // (1 << STATUS_FIELD_*) of the fields that follow
+} __attribute__((packed)) status_event_hdr_t;
+
 int command_start_server(int port, int search_port, int mode, sock_proto_t proto);
 int command_add_cmd_to_fifo(command_t new_cmd);
 int command_get_cmd_from_fifo(command_t *cmd);
 int command_send_cmd(command_t command, char *addr, int port, sock_proto_t proto);
 void command_get_last_cmd(command_t *command);
-void command_send_status_reply(status_packet_t *status_packet);
+void command_set_status(status_packet_t *status_packet);
+int command_has_subscribers(void);
 int command_recv_status_reply(status_packet_t *status_packet, sock_proto_t proto);
 void command_stop_server(void);
+int command_benchmark(char *addr, int port, int rate, int count);
+int command_subscribe_status(char *addr, int port, int interval_ms);
+int command_recv_status_event(status_packet_t *status_packet, uint16_t *changed);
 
 #endif
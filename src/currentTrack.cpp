@@ -14,4 +14,9 @@ currentTrackFunction getCurrentTrackFunctionFromId(int i)
     default:
         return NULL;
     }
+}
+
+extern "C" int currentTrackWatch(void (*on_change)(void))
+{
+    return -1;
 }
\ No newline at end of file
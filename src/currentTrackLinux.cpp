@@ -3,13 +3,37 @@
 #include <string.h>
 #include <stdbool.h>
 #include <stdarg.h>
+#include <pthread.h>
 #include <dbus/dbus.h>
 
 #include "currentTrack.h"
 
+#define MPRIS_PREFIX "org.mpris.MediaPlayer2."
+#define MPRIS_PATH "/org/mpris/MediaPlayer2"
+#define MPRIS_PLAYER_IFACE "org.mpris.MediaPlayer2.Player"
+#define MPRIS_MAX_PLAYERS 32
+
 static DBusError err;
 static DBusConnection *conn = NULL;
 
+// State of the MPRIS players as last reported by PropertiesChanged signals, see currentTrackWatch()
+typedef struct {
+    char *name;  // Well-known name, e.g. org.mpris.MediaPlayer2.spotify
+    char *owner; // Unique connection name, which is the sender of the signals
+    char *status;
+    char *title;
+    char *artist;
+} mpris_player_t;
+
+static mpris_player_t players[MPRIS_MAX_PLAYERS];
+static int num_players = 0;
+static pthread_mutex_t players_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static int watch_started = 0;
+static DBusConnection *watch_conn = NULL;
+static pthread_t watch_thread_detached;
+static void (*watch_on_change)(void);
+
 static bool dbus_init(void)
 {
     if (conn == NULL) {
@@ -114,44 +138,92 @@ static void playbackstatus(void *data, DBusMessageIter *args)
     *((char **)data) = strdup(str);
 }
 
-static void metadata(void *data, DBusMessageIter *args)
+// Joins all artists with ", " and takes the title from an MPRIS Metadata dictionary (a{sv})
+static void parse_metadata(DBusMessageIter *dict, char **title, char **artist)
 {
-    DBusMessageIter var, arr, var2, var3, arr2;
-    char *str = NULL;
-    char **values = (char **)data;
-    dbus_message_iter_recurse(args, &var);
+    DBusMessageIter arr, entry, var, list;
+    const char *key, *str;
+
+    if (dbus_message_iter_get_arg_type(dict) != DBUS_TYPE_ARRAY) {
+        return;
+    }
 
-    dbus_message_iter_recurse(&var, &arr);
-    do {
-        dbus_message_iter_recurse(&arr, &var2);
-        dbus_message_iter_get_basic(&var2, &str);
-        dbus_message_iter_next(&var2);
-        if (values[1] == NULL && !strcmp("xesam:artist", str)) {
-            dbus_message_iter_recurse(&var2, &var3);
-            dbus_message_iter_recurse(&var3, &arr2);
-            values[1] = (char *)calloc(1, 1);
+    dbus_message_iter_recurse(dict, &arr);
+    while (dbus_message_iter_get_arg_type(&arr) == DBUS_TYPE_DICT_ENTRY) {
+        dbus_message_iter_recurse(&arr, &entry);
+        dbus_message_iter_get_basic(&entry, &key);
+        dbus_message_iter_next(&entry);
+        dbus_message_iter_recurse(&entry, &var);
+
+        if (*artist == NULL && !strcmp("xesam:artist", key) && dbus_message_iter_get_arg_type(&var) == DBUS_TYPE_ARRAY) {
+            *artist = (char *)calloc(1, 1);
             int s = 1, didFirst = 0;
-            do {
-                dbus_message_iter_get_basic(&arr2, &str);
+            dbus_message_iter_recurse(&var, &list);
+            while (dbus_message_iter_get_arg_type(&list) == DBUS_TYPE_STRING) {
+                dbus_message_iter_get_basic(&list, &str);
                 if (strlen(str)) {
                     s += strlen(str) + (didFirst ? 2 : 0);
-                    values[1] = (char *)realloc(values[1], s);
+                    *artist = (char *)realloc(*artist, s);
                     if (didFirst) {
-                        strcat(values[1], ", ");
-                    }
-                    strcat(values[1], str);
-                    if (!didFirst) {
-                        didFirst = 1;
+                        strcat(*artist, ", ");
                     }
+                    strcat(*artist, str);
+                    didFirst = 1;
                 }
-            } while (dbus_message_iter_next(&arr2));
+                dbus_message_iter_next(&list);
+            }
         }
-        else if (values[0] == NULL && !strcmp("xesam:title", str)) {
-            dbus_message_iter_recurse(&var2, &var3);
-            dbus_message_iter_get_basic(&var3, &str);
-            values[0] = strdup(str);
+        else if (*title == NULL && !strcmp("xesam:title", key) && dbus_message_iter_get_arg_type(&var) == DBUS_TYPE_STRING) {
+            dbus_message_iter_get_basic(&var, &str);
+            *title = strdup(str);
         }
-    } while (dbus_message_iter_next(&arr));
+        dbus_message_iter_next(&arr);
+    }
+}
+
+static void metadata(void *data, DBusMessageIter *args)
+{
+    DBusMessageIter var;
+    char **values = (char **)data;
+
+    dbus_message_iter_recurse(args, &var);
+    parse_metadata(&var, &values[0], &values[1]);
+}
+
+// Returns "artist - title" (or the other way round) in a newly allocated string or NULL if both are missing
+static char *format_track(const char *title, const char *artist, int artist_title_order)
+{
+    char *returnString = NULL;
+    int len;
+
+    if (title != NULL && artist != NULL) {
+        len = strlen(artist) + 3 + strlen(title) + 1;
+        returnString = (char *)malloc(len);
+        if (artist_title_order == 1) {
+            snprintf(returnString, len, "%s - %s", title, artist);
+        }
+        else {
+            snprintf(returnString, len, "%s - %s", artist, title);
+        }
+    }
+    else if (title != NULL) {
+        returnString = strdup(title);
+    }
+    else if (artist != NULL) {
+        returnString = strdup(artist);
+    }
+
+    return returnString;
+}
+
+static mpris_player_t *find_player(const char *name, const char *owner)
+{
+    for (int i = 0; i < num_players; i++) {
+        if ((name != NULL && !strcmp(players[i].name, name)) || (owner != NULL && !strcmp(players[i].owner, owner))) {
+            return &players[i];
+        }
+    }
+    return NULL;
 }
 
 static char *get_mpris(const char *target, int artist_title_order)
@@ -160,40 +232,32 @@ static char *get_mpris(const char *target, int artist_title_order)
     char *returnString = NULL;
     struct DBusMethodCall opt = {target, "/org/mpris/MediaPlayer2", "org.freedesktop.DBus.Properties", "Get", playbackstatus, &playbackStatusValue};
 
+    // The watcher keeps the state of all MPRIS players up to date, no need to ask the player
+    if (__atomic_load_n(&watch_started, __ATOMIC_ACQUIRE)) {
+        pthread_mutex_lock(&players_mutex);
+        mpris_player_t *p = find_player(target, NULL);
+        if (p != NULL && p->status != NULL && strcmp(p->status, "Stopped")) {
+            returnString = format_track(p->title, p->artist, artist_title_order);
+        }
+        pthread_mutex_unlock(&players_mutex);
+
+        if (p != NULL || !strncmp(target, MPRIS_PREFIX, strlen(MPRIS_PREFIX))) {
+            return returnString;
+        }
+    }
+
     dbus_init();
     if (dbus_bus_name_has_owner(conn, target, &err)) {
         dbus_call_method(&opt, 2, "org.mpris.MediaPlayer2.Player", "PlaybackStatus");
         if (playbackStatusValue != NULL && strcmp(playbackStatusValue, "Stopped")) {
-            int len;
             char *values[2] = {NULL, NULL};
             opt.arg_iter = metadata;
             opt.data = values;
             dbus_call_method(&opt, 2, "org.mpris.MediaPlayer2.Player", "Metadata");
 
-            if (values[0] != NULL && values[1] != NULL) {
-                len = strlen(values[1]) + 3 + strlen(values[0]) + 1;
-                returnString = (char *)malloc(len);
-                if (artist_title_order == 1) {
-                    snprintf(returnString, len, "%s - %s", values[0], values[1]);
-                }
-                else {
-                    snprintf(returnString, len, "%s - %s", values[1], values[0]);
-                }
-                free(values[0]);
-                free(values[1]);
-            }
-            else if (values[0] != NULL) {
-                len = strlen(values[0]) + 1;
-                returnString = (char *)malloc(len);
-                snprintf(returnString, len, "%s", values[0]);
-                free(values[0]);
-            }
-            else if (values[1] != NULL) {
-                len = strlen(values[1]) + 1;
-                returnString = (char *)malloc(len);
-                snprintf(returnString, len, "%s", values[1]);
-                free(values[1]);
-            }
+            returnString = format_track(values[0], values[1], artist_title_order);
+            free(values[0]);
+            free(values[1]);
         }
         if (playbackStatusValue != NULL) {
             free(playbackStatusValue);
@@ -258,3 +322,347 @@ currentTrackFunction getCurrentTrackFunctionFromId(int i)
         return NULL;
     }
 }
+
+// Stores a copy of <src> in <dst> and returns 1 if the value has changed
+static int set_str(char **dst, const char *src)
+{
+    if ((*dst == NULL && src == NULL) || (*dst != NULL && src != NULL && !strcmp(*dst, src))) {
+        return 0;
+    }
+    free(*dst);
+    *dst = src != NULL ? strdup(src) : NULL;
+    return 1;
+}
+
+static void free_player(mpris_player_t *p)
+{
+    free(p->name);
+    free(p->owner);
+    free(p->status);
+    free(p->title);
+    free(p->artist);
+    memset(p, 0, sizeof(*p));
+}
+
+// Applies a dictionary of changed player properties (a{sv}). Returns 1 if the track or status has changed
+static int apply_properties(mpris_player_t *p, DBusMessageIter *dict)
+{
+    DBusMessageIter arr, entry, var;
+    const char *key, *str;
+    char *title, *artist;
+    int changed = 0;
+
+    dbus_message_iter_recurse(dict, &arr);
+    while (dbus_message_iter_get_arg_type(&arr) == DBUS_TYPE_DICT_ENTRY) {
+        dbus_message_iter_recurse(&arr, &entry);
+        dbus_message_iter_get_basic(&entry, &key);
+        dbus_message_iter_next(&entry);
+        dbus_message_iter_recurse(&entry, &var);
+
+        if (!strcmp(key, "PlaybackStatus") && dbus_message_iter_get_arg_type(&var) == DBUS_TYPE_STRING) {
+            dbus_message_iter_get_basic(&var, &str);
+            changed |= set_str(&p->status, str);
+        }
+        else if (!strcmp(key, "Metadata")) {
+            // Metadata is always replaced as a whole
+            title = artist = NULL;
+            parse_metadata(&var, &title, &artist);
+            changed |= set_str(&p->title, title);
+            changed |= set_str(&p->artist, artist);
+            free(title);
+            free(artist);
+        }
+        dbus_message_iter_next(&arr);
+    }
+
+    return changed;
+}
+
+static DBusMessage *call_blocking(const char *target, const char *object, const char *interface, const char *method, const char *arg1, const char *arg2)
+{
+    DBusMessage *msg, *reply;
+    DBusError e;
+
+    msg = dbus_message_new_method_call(target, object, interface, method);
+    if (msg == NULL) {
+        return NULL;
+    }
+    if (arg1 != NULL) {
+        dbus_message_append_args(msg, DBUS_TYPE_STRING, &arg1, DBUS_TYPE_INVALID);
+    }
+    if (arg2 != NULL) {
+        dbus_message_append_args(msg, DBUS_TYPE_STRING, &arg2, DBUS_TYPE_INVALID);
+    }
+
+    dbus_error_init(&e);
+    reply = dbus_connection_send_with_reply_and_block(watch_conn, msg, 1000, &e);
+    dbus_message_unref(msg);
+    if (dbus_error_is_set(&e)) {
+        dbus_error_free(&e);
+        return NULL;
+    }
+
+    return reply;
+}
+
+static void remove_player(const char *name)
+{
+    mpris_player_t *p;
+
+    pthread_mutex_lock(&players_mutex);
+    p = find_player(name, NULL);
+    if (p != NULL) {
+        free_player(p);
+        *p = players[--num_players];
+        memset(&players[num_players], 0, sizeof(players[num_players]));
+    }
+    pthread_mutex_unlock(&players_mutex);
+}
+
+// Reads all properties of a player that appeared on the bus (or has invalidated its properties).
+// A known player keeps its old state until the new one has been read, so readers never see it empty
+static void fetch_player(const char *name)
+{
+    DBusMessage *reply;
+    DBusMessageIter args;
+    const char *owner;
+    mpris_player_t *p;
+    mpris_player_t fetched;
+    int ok = 0;
+
+    reply = call_blocking(DBUS_SERVICE_DBUS, DBUS_PATH_DBUS, DBUS_INTERFACE_DBUS, "GetNameOwner", name, NULL);
+    if (reply == NULL) {
+        return;
+    }
+    if (!dbus_message_get_args(reply, NULL, DBUS_TYPE_STRING, &owner, DBUS_TYPE_INVALID)) {
+        dbus_message_unref(reply);
+        return;
+    }
+
+    pthread_mutex_lock(&players_mutex);
+    p = find_player(name, NULL);
+    if (p == NULL && num_players < MPRIS_MAX_PLAYERS) {
+        p = &players[num_players++];
+        p->name = strdup(name);
+    }
+    if (p != NULL) {
+        set_str(&p->owner, owner);
+    }
+    pthread_mutex_unlock(&players_mutex);
+    dbus_message_unref(reply);
+
+    if (p == NULL) {
+        return;
+    }
+
+    // GetAll returns every property, so the result replaces the whole state
+    memset(&fetched, 0, sizeof(fetched));
+    reply = call_blocking(name, MPRIS_PATH, DBUS_INTERFACE_PROPERTIES, "GetAll", MPRIS_PLAYER_IFACE, NULL);
+    if (reply != NULL) {
+        if (dbus_message_iter_init(reply, &args) && dbus_message_iter_get_arg_type(&args) == DBUS_TYPE_ARRAY) {
+            apply_properties(&fetched, &args);
+            ok = 1;
+        }
+        dbus_message_unref(reply);
+    }
+
+    pthread_mutex_lock(&players_mutex);
+    p = find_player(name, NULL);
+    if (p != NULL && ok) {
+        free(p->status);
+        free(p->title);
+        free(p->artist);
+        p->status = fetched.status;
+        p->title = fetched.title;
+        p->artist = fetched.artist;
+        fetched.status = fetched.title = fetched.artist = NULL;
+    }
+    else if (p != NULL) { // The player's state is unknown
+        set_str(&p->status, NULL);
+        set_str(&p->title, NULL);
+        set_str(&p->artist, NULL);
+    }
+    pthread_mutex_unlock(&players_mutex);
+
+    free_player(&fetched);
+}
+
+static void list_players(void)
+{
+    DBusMessage *reply;
+    char **names;
+    int n;
+
+    reply = call_blocking(DBUS_SERVICE_DBUS, DBUS_PATH_DBUS, DBUS_INTERFACE_DBUS, "ListNames", NULL, NULL);
+    if (reply == NULL) {
+        return;
+    }
+
+    if (dbus_message_get_args(reply, NULL, DBUS_TYPE_ARRAY, DBUS_TYPE_STRING, &names, &n, DBUS_TYPE_INVALID)) {
+        for (int i = 0; i < n; i++) {
+            if (!strncmp(names[i], MPRIS_PREFIX, strlen(MPRIS_PREFIX))) {
+                fetch_player(names[i]);
+            }
+        }
+        dbus_free_string_array(names);
+    }
+    dbus_message_unref(reply);
+}
+
+static int on_properties_changed(DBusMessage *msg)
+{
+    DBusMessageIter args, dict, arr;
+    const char *iface, *prop;
+    const char *sender = dbus_message_get_sender(msg);
+    char *refetch[MPRIS_MAX_PLAYERS];
+    int num_refetch = 0;
+    int invalidated = 0;
+    int changed = 0;
+
+    if (sender == NULL || !dbus_message_iter_init(msg, &args) || dbus_message_iter_get_arg_type(&args) != DBUS_TYPE_STRING) {
+        return 0;
+    }
+    dbus_message_iter_get_basic(&args, &iface);
+    if (strcmp(iface, MPRIS_PLAYER_IFACE) || !dbus_message_iter_next(&args) || dbus_message_iter_get_arg_type(&args) != DBUS_TYPE_ARRAY) {
+        return 0;
+    }
+    dict = args;
+
+    // Players may only announce that a property has changed without its new value
+    if (dbus_message_iter_next(&args) && dbus_message_iter_get_arg_type(&args) == DBUS_TYPE_ARRAY) {
+        dbus_message_iter_recurse(&args, &arr);
+        while (dbus_message_iter_get_arg_type(&arr) == DBUS_TYPE_STRING) {
+            dbus_message_iter_get_basic(&arr, &prop);
+            if (!strcmp(prop, "Metadata") || !strcmp(prop, "PlaybackStatus")) {
+                invalidated = 1;
+            }
+            dbus_message_iter_next(&arr);
+        }
+    }
+
+    // One connection may own several names, e.g. org.mpris.MediaPlayer2.vlc and org.mpris.MediaPlayer2.vlc.instance42
+    pthread_mutex_lock(&players_mutex);
+    for (int i = 0; i < num_players; i++) {
+        if (strcmp(players[i].owner, sender)) {
+            continue;
+        }
+        changed |= apply_properties(&players[i], &dict);
+        if (invalidated) {
+            refetch[num_refetch++] = strdup(players[i].name);
+        }
+    }
+    pthread_mutex_unlock(&players_mutex);
+
+    for (int i = 0; i < num_refetch; i++) {
+        fetch_player(refetch[i]);
+        free(refetch[i]);
+        changed = 1;
+    }
+
+    return changed;
+}
+
+static int on_name_owner_changed(DBusMessage *msg)
+{
+    const char *name, *old_owner, *new_owner;
+
+    if (!dbus_message_get_args(msg, NULL, DBUS_TYPE_STRING, &name, DBUS_TYPE_STRING, &old_owner, DBUS_TYPE_STRING, &new_owner,
+                               DBUS_TYPE_INVALID)) {
+        return 0;
+    }
+    if (strncmp(name, MPRIS_PREFIX, strlen(MPRIS_PREFIX))) {
+        return 0;
+    }
+
+    if (new_owner[0] == '\0') {
+        remove_player(name);
+    }
+    else {
+        fetch_player(name);
+    }
+
+    return 1;
+}
+
+static void *watch_thread_func(void *data)
+{
+    DBusMessage *msg;
+    int changed;
+    (void)data;
+
+    // Detach thread (free ressources) because no one will call pthread_join() on it
+    pthread_detach(pthread_self());
+
+    list_players();
+    __atomic_store_n(&watch_started, 1, __ATOMIC_RELEASE);
+
+    while (dbus_connection_read_write(watch_conn, -1)) {
+        while ((msg = dbus_connection_pop_message(watch_conn)) != NULL) {
+            changed = 0;
+            if (dbus_message_is_signal(msg, DBUS_INTERFACE_PROPERTIES, "PropertiesChanged")) {
+                changed = on_properties_changed(msg);
+            }
+            else if (dbus_message_is_signal(msg, DBUS_INTERFACE_DBUS, "NameOwnerChanged")) {
+                changed = on_name_owner_changed(msg);
+            }
+            dbus_message_unref(msg);
+
+            if (changed && watch_on_change != NULL) {
+                watch_on_change();
+            }
+        }
+    }
+
+    // Lost the session bus. get_mpris() asks the players directly again
+    printf("MPRIS watcher: Connection to the session bus lost\n");
+    __atomic_store_n(&watch_started, 0, __ATOMIC_RELEASE);
+
+    return NULL;
+}
+
+extern "C" int currentTrackWatch(void (*on_change)(void))
+{
+    DBusError e;
+
+    if (watch_conn != NULL) {
+        return 0;
+    }
+
+    dbus_error_init(&e);
+    watch_conn = dbus_bus_get_private(DBUS_BUS_SESSION, &e);
+    if (watch_conn == NULL) {
+        printf("MPRIS watcher: %s\n", e.message);
+        dbus_error_free(&e);
+        return -1;
+    }
+    dbus_connection_set_exit_on_disconnect(watch_conn, FALSE);
+
+    dbus_bus_add_match(watch_conn,
+                       "type='signal',interface='" DBUS_INTERFACE_PROPERTIES "',member='PropertiesChanged',"
+                       "path='" MPRIS_PATH "',arg0='" MPRIS_PLAYER_IFACE "'",
+                       &e);
+    if (!dbus_error_is_set(&e)) {
+        dbus_bus_add_match(watch_conn,
+                           "type='signal',sender='" DBUS_SERVICE_DBUS "',interface='" DBUS_INTERFACE_DBUS "',"
+                           "member='NameOwnerChanged',arg0namespace='org.mpris.MediaPlayer2'",
+                           &e);
+    }
+    if (dbus_error_is_set(&e)) {
+        printf("MPRIS watcher: %s\n", e.message);
+        dbus_error_free(&e);
+        goto error;
+    }
+
+    watch_on_change = on_change;
+    if (pthread_create(&watch_thread_detached, NULL, watch_thread_func, NULL) != 0) {
+        goto error;
+    }
+
+    return 0;
+
+error:
+    dbus_connection_close(watch_conn);
+    dbus_connection_unref(watch_conn);
+    watch_conn = NULL;
+    return -1;
+}
@@ -0,0 +1,219 @@
+// audio device cache functions for butt
+//
+// Copyright 2007-2018 by Daniel Noethen.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <FL/fl_utf8.h> // for fl_fopen(...)
+
+#include "dev_cache.h"
+
+#define DEV_CACHE_HEADER "# butt audio device cache 1"
+
+// File format: the header line followed by one line per device:
+// <number of samplerates> <samplerate>... <TAB> <key>
+
+typedef struct {
+    char *key;
+    int sr_list[DEV_CACHE_MAX_SR + 1];
+    int num_of_sr;
+} dev_cache_entry_t;
+
+static dev_cache_entry_t *entries = NULL;
+static int num_of_entries = 0;
+static int max_entries = 0;
+static int dirty = 0;
+static pthread_mutex_t cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static dev_cache_entry_t *find_entry(const char *key)
+{
+    for (int i = 0; i < num_of_entries; i++) {
+        if (strcmp(entries[i].key, key) == 0) {
+            return &entries[i];
+        }
+    }
+
+    return NULL;
+}
+
+static void clear_entries(void)
+{
+    for (int i = 0; i < num_of_entries; i++) {
+        free(entries[i].key);
+    }
+    free(entries);
+
+    entries = NULL;
+    num_of_entries = 0;
+    max_entries = 0;
+}
+
+static void set_entry(const char *key, const int *sr_list, int num_of_sr)
+{
+    dev_cache_entry_t *entry = find_entry(key);
+
+    if (num_of_sr > DEV_CACHE_MAX_SR) {
+        num_of_sr = DEV_CACHE_MAX_SR;
+    }
+
+    if (entry == NULL) {
+        if (num_of_entries == max_entries) {
+            int new_max = max_entries > 0 ? 2 * max_entries : 16;
+            dev_cache_entry_t *new_entries = (dev_cache_entry_t *)realloc(entries, new_max * sizeof(dev_cache_entry_t));
+            if (new_entries == NULL) {
+                return;
+            }
+            entries = new_entries;
+            max_entries = new_max;
+        }
+
+        entry = &entries[num_of_entries];
+        entry->key = strdup(key);
+        if (entry->key == NULL) {
+            return;
+        }
+        num_of_entries++;
+    }
+    else if (entry->num_of_sr == num_of_sr && memcmp(entry->sr_list, sr_list, num_of_sr * sizeof(int)) == 0) {
+        return;
+    }
+
+    memcpy(entry->sr_list, sr_list, num_of_sr * sizeof(int));
+    memset(entry->sr_list + num_of_sr, 0, (DEV_CACHE_MAX_SR + 1 - num_of_sr) * sizeof(int));
+    entry->num_of_sr = num_of_sr;
+    dirty = 1;
+}
+
+int dev_cache_load(const char *path)
+{
+    FILE *fd;
+    char line[1024];
+    int sr_list[DEV_CACHE_MAX_SR + 1];
+
+    if ((fd = fl_fopen(path, "rb")) == NULL) {
+        return -1;
+    }
+
+    if (fgets(line, sizeof(line), fd) == NULL || strncmp(line, DEV_CACHE_HEADER, strlen(DEV_CACHE_HEADER)) != 0) {
+        fclose(fd);
+        return -1;
+    }
+
+    pthread_mutex_lock(&cache_mutex);
+    clear_entries();
+
+    while (fgets(line, sizeof(line), fd) != NULL) {
+        char *key = strchr(line, '\t');
+        char *p = line;
+        int num_of_sr, len, i;
+
+        if (key == NULL || sscanf(p, "%d%n", &num_of_sr, &len) != 1 || num_of_sr < 0 || num_of_sr > DEV_CACHE_MAX_SR) {
+            continue;
+        }
+        p += len;
+
+        for (i = 0; i < num_of_sr; i++) {
+            if (sscanf(p, "%d%n", &sr_list[i], &len) != 1) {
+                break;
+            }
+            p += len;
+        }
+        if (i < num_of_sr) {
+            continue;
+        }
+
+        key++;
+        key[strcspn(key, "\r\n")] = '\0';
+        set_entry(key, sr_list, num_of_sr);
+    }
+
+    dirty = 0;
+    pthread_mutex_unlock(&cache_mutex);
+
+    fclose(fd);
+    return 0;
+}
+
+int dev_cache_save(const char *path)
+{
+    FILE *fd;
+    int ret = 0;
+
+    pthread_mutex_lock(&cache_mutex);
+    if (dirty == 0) {
+        pthread_mutex_unlock(&cache_mutex);
+        return 0;
+    }
+
+    if ((fd = fl_fopen(path, "wb")) == NULL) {
+        pthread_mutex_unlock(&cache_mutex);
+        return -1;
+    }
+
+    fprintf(fd, "%s\n", DEV_CACHE_HEADER);
+    for (int i = 0; i < num_of_entries; i++) {
+        fprintf(fd, "%d", entries[i].num_of_sr);
+        for (int j = 0; j < entries[i].num_of_sr; j++) {
+            fprintf(fd, " %d", entries[i].sr_list[j]);
+        }
+        fprintf(fd, "\t%s\n", entries[i].key);
+    }
+
+    if (fclose(fd) != 0) {
+        ret = -1;
+    }
+    else {
+        dirty = 0;
+    }
+    pthread_mutex_unlock(&cache_mutex);
+
+    return ret;
+}
+
+int dev_cache_lookup(const char *key, int *sr_list)
+{
+    dev_cache_entry_t *entry;
+    int num_of_sr = -1;
+
+    pthread_mutex_lock(&cache_mutex);
+    if ((entry = find_entry(key)) != NULL) {
+        memcpy(sr_list, entry->sr_list, sizeof(entry->sr_list));
+        num_of_sr = entry->num_of_sr;
+    }
+    pthread_mutex_unlock(&cache_mutex);
+
+    return num_of_sr;
+}
+
+void dev_cache_store(const char *key, const int *sr_list, int num_of_sr)
+{
+    // Keys end at the line break in the cache file
+    if (strpbrk(key, "\r\n") != NULL) {
+        return;
+    }
+
+    pthread_mutex_lock(&cache_mutex);
+    set_entry(key, sr_list, num_of_sr);
+    pthread_mutex_unlock(&cache_mutex);
+}
+
+void dev_cache_clear(void)
+{
+    pthread_mutex_lock(&cache_mutex);
+    clear_entries();
+    dirty = 0;
+    pthread_mutex_unlock(&cache_mutex);
+}
@@ -0,0 +1,39 @@
+// audio device cache functions for butt
+//
+// Copyright 2007-2018 by Daniel Noethen.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+
+#ifndef DEV_CACHE_H
+#define DEV_CACHE_H
+
+#define DEV_CACHE_MAX_SR 11 // Samplerates per device
+
+// Remembers which samplerates each audio device supports, so the device list can be built without
+// probing every device. Entries are looked up by a key that identifies the device and its driver
+// (see snd_get_devices()). All functions are thread safe.
+
+// Replaces the cache with the content of <path>. Returns 0 on success and -1 if the file could not be read
+int dev_cache_load(const char *path);
+
+// Writes the cache to <path> if it has changed since it was loaded or saved. Returns 0 on success and -1 on error
+int dev_cache_save(const char *path);
+
+// Copies the samplerates of <key> into <sr_list> (DEV_CACHE_MAX_SR entries + terminating 0).
+// Returns the number of samplerates, which may be 0 for devices that support none of them, or -1 if <key> is not cached
+int dev_cache_lookup(const char *key, int *sr_list);
+
+void dev_cache_store(const char *key, const int *sr_list, int num_of_sr);
+
+void dev_cache_clear(void);
+
+#endif
@@ -0,0 +1,194 @@
+// encoder statistics for butt
+//
+// Copyright 2007-2018 by Daniel Noethen.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#ifdef __APPLE__
+#include <mach/mach.h>
+#include <mach/thread_policy.h>
+#endif
+
+#include "enc_stats.h"
+#include "metrics.h"
+
+static uint64_t get_monotonic_us(void)
+{
+#ifdef WIN32
+    LARGE_INTEGER freq, count;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&count);
+    return (uint64_t)(count.QuadPart / (double)freq.QuadPart * 1000000.0);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#endif
+}
+
+static uint64_t get_thread_cpu_us(void)
+{
+#ifdef WIN32
+    FILETIME creation, exit, kernel, user;
+    if (GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user) == 0) {
+        return 0;
+    }
+    uint64_t k = ((uint64_t)kernel.dwHighDateTime << 32) | kernel.dwLowDateTime;
+    uint64_t u = ((uint64_t)user.dwHighDateTime << 32) | user.dwLowDateTime;
+    return (k + u) / 10; // 100 ns units
+#else
+    struct timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0) {
+        return 0;
+    }
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#endif
+}
+
+void enc_stats_reset(enc_stats_t *stats)
+{
+    pthread_mutex_lock(&stats->mutex);
+    __atomic_store_n(&stats->queued_at, 0, __ATOMIC_RELAXED);
+    stats->active = 0;
+    memset(&stats->values, 0, sizeof(stats->values));
+    pthread_mutex_unlock(&stats->mutex);
+}
+
+// Called by the mixer thread after it has written a block into the encoder ringbuffer
+void enc_stats_queued(enc_stats_t *stats)
+{
+    uint64_t expected = 0;
+
+    // Only the first block since the encoder's last wakeup sets the time
+    if (__atomic_load_n(&stats->queued_at, __ATOMIC_RELAXED) == 0) {
+        __atomic_compare_exchange_n(&stats->queued_at, &expected, get_monotonic_us(), 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+    }
+}
+
+// Called by the encoder thread after it has been woken up
+void enc_stats_begin(enc_stats_t *stats)
+{
+    uint64_t wait;
+    uint64_t queued_at;
+
+    stats->cpu_start = get_thread_cpu_us();
+    stats->active = 1;
+
+    queued_at = __atomic_exchange_n(&stats->queued_at, 0, __ATOMIC_RELAXED);
+    if (queued_at != 0) {
+        wait = get_monotonic_us() - queued_at;
+
+        pthread_mutex_lock(&stats->mutex);
+        stats->values.blocks++;
+        stats->values.wait_us += wait;
+        if (wait > stats->values.max_wait_us) {
+            stats->values.max_wait_us = wait;
+        }
+        pthread_mutex_unlock(&stats->mutex);
+
+        metrics_observe_us(stats->wait_metric, wait);
+    }
+}
+
+// Called by the encoder thread before it goes back to sleep
+void enc_stats_end(enc_stats_t *stats)
+{
+    uint64_t cpu_time;
+
+    if (!stats->active) {
+        return;
+    }
+
+    cpu_time = get_thread_cpu_us() - stats->cpu_start;
+    stats->active = 0;
+
+    pthread_mutex_lock(&stats->mutex);
+    stats->values.cpu_time_us += cpu_time;
+    pthread_mutex_unlock(&stats->mutex);
+
+    metrics_observe_us(stats->cpu_metric, cpu_time);
+}
+
+void enc_stats_get(enc_stats_t *stats, enc_stats_values_t *values)
+{
+    pthread_mutex_lock(&stats->mutex);
+    *values = stats->values;
+    pthread_mutex_unlock(&stats->mutex);
+}
+
+void enc_stats_print(enc_stats_t *stats)
+{
+    enc_stats_values_t v;
+
+    enc_stats_get(stats, &v);
+    if (v.blocks == 0) {
+        return;
+    }
+
+    printf("%s encoder: %llu blocks, cpu %.1f ms (%.1f us/block), queue wait avg %.1f us, max %llu us\n", stats->name, (unsigned long long)v.blocks,
+           v.cpu_time_us / 1000.0, (double)v.cpu_time_us / v.blocks, (double)v.wait_us / v.blocks, (unsigned long long)v.max_wait_us);
+}
+
+int enc_stats_pin_thread(int encoder_idx)
+{
+    int cpu_count;
+
+#ifdef WIN32
+    SYSTEM_INFO sysinfo;
+    GetSystemInfo(&sysinfo);
+    cpu_count = sysinfo.dwNumberOfProcessors;
+#else
+    cpu_count = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+    if (cpu_count < 3) {
+        return -1;
+    }
+
+    int cpu = 1 + encoder_idx % (cpu_count - 1);
+
+#if defined(WIN32)
+    if (SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << cpu) == 0) {
+        return -1;
+    }
+#elif defined(__APPLE__)
+    // macOS doesn't support binding threads to a cpu. Threads with the same affinity tag
+    // share a L2 cache, different tags are distributed over different caches if possible
+    thread_affinity_policy_data_t policy = {cpu};
+    if (thread_policy_set(pthread_mach_thread_np(pthread_self()), THREAD_AFFINITY_POLICY, (thread_policy_t)&policy, THREAD_AFFINITY_POLICY_COUNT) !=
+        KERN_SUCCESS) {
+        return -1;
+    }
+#elif defined(__linux__)
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(cpu, &cpuset);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset) != 0) {
+        return -1;
+    }
+#else
+    (void)cpu;
+    return -1;
+#endif
+
+    return 0;
+}
@@ -0,0 +1,59 @@
+// encoder statistics for butt
+//
+// Copyright 2007-2018 by Daniel Noethen.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+
+#ifndef ENC_STATS_H
+#define ENC_STATS_H
+
+#include <stdint.h>
+#include <pthread.h>
+
+#define ENC_STATS_NEW(stats, name, cpu_metric, wait_metric) \
+    enc_stats_t stats = {name, cpu_metric, wait_metric, PTHREAD_MUTEX_INITIALIZER, 0, 0, 0, {0, 0, 0, 0}}
+
+typedef struct enc_stats_values {
+    uint64_t blocks;      // Number of wakeups with pending audio data
+    uint64_t cpu_time_us; // CPU time consumed by the encoder thread
+    uint64_t wait_us;     // Accumulated time between the mixer queuing a block and the encoder picking it up
+    uint64_t max_wait_us;
+} enc_stats_values_t;
+
+// Every encoder instance (stream, recording) runs in its own thread and consumes
+// the mixer output from its own ringbuffer. The mixer marks a block as queued,
+// the encoder thread brackets its work with enc_stats_begin()/enc_stats_end()
+typedef struct enc_stats {
+    const char *name;
+    int cpu_metric;  // METRIC_* histograms that receive the per block values
+    int wait_metric;
+    pthread_mutex_t mutex; // Protects values, queued_at is accessed atomically so the mixer never blocks
+    uint64_t queued_at;    // Monotonic time in us, 0 if there is no pending block
+    uint64_t cpu_start;    // Thread CPU time at enc_stats_begin(), only accessed by the encoder thread
+    int active;            // enc_stats_begin() was called without enc_stats_end()
+    enc_stats_values_t values;
+} enc_stats_t;
+
+void enc_stats_reset(enc_stats_t *stats);
+void enc_stats_queued(enc_stats_t *stats);
+void enc_stats_begin(enc_stats_t *stats);
+void enc_stats_end(enc_stats_t *stats);
+void enc_stats_get(enc_stats_t *stats, enc_stats_values_t *values);
+void enc_stats_print(enc_stats_t *stats);
+
+// Pins the calling encoder thread to a cpu to keep its encoder state cache-hot. Only called if
+// cfg.main.pin_encoder_threads is set, the fixed cpus ignore taskset and cgroup limits.
+// Core 0 is left to the mixer, audio callback and GUI; nothing is pinned on machines with less than 3 cores.
+// Returns 0 on success and -1 if the thread was not pinned
+int enc_stats_pin_thread(int encoder_idx);
+
+#endif
@@ -0,0 +1,207 @@
+// file watch functions for butt
+//
+// Copyright 2007-2018 by Daniel Noethen.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "config.h"
+
+#ifdef HAVE_SYS_INOTIFY_H
+#include <errno.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/inotify.h>
+
+#include "timer.h"
+#endif
+
+#include "file_watch.h"
+
+#ifdef HAVE_SYS_INOTIFY_H
+static void *watch_thread_func(void *data)
+{
+    file_watch *fw = (file_watch *)data;
+    char buf[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+    struct inotify_event *ev;
+    struct pollfd fds[2];
+    ssize_t len;
+    char cmd;
+    int pending = 0;
+    int forced = 0;
+    int timeout;
+    uint64_t due = 0, now;
+
+    fds[0].fd = fw->inotify_fd;
+    fds[0].events = POLLIN;
+    fds[1].fd = fw->wake_pipe[0];
+    fds[1].events = POLLIN;
+
+    for (;;) {
+        timeout = -1;
+        if (pending) {
+            now = timer_get_cur_time();
+            timeout = due > now ? (int)(due - now) : 0;
+        }
+
+        if (poll(fds, 2, timeout) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+
+        if (fds[1].revents & POLLIN) {
+            if (read(fw->wake_pipe[0], &cmd, 1) == 1) {
+                if (cmd == 'q') {
+                    break;
+                }
+                pending = 1;
+                forced = 1;
+            }
+        }
+
+        if (fds[0].revents & POLLIN) {
+            len = read(fw->inotify_fd, buf, sizeof(buf));
+            for (char *p = buf; len > 0 && p < buf + len; p += sizeof(struct inotify_event) + ev->len) {
+                ev = (struct inotify_event *)p;
+                if (ev->len > 0 && !strcmp(ev->name, fw->name)) {
+                    pending = 1;
+                    due = timer_get_cur_time() + fw->debounce_ms;
+                }
+            }
+        }
+
+        if (pending && timer_get_cur_time() >= due) {
+            fw->on_change(fw->data, forced);
+            pending = 0;
+            forced = 0;
+        }
+    }
+
+    return NULL;
+}
+
+static void close_watch(file_watch *fw)
+{
+    if (fw->inotify_fd >= 0) {
+        close(fw->inotify_fd);
+    }
+    if (fw->wake_pipe[0] >= 0) {
+        close(fw->wake_pipe[0]);
+        close(fw->wake_pipe[1]);
+    }
+    fw->inotify_fd = -1;
+    fw->wake_pipe[0] = fw->wake_pipe[1] = -1;
+
+    free(fw->path);
+    free(fw->dir);
+    fw->path = fw->dir = NULL;
+}
+#endif
+
+int file_watch_start(file_watch *fw, const char *path, int debounce_ms, void (*on_change)(void *data, int forced), void *data)
+{
+#ifdef HAVE_SYS_INOTIFY_H
+    char *slash;
+
+    file_watch_stop(fw);
+
+    fw->inotify_fd = -1;
+    fw->wake_pipe[0] = fw->wake_pipe[1] = -1;
+    fw->debounce_ms = debounce_ms;
+    fw->on_change = on_change;
+    fw->data = data;
+
+    // The directory is watched instead of the file itself to follow files that are replaced
+    fw->path = strdup(path);
+    fw->dir = strdup(path);
+    if (fw->path == NULL || fw->dir == NULL) {
+        goto error;
+    }
+
+    slash = strrchr(fw->dir, '/');
+    if (slash == NULL) {
+        fw->name = fw->path;
+        strcpy(fw->dir, ".");
+    }
+    else {
+        fw->name = fw->path + (slash - fw->dir) + 1;
+        slash[slash == fw->dir ? 1 : 0] = '\0';
+    }
+
+    if (*fw->name == '\0' || (fw->inotify_fd = inotify_init1(IN_CLOEXEC)) < 0) {
+        goto error;
+    }
+    if (inotify_add_watch(fw->inotify_fd, fw->dir, IN_CLOSE_WRITE | IN_MOVED_TO | IN_MODIFY) < 0) {
+        goto error;
+    }
+    if (pipe(fw->wake_pipe) != 0) {
+        fw->wake_pipe[0] = fw->wake_pipe[1] = -1;
+        goto error;
+    }
+
+    if (pthread_create(&fw->thread, NULL, watch_thread_func, fw) != 0) {
+        goto error;
+    }
+
+    fw->running = 1;
+    return 0;
+
+error:
+    close_watch(fw);
+    return -1;
+#else
+    (void)fw;
+    (void)path;
+    (void)debounce_ms;
+    (void)on_change;
+    (void)data;
+    return -1;
+#endif
+}
+
+int file_watch_trigger(file_watch *fw)
+{
+#ifdef HAVE_SYS_INOTIFY_H
+    if (!fw->running || write(fw->wake_pipe[1], "r", 1) != 1) {
+        return -1;
+    }
+    return 0;
+#else
+    (void)fw;
+    return -1;
+#endif
+}
+
+void file_watch_stop(file_watch *fw)
+{
+#ifdef HAVE_SYS_INOTIFY_H
+    if (!fw->running) {
+        return;
+    }
+
+    if (write(fw->wake_pipe[1], "q", 1) != 1) {
+        pthread_cancel(fw->thread);
+    }
+    pthread_join(fw->thread, NULL);
+
+    close_watch(fw);
+    fw->running = 0;
+#else
+    (void)fw;
+#endif
+}
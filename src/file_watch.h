@@ -0,0 +1,47 @@
+// file watch functions for butt
+//
+// Copyright 2007-2018 by Daniel Noethen.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+
+#ifndef FILE_WATCH_H
+#define FILE_WATCH_H
+
+#include <pthread.h>
+
+// Watches a single file from a background thread. The directory of the file is watched
+// with inotify (IN_CLOSE_WRITE, IN_MOVED_TO, IN_MODIFY), so files that are replaced by renaming
+// a temporary file are followed as well. A burst of events, e.g. from writers that truncate
+// and rewrite the file, results in one call of on_change() after <debounce_ms> without events
+struct file_watch {
+    int running;
+    pthread_t thread;
+    int inotify_fd;
+    int wake_pipe[2];
+    char *path;
+    char *dir;
+    const char *name;
+    int debounce_ms;
+
+    // Called from the watcher thread. <forced> is set if the call was requested by file_watch_trigger()
+    void (*on_change)(void *data, int forced);
+    void *data;
+};
+
+// Returns 0 on success and -1 if the file can't be watched (no inotify, invalid path)
+int file_watch_start(file_watch *fw, const char *path, int debounce_ms, void (*on_change)(void *data, int forced), void *data);
+
+// Makes the watcher thread call on_change() immediately
+int file_watch_trigger(file_watch *fw);
+void file_watch_stop(file_watch *fw);
+
+#endif
@@ -19,9 +19,7 @@
 #include <math.h>
 
 #include "flac_encode.h"
-
-#define INT24_MAX ((1 << 23) - 1)
-#define INT24_MIN (-(1 << 23))
+#include "pcm_convert.h"
 
 FLAC__uint64 g_bytes_written = 0;
 
@@ -111,7 +109,7 @@ int flac_enc_init_FILE(flac_enc *flac, FILE *fout)
 
     set_settings(flac);
 
-    init_status = FLAC__stream_encoder_init_FILE(flac->encoder, fout, progress_callback, /*client_data=*/NULL);
+    init_status = FLAC__stream_encoder_init_FILE(flac->encoder, fout, progress_callback, /*client_data=*/flac);
     if (init_status != FLAC__STREAM_ENCODER_INIT_STATUS_OK) {
         fprintf(stderr, "ERROR: initializing encoder: %s\n", FLAC__StreamEncoderInitStatusString[init_status]);
 
@@ -180,24 +178,7 @@ int flac_enc_encode(flac_enc *flac, float *pcm_float, int samples_per_chan, int
 
     pcm_int32 = (int32_t *)pcm_float;
     while (samples_left > 0) {
-        for (i = 0; i < chunk_size * channel; i++) {
-            if (pcm_float[i] > 0) {
-                if (flac->bit_depth == 16) {
-                    pcm_int32[i] = (int32_t)round(fmin(pcm_float[i + samples_written] * INT16_MAX, INT16_MAX));
-                }
-                else { // 24 bit
-                    pcm_int32[i] = (int32_t)round(fmin(pcm_float[i + samples_written] * INT24_MAX, INT24_MAX));
-                }
-            }
-            else {
-                if (flac->bit_depth == 16) {
-                    pcm_int32[i] = (int32_t)round(fmax(-pcm_float[i + samples_written] * INT16_MIN, INT16_MIN));
-                }
-                else { // 24 bit
-                    pcm_int32[i] = (int32_t)round(fmax(-pcm_float[i + samples_written] * INT24_MIN, INT24_MIN));
-                }
-            }
-        }
+        pcm_float_to_int32(pcm_float + samples_written, pcm_int32, chunk_size * channel, flac->bit_depth);
 
         FLAC__stream_encoder_process_interleaved(flac->encoder, pcm_int32, chunk_size);
 
@@ -238,28 +219,16 @@ int flac_enc_encode_stream(flac_enc *flac, float *pcm_float, uint8_t *enc_buf, i
     samples_left = samples_per_chan;
 
     pcm_int32 = (int32_t *)pcm_float;
-    float sum;
+    int silent;
     while (samples_left > 0) {
-        // Convert 16bit samples to 32bit samples
-        sum = 0;
+        // Convert float samples to 16/24 bit samples
+        pcm_float_to_int32(pcm_float + samples_written, pcm_int32, chunk_size * channel, flac->bit_depth);
+
+        silent = 1;
         for (i = 0; i < chunk_size * channel; i++) {
-            sum += abs(pcm_float[i + samples_written]);
-
-            if (pcm_float[i + samples_written] > 0) {
-                if (flac->bit_depth == 16) {
-                    pcm_int32[i] = (int32_t)round(fmin(pcm_float[i + samples_written] * INT16_MAX, INT16_MAX));
-                }
-                else { // 24 bit
-                    pcm_int32[i] = (int32_t)round(fmin(pcm_float[i + samples_written] * INT24_MAX, INT24_MAX));
-                }
-            }
-            else {
-                if (flac->bit_depth == 16) {
-                    pcm_int32[i] = (int32_t)round(fmax(-pcm_float[i + samples_written] * INT16_MIN, INT16_MIN));
-                }
-                else { // 24 bit
-                    pcm_int32[i] = (int32_t)round(fmax(-pcm_float[i + samples_written] * INT24_MIN, INT24_MIN));
-                }
+            if (pcm_int32[i] != 0) {
+                silent = 0;
+                break;
             }
         }
 
@@ -267,7 +236,7 @@ int flac_enc_encode_stream(flac_enc *flac, float *pcm_float, uint8_t *enc_buf, i
         // This makes sure the FLAC encoder returns encoded data.
         // Otherwise, if the encoder receives 100 % silence, no encoded audio data
         // would be send to the streaming server and thus would drop the connection.
-        if (sum == 0) {
+        if (silent) {
             for (i = 0; i < chunk_size * channel; i++) {
                 pcm_int32[i] = (rand() % 3) - 1;
             }
@@ -324,7 +293,11 @@ void flac_enc_close(flac_enc *flac)
 void progress_callback(const FLAC__StreamEncoder *encoder, FLAC__uint64 bytes_written, FLAC__uint64 samples_written, unsigned frames_written,
                        unsigned total_frames_estimate, void *client_data)
 {
-    g_bytes_written = bytes_written;
+    flac_enc *flac = (flac_enc *)client_data;
+
+    if (flac->enc_type != FLAC_ENC_TYPE_MULTITRACK) {
+        g_bytes_written = bytes_written;
+    }
 }
 
 FLAC__StreamEncoderWriteStatus ogg_stream_callback(const FLAC__StreamEncoder *encoder, const FLAC__byte buffer[], size_t bytes, unsigned samples,
@@ -20,6 +20,7 @@
 
 #define FLAC_ENC_TYPE_REC    0
 #define FLAC_ENC_TYPE_STREAM 1
+#define FLAC_ENC_TYPE_MULTITRACK 2 // Recording that does not count towards flac_enc_get_bytes_written()
 
 #define FLAC_STATE_OK                 0
 #define FLAC_STATE_NEW_SONG_AVAILABLE 1
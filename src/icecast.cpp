@@ -57,7 +57,12 @@ tls_t stream_tls;
 
 int server_type = IC_TYPE_UNKNOWN;
 
+static char send_buf_data[IC_SEND_BUF_SIZE];
+static int send_buf_len = 0;
+static uint64_t send_buf_first_write = 0;
+
 int ic_recv(char *buf, int buf_len);
+static int ic_send_raw(char *buf, int buf_len);
 
 int ic_connect(void)
 {
@@ -76,6 +81,7 @@ int ic_connect(void)
 
     server_type = IC_TYPE_UNKNOWN;
     memset(recv_buf, 0, sizeof(recv_buf));
+    send_buf_len = 0;
 
     for (int try_cnt = 0; try_cnt < tries; try_cnt++) {
         if (cfg.srv[cfg.selected_srv]->icecast_protocol == ICECAST_PROTOCOL_SOURCE) {
@@ -121,10 +127,17 @@ int ic_connect(void)
             return ret;
         }
 
+        int sndbuf_size = cfg.audio.bitrate * 1000 / 8 * IC_SNDBUF_SECONDS;
+        if (sndbuf_size < IC_SNDBUF_MIN) {
+            sndbuf_size = IC_SNDBUF_MIN;
+        }
+        sock_tune_stream(stream_socket, sndbuf_size, IC_NOTSENT_LOWAT);
+
 #ifdef HAVE_LIBSSL
         if (cfg.srv[cfg.selected_srv]->tls == 1) {
             stream_tls.host = cfg.srv[cfg.selected_srv]->addr;
             stream_tls.socket = stream_socket;
+            stream_tls.port = cfg.srv[cfg.selected_srv]->port;
             stream_tls.cert_file = cfg.tls.cert_file;
             stream_tls.cert_dir = cfg.tls.cert_dir;
 
@@ -297,7 +310,7 @@ int ic_connect(void)
 
         snprintf(send_buf + strlen(send_buf), sizeof(send_buf) - strlen(send_buf), "\r\n");
 
-        ic_send(send_buf, (int)strlen(send_buf));
+        ic_send_raw(send_buf, (int)strlen(send_buf));
 
         ret = ic_recv(recv_buf, sizeof(recv_buf) - 1);
 
@@ -449,7 +462,48 @@ int ic_connect(void)
     return IC_OK;
 }
 
+static int ic_send_flush(void)
+{
+    int len = send_buf_len;
+
+    send_buf_len = 0;
+    if (len == 0) {
+        return 0;
+    }
+
+    return ic_send_raw(send_buf_data, len);
+}
+
+// Low bitrate encoders (opus, aac) return a few hundred bytes per call.
+// Sending them one by one costs a syscall (and a TLS record) each, so they are
+// collected and sent as one block. The added delay is at most IC_SEND_BUF_MAX_DELAY ms
 int ic_send(char *buf, int buf_len)
+{
+    uint64_t now = timer_get_cur_time();
+
+    if (send_buf_len + buf_len <= IC_SEND_BUF_SIZE) {
+        if (send_buf_len == 0) {
+            send_buf_first_write = now;
+        }
+        memcpy(send_buf_data + send_buf_len, buf, buf_len);
+        send_buf_len += buf_len;
+
+        if (send_buf_len < IC_SEND_BUF_SIZE && now - send_buf_first_write < IC_SEND_BUF_MAX_DELAY) {
+            return buf_len;
+        }
+
+        return ic_send_flush() < 0 ? -1 : buf_len;
+    }
+
+    // Big block, send what is buffered and then the block itself
+    if (ic_send_flush() < 0) {
+        return -1;
+    }
+
+    return ic_send_raw(buf, buf_len);
+}
+
+static int ic_send_raw(char *buf, int buf_len)
 {
     int ret;
     if (cfg.srv[cfg.selected_srv]->tls == 1) {
@@ -526,6 +580,7 @@ int ic_update_song(char *song_name)
     if (cfg.srv[cfg.selected_srv]->tls == 1) {
         web_tls.host = cfg.srv[cfg.selected_srv]->addr;
         web_tls.socket = web_socket;
+        web_tls.port = cfg.srv[cfg.selected_srv]->port;
         web_tls.cert_file = cfg.tls.cert_file;
         web_tls.cert_dir = cfg.tls.cert_dir;
         web_tls.skip_verification = 0;
@@ -601,6 +656,8 @@ int ic_update_song(char *song_name)
 
 void ic_disconnect(void)
 {
+    send_buf_len = 0;
+
 #ifdef HAVE_LIBSSL
     if (cfg.srv[cfg.selected_srv]->tls == 1) {
         tls_close(&stream_tls);
@@ -23,6 +23,16 @@ enum {
     IC_ASK = 3,
 };
 
+// Encoder output is collected and sent once IC_SEND_BUF_SIZE bytes are buffered
+// or the oldest buffered byte is IC_SEND_BUF_MAX_DELAY ms old
+#define IC_SEND_BUF_SIZE 4096
+#define IC_SEND_BUF_MAX_DELAY 250
+
+// Socket tuning of the stream connection
+#define IC_SNDBUF_SECONDS 2         // Socket send buffer holds this many seconds of audio...
+#define IC_SNDBUF_MIN (64 * 1024)   // ...but at least this many bytes
+#define IC_NOTSENT_LOWAT (16 * 1024) // Max. unsent bytes queued in the kernel (Linux, macOS)
+
 enum {
     IC_TYPE_UNKNOWN = -1,
     IC_TYPE_KH = 0,
@@ -0,0 +1,217 @@
+// level detection functions for butt
+//
+// Copyright 2007-2018 by Daniel Noethen.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "level_detect.h"
+
+// Arming state as one word, so the mixer never sees a new generation with an old hold time:
+// generation in the upper 32 bits, hold time in ms in the lower ones (0 = disarmed).
+// Every call of level_detect_arm() and level_detect_disarm() starts a new generation
+static uint64_t arm_state[LEVEL_DETECTOR_COUNT];
+
+static uint32_t silence_level_bits;
+static uint32_t signal_level_bits;
+
+// Path state with hysteresis, written by the mixer
+static int is_silent[LEVEL_PATH_COUNT];
+static int has_signal[LEVEL_PATH_COUNT];
+
+// Mixer thread only
+static int mixer_samplerate;
+static uint32_t seen_gen[LEVEL_DETECTOR_COUNT];
+static uint32_t fired_gen[LEVEL_DETECTOR_COUNT];
+static uint64_t held_frames[LEVEL_DETECTOR_COUNT];
+
+// Single producer (mixer), single consumer (control thread)
+static int events[LEVEL_DETECT_QUEUE_SIZE];
+static uint32_t events_head;
+static uint32_t events_tail;
+
+static void (*notify_func)(void) = NULL;
+
+static float load_level(uint32_t *bits)
+{
+    uint32_t b = __atomic_load_n(bits, __ATOMIC_RELAXED);
+    float level;
+
+    memcpy(&level, &b, sizeof(level));
+    return level;
+}
+
+static void store_level(uint32_t *bits, float level)
+{
+    uint32_t b;
+
+    memcpy(&b, &level, sizeof(b));
+    __atomic_store_n(bits, b, __ATOMIC_RELAXED);
+}
+
+static void new_generation(int detector, uint32_t hold_ms)
+{
+    uint64_t cur = __atomic_load_n(&arm_state[detector], __ATOMIC_RELAXED);
+    uint64_t next;
+
+    do {
+        next = ((uint64_t)((uint32_t)(cur >> 32) + 1) << 32) | hold_ms;
+    } while (!__atomic_compare_exchange_n(&arm_state[detector], &cur, next, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
+
+void level_detect_reset(int samplerate)
+{
+    mixer_samplerate = samplerate;
+
+    for (int i = 0; i < LEVEL_PATH_COUNT; i++) {
+        __atomic_store_n(&is_silent[i], 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&has_signal[i], 0, __ATOMIC_RELAXED);
+    }
+    for (int i = 0; i < LEVEL_DETECTOR_COUNT; i++) {
+        held_frames[i] = 0;
+    }
+}
+
+void level_detect_set_levels(float silence_dB, float signal_dB)
+{
+    store_level(&silence_level_bits, silence_dB);
+    store_level(&signal_level_bits, signal_dB);
+}
+
+void level_detect_arm(int detector, float hold_seconds)
+{
+    uint32_t hold_ms = (uint32_t)lrintf(hold_seconds * 1000);
+
+    new_generation(detector, hold_ms > 0 ? hold_ms : 1);
+}
+
+void level_detect_disarm(int detector)
+{
+    new_generation(detector, 0);
+}
+
+void level_detect_set_notify(void (*notify)(void))
+{
+    notify_func = notify;
+}
+
+static int push_event(int detector)
+{
+    uint32_t head = events_head;
+
+    if (head - __atomic_load_n(&events_tail, __ATOMIC_ACQUIRE) >= LEVEL_DETECT_QUEUE_SIZE) {
+        return 0;
+    }
+
+    events[head & (LEVEL_DETECT_QUEUE_SIZE - 1)] = detector;
+    __atomic_store_n(&events_head, head + 1, __ATOMIC_RELEASE);
+
+    return 1;
+}
+
+int level_detect_get_event(void)
+{
+    uint32_t tail = events_tail;
+    int detector;
+
+    if (tail == __atomic_load_n(&events_head, __ATOMIC_ACQUIRE)) {
+        return -1;
+    }
+
+    detector = events[tail & (LEVEL_DETECT_QUEUE_SIZE - 1)];
+    __atomic_store_n(&events_tail, tail + 1, __ATOMIC_RELEASE);
+
+    return detector;
+}
+
+// Counts how long <condition> has held for an armed detector and fires it once the hold time is reached
+static int run_detector(int detector, int condition, int frames)
+{
+    uint64_t state = __atomic_load_n(&arm_state[detector], __ATOMIC_ACQUIRE);
+    uint32_t gen = (uint32_t)(state >> 32);
+    uint32_t hold_ms = (uint32_t)state;
+
+    if (gen != seen_gen[detector]) {
+        seen_gen[detector] = gen;
+        held_frames[detector] = 0;
+    }
+
+    if (hold_ms == 0 || fired_gen[detector] == gen || !condition) {
+        held_frames[detector] = 0;
+        return 0;
+    }
+
+    held_frames[detector] += frames;
+    if (held_frames[detector] * 1000 < (uint64_t)hold_ms * mixer_samplerate) {
+        return 0;
+    }
+
+    fired_gen[detector] = gen;
+    held_frames[detector] = 0;
+
+    return push_event(detector);
+}
+
+int level_detect_process(int path, float peak, int frames)
+{
+    float silence_dB = load_level(&silence_level_bits);
+    float signal_dB = load_level(&signal_level_bits);
+    float level_dB = 20 * log10f(peak); // -inf for digital silence
+    int silent = is_silent[path];
+    int signal = has_signal[path];
+    int queued;
+
+    if (silent) {
+        silent = level_dB <= silence_dB + LEVEL_DETECT_HYSTERESIS;
+    }
+    else {
+        silent = level_dB < silence_dB;
+    }
+
+    if (signal) {
+        signal = level_dB >= signal_dB - LEVEL_DETECT_HYSTERESIS;
+    }
+    else {
+        signal = level_dB > signal_dB;
+    }
+
+    __atomic_store_n(&is_silent[path], silent, __ATOMIC_RELAXED);
+    __atomic_store_n(&has_signal[path], signal, __ATOMIC_RELAXED);
+
+    if (path == LEVEL_PATH_STREAM) {
+        queued = run_detector(LEVEL_STREAM_SILENCE, silent, frames);
+        queued += run_detector(LEVEL_STREAM_SIGNAL, signal, frames);
+    }
+    else {
+        queued = run_detector(LEVEL_REC_SILENCE, silent, frames);
+        queued += run_detector(LEVEL_REC_SIGNAL, signal, frames);
+    }
+
+    if (queued > 0 && notify_func != NULL) {
+        notify_func();
+    }
+
+    return queued;
+}
+
+int level_detect_is_silent(int path)
+{
+    return __atomic_load_n(&is_silent[path], __ATOMIC_RELAXED);
+}
+
+int level_detect_has_signal(int path)
+{
+    return __atomic_load_n(&has_signal[path], __ATOMIC_RELAXED);
+}
@@ -0,0 +1,65 @@
+// level detection functions for butt
+//
+// Copyright 2007-2018 by Daniel Noethen.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+
+#ifndef LEVEL_DETECT_H
+#define LEVEL_DETECT_H
+
+#define LEVEL_DETECT_HYSTERESIS 3.0f // dB a level has to move back across a threshold before the state flips again
+#define LEVEL_DETECT_QUEUE_SIZE 16   // Pending events, must be a power of 2
+
+enum {
+    LEVEL_PATH_STREAM = 0,
+    LEVEL_PATH_REC = 1,
+    LEVEL_PATH_COUNT = 2,
+};
+
+// The detector ids are also the events that are queued when a detector fires
+enum {
+    LEVEL_STREAM_SILENCE = 0,
+    LEVEL_STREAM_SIGNAL = 1,
+    LEVEL_REC_SILENCE = 2,
+    LEVEL_REC_SIGNAL = 3,
+    LEVEL_DETECTOR_COUNT = 4,
+};
+
+// Silence and signal detection runs in the mixer thread on every block, so the hold times are
+// counted in samples and do not depend on how often the GUI gets to run.
+// An armed detector fires once when its condition has held for the hold time without interruption,
+// queues its id and calls the notify function. It has to be armed again to fire another time.
+//
+// Called by the mixer thread before it starts
+void level_detect_reset(int samplerate);
+
+// <silence_dB> and <signal_dB> are in dBFS (<= 0). May be called from any thread
+void level_detect_set_levels(float silence_dB, float signal_dB);
+
+// (Re)starts the hold time of <detector>. May be called from any thread
+void level_detect_arm(int detector, float hold_seconds);
+void level_detect_disarm(int detector);
+
+// Mixer thread: feeds the mean channel peak of a block of <frames> frames into the detectors of <path>.
+// Returns the number of queued events
+int level_detect_process(int path, float peak, int frames);
+
+// Returns the id of the next fired detector or -1 if the queue is empty. Must always be called from the same thread
+int level_detect_get_event(void);
+
+// <notify> is called from the mixer thread after an event was queued
+void level_detect_set_notify(void (*notify)(void));
+
+int level_detect_is_silent(int path);
+int level_detect_has_signal(int path);
+
+#endif
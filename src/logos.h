@@ -1,1955 +1,1266 @@
+// Generated by pack_logos.py, do not edit
+//
+// 124x61 RGBA, every channel plane is PackBits compressed
+
+#define LOGO_WIDTH 124
+#define LOGO_HEIGHT 61
+#define LOGO_DEPTH 4
+
 static const unsigned char radio_co_logo[] = {
-    0,   0,   0,   0,   255, 255, 255, 19,  255, 255, 255, 68,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255,
-    67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255,
-    255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255,
-    255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,
-    255, 255, 255, 66,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255,
-    67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255,
-    255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255,
-    255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 66,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,
-    255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255,
-    67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255,
-    255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255,
-    255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 66,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,
-    255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255,
-    67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255,
-    255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 67,  255,
-    255, 255, 67,  255, 255, 255, 67,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 67,  255, 255, 255, 66,  255, 255, 255, 12,  0,   0,   0,   0,
-    255, 255, 255, 62,  255, 255, 255, 242, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 230, 255, 255, 255, 45,
-    255, 255, 255, 223, 255, 255, 255, 255, 255, 255, 255, 249, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255,
-    253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255,
-    255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255,
-    255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253,
-    255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255,
-    253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255,
-    255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255,
-    255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253,
-    255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255,
-    253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255,
-    255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255,
-    255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253,
-    255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255,
-    253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255,
-    255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255,
-    255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 248, 255, 255, 255, 255, 255, 255, 255, 194,
-    255, 255, 255, 255, 255, 255, 255, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 254, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 255, 255, 255, 254, 255, 255, 255, 254, 255, 255,
-    255, 255, 255, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 255, 255, 255, 254, 255, 255, 255, 254, 255, 255,
-    255, 255, 255, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 255, 255, 255, 254, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 233,
-    255, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 231,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    254, 254, 254, 255, 253, 253, 253, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 253,
-    253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255,
-    241, 241, 241, 255, 210, 210, 210, 255, 234, 234, 234, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 254, 254, 254, 255, 222, 222, 222, 255, 247, 247, 247, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 243, 243, 243, 255, 225,
-    225, 225, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 221, 221, 221, 255,
-    35,  35,  35,  255, 102, 102, 102, 255, 38,  38,  38,  255, 212, 212, 212, 255, 255, 255, 255, 255, 252, 252, 252, 255, 254, 254, 254, 255, 255, 255, 255,
-    255, 254, 254, 254, 255, 254, 254, 254, 255, 255, 255, 255, 255, 254, 254, 254, 255, 253, 253, 253, 255, 255, 255, 255, 255, 254, 254, 254, 255, 254, 254,
-    254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 254, 254, 254, 255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 253, 253, 255, 254, 254, 254, 255,
-    255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 253, 253, 253, 255, 255, 255, 255, 255, 254, 254, 254, 255, 254, 254, 254, 255, 255, 255, 255, 255, 254, 254, 254, 255, 253, 253, 253, 255, 255, 255,
-    255, 255, 251, 251, 251, 255, 66,  66,  66,  255, 226, 226, 226, 255, 255, 255, 255, 255, 252, 252, 252, 255, 255, 255, 255, 255, 208, 208, 208, 255, 98,
-    98,  98,  255, 255, 255, 255, 255, 254, 254, 254, 255, 253, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 116, 116, 116, 255,
-    174, 174, 174, 255, 255, 255, 255, 255, 237, 237, 237, 255, 245, 245, 245, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 102, 102, 102, 255, 227, 227, 227, 255, 255, 255, 255, 255, 252, 252, 252, 255, 255, 255, 255, 255, 210, 210, 210, 255, 125,
-    125, 125, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 174, 174, 174, 255,
-    81,  81,  81,  255, 229, 229, 229, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 252, 252, 255, 166, 166, 166, 255, 148, 148, 148, 255, 105, 105, 105,
-    255, 131, 131, 131, 255, 237, 237, 237, 255, 255, 255, 255, 255, 252, 252, 252, 255, 168, 168, 168, 255, 97,  97,  97,  255, 127, 127, 127, 255, 230, 230,
-    230, 255, 255, 255, 255, 255, 212, 212, 212, 255, 143, 143, 143, 255, 133, 133, 133, 255, 97,  97,  97,  255, 207, 207, 207, 255, 255, 255, 255, 255, 253,
-    253, 253, 255, 178, 178, 178, 255, 103, 103, 103, 255, 137, 137, 137, 255, 244, 244, 244, 255, 255, 255, 255, 255, 201, 201, 201, 255, 105, 105, 105, 255,
-    106, 106, 106, 255, 202, 202, 202, 255, 255, 255, 255, 255, 239, 239, 239, 255, 158, 158, 158, 255, 139, 139, 139, 255, 155, 155, 155, 255, 255, 255, 255,
-    255, 185, 185, 185, 255, 110, 110, 110, 255, 132, 132, 132, 255, 232, 232, 232, 255, 255, 255, 255, 255, 251, 251, 251, 255, 163, 163, 163, 255, 95,  95,
-    95,  255, 144, 144, 144, 255, 68,  68,  68,  255, 229, 229, 229, 255, 255, 255, 255, 255, 252, 252, 252, 255, 255, 255, 255, 255, 214, 214, 214, 255, 71,
-    71,  71,  255, 143, 143, 143, 255, 91,  91,  91,  255, 178, 178, 178, 255, 255, 255, 255, 255, 180, 180, 180, 255, 196, 196, 196, 255, 255, 255, 255, 255,
-    253, 253, 253, 255, 154, 154, 154, 255, 227, 227, 227, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 253, 253, 253, 255,
-    174, 174, 174, 255, 34,  34,  34,  255, 123, 123, 123, 255, 243, 243, 243, 255, 255, 255, 255, 255, 61,  61,  61,  255, 142, 142, 142, 255, 233, 233, 233,
-    255, 158, 158, 158, 255, 87,  87,  87,  255, 255, 255, 255, 255, 164, 164, 164, 255, 94,  94,  94,  255, 231, 231, 231, 255, 173, 173, 173, 255, 53,  53,
-    53,  255, 255, 255, 255, 255, 194, 194, 194, 255, 0,   0,   0,   255, 215, 215, 215, 255, 208, 208, 208, 255, 0,   0,   0,   255, 239, 239, 239, 255, 223,
-    223, 223, 255, 0,   0,   0,   255, 233, 233, 233, 255, 219, 219, 219, 255, 255, 255, 255, 255, 218, 218, 218, 255, 0,   0,   0,   255, 212, 212, 212, 255,
-    212, 212, 212, 255, 0,   0,   0,   255, 222, 222, 222, 255, 244, 244, 244, 255, 0,   0,   0,   255, 170, 170, 170, 255, 245, 245, 245, 255, 201, 201, 201,
-    255, 58,  58,  58,  255, 231, 231, 231, 255, 182, 182, 182, 255, 72,  72,  72,  255, 255, 255, 255, 255, 163, 163, 163, 255, 98,  98,  98,  255, 230, 230,
-    230, 255, 186, 186, 186, 255, 0,   0,   0,   255, 232, 232, 232, 255, 255, 255, 255, 255, 252, 252, 252, 255, 255, 255, 255, 255, 217, 217, 217, 255, 0,
-    0,   0,   255, 201, 201, 201, 255, 224, 224, 224, 255, 48,  48,  48,  255, 197, 197, 197, 255, 225, 225, 225, 255, 19,  19,  19,  255, 255, 255, 255, 255,
-    217, 217, 217, 255, 62,  62,  62,  255, 252, 252, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 250, 250, 250, 255, 138, 138, 138, 255, 131, 131, 131, 255, 255, 255, 255, 255, 101, 101, 101, 255, 238, 238, 238, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 86,  86,  86,  255, 221, 221, 221, 255, 105, 105, 105, 255, 230, 230, 230, 255, 255, 255, 255, 255, 255, 255, 255, 255, 99,  99,
-    99,  255, 225, 225, 225, 255, 200, 200, 200, 255, 146, 146, 146, 255, 255, 255, 255, 255, 255, 255, 255, 255, 137, 137, 137, 255, 193, 193, 193, 255, 254,
-    254, 254, 255, 116, 116, 116, 255, 110, 110, 110, 255, 199, 199, 199, 255, 255, 255, 255, 255, 151, 151, 151, 255, 176, 176, 176, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 175, 175, 175, 255, 161, 161, 161, 255, 246, 246, 246, 255, 85,  85,  85,  255, 254, 254, 254, 255, 255, 255, 255, 255, 145, 145, 145,
-    255, 93,  93,  93,  255, 145, 145, 145, 255, 134, 134, 134, 255, 85,  85,  85,  255, 229, 229, 229, 255, 98,  98,  98,  255, 231, 231, 231, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 98,  98,  98,  255, 227, 227, 227, 255, 255, 255, 255, 255, 252, 252, 252, 255, 255, 255, 255, 255, 210, 210, 210, 255, 123,
-    123, 123, 255, 255, 255, 255, 255, 255, 255, 255, 255, 216, 216, 216, 255, 98,  98,  98,  255, 255, 255, 255, 255, 114, 114, 114, 255, 199, 199, 199, 255,
-    147, 147, 147, 255, 185, 185, 185, 255, 255, 255, 255, 255, 252, 252, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 200, 200, 200, 255,
-    237, 237, 237, 255, 255, 255, 255, 255, 211, 211, 211, 255, 73,  73,  73,  255, 255, 255, 255, 255, 94,  94,  94,  255, 217, 217, 217, 255, 255, 255, 255,
-    255, 235, 235, 235, 255, 35,  35,  35,  255, 239, 239, 239, 255, 114, 114, 114, 255, 195, 195, 195, 255, 255, 255, 255, 255, 245, 245, 245, 255, 38,  38,
-    38,  255, 238, 238, 238, 255, 198, 198, 198, 255, 139, 139, 139, 255, 255, 255, 255, 255, 255, 255, 255, 255, 149, 149, 149, 255, 190, 190, 190, 255, 255,
-    255, 255, 255, 249, 249, 249, 255, 233, 233, 233, 255, 44,  44,  44,  255, 206, 206, 206, 255, 189, 189, 189, 255, 125, 125, 125, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 127, 127, 127, 255, 183, 183, 183, 255, 245, 245, 245, 255, 85,  85,  85,  255, 244, 244, 244, 255, 255, 255, 255, 255, 158, 158, 158,
-    255, 146, 146, 146, 255, 255, 255, 255, 255, 246, 246, 246, 255, 233, 233, 233, 255, 255, 255, 255, 255, 99,  99,  99,  255, 196, 196, 196, 255, 255, 255,
-    255, 255, 247, 247, 247, 255, 76,  76,  76,  255, 229, 229, 229, 255, 255, 255, 255, 255, 252, 252, 252, 255, 255, 255, 255, 255, 213, 213, 213, 255, 99,
-    99,  99,  255, 255, 255, 255, 255, 255, 255, 255, 255, 174, 174, 174, 255, 125, 125, 125, 255, 255, 255, 255, 255, 217, 217, 217, 255, 0,   0,   0,   255,
-    90,  90,  90,  255, 245, 245, 245, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 146, 146, 146, 255,
-    46,  46,  46,  255, 136, 136, 136, 255, 0,   0,   0,   255, 195, 195, 195, 255, 255, 255, 255, 255, 95,  95,  95,  255, 67,  67,  67,  255, 151, 151, 151,
-    255, 43,  43,  43,  255, 169, 169, 169, 255, 255, 255, 255, 255, 214, 214, 214, 255, 17,  17,  17,  255, 147, 147, 147, 255, 74,  74,  74,  255, 152, 152,
-    152, 255, 255, 255, 255, 255, 182, 182, 182, 255, 131, 131, 131, 255, 255, 255, 255, 255, 255, 255, 255, 255, 132, 132, 132, 255, 194, 194, 194, 255, 234,
-    234, 234, 255, 92,  92,  92,  255, 181, 181, 181, 255, 79,  79,  79,  255, 216, 216, 216, 255, 252, 252, 252, 255, 84,  84,  84,  255, 122, 122, 122, 255,
-    122, 122, 122, 255, 89,  89,  89,  255, 251, 251, 251, 255, 236, 236, 236, 255, 57,  57,  57,  255, 247, 247, 247, 255, 255, 255, 255, 255, 239, 239, 239,
-    255, 90,  90,  90,  255, 156, 156, 156, 255, 144, 144, 144, 255, 133, 133, 133, 255, 255, 255, 255, 255, 214, 214, 214, 255, 0,   0,   0,   255, 143, 143,
-    143, 255, 111, 111, 111, 255, 0,   0,   0,   255, 230, 230, 230, 255, 255, 255, 255, 255, 252, 252, 252, 255, 255, 255, 255, 255, 215, 215, 215, 255, 0,
-    0,   0,   255, 126, 126, 126, 255, 134, 134, 134, 255, 34,  34,  34,  255, 228, 228, 228, 255, 255, 255, 255, 255, 255, 255, 255, 255, 97,  97,  97,  255,
-    164, 164, 164, 255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    221, 221, 221, 255, 190, 190, 190, 255, 223, 223, 223, 255, 255, 255, 255, 255, 253, 253, 253, 255, 110, 110, 110, 255, 205, 205, 205, 255, 198, 198, 198,
-    255, 217, 217, 217, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 235, 235, 235, 255, 190, 190, 190, 255, 215, 215, 215, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 236, 236, 236, 255, 227, 227, 227, 255, 255, 255, 255, 255, 255, 255, 255, 255, 228, 228, 228, 255, 237, 237, 237, 255, 255,
-    255, 255, 255, 219, 219, 219, 255, 185, 185, 185, 255, 225, 225, 225, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 249, 249, 255, 199, 199, 199, 255,
-    199, 199, 199, 255, 249, 249, 249, 255, 255, 255, 255, 255, 248, 248, 248, 255, 221, 221, 221, 255, 253, 253, 253, 255, 254, 254, 254, 255, 255, 255, 255,
-    255, 246, 246, 246, 255, 195, 195, 195, 255, 199, 199, 199, 255, 245, 245, 245, 255, 255, 255, 255, 255, 255, 255, 255, 255, 234, 234, 234, 255, 190, 190,
-    190, 255, 219, 219, 219, 255, 222, 222, 222, 255, 246, 246, 246, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 243, 243, 243, 255, 223,
-    223, 223, 255, 214, 214, 214, 255, 191, 191, 191, 255, 241, 241, 241, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 247, 247, 255, 81,  81,  81,  255,
-    233, 233, 233, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 253, 253, 255, 80,  80,  80,  255, 232, 232, 232, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 251, 251, 255, 255, 255, 255, 255, 175, 175, 175, 255, 124, 124, 124, 255,
-    255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 254, 254, 255, 255, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    253, 253, 253, 255, 253, 253, 253, 255, 253, 253, 253, 255, 255, 255, 255, 255, 254, 254, 254, 255, 145, 145, 145, 255, 232, 232, 232, 255, 255, 255, 255,
-    255, 252, 252, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 253, 253, 253, 255, 253, 253, 253, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 254, 254, 254, 255, 255,
-    255, 255, 255, 253, 253, 253, 255, 253, 253, 253, 255, 253, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 253, 253, 253, 255,
-    253, 253, 253, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 254, 254, 254, 255, 253, 253, 253, 255, 253, 253, 253, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 253, 253,
-    253, 255, 253, 253, 253, 255, 253, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 253,
-    253, 253, 255, 253, 253, 253, 255, 253, 253, 253, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 142, 142, 142, 255, 220, 220, 220, 255,
-    255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254,
-    253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 252, 243, 243, 255, 253, 248, 248, 255, 255, 255, 255, 255, 255, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 255, 254, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 241,
-    197, 197, 255, 224, 87,  87,  255, 226, 110, 110, 255, 245, 218, 218, 255, 255, 255, 255, 255, 255, 254, 254, 255, 254, 253, 253, 255, 255, 254, 254, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 254, 254, 255, 254, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 243, 243, 255, 222,
-    71,  71,  255, 222, 77,  77,  255, 220, 44,  44,  255, 228, 124, 124, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    254, 253, 253, 255, 255, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 254, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 225, 225, 255, 237, 181, 181, 255, 255, 255, 255, 255, 252, 244, 244, 255, 224,
-    97,  97,  255, 223, 84,  84,  255, 222, 70,  70,  255, 229, 132, 132, 255, 255, 255, 255, 255, 251, 241, 241, 255, 237, 178, 178, 255, 251, 240, 240, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 254, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 253, 253, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 252, 243, 243, 255, 235, 172, 172, 255, 221, 55,  55,  255, 223, 74,  74,  255, 254, 249, 249, 255, 252, 246, 246, 255, 224,
-    91,  91,  255, 223, 82,  82,  255, 222, 65,  65,  255, 228, 129, 129, 255, 255, 255, 255, 255, 248, 229, 229, 255, 219, 0,   0,   255, 224, 93,  93,  255,
-    240, 192, 192, 255, 254, 252, 252, 255, 255, 255, 255, 255, 255, 254, 254, 255, 255, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 255, 255, 255, 255, 255, 254, 253,
-    253, 255, 240, 195, 195, 255, 224, 93,  93,  255, 221, 43,  43,  255, 222, 78,  78,  255, 226, 107, 107, 255, 254, 250, 250, 255, 252, 245, 245, 255, 224,
-    91,  91,  255, 223, 83,  83,  255, 222, 65,  65,  255, 228, 129, 129, 255, 255, 255, 255, 255, 248, 231, 231, 255, 222, 75,  75,  255, 223, 81,  81,  255,
-    220, 31,  31,  255, 227, 119, 119, 255, 244, 213, 213, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 253, 253, 253, 255, 254, 254, 254, 255, 255, 255, 255,
-    255, 253, 253, 253, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 245, 217, 217, 255, 227, 122,
-    122, 255, 220, 31,  31,  255, 222, 78,  78,  255, 224, 92,  92,  255, 222, 75,  75,  255, 225, 101, 101, 255, 254, 250, 250, 255, 252, 246, 246, 255, 224,
-    91,  91,  255, 223, 83,  83,  255, 222, 65,  65,  255, 228, 129, 129, 255, 255, 255, 255, 255, 248, 230, 230, 255, 221, 63,  63,  255, 223, 86,  86,  255,
-    224, 91,  91,  255, 222, 68,  68,  255, 221, 42,  42,  255, 231, 147, 147, 255, 249, 233, 233, 255, 255, 255, 255, 255, 255, 254, 254, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 253, 253, 255, 255, 255, 255, 255, 241, 200, 200, 255, 219, 0,   0,   255, 222, 70,
-    70,  255, 224, 90,  90,  255, 223, 84,  84,  255, 223, 83,  83,  255, 222, 74,  74,  255, 225, 103, 103, 255, 254, 250, 250, 255, 252, 245, 245, 255, 224,
-    91,  91,  255, 223, 83,  83,  255, 222, 65,  65,  255, 228, 129, 129, 255, 255, 255, 255, 255, 248, 231, 231, 255, 222, 65,  65,  255, 223, 84,  84,  255,
-    223, 81,  81,  255, 223, 86,  86,  255, 223, 89,  89,  255, 221, 53,  53,  255, 222, 63,  63,  255, 248, 227, 227, 255, 255, 255, 255, 255, 255, 254, 254,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 250, 250, 250, 255, 231, 232, 232, 255, 230, 230, 230, 255, 242, 242, 242, 255, 255, 255, 255,
-    255, 212, 212, 213, 255, 233, 233, 233, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 229, 132, 132, 255, 221, 63,  63,  255, 224, 91,
-    91,  255, 223, 81,  81,  255, 223, 82,  82,  255, 223, 84,  84,  255, 223, 81,  81,  255, 225, 97,  97,  255, 253, 249, 249, 255, 252, 245, 245, 255, 224,
-    90,  90,  255, 223, 83,  83,  255, 222, 66,  66,  255, 228, 128, 128, 255, 255, 255, 255, 255, 248, 229, 229, 255, 221, 61,  61,  255, 224, 90,  90,  255,
-    223, 81,  81,  255, 223, 82,  82,  255, 223, 81,  81,  255, 224, 96,  96,  255, 220, 31,  31,  255, 236, 174, 174, 255, 255, 255, 255, 255, 254, 253, 253,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 254, 254, 254, 255, 254, 254, 254, 255, 255, 255, 255, 255, 253, 253,
-    253, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 253, 253, 253, 255, 253, 253, 253, 255, 253, 253, 253, 255, 254,
-    254, 254, 255, 254, 254, 254, 255, 254, 254, 254, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255,
-    253, 253, 253, 255, 252, 252, 252, 255, 255, 255, 255, 255, 228, 228, 228, 255, 0,   0,   0,   255, 0,   0,   0,   255, 172, 172, 172, 255, 193, 193, 193,
-    255, 0,   0,   0,   255, 47,  48,  50,  255, 239, 239, 239, 255, 255, 255, 255, 255, 254, 254, 254, 255, 254, 254, 254, 255, 253, 253, 253, 255, 253, 253,
-    253, 255, 253, 253, 253, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 253, 253, 253, 255, 253, 253, 253, 255, 253, 253, 253, 255, 254, 254, 254, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 253, 253, 255, 253, 253, 253,
-    255, 253, 253, 253, 255, 253, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 229, 136, 136, 255, 221, 63,  63,  255, 223, 86,
-    86,  255, 223, 82,  82,  255, 223, 82,  82,  255, 223, 86,  86,  255, 220, 27,  27,  255, 227, 118, 118, 255, 254, 252, 252, 255, 252, 246, 246, 255, 224,
-    94,  94,  255, 223, 82,  82,  255, 222, 64,  64,  255, 229, 133, 133, 255, 255, 255, 255, 255, 249, 235, 235, 255, 222, 70,  70,  255, 221, 59,  59,  255,
-    223, 86,  86,  255, 223, 81,  81,  255, 223, 82,  82,  255, 223, 88,  88,  255, 221, 46,  46,  255, 236, 172, 172, 255, 255, 255, 255, 255, 254, 254, 254,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 253, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 253, 253, 253, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 227, 227, 227, 255, 0,   0,   0,   255, 0,   0,   0,   255, 175, 175, 175, 255, 184, 184, 184,
-    255, 0,   0,   0,   255, 0,   0,   0,   255, 234, 234, 235, 255, 255, 255, 255, 255, 252, 252, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 253, 253, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    253, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 229, 135, 135, 255, 221, 61,  61,  255, 223, 87,
-    87,  255, 223, 82,  82,  255, 223, 86,  86,  255, 222, 67,  67,  255, 234, 167, 167, 255, 252, 245, 245, 255, 255, 255, 255, 255, 249, 231, 231, 255, 222,
-    73,  73,  255, 223, 87,  87,  255, 222, 72,  72,  255, 226, 114, 114, 255, 254, 251, 251, 255, 255, 255, 255, 255, 249, 234, 234, 255, 229, 138, 138, 255,
-    222, 68,  68,  255, 223, 86,  86,  255, 223, 81,  81,  255, 224, 89,  89,  255, 220, 41,  41,  255, 236, 173, 173, 255, 255, 255, 255, 255, 254, 253, 253,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 250, 250, 250, 255, 246, 246, 246, 255, 247, 247, 247, 255, 255, 255, 255, 255, 221, 221,
-    221, 255, 236, 236, 236, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 247, 247, 255, 217, 217, 217, 255, 208, 208, 208, 255, 218, 218, 219, 255, 252,
-    252, 252, 255, 252, 252, 252, 255, 245, 245, 245, 255, 247, 247, 247, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 239, 239, 239, 255,
-    214, 214, 214, 255, 211, 211, 211, 255, 243, 243, 243, 255, 235, 235, 235, 255, 0,   0,   0,   255, 0,   0,   0,   255, 166, 166, 166, 255, 251, 251, 252,
-    255, 170, 170, 170, 255, 206, 206, 206, 255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 253, 253, 253, 255, 224, 224, 224, 255, 212, 212,
-    212, 255, 216, 216, 216, 255, 242, 242, 242, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 251, 251, 251, 255, 221, 221, 221, 255, 211, 212, 212, 255, 220, 220, 220, 255, 248, 248, 248, 255,
-    255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 232, 233, 233, 255, 213, 213, 213,
-    255, 213, 213, 214, 255, 232, 232, 232, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 229, 135, 135, 255, 221, 61,  61,  255, 223, 87,
-    87,  255, 223, 83,  83,  255, 223, 80,  80,  255, 224, 85,  85,  255, 253, 245, 245, 255, 255, 255, 255, 255, 244, 211, 211, 255, 226, 110, 110, 255, 222,
-    74,  74,  255, 223, 84,  84,  255, 223, 85,  85,  255, 222, 70,  70,  255, 229, 135, 135, 255, 247, 227, 227, 255, 255, 255, 255, 255, 246, 222, 222, 255,
-    221, 44,  44,  255, 223, 88,  88,  255, 223, 81,  81,  255, 224, 89,  89,  255, 220, 41,  41,  255, 236, 172, 172, 255, 255, 255, 255, 255, 254, 253, 253,
-    255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 176, 176, 176, 255, 0,   0,   0,   255, 94,  95,  95,  255, 145, 146, 146, 255, 0,   0,
-    0,   255, 191, 191, 191, 255, 255, 255, 255, 255, 198, 198, 198, 255, 61,  62,  63,  255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 124,
-    124, 125, 255, 126, 127, 128, 255, 30,  31,  32,  255, 98,  99,  99,  255, 247, 247, 247, 255, 255, 255, 255, 255, 172, 172, 173, 255, 0,   0,   3,   255,
-    0,   0,   0,   255, 0,   0,   0,   255, 57,  58,  59,  255, 146, 147, 147, 255, 47,  48,  49,  255, 0,   0,   0,   255, 171, 171, 172, 255, 176, 177, 177,
-    255, 76,  77,  77,  255, 86,  87,  88,  255, 223, 223, 223, 255, 255, 255, 255, 255, 215, 215, 215, 255, 96,  97,  98,  255, 0,   0,   0,   255, 0,   0,
-    0,   255, 0,   0,   0,   255, 44,  45,  47,  255, 175, 175, 175, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 254,
-    254, 254, 255, 255, 255, 255, 255, 210, 210, 211, 255, 84,  85,  86,  255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 71,  72,  73,  255,
-    197, 197, 197, 255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 241, 241, 241, 255, 136, 137, 137, 255, 0,   0,   0,   255, 0,   0,   0,
-    255, 0,   0,   0,   255, 0,   0,   0,   255, 135, 135, 135, 255, 240, 240, 240, 255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 229, 135, 135, 255, 221, 61,  61,  255, 223, 87,
-    87,  255, 223, 83,  83,  255, 223, 79,  79,  255, 224, 90,  90,  255, 252, 243, 243, 255, 253, 246, 246, 255, 222, 69,  69,  255, 221, 62,  62,  255, 223,
-    87,  87,  255, 223, 81,  81,  255, 223, 81,  81,  255, 224, 90,  90,  255, 220, 8,   8,   255, 228, 126, 126, 255, 255, 255, 255, 255, 246, 220, 220, 255,
-    221, 52,  52,  255, 223, 87,  87,  255, 223, 81,  81,  255, 224, 89,  89,  255, 220, 41,  41,  255, 236, 172, 172, 255, 255, 255, 255, 255, 254, 253, 253,
-    255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 167, 167, 167, 255, 0,   0,   0,   255, 6,   10,  14,  255, 0,   0,   0,   255, 0,   0,
-    0,   255, 202, 202, 202, 255, 215, 215, 215, 255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 0,
-    0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 52,  53,  55,  255, 252, 252, 252, 255, 172, 172, 172, 255, 0,   0,   0,   255, 22,  24,  25,  255,
-    0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 42,  44,  45,  255, 0,   0,   0,   255, 173, 173, 173, 255, 163, 163, 163,
-    255, 0,   0,   0,   255, 0,   0,   0,   255, 230, 230, 231, 255, 224, 224, 224, 255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,
-    0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 154, 154, 155, 255, 255, 255, 255, 255, 254, 254, 254, 255, 253, 253, 253, 255, 255,
-    255, 255, 255, 208, 208, 208, 255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255,
-    0,   0,   0,   255, 189, 189, 189, 255, 255, 255, 255, 255, 243, 243, 244, 255, 82,  83,  84,  255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,
-    255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 77,  78,  79,  255, 244, 244, 244, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 229, 135, 135, 255, 221, 61,  61,  255, 223, 87,
-    87,  255, 223, 83,  83,  255, 223, 79,  79,  255, 224, 88,  88,  255, 252, 245, 245, 255, 253, 246, 246, 255, 224, 95,  95,  255, 223, 82,  82,  255, 223,
-    83,  83,  255, 223, 82,  82,  255, 223, 82,  82,  255, 223, 87,  87,  255, 222, 68,  68,  255, 229, 134, 134, 255, 255, 255, 255, 255, 246, 221, 221, 255,
-    221, 50,  50,  255, 223, 87,  87,  255, 223, 81,  81,  255, 224, 89,  89,  255, 220, 41,  41,  255, 236, 172, 172, 255, 255, 255, 255, 255, 254, 253, 253,
-    255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 169, 169, 170, 255, 0,   0,   0,   255, 29,  31,  32,  255, 57,  58,  59,  255, 153, 154,
-    154, 255, 221, 221, 221, 255, 92,  93,  94,  255, 0,   0,   0,   255, 0,   0,   0,   255, 131, 131, 131, 255, 210, 210, 210, 255, 191, 192, 192, 255, 71,
-    72,  73,  255, 0,   0,   0,   255, 0,   0,   0,   255, 95,  96,  96,  255, 219, 219, 219, 255, 0,   0,   0,   255, 30,  32,  33,  255, 0,   0,   0,   255,
-    158, 159, 159, 255, 213, 213, 213, 255, 179, 179, 180, 255, 35,  36,  38,  255, 25,  27,  29,  255, 0,   0,   0,   255, 172, 172, 173, 255, 166, 167, 167,
-    255, 0,   0,   0,   255, 0,   0,   0,   255, 220, 220, 221, 255, 111, 111, 112, 255, 0,   0,   0,   255, 0,   0,   0,   255, 135, 135, 136, 255, 211, 211,
-    212, 255, 180, 180, 180, 255, 11,  15,  18,  255, 39,  40,  41,  255, 0,   0,   0,   255, 214, 214, 214, 255, 255, 255, 255, 255, 255, 255, 255, 255, 248,
-    248, 248, 255, 69,  70,  71,  255, 0,   0,   0,   255, 0,   0,   0,   255, 148, 148, 148, 255, 213, 213, 213, 255, 176, 176, 176, 255, 0,   0,   0,   255,
-    0,   0,   0,   255, 0,   0,   0,   255, 238, 238, 239, 255, 175, 175, 175, 255, 0,   0,   0,   255, 17,  20,  22,  255, 85,  85,  86,  255, 200, 200, 200,
-    255, 201, 201, 202, 255, 88,  89,  89,  255, 12,  15,  18,  255, 0,   0,   0,   255, 162, 162, 162, 255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 229, 135, 135, 255, 221, 61,  61,  255, 223, 87,
-    87,  255, 223, 83,  83,  255, 223, 79,  79,  255, 224, 88,  88,  255, 252, 245, 245, 255, 253, 247, 247, 255, 224, 95,  95,  255, 222, 77,  77,  255, 223,
-    84,  84,  255, 223, 82,  82,  255, 223, 82,  82,  255, 223, 87,  87,  255, 221, 61,  61,  255, 229, 136, 136, 255, 255, 255, 255, 255, 246, 221, 221, 255,
-    221, 51,  51,  255, 223, 87,  87,  255, 223, 81,  81,  255, 224, 89,  89,  255, 220, 41,  41,  255, 236, 172, 172, 255, 255, 255, 255, 255, 254, 253, 253,
-    255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 169, 169, 169, 255, 0,   0,   0,   255, 0,   0,   0,   255, 196, 197, 197, 255, 255, 255,
-    255, 255, 223, 223, 223, 255, 0,   0,   0,   255, 0,   0,   0,   255, 115, 116, 116, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 222,
-    222, 222, 255, 0,   0,   0,   255, 0,   0,   0,   255, 105, 105, 106, 255, 172, 172, 173, 255, 0,   0,   0,   255, 0,   0,   0,   255, 165, 165, 165, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 200, 200, 200, 255, 0,   0,   0,   255, 0,   0,   0,   255, 172, 172, 173, 255, 166, 166, 167,
-    255, 0,   0,   0,   255, 52,  53,  55,  255, 182, 182, 183, 255, 38,  40,  41,  255, 0,   0,   0,   255, 120, 120, 121, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 193, 194, 194, 255, 0,   0,   0,   255, 0,   0,   0,   255, 157, 157, 158, 255, 255, 255, 255, 255, 255, 255, 255, 255, 212,
-    212, 212, 255, 0,   0,   0,   255, 0,   0,   0,   255, 136, 137, 137, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 204, 204, 204, 255,
-    151, 152, 152, 255, 154, 154, 154, 255, 211, 212, 212, 255, 108, 109, 109, 255, 0,   0,   0,   255, 29,  31,  33,  255, 233, 233, 233, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 234, 234, 234, 255, 35,  37,  39,  255, 0,   0,   0,   255, 82,  83,  84,  255, 249, 249, 249, 255, 255, 255, 255, 255, 254, 254,
-    254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 229, 135, 135, 255, 221, 61,  61,  255, 223, 87,
-    87,  255, 223, 83,  83,  255, 223, 79,  79,  255, 224, 88,  88,  255, 252, 244, 244, 255, 252, 245, 245, 255, 223, 72,  72,  255, 223, 84,  84,  255, 223,
-    88,  88,  255, 223, 81,  81,  255, 223, 81,  81,  255, 224, 93,  93,  255, 221, 61,  61,  255, 227, 122, 122, 255, 255, 255, 255, 255, 246, 220, 220, 255,
-    221, 51,  51,  255, 223, 87,  87,  255, 223, 81,  81,  255, 224, 89,  89,  255, 220, 41,  41,  255, 236, 172, 172, 255, 255, 255, 255, 255, 254, 253, 253,
-    255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 169, 169, 169, 255, 0,   0,   0,   255, 0,   0,   0,   255, 225, 225, 225, 255, 255, 255,
-    255, 255, 200, 200, 201, 255, 0,   0,   0,   255, 0,   0,   0,   255, 184, 185, 185, 255, 255, 255, 255, 255, 249, 249, 249, 255, 252, 252, 252, 255, 254,
-    254, 254, 255, 100, 101, 102, 255, 0,   0,   0,   255, 104, 104, 105, 255, 147, 148, 148, 255, 0,   0,   0,   255, 0,   0,   0,   255, 220, 221, 221, 255,
-    255, 255, 255, 255, 249, 249, 249, 255, 255, 255, 255, 255, 244, 244, 244, 255, 62,  63,  64,  255, 0,   0,   0,   255, 173, 174, 174, 255, 166, 167, 167,
-    255, 0,   0,   0,   255, 63,  64,  65,  255, 157, 158, 158, 255, 20,  22,  24,  255, 0,   0,   0,   255, 187, 187, 187, 255, 255, 255, 255, 255, 248, 248,
-    248, 255, 255, 255, 255, 255, 240, 240, 240, 255, 33,  35,  37,  255, 0,   0,   0,   255, 133, 134, 134, 255, 255, 255, 255, 255, 255, 255, 255, 255, 196,
-    196, 196, 255, 0,   0,   0,   255, 0,   0,   0,   255, 201, 201, 201, 255, 255, 255, 255, 255, 249, 249, 249, 255, 251, 251, 251, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 247, 247, 247, 255, 45,  46,  48,  255, 0,   0,   0,   255, 125, 125, 125, 255, 255, 255, 255, 255, 251, 251, 251,
-    255, 250, 250, 250, 255, 255, 255, 255, 255, 127, 127, 128, 255, 0,   0,   0,   255, 46,  48,  49,  255, 238, 238, 238, 255, 255, 255, 255, 255, 254, 254,
-    254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 229, 135, 135, 255, 221, 61,  61,  255, 223, 87,
-    87,  255, 223, 83,  83,  255, 222, 78,  78,  255, 224, 91,  91,  255, 253, 246, 246, 255, 255, 254, 254, 255, 232, 149, 149, 255, 220, 26,  26,  255, 222,
-    71,  71,  255, 224, 91,  91,  255, 223, 89,  89,  255, 221, 61,  61,  255, 221, 42,  42,  255, 237, 180, 180, 255, 255, 255, 255, 255, 247, 224, 224, 255,
-    221, 50,  50,  255, 223, 88,  88,  255, 223, 81,  81,  255, 224, 89,  89,  255, 220, 41,  41,  255, 236, 172, 172, 255, 255, 255, 255, 255, 254, 253, 253,
-    255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 169, 169, 169, 255, 0,   0,   0,   255, 0,   0,   0,   255, 222, 222, 222, 255, 255, 255,
-    255, 255, 209, 209, 209, 255, 0,   0,   0,   255, 0,   0,   0,   255, 154, 154, 155, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 244,
-    244, 244, 255, 57,  59,  60,  255, 0,   0,   0,   255, 105, 105, 106, 255, 160, 160, 161, 255, 0,   0,   0,   255, 0,   0,   0,   255, 198, 198, 198, 255,
-    255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 227, 227, 227, 255, 0,   0,   0,   255, 0,   0,   0,   255, 173, 173, 173, 255, 166, 167, 167,
-    255, 0,   0,   0,   255, 60,  61,  62,  255, 167, 167, 168, 255, 26,  28,  30,  255, 0,   0,   0,   255, 158, 159, 159, 255, 255, 255, 255, 255, 254, 254,
-    254, 255, 255, 255, 255, 255, 224, 224, 224, 255, 0,   0,   0,   255, 0,   0,   0,   255, 142, 142, 142, 255, 255, 255, 255, 255, 255, 255, 255, 255, 203,
-    203, 203, 255, 0,   0,   0,   255, 0,   0,   0,   255, 176, 176, 176, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 241, 241, 241, 255,
-    215, 215, 216, 255, 221, 221, 221, 255, 224, 225, 225, 255, 80,  81,  82,  255, 0,   0,   0,   255, 86,  87,  88,  255, 252, 252, 252, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 254, 254, 254, 255, 92,  93,  93,  255, 0,   0,   0,   255, 64,  65,  66,  255, 243, 243, 243, 255, 255, 255, 255, 255, 254, 254,
-    254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 229, 135, 135, 255, 221, 61,  61,  255, 223, 87,
-    87,  255, 223, 82,  82,  255, 223, 85,  85,  255, 222, 70,  70,  255, 245, 215, 215, 255, 255, 255, 255, 255, 255, 255, 255, 255, 243, 208, 208, 255, 226,
-    113, 113, 255, 220, 32,  32,  255, 221, 44,  44,  255, 230, 138, 138, 255, 247, 225, 225, 255, 255, 255, 255, 255, 255, 255, 255, 255, 238, 187, 187, 255,
-    221, 52,  52,  255, 223, 88,  88,  255, 223, 81,  81,  255, 224, 89,  89,  255, 220, 41,  41,  255, 236, 172, 172, 255, 255, 255, 255, 255, 254, 253, 253,
-    255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 169, 169, 169, 255, 0,   0,   0,   255, 0,   0,   0,   255, 224, 224, 224, 255, 255, 255,
-    255, 255, 235, 235, 235, 255, 0,   0,   0,   255, 24,  25,  27,  255, 0,   0,   0,   255, 196, 196, 196, 255, 249, 249, 249, 255, 241, 241, 242, 255, 146,
-    146, 146, 255, 0,   0,   0,   255, 0,   0,   0,   255, 100, 101, 101, 255, 200, 200, 200, 255, 0,   0,   0,   255, 7,   11,  14,  255, 67,  68,  69,  255,
-    220, 220, 221, 255, 250, 250, 250, 255, 233, 233, 233, 255, 114, 114, 115, 255, 0,   0,   0,   255, 0,   0,   0,   255, 172, 172, 172, 255, 166, 166, 166,
-    255, 0,   0,   0,   255, 24,  26,  29,  255, 204, 204, 204, 255, 67,  67,  68,  255, 0,   0,   0,   255, 0,   0,   0,   255, 201, 202, 202, 255, 251, 251,
-    251, 255, 234, 235, 235, 255, 110, 110, 111, 255, 0,   0,   0,   255, 0,   0,   0,   255, 196, 196, 196, 255, 248, 248, 248, 255, 229, 229, 229, 255, 239,
-    239, 239, 255, 0,   0,   0,   255, 0,   0,   3,   255, 41,  43,  44,  255, 213, 213, 213, 255, 251, 251, 251, 255, 230, 231, 231, 255, 96,  97,  98,  255,
-    0,   0,   0,   255, 0,   0,   0,   255, 214, 214, 214, 255, 144, 144, 144, 255, 0,   0,   0,   255, 0,   0,   0,   255, 160, 161, 161, 255, 245, 245, 246,
-    255, 246, 246, 247, 255, 166, 166, 166, 255, 0,   0,   0,   255, 0,   0,   0,   255, 127, 127, 128, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 230, 136, 136, 255, 221, 60,  60,  255, 223, 87,
-    87,  255, 223, 82,  82,  255, 223, 83,  83,  255, 223, 79,  79,  255, 222, 74,  74,  255, 236, 174, 174, 255, 252, 244, 244, 255, 255, 255, 255, 255, 254,
-    251, 251, 255, 238, 186, 186, 255, 242, 201, 201, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 232, 232, 255, 232, 150, 150, 255, 221, 62,  62,  255,
-    223, 84,  84,  255, 223, 82,  82,  255, 223, 82,  82,  255, 223, 89,  89,  255, 220, 41,  41,  255, 236, 173, 173, 255, 255, 255, 255, 255, 254, 253, 253,
-    255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 171, 171, 171, 255, 0,   0,   0,   255, 0,   0,   0,   255, 226, 226, 226, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 155, 155, 155, 255, 0,   0,   0,   255, 46,  47,  48,  255, 0,   0,   0,   255, 77,  78,  79,  255, 54,  55,  56,  255, 0,
-    0,   0,   255, 33,  34,  35,  255, 0,   0,   2,   255, 82,  83,  83,  255, 245, 245, 245, 255, 113, 113, 114, 255, 0,   0,   0,   255, 27,  29,  30,  255,
-    0,   0,   0,   255, 85,  86,  87,  255, 23,  26,  28,  255, 0,   0,   0,   255, 53,  54,  55,  255, 0,   0,   0,   255, 174, 174, 174, 255, 168, 168, 169,
-    255, 0,   0,   0,   255, 0,   0,   0,   255, 232, 232, 232, 255, 179, 179, 180, 255, 0,   0,   0,   255, 37,  38,  40,  255, 0,   0,   0,   255, 81,  81,
-    82,  255, 29,  31,  33,  255, 0,   0,   0,   255, 0,   0,   0,   255, 92,  92,  93,  255, 232, 232, 232, 255, 86,  86,  87,  255, 0,   0,   0,   255, 209,
-    209, 209, 255, 179, 179, 179, 255, 0,   0,   0,   255, 27,  29,  30,  255, 0,   0,   0,   255, 84,  85,  86,  255, 12,  16,  19,  255, 0,   0,   1,   255,
-    0,   0,   0,   255, 127, 128, 128, 255, 255, 255, 255, 255, 217, 218, 218, 255, 0,   0,   0,   255, 11,  14,  16,  255, 0,   0,   0,   255, 62,  63,  64,
-    255, 65,  66,  67,  255, 0,   0,   0,   255, 8,   12,  14,  255, 0,   0,   0,   255, 218, 218, 218, 255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 229, 132, 132, 255, 222, 69,  69,  255, 223, 86,
-    86,  255, 223, 82,  82,  255, 223, 82,  82,  255, 223, 83,  83,  255, 223, 83,  83,  255, 220, 39,  39,  255, 224, 96,  96,  255, 240, 195, 195, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 246, 246, 255, 236, 175, 175, 255, 222, 71,  71,  255, 221, 52,  52,  255, 223, 86,  86,  255,
-    223, 82,  82,  255, 223, 82,  82,  255, 223, 81,  81,  255, 224, 90,  90,  255, 221, 51,  51,  255, 235, 170, 170, 255, 255, 255, 255, 255, 254, 253, 253,
-    255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 160, 160, 161, 255, 0,   0,   0,   255, 0,   0,   0,   255, 223, 223, 223, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 249, 249, 249, 255, 127, 128, 128, 255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 19,
-    22,  25,  255, 28,  31,  34,  255, 0,   0,   0,   255, 0,   0,   0,   255, 250, 250, 250, 255, 239, 239, 239, 255, 81,  82,  83,  255, 0,   0,   0,   255,
-    0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 93,  94,  94,  255, 0,   0,   0,   255, 0,   0,   0,   255, 165, 165, 165, 255, 157, 157, 158,
-    255, 0,   0,   0,   255, 0,   0,   0,   255, 222, 222, 222, 255, 255, 255, 255, 255, 150, 151, 151, 255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,
-    0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 76,  77,  78,  255, 239, 239, 239, 255, 232, 232, 232, 255, 0,   0,   0,   255, 0,   0,   0,   255, 170,
-    171, 171, 255, 255, 255, 255, 255, 150, 150, 151, 255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255,
-    124, 124, 125, 255, 246, 246, 246, 255, 255, 255, 255, 255, 255, 255, 255, 255, 199, 200, 200, 255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,
-    255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 199, 199, 199, 255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 255, 255, 255, 255, 255, 234, 162, 162, 255, 219, 0,   0,   255, 224, 93,
-    93,  255, 223, 86,  86,  255, 223, 81,  81,  255, 223, 82,  82,  255, 223, 83,  83,  255, 224, 90,  90,  255, 222, 76,  76,  255, 220, 29,  29,  255, 228,
-    125, 125, 255, 244, 213, 213, 255, 241, 200, 200, 255, 225, 98,  98,  255, 220, 35,  35,  255, 223, 83,  83,  255, 223, 89,  89,  255, 223, 82,  82,  255,
-    223, 82,  82,  255, 223, 82,  82,  255, 223, 88,  88,  255, 223, 89,  89,  255, 218, 0,   0,   255, 241, 200, 200, 255, 255, 255, 255, 255, 254, 253, 253,
-    255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 223, 224, 224, 255, 194, 195, 195, 255, 197, 197, 198, 255, 243, 243, 243, 255, 255, 255,
-    255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 204, 204, 205, 255, 156, 156, 156, 255, 142, 143, 143, 255, 158, 158, 159, 255, 223,
-    223, 223, 255, 219, 219, 219, 255, 193, 193, 193, 255, 204, 205, 205, 255, 250, 250, 250, 255, 255, 255, 255, 255, 248, 248, 248, 255, 191, 191, 191, 255,
-    149, 149, 149, 255, 143, 143, 144, 255, 184, 184, 184, 255, 242, 242, 242, 255, 206, 206, 206, 255, 191, 191, 192, 255, 225, 225, 225, 255, 223, 223, 223,
-    255, 194, 194, 194, 255, 197, 198, 198, 255, 241, 242, 242, 255, 255, 255, 255, 255, 255, 255, 255, 255, 218, 218, 219, 255, 166, 166, 167, 255, 143, 144,
-    144, 255, 152, 152, 153, 255, 195, 195, 195, 255, 249, 249, 249, 255, 255, 255, 255, 255, 255, 255, 255, 255, 199, 200, 200, 255, 168, 168, 168, 255, 245,
-    245, 246, 255, 255, 255, 255, 255, 255, 255, 255, 255, 217, 217, 218, 255, 164, 164, 164, 255, 142, 142, 143, 255, 157, 158, 158, 255, 206, 207, 207, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 254, 254, 254, 255, 255, 255, 255, 255, 235, 235, 235, 255, 179, 179, 180, 255, 146, 147, 147,
-    255, 147, 147, 147, 255, 178, 178, 179, 255, 234, 235, 235, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 255, 255, 255, 255, 255, 252, 245, 245, 255, 232, 152, 152, 255, 221, 44,
-    44,  255, 222, 65,  65,  255, 224, 90,  90,  255, 223, 84,  84,  255, 223, 82,  82,  255, 223, 81,  81,  255, 223, 85,  85,  255, 224, 90,  90,  255, 222,
-    64,  64,  255, 221, 47,  47,  255, 221, 45,  45,  255, 222, 73,  73,  255, 224, 90,  90,  255, 223, 83,  83,  255, 223, 81,  81,  255, 223, 82,  82,  255,
-    223, 86,  86,  255, 223, 89,  89,  255, 221, 53,  53,  255, 222, 64,  64,  255, 237, 180, 180, 255, 255, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254,
-    254, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 254, 254, 254, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 245, 216,
-    216, 255, 228, 124, 124, 255, 220, 30,  30,  255, 222, 77,  77,  255, 224, 90,  90,  255, 223, 82,  82,  255, 223, 82,  82,  255, 223, 81,  81,  255, 223,
-    86,  86,  255, 223, 88,  88,  255, 223, 88,  88,  255, 223, 85,  85,  255, 223, 82,  82,  255, 223, 81,  81,  255, 223, 84,  84,  255, 224, 90,  90,  255,
-    222, 67,  67,  255, 221, 41,  41,  255, 231, 148, 148, 255, 249, 231, 231, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 253, 253, 253, 255, 253, 253, 253, 255, 254, 254, 254, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 253, 253, 255, 253, 253, 253, 255, 254, 254, 254, 255, 253, 253, 253, 255, 253,
-    253, 253, 255, 253, 253, 253, 255, 253, 253, 253, 255, 253, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 253, 253, 253, 255,
-    254, 254, 254, 255, 254, 254, 254, 255, 253, 253, 253, 255, 254, 254, 254, 255, 253, 253, 253, 255, 253, 253, 253, 255, 254, 254, 254, 255, 254, 254, 254,
-    255, 253, 253, 253, 255, 253, 253, 253, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 253, 253, 255, 253, 253, 253, 255, 254, 254,
-    254, 255, 254, 254, 254, 255, 253, 253, 253, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 253, 253, 255, 253, 253, 253, 255, 254,
-    254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 253, 253, 255, 253, 253, 253, 255, 254, 254, 254, 255, 253, 253, 253, 255, 253, 253, 253, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 253, 253, 253, 255, 254, 254, 254,
-    255, 254, 254, 254, 255, 253, 253, 253, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 255, 255, 254, 254, 255, 255, 255,
-    255, 255, 255, 253, 253, 255, 240, 196, 196, 255, 224, 95,  95,  255, 220, 38,  38,  255, 223, 85,  85,  255, 223, 88,  88,  255, 223, 82,  82,  255, 223,
-    81,  81,  255, 223, 82,  82,  255, 223, 82,  82,  255, 223, 81,  81,  255, 223, 83,  83,  255, 224, 90,  90,  255, 222, 78,  78,  255, 220, 30,  30,  255,
-    227, 120, 120, 255, 245, 214, 214, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 253,
-    253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 243, 243, 255, 235, 172, 172, 255, 222, 65,  65,  255, 221, 54,  54,  255, 223, 89,  89,  255, 223,
-    86,  86,  255, 223, 81,  81,  255, 223, 81,  81,  255, 223, 88,  88,  255, 223, 85,  85,  255, 220, 38,  38,  255, 224, 91,  91,  255, 240, 193, 193, 255,
-    254, 252, 252, 255, 255, 255, 255, 255, 255, 254, 254, 255, 255, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 254, 254, 255, 254, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 248, 230, 230, 255, 231, 145, 145, 255, 221, 41,  41,  255, 222,
-    68,  68,  255, 224, 90,  90,  255, 223, 89,  89,  255, 221, 56,  56,  255, 222, 63,  63,  255, 235, 170, 170, 255, 252, 242, 242, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 254, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 255, 254, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 244, 212, 212, 255, 227,
-    118, 118, 255, 220, 37,  37,  255, 221, 47,  47,  255, 230, 142, 142, 255, 248, 228, 228, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 253, 253, 255,
-    255, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 253, 255, 255, 254, 254, 255, 255, 255, 255, 255, 254,
-    250, 250, 255, 244, 212, 212, 255, 246, 220, 220, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 253, 253, 255, 255, 254, 254, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 253, 253, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 254, 253, 253, 255, 254, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 232,
-    255, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 231,
-    255, 255, 255, 255, 255, 255, 255, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 233,
-    255, 255, 255, 223, 255, 255, 255, 255, 255, 255, 255, 249, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 252, 255, 255, 255, 252, 255, 255, 255,
-    253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 252, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255,
-    255, 253, 255, 255, 255, 252, 255, 255, 255, 252, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 252, 255,
-    255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 252, 255, 255, 255, 253,
-    255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255,
-    253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 252, 255, 255, 255, 253, 255, 255, 255, 252, 255, 255,
-    255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 252, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 252, 255,
-    255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 252, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253,
-    255, 255, 255, 252, 255, 255, 255, 252, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 252, 255, 255, 255,
-    253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 252, 255, 255, 255, 253, 255, 255, 255, 252, 255, 255,
-    255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 252, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255,
-    255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 252, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 252, 255, 255, 255, 252, 255, 255, 255, 253,
-    255, 255, 255, 252, 255, 255, 255, 252, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 252, 255, 255, 255,
-    253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 252, 255, 255,
-    255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 252, 255, 255, 255, 252, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 253, 255,
-    255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 252, 255, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 248, 255, 255, 255, 255, 255, 255, 255, 194,
-    255, 255, 255, 62,  255, 255, 255, 242, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 230, 255, 255, 255, 45,
-    0,   0,   0,   0,   255, 255, 255, 20,  255, 255, 255, 68,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255,
-    66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255,
-    255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255,
-    255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,
-    255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255,
-    66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255,
-    255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255,
-    255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,
-    255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255,
-    66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255,
-    255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255,
-    255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,
-    255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255,
-    66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255,
-    255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255,
-    255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 66,  255, 255, 255, 13,  0,   0,   0,   0};
+      0,   0, 135, 255,   0,   0, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 130, 255,   2, 254,
+    253, 254, 212, 255,   0, 253, 253, 255,   1, 254, 253, 189, 255,   0, 254, 207, 255,   2, 254, 255, 254, 188, 255,   4,
+    254, 255, 241, 210, 234, 213, 255,   9, 254, 222, 247, 255, 254, 255, 243, 225, 255, 254, 193, 255,  10, 253, 255, 221,
+     35, 102,  38, 212, 255, 252, 254, 255, 255, 254,   3, 255, 254, 253, 255, 255, 254, 255, 255, 255, 254,   1, 255, 253,
+    255, 255,   2, 253, 255, 254, 255, 255,   3, 253, 254, 255, 253, 255, 255, 255, 254, 255, 255,   1, 253, 255, 255, 254,
+     14, 255, 254, 253, 255, 251,  66, 226, 255, 252, 255, 208,  98, 255, 254, 253, 255, 255,   0, 254, 255, 255,   0, 254,
+    200, 255,   6, 254, 255, 116, 174, 255, 237, 245, 251, 255,   0, 253, 252, 255,   0, 253, 252, 255,   0, 254, 252, 255,
+      0, 254, 253, 255,   0, 254, 248, 255,   0, 253, 253, 255,   6, 102, 227, 255, 252, 255, 210, 125, 251, 255,   0, 254,
+    198, 255,   4, 253, 255, 174,  81, 229, 255, 255,  62, 252, 166, 148, 105, 131, 237, 255, 252, 168,  97, 127, 230, 255,
+    212, 143, 133,  97, 207, 255, 253, 178, 103, 137, 244, 255, 201, 105, 106, 202, 255, 239, 158, 139, 155, 255, 185, 110,
+    132, 232, 255, 251, 163,  95, 144,  68, 229, 255, 252, 255, 214,  71, 143,  91, 178, 255, 180, 196, 255, 253, 154, 227,
+    255, 254, 203, 255,  32, 254, 255, 253, 174,  34, 123, 243, 255,  61, 142, 233, 158,  87, 255, 164,  94, 231, 173,  53,
+    255, 194,   0, 215, 208,   0, 239, 223,   0, 233, 219, 255, 218,   0, 255, 212,  32,   0, 222, 244,   0, 170, 245, 201,
+     58, 231, 182,  72, 255, 163,  98, 230, 186,   0, 232, 255, 252, 255, 217,   0, 201, 224,  48, 197, 225,  19, 255, 217,
+     62, 252, 197, 255,   5, 250, 138, 131, 255, 101, 238, 255, 255,   3,  86, 221, 105, 230, 255, 255,   3,  99, 225, 200,
+    146, 255, 255,   8, 137, 193, 254, 116, 110, 199, 255, 151, 176, 255, 255,  13, 175, 161, 246,  85, 254, 255, 145,  93,
+    145, 134,  85, 229,  98, 231, 255, 255,   6,  98, 227, 255, 252, 255, 210, 123, 255, 255,   8, 216,  98, 255, 114, 199,
+    147, 185, 255, 252, 200, 255,  19, 200, 237, 255, 211,  73, 255,  94, 217, 255, 235,  35, 239, 114, 195, 255, 245,  38,
+    238, 198, 139, 255, 255,   8, 149, 190, 255, 249, 233,  44, 206, 189, 125, 255, 255,  22, 127, 183, 245,  85, 244, 255,
+    158, 146, 255, 246, 233, 255,  99, 196, 255, 247,  76, 229, 255, 252, 255, 213,  99, 255, 255,   8, 174, 125, 255, 217,
+      0,  90, 245, 255, 254, 200, 255,  19, 146,  46, 136,   0, 195, 255,  95,  67, 151,  43, 169, 255, 214,  17, 147,  74,
+    152, 255, 182, 131, 255, 255,   8, 132, 194, 234,  92, 181,  79, 216, 252,  84, 255, 122,  26,  89, 251, 236,  57, 247,
+    255, 239,  90, 156, 144, 133, 255, 214,   0, 143, 111,   0, 230, 255, 252, 255, 215,   0, 126, 134,  34, 228, 255, 255,
+      3,  97, 164, 255, 253, 201, 255,   0, 254, 255, 255,  14, 221, 190, 223, 255, 253, 110, 205, 198, 217, 255, 254, 255,
+    235, 190, 215, 255, 255,   1, 236, 227, 255, 255,   5, 228, 237, 255, 219, 185, 225, 255, 255,   0, 249, 255, 199,  10,
+    249, 255, 248, 221, 253, 254, 255, 246, 195, 199, 245, 255, 255,  12, 234, 190, 219, 222, 246, 255, 254, 255, 243, 223,
+    214, 191, 241, 255, 255,   4, 247,  81, 233, 255, 254, 199, 255,   0, 254, 253, 255,   2, 253,  80, 232, 255, 255,   2,
+    254, 255, 254, 253, 255,   0, 254, 255, 255, 255, 254, 251, 255, 255, 254, 253, 255,   0, 253, 253, 255,   0, 254, 252,
+    255,   0, 254, 252, 255,   2, 254, 255, 254, 252, 255,   5, 251, 255, 175, 124, 255, 253, 197, 255, 254, 253,   5, 255,
+    254, 145, 232, 255, 252, 254, 255,   0, 254, 255, 253, 255, 255, 255, 254, 255, 255, 255, 254,   0, 255, 254, 253, 255,
+    255,   0, 254, 255, 253,   0, 254, 255, 255,   0, 253, 254, 255,   0, 254, 255, 253,   0, 254, 255, 255,   0, 254, 254,
+    253, 253, 255,   0, 254, 254, 253,   0, 254, 255, 255,   3, 142, 220, 255, 253, 205, 255,   0, 254, 255, 255,   0, 254,
+    194, 255,   0, 254, 255, 255,   0, 254, 203, 255,   1, 252, 253, 191, 255,   0, 254, 206, 255,   0, 254, 255, 255,   3,
+    241, 224, 226, 245, 255, 255,   0, 254, 145, 255,   0, 254, 254, 255,   0, 252, 255, 222,   1, 220, 228, 253, 255,   0,
+    254, 149, 255,   0, 254, 255, 255,  11, 247, 237, 255, 252, 224, 223, 222, 229, 255, 251, 237, 251, 255, 255,   0, 254,
+    153, 255,   0, 254, 255, 255,  15, 252, 235, 221, 223, 254, 252, 224, 223, 222, 228, 255, 248, 219, 224, 240, 254, 151,
+    255,  18, 254, 240, 224, 221, 222, 226, 254, 252, 224, 223, 222, 228, 255, 248, 222, 223, 220, 227, 244, 225, 255,   5,
+    254, 253, 254, 255, 253, 254, 191, 255,  21, 245, 227, 220, 222, 224, 222, 225, 254, 252, 224, 223, 222, 228, 255, 248,
+    221, 223, 224, 222, 221, 231, 249, 221, 255,   0, 254, 195, 255,   5, 254, 255, 241, 219, 222, 224, 255, 223,  10, 222,
+    225, 254, 252, 224, 223, 222, 228, 255, 248, 222, 253, 223,   2, 221, 222, 248, 229, 255,   8, 250, 231, 230, 242, 255,
+    212, 233, 255, 254, 194, 255,   2, 229, 221, 224, 253, 223,  10, 225, 253, 252, 224, 223, 222, 228, 255, 248, 221, 224,
+    254, 223,   4, 224, 220, 236, 255, 254, 254, 255, 254, 254,   2, 255, 253, 254, 255, 255,   0, 254, 254, 253, 253, 254,
+    254, 255,   4, 254, 253, 252, 255, 228, 255,   0,   5, 172, 193,   0,  47, 239, 255, 255, 254, 254, 253,   0, 254, 249,
+    255,   0, 254, 254, 253,   0, 254, 251, 255, 253, 253, 223, 255,   1, 229, 221, 253, 223,  11, 220, 227, 254, 252, 224,
+    223, 222, 229, 255, 249, 222, 221, 253, 223,   3, 221, 236, 255, 254, 248, 255,   1, 254, 253, 248, 255,   1, 254, 253,
+    253, 255,   0, 227, 255,   0,   1, 175, 184, 255,   0,   2, 234, 255, 252, 252, 255,   1, 253, 254, 252, 255,   0, 253,
+    252, 255,   0, 253, 254, 255, 255, 254, 253, 255, 255, 254, 225, 255,   1, 229, 221, 254, 223,  13, 222, 234, 252, 255,
+    249, 222, 223, 222, 226, 254, 255, 249, 229, 222, 255, 223,   4, 224, 220, 236, 255, 254, 254, 255,   5, 250, 246, 247,
+    255, 221, 236, 255, 255,   3, 247, 217, 208, 218, 255, 252,   2, 245, 247, 254, 255, 255,   4, 239, 214, 211, 243, 235,
+    255,   0,  11, 166, 251, 170, 206, 255, 253, 255, 253, 224, 212, 216, 242, 255, 255,   0, 254, 254, 255,  10, 254, 255,
+    251, 221, 211, 220, 248, 255, 254, 255, 254, 255, 255,   0, 232, 255, 213,   0, 232, 255, 255,   0, 253, 226, 255,   1,
+    229, 221, 254, 223,   5, 224, 253, 255, 244, 226, 222, 255, 223,   5, 222, 229, 247, 255, 246, 221, 255, 223,  16, 224,
+    220, 236, 255, 254, 255, 253, 255, 176,   0,  94, 145,   0, 191, 255, 198,  61, 254,   0,   6, 124, 126,  30,  98, 247,
+    255, 172, 254,   0,  11,  57, 146,  47,   0, 171, 176,  76,  86, 223, 255, 215,  96, 254,   0,   1,  44, 175, 255, 255,
+      5, 254, 255, 254, 255, 210,  84, 254,   0,   6,  71, 197, 255, 253, 255, 241, 136, 253,   0,   3, 135, 240, 255, 253,
+    227, 255,   1, 229, 221, 254, 223,   4, 224, 252, 253, 222, 221, 254, 223,   5, 224, 220, 228, 255, 246, 221, 255, 223,
+     10, 224, 220, 236, 255, 254, 255, 253, 255, 167,   0,   6, 255,   0,   1, 202, 215, 249,   0,   4,  52, 252, 172,   0,
+     22, 253,   0,   3,  42,   0, 173, 163, 255,   0,   1, 230, 224, 250,   0,   5, 154, 255, 254, 253, 255, 208, 250,   0,
+      3, 189, 255, 243,  82, 251,   0,   3,  77, 244, 255, 254, 228, 255,   1, 229, 221, 254, 223,   3, 224, 252, 253, 224,
+    252, 223,   4, 222, 229, 255, 246, 221, 255, 223,  14, 224, 220, 236, 255, 254, 255, 253, 255, 169,   0,  29,  57, 153,
+    221,  92, 255,   0,   3, 131, 210, 191,  71, 255,   0,  12,  95, 219,   0,  30,   0, 158, 213, 179,  35,  25,   0, 172,
+    166, 255,   0,   1, 220, 111, 255,   0,   6, 135, 211, 180,  11,  39,   0, 214, 255, 255,   1, 248,  69, 255,   0,   2,
+    148, 213, 176, 254,   0,  12, 238, 175,   0,  17,  85, 200, 201,  88,  12,   0, 162, 255, 253, 228, 255,   1, 229, 221,
+    254, 223,   4, 224, 252, 253, 224, 222, 253, 223,   4, 221, 229, 255, 246, 221, 255, 223,   8, 224, 220, 236, 255, 254,
+    255, 253, 255, 169, 255,   0,   2, 196, 255, 223, 255,   0,   0, 115, 254, 255,   0, 222, 255,   0,   1, 105, 172, 255,
+      0,   0, 165, 254, 255,   0, 200, 255,   0,   7, 172, 166,   0,  52, 182,  38,   0, 120, 254, 255,   0, 193, 255,   0,
+      0, 157, 255, 255,   0, 212, 255,   0,   0, 136, 254, 255,   7, 204, 151, 154, 211, 108,   0,  29, 233, 255, 255,   6,
+    234,  35,   0,  82, 249, 255, 254, 229, 255,   1, 229, 221, 254, 223,   0, 224, 255, 252, 252, 223,   5, 224, 221, 227,
+    255, 246, 221, 255, 223,   8, 224, 220, 236, 255, 254, 255, 253, 255, 169, 255,   0,   2, 225, 255, 200, 255,   0,   8,
+    184, 255, 249, 252, 254, 100,   0, 104, 147, 255,   0,  21, 220, 255, 249, 255, 244,  62,   0, 173, 166,   0,  63, 157,
+     20,   0, 187, 255, 248, 255, 240,  33,   0, 133, 255, 255,   0, 196, 255,   0,   3, 201, 255, 249, 251, 254, 255,  13,
+    247,  45,   0, 125, 255, 251, 250, 255, 127,   0,  46, 238, 255, 254, 229, 255,   1, 229, 221, 255, 223,   8, 222, 224,
+    253, 255, 232, 220, 222, 224, 223, 255, 221,   3, 237, 255, 247, 221, 255, 223,   8, 224, 220, 236, 255, 254, 255, 253,
+    255, 169, 255,   0,   2, 222, 255, 209, 255,   0,   0, 154, 254, 255,   4, 244,  57,   0, 105, 160, 255,   0,   4, 198,
+    255, 254, 255, 227, 255,   0,  11, 173, 166,   0,  60, 167,  26,   0, 158, 255, 254, 255, 224, 255,   0,   0, 142, 255,
+    255,   0, 203, 255,   0,   0, 176, 254, 255,   7, 241, 215, 221, 224,  80,   0,  86, 252, 255, 255,   6, 254,  92,   0,
+     64, 243, 255, 254, 229, 255,   1, 229, 221, 254, 223,   1, 222, 245, 255, 255,   5, 243, 226, 220, 221, 230, 247, 255,
+    255,   1, 238, 221, 255, 223,   8, 224, 220, 236, 255, 254, 255, 253, 255, 169, 255,   0,   9, 224, 255, 235,   0,  24,
+      0, 196, 249, 241, 146, 255,   0,   8, 100, 200,   0,   7,  67, 220, 250, 233, 114, 255,   0,   5, 172, 166,   0,  24,
+    204,  67, 255,   0,   3, 201, 251, 234, 110, 255,   0,   3, 196, 248, 229, 239, 255,   0,   4,  41, 213, 251, 230,  96,
+    255,   0,   1, 214, 144, 255,   0,   3, 160, 245, 246, 166, 255,   0,   2, 127, 255, 254, 228, 255,   1, 230, 221, 253,
+    223,   6, 222, 236, 252, 255, 254, 238, 242, 255, 255,   2, 249, 232, 221, 253, 223,   7, 220, 236, 255, 254, 255, 253,
+    255, 171, 255,   0,   0, 226, 255, 255,  21, 155,   0,  46,   0,  77,  54,   0,  33,   0,  82, 245, 113,   0,  27,   0,
+     85,  23,   0,  53,   0, 174, 168, 255,   0,   6, 232, 179,   0,  37,   0,  81,  29, 255,   0,  10,  92, 232,  86,   0,
+    209, 179,   0,  27,   0,  84,  12, 255,   0,  13, 127, 255, 217,   0,  11,   0,  62,  65,   0,   8,   0, 218, 255, 253,
+    228, 255,   1, 229, 222, 252, 223,   2, 220, 224, 240, 254, 255,   3, 253, 236, 222, 221, 253, 223,   8, 224, 221, 235,
+    255, 254, 255, 253, 255, 160, 255,   0,   0, 223, 255, 255,   1, 249, 127, 253,   0,   1,  19,  28, 255,   0,   2, 250,
+    239,  81, 253,   0,   0,  93, 255,   0,   1, 165, 157, 255,   0,   2, 222, 255, 150, 252,   0,   2,  76, 239, 232, 255,
+      0,   2, 170, 255, 150, 252,   0,   1, 124, 246, 255, 255,   0, 199, 251,   0,   2, 199, 255, 253, 227, 255,   2, 234,
+    219, 224, 253, 223,   7, 224, 222, 220, 228, 244, 241, 225, 220, 250, 223,  12, 218, 241, 255, 254, 255, 254, 255, 223,
+    194, 197, 243, 255, 253, 255, 255,  22, 204, 156, 142, 158, 223, 219, 193, 204, 250, 255, 248, 191, 149, 143, 184, 242,
+    206, 191, 225, 223, 194, 197, 241, 255, 255,   5, 218, 166, 143, 152, 195, 249, 255, 255,   2, 199, 168, 245, 255, 255,
+      4, 217, 164, 142, 157, 206, 255, 255, 255, 254,   8, 255, 235, 179, 146, 147, 178, 234, 255, 254, 226, 255,   4, 252,
+    232, 221, 222, 224, 253, 223,   1, 224, 222, 255, 221,   1, 222, 224, 252, 223,   2, 221, 222, 237, 252, 255,   0, 254,
+    253, 255,   2, 254, 255, 254, 247, 255,   0, 253, 244, 255, 255, 254, 251, 255,   0, 253, 253, 255, 255, 254, 251, 255,
+      0, 254, 255, 255,   0, 253, 251, 255,   0, 253, 223, 255,   4, 245, 228, 220, 222, 224, 247, 223,   4, 224, 222, 221,
+    231, 249, 250, 255,   0, 254, 255, 253,   0, 254, 253, 255, 255, 253,   0, 254, 252, 253, 255, 255,   1, 254, 253, 255,
+    254,   1, 253, 254, 255, 253, 255, 254, 255, 253,   0, 254, 255, 255, 255, 253, 255, 254,   1, 253, 254, 255, 255, 255,
+    253,   0, 254, 255, 255, 255, 253,   0, 254, 255, 253, 252, 255,   1, 254, 253, 255, 254,   1, 253, 254, 220, 255,   2,
+    240, 224, 220, 249, 223,   4, 224, 222, 220, 227, 245, 255, 255,   0, 254, 154, 255,   0, 254, 255, 255,   3, 252, 235,
+    222, 221, 251, 223,   3, 220, 224, 240, 254, 148, 255,   0, 254, 255, 255,   9, 248, 231, 221, 222, 224, 223, 221, 222,
+    235, 252, 255, 255,   0, 254, 147, 255,   0, 254, 255, 255,   5, 244, 227, 220, 221, 230, 248, 255, 255,   0, 254, 141,
+    255,   2, 254, 244, 246, 255, 255,   0, 254, 140, 255,   0, 254, 253, 255,   0, 254, 137, 255, 255, 254, 129, 255, 129,
+    255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 187, 255,   0,   0, 135, 255,   0,   0,   0,   0, 135, 255,   0,
+      0, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 130, 255,   2, 254, 253, 254, 212, 255,   0,
+    253, 253, 255,   1, 254, 253, 189, 255,   0, 254, 207, 255,   2, 254, 255, 254, 188, 255,   4, 254, 255, 241, 210, 234,
+    213, 255,   9, 254, 222, 247, 255, 254, 255, 243, 225, 255, 254, 193, 255,  10, 253, 255, 221,  35, 102,  38, 212, 255,
+    252, 254, 255, 255, 254,   3, 255, 254, 253, 255, 255, 254, 255, 255, 255, 254,   1, 255, 253, 255, 255,   2, 253, 255,
+    254, 255, 255,   3, 253, 254, 255, 253, 255, 255, 255, 254, 255, 255,   1, 253, 255, 255, 254,  14, 255, 254, 253, 255,
+    251,  66, 226, 255, 252, 255, 208,  98, 255, 254, 253, 255, 255,   0, 254, 255, 255,   0, 254, 200, 255,   6, 254, 255,
+    116, 174, 255, 237, 245, 251, 255,   0, 253, 252, 255,   0, 253, 252, 255,   0, 254, 252, 255,   0, 254, 253, 255,   0,
+    254, 248, 255,   0, 253, 253, 255,   6, 102, 227, 255, 252, 255, 210, 125, 251, 255,   0, 254, 198, 255,   4, 253, 255,
+    174,  81, 229, 255, 255,  62, 252, 166, 148, 105, 131, 237, 255, 252, 168,  97, 127, 230, 255, 212, 143, 133,  97, 207,
+    255, 253, 178, 103, 137, 244, 255, 201, 105, 106, 202, 255, 239, 158, 139, 155, 255, 185, 110, 132, 232, 255, 251, 163,
+     95, 144,  68, 229, 255, 252, 255, 214,  71, 143,  91, 178, 255, 180, 196, 255, 253, 154, 227, 255, 254, 203, 255,  32,
+    254, 255, 253, 174,  34, 123, 243, 255,  61, 142, 233, 158,  87, 255, 164,  94, 231, 173,  53, 255, 194,   0, 215, 208,
+      0, 239, 223,   0, 233, 219, 255, 218,   0, 255, 212,  32,   0, 222, 244,   0, 170, 245, 201,  58, 231, 182,  72, 255,
+    163,  98, 230, 186,   0, 232, 255, 252, 255, 217,   0, 201, 224,  48, 197, 225,  19, 255, 217,  62, 252, 197, 255,   5,
+    250, 138, 131, 255, 101, 238, 255, 255,   3,  86, 221, 105, 230, 255, 255,   3,  99, 225, 200, 146, 255, 255,   8, 137,
+    193, 254, 116, 110, 199, 255, 151, 176, 255, 255,  13, 175, 161, 246,  85, 254, 255, 145,  93, 145, 134,  85, 229,  98,
+    231, 255, 255,   6,  98, 227, 255, 252, 255, 210, 123, 255, 255,   8, 216,  98, 255, 114, 199, 147, 185, 255, 252, 200,
+    255,  19, 200, 237, 255, 211,  73, 255,  94, 217, 255, 235,  35, 239, 114, 195, 255, 245,  38, 238, 198, 139, 255, 255,
+      8, 149, 190, 255, 249, 233,  44, 206, 189, 125, 255, 255,  22, 127, 183, 245,  85, 244, 255, 158, 146, 255, 246, 233,
+    255,  99, 196, 255, 247,  76, 229, 255, 252, 255, 213,  99, 255, 255,   8, 174, 125, 255, 217,   0,  90, 245, 255, 254,
+    200, 255,  19, 146,  46, 136,   0, 195, 255,  95,  67, 151,  43, 169, 255, 214,  17, 147,  74, 152, 255, 182, 131, 255,
+    255,   8, 132, 194, 234,  92, 181,  79, 216, 252,  84, 255, 122,  26,  89, 251, 236,  57, 247, 255, 239,  90, 156, 144,
+    133, 255, 214,   0, 143, 111,   0, 230, 255, 252, 255, 215,   0, 126, 134,  34, 228, 255, 255,   3,  97, 164, 255, 253,
+    201, 255,   0, 254, 255, 255,  14, 221, 190, 223, 255, 253, 110, 205, 198, 217, 255, 254, 255, 235, 190, 215, 255, 255,
+      1, 236, 227, 255, 255,   5, 228, 237, 255, 219, 185, 225, 255, 255,   0, 249, 255, 199,  10, 249, 255, 248, 221, 253,
+    254, 255, 246, 195, 199, 245, 255, 255,  12, 234, 190, 219, 222, 246, 255, 254, 255, 243, 223, 214, 191, 241, 255, 255,
+      4, 247,  81, 233, 255, 254, 199, 255,   0, 254, 253, 255,   2, 253,  80, 232, 255, 255,   2, 254, 255, 254, 253, 255,
+      0, 254, 255, 255, 255, 254, 251, 255, 255, 254, 253, 255,   0, 253, 253, 255,   0, 254, 252, 255,   0, 254, 252, 255,
+      2, 254, 255, 254, 252, 255,   5, 251, 255, 175, 124, 255, 253, 204, 255, 255, 254, 252, 255, 254, 253,   5, 255, 254,
+    145, 232, 255, 252, 254, 255,   0, 254, 255, 253, 255, 255, 255, 254, 255, 255, 255, 254,   0, 255, 254, 253, 255, 255,
+      0, 254, 255, 253,   0, 254, 255, 255,   0, 253, 254, 255,   0, 254, 255, 253,   0, 254, 255, 255,   0, 254, 254, 253,
+    253, 255,   0, 254, 254, 253,   0, 254, 255, 255,   3, 142, 220, 255, 253, 205, 255,   0, 253, 255, 255,   0, 253, 194,
+    255,   0, 254, 255, 255,   0, 254, 203, 255,   3, 243, 248, 255, 254, 193, 255,   0, 254, 207, 255,   1, 254, 253, 255,
+    255,   7, 197,  87, 110, 218, 255, 254, 253, 254, 147, 255,   1, 254, 253, 254, 255,   4, 243,  71,  77,  44, 124, 253,
+    255,   1, 253, 254, 150, 255,   0, 253, 255, 255,  11, 225, 181, 255, 244,  97,  84,  70, 132, 255, 241, 178, 240, 255,
+    255,   0, 253, 153, 255,   0, 253, 255, 255,  18, 243, 172,  55,  74, 249, 246,  91,  82,  65, 129, 255, 229,   0,  93,
+    192, 252, 255, 254, 253, 156, 255,  20, 254, 255, 253, 195,  93,  43,  78, 107, 250, 245,  91,  83,  65, 129, 255, 231,
+     75,  81,  31, 119, 213, 255, 255,   0, 254, 228, 255,   5, 254, 253, 254, 255, 253, 254, 191, 255,  23, 217, 122,  31,
+     78,  92,  75, 101, 250, 246,  91,  83,  65, 129, 255, 230,  63,  86,  91,  68,  42, 147, 233, 255, 254, 223, 255,   0,
+    254, 195, 255,  27, 253, 255, 200,   0,  70,  90,  84,  83,  74, 103, 250, 245,  91,  83,  65, 129, 255, 231,  65,  84,
+     81,  86,  89,  53,  63, 227, 255, 254, 231, 255,   8, 250, 232, 230, 242, 255, 212, 233, 255, 254, 194, 255,  25, 132,
+     63,  91,  81,  82,  84,  81,  97, 249, 245,  90,  83,  66, 128, 255, 229,  61,  90,  81,  82,  81,  96,  31, 174, 255,
+    253, 254, 255, 254, 254,   2, 255, 253, 254, 255, 255,   0, 254, 254, 253, 253, 254, 254, 255,   4, 254, 253, 252, 255,
+    228, 255,   0,   5, 172, 193,   0,  48, 239, 255, 255, 254, 254, 253,   0, 254, 249, 255,   0, 254, 254, 253,   0, 254,
+    251, 255, 253, 253, 223, 255,   2, 136,  63,  86, 255,  82,  20,  86,  27, 118, 252, 246,  94,  82,  64, 133, 255, 235,
+     70,  59,  86,  81,  82,  88,  46, 172, 255, 254, 248, 255,   1, 254, 253, 248, 255,   1, 254, 253, 253, 255,   0, 227,
+    255,   0,   1, 175, 184, 255,   0,   2, 234, 255, 252, 252, 255,   1, 253, 254, 252, 255,   0, 253, 252, 255,   0, 253,
+    254, 255, 255, 254, 253, 255, 255, 254, 225, 255,  25, 135,  61,  87,  82,  86,  67, 167, 245, 255, 231,  73,  87,  72,
+    114, 251, 255, 234, 138,  68,  86,  81,  89,  41, 173, 255, 253, 254, 255,   5, 250, 246, 247, 255, 221, 236, 255, 255,
+      3, 247, 217, 208, 218, 255, 252,   2, 245, 247, 254, 255, 255,   4, 239, 214, 211, 243, 235, 255,   0,  11, 166, 251,
+    170, 206, 255, 253, 255, 253, 224, 212, 216, 242, 255, 255,   0, 254, 254, 255,  10, 254, 255, 251, 221, 212, 220, 248,
+    255, 254, 255, 254, 255, 255,   0, 233, 255, 213,   0, 232, 255, 255,   0, 253, 226, 255,  37, 135,  61,  87,  83,  80,
+     85, 245, 255, 211, 110,  74,  84,  85,  70, 135, 227, 255, 222,  44,  88,  81,  89,  41, 172, 255, 253, 255, 253, 255,
+    176,   0,  95, 146,   0, 191, 255, 198,  62, 254,   0,   6, 124, 127,  31,  99, 247, 255, 172, 254,   0,  11,  58, 147,
+     48,   0, 171, 177,  77,  87, 223, 255, 215,  97, 254,   0,   1,  45, 175, 255, 255,   5, 254, 255, 254, 255, 210,  85,
+    254,   0,   6,  72, 197, 255, 253, 255, 241, 137, 253,   0,   3, 135, 240, 255, 253, 227, 255,  10, 135,  61,  87,  83,
+     79,  90, 243, 246,  69,  62,  87, 255,  81,  18,  90,   8, 126, 255, 220,  52,  87,  81,  89,  41, 172, 255, 253, 255,
+    253, 255, 167,   0,  10, 255,   0,   1, 202, 215, 249,   0,   4,  53, 252, 172,   0,  24, 253,   0,   3,  44,   0, 173,
+    163, 255,   0,   1, 230, 224, 250,   0,   5, 154, 255, 254, 253, 255, 208, 250,   0,   3, 189, 255, 243,  83, 251,   0,
+      3,  78, 244, 255, 254, 228, 255,  10, 135,  61,  87,  83,  79,  88, 245, 246,  95,  82,  83, 255,  82,  22,  87,  68,
+    134, 255, 221,  50,  87,  81,  89,  41, 172, 255, 253, 255, 253, 255, 169,   0,  31,  58, 154, 221,  93, 255,   0,   3,
+    131, 210, 192,  72, 255,   0,  12,  96, 219,   0,  32,   0, 159, 213, 179,  36,  27,   0, 172, 167, 255,   0,   1, 220,
+    111, 255,   0,   6, 135, 211, 180,  15,  40,   0, 214, 255, 255,   1, 248,  70, 255,   0,   2, 148, 213, 176, 254,   0,
+     12, 238, 175,   0,  20,  85, 200, 201,  89,  15,   0, 162, 255, 253, 228, 255,  10, 135,  61,  87,  83,  79,  88, 245,
+    247,  95,  77,  84, 255,  82,  16,  87,  61, 136, 255, 221,  51,  87,  81,  89,  41, 172, 255, 253, 255, 253, 255, 169,
+    255,   0,   2, 197, 255, 223, 255,   0,   0, 116, 254, 255,   0, 222, 255,   0,   1, 105, 172, 255,   0,   0, 165, 254,
+    255,   0, 200, 255,   0,   7, 172, 166,   0,  53, 182,  40,   0, 120, 254, 255,   0, 194, 255,   0,   0, 157, 255, 255,
+      0, 212, 255,   0,   0, 137, 254, 255,   7, 204, 152, 154, 212, 109,   0,  31, 233, 255, 255,   6, 234,  37,   0,  83,
+    249, 255, 254, 229, 255,  10, 135,  61,  87,  83,  79,  88, 244, 245,  72,  84,  88, 255,  81,  16,  93,  61, 122, 255,
+    220,  51,  87,  81,  89,  41, 172, 255, 253, 255, 253, 255, 169, 255,   0,   2, 225, 255, 200, 255,   0,   8, 185, 255,
+    249, 252, 254, 101,   0, 104, 148, 255,   0,  21, 221, 255, 249, 255, 244,  63,   0, 174, 167,   0,  64, 158,  22,   0,
+    187, 255, 248, 255, 240,  35,   0, 134, 255, 255,   0, 196, 255,   0,   3, 201, 255, 249, 251, 254, 255,  13, 247,  46,
+      0, 125, 255, 251, 250, 255, 127,   0,  48, 238, 255, 254, 229, 255,  29, 135,  61,  87,  83,  78,  91, 246, 254, 149,
+     26,  71,  91,  89,  61,  42, 180, 255, 224,  50,  88,  81,  89,  41, 172, 255, 253, 255, 253, 255, 169, 255,   0,   2,
+    222, 255, 209, 255,   0,   0, 154, 254, 255,   4, 244,  59,   0, 105, 160, 255,   0,   4, 198, 255, 254, 255, 227, 255,
+      0,  11, 173, 167,   0,  61, 167,  28,   0, 159, 255, 254, 255, 224, 255,   0,   0, 142, 255, 255,   0, 203, 255,   0,
+      0, 176, 254, 255,   7, 241, 215, 221, 225,  81,   0,  87, 252, 255, 255,   6, 254,  93,   0,  65, 243, 255, 254, 229,
+    255,   6, 135,  61,  87,  82,  85,  70, 215, 255, 255,   5, 208, 113,  32,  44, 138, 225, 255, 255,  12, 187,  52,  88,
+     81,  89,  41, 172, 255, 253, 255, 253, 255, 169, 255,   0,   9, 224, 255, 235,   0,  25,   0, 196, 249, 241, 146, 255,
+      0,   8, 101, 200,   0,  11,  68, 220, 250, 233, 114, 255,   0,   5, 172, 166,   0,  26, 204,  67, 255,   0,   3, 202,
+    251, 235, 110, 255,   0,   3, 196, 248, 229, 239, 255,   0,   4,  43, 213, 251, 231,  97, 255,   0,   1, 214, 144, 255,
+      0,   3, 161, 245, 246, 166, 255,   0,   2, 127, 255, 254, 228, 255,  12, 136,  60,  87,  82,  83,  79,  74, 174, 244,
+    255, 251, 186, 201, 255, 255,   3, 232, 150,  62,  84, 255,  82,   8,  89,  41, 173, 255, 253, 255, 253, 255, 171, 255,
+      0,   0, 226, 255, 255,  21, 155,   0,  47,   0,  78,  55,   0,  34,   0,  83, 245, 113,   0,  29,   0,  86,  26,   0,
+     54,   0, 174, 168, 255,   0,   6, 232, 179,   0,  38,   0,  81,  31, 255,   0,  10,  92, 232,  86,   0, 209, 179,   0,
+     29,   0,  85,  16, 255,   0,  13, 128, 255, 218,   0,  14,   0,  63,  66,   0,  12,   0, 218, 255, 253, 231, 255,   0,
+    254, 255, 255,   2, 132,  69,  86, 255,  82, 255,  83,   2,  39,  96, 195, 254, 255,   4, 246, 175,  71,  52,  86, 255,
+     82,   9,  81,  90,  51, 170, 255, 253, 255, 253, 255, 160, 255,   0,   0, 223, 255, 255,   1, 249, 128, 253,   0,   1,
+     22,  31, 255,   0,   2, 250, 239,  82, 253,   0,   0,  94, 255,   0,   1, 165, 157, 255,   0,   2, 222, 255, 151, 252,
+      0,   2,  77, 239, 232, 255,   0,   2, 171, 255, 150, 252,   0,   1, 124, 246, 255, 255,   0, 200, 251,   0,   2, 199,
+    255, 253, 229, 255,  18, 254, 255, 162,   0,  93,  86,  81,  82,  83,  90,  76,  29, 125, 213, 200,  98,  35,  83,  89,
+    254,  82,  14,  88,  89,   0, 200, 255, 253, 255, 254, 255, 224, 195, 197, 243, 255, 253, 255, 255,  22, 204, 156, 143,
+    158, 223, 219, 193, 205, 250, 255, 248, 191, 149, 143, 184, 242, 206, 191, 225, 223, 194, 198, 242, 255, 255,   5, 218,
+    166, 144, 152, 195, 249, 255, 255,   2, 200, 168, 245, 255, 255,   4, 217, 164, 142, 158, 207, 255, 255, 255, 254,   2,
+    255, 235, 179, 255, 147,   3, 178, 235, 255, 254, 228, 255,  25, 254, 255, 245, 152,  44,  65,  90,  84,  82,  81,  85,
+     90,  64,  47,  45,  73,  90,  83,  81,  82,  86,  89,  53,  64, 180, 254, 253, 255,   0, 254, 253, 255,   2, 254, 255,
+    254, 247, 255,   0, 253, 244, 255, 255, 254, 251, 255,   0, 253, 253, 255, 255, 254, 251, 255,   0, 254, 255, 255,   0,
+    253, 251, 255,   0, 253, 226, 255,   0, 254, 255, 255,   4, 216, 124,  30,  77,  90, 255,  82,   1,  81,  86, 255,  88,
+      8,  85,  82,  81,  84,  90,  67,  41, 148, 231, 255, 255,   0, 254, 253, 255,   0, 254, 255, 253,   0, 254, 253, 255,
+    255, 253,   0, 254, 252, 253, 255, 255,   1, 254, 253, 255, 254,   1, 253, 254, 255, 253, 255, 254, 255, 253,   0, 254,
+    255, 255, 255, 253, 255, 254,   1, 253, 254, 255, 255, 255, 253,   0, 254, 255, 255, 255, 253,   0, 254, 255, 253, 252,
+    255,   1, 254, 253, 255, 254,   1, 253, 254, 224, 255, 255, 254,   8, 255, 253, 196,  95,  38,  85,  88,  82,  81, 255,
+     82,   6,  81,  83,  90,  78,  30, 120, 214, 255, 255,   0, 253, 154, 255,   0, 253, 255, 255,   5, 243, 172,  65,  54,
+     89,  86, 255,  81,   8,  88,  85,  38,  91, 193, 252, 255, 254, 253, 152, 255,   1, 254, 253, 255, 255,   9, 230, 145,
+     41,  68,  90,  89,  56,  63, 170, 242, 255, 255,   0, 253, 148, 255,   1, 254, 253, 255, 255,   5, 212, 118,  37,  47,
+    142, 228, 255, 255,   1, 253, 254, 145, 255,   5, 253, 254, 255, 250, 212, 220, 255, 255,   1, 253, 254, 141, 255,   0,
+    253, 253, 255,   0, 253, 137, 255, 255, 253, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 187,
+    255,   0,   0, 135, 255,   0,   0,   0,   0, 135, 255,   0,   0, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129,
+    255, 129, 255, 130, 255,   2, 254, 253, 254, 212, 255,   0, 253, 253, 255,   1, 254, 253, 189, 255,   0, 254, 207, 255,
+      2, 254, 255, 254, 188, 255,   4, 254, 255, 241, 210, 234, 213, 255,   9, 254, 222, 247, 255, 254, 255, 243, 225, 255,
+    254, 193, 255,  10, 253, 255, 221,  35, 102,  38, 212, 255, 252, 254, 255, 255, 254,   3, 255, 254, 253, 255, 255, 254,
+    255, 255, 255, 254,   1, 255, 253, 255, 255,   2, 253, 255, 254, 255, 255,   3, 253, 254, 255, 253, 255, 255, 255, 254,
+    255, 255,   1, 253, 255, 255, 254,  14, 255, 254, 253, 255, 251,  66, 226, 255, 252, 255, 208,  98, 255, 254, 253, 255,
+    255,   0, 254, 255, 255,   0, 254, 200, 255,   6, 254, 255, 116, 174, 255, 237, 245, 251, 255,   0, 253, 252, 255,   0,
+    253, 252, 255,   0, 254, 252, 255,   0, 254, 253, 255,   0, 254, 248, 255,   0, 253, 253, 255,   6, 102, 227, 255, 252,
+    255, 210, 125, 251, 255,   0, 254, 198, 255,   4, 253, 255, 174,  81, 229, 255, 255,  62, 252, 166, 148, 105, 131, 237,
+    255, 252, 168,  97, 127, 230, 255, 212, 143, 133,  97, 207, 255, 253, 178, 103, 137, 244, 255, 201, 105, 106, 202, 255,
+    239, 158, 139, 155, 255, 185, 110, 132, 232, 255, 251, 163,  95, 144,  68, 229, 255, 252, 255, 214,  71, 143,  91, 178,
+    255, 180, 196, 255, 253, 154, 227, 255, 254, 203, 255,  32, 254, 255, 253, 174,  34, 123, 243, 255,  61, 142, 233, 158,
+     87, 255, 164,  94, 231, 173,  53, 255, 194,   0, 215, 208,   0, 239, 223,   0, 233, 219, 255, 218,   0, 255, 212,  32,
+      0, 222, 244,   0, 170, 245, 201,  58, 231, 182,  72, 255, 163,  98, 230, 186,   0, 232, 255, 252, 255, 217,   0, 201,
+    224,  48, 197, 225,  19, 255, 217,  62, 252, 197, 255,   5, 250, 138, 131, 255, 101, 238, 255, 255,   3,  86, 221, 105,
+    230, 255, 255,   3,  99, 225, 200, 146, 255, 255,   8, 137, 193, 254, 116, 110, 199, 255, 151, 176, 255, 255,  13, 175,
+    161, 246,  85, 254, 255, 145,  93, 145, 134,  85, 229,  98, 231, 255, 255,   6,  98, 227, 255, 252, 255, 210, 123, 255,
+    255,   8, 216,  98, 255, 114, 199, 147, 185, 255, 252, 200, 255,  19, 200, 237, 255, 211,  73, 255,  94, 217, 255, 235,
+     35, 239, 114, 195, 255, 245,  38, 238, 198, 139, 255, 255,   8, 149, 190, 255, 249, 233,  44, 206, 189, 125, 255, 255,
+     22, 127, 183, 245,  85, 244, 255, 158, 146, 255, 246, 233, 255,  99, 196, 255, 247,  76, 229, 255, 252, 255, 213,  99,
+    255, 255,   8, 174, 125, 255, 217,   0,  90, 245, 255, 254, 200, 255,  19, 146,  46, 136,   0, 195, 255,  95,  67, 151,
+     43, 169, 255, 214,  17, 147,  74, 152, 255, 182, 131, 255, 255,   8, 132, 194, 234,  92, 181,  79, 216, 252,  84, 255,
+    122,  26,  89, 251, 236,  57, 247, 255, 239,  90, 156, 144, 133, 255, 214,   0, 143, 111,   0, 230, 255, 252, 255, 215,
+      0, 126, 134,  34, 228, 255, 255,   3,  97, 164, 255, 253, 201, 255,   0, 254, 255, 255,  14, 221, 190, 223, 255, 253,
+    110, 205, 198, 217, 255, 254, 255, 235, 190, 215, 255, 255,   1, 236, 227, 255, 255,   5, 228, 237, 255, 219, 185, 225,
+    255, 255,   0, 249, 255, 199,  10, 249, 255, 248, 221, 253, 254, 255, 246, 195, 199, 245, 255, 255,  12, 234, 190, 219,
+    222, 246, 255, 254, 255, 243, 223, 214, 191, 241, 255, 255,   4, 247,  81, 233, 255, 254, 199, 255,   0, 254, 253, 255,
+      2, 253,  80, 232, 255, 255,   2, 254, 255, 254, 253, 255,   0, 254, 255, 255, 255, 254, 251, 255, 255, 254, 253, 255,
+      0, 253, 253, 255,   0, 254, 252, 255,   0, 254, 252, 255,   2, 254, 255, 254, 252, 255,   5, 251, 255, 175, 124, 255,
+    253, 204, 255, 255, 254, 252, 255, 254, 253,   5, 255, 254, 145, 232, 255, 252, 254, 255,   0, 254, 255, 253, 255, 255,
+    255, 254, 255, 255, 255, 254,   0, 255, 254, 253, 255, 255,   0, 254, 255, 253,   0, 254, 255, 255,   0, 253, 254, 255,
+      0, 254, 255, 253,   0, 254, 255, 255,   0, 254, 254, 253, 253, 255,   0, 254, 254, 253,   0, 254, 255, 255,   3, 142,
+    220, 255, 253, 205, 255,   0, 253, 255, 255,   0, 253, 194, 255,   0, 254, 255, 255,   0, 254, 203, 255,   3, 243, 248,
+    255, 254, 193, 255,   0, 254, 207, 255,   1, 254, 253, 255, 255,   7, 197,  87, 110, 218, 255, 254, 253, 254, 147, 255,
+      1, 254, 253, 254, 255,   4, 243,  71,  77,  44, 124, 253, 255,   1, 253, 254, 150, 255,   0, 253, 255, 255,  11, 225,
+    181, 255, 244,  97,  84,  70, 132, 255, 241, 178, 240, 255, 255,   0, 253, 153, 255,   0, 253, 255, 255,  18, 243, 172,
+     55,  74, 249, 246,  91,  82,  65, 129, 255, 229,   0,  93, 192, 252, 255, 254, 253, 156, 255,  20, 254, 255, 253, 195,
+     93,  43,  78, 107, 250, 245,  91,  83,  65, 129, 255, 231,  75,  81,  31, 119, 213, 255, 255,   0, 254, 228, 255,   5,
+    254, 253, 254, 255, 253, 254, 191, 255,  23, 217, 122,  31,  78,  92,  75, 101, 250, 246,  91,  83,  65, 129, 255, 230,
+     63,  86,  91,  68,  42, 147, 233, 255, 254, 223, 255,   0, 254, 195, 255,  27, 253, 255, 200,   0,  70,  90,  84,  83,
+     74, 103, 250, 245,  91,  83,  65, 129, 255, 231,  65,  84,  81,  86,  89,  53,  63, 227, 255, 254, 231, 255,   8, 250,
+    232, 230, 242, 255, 213, 233, 255, 254, 194, 255,  25, 132,  63,  91,  81,  82,  84,  81,  97, 249, 245,  90,  83,  66,
+    128, 255, 229,  61,  90,  81,  82,  81,  96,  31, 174, 255, 253, 254, 255, 254, 254,   2, 255, 253, 254, 255, 255,   0,
+    254, 254, 253, 253, 254, 254, 255,   4, 254, 253, 252, 255, 228, 255,   0,   5, 172, 193,   0,  50, 239, 255, 255, 254,
+    254, 253,   0, 254, 249, 255,   0, 254, 254, 253,   0, 254, 251, 255, 253, 253, 223, 255,   2, 136,  63,  86, 255,  82,
+     20,  86,  27, 118, 252, 246,  94,  82,  64, 133, 255, 235,  70,  59,  86,  81,  82,  88,  46, 172, 255, 254, 248, 255,
+      1, 254, 253, 248, 255,   1, 254, 253, 253, 255,   0, 227, 255,   0,   1, 175, 184, 255,   0,   2, 235, 255, 252, 252,
+    255,   1, 253, 254, 252, 255,   0, 253, 252, 255,   0, 253, 254, 255, 255, 254, 253, 255, 255, 254, 225, 255,  25, 135,
+     61,  87,  82,  86,  67, 167, 245, 255, 231,  73,  87,  72, 114, 251, 255, 234, 138,  68,  86,  81,  89,  41, 173, 255,
+    253, 254, 255,   5, 250, 246, 247, 255, 221, 236, 255, 255,   3, 247, 217, 208, 219, 255, 252,   2, 245, 247, 254, 255,
+    255,   4, 239, 214, 211, 243, 235, 255,   0,  11, 166, 252, 170, 206, 255, 253, 255, 253, 224, 212, 216, 242, 255, 255,
+      0, 254, 254, 255,  10, 254, 255, 251, 221, 212, 220, 248, 255, 254, 255, 254, 255, 255,   3, 233, 213, 214, 232, 255,
+    255,   0, 253, 226, 255,  37, 135,  61,  87,  83,  80,  85, 245, 255, 211, 110,  74,  84,  85,  70, 135, 227, 255, 222,
+     44,  88,  81,  89,  41, 172, 255, 253, 255, 253, 255, 176,   0,  95, 146,   0, 191, 255, 198,  63, 254,   0,   7, 125,
+    128,  32,  99, 247, 255, 173,   3, 255,   0,  11,  59, 147,  49,   0, 172, 177,  77,  88, 223, 255, 215,  98, 254,   0,
+      1,  47, 175, 255, 255,   5, 254, 255, 254, 255, 211,  86, 254,   0,   6,  73, 197, 255, 253, 255, 241, 137, 253,   0,
+      3, 135, 240, 255, 253, 227, 255,  10, 135,  61,  87,  83,  79,  90, 243, 246,  69,  62,  87, 255,  81,  18,  90,   8,
+    126, 255, 220,  52,  87,  81,  89,  41, 172, 255, 253, 255, 253, 255, 167,   0,  14, 255,   0,   1, 202, 215, 249,   0,
+      4,  55, 252, 172,   0,  25, 253,   0,   3,  45,   0, 173, 163, 255,   0,   1, 231, 224, 250,   0,   5, 155, 255, 254,
+    253, 255, 208, 250,   0,   3, 189, 255, 244,  84, 251,   0,   3,  79, 244, 255, 254, 228, 255,  10, 135,  61,  87,  83,
+     79,  88, 245, 246,  95,  82,  83, 255,  82,  22,  87,  68, 134, 255, 221,  50,  87,  81,  89,  41, 172, 255, 253, 255,
+    253, 255, 170,   0,  32,  59, 154, 221,  94, 255,   0,   3, 131, 210, 192,  73, 255,   0,  12,  96, 219,   0,  33,   0,
+    159, 213, 180,  38,  29,   0, 173, 167, 255,   0,   1, 221, 112, 255,   0,   6, 136, 212, 180,  18,  41,   0, 214, 255,
+    255,   1, 248,  71, 255,   0,   2, 148, 213, 176, 254,   0,  12, 239, 175,   0,  22,  86, 200, 202,  89,  18,   0, 162,
+    255, 253, 228, 255,  10, 135,  61,  87,  83,  79,  88, 245, 247,  95,  77,  84, 255,  82,  16,  87,  61, 136, 255, 221,
+     51,  87,  81,  89,  41, 172, 255, 253, 255, 253, 255, 169, 255,   0,   2, 197, 255, 223, 255,   0,   0, 116, 254, 255,
+      0, 222, 255,   0,   1, 106, 173, 255,   0,   0, 165, 254, 255,   0, 200, 255,   0,   7, 173, 167,   0,  55, 183,  41,
+      0, 121, 254, 255,   0, 194, 255,   0,   0, 158, 255, 255,   0, 212, 255,   0,   0, 137, 254, 255,   7, 204, 152, 154,
+    212, 109,   0,  33, 233, 255, 255,   6, 234,  39,   0,  84, 249, 255, 254, 229, 255,  10, 135,  61,  87,  83,  79,  88,
+    244, 245,  72,  84,  88, 255,  81,  16,  93,  61, 122, 255, 220,  51,  87,  81,  89,  41, 172, 255, 253, 255, 253, 255,
+    169, 255,   0,   2, 225, 255, 201, 255,   0,   8, 185, 255, 249, 252, 254, 102,   0, 105, 148, 255,   0,  21, 221, 255,
+    249, 255, 244,  64,   0, 174, 167,   0,  65, 158,  24,   0, 187, 255, 248, 255, 240,  37,   0, 134, 255, 255,   0, 196,
+    255,   0,   3, 201, 255, 249, 251, 254, 255,  13, 247,  48,   0, 125, 255, 251, 250, 255, 128,   0,  49, 238, 255, 254,
+    229, 255,  29, 135,  61,  87,  83,  78,  91, 246, 254, 149,  26,  71,  91,  89,  61,  42, 180, 255, 224,  50,  88,  81,
+     89,  41, 172, 255, 253, 255, 253, 255, 169, 255,   0,   2, 222, 255, 209, 255,   0,   0, 155, 254, 255,   4, 244,  60,
+      0, 106, 161, 255,   0,   4, 198, 255, 254, 255, 227, 255,   0,  11, 173, 167,   0,  62, 168,  30,   0, 159, 255, 254,
+    255, 224, 255,   0,   0, 142, 255, 255,   0, 203, 255,   0,   0, 176, 254, 255,   7, 241, 216, 221, 225,  82,   0,  88,
+    252, 255, 255,   6, 254,  93,   0,  66, 243, 255, 254, 229, 255,   6, 135,  61,  87,  82,  85,  70, 215, 255, 255,   5,
+    208, 113,  32,  44, 138, 225, 255, 255,  12, 187,  52,  88,  81,  89,  41, 172, 255, 253, 255, 253, 255, 169, 255,   0,
+      9, 224, 255, 235,   0,  27,   0, 196, 249, 242, 146, 255,   0,   8, 101, 200,   0,  14,  69, 221, 250, 233, 115, 255,
+      0,   5, 172, 166,   0,  29, 204,  68, 255,   0,   3, 202, 251, 235, 111, 255,   0,  10, 196, 248, 229, 239,   0,   3,
+     44, 213, 251, 231,  98, 255,   0,   1, 214, 144, 255,   0,   3, 161, 246, 247, 166, 255,   0,   2, 128, 255, 254, 228,
+    255,  12, 136,  60,  87,  82,  83,  79,  74, 174, 244, 255, 251, 186, 201, 255, 255,   3, 232, 150,  62,  84, 255,  82,
+      8,  89,  41, 173, 255, 253, 255, 253, 255, 171, 255,   0,   0, 226, 255, 255,  21, 155,   0,  48,   0,  79,  56,   0,
+     35,   2,  83, 245, 114,   0,  30,   0,  87,  28,   0,  55,   0, 174, 169, 255,   0,   6, 232, 180,   0,  40,   0,  82,
+     33, 255,   0,  26,  93, 232,  87,   0, 209, 179,   0,  30,   0,  86,  19,   1,   0, 128, 255, 218,   0,  16,   0,  64,
+     67,   0,  14,   0, 218, 255, 253, 231, 255,   0, 254, 255, 255,   2, 132,  69,  86, 255,  82, 255,  83,   2,  39,  96,
+    195, 254, 255,   4, 246, 175,  71,  52,  86, 255,  82,   9,  81,  90,  51, 170, 255, 253, 255, 253, 255, 161, 255,   0,
+      0, 223, 255, 255,   1, 249, 128, 253,   0,   1,  25,  34, 255,   0,   2, 250, 239,  83, 253,   0,   0,  94, 255,   0,
+      1, 165, 158, 255,   0,   2, 222, 255, 151, 252,   0,   2,  78, 239, 232, 255,   0,   2, 171, 255, 151, 252,   0,   1,
+    125, 246, 255, 255,   0, 200, 251,   0,   2, 199, 255, 253, 229, 255,  18, 254, 255, 162,   0,  93,  86,  81,  82,  83,
+     90,  76,  29, 125, 213, 200,  98,  35,  83,  89, 254,  82,  14,  88,  89,   0, 200, 255, 253, 255, 254, 255, 224, 195,
+    198, 243, 255, 253, 255, 255,  22, 205, 156, 143, 159, 223, 219, 193, 205, 250, 255, 248, 191, 149, 144, 184, 242, 206,
+    192, 225, 223, 194, 198, 242, 255, 255,   5, 219, 167, 144, 153, 195, 249, 255, 255,   2, 200, 168, 246, 255, 255,   4,
+    218, 164, 143, 158, 207, 255, 255, 255, 254,   2, 255, 235, 180, 255, 147,   3, 179, 235, 255, 254, 228, 255,  25, 254,
+    255, 245, 152,  44,  65,  90,  84,  82,  81,  85,  90,  64,  47,  45,  73,  90,  83,  81,  82,  86,  89,  53,  64, 180,
+    254, 253, 255,   0, 254, 253, 255,   2, 254, 255, 254, 247, 255,   0, 253, 244, 255, 255, 254, 251, 255,   0, 253, 253,
+    255, 255, 254, 251, 255,   0, 254, 255, 255,   0, 253, 251, 255,   0, 253, 226, 255,   0, 254, 255, 255,   4, 216, 124,
+     30,  77,  90, 255,  82,   1,  81,  86, 255,  88,   8,  85,  82,  81,  84,  90,  67,  41, 148, 231, 255, 255,   0, 254,
+    253, 255,   0, 254, 255, 253,   0, 254, 253, 255, 255, 253,   0, 254, 252, 253, 255, 255,   1, 254, 253, 255, 254,   1,
+    253, 254, 255, 253, 255, 254, 255, 253,   0, 254, 255, 255, 255, 253, 255, 254,   1, 253, 254, 255, 255, 255, 253,   0,
+    254, 255, 255, 255, 253,   0, 254, 255, 253, 252, 255,   1, 254, 253, 255, 254,   1, 253, 254, 224, 255, 255, 254,   8,
+    255, 253, 196,  95,  38,  85,  88,  82,  81, 255,  82,   6,  81,  83,  90,  78,  30, 120, 214, 255, 255,   0, 253, 154,
+    255,   0, 253, 255, 255,   5, 243, 172,  65,  54,  89,  86, 255,  81,   8,  88,  85,  38,  91, 193, 252, 255, 254, 253,
+    152, 255,   1, 254, 253, 255, 255,   9, 230, 145,  41,  68,  90,  89,  56,  63, 170, 242, 255, 255,   0, 253, 148, 255,
+      1, 254, 253, 255, 255,   5, 212, 118,  37,  47, 142, 228, 255, 255,   1, 253, 254, 145, 255,   5, 253, 254, 255, 250,
+    212, 220, 255, 255,   1, 253, 254, 141, 255,   0, 253, 253, 255,   0, 253, 137, 255, 255, 253, 129, 255, 129, 255, 129,
+    255, 129, 255, 129, 255, 129, 255, 129, 255, 187, 255,   0,   0, 135, 255,   0,   0,   2,   0,  19,  68, 255,  66, 249,
+     67, 255,  66, 241,  67,   0,  66, 233,  67,   0,  66, 227,  67,   0,  66, 227,  67, 255,  66,   5,  67,  66,  12,   0,
+     62, 242, 137, 255,   4, 230,  45, 223, 255, 249, 139, 253,   4, 248, 255, 194, 255, 252, 255, 255,   2, 254, 255, 254,
+    252, 255,   0, 254, 253, 255,   0, 254, 232, 255, 254, 254,   1, 255, 254, 231, 255, 254, 254,   1, 255, 254, 245, 255,
+      0, 254, 250, 255,   0, 254, 251, 255, 255, 254, 244, 255,   3, 253, 255, 233, 254, 137, 255,   2, 253, 255, 231, 136,
+    255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136,
+    255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136,
+    255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136,
+    255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136,
+    255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136,
+    255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136,
+    255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136,
+    255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136,
+    255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136,
+    255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136,
+    255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136,
+    255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136,
+    255,   2, 253, 255, 232, 136, 255,   2, 253, 255, 232, 136, 255,   3, 253, 255, 232, 254, 137, 255,   4, 253, 255, 231,
+    255, 252, 138, 255,   5, 253, 255, 233, 223, 255, 249, 255, 253, 255, 252, 252, 253,   0, 252, 254, 253, 255, 252, 253,
+    253,   0, 252, 251, 253,   0, 252, 244, 253,   2, 252, 253, 252, 253, 253,   0, 252, 255, 253,   0, 252, 255, 253,   0,
+    252, 252, 253, 255, 252, 253, 253,   0, 252, 252, 253,   2, 252, 253, 252, 253, 253,   0, 252, 252, 253,   0, 252, 255,
+    253, 255, 252,   0, 253, 255, 252, 253, 253,   0, 252, 250, 253,   0, 252, 254, 253, 255, 252, 252, 253,   0, 252, 255,
+    253,   4, 248, 255, 194,  62, 242, 137, 255,   4, 230,  45,   0,  20,  68, 138,  66,   1,  13,   0};
 
 static const unsigned char live365_logo[] = {
-    218, 240, 246, 255, 221, 241, 247, 255, 225, 243, 248, 255, 228, 245, 249, 255, 231, 246, 250, 255, 234, 247, 251, 255, 236, 248, 251, 255, 239, 249, 252,
-    255, 241, 250, 252, 255, 243, 251, 252, 255, 245, 251, 253, 255, 246, 252, 254, 255, 247, 252, 253, 255, 248, 253, 254, 255, 249, 253, 254, 255, 250, 253,
-    254, 255, 251, 254, 254, 255, 251, 253, 254, 255, 251, 253, 254, 255, 252, 254, 254, 255, 252, 254, 254, 255, 253, 254, 255, 255, 253, 254, 255, 255, 252,
-    254, 254, 255, 253, 254, 254, 255, 253, 255, 255, 255, 253, 254, 254, 255, 253, 254, 255, 255, 253, 254, 255, 255, 252, 253, 254, 255, 252, 253, 253, 255,
-    252, 253, 253, 255, 252, 254, 254, 255, 252, 253, 254, 255, 251, 254, 255, 255, 251, 254, 254, 255, 250, 253, 254, 255, 250, 254, 255, 255, 249, 253, 254,
-    255, 247, 253, 254, 255, 247, 253, 254, 255, 245, 252, 254, 255, 243, 252, 254, 255, 241, 251, 254, 255, 239, 250, 253, 255, 236, 250, 253, 255, 233, 249,
-    253, 255, 230, 248, 252, 255, 226, 247, 252, 255, 221, 241, 247, 255, 218, 230, 239, 255, 214, 236, 244, 255, 209, 241, 249, 255, 205, 241, 249, 255, 201,
-    239, 248, 255, 197, 238, 247, 255, 193, 236, 246, 255, 189, 235, 245, 255, 185, 233, 245, 255, 183, 230, 242, 255, 182, 230, 243, 255, 180, 229, 243, 255,
-    179, 227, 241, 255, 191, 198, 216, 255, 183, 220, 238, 255, 176, 225, 241, 255, 175, 224, 241, 255, 174, 223, 241, 255, 172, 222, 240, 255, 170, 221, 239,
-    255, 171, 221, 239, 255, 171, 220, 239, 255, 172, 220, 239, 255, 172, 220, 239, 255, 172, 220, 239, 255, 173, 219, 239, 255, 173, 219, 239, 255, 173, 218,
-    239, 255, 218, 222, 231, 255, 234, 222, 224, 255, 231, 218, 221, 255, 224, 210, 217, 255, 212, 198, 211, 255, 198, 184, 206, 255, 185, 179, 206, 255, 180,
-    180, 207, 255, 181, 180, 207, 255, 181, 181, 208, 255, 191, 188, 211, 255, 186, 185, 212, 255, 184, 189, 217, 255, 185, 186, 214, 255, 186, 201, 228, 255,
-    187, 194, 220, 255, 187, 202, 227, 255, 187, 216, 240, 255, 187, 211, 236, 255, 188, 207, 233, 255, 188, 203, 228, 255, 189, 192, 219, 255, 195, 182, 213,
-    255, 202, 179, 211, 255, 195, 186, 215, 255, 192, 193, 220, 255, 190, 213, 236, 255, 192, 190, 218, 255, 208, 201, 227, 255, 197, 204, 229, 255, 190, 202,
-    226, 255, 191, 202, 226, 255, 190, 201, 226, 255, 190, 201, 225, 255, 191, 201, 225, 255, 191, 202, 225, 255, 192, 202, 225, 255, 192, 202, 225, 255, 191,
-    202, 225, 255, 191, 202, 225, 255, 190, 201, 224, 255, 190, 200, 223, 255, 189, 198, 220, 255, 188, 197, 219, 255, 187, 200, 223, 255, 186, 201, 224, 255,
-    219, 240, 245, 255, 223, 242, 247, 255, 226, 244, 248, 255, 230, 245, 249, 255, 233, 247, 251, 255, 236, 249, 252, 255, 238, 249, 252, 255, 240, 250, 253,
-    255, 242, 251, 253, 255, 244, 252, 253, 255, 246, 252, 253, 255, 247, 253, 254, 255, 248, 253, 254, 255, 249, 254, 254, 255, 250, 253, 254, 255, 251, 254,
-    255, 255, 252, 254, 254, 255, 252, 254, 254, 255, 252, 254, 254, 255, 253, 254, 255, 255, 253, 254, 254, 255, 253, 254, 254, 255, 253, 254, 254, 255, 253,
-    254, 254, 255, 254, 255, 255, 255, 254, 255, 255, 255, 253, 254, 254, 255, 253, 254, 254, 255, 253, 254, 254, 255, 253, 254, 254, 255, 252, 253, 253, 255,
-    252, 253, 253, 255, 252, 254, 255, 255, 252, 254, 255, 255, 251, 254, 254, 255, 251, 254, 255, 255, 250, 253, 254, 255, 249, 253, 254, 255, 248, 253, 254,
-    255, 247, 253, 254, 255, 246, 252, 254, 255, 244, 252, 254, 255, 243, 252, 254, 255, 241, 251, 253, 255, 238, 250, 253, 255, 236, 250, 253, 255, 233, 249,
-    253, 255, 231, 249, 252, 255, 228, 242, 248, 255, 222, 233, 241, 255, 221, 244, 250, 255, 218, 245, 251, 255, 215, 244, 251, 255, 210, 244, 251, 255, 206,
-    242, 250, 255, 202, 242, 250, 255, 197, 241, 250, 255, 192, 239, 249, 255, 187, 238, 249, 255, 184, 236, 247, 255, 182, 236, 248, 255, 180, 235, 248, 255,
-    178, 233, 247, 255, 202, 205, 218, 255, 193, 208, 226, 255, 175, 230, 245, 255, 174, 228, 244, 255, 174, 227, 244, 255, 171, 225, 242, 255, 169, 223, 241,
-    255, 169, 221, 240, 255, 170, 220, 239, 255, 170, 219, 238, 255, 170, 218, 238, 255, 170, 218, 237, 255, 170, 217, 237, 255, 170, 216, 236, 255, 185, 217,
-    234, 255, 236, 226, 227, 255, 234, 225, 226, 255, 230, 219, 223, 255, 219, 205, 215, 255, 205, 192, 209, 255, 193, 182, 205, 255, 184, 178, 204, 255, 181,
-    175, 204, 255, 178, 174, 204, 255, 178, 174, 205, 255, 186, 182, 207, 255, 191, 177, 205, 255, 187, 173, 204, 255, 184, 176, 207, 255, 182, 195, 221, 255,
-    183, 192, 218, 255, 184, 200, 226, 255, 184, 204, 230, 255, 184, 214, 238, 255, 184, 215, 239, 255, 184, 206, 231, 255, 185, 194, 220, 255, 190, 176, 208,
-    255, 196, 175, 208, 255, 190, 185, 214, 255, 187, 200, 224, 255, 188, 217, 238, 255, 187, 191, 218, 255, 194, 194, 220, 255, 206, 206, 231, 255, 188, 203,
-    227, 255, 187, 203, 227, 255, 187, 203, 226, 255, 187, 203, 227, 255, 188, 203, 226, 255, 188, 203, 226, 255, 189, 203, 226, 255, 189, 203, 226, 255, 189,
-    203, 226, 255, 189, 203, 226, 255, 189, 203, 225, 255, 188, 202, 224, 255, 187, 199, 221, 255, 187, 197, 219, 255, 186, 201, 224, 255, 185, 204, 226, 255,
-    220, 242, 247, 255, 224, 244, 248, 255, 228, 245, 249, 255, 231, 246, 250, 255, 234, 248, 251, 255, 237, 249, 252, 255, 239, 250, 252, 255, 242, 251, 253,
-    255, 244, 251, 253, 255, 245, 251, 253, 255, 247, 252, 253, 255, 248, 253, 254, 255, 249, 253, 254, 255, 250, 253, 254, 255, 251, 254, 254, 255, 251, 254,
-    254, 255, 252, 254, 255, 255, 252, 254, 255, 255, 253, 254, 255, 255, 253, 254, 255, 255, 253, 254, 254, 255, 253, 254, 255, 255, 253, 254, 254, 255, 254,
-    255, 255, 255, 254, 254, 255, 255, 253, 254, 254, 255, 254, 255, 255, 255, 253, 254, 254, 255, 253, 254, 254, 255, 253, 253, 254, 255, 253, 254, 254, 255,
-    253, 254, 254, 255, 253, 254, 254, 255, 253, 254, 255, 255, 252, 254, 255, 255, 252, 254, 254, 255, 251, 254, 255, 255, 251, 254, 254, 255, 250, 254, 255,
-    255, 250, 253, 254, 255, 249, 253, 255, 255, 247, 253, 254, 255, 246, 253, 255, 255, 245, 252, 254, 255, 243, 252, 254, 255, 240, 251, 254, 255, 238, 251,
-    254, 255, 233, 244, 249, 255, 230, 239, 245, 255, 230, 248, 252, 255, 226, 248, 253, 255, 223, 247, 252, 255, 219, 246, 252, 255, 215, 244, 252, 255, 210,
-    243, 251, 255, 205, 242, 250, 255, 200, 240, 249, 255, 195, 238, 248, 255, 190, 236, 247, 255, 184, 233, 245, 255, 182, 233, 245, 255, 180, 231, 244, 255,
-    181, 230, 243, 255, 216, 214, 225, 255, 195, 204, 224, 255, 174, 225, 241, 255, 173, 224, 239, 255, 172, 222, 239, 255, 169, 220, 238, 255, 167, 218, 237,
-    255, 168, 217, 236, 255, 168, 216, 236, 255, 168, 216, 235, 255, 168, 215, 235, 255, 168, 215, 235, 255, 168, 215, 235, 255, 168, 214, 235, 255, 209, 223,
-    232, 255, 236, 227, 228, 255, 234, 226, 227, 255, 228, 217, 223, 255, 213, 200, 212, 255, 199, 187, 206, 255, 188, 178, 203, 255, 181, 171, 202, 255, 177,
-    168, 201, 255, 175, 169, 201, 255, 175, 171, 203, 255, 181, 175, 204, 255, 200, 191, 210, 255, 184, 173, 204, 255, 179, 184, 212, 255, 179, 196, 222, 255,
-    179, 182, 209, 255, 180, 185, 212, 255, 180, 194, 219, 255, 180, 207, 232, 255, 180, 215, 239, 255, 181, 209, 234, 255, 182, 195, 222, 255, 185, 175, 207,
-    255, 189, 173, 206, 255, 185, 185, 213, 255, 184, 207, 230, 255, 184, 215, 236, 255, 184, 190, 216, 255, 185, 193, 217, 255, 204, 203, 228, 255, 191, 203,
-    227, 255, 186, 201, 225, 255, 185, 201, 224, 255, 184, 201, 224, 255, 185, 201, 224, 255, 186, 200, 223, 255, 186, 201, 223, 255, 187, 201, 223, 255, 187,
-    201, 223, 255, 187, 201, 223, 255, 187, 200, 222, 255, 187, 199, 221, 255, 186, 197, 218, 255, 185, 195, 217, 255, 185, 199, 222, 255, 184, 202, 224, 255,
-    222, 240, 245, 255, 226, 242, 247, 255, 229, 244, 248, 255, 230, 244, 247, 255, 215, 226, 229, 255, 214, 223, 226, 255, 216, 224, 227, 255, 218, 225, 227,
-    255, 219, 226, 228, 255, 221, 226, 228, 255, 223, 227, 228, 255, 223, 227, 228, 255, 224, 228, 228, 255, 225, 228, 228, 255, 226, 228, 228, 255, 226, 228,
-    229, 255, 227, 228, 229, 255, 227, 229, 229, 255, 228, 229, 229, 255, 228, 229, 229, 255, 228, 229, 229, 255, 228, 228, 229, 255, 228, 229, 229, 255, 228,
-    229, 229, 255, 228, 228, 228, 255, 228, 228, 228, 255, 228, 228, 229, 255, 228, 228, 228, 255, 228, 228, 228, 255, 227, 228, 228, 255, 227, 228, 228, 255,
-    227, 228, 228, 255, 227, 229, 229, 255, 227, 228, 228, 255, 227, 228, 229, 255, 227, 228, 229, 255, 226, 228, 229, 255, 226, 228, 228, 255, 225, 227, 228,
-    255, 224, 227, 228, 255, 223, 227, 228, 255, 222, 227, 228, 255, 220, 227, 228, 255, 219, 227, 228, 255, 217, 226, 227, 255, 214, 225, 227, 255, 211, 221,
-    225, 255, 208, 216, 220, 255, 206, 222, 226, 255, 203, 222, 226, 255, 200, 221, 226, 255, 196, 220, 226, 255, 193, 219, 225, 255, 190, 219, 225, 255, 198,
-    231, 238, 255, 203, 240, 249, 255, 200, 240, 249, 255, 195, 238, 248, 255, 190, 237, 247, 255, 185, 234, 246, 255, 182, 234, 246, 255, 180, 233, 246, 255,
-    185, 234, 245, 255, 219, 217, 228, 255, 194, 199, 218, 255, 173, 230, 245, 255, 172, 229, 244, 255, 171, 228, 244, 255, 168, 226, 243, 255, 166, 225, 242,
-    255, 166, 224, 242, 255, 166, 223, 241, 255, 166, 222, 241, 255, 166, 222, 241, 255, 166, 221, 240, 255, 165, 221, 240, 255, 166, 220, 239, 255, 228, 227,
-    229, 255, 235, 226, 227, 255, 232, 224, 226, 255, 223, 212, 219, 255, 211, 198, 210, 255, 198, 185, 205, 255, 189, 179, 203, 255, 184, 174, 202, 255, 179,
-    168, 200, 255, 180, 170, 201, 255, 181, 172, 201, 255, 181, 167, 200, 255, 182, 170, 202, 255, 178, 171, 204, 255, 175, 185, 213, 255, 176, 194, 220, 255,
-    177, 186, 214, 255, 176, 181, 209, 255, 177, 187, 213, 255, 177, 201, 226, 255, 177, 209, 233, 255, 178, 210, 235, 255, 179, 200, 225, 255, 180, 176, 207,
-    255, 185, 171, 204, 255, 181, 186, 212, 255, 181, 216, 237, 255, 182, 215, 236, 255, 182, 193, 217, 255, 182, 197, 220, 255, 197, 209, 232, 255, 191, 201,
-    225, 255, 188, 200, 223, 255, 182, 199, 222, 255, 182, 199, 222, 255, 182, 199, 222, 255, 183, 199, 222, 255, 183, 199, 222, 255, 184, 200, 222, 255, 185,
-    200, 222, 255, 185, 200, 222, 255, 185, 200, 222, 255, 185, 199, 221, 255, 185, 197, 219, 255, 184, 196, 217, 255, 184, 200, 222, 255, 183, 203, 225, 255,
-    223, 244, 249, 255, 227, 246, 250, 255, 230, 247, 251, 255, 140, 149, 151, 255, 14,  15,  15,  255, 7,   7,   7,   255, 7,   7,   7,   255, 7,   7,   7,
-    255, 7,   7,   7,   255, 7,   7,   7,   255, 7,   7,   7,   255, 7,   7,   7,   255, 7,   7,   7,   255, 7,   7,   7,   255, 7,   7,   7,   255, 7,   7,
-    7,   255, 7,   7,   7,   255, 7,   7,   7,   255, 7,   7,   7,   255, 7,   7,   7,   255, 7,   7,   7,   255, 7,   7,   7,   255, 7,   7,   7,   255, 7,
-    7,   7,   255, 7,   7,   7,   255, 7,   7,   7,   255, 7,   7,   7,   255, 6,   6,   6,   255, 6,   6,   6,   255, 6,   6,   6,   255, 6,   6,   6,   255,
-    6,   6,   6,   255, 6,   6,   6,   255, 6,   6,   6,   255, 6,   6,   6,   255, 6,   6,   6,   255, 6,   6,   6,   255, 6,   6,   6,   255, 6,   6,   6,
-    255, 6,   6,   6,   255, 6,   6,   6,   255, 6,   6,   6,   255, 6,   6,   6,   255, 6,   6,   6,   255, 6,   6,   6,   255, 6,   6,   6,   255, 6,   6,
-    6,   255, 6,   6,   6,   255, 6,   6,   6,   255, 5,   6,   6,   255, 5,   6,   6,   255, 5,   6,   6,   255, 5,   6,   6,   255, 6,   6,   7,   255, 41,
-    46,  48,  255, 200, 232, 239, 255, 206, 243, 252, 255, 202, 242, 251, 255, 196, 240, 250, 255, 187, 238, 249, 255, 187, 238, 249, 255, 182, 236, 248, 255,
-    181, 233, 245, 255, 218, 218, 228, 255, 195, 197, 215, 255, 172, 230, 245, 255, 172, 229, 244, 255, 170, 227, 243, 255, 166, 224, 241, 255, 164, 222, 240,
-    255, 164, 221, 239, 255, 164, 219, 238, 255, 164, 219, 237, 255, 163, 217, 237, 255, 163, 217, 236, 255, 163, 215, 235, 255, 174, 217, 235, 255, 234, 227,
-    227, 255, 224, 215, 220, 255, 217, 207, 216, 255, 209, 198, 210, 255, 203, 191, 207, 255, 194, 183, 203, 255, 190, 177, 201, 255, 193, 180, 201, 255, 188,
-    178, 201, 255, 185, 177, 202, 255, 178, 163, 198, 255, 176, 164, 199, 255, 174, 173, 203, 255, 171, 173, 204, 255, 172, 177, 206, 255, 173, 185, 213, 255,
-    174, 189, 216, 255, 175, 187, 215, 255, 174, 183, 210, 255, 174, 190, 215, 255, 174, 203, 228, 255, 175, 206, 230, 255, 176, 192, 218, 255, 178, 174, 204,
-    255, 182, 168, 203, 255, 179, 187, 212, 255, 178, 217, 238, 255, 179, 214, 235, 255, 179, 193, 217, 255, 179, 201, 223, 255, 193, 217, 238, 255, 189, 204,
-    227, 255, 182, 203, 225, 255, 180, 202, 224, 255, 180, 201, 224, 255, 180, 201, 223, 255, 180, 201, 223, 255, 181, 201, 223, 255, 182, 202, 223, 255, 182,
-    202, 223, 255, 183, 201, 223, 255, 183, 201, 223, 255, 183, 200, 221, 255, 183, 198, 219, 255, 183, 196, 217, 255, 183, 200, 222, 255, 182, 204, 227, 255,
-    224, 242, 247, 255, 228, 244, 248, 255, 231, 245, 249, 255, 143, 151, 152, 255, 81,  85,  86,  255, 84,  87,  88,  255, 86,  89,  89,  255, 86,  89,  89,
-    255, 87,  89,  89,  255, 87,  89,  89,  255, 88,  89,  89,  255, 88,  89,  90,  255, 89,  89,  90,  255, 89,  89,  90,  255, 89,  90,  90,  255, 89,  90,
-    90,  255, 89,  90,  90,  255, 90,  90,  90,  255, 90,  90,  90,  255, 90,  90,  90,  255, 90,  90,  90,  255, 90,  90,  90,  255, 90,  90,  90,  255, 90,
-    90,  90,  255, 90,  90,  90,  255, 90,  90,  90,  255, 82,  82,  82,  255, 14,  14,  14,  255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255,
-    0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,
-    255, 0,   0,   0,   255, 1,   1,   1,   255, 1,   1,   1,   255, 9,   9,   9,   255, 8,   8,   8,   255, 1,   1,   1,   255, 0,   0,   0,   255, 0,   0,
-    0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 4,
-    4,   4,   255, 184, 216, 222, 255, 203, 241, 249, 255, 198, 240, 249, 255, 193, 238, 248, 255, 187, 235, 245, 255, 184, 235, 246, 255, 180, 233, 246, 255,
-    179, 230, 242, 255, 207, 208, 223, 255, 197, 192, 211, 255, 173, 225, 241, 255, 170, 227, 242, 255, 169, 225, 241, 255, 165, 223, 240, 255, 162, 221, 239,
-    255, 162, 221, 239, 255, 162, 220, 239, 255, 162, 220, 239, 255, 161, 220, 238, 255, 161, 219, 238, 255, 160, 219, 238, 255, 185, 221, 235, 255, 212, 200,
-    210, 255, 223, 213, 218, 255, 223, 213, 219, 255, 202, 191, 206, 255, 193, 181, 201, 255, 189, 177, 199, 255, 191, 178, 200, 255, 193, 180, 200, 255, 192,
-    188, 205, 255, 179, 167, 198, 255, 177, 166, 198, 255, 174, 168, 199, 255, 169, 165, 199, 255, 170, 164, 199, 255, 172, 164, 199, 255, 172, 166, 201, 255,
-    171, 177, 207, 255, 172, 193, 220, 255, 176, 193, 220, 255, 171, 188, 214, 255, 172, 197, 221, 255, 173, 199, 223, 255, 173, 183, 210, 255, 176, 169, 202,
-    255, 179, 166, 201, 255, 176, 187, 213, 255, 176, 218, 239, 255, 177, 208, 230, 255, 177, 193, 216, 255, 177, 201, 224, 255, 187, 219, 239, 255, 199, 204,
-    227, 255, 183, 200, 223, 255, 181, 199, 221, 255, 178, 199, 221, 255, 178, 198, 220, 255, 178, 198, 220, 255, 179, 198, 221, 255, 179, 198, 220, 255, 180,
-    198, 220, 255, 181, 199, 220, 255, 181, 198, 220, 255, 182, 198, 219, 255, 182, 196, 217, 255, 182, 194, 215, 255, 181, 198, 219, 255, 181, 202, 224, 255,
-    225, 243, 248, 255, 229, 245, 249, 255, 232, 247, 250, 255, 204, 215, 218, 255, 184, 193, 195, 255, 232, 241, 244, 255, 242, 250, 252, 255, 244, 251, 252,
-    255, 245, 251, 252, 255, 246, 251, 252, 255, 248, 252, 253, 255, 250, 253, 253, 255, 250, 252, 253, 255, 250, 252, 252, 255, 251, 253, 253, 255, 251, 252,
-    252, 255, 252, 253, 253, 255, 253, 254, 254, 255, 252, 253, 253, 255, 252, 253, 253, 255, 253, 253, 253, 255, 253, 253, 253, 255, 253, 253, 253, 255, 252,
-    252, 252, 255, 253, 253, 253, 255, 254, 254, 254, 255, 252, 252, 252, 255, 82,  82,  82,  255, 1,   1,   1,   255, 0,   0,   0,   255, 1,   1,   1,   255,
-    1,   1,   1,   255, 15,  15,  15,  255, 21,  21,  21,  255, 5,   5,   5,   255, 1,   1,   1,   255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,
-    255, 1,   1,   1,   255, 19,  20,  20,  255, 111, 113, 114, 255, 192, 196, 198, 255, 117, 120, 121, 255, 1,   1,   1,   255, 0,   0,   0,   255, 1,   1,
-    1,   255, 2,   2,   2,   255, 2,   2,   2,   255, 2,   2,   2,   255, 2,   2,   2,   255, 0,   1,   1,   255, 0,   0,   0,   255, 0,   0,   0,   255, 4,
-    4,   4,   255, 189, 217, 223, 255, 209, 243, 251, 255, 205, 242, 251, 255, 200, 241, 250, 255, 190, 238, 249, 255, 192, 239, 250, 255, 187, 236, 248, 255,
-    181, 202, 222, 255, 184, 181, 209, 255, 180, 173, 204, 255, 190, 189, 215, 255, 185, 232, 246, 255, 168, 231, 246, 255, 163, 229, 245, 255, 160, 227, 244,
-    255, 160, 226, 243, 255, 160, 225, 243, 255, 159, 224, 241, 255, 159, 223, 241, 255, 158, 222, 241, 255, 158, 221, 240, 255, 174, 222, 237, 255, 222, 210,
-    214, 255, 202, 190, 204, 255, 199, 189, 205, 255, 202, 189, 203, 255, 206, 193, 205, 255, 198, 185, 201, 255, 195, 183, 201, 255, 193, 182, 201, 255, 190,
-    185, 204, 255, 176, 166, 197, 255, 183, 179, 201, 255, 165, 163, 199, 255, 165, 166, 200, 255, 167, 165, 200, 255, 169, 163, 199, 255, 173, 160, 197, 255,
-    171, 165, 200, 255, 170, 184, 213, 255, 173, 199, 224, 255, 170, 189, 215, 255, 169, 191, 215, 255, 170, 192, 217, 255, 171, 176, 205, 255, 175, 162, 199,
-    255, 176, 168, 202, 255, 174, 195, 218, 255, 174, 216, 237, 255, 175, 196, 219, 255, 175, 199, 221, 255, 175, 202, 224, 255, 181, 220, 239, 255, 208, 206,
-    230, 255, 183, 200, 222, 255, 176, 199, 220, 255, 176, 198, 220, 255, 176, 198, 220, 255, 176, 198, 220, 255, 176, 198, 220, 255, 177, 199, 220, 255, 178,
-    199, 220, 255, 179, 200, 221, 255, 179, 200, 220, 255, 180, 199, 219, 255, 180, 197, 218, 255, 180, 194, 215, 255, 180, 199, 220, 255, 180, 204, 225, 255,
-    226, 244, 249, 255, 230, 246, 250, 255, 233, 247, 250, 255, 99,  104, 105, 255, 7,   7,   7,   255, 206, 214, 216, 255, 242, 250, 252, 255, 245, 251, 253,
-    255, 180, 183, 184, 255, 172, 175, 176, 255, 249, 252, 253, 255, 251, 253, 254, 255, 239, 241, 241, 255, 140, 141, 141, 255, 218, 219, 220, 255, 146, 147,
-    147, 255, 230, 231, 231, 255, 248, 249, 249, 255, 154, 154, 154, 255, 204, 204, 204, 255, 163, 163, 163, 255, 145, 145, 145, 255, 145, 145, 145, 255, 167,
-    167, 167, 255, 250, 250, 250, 255, 255, 255, 255, 255, 255, 255, 255, 255, 86,  86,  86,  255, 1,   1,   1,   255, 2,   2,   2,   255, 70,  70,  70,  255,
-    181, 181, 181, 255, 227, 227, 227, 255, 231, 231, 231, 255, 206, 207, 207, 255, 94,  95,  95,  255, 3,   3,   3,   255, 0,   0,   0,   255, 1,   1,   1,
-    255, 65,  66,  66,  255, 213, 215, 216, 255, 248, 251, 252, 255, 244, 248, 248, 255, 143, 145, 146, 255, 4,   4,   4,   255, 8,   8,   8,   255, 141, 142,
-    145, 255, 163, 166, 169, 255, 163, 167, 171, 255, 164, 172, 175, 255, 163, 173, 176, 255, 47,  50,  51,  255, 0,   0,   0,   255, 0,   0,   0,   255, 4,
-    4,   4,   255, 192, 218, 224, 255, 211, 243, 251, 255, 206, 242, 251, 255, 201, 240, 250, 255, 192, 237, 248, 255, 191, 237, 248, 255, 184, 220, 233, 255,
-    195, 197, 213, 255, 179, 175, 204, 255, 176, 172, 202, 255, 184, 171, 203, 255, 180, 184, 212, 255, 175, 204, 225, 255, 162, 224, 241, 255, 158, 221, 239,
-    255, 158, 220, 239, 255, 158, 219, 238, 255, 158, 218, 237, 255, 158, 217, 237, 255, 158, 217, 236, 255, 158, 216, 236, 255, 160, 216, 236, 255, 221, 216,
-    220, 255, 209, 198, 208, 255, 203, 197, 210, 255, 205, 192, 204, 255, 221, 209, 214, 255, 206, 194, 205, 255, 192, 180, 199, 255, 192, 185, 202, 255, 188,
-    181, 203, 255, 181, 173, 199, 255, 180, 179, 204, 255, 161, 166, 201, 255, 162, 166, 201, 255, 162, 166, 201, 255, 164, 166, 201, 255, 166, 164, 199, 255,
-    171, 158, 195, 255, 168, 168, 201, 255, 168, 193, 220, 255, 168, 188, 215, 255, 167, 189, 214, 255, 168, 188, 213, 255, 171, 165, 200, 255, 174, 159, 198,
-    255, 173, 170, 202, 255, 171, 197, 219, 255, 172, 209, 231, 255, 173, 189, 213, 255, 173, 205, 226, 255, 173, 203, 224, 255, 174, 217, 236, 255, 198, 205,
-    227, 255, 180, 201, 223, 255, 174, 200, 221, 255, 174, 200, 221, 255, 174, 200, 221, 255, 174, 200, 221, 255, 175, 199, 221, 255, 175, 199, 221, 255, 176,
-    200, 221, 255, 177, 200, 221, 255, 177, 200, 221, 255, 178, 199, 219, 255, 179, 197, 217, 255, 179, 194, 215, 255, 179, 198, 219, 255, 179, 204, 225, 255,
-    227, 243, 247, 255, 230, 245, 249, 255, 233, 246, 250, 255, 96,  101, 102, 255, 1,   1,   1,   255, 206, 213, 215, 255, 243, 250, 252, 255, 245, 250, 251,
-    255, 104, 106, 107, 255, 84,  86,  86,  255, 249, 252, 252, 255, 250, 253, 253, 255, 222, 224, 225, 255, 9,   9,   9,   255, 189, 190, 190, 255, 38,  38,
-    38,  255, 170, 171, 171, 255, 236, 237, 237, 255, 22,  22,  22,  255, 184, 184, 184, 255, 50,  50,  50,  255, 44,  44,  44,  255, 77,  77,  77,  255, 114,
-    114, 114, 255, 246, 246, 246, 255, 255, 255, 255, 255, 255, 255, 255, 255, 85,  85,  85,  255, 1,   1,   1,   255, 4,   4,   4,   255, 153, 153, 153, 255,
-    251, 251, 251, 255, 236, 237, 237, 255, 241, 242, 242, 255, 252, 253, 253, 255, 246, 247, 247, 255, 63,  64,  64,  255, 2,   2,   2,   255, 64,  65,  65,
-    255, 234, 236, 236, 255, 248, 250, 252, 255, 184, 186, 187, 255, 49,  49,  50,  255, 1,   1,   1,   255, 0,   0,   0,   255, 12,  12,  12,  255, 209, 210,
-    214, 255, 233, 234, 239, 255, 231, 231, 238, 255, 228, 229, 237, 255, 212, 217, 223, 255, 39,  40,  42,  255, 1,   1,   1,   255, 0,   0,   0,   255, 4,
-    4,   4,   255, 185, 209, 217, 255, 205, 241, 249, 255, 201, 238, 247, 255, 197, 237, 247, 255, 191, 234, 245, 255, 190, 225, 237, 255, 190, 202, 218, 255,
-    203, 203, 217, 255, 181, 177, 205, 255, 179, 175, 203, 255, 182, 173, 203, 255, 177, 177, 207, 255, 169, 210, 230, 255, 165, 214, 233, 255, 160, 225, 242,
-    255, 160, 226, 243, 255, 161, 225, 242, 255, 161, 225, 242, 255, 161, 225, 241, 255, 161, 224, 241, 255, 161, 224, 242, 255, 165, 224, 241, 255, 220, 213,
-    218, 255, 222, 210, 215, 255, 226, 214, 218, 255, 230, 220, 221, 255, 223, 211, 215, 255, 203, 190, 204, 255, 188, 175, 198, 255, 192, 186, 205, 255, 194,
-    192, 208, 255, 190, 186, 205, 255, 179, 178, 205, 255, 166, 175, 206, 255, 166, 171, 204, 255, 166, 171, 204, 255, 167, 171, 204, 255, 168, 171, 204, 255,
-    174, 165, 199, 255, 171, 168, 201, 255, 169, 189, 216, 255, 169, 192, 218, 255, 169, 188, 212, 255, 171, 183, 210, 255, 175, 166, 201, 255, 177, 163, 199,
-    255, 176, 175, 205, 255, 174, 202, 223, 255, 175, 199, 223, 255, 175, 190, 214, 255, 175, 207, 228, 255, 175, 212, 232, 255, 175, 214, 232, 255, 185, 203,
-    224, 255, 183, 202, 222, 255, 179, 200, 221, 255, 175, 199, 220, 255, 174, 198, 219, 255, 175, 198, 219, 255, 175, 198, 219, 255, 175, 199, 219, 255, 176,
-    198, 219, 255, 176, 198, 218, 255, 177, 199, 218, 255, 178, 197, 218, 255, 178, 196, 216, 255, 178, 193, 213, 255, 179, 197, 217, 255, 178, 203, 223, 255,
-    227, 246, 251, 255, 231, 248, 251, 255, 234, 248, 251, 255, 96,  101, 103, 255, 1,   1,   1,   255, 207, 214, 216, 255, 243, 251, 252, 255, 245, 251, 253,
-    255, 105, 107, 107, 255, 82,  83,  84,  255, 249, 252, 252, 255, 251, 253, 254, 255, 223, 225, 225, 255, 9,   9,   9,   255, 207, 207, 208, 255, 76,  76,
-    76,  255, 130, 130, 130, 255, 211, 212, 212, 255, 23,  23,  23,  255, 218, 218, 218, 255, 51,  51,  51,  255, 143, 143, 143, 255, 254, 254, 254, 255, 254,
-    254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 85,  85,  85,  255, 1,   1,   1,   255, 1,   1,   1,   255, 30,  30,  30,  255,
-    110, 110, 110, 255, 40,  40,  40,  255, 73,  73,  73,  255, 254, 254, 254, 255, 253, 253, 253, 255, 122, 122, 122, 255, 14,  14,  14,  255, 207, 207, 208,
-    255, 249, 250, 251, 255, 196, 196, 197, 255, 50,  51,  51,  255, 28,  28,  28,  255, 2,   2,   2,   255, 1,   1,   1,   255, 15,  15,  15,  255, 224, 228,
-    231, 255, 235, 235, 240, 255, 130, 130, 133, 255, 81,  81,  84,  255, 72,  72,  74,  255, 10,  10,  10,  255, 0,   0,   0,   255, 0,   0,   0,   255, 5,
-    5,   5,   255, 182, 184, 198, 255, 204, 215, 229, 255, 203, 219, 232, 255, 201, 221, 235, 255, 192, 219, 232, 255, 198, 229, 241, 255, 191, 202, 218, 255,
-    200, 201, 214, 255, 179, 177, 204, 255, 178, 174, 202, 255, 179, 173, 202, 255, 178, 176, 205, 255, 171, 204, 225, 255, 169, 191, 217, 255, 167, 205, 227,
-    255, 162, 227, 243, 255, 162, 226, 242, 255, 163, 225, 242, 255, 163, 224, 241, 255, 163, 223, 240, 255, 163, 222, 240, 255, 188, 222, 235, 255, 221, 207,
-    212, 255, 227, 214, 218, 255, 236, 228, 228, 255, 231, 222, 223, 255, 217, 205, 212, 255, 197, 185, 201, 255, 187, 172, 198, 255, 187, 179, 201, 255, 185,
-    181, 203, 255, 183, 179, 202, 255, 176, 176, 203, 255, 170, 184, 213, 255, 169, 174, 206, 255, 169, 173, 205, 255, 169, 173, 205, 255, 170, 173, 205, 255,
-    174, 168, 200, 255, 172, 170, 202, 255, 170, 187, 214, 255, 171, 186, 212, 255, 171, 186, 210, 255, 171, 180, 207, 255, 177, 167, 201, 255, 179, 167, 201,
-    255, 175, 183, 208, 255, 174, 206, 226, 255, 175, 187, 212, 255, 176, 197, 218, 255, 175, 202, 223, 255, 175, 214, 233, 255, 176, 212, 231, 255, 183, 204,
-    225, 255, 185, 204, 224, 255, 177, 201, 221, 255, 175, 201, 221, 255, 175, 200, 220, 255, 175, 200, 220, 255, 175, 200, 220, 255, 175, 200, 220, 255, 175,
-    200, 220, 255, 175, 200, 220, 255, 176, 200, 220, 255, 176, 199, 219, 255, 177, 197, 218, 255, 177, 195, 214, 255, 177, 198, 218, 255, 177, 205, 225, 255,
-    227, 243, 248, 255, 231, 245, 249, 255, 234, 247, 250, 255, 96,  101, 102, 255, 1,   1,   1,   255, 207, 214, 215, 255, 243, 250, 252, 255, 245, 250, 252,
-    255, 104, 107, 107, 255, 79,  80,  80,  255, 249, 252, 252, 255, 251, 253, 253, 255, 223, 224, 225, 255, 9,   9,   9,   255, 210, 211, 212, 255, 125, 125,
-    126, 255, 83,  83,  83,  255, 172, 172, 172, 255, 48,  48,  48,  255, 244, 244, 244, 255, 51,  51,  51,  255, 141, 141, 141, 255, 248, 248, 248, 255, 251,
-    251, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 85,  85,  85,  255, 1,   1,   1,   255, 0,   0,   0,   255, 1,   1,   1,   255,
-    48,  48,  48,  255, 101, 101, 101, 255, 161, 162, 162, 255, 253, 254, 254, 255, 250, 251, 251, 255, 77,  77,  78,  255, 77,  77,  77,  255, 250, 250, 251,
-    255, 251, 251, 252, 255, 245, 246, 247, 255, 241, 243, 243, 255, 237, 240, 240, 255, 147, 149, 150, 255, 11,  11,  11,  255, 25,  25,  26,  255, 237, 242,
-    245, 255, 236, 236, 241, 255, 131, 131, 135, 255, 79,  80,  82,  255, 15,  16,  16,  255, 0,   0,   0,   255, 1,   1,   1,   255, 1,   1,   1,   255, 5,
-    5,   5,   255, 185, 189, 201, 255, 202, 203, 221, 255, 197, 198, 217, 255, 194, 194, 214, 255, 192, 192, 213, 255, 195, 207, 222, 255, 190, 202, 219, 255,
-    184, 183, 207, 255, 179, 177, 204, 255, 177, 174, 202, 255, 178, 172, 201, 255, 179, 173, 202, 255, 182, 192, 215, 255, 182, 183, 208, 255, 179, 200, 221,
-    255, 163, 223, 240, 255, 163, 223, 240, 255, 163, 223, 239, 255, 164, 222, 239, 255, 164, 222, 239, 255, 166, 221, 239, 255, 215, 220, 225, 255, 218, 204,
-    210, 255, 228, 218, 220, 255, 238, 231, 231, 255, 228, 220, 222, 255, 210, 198, 207, 255, 195, 182, 200, 255, 187, 171, 197, 255, 185, 170, 198, 255, 182,
-    177, 201, 255, 177, 173, 200, 255, 177, 176, 202, 255, 171, 183, 211, 255, 170, 180, 209, 255, 170, 174, 205, 255, 170, 174, 205, 255, 171, 173, 204, 255,
-    174, 170, 201, 255, 170, 175, 205, 255, 170, 187, 213, 255, 170, 183, 210, 255, 171, 182, 208, 255, 176, 173, 204, 255, 179, 169, 201, 255, 181, 169, 202,
-    255, 173, 192, 214, 255, 174, 203, 223, 255, 176, 181, 208, 255, 175, 199, 219, 255, 176, 196, 217, 255, 176, 215, 233, 255, 176, 216, 234, 255, 181, 204,
-    224, 255, 191, 206, 226, 255, 175, 202, 221, 255, 174, 202, 221, 255, 175, 201, 221, 255, 174, 201, 220, 255, 174, 201, 220, 255, 174, 200, 220, 255, 174,
-    200, 220, 255, 174, 200, 220, 255, 174, 200, 219, 255, 174, 199, 218, 255, 175, 197, 217, 255, 176, 193, 213, 255, 176, 196, 216, 255, 176, 203, 224, 255,
-    227, 246, 250, 255, 231, 247, 251, 255, 234, 248, 251, 255, 97,  102, 103, 255, 1,   1,   1,   255, 207, 215, 216, 255, 244, 251, 253, 255, 246, 251, 252,
-    255, 105, 107, 107, 255, 76,  77,  77,  255, 250, 252, 253, 255, 251, 253, 254, 255, 223, 224, 225, 255, 9,   9,   9,   255, 210, 211, 211, 255, 175, 176,
-    176, 255, 49,  49,  49,  255, 133, 133, 133, 255, 95,  95,  95,  255, 253, 253, 253, 255, 50,  50,  50,  255, 22,  22,  22,  255, 38,  38,  38,  255, 141,
-    141, 141, 255, 253, 253, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 85,  85,  85,  255, 1,   1,   1,   255, 0,   0,   0,   255, 1,   1,   1,   255,
-    120, 120, 120, 255, 252, 252, 252, 255, 253, 253, 253, 255, 253, 253, 253, 255, 179, 179, 180, 255, 11,  11,  11,  255, 135, 135, 135, 255, 252, 253, 253,
-    255, 251, 253, 254, 255, 211, 214, 214, 255, 193, 196, 196, 255, 244, 249, 250, 255, 246, 251, 252, 255, 102, 104, 105, 255, 41,  41,  42,  255, 239, 240,
-    244, 255, 235, 235, 241, 255, 233, 238, 243, 255, 232, 247, 251, 255, 189, 203, 206, 255, 31,  33,  34,  255, 2,   2,   2,   255, 1,   1,   1,   255, 6,
-    6,   6,   255, 191, 216, 222, 255, 208, 237, 246, 255, 199, 222, 235, 255, 196, 214, 228, 255, 195, 212, 226, 255, 193, 204, 221, 255, 187, 193, 214, 255,
-    181, 181, 207, 255, 178, 178, 204, 255, 177, 175, 202, 255, 181, 174, 202, 255, 180, 174, 202, 255, 203, 211, 219, 255, 191, 202, 215, 255, 187, 224, 233,
-    255, 164, 230, 245, 255, 164, 229, 244, 255, 165, 228, 244, 255, 165, 227, 244, 255, 166, 227, 243, 255, 185, 226, 238, 255, 223, 210, 213, 255, 213, 199,
-    207, 255, 211, 196, 205, 255, 234, 226, 226, 255, 226, 214, 218, 255, 209, 195, 205, 255, 195, 182, 200, 255, 189, 174, 198, 255, 187, 171, 198, 255, 183,
-    176, 200, 255, 176, 172, 199, 255, 178, 174, 200, 255, 175, 172, 202, 255, 172, 176, 206, 255, 171, 177, 207, 255, 171, 175, 205, 255, 172, 173, 203, 255,
-    171, 174, 204, 255, 171, 184, 209, 255, 172, 183, 210, 255, 170, 182, 208, 255, 174, 176, 205, 255, 180, 171, 202, 255, 182, 173, 203, 255, 180, 176, 204,
-    255, 174, 191, 212, 255, 176, 197, 218, 255, 177, 181, 208, 255, 175, 193, 214, 255, 175, 197, 218, 255, 176, 214, 232, 255, 177, 221, 238, 255, 176, 207,
-    226, 255, 192, 207, 227, 255, 175, 200, 219, 255, 174, 199, 218, 255, 174, 199, 218, 255, 174, 199, 218, 255, 174, 199, 218, 255, 173, 199, 218, 255, 174,
-    198, 218, 255, 174, 198, 218, 255, 174, 197, 217, 255, 174, 196, 216, 255, 174, 195, 214, 255, 174, 193, 212, 255, 175, 195, 214, 255, 175, 202, 222, 255,
-    227, 245, 249, 255, 231, 246, 250, 255, 234, 248, 251, 255, 97,  101, 102, 255, 1,   1,   1,   255, 207, 214, 216, 255, 244, 250, 252, 255, 245, 250, 251,
-    255, 104, 107, 107, 255, 72,  73,  73,  255, 249, 252, 252, 255, 251, 253, 253, 255, 223, 224, 225, 255, 9,   9,   9,   255, 209, 210, 210, 255, 214, 215,
-    215, 255, 32,  32,  32,  255, 68,  69,  69,  255, 149, 149, 149, 255, 253, 253, 253, 255, 51,  51,  51,  255, 114, 114, 114, 255, 201, 201, 201, 255, 226,
-    226, 226, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 84,  84,  84,  255, 1,   1,   1,   255, 0,   0,   0,   255, 1,   1,   1,   255,
-    61,  61,  61,  255, 118, 118, 118, 255, 167, 168, 168, 255, 253, 254, 254, 255, 249, 250, 250, 255, 109, 109, 109, 255, 148, 148, 149, 255, 253, 254, 254,
-    255, 245, 247, 247, 255, 43,  43,  43,  255, 12,  12,  12,  255, 193, 194, 195, 255, 245, 246, 248, 255, 161, 162, 164, 255, 31,  31,  32,  255, 109, 111,
-    112, 255, 89,  91,  92,  255, 142, 147, 148, 255, 240, 251, 254, 255, 237, 249, 252, 255, 120, 127, 130, 255, 3,   3,   3,   255, 2,   2,   2,   255, 6,
-    7,   7,   255, 198, 219, 225, 255, 218, 245, 253, 255, 214, 244, 252, 255, 209, 243, 251, 255, 198, 236, 246, 255, 193, 212, 228, 255, 188, 199, 217, 255,
-    189, 189, 210, 255, 179, 178, 204, 255, 178, 176, 202, 255, 181, 174, 202, 255, 182, 173, 202, 255, 173, 217, 233, 255, 168, 202, 223, 255, 166, 222, 239,
-    255, 165, 225, 241, 255, 166, 224, 240, 255, 166, 224, 240, 255, 167, 223, 239, 255, 167, 222, 239, 255, 187, 222, 233, 255, 212, 195, 206, 255, 204, 186,
-    201, 255, 207, 190, 203, 255, 230, 221, 223, 255, 226, 215, 217, 255, 213, 198, 207, 255, 206, 192, 204, 255, 195, 180, 200, 255, 191, 175, 199, 255, 189,
-    174, 200, 255, 182, 175, 200, 255, 177, 173, 200, 255, 178, 172, 200, 255, 179, 172, 202, 255, 176, 173, 203, 255, 176, 173, 204, 255, 176, 175, 205, 255,
-    174, 181, 207, 255, 173, 182, 208, 255, 173, 180, 208, 255, 174, 177, 205, 255, 176, 179, 206, 255, 179, 180, 207, 255, 181, 176, 204, 255, 179, 180, 207,
-    255, 175, 190, 211, 255, 184, 193, 214, 255, 177, 183, 209, 255, 176, 186, 210, 255, 175, 195, 216, 255, 176, 211, 230, 255, 176, 219, 236, 255, 175, 214,
-    231, 255, 191, 212, 230, 255, 176, 203, 221, 255, 174, 201, 220, 255, 174, 201, 220, 255, 174, 201, 220, 255, 174, 201, 220, 255, 173, 201, 220, 255, 173,
-    201, 220, 255, 173, 201, 220, 255, 173, 200, 220, 255, 173, 199, 218, 255, 173, 197, 216, 255, 173, 194, 213, 255, 174, 197, 215, 255, 173, 205, 224, 255,
-    227, 244, 248, 255, 231, 246, 250, 255, 233, 247, 250, 255, 97,  101, 102, 255, 1,   1,   1,   255, 207, 214, 216, 255, 244, 250, 252, 255, 246, 251, 252,
-    255, 105, 107, 107, 255, 69,  70,  70,  255, 249, 251, 252, 255, 250, 252, 253, 255, 223, 224, 225, 255, 9,   9,   9,   255, 210, 210, 211, 255, 246, 247,
-    247, 255, 39,  39,  39,  255, 12,  12,  12,  255, 199, 199, 199, 255, 253, 253, 253, 255, 51,  51,  51,  255, 142, 142, 142, 255, 253, 253, 253, 255, 254,
-    254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 84,  84,  84,  255, 1,   1,   1,   255, 0,   0,   0,   255, 0,   0,   0,   255,
-    1,   1,   1,   255, 3,   3,   3,   255, 34,  34,  34,  255, 251, 252, 252, 255, 253, 254, 254, 255, 182, 182, 182, 255, 109, 109, 110, 255, 251, 252, 253,
-    255, 248, 249, 250, 255, 63,  63,  63,  255, 19,  19,  19,  255, 203, 205, 206, 255, 247, 250, 252, 255, 146, 149, 150, 255, 2,   2,   2,   255, 3,   3,
-    3,   255, 3,   3,   3,   255, 7,   7,   7,   255, 222, 236, 239, 255, 231, 248, 252, 255, 136, 147, 150, 255, 3,   3,   3,   255, 2,   2,   2,   255, 7,
-    7,   7,   255, 190, 217, 224, 255, 209, 243, 251, 255, 205, 242, 250, 255, 201, 240, 249, 255, 194, 237, 247, 255, 191, 229, 241, 255, 190, 211, 226, 255,
-    193, 197, 213, 255, 180, 179, 204, 255, 177, 176, 202, 255, 182, 175, 201, 255, 176, 174, 202, 255, 177, 190, 213, 255, 169, 219, 236, 255, 166, 228, 243,
-    255, 167, 227, 243, 255, 167, 227, 242, 255, 168, 227, 242, 255, 169, 226, 242, 255, 169, 226, 241, 255, 171, 226, 241, 255, 182, 216, 232, 255, 195, 205,
-    220, 255, 231, 223, 223, 255, 231, 223, 223, 255, 225, 212, 215, 255, 215, 200, 208, 255, 220, 207, 212, 255, 204, 190, 204, 255, 197, 180, 200, 255, 196,
-    179, 201, 255, 194, 178, 201, 255, 186, 177, 202, 255, 181, 176, 202, 255, 184, 176, 202, 255, 184, 176, 201, 255, 184, 177, 203, 255, 181, 179, 206, 255,
-    176, 185, 210, 255, 175, 191, 212, 255, 175, 180, 207, 255, 175, 179, 207, 255, 177, 184, 209, 255, 176, 189, 213, 255, 177, 185, 210, 255, 183, 182, 207,
-    255, 177, 194, 213, 255, 186, 185, 209, 255, 179, 185, 208, 255, 181, 181, 206, 255, 178, 189, 211, 255, 175, 207, 225, 255, 176, 211, 229, 255, 176, 216,
-    232, 255, 189, 215, 233, 255, 176, 203, 221, 255, 174, 203, 220, 255, 174, 202, 220, 255, 174, 202, 219, 255, 173, 201, 219, 255, 173, 200, 219, 255, 173,
-    200, 219, 255, 173, 200, 218, 255, 172, 198, 217, 255, 172, 197, 216, 255, 172, 196, 215, 255, 172, 193, 212, 255, 172, 194, 214, 255, 173, 203, 222, 255,
-    227, 246, 251, 255, 231, 248, 252, 255, 234, 249, 252, 255, 96,  102, 103, 255, 1,   1,   1,   255, 207, 215, 216, 255, 244, 251, 253, 255, 246, 251, 252,
-    255, 105, 107, 108, 255, 42,  42,  42,  255, 150, 151, 151, 255, 152, 153, 154, 255, 212, 214, 215, 255, 9,   9,   9,   255, 210, 211, 211, 255, 251, 252,
-    252, 255, 87,  87,  87,  255, 22,  22,  22,  255, 240, 240, 240, 255, 253, 253, 253, 255, 51,  51,  51,  255, 86,  86,  86,  255, 150, 150, 150, 255, 171,
-    171, 171, 255, 250, 250, 250, 255, 255, 255, 255, 255, 255, 255, 255, 255, 84,  84,  84,  255, 1,   1,   1,   255, 2,   2,   2,   255, 34,  34,  34,  255,
-    39,  39,  39,  255, 65,  65,  65,  255, 180, 181, 181, 255, 253, 254, 254, 255, 252, 253, 253, 255, 129, 129, 129, 255, 30,  30,  30,  255, 223, 224, 225,
-    255, 250, 251, 252, 255, 223, 225, 226, 255, 203, 206, 207, 255, 248, 252, 253, 255, 232, 237, 238, 255, 54,  55,  55,  255, 14,  15,  15,  255, 12,  12,
-    12,  255, 18,  20,  20,  255, 106, 111, 113, 255, 238, 250, 253, 255, 232, 245, 249, 255, 87,  92,  93,  255, 4,   4,   4,   255, 3,   3,   3,   255, 8,
-    8,   8,   255, 199, 220, 225, 255, 221, 246, 253, 255, 218, 244, 252, 255, 213, 244, 252, 255, 203, 242, 251, 255, 206, 242, 252, 255, 194, 225, 239, 255,
-    205, 213, 221, 255, 182, 181, 205, 255, 178, 177, 202, 255, 182, 175, 202, 255, 179, 182, 208, 255, 186, 229, 243, 255, 171, 233, 247, 255, 168, 232, 246,
-    255, 169, 231, 246, 255, 170, 230, 245, 255, 170, 229, 245, 255, 170, 229, 243, 255, 171, 228, 243, 255, 172, 228, 243, 255, 172, 227, 243, 255, 179, 225,
-    241, 255, 225, 213, 218, 255, 217, 202, 210, 255, 207, 187, 200, 255, 223, 209, 214, 255, 224, 213, 216, 255, 211, 197, 207, 255, 201, 184, 202, 255, 202,
-    185, 203, 255, 202, 186, 203, 255, 202, 186, 204, 255, 199, 186, 205, 255, 193, 182, 204, 255, 188, 181, 205, 255, 184, 187, 210, 255, 180, 203, 224, 255,
-    177, 209, 226, 255, 177, 195, 215, 255, 178, 185, 210, 255, 177, 197, 214, 255, 177, 204, 219, 255, 180, 194, 215, 255, 179, 195, 216, 255, 186, 183, 207,
-    255, 183, 195, 214, 255, 187, 185, 209, 255, 184, 185, 208, 255, 186, 182, 207, 255, 184, 187, 209, 255, 177, 204, 222, 255, 177, 203, 220, 255, 176, 208,
-    225, 255, 180, 209, 227, 255, 176, 203, 220, 255, 175, 202, 219, 255, 174, 201, 219, 255, 174, 200, 218, 255, 174, 200, 218, 255, 173, 200, 218, 255, 173,
-    199, 218, 255, 172, 199, 218, 255, 172, 198, 217, 255, 172, 197, 216, 255, 171, 196, 215, 255, 172, 193, 211, 255, 172, 194, 213, 255, 171, 202, 221, 255,
-    226, 244, 248, 255, 230, 245, 249, 255, 233, 247, 250, 255, 96,  101, 102, 255, 1,   1,   1,   255, 206, 214, 216, 255, 243, 250, 252, 255, 245, 251, 252,
-    255, 136, 138, 139, 255, 59,  60,  60,  255, 59,  60,  60,  255, 65,  66,  66,  255, 208, 210, 211, 255, 62,  62,  62,  255, 218, 219, 220, 255, 252, 253,
-    253, 255, 162, 163, 163, 255, 102, 102, 102, 255, 253, 254, 254, 255, 254, 254, 254, 255, 91,  91,  91,  255, 56,  56,  56,  255, 55,  55,  55,  255, 95,
-    95,  95,  255, 246, 246, 246, 255, 255, 255, 255, 255, 254, 254, 254, 255, 83,  83,  83,  255, 1,   1,   1,   255, 9,   9,   9,   255, 191, 191, 191, 255,
-    237, 237, 237, 255, 246, 246, 246, 255, 252, 252, 252, 255, 251, 251, 252, 255, 168, 168, 168, 255, 16,  16,  16,  255, 1,   1,   1,   255, 46,  46,  46,
-    255, 171, 172, 172, 255, 232, 234, 234, 255, 236, 238, 238, 255, 183, 186, 186, 255, 61,  62,  62,  255, 4,   4,   4,   255, 98,  100, 101, 255, 218, 224,
-    225, 255, 220, 227, 229, 255, 236, 245, 248, 255, 238, 249, 252, 255, 155, 165, 167, 255, 12,  13,  13,  255, 4,   4,   4,   255, 4,   4,   4,   255, 9,
-    9,   9,   255, 196, 219, 224, 255, 215, 244, 252, 255, 211, 243, 251, 255, 206, 242, 250, 255, 198, 239, 248, 255, 198, 239, 248, 255, 191, 221, 233, 255,
-    192, 195, 212, 255, 184, 183, 206, 255, 179, 178, 203, 255, 178, 176, 201, 255, 178, 175, 202, 255, 188, 194, 216, 255, 173, 228, 242, 255, 170, 226, 241,
-    255, 171, 225, 240, 255, 172, 225, 240, 255, 172, 225, 239, 255, 173, 224, 239, 255, 174, 224, 239, 255, 174, 224, 239, 255, 175, 223, 240, 255, 176, 223,
-    240, 255, 205, 221, 230, 255, 229, 217, 219, 255, 227, 216, 219, 255, 234, 224, 222, 255, 228, 216, 217, 255, 215, 200, 209, 255, 206, 189, 203, 255, 207,
-    190, 204, 255, 207, 191, 205, 255, 208, 194, 208, 255, 202, 200, 213, 255, 198, 197, 213, 255, 185, 197, 215, 255, 180, 207, 224, 255, 180, 213, 229, 255,
-    180, 204, 221, 255, 181, 186, 210, 255, 186, 189, 211, 255, 183, 201, 216, 255, 179, 218, 229, 255, 182, 214, 227, 255, 188, 189, 211, 255, 188, 184, 208,
-    255, 187, 193, 212, 255, 187, 186, 209, 255, 187, 184, 208, 255, 190, 186, 208, 255, 187, 190, 210, 255, 179, 199, 217, 255, 184, 198, 216, 255, 183, 203,
-    219, 255, 180, 208, 224, 255, 178, 206, 222, 255, 176, 204, 221, 255, 175, 204, 221, 255, 174, 204, 221, 255, 174, 203, 220, 255, 173, 203, 220, 255, 173,
-    203, 220, 255, 172, 202, 220, 255, 171, 201, 219, 255, 171, 200, 218, 255, 171, 198, 216, 255, 171, 195, 213, 255, 171, 196, 214, 255, 170, 204, 223, 255,
-    226, 246, 251, 255, 230, 248, 252, 255, 233, 249, 252, 255, 96,  102, 103, 255, 1,   1,   1,   255, 205, 213, 215, 255, 243, 251, 252, 255, 246, 252, 253,
-    255, 246, 251, 252, 255, 247, 251, 252, 255, 248, 251, 252, 255, 249, 251, 252, 255, 251, 253, 254, 255, 250, 252, 252, 255, 252, 253, 253, 255, 253, 254,
-    254, 255, 252, 252, 253, 255, 251, 251, 252, 255, 253, 253, 254, 255, 254, 254, 254, 255, 252, 252, 252, 255, 252, 252, 252, 255, 252, 252, 252, 255, 252,
-    252, 252, 255, 254, 254, 254, 255, 254, 254, 254, 255, 254, 254, 254, 255, 83,  83,  83,  255, 1,   1,   1,   255, 2,   2,   2,   255, 112, 112, 112, 255,
-    179, 179, 179, 255, 177, 177, 177, 255, 148, 148, 148, 255, 69,  69,  69,  255, 4,   4,   4,   255, 0,   0,   0,   255, 0,   0,   0,   255, 1,   1,   1,
-    255, 1,   1,   1,   255, 2,   3,   3,   255, 5,   5,   5,   255, 2,   2,   2,   255, 2,   2,   2,   255, 2,   2,   2,   255, 35,  36,  36,  255, 198, 206,
-    207, 255, 200, 209, 211, 255, 168, 177, 179, 255, 89,  94,  96,  255, 8,   8,   8,   255, 5,   5,   5,   255, 4,   4,   4,   255, 5,   5,   5,   255, 10,
-    10,  10,  255, 193, 218, 224, 255, 214, 244, 251, 255, 210, 243, 251, 255, 207, 242, 250, 255, 199, 239, 249, 255, 200, 240, 250, 255, 194, 207, 221, 255,
-    189, 189, 209, 255, 183, 181, 205, 255, 180, 178, 203, 255, 179, 177, 201, 255, 178, 176, 201, 255, 183, 179, 204, 255, 176, 232, 246, 255, 173, 232, 246,
-    255, 172, 232, 246, 255, 173, 232, 246, 255, 174, 231, 245, 255, 175, 231, 245, 255, 176, 231, 245, 255, 177, 231, 245, 255, 177, 230, 245, 255, 178, 230,
-    245, 255, 194, 228, 240, 255, 233, 223, 225, 255, 228, 217, 219, 255, 233, 224, 223, 255, 229, 217, 218, 255, 215, 201, 209, 255, 210, 193, 205, 255, 211,
-    195, 207, 255, 209, 201, 213, 255, 201, 209, 222, 255, 196, 208, 222, 255, 200, 199, 214, 255, 191, 197, 215, 255, 183, 213, 228, 255, 183, 217, 232, 255,
-    184, 207, 224, 255, 187, 186, 210, 255, 195, 188, 208, 255, 192, 195, 213, 255, 185, 220, 229, 255, 195, 231, 237, 255, 203, 217, 225, 255, 209, 201, 216,
-    255, 209, 205, 219, 255, 204, 205, 219, 255, 205, 198, 216, 255, 201, 198, 215, 255, 192, 198, 215, 255, 184, 199, 217, 255, 195, 196, 213, 255, 192, 204,
-    219, 255, 180, 207, 223, 255, 179, 205, 222, 255, 176, 204, 220, 255, 176, 203, 220, 255, 175, 203, 219, 255, 174, 203, 219, 255, 173, 202, 219, 255, 173,
-    201, 218, 255, 172, 200, 218, 255, 172, 199, 218, 255, 171, 198, 216, 255, 171, 197, 215, 255, 170, 194, 212, 255, 170, 194, 212, 255, 169, 201, 220, 255,
-    225, 244, 249, 255, 229, 246, 250, 255, 232, 247, 250, 255, 96,  101, 103, 255, 1,   1,   1,   255, 87,  90,  91,  255, 133, 137, 138, 255, 134, 138, 139,
-    255, 135, 138, 139, 255, 136, 139, 139, 255, 136, 139, 139, 255, 138, 139, 139, 255, 138, 139, 140, 255, 138, 139, 140, 255, 139, 139, 140, 255, 139, 139,
-    140, 255, 139, 139, 140, 255, 139, 139, 140, 255, 140, 140, 140, 255, 140, 140, 140, 255, 140, 140, 140, 255, 140, 140, 140, 255, 140, 140, 140, 255, 140,
-    140, 140, 255, 140, 140, 140, 255, 144, 145, 145, 255, 237, 237, 237, 255, 82,  82,  82,  255, 1,   1,   1,   255, 0,   0,   0,   255, 1,   1,   1,   255,
-    1,   1,   1,   255, 1,   1,   1,   255, 2,   2,   2,   255, 1,   1,   1,   255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,   255, 0,   0,   0,
-    255, 0,   0,   0,   255, 0,   0,   0,   255, 1,   1,   1,   255, 1,   1,   1,   255, 0,   0,   0,   255, 1,   1,   1,   255, 1,   1,   1,   255, 7,   7,
-    7,   255, 9,   9,   9,   255, 4,   4,   4,   255, 4,   4,   4,   255, 4,   4,   4,   255, 4,   4,   4,   255, 5,   5,   5,   255, 6,   6,   6,   255, 12,
-    12,  12,  255, 202, 220, 226, 255, 223, 246, 253, 255, 220, 245, 253, 255, 215, 245, 252, 255, 205, 242, 251, 255, 207, 242, 252, 255, 195, 208, 222, 255,
-    189, 189, 209, 255, 183, 182, 205, 255, 181, 179, 203, 255, 180, 178, 201, 255, 180, 177, 201, 255, 181, 177, 202, 255, 179, 229, 243, 255, 174, 231, 245,
-    255, 175, 231, 244, 255, 176, 230, 244, 255, 177, 229, 243, 255, 178, 229, 243, 255, 178, 228, 242, 255, 179, 228, 242, 255, 180, 227, 242, 255, 180, 227,
-    242, 255, 192, 226, 240, 255, 230, 220, 222, 255, 230, 219, 220, 255, 232, 223, 222, 255, 225, 213, 216, 255, 215, 200, 208, 255, 213, 198, 210, 255, 211,
-    205, 218, 255, 210, 206, 219, 255, 212, 202, 214, 255, 212, 200, 212, 255, 207, 197, 212, 255, 194, 203, 218, 255, 186, 216, 230, 255, 186, 223, 236, 255,
-    192, 199, 217, 255, 195, 189, 210, 255, 200, 190, 209, 255, 204, 195, 210, 255, 207, 213, 221, 255, 225, 227, 226, 255, 235, 220, 215, 255, 236, 224, 223,
-    255, 242, 232, 232, 255, 244, 234, 234, 255, 245, 235, 234, 255, 244, 235, 235, 255, 233, 228, 233, 255, 203, 210, 223, 255, 200, 197, 213, 255, 199, 206,
-    221, 255, 181, 207, 222, 255, 183, 206, 223, 255, 180, 205, 221, 255, 182, 205, 221, 255, 177, 204, 220, 255, 175, 203, 219, 255, 175, 202, 219, 255, 174,
-    202, 219, 255, 173, 201, 218, 255, 172, 200, 218, 255, 171, 199, 217, 255, 171, 198, 215, 255, 170, 194, 212, 255, 170, 194, 212, 255, 169, 202, 219, 255,
-    224, 245, 250, 255, 228, 246, 251, 255, 231, 248, 251, 255, 101, 107, 109, 255, 2,   2,   2,   255, 2,   2,   2,   255, 2,   2,   2,   255, 2,   2,   2,
-    255, 2,   2,   2,   255, 2,   2,   2,   255, 2,   2,   2,   255, 2,   2,   2,   255, 2,   2,   2,   255, 2,   2,   2,   255, 2,   2,   2,   255, 2,   2,
-    2,   255, 2,   2,   2,   255, 2,   2,   2,   255, 2,   2,   2,   255, 2,   2,   2,   255, 2,   2,   2,   255, 2,   2,   2,   255, 2,   2,   2,   255, 2,
-    2,   2,   255, 2,   2,   2,   255, 13,  13,  13,  255, 217, 217, 217, 255, 82,  82,  82,  255, 2,   2,   2,   255, 1,   1,   1,   255, 1,   1,   1,   255,
-    1,   1,   1,   255, 1,   1,   1,   255, 1,   1,   1,   255, 1,   1,   1,   255, 1,   1,   1,   255, 1,   1,   1,   255, 1,   1,   1,   255, 1,   1,   1,
-    255, 1,   1,   1,   255, 2,   2,   2,   255, 2,   2,   2,   255, 2,   2,   2,   255, 1,   1,   1,   255, 2,   2,   2,   255, 3,   3,   3,   255, 3,   3,
-    3,   255, 3,   3,   3,   255, 4,   4,   4,   255, 5,   5,   5,   255, 6,   6,   6,   255, 7,   7,   7,   255, 8,   8,   8,   255, 9,   9,   9,   255, 18,
-    19,  20,  255, 195, 221, 227, 255, 211, 243, 250, 255, 207, 242, 250, 255, 203, 241, 249, 255, 197, 237, 247, 255, 196, 238, 248, 255, 194, 208, 222, 255,
-    190, 190, 210, 255, 185, 182, 207, 255, 182, 180, 203, 255, 182, 179, 202, 255, 181, 178, 202, 255, 182, 178, 202, 255, 184, 221, 237, 255, 177, 229, 242,
-    255, 177, 228, 242, 255, 179, 228, 242, 255, 179, 228, 241, 255, 180, 228, 242, 255, 181, 228, 242, 255, 182, 227, 241, 255, 183, 227, 241, 255, 184, 227,
-    242, 255, 185, 227, 242, 255, 223, 226, 230, 255, 235, 226, 226, 255, 227, 216, 219, 255, 218, 204, 211, 255, 215, 199, 209, 255, 217, 203, 213, 255, 218,
-    205, 214, 255, 218, 201, 211, 255, 216, 200, 210, 255, 213, 199, 211, 255, 209, 198, 212, 255, 203, 203, 217, 255, 191, 215, 228, 255, 196, 209, 223, 255,
-    200, 193, 212, 255, 205, 196, 211, 255, 211, 200, 211, 255, 222, 208, 212, 255, 234, 221, 215, 255, 239, 224, 214, 255, 234, 219, 215, 255, 232, 217, 217,
-    255, 243, 229, 227, 255, 246, 233, 231, 255, 248, 236, 233, 255, 248, 237, 233, 255, 248, 237, 233, 255, 244, 236, 236, 255, 220, 219, 227, 255, 202, 212,
-    227, 255, 185, 211, 226, 255, 180, 209, 224, 255, 180, 208, 223, 255, 180, 207, 223, 255, 177, 206, 222, 255, 176, 206, 222, 255, 175, 205, 221, 255, 174,
-    205, 221, 255, 173, 204, 221, 255, 172, 203, 220, 255, 172, 202, 219, 255, 170, 200, 217, 255, 169, 197, 214, 255, 168, 195, 213, 255, 168, 204, 221, 255,
-    223, 246, 251, 255, 227, 247, 251, 255, 231, 248, 252, 255, 196, 209, 212, 255, 107, 112, 113, 255, 99,  103, 103, 255, 100, 103, 104, 255, 100, 102, 103,
-    255, 101, 101, 102, 255, 101, 102, 102, 255, 102, 102, 103, 255, 103, 103, 104, 255, 104, 104, 105, 255, 105, 105, 105, 255, 105, 106, 106, 255, 106, 106,
-    106, 255, 106, 106, 106, 255, 106, 106, 107, 255, 106, 106, 106, 255, 106, 106, 106, 255, 106, 106, 106, 255, 106, 106, 106, 255, 106, 106, 107, 255, 106,
-    106, 107, 255, 107, 107, 107, 255, 112, 112, 112, 255, 232, 232, 232, 255, 152, 153, 153, 255, 107, 108, 108, 255, 107, 107, 108, 255, 107, 107, 107, 255,
-    107, 107, 107, 255, 107, 108, 108, 255, 107, 107, 108, 255, 107, 108, 108, 255, 107, 107, 108, 255, 107, 107, 108, 255, 107, 107, 107, 255, 106, 107, 108,
-    255, 106, 107, 107, 255, 106, 108, 108, 255, 105, 108, 108, 255, 104, 107, 107, 255, 104, 107, 108, 255, 104, 107, 108, 255, 103, 107, 108, 255, 103, 107,
-    108, 255, 102, 108, 109, 255, 102, 108, 109, 255, 101, 108, 110, 255, 101, 108, 110, 255, 100, 109, 111, 255, 100, 109, 112, 255, 99,  110, 112, 255, 138,
-    153, 156, 255, 221, 244, 250, 255, 221, 246, 252, 255, 218, 245, 252, 255, 215, 244, 252, 255, 207, 242, 251, 255, 209, 242, 251, 255, 196, 211, 224, 255,
-    191, 191, 210, 255, 186, 184, 207, 255, 184, 181, 204, 255, 184, 180, 203, 255, 183, 179, 203, 255, 183, 179, 203, 255, 188, 223, 238, 255, 181, 235, 248,
-    255, 181, 235, 247, 255, 182, 235, 247, 255, 183, 234, 247, 255, 184, 234, 246, 255, 184, 234, 246, 255, 185, 233, 246, 255, 186, 233, 245, 255, 187, 233,
-    245, 255, 187, 232, 245, 255, 213, 229, 236, 255, 232, 220, 222, 255, 220, 206, 213, 255, 218, 201, 210, 255, 221, 204, 212, 255, 223, 206, 213, 255, 222,
-    204, 212, 255, 218, 202, 212, 255, 217, 201, 212, 255, 215, 201, 213, 255, 213, 200, 213, 255, 211, 201, 214, 255, 208, 204, 217, 255, 208, 200, 214, 255,
-    210, 201, 213, 255, 222, 209, 214, 255, 229, 214, 214, 255, 239, 224, 215, 255, 243, 229, 215, 255, 240, 224, 215, 255, 235, 219, 215, 255, 231, 214, 216,
-    255, 242, 225, 223, 255, 244, 228, 224, 255, 248, 234, 229, 255, 249, 236, 231, 255, 249, 237, 232, 255, 250, 237, 233, 255, 246, 237, 235, 255, 227, 226,
-    235, 255, 193, 212, 226, 255, 184, 209, 223, 255, 184, 207, 222, 255, 180, 206, 221, 255, 178, 206, 221, 255, 177, 205, 220, 255, 176, 204, 220, 255, 175,
-    204, 219, 255, 174, 202, 218, 255, 173, 201, 218, 255, 172, 200, 216, 255, 170, 198, 215, 255, 169, 195, 212, 255, 169, 193, 211, 255, 167, 200, 217, 255,
-    222, 243, 248, 255, 226, 245, 249, 255, 229, 246, 250, 255, 232, 247, 251, 255, 235, 248, 251, 255, 238, 250, 252, 255, 241, 250, 253, 255, 243, 247, 250,
-    255, 244, 245, 248, 255, 246, 246, 249, 255, 247, 247, 249, 255, 248, 248, 251, 255, 249, 250, 252, 255, 251, 254, 254, 255, 252, 254, 254, 255, 252, 254,
-    254, 255, 253, 253, 254, 255, 253, 253, 253, 255, 253, 253, 254, 255, 253, 253, 254, 255, 254, 254, 254, 255, 254, 254, 255, 255, 254, 254, 255, 255, 254,
-    254, 254, 255, 254, 255, 255, 255, 254, 254, 254, 255, 254, 254, 255, 255, 254, 255, 255, 255, 254, 255, 255, 255, 254, 254, 254, 255, 254, 254, 254, 255,
-    253, 254, 254, 255, 253, 254, 254, 255, 254, 254, 255, 255, 253, 254, 255, 255, 253, 255, 255, 255, 253, 255, 255, 255, 252, 254, 254, 255, 252, 254, 254,
-    255, 252, 254, 255, 255, 251, 253, 254, 255, 251, 254, 255, 255, 250, 253, 254, 255, 249, 253, 254, 255, 248, 253, 254, 255, 246, 252, 254, 255, 245, 252,
-    254, 255, 244, 251, 254, 255, 242, 251, 254, 255, 239, 250, 254, 255, 237, 250, 254, 255, 236, 249, 254, 255, 233, 248, 254, 255, 230, 248, 254, 255, 227,
-    247, 253, 255, 224, 246, 253, 255, 221, 246, 252, 255, 217, 245, 252, 255, 213, 244, 251, 255, 204, 241, 250, 255, 206, 242, 251, 255, 197, 213, 226, 255,
-    191, 192, 211, 255, 187, 184, 207, 255, 186, 182, 205, 255, 185, 181, 204, 255, 185, 181, 203, 255, 185, 180, 203, 255, 190, 216, 232, 255, 183, 232, 244,
-    255, 184, 231, 243, 255, 185, 230, 243, 255, 186, 230, 243, 255, 187, 230, 242, 255, 187, 230, 242, 255, 189, 229, 241, 255, 189, 228, 241, 255, 190, 228,
-    241, 255, 191, 228, 241, 255, 195, 226, 239, 255, 224, 221, 225, 255, 225, 209, 215, 255, 222, 210, 216, 255, 214, 217, 226, 255, 206, 220, 230, 255, 216,
-    214, 222, 255, 216, 203, 214, 255, 216, 202, 214, 255, 216, 203, 214, 255, 216, 204, 215, 255, 217, 206, 216, 255, 216, 206, 216, 255, 216, 206, 215, 255,
-    230, 216, 216, 255, 237, 222, 216, 255, 241, 226, 217, 255, 245, 231, 217, 255, 244, 230, 217, 255, 239, 224, 216, 255, 228, 213, 216, 255, 235, 217, 219,
-    255, 241, 223, 222, 255, 242, 225, 223, 255, 248, 235, 230, 255, 249, 236, 229, 255, 249, 236, 230, 255, 250, 236, 230, 255, 250, 238, 232, 255, 247, 237,
-    236, 255, 214, 223, 232, 255, 186, 211, 224, 255, 182, 209, 223, 255, 182, 208, 222, 255, 180, 207, 222, 255, 179, 206, 221, 255, 178, 205, 220, 255, 176,
-    204, 220, 255, 175, 203, 219, 255, 174, 203, 219, 255, 172, 201, 218, 255, 171, 199, 216, 255, 169, 196, 213, 255, 169, 194, 211, 255, 167, 201, 217, 255,
-    221, 246, 251, 255, 226, 247, 252, 255, 230, 248, 252, 255, 233, 249, 253, 255, 236, 250, 253, 255, 240, 251, 254, 255, 242, 251, 253, 255, 242, 243, 247,
-    255, 243, 244, 248, 255, 245, 245, 248, 255, 246, 246, 249, 255, 248, 248, 250, 255, 249, 249, 251, 255, 250, 251, 252, 255, 250, 251, 252, 255, 251, 252,
-    253, 255, 252, 253, 254, 255, 253, 254, 254, 255, 253, 254, 255, 255, 254, 255, 255, 255, 254, 255, 255, 255, 253, 253, 254, 255, 254, 254, 254, 255, 254,
-    254, 254, 255, 254, 255, 255, 255, 254, 255, 255, 255, 254, 255, 255, 255, 254, 254, 254, 255, 253, 254, 254, 255, 253, 254, 254, 255, 253, 254, 254, 255,
-    253, 254, 254, 255, 253, 254, 254, 255, 253, 254, 254, 255, 253, 254, 255, 255, 252, 254, 255, 255, 252, 254, 254, 255, 251, 253, 254, 255, 251, 254, 255,
-    255, 250, 254, 255, 255, 249, 253, 255, 255, 248, 253, 254, 255, 246, 252, 254, 255, 245, 252, 254, 255, 243, 252, 254, 255, 241, 251, 253, 255, 239, 251,
-    254, 255, 236, 250, 254, 255, 234, 250, 253, 255, 232, 249, 253, 255, 229, 248, 253, 255, 226, 247, 252, 255, 223, 247, 252, 255, 221, 246, 252, 255, 218,
-    246, 252, 255, 215, 245, 251, 255, 213, 244, 251, 255, 210, 243, 251, 255, 206, 242, 251, 255, 200, 239, 249, 255, 202, 240, 249, 255, 197, 215, 227, 255,
-    192, 192, 211, 255, 189, 185, 208, 255, 188, 183, 205, 255, 187, 183, 204, 255, 187, 182, 204, 255, 187, 183, 205, 255, 190, 217, 233, 255, 187, 234, 246,
-    255, 187, 233, 245, 255, 188, 233, 245, 255, 189, 233, 245, 255, 190, 233, 245, 255, 191, 233, 244, 255, 192, 233, 244, 255, 193, 232, 244, 255, 193, 232,
-    244, 255, 194, 232, 244, 255, 195, 231, 243, 255, 199, 219, 230, 255, 211, 210, 221, 255, 205, 213, 224, 255, 197, 227, 239, 255, 198, 230, 241, 255, 203,
-    227, 238, 255, 220, 209, 219, 255, 219, 207, 217, 255, 219, 207, 217, 255, 220, 209, 218, 255, 223, 213, 220, 255, 223, 213, 219, 255, 233, 221, 219, 255,
-    240, 226, 219, 255, 243, 230, 219, 255, 244, 230, 218, 255, 245, 234, 219, 255, 244, 230, 218, 255, 233, 219, 217, 255, 221, 207, 215, 255, 231, 214, 218,
-    255, 242, 225, 223, 255, 243, 226, 223, 255, 248, 235, 229, 255, 249, 236, 230, 255, 249, 236, 229, 255, 249, 234, 227, 255, 249, 234, 227, 255, 250, 238,
-    233, 255, 245, 237, 235, 255, 215, 223, 232, 255, 186, 212, 226, 255, 184, 211, 225, 255, 182, 210, 224, 255, 180, 209, 223, 255, 179, 208, 223, 255, 177,
-    207, 222, 255, 176, 206, 222, 255, 175, 205, 221, 255, 173, 204, 220, 255, 172, 201, 217, 255, 171, 199, 214, 255, 170, 196, 213, 255, 169, 202, 218, 255,
-    220, 242, 248, 255, 223, 244, 249, 255, 227, 245, 250, 255, 230, 246, 250, 255, 233, 247, 251, 255, 236, 249, 252, 255, 239, 247, 250, 255, 240, 241, 246,
-    255, 243, 250, 252, 255, 244, 245, 249, 255, 245, 245, 248, 255, 247, 247, 250, 255, 248, 249, 251, 255, 249, 251, 252, 255, 250, 252, 253, 255, 251, 254,
-    254, 255, 252, 254, 254, 255, 252, 254, 255, 255, 252, 254, 254, 255, 253, 254, 254, 255, 253, 253, 254, 255, 253, 254, 254, 255, 253, 254, 255, 255, 253,
-    254, 255, 255, 253, 254, 254, 255, 253, 255, 255, 255, 253, 254, 254, 255, 253, 254, 254, 255, 253, 254, 254, 255, 253, 253, 254, 255, 253, 253, 254, 255,
-    252, 253, 254, 255, 253, 254, 255, 255, 253, 254, 255, 255, 253, 254, 255, 255, 252, 254, 254, 255, 252, 254, 254, 255, 251, 254, 255, 255, 251, 254, 255,
-    255, 250, 253, 254, 255, 250, 253, 254, 255, 249, 253, 255, 255, 248, 253, 254, 255, 247, 252, 254, 255, 246, 252, 254, 255, 245, 252, 254, 255, 243, 252,
-    254, 255, 242, 251, 254, 255, 241, 251, 254, 255, 239, 250, 254, 255, 238, 250, 253, 255, 236, 249, 254, 255, 234, 249, 254, 255, 232, 248, 253, 255, 230,
-    248, 253, 255, 228, 248, 253, 255, 226, 247, 253, 255, 223, 246, 253, 255, 220, 245, 253, 255, 210, 243, 251, 255, 214, 244, 252, 255, 204, 224, 235, 255,
-    193, 192, 211, 255, 190, 185, 208, 255, 190, 185, 206, 255, 190, 184, 205, 255, 189, 184, 206, 255, 191, 185, 207, 255, 194, 232, 244, 255, 192, 237, 249,
-    255, 192, 237, 248, 255, 191, 236, 248, 255, 192, 236, 247, 255, 193, 236, 247, 255, 194, 235, 246, 255, 195, 235, 246, 255, 196, 235, 245, 255, 197, 234,
-    245, 255, 198, 234, 245, 255, 199, 233, 243, 255, 202, 221, 231, 255, 211, 211, 222, 255, 208, 215, 225, 255, 201, 228, 239, 255, 201, 231, 241, 255, 202,
-    231, 240, 255, 223, 225, 229, 255, 228, 217, 222, 255, 226, 215, 221, 255, 226, 217, 222, 255, 229, 221, 224, 255, 233, 223, 223, 255, 241, 228, 221, 255,
-    243, 231, 221, 255, 243, 230, 221, 255, 242, 227, 219, 255, 246, 234, 221, 255, 244, 232, 220, 255, 229, 214, 217, 255, 222, 209, 217, 255, 227, 212, 217,
-    255, 243, 226, 224, 255, 243, 227, 224, 255, 247, 232, 227, 255, 249, 236, 229, 255, 250, 237, 230, 255, 248, 232, 226, 255, 249, 234, 226, 255, 250, 237,
-    230, 255, 249, 238, 232, 255, 246, 236, 236, 255, 211, 220, 230, 255, 188, 211, 224, 255, 184, 210, 223, 255, 182, 208, 222, 255, 181, 207, 221, 255, 180,
-    206, 221, 255, 178, 205, 220, 255, 177, 204, 219, 255, 175, 202, 217, 255, 174, 200, 216, 255, 173, 197, 213, 255, 172, 194, 211, 255, 170, 199, 216, 255,
-    218, 244, 250, 255, 223, 245, 250, 255, 226, 247, 251, 255, 230, 248, 252, 255, 234, 249, 252, 255, 236, 249, 253, 255, 238, 243, 247, 255, 239, 244, 248,
-    255, 244, 252, 254, 255, 245, 251, 253, 255, 244, 245, 248, 255, 246, 247, 250, 255, 247, 249, 251, 255, 249, 250, 252, 255, 251, 254, 254, 255, 252, 254,
-    255, 255, 252, 254, 255, 255, 252, 254, 254, 255, 253, 254, 254, 255, 252, 253, 253, 255, 253, 254, 254, 255, 254, 254, 255, 255, 254, 254, 255, 255, 254,
-    255, 255, 255, 254, 255, 255, 255, 254, 255, 255, 255, 254, 255, 255, 255, 253, 254, 255, 255, 253, 255, 255, 255, 252, 253, 254, 255, 252, 253, 254, 255,
-    252, 253, 253, 255, 253, 254, 255, 255, 253, 254, 255, 255, 252, 254, 254, 255, 252, 254, 254, 255, 252, 254, 254, 255, 251, 253, 254, 255, 251, 254, 255,
-    255, 250, 253, 254, 255, 249, 253, 254, 255, 248, 253, 254, 255, 247, 252, 254, 255, 246, 252, 254, 255, 244, 252, 254, 255, 242, 251, 254, 255, 240, 250,
-    253, 255, 238, 250, 253, 255, 236, 249, 253, 255, 234, 249, 253, 255, 230, 248, 252, 255, 228, 247, 252, 255, 225, 247, 252, 255, 223, 246, 252, 255, 219,
-    245, 251, 255, 216, 244, 251, 255, 213, 243, 251, 255, 210, 243, 251, 255, 208, 241, 250, 255, 201, 238, 248, 255, 202, 239, 249, 255, 200, 235, 245, 255,
-    195, 201, 219, 255, 192, 186, 208, 255, 192, 186, 207, 255, 192, 185, 207, 255, 193, 188, 208, 255, 194, 207, 224, 255, 193, 233, 244, 255, 193, 232, 243,
-    255, 194, 232, 243, 255, 195, 232, 243, 255, 196, 232, 243, 255, 197, 231, 243, 255, 198, 231, 242, 255, 199, 231, 242, 255, 200, 231, 242, 255, 201, 231,
-    242, 255, 201, 231, 241, 255, 202, 230, 240, 255, 205, 221, 231, 255, 214, 214, 224, 255, 211, 216, 227, 255, 204, 228, 238, 255, 205, 230, 240, 255, 205,
-    230, 239, 255, 208, 230, 238, 255, 230, 228, 230, 255, 235, 225, 226, 255, 234, 225, 226, 255, 236, 227, 227, 255, 242, 231, 225, 255, 243, 231, 223, 255,
-    243, 230, 223, 255, 243, 229, 222, 255, 241, 227, 221, 255, 247, 236, 223, 255, 244, 233, 222, 255, 229, 214, 219, 255, 223, 211, 219, 255, 225, 213, 219,
-    255, 243, 226, 224, 255, 244, 227, 225, 255, 246, 230, 226, 255, 249, 235, 229, 255, 250, 237, 230, 255, 248, 233, 227, 255, 251, 239, 231, 255, 251, 237,
-    229, 255, 246, 228, 224, 255, 250, 238, 233, 255, 245, 235, 237, 255, 208, 219, 231, 255, 195, 214, 227, 255, 198, 213, 227, 255, 189, 211, 224, 255, 182,
-    208, 222, 255, 180, 207, 221, 255, 179, 206, 221, 255, 177, 205, 219, 255, 176, 202, 218, 255, 174, 200, 216, 255, 173, 196, 213, 255, 172, 201, 217, 255,
-    217, 243, 249, 255, 221, 245, 250, 255, 225, 246, 251, 255, 228, 247, 251, 255, 231, 248, 252, 255, 234, 247, 251, 255, 235, 236, 242, 255, 239, 248, 251,
-    255, 241, 251, 253, 255, 243, 251, 253, 255, 243, 244, 248, 255, 246, 250, 252, 255, 248, 253, 254, 255, 248, 253, 254, 255, 250, 253, 254, 255, 250, 253,
-    254, 255, 251, 253, 254, 255, 251, 252, 253, 255, 251, 252, 253, 255, 252, 253, 254, 255, 252, 254, 255, 255, 252, 254, 255, 255, 252, 254, 255, 255, 252,
-    254, 254, 255, 252, 254, 254, 255, 252, 254, 254, 255, 252, 254, 254, 255, 252, 254, 254, 255, 252, 254, 254, 255, 252, 253, 253, 255, 251, 253, 253, 255,
-    251, 253, 253, 255, 251, 254, 255, 255, 251, 253, 254, 255, 251, 254, 254, 255, 250, 254, 254, 255, 250, 253, 254, 255, 249, 253, 254, 255, 248, 253, 254,
-    255, 247, 253, 254, 255, 246, 252, 254, 255, 245, 252, 254, 255, 243, 252, 254, 255, 241, 251, 253, 255, 240, 251, 253, 255, 238, 250, 253, 255, 237, 250,
-    253, 255, 235, 249, 253, 255, 233, 249, 253, 255, 231, 248, 252, 255, 229, 247, 253, 255, 227, 247, 252, 255, 225, 246, 252, 255, 223, 246, 252, 255, 221,
-    245, 252, 255, 219, 245, 252, 255, 218, 245, 252, 255, 216, 243, 252, 255, 214, 243, 251, 255, 206, 241, 250, 255, 209, 242, 250, 255, 209, 242, 250, 255,
-    203, 235, 246, 255, 195, 215, 230, 255, 195, 210, 226, 255, 196, 215, 230, 255, 198, 227, 239, 255, 201, 237, 248, 255, 198, 238, 248, 255, 197, 237, 248,
-    255, 197, 237, 248, 255, 198, 237, 248, 255, 199, 237, 248, 255, 200, 237, 247, 255, 202, 237, 247, 255, 202, 237, 246, 255, 203, 237, 246, 255, 204, 236,
-    246, 255, 205, 236, 246, 255, 206, 235, 244, 255, 208, 225, 234, 255, 216, 216, 226, 255, 214, 219, 228, 255, 208, 232, 241, 255, 208, 235, 243, 255, 209,
-    235, 243, 255, 209, 234, 243, 255, 214, 235, 242, 255, 239, 233, 231, 255, 239, 230, 229, 255, 240, 232, 229, 255, 244, 234, 225, 255, 242, 230, 224, 255,
-    244, 233, 225, 255, 242, 229, 224, 255, 238, 224, 222, 255, 247, 236, 225, 255, 244, 232, 224, 255, 228, 215, 221, 255, 225, 214, 221, 255, 226, 215, 221,
-    255, 242, 226, 225, 255, 244, 228, 226, 255, 244, 228, 225, 255, 248, 235, 229, 255, 250, 238, 231, 255, 249, 236, 230, 255, 251, 239, 231, 255, 251, 239,
-    231, 255, 246, 228, 223, 255, 248, 232, 227, 255, 249, 237, 233, 255, 241, 234, 237, 255, 243, 229, 239, 255, 238, 223, 236, 255, 225, 220, 233, 255, 212,
-    216, 230, 255, 194, 211, 225, 255, 181, 208, 222, 255, 179, 206, 221, 255, 178, 205, 219, 255, 176, 202, 217, 255, 175, 197, 213, 255, 173, 202, 218, 255,
-    214, 240, 247, 255, 218, 242, 248, 255, 222, 244, 249, 255, 225, 245, 250, 255, 229, 246, 251, 255, 231, 241, 247, 255, 233, 237, 243, 255, 238, 250, 252,
-    255, 240, 250, 253, 255, 242, 248, 251, 255, 242, 243, 247, 255, 245, 252, 253, 255, 247, 253, 254, 255, 248, 253, 254, 255, 249, 253, 254, 255, 250, 253,
-    254, 255, 250, 251, 252, 255, 250, 252, 253, 255, 251, 254, 254, 255, 252, 254, 254, 255, 252, 254, 255, 255, 252, 254, 255, 255, 253, 254, 254, 255, 253,
-    254, 254, 255, 253, 254, 254, 255, 253, 254, 254, 255, 252, 254, 254, 255, 253, 254, 255, 255, 253, 254, 255, 255, 251, 253, 253, 255, 251, 252, 253, 255,
-    250, 252, 253, 255, 252, 254, 254, 255, 252, 254, 254, 255, 251, 254, 254, 255, 252, 254, 255, 255, 251, 254, 255, 255, 251, 253, 254, 255, 250, 253, 254,
-    255, 250, 253, 254, 255, 249, 253, 254, 255, 248, 253, 254, 255, 247, 252, 254, 255, 246, 252, 254, 255, 245, 252, 254, 255, 244, 251, 254, 255, 242, 251,
-    254, 255, 241, 251, 254, 255, 240, 250, 254, 255, 238, 249, 254, 255, 236, 249, 254, 255, 234, 249, 254, 255, 231, 248, 253, 255, 230, 248, 253, 255, 227,
-    247, 253, 255, 225, 246, 252, 255, 222, 246, 252, 255, 220, 245, 252, 255, 217, 244, 252, 255, 210, 241, 250, 255, 212, 242, 251, 255, 212, 242, 251, 255,
-    210, 241, 250, 255, 208, 240, 250, 255, 206, 240, 249, 255, 205, 239, 249, 255, 204, 238, 249, 255, 203, 238, 248, 255, 202, 237, 248, 255, 200, 237, 247,
-    255, 201, 237, 246, 255, 202, 236, 246, 255, 203, 236, 246, 255, 204, 236, 245, 255, 205, 236, 245, 255, 206, 235, 245, 255, 207, 235, 244, 255, 208, 235,
-    244, 255, 209, 235, 244, 255, 209, 234, 243, 255, 212, 226, 235, 255, 219, 219, 228, 255, 218, 221, 230, 255, 211, 232, 240, 255, 212, 234, 242, 255, 212,
-    234, 242, 255, 212, 234, 242, 255, 213, 234, 242, 255, 233, 232, 233, 255, 241, 232, 231, 255, 243, 234, 229, 255, 242, 231, 227, 255, 244, 234, 227, 255,
-    241, 231, 226, 255, 239, 226, 225, 255, 238, 224, 224, 255, 246, 236, 227, 255, 243, 232, 226, 255, 228, 216, 222, 255, 227, 217, 224, 255, 228, 218, 224,
-    255, 242, 227, 226, 255, 244, 228, 227, 255, 245, 228, 226, 255, 248, 234, 229, 255, 249, 237, 231, 255, 250, 237, 231, 255, 251, 238, 231, 255, 252, 241,
-    232, 255, 251, 238, 230, 255, 246, 226, 222, 255, 249, 237, 231, 255, 245, 236, 234, 255, 244, 232, 238, 255, 232, 221, 233, 255, 215, 216, 229, 255, 206,
-    213, 226, 255, 190, 209, 223, 255, 184, 207, 221, 255, 182, 206, 220, 255, 180, 203, 218, 255, 178, 201, 216, 255, 177, 197, 213, 255, 175, 200, 215, 255,
-    215, 244, 251, 255, 219, 245, 251, 255, 223, 247, 252, 255, 227, 248, 252, 255, 230, 248, 252, 255, 228, 233, 241, 255, 234, 242, 247, 255, 240, 251, 253,
-    255, 242, 251, 253, 255, 238, 242, 247, 255, 242, 246, 250, 255, 246, 252, 254, 255, 248, 253, 254, 255, 248, 253, 254, 255, 247, 251, 252, 255, 248, 249,
-    251, 255, 250, 252, 253, 255, 251, 253, 254, 255, 251, 254, 255, 255, 251, 254, 254, 255, 252, 254, 255, 255, 252, 254, 254, 255, 252, 254, 254, 255, 252,
-    254, 254, 255, 252, 254, 254, 255, 252, 254, 254, 255, 252, 254, 254, 255, 252, 254, 254, 255, 252, 254, 254, 255, 250, 252, 253, 255, 249, 251, 252, 255,
-    249, 252, 253, 255, 250, 253, 254, 255, 251, 254, 255, 255, 250, 253, 254, 255, 249, 253, 254, 255, 248, 253, 254, 255, 248, 253, 254, 255, 246, 252, 254,
-    255, 246, 252, 254, 255, 244, 252, 253, 255, 243, 251, 253, 255, 241, 251, 254, 255, 239, 250, 253, 255, 237, 250, 253, 255, 236, 250, 253, 255, 234, 249,
-    253, 255, 231, 248, 253, 255, 229, 248, 253, 255, 227, 247, 252, 255, 224, 247, 252, 255, 222, 246, 252, 255, 219, 245, 251, 255, 217, 244, 251, 255, 215,
-    243, 251, 255, 212, 243, 250, 255, 210, 242, 250, 255, 209, 241, 250, 255, 207, 240, 249, 255, 203, 238, 247, 255, 204, 239, 247, 255, 204, 238, 247, 255,
-    204, 238, 248, 255, 203, 238, 247, 255, 203, 237, 246, 255, 203, 236, 246, 255, 203, 236, 246, 255, 204, 236, 245, 255, 203, 235, 245, 255, 203, 235, 245,
-    255, 204, 235, 244, 255, 205, 235, 244, 255, 207, 235, 244, 255, 208, 235, 244, 255, 209, 235, 244, 255, 210, 235, 244, 255, 211, 235, 244, 255, 212, 235,
-    244, 255, 212, 235, 244, 255, 213, 235, 243, 255, 215, 228, 236, 255, 222, 221, 230, 255, 220, 224, 231, 255, 215, 233, 241, 255, 215, 235, 243, 255, 216,
-    235, 243, 255, 216, 236, 243, 255, 219, 236, 242, 255, 237, 226, 228, 255, 240, 230, 229, 255, 244, 234, 230, 255, 244, 234, 229, 255, 249, 241, 231, 255,
-    236, 225, 226, 255, 240, 228, 227, 255, 237, 224, 226, 255, 246, 236, 229, 255, 242, 232, 228, 255, 230, 219, 225, 255, 230, 220, 226, 255, 231, 222, 226,
-    255, 241, 227, 227, 255, 242, 227, 227, 255, 245, 229, 228, 255, 247, 233, 229, 255, 250, 236, 231, 255, 250, 238, 231, 255, 251, 239, 231, 255, 252, 241,
-    233, 255, 252, 241, 232, 255, 247, 230, 225, 255, 249, 236, 229, 255, 247, 237, 233, 255, 243, 235, 236, 255, 220, 225, 233, 255, 196, 215, 227, 255, 192,
-    213, 225, 255, 189, 212, 224, 255, 188, 210, 224, 255, 184, 209, 222, 255, 182, 206, 220, 255, 181, 204, 218, 255, 179, 199, 215, 255, 177, 201, 217, 255,
-    210, 239, 247, 255, 214, 241, 248, 255, 217, 242, 249, 255, 220, 243, 249, 255, 224, 241, 247, 255, 226, 228, 238, 255, 230, 246, 250, 255, 233, 248, 251,
-    255, 236, 247, 250, 255, 236, 237, 243, 255, 239, 247, 250, 255, 241, 250, 251, 255, 244, 250, 251, 255, 244, 246, 249, 255, 244, 247, 250, 255, 246, 251,
-    253, 255, 248, 253, 254, 255, 248, 253, 254, 255, 249, 253, 254, 255, 249, 253, 254, 255, 250, 253, 254, 255, 250, 253, 254, 255, 250, 253, 254, 255, 250,
-    253, 254, 255, 251, 254, 254, 255, 251, 254, 255, 255, 250, 253, 254, 255, 251, 253, 254, 255, 250, 253, 254, 255, 248, 251, 252, 255, 248, 250, 251, 255,
-    248, 251, 252, 255, 250, 253, 254, 255, 250, 253, 254, 255, 249, 253, 254, 255, 249, 253, 254, 255, 248, 253, 254, 255, 248, 252, 254, 255, 247, 252, 254,
-    255, 246, 252, 254, 255, 245, 252, 254, 255, 244, 252, 254, 255, 243, 251, 254, 255, 242, 251, 254, 255, 241, 251, 254, 255, 240, 251, 254, 255, 239, 250,
-    254, 255, 237, 250, 254, 255, 237, 249, 254, 255, 235, 249, 254, 255, 233, 249, 254, 255, 231, 248, 253, 255, 230, 248, 253, 255, 228, 247, 253, 255, 227,
-    247, 253, 255, 225, 246, 253, 255, 223, 246, 253, 255, 222, 246, 253, 255, 220, 245, 253, 255, 213, 243, 252, 255, 216, 243, 252, 255, 216, 243, 252, 255,
-    215, 243, 252, 255, 214, 243, 251, 255, 213, 242, 251, 255, 212, 241, 251, 255, 211, 241, 250, 255, 210, 241, 250, 255, 208, 241, 250, 255, 208, 240, 249,
-    255, 208, 240, 249, 255, 209, 240, 249, 255, 210, 240, 249, 255, 211, 240, 248, 255, 212, 240, 248, 255, 213, 240, 248, 255, 214, 240, 248, 255, 215, 239,
-    247, 255, 216, 239, 247, 255, 216, 239, 246, 255, 218, 231, 239, 255, 225, 224, 232, 255, 223, 226, 233, 255, 218, 236, 243, 255, 219, 239, 246, 255, 219,
-    239, 245, 255, 219, 238, 245, 255, 232, 234, 237, 255, 242, 231, 229, 255, 243, 233, 230, 255, 245, 236, 231, 255, 248, 241, 232, 255, 247, 239, 232, 255,
-    235, 223, 227, 255, 243, 232, 230, 255, 238, 226, 228, 255, 245, 235, 230, 255, 242, 232, 229, 255, 233, 223, 227, 255, 234, 225, 228, 255, 234, 225, 228,
-    255, 243, 230, 229, 255, 241, 227, 228, 255, 244, 229, 229, 255, 246, 232, 229, 255, 249, 236, 231, 255, 250, 238, 231, 255, 251, 239, 232, 255, 252, 240,
-    232, 255, 252, 242, 233, 255, 249, 234, 227, 255, 249, 233, 226, 255, 249, 238, 233, 255, 246, 236, 234, 255, 242, 234, 236, 255, 233, 226, 234, 255, 217,
-    219, 230, 255, 204, 216, 228, 255, 201, 213, 227, 255, 201, 212, 226, 255, 197, 209, 223, 255, 185, 206, 219, 255, 181, 200, 216, 255, 179, 202, 217, 255,
-    210, 243, 250, 255, 215, 244, 251, 255, 218, 245, 252, 255, 218, 239, 245, 255, 223, 234, 242, 255, 225, 233, 242, 255, 233, 249, 253, 255, 236, 250, 253,
-    255, 235, 242, 248, 255, 234, 237, 243, 255, 237, 246, 248, 255, 239, 246, 248, 255, 241, 244, 247, 255, 241, 246, 248, 255, 242, 247, 249, 255, 244, 247,
-    249, 255, 245, 249, 251, 255, 249, 253, 254, 255, 250, 253, 254, 255, 251, 254, 254, 255, 251, 254, 255, 255, 251, 254, 255, 255, 251, 254, 254, 255, 251,
-    254, 254, 255, 252, 254, 255, 255, 252, 254, 255, 255, 251, 253, 254, 255, 251, 254, 254, 255, 251, 253, 254, 255, 248, 251, 253, 255, 247, 250, 251, 255,
-    247, 250, 252, 255, 250, 253, 254, 255, 250, 254, 255, 255, 250, 253, 254, 255, 250, 253, 255, 255, 249, 253, 254, 255, 248, 253, 254, 255, 247, 252, 254,
-    255, 246, 252, 254, 255, 246, 252, 254, 255, 244, 251, 254, 255, 243, 251, 254, 255, 241, 250, 253, 255, 240, 250, 253, 255, 238, 250, 253, 255, 236, 249,
-    254, 255, 235, 249, 253, 255, 233, 248, 253, 255, 230, 248, 253, 255, 228, 247, 252, 255, 226, 246, 252, 255, 224, 246, 252, 255, 222, 245, 252, 255, 220,
-    245, 252, 255, 218, 244, 252, 255, 216, 244, 251, 255, 214, 242, 250, 255, 213, 242, 250, 255, 208, 239, 249, 255, 209, 240, 249, 255, 209, 240, 249, 255,
-    209, 239, 249, 255, 209, 239, 248, 255, 209, 239, 247, 255, 208, 238, 247, 255, 209, 238, 247, 255, 209, 238, 247, 255, 209, 237, 246, 255, 209, 237, 246,
-    255, 211, 237, 245, 255, 212, 237, 245, 255, 214, 237, 245, 255, 215, 237, 245, 255, 215, 237, 245, 255, 217, 237, 244, 255, 218, 237, 245, 255, 218, 237,
-    245, 255, 219, 237, 244, 255, 220, 237, 244, 255, 222, 232, 238, 255, 228, 227, 233, 255, 227, 228, 235, 255, 222, 235, 241, 255, 222, 238, 244, 255, 222,
-    238, 244, 255, 223, 238, 244, 255, 243, 236, 234, 255, 242, 232, 231, 255, 245, 236, 233, 255, 249, 242, 234, 255, 250, 243, 235, 255, 242, 233, 232, 255,
-    239, 228, 231, 255, 242, 232, 231, 255, 238, 228, 230, 255, 244, 234, 231, 255, 242, 232, 231, 255, 235, 226, 230, 255, 237, 229, 231, 255, 236, 228, 230,
-    255, 243, 231, 231, 255, 242, 229, 229, 255, 243, 229, 229, 255, 247, 233, 230, 255, 249, 236, 231, 255, 250, 239, 233, 255, 251, 240, 233, 255, 252, 241,
-    233, 255, 253, 243, 234, 255, 250, 236, 229, 255, 249, 233, 226, 255, 250, 238, 232, 255, 247, 237, 234, 255, 244, 236, 235, 255, 245, 234, 235, 255, 247,
-    226, 230, 255, 241, 221, 228, 255, 237, 222, 232, 255, 217, 216, 229, 255, 191, 208, 221, 255, 185, 205, 219, 255, 183, 201, 216, 255, 181, 201, 216, 255,
-    206, 240, 248, 255, 211, 242, 249, 255, 215, 243, 250, 255, 217, 238, 245, 255, 218, 221, 233, 255, 223, 240, 247, 255, 224, 242, 248, 255, 226, 238, 245,
-    255, 230, 232, 240, 255, 237, 242, 245, 255, 244, 248, 249, 255, 237, 240, 245, 255, 238, 244, 247, 255, 239, 245, 248, 255, 241, 245, 248, 255, 242, 245,
-    248, 255, 243, 245, 248, 255, 244, 247, 250, 255, 246, 252, 254, 255, 247, 253, 254, 255, 248, 252, 254, 255, 248, 253, 254, 255, 248, 253, 254, 255, 248,
-    253, 254, 255, 248, 253, 254, 255, 248, 253, 254, 255, 248, 253, 254, 255, 248, 253, 254, 255, 248, 252, 254, 255, 246, 250, 252, 255, 246, 249, 251, 255,
-    245, 249, 251, 255, 246, 252, 254, 255, 246, 252, 254, 255, 246, 252, 254, 255, 245, 252, 254, 255, 244, 252, 253, 255, 243, 252, 254, 255, 242, 251, 253,
-    255, 241, 251, 253, 255, 239, 251, 253, 255, 238, 250, 253, 255, 236, 250, 253, 255, 235, 249, 253, 255, 233, 248, 253, 255, 231, 248, 253, 255, 230, 247,
-    252, 255, 228, 247, 252, 255, 226, 247, 252, 255, 224, 247, 252, 255, 222, 246, 251, 255, 221, 245, 252, 255, 220, 245, 251, 255, 218, 244, 251, 255, 217,
-    243, 251, 255, 216, 243, 250, 255, 214, 243, 250, 255, 214, 242, 250, 255, 213, 242, 250, 255, 209, 240, 248, 255, 211, 240, 249, 255, 212, 240, 249, 255,
-    212, 240, 248, 255, 212, 240, 248, 255, 213, 240, 248, 255, 213, 240, 248, 255, 213, 239, 248, 255, 213, 239, 247, 255, 213, 239, 247, 255, 213, 239, 247,
-    255, 214, 239, 247, 255, 216, 239, 247, 255, 217, 239, 247, 255, 218, 240, 247, 255, 219, 240, 247, 255, 220, 240, 247, 255, 221, 240, 247, 255, 221, 240,
-    247, 255, 223, 240, 247, 255, 223, 240, 246, 255, 225, 235, 241, 255, 231, 229, 235, 255, 230, 230, 236, 255, 225, 238, 244, 255, 225, 241, 246, 255, 225,
-    241, 246, 255, 232, 240, 244, 255, 244, 235, 233, 255, 241, 231, 233, 255, 242, 233, 233, 255, 248, 240, 235, 255, 249, 243, 236, 255, 240, 230, 232, 255,
-    240, 231, 233, 255, 241, 232, 233, 255, 239, 230, 232, 255, 245, 235, 233, 255, 242, 233, 233, 255, 239, 231, 233, 255, 240, 232, 233, 255, 238, 230, 232,
-    255, 244, 233, 232, 255, 245, 232, 232, 255, 242, 229, 230, 255, 246, 233, 231, 255, 248, 236, 232, 255, 251, 240, 234, 255, 252, 241, 234, 255, 252, 241,
-    233, 255, 253, 242, 233, 255, 251, 240, 231, 255, 248, 231, 225, 255, 251, 239, 231, 255, 248, 238, 234, 255, 246, 236, 234, 255, 244, 236, 235, 255, 245,
-    235, 232, 255, 215, 220, 228, 255, 199, 215, 227, 255, 193, 213, 226, 255, 189, 210, 223, 255, 187, 208, 221, 255, 185, 204, 218, 255, 183, 204, 218, 255,
-    203, 229, 238, 255, 208, 237, 245, 255, 212, 240, 247, 255, 214, 232, 241, 255, 215, 219, 232, 255, 220, 238, 244, 255, 222, 229, 238, 255, 224, 232, 240,
-    255, 228, 230, 239, 255, 248, 250, 250, 255, 243, 245, 248, 255, 238, 242, 246, 255, 235, 244, 246, 255, 237, 243, 246, 255, 238, 243, 247, 255, 240, 242,
-    247, 255, 241, 242, 247, 255, 243, 243, 248, 255, 244, 248, 251, 255, 247, 253, 254, 255, 248, 253, 254, 255, 248, 252, 254, 255, 248, 253, 254, 255, 249,
-    253, 254, 255, 249, 252, 253, 255, 249, 253, 254, 255, 248, 252, 254, 255, 249, 253, 254, 255, 248, 253, 254, 255, 244, 249, 251, 255, 245, 248, 249, 255,
-    244, 249, 250, 255, 247, 252, 254, 255, 248, 253, 254, 255, 248, 253, 254, 255, 247, 252, 254, 255, 246, 252, 254, 255, 246, 252, 254, 255, 245, 251, 253,
-    255, 245, 251, 253, 255, 243, 251, 253, 255, 242, 251, 254, 255, 241, 251, 254, 255, 240, 250, 253, 255, 240, 250, 254, 255, 238, 249, 254, 255, 236, 249,
-    254, 255, 235, 249, 254, 255, 234, 248, 254, 255, 232, 249, 253, 255, 231, 248, 253, 255, 229, 247, 253, 255, 228, 247, 253, 255, 226, 246, 253, 255, 224,
-    246, 253, 255, 223, 245, 253, 255, 222, 245, 252, 255, 221, 244, 252, 255, 219, 244, 251, 255, 214, 242, 251, 255, 216, 242, 251, 255, 217, 243, 251, 255,
-    217, 242, 251, 255, 216, 242, 250, 255, 216, 242, 250, 255, 216, 241, 250, 255, 216, 241, 249, 255, 215, 241, 249, 255, 215, 241, 248, 255, 216, 241, 248,
-    255, 217, 241, 248, 255, 219, 241, 247, 255, 220, 241, 248, 255, 221, 241, 247, 255, 222, 241, 247, 255, 223, 241, 247, 255, 224, 241, 247, 255, 224, 241,
-    247, 255, 225, 241, 247, 255, 226, 241, 247, 255, 228, 236, 242, 255, 233, 231, 237, 255, 233, 232, 238, 255, 228, 239, 244, 255, 228, 242, 246, 255, 228,
-    242, 246, 255, 231, 242, 245, 255, 240, 234, 236, 255, 242, 233, 235, 255, 241, 232, 234, 255, 242, 234, 235, 255, 242, 234, 235, 255, 242, 234, 235, 255,
-    241, 233, 235, 255, 241, 233, 235, 255, 241, 232, 234, 255, 246, 238, 236, 255, 242, 234, 235, 255, 244, 236, 235, 255, 241, 234, 235, 255, 240, 232, 234,
-    255, 245, 235, 234, 255, 246, 235, 234, 255, 243, 231, 232, 255, 244, 232, 232, 255, 248, 235, 233, 255, 250, 239, 234, 255, 252, 242, 234, 255, 252, 242,
-    234, 255, 252, 242, 233, 255, 252, 242, 233, 255, 249, 234, 228, 255, 251, 238, 230, 255, 249, 239, 234, 255, 247, 237, 234, 255, 245, 236, 234, 255, 246,
-    237, 235, 255, 237, 232, 229, 255, 197, 215, 226, 255, 198, 215, 226, 255, 191, 211, 224, 255, 189, 208, 221, 255, 187, 204, 218, 255, 185, 203, 218, 255,
-    200, 218, 229, 255, 203, 220, 231, 255, 207, 236, 244, 255, 210, 219, 232, 255, 214, 228, 239, 255, 216, 232, 240, 255, 219, 226, 236, 255, 222, 228, 237,
-    255, 228, 232, 240, 255, 242, 245, 247, 255, 233, 235, 242, 255, 234, 242, 245, 255, 232, 241, 245, 255, 234, 240, 245, 255, 235, 239, 244, 255, 237, 238,
-    245, 255, 238, 239, 245, 255, 240, 240, 246, 255, 241, 242, 247, 255, 244, 251, 253, 255, 246, 252, 254, 255, 246, 252, 254, 255, 246, 252, 254, 255, 247,
-    252, 254, 255, 247, 252, 254, 255, 247, 252, 254, 255, 246, 252, 253, 255, 246, 252, 254, 255, 245, 252, 253, 255, 242, 248, 250, 255, 241, 246, 248, 255,
-    240, 246, 249, 255, 243, 251, 253, 255, 244, 251, 253, 255, 243, 251, 253, 255, 242, 251, 253, 255, 240, 250, 252, 255, 238, 248, 250, 255, 240, 246, 247,
-    255, 233, 242, 246, 255, 235, 248, 252, 255, 234, 248, 252, 255, 233, 248, 252, 255, 231, 247, 252, 255, 228, 246, 251, 255, 227, 246, 251, 255, 225, 246,
-    251, 255, 222, 245, 251, 255, 221, 245, 250, 255, 219, 244, 250, 255, 217, 243, 250, 255, 215, 242, 250, 255, 214, 242, 249, 255, 212, 241, 249, 255, 211,
-    240, 248, 255, 210, 240, 248, 255, 210, 239, 248, 255, 209, 239, 247, 255, 209, 239, 247, 255, 208, 237, 246, 255, 209, 238, 246, 255, 210, 238, 246, 255,
-    211, 237, 246, 255, 212, 237, 245, 255, 213, 237, 245, 255, 214, 237, 245, 255, 215, 237, 245, 255, 217, 237, 245, 255, 218, 238, 245, 255, 219, 237, 244,
-    255, 221, 238, 245, 255, 222, 238, 245, 255, 223, 239, 245, 255, 224, 239, 245, 255, 225, 239, 245, 255, 226, 239, 245, 255, 226, 239, 245, 255, 227, 240,
-    245, 255, 228, 240, 246, 255, 229, 240, 245, 255, 231, 237, 241, 255, 235, 233, 238, 255, 235, 234, 239, 255, 231, 240, 244, 255, 231, 241, 246, 255, 231,
-    242, 246, 255, 231, 242, 246, 255, 234, 241, 244, 255, 243, 236, 237, 255, 244, 235, 237, 255, 244, 236, 237, 255, 243, 235, 237, 255, 246, 238, 238, 255,
-    246, 239, 238, 255, 244, 237, 237, 255, 243, 235, 236, 255, 247, 240, 238, 255, 246, 238, 238, 255, 247, 240, 238, 255, 243, 236, 237, 255, 241, 234, 236,
-    255, 246, 238, 236, 255, 247, 237, 235, 255, 245, 235, 234, 255, 243, 232, 233, 255, 249, 237, 234, 255, 250, 239, 235, 255, 252, 242, 236, 255, 252, 243,
-    235, 255, 252, 242, 233, 255, 252, 242, 234, 255, 250, 236, 230, 255, 251, 239, 231, 255, 250, 240, 234, 255, 248, 238, 235, 255, 246, 236, 234, 255, 245,
-    236, 234, 255, 249, 239, 234, 255, 222, 226, 227, 255, 196, 213, 225, 255, 194, 211, 223, 255, 191, 209, 222, 255, 189, 205, 219, 255, 187, 203, 218, 255,
-    198, 215, 227, 255, 200, 220, 232, 255, 204, 221, 232, 255, 207, 208, 226, 255, 210, 223, 236, 255, 215, 230, 239, 255, 216, 225, 235, 255, 218, 220, 233,
-    255, 222, 234, 240, 255, 226, 230, 239, 255, 227, 236, 242, 255, 228, 237, 243, 255, 230, 236, 243, 255, 231, 236, 243, 255, 233, 235, 243, 255, 234, 235,
-    243, 255, 236, 236, 244, 255, 237, 237, 244, 255, 238, 238, 245, 255, 240, 247, 250, 255, 242, 249, 252, 255, 242, 249, 252, 255, 243, 249, 252, 255, 243,
-    250, 252, 255, 243, 250, 252, 255, 243, 250, 252, 255, 243, 250, 252, 255, 243, 250, 252, 255, 242, 249, 252, 255, 240, 246, 249, 255, 239, 245, 247, 255,
-    238, 245, 248, 255, 241, 249, 251, 255, 241, 249, 252, 255, 241, 249, 251, 255, 243, 249, 249, 255, 245, 248, 247, 255, 246, 247, 246, 255, 243, 244, 244,
-    255, 229, 235, 241, 255, 235, 247, 251, 255, 234, 246, 250, 255, 232, 246, 250, 255, 231, 246, 250, 255, 230, 245, 250, 255, 228, 244, 250, 255, 227, 244,
-    250, 255, 226, 244, 250, 255, 224, 244, 250, 255, 223, 243, 249, 255, 222, 242, 249, 255, 220, 242, 249, 255, 220, 242, 249, 255, 219, 242, 249, 255, 218,
-    241, 249, 255, 217, 241, 249, 255, 217, 241, 249, 255, 216, 241, 249, 255, 216, 240, 249, 255, 213, 240, 248, 255, 215, 240, 249, 255, 217, 241, 248, 255,
-    217, 240, 248, 255, 217, 240, 248, 255, 218, 240, 248, 255, 218, 240, 248, 255, 219, 241, 248, 255, 220, 241, 247, 255, 221, 241, 248, 255, 223, 241, 248,
-    255, 224, 241, 247, 255, 225, 241, 247, 255, 226, 242, 247, 255, 227, 241, 247, 255, 228, 242, 247, 255, 229, 242, 247, 255, 230, 243, 248, 255, 231, 243,
-    247, 255, 231, 243, 247, 255, 232, 243, 248, 255, 233, 240, 244, 255, 237, 235, 240, 255, 237, 236, 241, 255, 233, 242, 246, 255, 233, 244, 248, 255, 234,
-    244, 248, 255, 233, 244, 247, 255, 234, 244, 248, 255, 244, 239, 240, 255, 245, 237, 239, 255, 244, 237, 239, 255, 246, 238, 239, 255, 248, 241, 240, 255,
-    248, 241, 240, 255, 246, 239, 239, 255, 244, 237, 238, 255, 248, 242, 239, 255, 248, 242, 240, 255, 248, 242, 239, 255, 244, 238, 238, 255, 242, 236, 237,
-    255, 247, 239, 237, 255, 248, 239, 237, 255, 248, 239, 236, 255, 241, 232, 234, 255, 249, 239, 236, 255, 249, 238, 235, 255, 252, 243, 236, 255, 253, 244,
-    236, 255, 252, 242, 234, 255, 253, 243, 235, 255, 250, 235, 229, 255, 251, 240, 232, 255, 250, 241, 234, 255, 249, 239, 235, 255, 247, 237, 235, 255, 246,
-    236, 235, 255, 244, 237, 236, 255, 249, 239, 231, 255, 206, 220, 227, 255, 196, 214, 225, 255, 194, 211, 224, 255, 191, 207, 220, 255, 189, 205, 219, 255,
-    194, 211, 225, 255, 197, 220, 233, 255, 201, 214, 229, 255, 204, 208, 225, 255, 207, 215, 230, 255, 212, 225, 236, 255, 213, 224, 236, 255, 216, 220, 232,
-    255, 218, 228, 237, 255, 221, 229, 238, 255, 223, 234, 240, 255, 225, 234, 241, 255, 227, 234, 241, 255, 229, 234, 242, 255, 231, 234, 242, 255, 233, 235,
-    243, 255, 237, 237, 244, 255, 239, 239, 245, 255, 240, 241, 246, 255, 237, 243, 248, 255, 237, 243, 248, 255, 237, 244, 248, 255, 238, 244, 248, 255, 238,
-    244, 248, 255, 238, 244, 248, 255, 238, 244, 248, 255, 238, 244, 247, 255, 238, 244, 247, 255, 237, 243, 247, 255, 237, 243, 247, 255, 236, 243, 246, 255,
-    236, 242, 246, 255, 235, 242, 246, 255, 242, 246, 247, 255, 245, 247, 246, 255, 244, 245, 245, 255, 240, 242, 243, 255, 236, 239, 241, 255, 232, 236, 239,
-    255, 227, 231, 236, 255, 224, 234, 240, 255, 222, 233, 238, 255, 220, 231, 238, 255, 218, 230, 236, 255, 216, 228, 235, 255, 215, 227, 233, 255, 213, 225,
-    233, 255, 212, 224, 231, 255, 210, 223, 230, 255, 209, 221, 229, 255, 209, 220, 228, 255, 209, 218, 227, 255, 209, 217, 226, 255, 209, 217, 225, 255, 210,
-    216, 225, 255, 210, 216, 225, 255, 212, 216, 225, 255, 213, 216, 225, 255, 215, 216, 225, 255, 215, 218, 227, 255, 217, 217, 226, 255, 220, 218, 226, 255,
-    222, 219, 227, 255, 223, 220, 228, 255, 225, 222, 229, 255, 227, 222, 230, 255, 228, 225, 232, 255, 230, 230, 236, 255, 236, 235, 239, 255, 240, 237, 239,
-    255, 240, 236, 239, 255, 238, 235, 238, 255, 236, 233, 237, 255, 236, 233, 238, 255, 236, 233, 238, 255, 236, 234, 239, 255, 237, 235, 239, 255, 237, 236,
-    240, 255, 238, 237, 241, 255, 238, 237, 241, 255, 239, 237, 241, 255, 240, 238, 241, 255, 240, 238, 242, 255, 239, 239, 243, 255, 239, 240, 243, 255, 239,
-    240, 244, 255, 239, 240, 244, 255, 240, 241, 244, 255, 245, 241, 242, 255, 247, 241, 241, 255, 246, 240, 240, 255, 248, 243, 241, 255, 248, 243, 241, 255,
-    249, 244, 242, 255, 247, 241, 241, 255, 246, 239, 240, 255, 248, 242, 240, 255, 249, 244, 241, 255, 249, 243, 241, 255, 246, 240, 241, 255, 243, 237, 239,
-    255, 248, 241, 239, 255, 249, 240, 239, 255, 249, 241, 238, 255, 241, 233, 236, 255, 250, 240, 237, 255, 249, 237, 236, 255, 252, 244, 238, 255, 252, 244,
-    237, 255, 253, 244, 236, 255, 253, 243, 235, 255, 249, 235, 229, 255, 251, 240, 233, 255, 251, 241, 235, 255, 249, 240, 235, 255, 248, 238, 235, 255, 246,
-    237, 235, 255, 244, 236, 235, 255, 247, 238, 235, 255, 234, 229, 226, 255, 201, 208, 222, 255, 199, 205, 220, 255, 197, 203, 218, 255, 193, 201, 216, 255,
-    192, 209, 224, 255, 195, 211, 226, 255, 198, 201, 220, 255, 202, 212, 227, 255, 206, 218, 230, 255, 211, 221, 232, 255, 210, 214, 229, 255, 214, 219, 231,
-    255, 218, 225, 236, 255, 224, 236, 241, 255, 231, 241, 245, 255, 236, 243, 247, 255, 242, 245, 249, 255, 246, 249, 250, 255, 249, 251, 252, 255, 251, 252,
-    253, 255, 252, 253, 253, 255, 253, 253, 253, 255, 250, 252, 252, 255, 239, 244, 248, 255, 234, 241, 246, 255, 235, 242, 246, 255, 235, 242, 246, 255, 235,
-    242, 246, 255, 236, 242, 246, 255, 236, 242, 246, 255, 236, 242, 246, 255, 236, 242, 246, 255, 236, 241, 245, 255, 235, 241, 245, 255, 235, 241, 245, 255,
-    234, 240, 244, 255, 234, 240, 244, 255, 240, 243, 244, 255, 236, 239, 242, 255, 232, 236, 240, 255, 230, 235, 239, 255, 229, 233, 237, 255, 228, 232, 237,
-    255, 225, 229, 235, 255, 222, 231, 238, 255, 222, 230, 236, 255, 220, 228, 235, 255, 219, 227, 233, 255, 217, 225, 232, 255, 216, 224, 231, 255, 215, 222,
-    229, 255, 213, 221, 228, 255, 212, 219, 227, 255, 211, 218, 226, 255, 210, 217, 225, 255, 210, 216, 224, 255, 210, 214, 224, 255, 211, 214, 223, 255, 212,
-    214, 223, 255, 212, 214, 223, 255, 214, 214, 223, 255, 216, 214, 223, 255, 217, 214, 223, 255, 219, 214, 223, 255, 221, 215, 224, 255, 223, 217, 225, 255,
-    225, 218, 226, 255, 226, 219, 227, 255, 228, 221, 228, 255, 228, 224, 231, 255, 224, 233, 239, 255, 233, 236, 240, 255, 239, 238, 241, 255, 244, 239, 241,
-    255, 244, 239, 241, 255, 245, 240, 243, 255, 243, 238, 242, 255, 238, 235, 239, 255, 238, 234, 238, 255, 239, 235, 239, 255, 239, 236, 240, 255, 240, 237,
-    241, 255, 240, 237, 241, 255, 240, 238, 242, 255, 241, 239, 242, 255, 241, 239, 243, 255, 241, 240, 243, 255, 241, 241, 244, 255, 241, 241, 244, 255, 242,
-    241, 245, 255, 242, 242, 245, 255, 242, 242, 245, 255, 241, 242, 245, 255, 246, 243, 244, 255, 247, 241, 242, 255, 251, 246, 243, 255, 248, 243, 242, 255,
-    250, 245, 243, 255, 248, 242, 243, 255, 246, 241, 241, 255, 248, 243, 242, 255, 249, 244, 243, 255, 250, 245, 242, 255, 247, 242, 242, 255, 244, 240, 241,
-    255, 248, 242, 240, 255, 249, 241, 241, 255, 250, 243, 240, 255, 242, 235, 237, 255, 250, 241, 239, 255, 249, 239, 237, 255, 252, 243, 238, 255, 253, 245,
-    238, 255, 253, 245, 238, 255, 253, 244, 236, 255, 249, 235, 229, 255, 251, 240, 233, 255, 251, 241, 235, 255, 250, 241, 236, 255, 249, 239, 236, 255, 247,
-    237, 235, 255, 244, 236, 235, 255, 244, 236, 235, 255, 250, 239, 231, 255, 213, 214, 223, 255, 201, 206, 220, 255, 200, 204, 219, 255, 197, 201, 217, 255,
-    189, 209, 224, 255, 193, 206, 223, 255, 197, 199, 219, 255, 203, 212, 225, 255, 212, 216, 227, 255, 220, 222, 230, 255, 211, 214, 228, 255, 226, 229, 238,
-    255, 246, 249, 249, 255, 250, 252, 252, 255, 250, 252, 253, 255, 249, 251, 252, 255, 247, 251, 252, 255, 250, 253, 254, 255, 246, 251, 252, 255, 241, 248,
-    250, 255, 236, 243, 247, 255, 233, 241, 245, 255, 231, 239, 245, 255, 231, 239, 244, 255, 231, 239, 245, 255, 232, 239, 245, 255, 232, 240, 245, 255, 233,
-    240, 245, 255, 233, 240, 245, 255, 233, 240, 245, 255, 233, 239, 244, 255, 233, 239, 244, 255, 232, 239, 243, 255, 232, 238, 243, 255, 231, 238, 243, 255,
-    230, 238, 242, 255, 230, 237, 242, 255, 231, 236, 240, 255, 230, 234, 239, 255, 227, 232, 237, 255, 226, 231, 236, 255, 225, 230, 235, 255, 225, 229, 234,
-    255, 224, 227, 233, 255, 218, 226, 235, 255, 217, 228, 234, 255, 216, 226, 233, 255, 214, 225, 231, 255, 214, 223, 231, 255, 213, 222, 230, 255, 212, 221,
-    228, 255, 211, 220, 227, 255, 211, 218, 226, 255, 210, 217, 225, 255, 210, 216, 225, 255, 211, 215, 224, 255, 211, 215, 224, 255, 212, 215, 223, 255, 213,
-    215, 223, 255, 214, 215, 223, 255, 216, 215, 223, 255, 217, 216, 223, 255, 219, 216, 224, 255, 221, 216, 224, 255, 223, 217, 225, 255, 225, 219, 226, 255,
-    227, 220, 227, 255, 229, 221, 228, 255, 230, 224, 230, 255, 226, 232, 238, 255, 233, 230, 235, 255, 240, 232, 234, 255, 245, 234, 234, 255, 249, 238, 234,
-    255, 248, 239, 236, 255, 246, 237, 238, 255, 244, 237, 240, 255, 240, 237, 240, 255, 241, 237, 240, 255, 241, 237, 241, 255, 242, 238, 241, 255, 242, 238,
-    242, 255, 242, 239, 243, 255, 243, 240, 243, 255, 243, 241, 244, 255, 243, 241, 244, 255, 243, 242, 245, 255, 243, 242, 245, 255, 244, 243, 245, 255, 244,
-    243, 246, 255, 244, 243, 246, 255, 244, 243, 246, 255, 243, 244, 246, 255, 244, 244, 246, 255, 249, 244, 244, 255, 251, 247, 245, 255, 249, 243, 243, 255,
-    251, 247, 245, 255, 248, 243, 244, 255, 247, 242, 243, 255, 249, 245, 244, 255, 249, 245, 243, 255, 251, 247, 244, 255, 248, 244, 243, 255, 247, 242, 242,
-    255, 248, 242, 242, 255, 249, 242, 241, 255, 251, 245, 242, 255, 243, 237, 239, 255, 250, 241, 239, 255, 250, 241, 239, 255, 250, 242, 239, 255, 253, 245,
-    239, 255, 253, 246, 239, 255, 253, 244, 237, 255, 250, 237, 231, 255, 251, 239, 232, 255, 250, 240, 234, 255, 250, 241, 237, 255, 249, 240, 236, 255, 247,
-    238, 237, 255, 244, 236, 236, 255, 242, 235, 235, 255, 247, 237, 233, 255, 233, 228, 228, 255, 205, 208, 222, 255, 203, 206, 220, 255, 199, 203, 219, 255,
-    187, 206, 222, 255, 190, 197, 218, 255, 195, 202, 220, 255, 198, 207, 224, 255, 203, 207, 224, 255, 208, 211, 226, 255, 205, 209, 227, 255, 213, 225, 235,
-    255, 218, 227, 237, 255, 220, 229, 238, 255, 219, 230, 239, 255, 220, 230, 239, 255, 221, 231, 241, 255, 228, 239, 245, 255, 227, 237, 243, 255, 226, 234,
-    242, 255, 228, 234, 242, 255, 229, 235, 242, 255, 230, 236, 242, 255, 231, 236, 243, 255, 232, 237, 243, 255, 232, 237, 243, 255, 233, 238, 243, 255, 234,
-    238, 243, 255, 234, 238, 243, 255, 234, 238, 243, 255, 234, 237, 242, 255, 235, 237, 242, 255, 236, 237, 242, 255, 236, 237, 241, 255, 235, 237, 241, 255,
-    234, 236, 240, 255, 233, 235, 240, 255, 230, 234, 238, 255, 226, 231, 236, 255, 224, 228, 235, 255, 222, 228, 234, 255, 223, 227, 233, 255, 222, 226, 232,
-    255, 221, 224, 231, 255, 217, 221, 231, 255, 222, 225, 232, 255, 223, 224, 230, 255, 224, 223, 229, 255, 224, 222, 228, 255, 223, 221, 227, 255, 223, 220,
-    226, 255, 222, 219, 225, 255, 222, 218, 224, 255, 222, 217, 223, 255, 222, 216, 222, 255, 222, 216, 222, 255, 223, 216, 222, 255, 223, 215, 221, 255, 224,
-    216, 222, 255, 225, 216, 222, 255, 226, 216, 222, 255, 228, 216, 222, 255, 229, 217, 223, 255, 229, 217, 223, 255, 231, 218, 224, 255, 233, 220, 225, 255,
-    235, 222, 227, 255, 236, 223, 228, 255, 232, 229, 233, 255, 231, 228, 233, 255, 240, 227, 231, 255, 245, 231, 232, 255, 249, 237, 233, 255, 253, 247, 239,
-    255, 252, 246, 242, 255, 250, 239, 236, 255, 247, 236, 237, 255, 244, 235, 238, 255, 242, 237, 240, 255, 245, 239, 241, 255, 245, 240, 242, 255, 246, 240,
-    243, 255, 246, 241, 243, 255, 246, 242, 244, 255, 246, 242, 244, 255, 246, 243, 245, 255, 247, 244, 246, 255, 247, 244, 246, 255, 247, 244, 246, 255, 247,
-    245, 247, 255, 247, 245, 247, 255, 247, 245, 247, 255, 246, 245, 247, 255, 247, 246, 247, 255, 252, 249, 247, 255, 250, 246, 246, 255, 250, 245, 245, 255,
-    251, 248, 246, 255, 249, 245, 245, 255, 249, 245, 245, 255, 248, 245, 245, 255, 249, 245, 245, 255, 251, 247, 245, 255, 250, 246, 245, 255, 248, 244, 244,
-    255, 249, 244, 244, 255, 249, 243, 243, 255, 252, 247, 243, 255, 244, 238, 240, 255, 249, 242, 241, 255, 251, 244, 241, 255, 250, 241, 240, 255, 253, 246,
-    240, 255, 253, 246, 240, 255, 252, 244, 238, 255, 250, 239, 233, 255, 251, 239, 233, 255, 250, 240, 235, 255, 250, 241, 237, 255, 249, 241, 238, 255, 246,
-    238, 237, 255, 243, 236, 236, 255, 242, 235, 235, 255, 243, 235, 234, 255, 249, 239, 231, 255, 217, 213, 223, 255, 209, 207, 220, 255, 207, 203, 218, 255,
-    185, 201, 220, 255, 189, 191, 213, 255, 193, 203, 221, 255, 194, 202, 221, 255, 195, 204, 224, 255, 198, 199, 221, 255, 201, 211, 228, 255, 205, 219, 233,
-    255, 210, 220, 233, 255, 211, 222, 235, 255, 213, 224, 236, 255, 215, 226, 237, 255, 217, 227, 238, 255, 219, 228, 239, 255, 221, 230, 240, 255, 223, 231,
-    240, 255, 225, 232, 241, 255, 226, 232, 241, 255, 227, 233, 241, 255, 228, 234, 241, 255, 230, 234, 242, 255, 231, 234, 241, 255, 231, 235, 242, 255, 232,
-    235, 242, 255, 233, 235, 241, 255, 233, 235, 241, 255, 233, 235, 240, 255, 233, 235, 240, 255, 233, 233, 239, 255, 231, 231, 237, 255, 230, 230, 237, 255,
-    228, 229, 236, 255, 226, 228, 235, 255, 225, 227, 234, 255, 225, 229, 234, 255, 222, 226, 233, 255, 220, 224, 232, 255, 219, 224, 230, 255, 219, 224, 230,
-    255, 218, 222, 230, 255, 216, 218, 228, 255, 211, 216, 229, 255, 208, 209, 224, 255, 214, 211, 224, 255, 226, 219, 225, 255, 227, 219, 225, 255, 227, 218,
-    224, 255, 227, 218, 223, 255, 227, 217, 222, 255, 227, 216, 221, 255, 228, 215, 221, 255, 228, 215, 221, 255, 226, 217, 222, 255, 221, 219, 225, 255, 220,
-    216, 223, 255, 218, 208, 219, 255, 218, 207, 220, 255, 220, 209, 220, 255, 222, 211, 222, 255, 223, 211, 223, 255, 225, 213, 224, 255, 227, 216, 225, 255,
-    229, 217, 226, 255, 232, 220, 228, 255, 233, 227, 233, 255, 238, 226, 231, 255, 244, 231, 233, 255, 251, 247, 246, 255, 252, 245, 239, 255, 254, 254, 254,
-    255, 254, 253, 251, 255, 251, 245, 243, 255, 249, 243, 241, 255, 246, 237, 238, 255, 244, 237, 240, 255, 247, 240, 242, 255, 248, 241, 242, 255, 248, 242,
-    243, 255, 248, 243, 244, 255, 248, 243, 245, 255, 249, 244, 245, 255, 249, 244, 246, 255, 248, 245, 246, 255, 249, 246, 247, 255, 249, 246, 247, 255, 249,
-    246, 247, 255, 249, 246, 247, 255, 249, 247, 248, 255, 249, 247, 248, 255, 250, 248, 248, 255, 252, 249, 248, 255, 250, 246, 246, 255, 250, 246, 246, 255,
-    251, 248, 247, 255, 250, 247, 247, 255, 251, 248, 247, 255, 249, 245, 246, 255, 250, 246, 246, 255, 252, 248, 246, 255, 250, 246, 246, 255, 248, 245, 245,
-    255, 250, 245, 245, 255, 249, 244, 244, 255, 253, 248, 245, 255, 246, 241, 242, 255, 248, 241, 242, 255, 252, 245, 242, 255, 249, 242, 240, 255, 253, 247,
-    242, 255, 253, 247, 241, 255, 253, 245, 239, 255, 251, 241, 235, 255, 251, 240, 235, 255, 250, 240, 236, 255, 250, 241, 238, 255, 249, 241, 238, 255, 246,
-    239, 238, 255, 243, 237, 237, 255, 241, 236, 237, 255, 242, 235, 234, 255, 247, 237, 232, 255, 236, 228, 227, 255, 213, 208, 220, 255, 209, 204, 218, 255,
-    191, 199, 217, 255, 191, 196, 215, 255, 191, 198, 218, 255, 195, 205, 223, 255, 195, 204, 223, 255, 195, 197, 220, 255, 203, 213, 228, 255, 206, 215, 231,
-    255, 210, 216, 230, 255, 211, 219, 233, 255, 213, 221, 234, 255, 215, 223, 235, 255, 218, 224, 236, 255, 220, 225, 237, 255, 221, 227, 237, 255, 223, 228,
-    238, 255, 225, 229, 238, 255, 226, 229, 239, 255, 227, 230, 239, 255, 228, 231, 239, 255, 229, 232, 239, 255, 230, 232, 240, 255, 231, 232, 239, 255, 231,
-    232, 240, 255, 232, 232, 239, 255, 232, 232, 238, 255, 232, 232, 239, 255, 233, 232, 238, 255, 233, 231, 235, 255, 233, 230, 235, 255, 233, 231, 234, 255,
-    234, 231, 234, 255, 233, 231, 234, 255, 233, 232, 233, 255, 223, 227, 233, 255, 219, 223, 231, 255, 217, 222, 229, 255, 216, 221, 230, 255, 215, 220, 228,
-    255, 214, 219, 227, 255, 214, 216, 225, 255, 208, 214, 227, 255, 203, 203, 222, 255, 202, 202, 221, 255, 209, 208, 222, 255, 225, 217, 223, 255, 226, 217,
-    223, 255, 225, 216, 221, 255, 226, 215, 221, 255, 226, 215, 220, 255, 226, 214, 220, 255, 221, 215, 222, 255, 202, 220, 230, 255, 201, 216, 227, 255, 203,
-    202, 219, 255, 204, 200, 218, 255, 206, 204, 220, 255, 209, 207, 222, 255, 211, 209, 223, 255, 213, 211, 224, 255, 216, 213, 226, 255, 219, 215, 227, 255,
-    221, 218, 229, 255, 224, 220, 230, 255, 228, 223, 232, 255, 236, 226, 232, 255, 244, 231, 232, 255, 250, 241, 238, 255, 253, 247, 241, 255, 255, 255, 255,
-    255, 255, 254, 252, 255, 252, 246, 242, 255, 251, 244, 240, 255, 247, 238, 240, 255, 246, 238, 241, 255, 247, 241, 243, 255, 248, 242, 243, 255, 249, 243,
-    245, 255, 249, 244, 245, 255, 248, 244, 245, 255, 249, 245, 246, 255, 249, 245, 246, 255, 249, 246, 247, 255, 249, 246, 248, 255, 249, 247, 248, 255, 249,
-    247, 248, 255, 249, 247, 248, 255, 249, 248, 249, 255, 249, 248, 249, 255, 251, 248, 248, 255, 251, 248, 248, 255, 250, 247, 247, 255, 251, 247, 248, 255,
-    253, 250, 249, 255, 252, 249, 248, 255, 251, 249, 248, 255, 249, 246, 247, 255, 250, 247, 247, 255, 252, 249, 248, 255, 251, 248, 247, 255, 249, 246, 247,
-    255, 251, 247, 246, 255, 249, 245, 245, 255, 253, 249, 246, 255, 248, 243, 243, 255, 248, 242, 242, 255, 252, 246, 244, 255, 251, 244, 242, 255, 253, 248,
-    243, 255, 253, 247, 242, 255, 253, 246, 240, 255, 251, 242, 237, 255, 251, 242, 237, 255, 249, 239, 236, 255, 250, 241, 238, 255, 249, 241, 238, 255, 246,
-    239, 239, 255, 244, 237, 238, 255, 241, 236, 237, 255, 242, 235, 235, 255, 245, 236, 233, 255, 250, 239, 231, 255, 220, 213, 222, 255, 211, 205, 218, 255,
-    180, 181, 206, 255, 182, 193, 215, 255, 185, 203, 222, 255, 187, 205, 224, 255, 189, 196, 218, 255, 192, 199, 221, 255, 195, 211, 228, 255, 197, 214, 230,
-    255, 202, 213, 229, 255, 203, 217, 232, 255, 205, 219, 233, 255, 207, 220, 234, 255, 209, 222, 235, 255, 211, 223, 236, 255, 213, 224, 236, 255, 215, 226,
-    237, 255, 217, 226, 237, 255, 219, 227, 238, 255, 221, 228, 238, 255, 222, 228, 238, 255, 223, 229, 238, 255, 224, 229, 238, 255, 225, 229, 238, 255, 226,
-    230, 238, 255, 227, 230, 237, 255, 227, 230, 237, 255, 227, 229, 237, 255, 235, 232, 235, 255, 244, 236, 234, 255, 246, 238, 234, 255, 247, 240, 234, 255,
-    248, 241, 235, 255, 246, 240, 234, 255, 247, 241, 235, 255, 227, 229, 231, 255, 216, 221, 228, 255, 214, 219, 227, 255, 213, 218, 227, 255, 212, 217, 226,
-    255, 212, 216, 225, 255, 213, 214, 223, 255, 208, 210, 224, 255, 201, 200, 220, 255, 199, 198, 219, 255, 201, 199, 218, 255, 220, 214, 222, 255, 222, 214,
-    221, 255, 222, 213, 220, 255, 222, 213, 220, 255, 222, 213, 220, 255, 223, 212, 219, 255, 206, 209, 220, 255, 199, 206, 220, 255, 201, 201, 217, 255, 204,
-    199, 216, 255, 205, 200, 219, 255, 207, 204, 220, 255, 209, 208, 222, 255, 191, 190, 202, 255, 215, 212, 225, 255, 217, 215, 226, 255, 205, 202, 213, 255,
-    216, 213, 223, 255, 225, 222, 231, 255, 230, 225, 233, 255, 237, 227, 233, 255, 246, 232, 232, 255, 250, 238, 235, 255, 253, 247, 243, 255, 254, 254, 254,
-    255, 254, 254, 253, 255, 252, 245, 240, 255, 250, 242, 241, 255, 247, 239, 241, 255, 247, 240, 242, 255, 248, 242, 243, 255, 228, 223, 225, 255, 249, 244,
-    245, 255, 249, 244, 246, 255, 250, 246, 247, 255, 250, 246, 247, 255, 250, 247, 248, 255, 250, 247, 248, 255, 250, 247, 248, 255, 250, 248, 249, 255, 250,
-    248, 249, 255, 250, 248, 249, 255, 250, 248, 249, 255, 251, 249, 249, 255, 251, 248, 248, 255, 251, 248, 249, 255, 251, 249, 248, 255, 253, 250, 249, 255,
-    253, 251, 249, 255, 252, 250, 249, 255, 252, 249, 249, 255, 250, 248, 248, 255, 251, 248, 248, 255, 252, 250, 248, 255, 252, 249, 248, 255, 250, 247, 247,
-    255, 252, 248, 247, 255, 251, 246, 246, 255, 253, 249, 247, 255, 250, 245, 245, 255, 249, 244, 244, 255, 252, 247, 244, 255, 252, 246, 243, 255, 253, 247,
-    243, 255, 254, 249, 243, 255, 253, 247, 242, 255, 252, 244, 239, 255, 249, 240, 237, 255, 249, 238, 236, 255, 238, 228, 225, 255, 236, 227, 225, 255, 231,
-    224, 223, 255, 240, 234, 234, 255, 243, 236, 237, 255, 242, 236, 236, 255, 244, 236, 234, 255, 249, 238, 231, 255, 237, 228, 226, 255, 212, 205, 219, 255,
-    178, 180, 205, 255, 180, 194, 216, 255, 182, 197, 218, 255, 184, 197, 219, 255, 186, 188, 214, 255, 189, 201, 222, 255, 192, 205, 225, 255, 194, 208, 227,
-    255, 210, 218, 229, 255, 200, 213, 229, 255, 200, 213, 230, 255, 203, 215, 231, 255, 205, 217, 232, 255, 206, 218, 233, 255, 208, 219, 233, 255, 210, 220,
-    234, 255, 212, 221, 234, 255, 214, 222, 235, 255, 215, 223, 235, 255, 216, 223, 235, 255, 218, 224, 235, 255, 219, 224, 235, 255, 220, 225, 235, 255, 221,
-    225, 235, 255, 221, 225, 234, 255, 222, 225, 234, 255, 222, 224, 233, 255, 231, 227, 232, 255, 239, 230, 230, 255, 241, 231, 230, 255, 241, 232, 230, 255,
-    241, 232, 230, 255, 240, 232, 230, 255, 239, 232, 229, 255, 228, 226, 228, 255, 214, 218, 226, 255, 212, 216, 226, 255, 209, 214, 225, 255, 209, 213, 223,
-    255, 209, 213, 222, 255, 210, 211, 222, 255, 209, 208, 221, 255, 199, 199, 218, 255, 197, 195, 216, 255, 197, 195, 215, 255, 212, 208, 219, 255, 214, 209,
-    218, 255, 214, 209, 218, 255, 214, 208, 218, 255, 215, 208, 218, 255, 216, 208, 217, 255, 201, 198, 215, 255, 199, 195, 215, 255, 201, 195, 213, 255, 202,
-    196, 215, 255, 205, 199, 218, 255, 208, 203, 220, 255, 210, 207, 222, 255, 123, 121, 130, 255, 179, 176, 186, 255, 216, 212, 224, 255, 98,  96,  101, 255,
-    221, 217, 227, 255, 227, 222, 232, 255, 232, 224, 233, 255, 236, 226, 233, 255, 245, 231, 233, 255, 248, 236, 236, 255, 252, 247, 243, 255, 255, 255, 254,
-    255, 254, 254, 252, 255, 252, 245, 240, 255, 249, 242, 242, 255, 247, 240, 242, 255, 247, 241, 243, 255, 240, 235, 237, 255, 142, 140, 140, 255, 249, 245,
-    246, 255, 249, 246, 247, 255, 249, 246, 247, 255, 249, 247, 248, 255, 249, 247, 248, 255, 163, 161, 162, 255, 250, 248, 249, 255, 250, 248, 249, 255, 250,
-    249, 250, 255, 250, 249, 250, 255, 250, 249, 250, 255, 251, 249, 250, 255, 251, 249, 249, 255, 251, 249, 249, 255, 252, 249, 249, 255, 253, 251, 250, 255,
-    253, 251, 250, 255, 252, 250, 249, 255, 252, 250, 249, 255, 251, 248, 249, 255, 251, 248, 249, 255, 253, 250, 249, 255, 252, 250, 249, 255, 220, 218, 218,
-    255, 194, 192, 192, 255, 252, 248, 248, 255, 253, 250, 247, 255, 251, 247, 246, 255, 249, 245, 245, 255, 252, 247, 245, 255, 253, 248, 245, 255, 253, 248,
-    244, 255, 254, 249, 244, 255, 253, 248, 243, 255, 252, 244, 240, 255, 250, 242, 239, 255, 250, 241, 239, 255, 166, 160, 158, 255, 195, 188, 187, 255, 163,
-    158, 157, 255, 217, 211, 211, 255, 244, 238, 237, 255, 243, 236, 236, 255, 244, 236, 235, 255, 247, 237, 233, 255, 251, 239, 229, 255, 218, 212, 222, 255,
-    175, 183, 207, 255, 177, 196, 217, 255, 180, 198, 218, 255, 182, 193, 216, 255, 184, 188, 215, 255, 186, 204, 223, 255, 189, 206, 225, 255, 191, 208, 226,
-    255, 202, 214, 228, 255, 198, 213, 229, 255, 197, 213, 229, 255, 199, 214, 231, 255, 202, 216, 231, 255, 204, 217, 232, 255, 206, 218, 233, 255, 208, 220,
-    233, 255, 210, 221, 234, 255, 212, 221, 234, 255, 213, 222, 234, 255, 215, 223, 235, 255, 217, 223, 234, 255, 218, 224, 234, 255, 218, 224, 234, 255, 220,
-    224, 234, 255, 221, 224, 234, 255, 221, 224, 233, 255, 220, 223, 233, 255, 228, 224, 230, 255, 235, 225, 227, 255, 237, 227, 228, 255, 237, 227, 227, 255,
-    237, 228, 227, 255, 236, 227, 227, 255, 235, 227, 226, 255, 228, 224, 225, 255, 212, 216, 224, 255, 209, 213, 224, 255, 206, 211, 222, 255, 206, 210, 221,
-    255, 205, 210, 221, 255, 207, 209, 219, 255, 209, 205, 218, 255, 200, 202, 219, 255, 194, 192, 214, 255, 194, 193, 213, 255, 212, 208, 218, 255, 216, 210,
-    219, 255, 216, 209, 219, 255, 216, 210, 218, 255, 217, 209, 218, 255, 218, 210, 218, 255, 202, 198, 215, 255, 198, 195, 215, 255, 201, 195, 214, 255, 203,
-    197, 216, 255, 206, 198, 217, 255, 208, 202, 220, 255, 211, 205, 222, 255, 201, 197, 211, 255, 102, 100, 106, 255, 127, 124, 131, 255, 186, 182, 192, 255,
-    225, 219, 230, 255, 156, 152, 159, 255, 116, 112, 117, 255, 173, 166, 171, 255, 243, 230, 234, 255, 167, 159, 159, 255, 250, 241, 237, 255, 195, 192, 188,
-    255, 231, 228, 225, 255, 169, 164, 163, 255, 145, 141, 142, 255, 177, 172, 174, 255, 248, 243, 245, 255, 231, 227, 228, 255, 186, 183, 184, 255, 224, 220,
-    221, 255, 138, 136, 137, 255, 122, 121, 122, 255, 196, 194, 195, 255, 220, 218, 219, 255, 62,  62,  62,  255, 150, 149, 150, 255, 250, 249, 250, 255, 169,
-    168, 169, 255, 125, 124, 125, 255, 189, 189, 189, 255, 251, 250, 250, 255, 151, 150, 150, 255, 110, 109, 109, 255, 228, 227, 227, 255, 134, 133, 133, 255,
-    128, 127, 127, 255, 179, 178, 178, 255, 252, 250, 250, 255, 203, 201, 201, 255, 127, 126, 126, 255, 156, 155, 154, 255, 253, 251, 250, 255, 111, 110, 110,
-    255, 98,  97,  97,  255, 226, 223, 223, 255, 254, 251, 249, 255, 244, 240, 239, 255, 144, 142, 142, 255, 111, 109, 108, 255, 245, 241, 238, 255, 138, 135,
-    133, 255, 137, 134, 132, 255, 165, 162, 158, 255, 251, 245, 241, 255, 177, 171, 170, 255, 126, 122, 121, 255, 91,  88,  87,  255, 225, 217, 216, 255, 167,
-    161, 160, 255, 246, 239, 238, 255, 200, 194, 194, 255, 123, 119, 119, 255, 145, 140, 140, 255, 246, 236, 233, 255, 250, 239, 230, 255, 237, 228, 225, 255,
-    173, 184, 209, 255, 175, 192, 214, 255, 178, 194, 216, 255, 181, 186, 211, 255, 182, 193, 217, 255, 184, 200, 221, 255, 186, 201, 222, 255, 188, 204, 224,
-    255, 190, 205, 224, 255, 193, 207, 226, 255, 195, 208, 227, 255, 197, 210, 228, 255, 199, 211, 229, 255, 201, 213, 229, 255, 203, 214, 230, 255, 204, 215,
-    230, 255, 206, 216, 231, 255, 208, 217, 231, 255, 210, 217, 231, 255, 211, 218, 231, 255, 212, 218, 231, 255, 213, 219, 231, 255, 214, 219, 231, 255, 215,
-    219, 231, 255, 216, 220, 230, 255, 217, 220, 230, 255, 216, 218, 230, 255, 224, 219, 227, 255, 230, 220, 224, 255, 232, 221, 224, 255, 232, 221, 224, 255,
-    232, 222, 224, 255, 231, 222, 223, 255, 226, 219, 222, 255, 226, 220, 222, 255, 211, 213, 222, 255, 206, 211, 221, 255, 204, 208, 220, 255, 202, 208, 219,
-    255, 203, 207, 219, 255, 205, 206, 217, 255, 209, 203, 216, 255, 201, 203, 218, 255, 192, 190, 212, 255, 192, 190, 211, 255, 208, 204, 216, 255, 211, 206,
-    216, 255, 211, 206, 216, 255, 212, 206, 216, 255, 213, 206, 216, 255, 214, 207, 217, 255, 201, 197, 215, 255, 199, 194, 214, 255, 201, 195, 214, 255, 203,
-    197, 216, 255, 206, 199, 217, 255, 209, 201, 220, 255, 212, 205, 222, 255, 214, 209, 224, 255, 100, 98,  104, 255, 124, 121, 128, 255, 223, 218, 229, 255,
-    188, 183, 192, 255, 133, 129, 134, 255, 234, 226, 234, 255, 98,  95,  98,  255, 243, 232, 234, 255, 113, 108, 108, 255, 249, 239, 237, 255, 128, 126, 121,
-    255, 238, 232, 228, 255, 97,  94,  94,  255, 215, 209, 210, 255, 248, 243, 245, 255, 249, 244, 246, 255, 194, 191, 193, 255, 167, 165, 166, 255, 181, 178,
-    180, 255, 157, 156, 156, 255, 247, 245, 246, 255, 105, 104, 104, 255, 251, 249, 250, 255, 119, 118, 119, 255, 251, 250, 251, 255, 207, 206, 207, 255, 151,
-    150, 151, 255, 251, 250, 251, 255, 110, 110, 110, 255, 242, 242, 243, 255, 77,  77,  77,  255, 248, 247, 246, 255, 214, 212, 212, 255, 127, 127, 126, 255,
-    254, 252, 251, 255, 103, 103, 102, 255, 248, 247, 247, 255, 111, 111, 111, 255, 252, 250, 250, 255, 126, 126, 125, 255, 236, 235, 234, 255, 151, 149, 150,
-    255, 221, 220, 219, 255, 252, 250, 249, 255, 254, 251, 249, 255, 213, 210, 210, 255, 105, 103, 103, 255, 251, 247, 246, 255, 142, 140, 139, 255, 205, 201,
-    199, 255, 219, 216, 213, 255, 104, 102, 100, 255, 228, 221, 219, 255, 116, 113, 112, 255, 249, 241, 239, 255, 70,  68,  68,  255, 248, 240, 238, 255, 112,
-    108, 108, 255, 244, 236, 235, 255, 104, 100, 100, 255, 244, 237, 236, 255, 132, 128, 128, 255, 214, 205, 204, 255, 249, 238, 231, 255, 252, 240, 227, 255,
-    174, 185, 208, 255, 173, 190, 213, 255, 178, 192, 213, 255, 178, 180, 207, 255, 180, 195, 217, 255, 182, 197, 219, 255, 184, 200, 221, 255, 186, 201, 222,
-    255, 188, 203, 223, 255, 190, 204, 224, 255, 192, 206, 225, 255, 194, 207, 226, 255, 196, 209, 227, 255, 199, 210, 227, 255, 201, 212, 228, 255, 203, 213,
-    228, 255, 204, 214, 229, 255, 206, 214, 229, 255, 208, 215, 229, 255, 210, 216, 230, 255, 211, 216, 230, 255, 212, 217, 230, 255, 214, 217, 229, 255, 215,
-    217, 229, 255, 215, 217, 229, 255, 216, 217, 228, 255, 215, 216, 227, 255, 220, 215, 224, 255, 226, 215, 222, 255, 227, 216, 221, 255, 227, 216, 221, 255,
-    226, 215, 221, 255, 225, 216, 220, 255, 215, 208, 217, 255, 220, 214, 219, 255, 209, 208, 219, 255, 204, 208, 219, 255, 202, 206, 218, 255, 200, 205, 217,
-    255, 200, 205, 217, 255, 202, 204, 216, 255, 208, 202, 214, 255, 206, 199, 215, 255, 191, 188, 210, 255, 190, 188, 209, 255, 209, 204, 216, 255, 212, 206,
-    217, 255, 213, 207, 216, 255, 213, 207, 216, 255, 215, 208, 217, 255, 216, 209, 217, 255, 201, 197, 215, 255, 198, 194, 214, 255, 201, 195, 213, 255, 203,
-    197, 216, 255, 206, 199, 218, 255, 209, 202, 220, 255, 212, 206, 223, 255, 216, 209, 225, 255, 120, 117, 125, 255, 199, 195, 206, 255, 224, 220, 231, 255,
-    140, 136, 143, 255, 192, 187, 194, 255, 234, 227, 235, 255, 106, 102, 105, 255, 222, 213, 215, 255, 137, 133, 131, 255, 251, 244, 240, 255, 116, 115, 110,
-    255, 252, 248, 243, 255, 113, 111, 110, 255, 250, 245, 244, 255, 248, 244, 245, 255, 249, 245, 246, 255, 166, 163, 164, 255, 198, 196, 197, 255, 151, 149,
-    150, 255, 211, 210, 210, 255, 251, 249, 250, 255, 115, 114, 115, 255, 251, 250, 250, 255, 117, 117, 117, 255, 252, 251, 251, 255, 155, 154, 155, 255, 120,
-    119, 120, 255, 140, 139, 140, 255, 136, 135, 136, 255, 212, 212, 212, 255, 153, 152, 153, 255, 253, 252, 252, 255, 183, 183, 182, 255, 183, 182, 182, 255,
-    253, 253, 252, 255, 116, 116, 116, 255, 217, 216, 216, 255, 86,  85,  85,  255, 140, 139, 139, 255, 119, 119, 119, 255, 241, 240, 239, 255, 121, 120, 120,
-    255, 248, 246, 246, 255, 253, 251, 250, 255, 254, 251, 250, 255, 183, 181, 180, 255, 183, 181, 181, 255, 253, 250, 248, 255, 115, 114, 113, 255, 254, 250,
-    247, 255, 226, 223, 219, 255, 137, 134, 132, 255, 179, 174, 173, 255, 187, 183, 180, 255, 251, 244, 242, 255, 107, 104, 103, 255, 249, 242, 240, 255, 113,
-    110, 109, 255, 213, 206, 204, 255, 145, 140, 140, 255, 245, 238, 237, 255, 137, 133, 133, 255, 216, 208, 208, 255, 248, 237, 232, 255, 251, 239, 228, 255,
-    175, 184, 206, 255, 172, 191, 213, 255, 177, 182, 206, 255, 176, 183, 209, 255, 178, 196, 217, 255, 179, 197, 219, 255, 181, 199, 220, 255, 183, 201, 221,
-    255, 186, 202, 222, 255, 188, 203, 223, 255, 190, 205, 224, 255, 192, 206, 225, 255, 195, 208, 225, 255, 197, 209, 226, 255, 199, 210, 227, 255, 200, 211,
-    228, 255, 203, 212, 228, 255, 205, 213, 228, 255, 207, 213, 228, 255, 208, 214, 228, 255, 210, 214, 228, 255, 211, 215, 228, 255, 212, 215, 228, 255, 213,
-    215, 228, 255, 214, 215, 227, 255, 214, 215, 227, 255, 213, 214, 226, 255, 217, 212, 222, 255, 221, 210, 218, 255, 222, 210, 218, 255, 221, 210, 217, 255,
-    220, 209, 217, 255, 219, 210, 217, 255, 211, 203, 215, 255, 217, 211, 218, 255, 203, 201, 214, 255, 202, 205, 217, 255, 200, 203, 215, 255, 198, 202, 215,
-    255, 197, 202, 214, 255, 199, 201, 214, 255, 205, 201, 213, 255, 213, 199, 212, 255, 191, 190, 210, 255, 189, 186, 207, 255, 208, 203, 215, 255, 211, 206,
-    215, 255, 212, 206, 216, 255, 214, 207, 217, 255, 215, 207, 217, 255, 216, 208, 217, 255, 201, 198, 215, 255, 198, 194, 214, 255, 201, 195, 213, 255, 204,
-    198, 217, 255, 207, 201, 219, 255, 210, 203, 221, 255, 213, 206, 223, 255, 216, 210, 225, 255, 100, 97,  103, 255, 221, 216, 228, 255, 225, 221, 231, 255,
-    147, 144, 150, 255, 174, 169, 175, 255, 212, 205, 212, 255, 116, 113, 116, 255, 207, 200, 202, 255, 131, 127, 125, 255, 240, 235, 229, 255, 88,  87,  86,
-    255, 254, 252, 247, 255, 114, 112, 110, 255, 250, 246, 246, 255, 250, 245, 247, 255, 250, 246, 247, 255, 136, 134, 135, 255, 229, 227, 227, 255, 119, 118,
-    119, 255, 242, 240, 241, 255, 234, 232, 233, 255, 129, 129, 129, 255, 247, 245, 246, 255, 102, 102, 102, 255, 251, 250, 251, 255, 164, 163, 164, 255, 195,
-    195, 195, 255, 233, 232, 233, 255, 194, 193, 194, 255, 183, 182, 183, 255, 183, 183, 183, 255, 253, 252, 253, 255, 153, 153, 152, 255, 214, 213, 213, 255,
-    254, 253, 252, 255, 114, 114, 114, 255, 225, 224, 224, 255, 133, 133, 133, 255, 249, 248, 248, 255, 178, 177, 177, 255, 253, 252, 252, 255, 108, 107, 107,
-    255, 245, 243, 243, 255, 253, 251, 251, 255, 254, 252, 250, 255, 153, 151, 150, 255, 212, 210, 210, 255, 253, 251, 249, 255, 107, 106, 105, 255, 241, 237,
-    234, 255, 142, 141, 139, 255, 168, 165, 163, 255, 183, 179, 177, 255, 163, 159, 158, 255, 222, 216, 214, 255, 83,  81,  80,  255, 249, 241, 240, 255, 114,
-    111, 111, 255, 219, 212, 211, 255, 124, 120, 119, 255, 239, 232, 232, 255, 102, 99,  99,  255, 244, 235, 235, 255, 247, 236, 233, 255, 251, 238, 229, 255,
-    181, 185, 204, 255, 173, 185, 207, 255, 172, 172, 200, 255, 174, 183, 208, 255, 175, 190, 213, 255, 177, 192, 215, 255, 179, 194, 216, 255, 181, 195, 217,
-    255, 183, 197, 218, 255, 186, 198, 219, 255, 188, 199, 220, 255, 190, 201, 221, 255, 192, 202, 222, 255, 193, 204, 223, 255, 196, 205, 224, 255, 198, 205,
-    224, 255, 200, 206, 224, 255, 202, 207, 225, 255, 203, 208, 224, 255, 205, 209, 225, 255, 206, 209, 224, 255, 208, 209, 225, 255, 209, 210, 224, 255, 210,
-    210, 224, 255, 211, 210, 224, 255, 211, 210, 224, 255, 211, 209, 222, 255, 214, 207, 219, 255, 218, 205, 216, 255, 218, 205, 215, 255, 217, 205, 214, 255,
-    215, 204, 214, 255, 214, 204, 213, 255, 206, 198, 212, 255, 214, 209, 217, 255, 195, 194, 212, 255, 200, 203, 215, 255, 197, 201, 214, 255, 196, 200, 214,
-    255, 195, 199, 212, 255, 197, 199, 212, 255, 202, 199, 211, 255, 215, 197, 210, 255, 196, 194, 211, 255, 187, 184, 204, 255, 204, 200, 212, 255, 207, 202,
-    213, 255, 208, 202, 214, 255, 209, 203, 214, 255, 211, 205, 215, 255, 212, 205, 216, 255, 200, 196, 214, 255, 199, 194, 214, 255, 201, 196, 214, 255, 204,
-    199, 217, 255, 207, 201, 220, 255, 210, 204, 222, 255, 213, 207, 224, 255, 217, 211, 226, 255, 163, 159, 169, 255, 223, 218, 230, 255, 227, 222, 232, 255,
-    225, 220, 229, 255, 132, 128, 133, 255, 135, 131, 136, 255, 229, 222, 229, 255, 243, 236, 239, 255, 148, 144, 145, 255, 149, 144, 144, 255, 182, 180, 175,
-    255, 252, 247, 244, 255, 183, 179, 180, 255, 249, 245, 246, 255, 249, 245, 247, 255, 249, 246, 248, 255, 186, 184, 185, 255, 250, 248, 249, 255, 184, 182,
-    183, 255, 251, 249, 250, 255, 232, 231, 231, 255, 204, 203, 204, 255, 252, 251, 251, 255, 158, 158, 158, 255, 206, 206, 206, 255, 246, 246, 246, 255, 141,
-    141, 141, 255, 146, 145, 146, 255, 243, 242, 243, 255, 208, 207, 208, 255, 230, 229, 230, 255, 253, 253, 253, 255, 193, 193, 192, 255, 246, 246, 245, 255,
-    250, 249, 249, 255, 189, 188, 188, 255, 253, 252, 253, 255, 167, 166, 167, 255, 134, 134, 134, 255, 223, 222, 222, 255, 254, 253, 252, 255, 203, 202, 202,
-    255, 163, 162, 162, 255, 253, 252, 251, 255, 255, 253, 251, 255, 193, 191, 190, 255, 244, 241, 242, 255, 253, 251, 249, 255, 222, 220, 218, 255, 131, 129,
-    128, 255, 165, 163, 161, 255, 223, 220, 217, 255, 250, 245, 243, 255, 145, 143, 141, 255, 156, 152, 151, 255, 181, 176, 175, 255, 244, 237, 236, 255, 190,
-    184, 183, 255, 249, 241, 240, 255, 166, 161, 160, 255, 129, 124, 124, 255, 216, 210, 210, 255, 244, 236, 236, 255, 246, 236, 233, 255, 250, 238, 230, 255,
-    185, 188, 204, 255, 172, 177, 200, 255, 171, 172, 199, 255, 172, 191, 213, 255, 174, 193, 214, 255, 176, 195, 216, 255, 177, 196, 217, 255, 180, 197, 218,
-    255, 182, 199, 219, 255, 184, 200, 220, 255, 187, 201, 221, 255, 189, 202, 221, 255, 191, 203, 222, 255, 193, 204, 223, 255, 196, 205, 222, 255, 199, 205,
-    223, 255, 201, 206, 223, 255, 204, 206, 223, 255, 205, 206, 223, 255, 205, 206, 222, 255, 206, 206, 222, 255, 208, 205, 221, 255, 208, 205, 221, 255, 209,
-    206, 221, 255, 210, 205, 219, 255, 210, 204, 218, 255, 209, 202, 217, 255, 209, 199, 214, 255, 209, 195, 210, 255, 207, 194, 209, 255, 209, 195, 209, 255,
-    206, 193, 208, 255, 205, 196, 209, 255, 200, 191, 208, 255, 206, 199, 210, 255, 193, 192, 211, 255, 197, 198, 212, 255, 196, 198, 212, 255, 194, 198, 211,
-    255, 194, 197, 211, 255, 194, 197, 210, 255, 200, 197, 210, 255, 214, 197, 209, 255, 201, 195, 211, 255, 186, 183, 202, 255, 208, 201, 213, 255, 211, 205,
-    215, 255, 213, 206, 215, 255, 214, 207, 215, 255, 215, 208, 217, 255, 217, 209, 217, 255, 202, 197, 215, 255, 198, 194, 214, 255, 201, 196, 213, 255, 205,
-    199, 217, 255, 207, 202, 220, 255, 211, 205, 222, 255, 215, 208, 224, 255, 217, 212, 227, 255, 221, 216, 229, 255, 224, 219, 231, 255, 228, 222, 232, 255,
-    231, 225, 234, 255, 234, 228, 236, 255, 236, 230, 238, 255, 238, 231, 238, 255, 244, 237, 240, 255, 246, 239, 241, 255, 247, 240, 241, 255, 251, 246, 243,
-    255, 249, 244, 244, 255, 248, 244, 245, 255, 249, 246, 247, 255, 250, 247, 248, 255, 250, 248, 249, 255, 251, 249, 250, 255, 251, 249, 250, 255, 251, 249,
-    250, 255, 252, 251, 251, 255, 252, 251, 251, 255, 252, 251, 252, 255, 252, 251, 252, 255, 252, 252, 252, 255, 252, 252, 252, 255, 252, 252, 252, 255, 253,
-    253, 253, 255, 252, 252, 252, 255, 253, 253, 253, 255, 253, 253, 253, 255, 253, 253, 254, 255, 254, 254, 253, 255, 255, 254, 253, 255, 254, 254, 253, 255,
-    254, 254, 253, 255, 253, 253, 252, 255, 253, 252, 252, 255, 253, 253, 253, 255, 253, 253, 253, 255, 253, 252, 252, 255, 254, 253, 253, 255, 253, 252, 252,
-    255, 253, 252, 251, 255, 254, 252, 252, 255, 255, 253, 252, 255, 254, 252, 251, 255, 251, 249, 250, 255, 254, 252, 250, 255, 254, 252, 250, 255, 254, 251,
-    248, 255, 254, 251, 248, 255, 253, 249, 246, 255, 253, 248, 245, 255, 253, 248, 246, 255, 252, 246, 244, 255, 251, 245, 243, 255, 250, 243, 242, 255, 250,
-    243, 242, 255, 249, 242, 241, 255, 248, 240, 240, 255, 245, 238, 238, 255, 244, 237, 237, 255, 244, 236, 236, 255, 246, 235, 234, 255, 249, 237, 231, 255,
-    179, 185, 203, 255, 168, 167, 194, 255, 169, 175, 200, 255, 170, 184, 209, 255, 172, 186, 210, 255, 174, 187, 211, 255, 176, 189, 212, 255, 178, 190, 214,
-    255, 180, 192, 214, 255, 182, 193, 216, 255, 184, 195, 216, 255, 186, 196, 218, 255, 188, 197, 218, 255, 190, 187, 210, 255, 203, 188, 209, 255, 207, 189,
-    209, 255, 210, 190, 208, 255, 213, 192, 208, 255, 215, 193, 208, 255, 216, 194, 208, 255, 217, 194, 208, 255, 216, 191, 208, 255, 216, 191, 207, 255, 217,
-    192, 208, 255, 219, 194, 207, 255, 220, 195, 206, 255, 219, 195, 205, 255, 218, 194, 204, 255, 212, 189, 204, 255, 202, 184, 204, 255, 209, 188, 203, 255,
-    209, 188, 203, 255, 206, 186, 202, 255, 194, 185, 204, 255, 203, 194, 208, 255, 193, 186, 204, 255, 191, 195, 211, 255, 195, 197, 211, 255, 193, 196, 209,
-    255, 192, 196, 209, 255, 192, 196, 209, 255, 197, 195, 209, 255, 209, 196, 209, 255, 210, 194, 209, 255, 186, 183, 201, 255, 202, 197, 210, 255, 205, 201,
-    212, 255, 207, 202, 213, 255, 209, 203, 214, 255, 210, 204, 215, 255, 212, 205, 216, 255, 201, 197, 214, 255, 199, 195, 215, 255, 201, 197, 214, 255, 205,
-    200, 218, 255, 208, 203, 221, 255, 211, 206, 223, 255, 215, 209, 225, 255, 218, 212, 227, 255, 221, 216, 229, 255, 225, 219, 231, 255, 228, 223, 233, 255,
-    231, 226, 235, 255, 235, 229, 237, 255, 237, 231, 238, 255, 238, 232, 239, 255, 244, 238, 241, 255, 245, 240, 242, 255, 244, 239, 243, 255, 244, 240, 244,
-    255, 246, 242, 245, 255, 248, 245, 246, 255, 249, 246, 248, 255, 250, 247, 248, 255, 250, 248, 249, 255, 251, 249, 250, 255, 251, 249, 250, 255, 252, 250,
-    251, 255, 252, 251, 251, 255, 252, 251, 251, 255, 252, 252, 252, 255, 252, 251, 252, 255, 253, 252, 253, 255, 252, 252, 252, 255, 253, 252, 252, 255, 253,
-    253, 253, 255, 253, 252, 253, 255, 253, 253, 253, 255, 254, 253, 254, 255, 253, 253, 253, 255, 254, 253, 253, 255, 255, 254, 254, 255, 255, 254, 254, 255,
-    254, 253, 253, 255, 253, 253, 253, 255, 254, 253, 253, 255, 254, 253, 253, 255, 254, 253, 253, 255, 253, 253, 253, 255, 253, 253, 252, 255, 253, 252, 252,
-    255, 253, 252, 252, 255, 254, 253, 252, 255, 255, 254, 252, 255, 254, 253, 251, 255, 252, 250, 251, 255, 254, 252, 250, 255, 254, 252, 250, 255, 254, 252,
-    249, 255, 254, 251, 249, 255, 253, 249, 247, 255, 253, 248, 246, 255, 252, 247, 246, 255, 252, 247, 245, 255, 251, 245, 244, 255, 250, 243, 242, 255, 250,
-    243, 242, 255, 249, 242, 241, 255, 248, 241, 240, 255, 246, 238, 238, 255, 245, 238, 238, 255, 243, 236, 236, 255, 245, 236, 234, 255, 249, 237, 232, 255,
-    169, 174, 197, 255, 166, 165, 191, 255, 168, 180, 204, 255, 169, 186, 209, 255, 171, 187, 210, 255, 173, 189, 211, 255, 175, 190, 212, 255, 177, 191, 213,
-    255, 179, 193, 214, 255, 182, 194, 215, 255, 184, 195, 216, 255, 187, 196, 217, 255, 189, 194, 215, 255, 198, 180, 205, 255, 196, 181, 204, 255, 195, 181,
-    204, 255, 195, 182, 204, 255, 196, 182, 204, 255, 196, 183, 204, 255, 197, 183, 204, 255, 198, 183, 204, 255, 198, 183, 204, 255, 197, 183, 204, 255, 199,
-    184, 204, 255, 201, 185, 204, 255, 199, 184, 203, 255, 199, 184, 202, 255, 202, 186, 202, 255, 203, 187, 201, 255, 206, 191, 201, 255, 204, 189, 200, 255,
-    194, 181, 199, 255, 201, 181, 200, 255, 191, 180, 201, 255, 199, 190, 205, 255, 191, 182, 202, 255, 188, 184, 204, 255, 194, 195, 208, 255, 193, 194, 208,
-    255, 192, 194, 207, 255, 192, 194, 208, 255, 195, 194, 207, 255, 203, 195, 207, 255, 215, 193, 206, 255, 190, 187, 204, 255, 203, 197, 210, 255, 207, 202,
-    212, 255, 208, 203, 213, 255, 210, 204, 214, 255, 212, 205, 215, 255, 213, 207, 216, 255, 201, 198, 214, 255, 198, 195, 215, 255, 202, 197, 214, 255, 205,
-    200, 217, 255, 209, 204, 221, 255, 211, 207, 223, 255, 215, 210, 225, 255, 218, 213, 227, 255, 222, 217, 230, 255, 225, 220, 231, 255, 228, 223, 234, 255,
-    232, 226, 235, 255, 235, 230, 237, 255, 237, 232, 239, 255, 239, 233, 240, 255, 244, 238, 242, 255, 245, 240, 243, 255, 244, 240, 243, 255, 247, 242, 244,
-    255, 249, 246, 247, 255, 248, 245, 247, 255, 249, 247, 248, 255, 250, 248, 249, 255, 250, 249, 250, 255, 251, 249, 250, 255, 251, 249, 250, 255, 251, 250,
-    251, 255, 252, 251, 252, 255, 252, 251, 252, 255, 252, 252, 252, 255, 253, 252, 252, 255, 253, 252, 253, 255, 253, 253, 253, 255, 253, 253, 253, 255, 253,
-    253, 253, 255, 253, 253, 254, 255, 253, 253, 254, 255, 253, 253, 253, 255, 253, 253, 254, 255, 254, 254, 253, 255, 254, 254, 253, 255, 254, 254, 253, 255,
-    254, 253, 253, 255, 253, 253, 254, 255, 253, 253, 253, 255, 253, 253, 254, 255, 253, 253, 254, 255, 253, 253, 253, 255, 253, 253, 253, 255, 253, 253, 254,
-    255, 253, 253, 254, 255, 253, 253, 253, 255, 254, 253, 253, 255, 255, 253, 252, 255, 252, 251, 251, 255, 253, 251, 251, 255, 254, 252, 251, 255, 255, 252,
-    250, 255, 254, 252, 249, 255, 253, 250, 247, 255, 253, 248, 246, 255, 251, 246, 245, 255, 252, 247, 245, 255, 251, 245, 244, 255, 250, 243, 242, 255, 248,
-    241, 241, 255, 248, 240, 240, 255, 247, 240, 240, 255, 246, 239, 239, 255, 245, 238, 238, 255, 244, 236, 237, 255, 245, 235, 235, 255, 248, 236, 232, 255,
-    165, 164, 190, 255, 165, 168, 193, 255, 166, 182, 206, 255, 168, 183, 207, 255, 170, 185, 208, 255, 172, 186, 209, 255, 174, 188, 210, 255, 176, 189, 211,
-    255, 178, 190, 212, 255, 181, 191, 213, 255, 183, 192, 214, 255, 185, 193, 214, 255, 187, 191, 213, 255, 197, 177, 202, 255, 191, 179, 201, 255, 223, 204,
-    204, 255, 231, 212, 205, 255, 206, 189, 202, 255, 229, 209, 205, 255, 220, 201, 203, 255, 231, 211, 204, 255, 223, 202, 203, 255, 196, 180, 201, 255, 229,
-    209, 204, 255, 247, 229, 207, 255, 233, 211, 204, 255, 225, 205, 202, 255, 250, 232, 206, 255, 240, 217, 202, 255, 253, 234, 206, 255, 252, 231, 204, 255,
-    223, 203, 198, 255, 199, 178, 198, 255, 189, 178, 199, 255, 196, 186, 203, 255, 188, 179, 200, 255, 184, 176, 198, 255, 192, 192, 206, 255, 192, 192, 207,
-    255, 192, 193, 206, 255, 192, 193, 206, 255, 194, 194, 207, 255, 200, 194, 206, 255, 212, 193, 206, 255, 197, 191, 208, 255, 202, 196, 210, 255, 207, 201,
-    213, 255, 209, 203, 213, 255, 210, 204, 214, 255, 212, 206, 215, 255, 214, 207, 216, 255, 201, 198, 214, 255, 199, 195, 215, 255, 202, 198, 214, 255, 206,
-    202, 218, 255, 209, 204, 221, 255, 212, 208, 224, 255, 215, 211, 226, 255, 219, 214, 228, 255, 222, 218, 230, 255, 225, 221, 232, 255, 229, 224, 234, 255,
-    231, 226, 236, 255, 235, 230, 238, 255, 237, 232, 239, 255, 239, 234, 241, 255, 244, 240, 242, 255, 246, 241, 243, 255, 244, 240, 244, 255, 249, 244, 245,
-    255, 251, 247, 248, 255, 248, 245, 247, 255, 250, 248, 248, 255, 251, 249, 249, 255, 251, 249, 250, 255, 252, 250, 251, 255, 251, 250, 251, 255, 252, 251,
-    252, 255, 253, 252, 252, 255, 253, 252, 253, 255, 253, 253, 253, 255, 253, 253, 253, 255, 253, 253, 253, 255, 254, 253, 254, 255, 254, 253, 254, 255, 254,
-    253, 254, 255, 253, 253, 253, 255, 254, 253, 254, 255, 254, 253, 254, 255, 254, 254, 254, 255, 254, 254, 253, 255, 254, 254, 254, 255, 253, 253, 254, 255,
-    254, 254, 254, 255, 253, 253, 253, 255, 253, 253, 253, 255, 253, 253, 253, 255, 253, 253, 253, 255, 253, 253, 254, 255, 253, 253, 254, 255, 253, 253, 254,
-    255, 253, 253, 254, 255, 253, 253, 254, 255, 253, 253, 253, 255, 254, 253, 252, 255, 253, 252, 251, 255, 253, 252, 251, 255, 255, 253, 251, 255, 255, 253,
-    250, 255, 254, 252, 249, 255, 253, 250, 248, 255, 252, 248, 247, 255, 250, 246, 245, 255, 252, 247, 245, 255, 251, 246, 245, 255, 250, 244, 243, 255, 249,
-    242, 242, 255, 248, 241, 241, 255, 248, 241, 240, 255, 247, 240, 240, 255, 246, 239, 239, 255, 244, 237, 237, 255, 244, 235, 235, 255, 247, 236, 232, 255,
-    163, 162, 187, 255, 165, 171, 195, 255, 166, 175, 202, 255, 167, 177, 204, 255, 169, 178, 205, 255, 171, 179, 205, 255, 172, 180, 206, 255, 175, 181, 207,
-    255, 176, 182, 208, 255, 178, 184, 209, 255, 181, 185, 210, 255, 183, 186, 210, 255, 184, 184, 209, 255, 196, 174, 199, 255, 222, 200, 199, 255, 252, 232,
-    207, 255, 251, 230, 206, 255, 246, 224, 205, 255, 246, 226, 206, 255, 250, 229, 206, 255, 245, 223, 204, 255, 233, 210, 202, 255, 193, 177, 198, 255, 237,
-    217, 204, 255, 254, 237, 207, 255, 250, 229, 204, 255, 226, 204, 200, 255, 254, 236, 205, 255, 243, 218, 200, 255, 254, 234, 204, 255, 242, 217, 199, 255,
-    237, 214, 197, 255, 201, 177, 195, 255, 186, 175, 196, 255, 193, 182, 200, 255, 185, 176, 198, 255, 182, 173, 195, 255, 189, 185, 201, 255, 192, 192, 205,
-    255, 192, 191, 205, 255, 192, 193, 205, 255, 194, 193, 206, 255, 198, 194, 206, 255, 208, 194, 206, 255, 202, 191, 208, 255, 196, 191, 208, 255, 200, 195,
-    210, 255, 201, 197, 211, 255, 203, 199, 212, 255, 205, 201, 213, 255, 207, 202, 215, 255, 200, 196, 214, 255, 199, 196, 214, 255, 202, 199, 214, 255, 206,
-    202, 218, 255, 209, 205, 222, 255, 213, 209, 224, 255, 216, 212, 226, 255, 219, 215, 228, 255, 223, 220, 231, 255, 228, 223, 233, 255, 232, 226, 235, 255,
-    233, 228, 237, 255, 236, 231, 238, 255, 239, 234, 240, 255, 240, 235, 241, 255, 243, 239, 242, 255, 246, 241, 243, 255, 244, 241, 245, 255, 249, 245, 246,
-    255, 251, 248, 249, 255, 248, 246, 248, 255, 250, 249, 250, 255, 251, 249, 250, 255, 251, 250, 250, 255, 252, 250, 251, 255, 252, 251, 251, 255, 252, 251,
-    252, 255, 253, 252, 252, 255, 253, 252, 253, 255, 253, 253, 253, 255, 253, 253, 253, 255, 254, 253, 254, 255, 254, 253, 254, 255, 254, 253, 254, 255, 254,
-    253, 254, 255, 254, 254, 254, 255, 254, 254, 254, 255, 254, 254, 254, 255, 254, 254, 254, 255, 255, 254, 254, 255, 254, 254, 254, 255, 212, 212, 212, 255,
-    225, 225, 225, 255, 254, 254, 254, 255, 254, 254, 254, 255, 254, 254, 254, 255, 253, 253, 254, 255, 253, 253, 254, 255, 254, 254, 254, 255, 253, 253, 254,
-    255, 253, 253, 254, 255, 253, 253, 254, 255, 253, 253, 253, 255, 253, 253, 253, 255, 253, 252, 253, 255, 253, 252, 252, 255, 254, 253, 251, 255, 254, 252,
-    250, 255, 153, 152, 150, 255, 166, 163, 162, 255, 252, 248, 247, 255, 250, 246, 246, 255, 251, 246, 246, 255, 252, 247, 246, 255, 250, 245, 244, 255, 249,
-    243, 243, 255, 248, 242, 242, 255, 248, 241, 241, 255, 247, 240, 240, 255, 246, 238, 239, 255, 243, 237, 238, 255, 244, 235, 236, 255, 247, 236, 233, 255,
-    163, 161, 187, 255, 165, 178, 199, 255, 166, 180, 204, 255, 167, 180, 205, 255, 170, 182, 205, 255, 171, 182, 206, 255, 174, 184, 207, 255, 176, 185, 208,
-    255, 178, 186, 208, 255, 179, 187, 209, 255, 182, 188, 210, 255, 184, 189, 210, 255, 185, 187, 209, 255, 194, 172, 197, 255, 229, 203, 198, 255, 251, 229,
-    204, 255, 243, 219, 202, 255, 250, 230, 205, 255, 246, 224, 203, 255, 254, 236, 207, 255, 253, 232, 204, 255, 235, 212, 200, 255, 192, 173, 196, 255, 239,
-    219, 202, 255, 251, 227, 202, 255, 254, 236, 205, 255, 231, 206, 197, 255, 254, 235, 203, 255, 243, 217, 198, 255, 254, 234, 202, 255, 252, 230, 200, 255,
-    229, 206, 195, 255, 199, 175, 193, 255, 184, 172, 194, 255, 189, 178, 199, 255, 183, 173, 196, 255, 180, 172, 194, 255, 184, 178, 196, 255, 193, 190, 204,
-    255, 192, 191, 205, 255, 193, 192, 205, 255, 194, 194, 206, 255, 196, 195, 206, 255, 203, 195, 206, 255, 202, 190, 207, 255, 202, 196, 210, 255, 206, 200,
-    211, 255, 207, 201, 212, 255, 209, 203, 214, 255, 211, 204, 215, 255, 213, 206, 216, 255, 201, 198, 214, 255, 199, 196, 214, 255, 202, 199, 215, 255, 206,
-    202, 218, 255, 209, 206, 222, 255, 213, 209, 225, 255, 216, 212, 227, 255, 220, 216, 229, 255, 227, 222, 232, 255, 237, 231, 235, 255, 239, 231, 235, 255,
-    241, 232, 237, 255, 243, 236, 239, 255, 245, 239, 242, 255, 248, 241, 243, 255, 250, 243, 246, 255, 251, 245, 247, 255, 250, 246, 247, 255, 251, 247, 248,
-    255, 252, 249, 250, 255, 251, 249, 250, 255, 243, 242, 242, 255, 203, 201, 202, 255, 242, 240, 240, 255, 254, 252, 252, 255, 218, 216, 216, 255, 231, 229,
-    229, 255, 211, 210, 210, 255, 254, 253, 253, 255, 255, 254, 253, 255, 227, 227, 227, 255, 211, 210, 210, 255, 255, 254, 254, 255, 254, 253, 253, 255, 255,
-    254, 254, 255, 255, 254, 254, 255, 254, 254, 254, 255, 245, 245, 245, 255, 205, 204, 204, 255, 240, 240, 240, 255, 241, 241, 241, 255, 64,  64,  64,  255,
-    135, 135, 135, 255, 246, 246, 246, 255, 250, 250, 250, 255, 205, 205, 205, 255, 237, 237, 237, 255, 254, 254, 254, 255, 224, 224, 224, 255, 229, 229, 229,
-    255, 208, 208, 208, 255, 252, 252, 253, 255, 254, 254, 253, 255, 255, 254, 253, 255, 252, 251, 251, 255, 208, 208, 208, 255, 228, 227, 226, 255, 254, 253,
-    251, 255, 77,  76,  76,  255, 141, 140, 139, 255, 205, 203, 203, 255, 249, 245, 245, 255, 250, 246, 246, 255, 233, 228, 227, 255, 202, 198, 198, 255, 245,
-    239, 239, 255, 243, 237, 237, 255, 204, 199, 199, 255, 219, 212, 213, 255, 217, 211, 212, 255, 243, 236, 238, 255, 243, 235, 236, 255, 246, 235, 234, 255,
-    165, 165, 189, 255, 170, 179, 198, 255, 178, 182, 201, 255, 166, 171, 200, 255, 167, 172, 201, 255, 169, 173, 202, 255, 171, 174, 203, 255, 172, 175, 203,
-    255, 174, 177, 204, 255, 176, 177, 204, 255, 178, 179, 205, 255, 180, 179, 206, 255, 182, 179, 204, 255, 192, 170, 195, 255, 226, 200, 195, 255, 252, 229,
-    202, 255, 241, 216, 199, 255, 250, 229, 203, 255, 244, 221, 201, 255, 254, 235, 205, 255, 254, 235, 205, 255, 238, 214, 199, 255, 191, 171, 194, 255, 242,
-    221, 201, 255, 241, 212, 197, 255, 254, 235, 203, 255, 239, 212, 196, 255, 254, 234, 202, 255, 243, 216, 196, 255, 254, 233, 200, 255, 246, 220, 196, 255,
-    240, 214, 193, 255, 197, 172, 191, 255, 182, 170, 192, 255, 186, 173, 197, 255, 182, 171, 194, 255, 178, 170, 192, 255, 180, 173, 192, 255, 192, 190, 203,
-    255, 193, 191, 204, 255, 193, 192, 204, 255, 194, 194, 205, 255, 195, 195, 206, 255, 200, 195, 207, 255, 200, 190, 205, 255, 199, 194, 210, 255, 200, 194,
-    209, 255, 201, 196, 210, 255, 203, 198, 211, 255, 206, 200, 213, 255, 208, 202, 214, 255, 200, 197, 214, 255, 200, 197, 215, 255, 203, 200, 216, 255, 206,
-    203, 219, 255, 209, 206, 223, 255, 213, 210, 225, 255, 221, 215, 228, 255, 230, 222, 230, 255, 233, 225, 231, 255, 234, 225, 232, 255, 235, 227, 233, 255,
-    237, 230, 235, 255, 240, 232, 237, 255, 242, 236, 239, 255, 244, 239, 241, 255, 246, 240, 243, 255, 249, 243, 245, 255, 250, 245, 247, 255, 251, 247, 248,
-    255, 253, 249, 249, 255, 230, 227, 226, 255, 35,  35,  35,  255, 48,  47,  47,  255, 34,  34,  34,  255, 246, 245, 244, 255, 17,  17,  17,  255, 49,  49,
-    49,  255, 9,   9,   9,   255, 166, 166, 166, 255, 161, 161, 160, 255, 28,  28,  28,  255, 26,  26,  26,  255, 141, 141, 141, 255, 254, 254, 254, 255, 254,
-    254, 254, 255, 255, 254, 254, 255, 238, 238, 238, 255, 35,  35,  35,  255, 72,  72,  72,  255, 25,  25,  25,  255, 171, 171, 171, 255, 9,   9,   9,   255,
-    54,  54,  54,  255, 218, 218, 218, 255, 51,  51,  51,  255, 49,  49,  49,  255, 20,  20,  20,  255, 229, 229, 229, 255, 58,  58,  58,  255, 31,  31,  31,
-    255, 20,  20,  20,  255, 119, 119, 119, 255, 254, 254, 254, 255, 255, 254, 253, 255, 79,  78,  78,  255, 61,  61,  61,  255, 22,  21,  21,  255, 200, 199,
-    197, 255, 47,  46,  46,  255, 43,  42,  42,  255, 16,  16,  16,  255, 133, 131, 130, 255, 187, 184, 184, 255, 25,  25,  25,  255, 35,  34,  34,  255, 89,
-    87,  87,  255, 209, 204, 204, 255, 0,   0,   0,   255, 47,  46,  46,  255, 7,   7,   7,   255, 199, 194, 195, 255, 243, 235, 236, 255, 246, 235, 234, 255,
-    163, 169, 195, 255, 164, 173, 199, 255, 166, 176, 201, 255, 167, 178, 202, 255, 169, 179, 202, 255, 171, 179, 203, 255, 173, 180, 204, 255, 174, 181, 205,
-    255, 177, 182, 205, 255, 179, 182, 205, 255, 181, 184, 206, 255, 183, 184, 207, 255, 184, 182, 205, 255, 189, 168, 193, 255, 223, 196, 193, 255, 252, 229,
-    199, 255, 239, 214, 197, 255, 250, 230, 202, 255, 244, 219, 199, 255, 251, 227, 199, 255, 254, 234, 203, 255, 241, 216, 197, 255, 190, 170, 192, 255, 246,
-    224, 200, 255, 251, 229, 200, 255, 254, 235, 202, 255, 246, 218, 195, 255, 254, 234, 200, 255, 244, 215, 194, 255, 254, 232, 199, 255, 238, 210, 192, 255,
-    250, 223, 193, 255, 196, 171, 190, 255, 181, 168, 190, 255, 183, 170, 196, 255, 179, 169, 193, 255, 177, 169, 191, 255, 177, 169, 190, 255, 190, 188, 201,
-    255, 193, 191, 203, 255, 194, 193, 204, 255, 194, 194, 205, 255, 195, 196, 205, 255, 198, 196, 206, 255, 199, 193, 206, 255, 202, 196, 210, 255, 202, 196,
-    209, 255, 203, 198, 210, 255, 205, 199, 212, 255, 208, 201, 214, 255, 210, 203, 215, 255, 201, 198, 214, 255, 200, 198, 215, 255, 203, 201, 215, 255, 206,
-    204, 218, 255, 211, 208, 223, 255, 222, 216, 226, 255, 234, 220, 225, 255, 229, 219, 226, 255, 229, 221, 228, 255, 230, 224, 231, 255, 233, 227, 233, 255,
-    237, 231, 236, 255, 243, 236, 239, 255, 248, 241, 242, 255, 249, 243, 244, 255, 251, 245, 245, 255, 252, 247, 247, 255, 253, 249, 248, 255, 253, 250, 249,
-    255, 252, 250, 249, 255, 128, 127, 125, 255, 91,  90,  89,  255, 253, 252, 250, 255, 16,  16,  16,  255, 191, 190, 189, 255, 0,   0,   0,   255, 236, 235,
-    235, 255, 79,  79,  79,  255, 144, 144, 143, 255, 38,  38,  38,  255, 82,  81,  81,  255, 75,  75,  75,  255, 70,  70,  70,  255, 115, 115, 115, 255, 30,
-    30,  30,  255, 30,  30,  30,  255, 189, 189, 189, 255, 15,  15,  15,  255, 115, 115, 115, 255, 171, 171, 171, 255, 250, 250, 250, 255, 14,  14,  14,  255,
-    225, 225, 225, 255, 161, 161, 161, 255, 60,  60,  60,  255, 255, 255, 255, 255, 47,  47,  47,  255, 177, 177, 177, 255, 28,  28,  28,  255, 184, 184, 184,
-    255, 149, 149, 149, 255, 58,  58,  59,  255, 254, 254, 253, 255, 255, 254, 253, 255, 33,  33,  32,  255, 87,  87,  87,  255, 154, 153, 152, 255, 239, 238,
-    236, 255, 16,  16,  16,  255, 205, 203, 202, 255, 109, 108, 108, 255, 108, 107, 107, 255, 63,  62,  62,  255, 154, 151, 151, 255, 203, 199, 198, 255, 19,
-    19,  19,  255, 181, 178, 178, 255, 28,  27,  28,  255, 241, 235, 236, 255, 51,  50,  50,  255, 148, 144, 145, 255, 243, 235, 236, 255, 245, 235, 234, 255,
-    162, 168, 197, 255, 163, 170, 199, 255, 164, 171, 199, 255, 165, 171, 199, 255, 167, 172, 200, 255, 168, 173, 200, 255, 170, 174, 200, 255, 172, 176, 202,
-    255, 174, 177, 202, 255, 176, 177, 203, 255, 178, 178, 203, 255, 180, 179, 204, 255, 181, 177, 202, 255, 187, 166, 191, 255, 217, 190, 191, 255, 253, 229,
-    199, 255, 241, 215, 196, 255, 251, 229, 200, 255, 243, 217, 197, 255, 244, 218, 196, 255, 248, 226, 199, 255, 244, 219, 196, 255, 188, 168, 190, 255, 250,
-    227, 198, 255, 233, 208, 195, 255, 250, 228, 199, 255, 251, 224, 195, 255, 254, 234, 199, 255, 242, 215, 193, 255, 253, 231, 197, 255, 235, 208, 190, 255,
-    249, 221, 191, 255, 195, 169, 189, 255, 180, 167, 189, 255, 180, 168, 194, 255, 178, 168, 192, 255, 176, 168, 190, 255, 176, 167, 189, 255, 185, 180, 196,
-    255, 196, 193, 203, 255, 197, 195, 204, 255, 197, 196, 205, 255, 195, 195, 206, 255, 196, 196, 206, 255, 198, 196, 207, 255, 198, 192, 208, 255, 203, 197,
-    210, 255, 205, 198, 211, 255, 207, 200, 212, 255, 208, 202, 213, 255, 207, 201, 214, 255, 199, 196, 213, 255, 199, 198, 215, 255, 203, 201, 215, 255, 207,
-    205, 219, 255, 216, 211, 223, 255, 232, 220, 224, 255, 244, 226, 221, 255, 235, 224, 229, 255, 239, 230, 234, 255, 244, 235, 238, 255, 245, 238, 240, 255,
-    249, 241, 241, 255, 251, 243, 243, 255, 251, 244, 244, 255, 252, 246, 246, 255, 253, 248, 248, 255, 253, 249, 249, 255, 253, 249, 249, 255, 253, 250, 249,
-    255, 251, 249, 249, 255, 104, 103, 102, 255, 109, 109, 108, 255, 218, 216, 215, 255, 11,  11,  11,  255, 194, 193, 192, 255, 22,  22,  22,  255, 253, 252,
-    252, 255, 55,  55,  55,  255, 174, 174, 173, 255, 18,  18,  18,  255, 150, 149, 149, 255, 155, 155, 155, 255, 197, 197, 197, 255, 239, 239, 239, 255, 231,
-    231, 231, 255, 231, 231, 231, 255, 216, 216, 216, 255, 167, 166, 166, 255, 106, 106, 106, 255, 23,  23,  23,  255, 236, 236, 236, 255, 0,   0,   0,   255,
-    241, 241, 241, 255, 138, 138, 138, 255, 79,  79,  79,  255, 236, 236, 236, 255, 18,  18,  18,  255, 211, 211, 211, 255, 2,   2,   2,   255, 201, 201, 201,
-    255, 101, 101, 101, 255, 95,  95,  95,  255, 254, 254, 253, 255, 237, 236, 236, 255, 166, 165, 165, 255, 143, 143, 143, 255, 7,   7,   7,   255, 195, 194,
-    192, 255, 0,   0,   0,   255, 241, 239, 238, 255, 85,  84,  84,  255, 141, 139, 139, 255, 42,  42,  42,  255, 173, 169, 169, 255, 155, 153, 152, 255, 60,
-    59,  59,  255, 152, 149, 149, 255, 43,  41,  42,  255, 230, 224, 226, 255, 20,  19,  19,  255, 183, 178, 179, 255, 243, 235, 236, 255, 245, 234, 234, 255,
-    163, 170, 196, 255, 165, 175, 198, 255, 167, 179, 200, 255, 170, 178, 198, 255, 168, 170, 193, 255, 166, 171, 194, 255, 168, 173, 195, 255, 172, 174, 195,
-    255, 175, 172, 194, 255, 176, 174, 198, 255, 177, 175, 202, 255, 179, 176, 202, 255, 180, 174, 201, 255, 185, 165, 190, 255, 191, 170, 189, 255, 243, 217,
-    194, 255, 249, 226, 197, 255, 221, 196, 192, 255, 224, 198, 191, 255, 230, 202, 192, 255, 219, 194, 191, 255, 220, 193, 191, 255, 187, 166, 189, 255, 219,
-    193, 191, 255, 201, 178, 190, 255, 210, 186, 190, 255, 209, 185, 189, 255, 207, 184, 189, 255, 199, 177, 187, 255, 199, 179, 188, 255, 191, 172, 187, 255,
-    192, 173, 187, 255, 193, 167, 188, 255, 178, 166, 188, 255, 177, 166, 192, 255, 176, 166, 191, 255, 175, 166, 189, 255, 174, 167, 189, 255, 182, 176, 193,
-    255, 205, 198, 204, 255, 201, 196, 204, 255, 194, 193, 204, 255, 193, 193, 204, 255, 194, 195, 205, 255, 198, 198, 207, 255, 196, 190, 207, 255, 198, 192,
-    209, 255, 196, 193, 209, 255, 198, 190, 207, 255, 201, 192, 207, 255, 198, 192, 208, 255, 197, 195, 210, 255, 200, 198, 213, 255, 203, 202, 215, 255, 211,
-    208, 220, 255, 217, 212, 222, 255, 242, 225, 223, 255, 238, 227, 228, 255, 238, 228, 233, 255, 247, 237, 238, 255, 247, 238, 240, 255, 250, 241, 242, 255,
-    251, 244, 245, 255, 252, 246, 246, 255, 252, 246, 247, 255, 252, 247, 247, 255, 252, 247, 247, 255, 253, 248, 248, 255, 253, 250, 250, 255, 254, 251, 251,
-    255, 252, 249, 250, 255, 195, 193, 193, 255, 19,  19,  19,  255, 20,  20,  20,  255, 154, 153, 153, 255, 177, 176, 175, 255, 53,  53,  53,  255, 253, 252,
-    252, 255, 27,  27,  26,  255, 206, 205, 205, 255, 123, 123, 123, 255, 13,  13,  13,  255, 35,  35,  35,  255, 210, 210, 209, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 254, 255, 189, 189, 189, 255, 24,  24,  24,  255, 34,  34,  34,  255, 119, 119, 119, 255, 238, 238, 238, 255, 28,  28,  28,  255,
-    89,  89,  89,  255, 218, 218, 219, 255, 26,  26,  26,  255, 17,  17,  17,  255, 129, 129, 129, 255, 218, 218, 218, 255, 8,   8,   8,   255, 23,  23,  23,
-    255, 30,  30,  30,  255, 217, 217, 217, 255, 254, 253, 253, 255, 232, 232, 231, 255, 37,  37,  37,  255, 37,  37,  37,  255, 67,  67,  67,  255, 200, 199,
-    198, 255, 22,  22,  22,  255, 252, 250, 250, 255, 57,  56,  56,  255, 173, 170, 170, 255, 142, 140, 140, 255, 12,  12,  12,  255, 31,  31,  31,  255, 200,
-    196, 196, 255, 121, 118, 118, 255, 22,  21,  21,  255, 6,   6,   6,   255, 86,  84,  85,  255, 242, 235, 237, 255, 244, 236, 236, 255, 246, 235, 234, 255,
-    174, 191, 202, 255, 176, 184, 199, 255, 166, 168, 190, 255, 169, 170, 192, 255, 180, 190, 201, 255, 171, 186, 201, 255, 167, 183, 200, 255, 173, 183, 200,
-    255, 190, 183, 198, 255, 178, 173, 194, 255, 176, 168, 193, 255, 177, 169, 194, 255, 181, 177, 201, 255, 182, 164, 189, 255, 181, 163, 187, 255, 183, 165,
-    187, 255, 186, 167, 187, 255, 183, 164, 187, 255, 184, 164, 187, 255, 185, 165, 188, 255, 185, 165, 188, 255, 185, 165, 188, 255, 186, 164, 187, 255, 186,
-    165, 187, 255, 187, 165, 188, 255, 189, 165, 188, 255, 190, 165, 187, 255, 190, 165, 186, 255, 191, 166, 186, 255, 193, 166, 186, 255, 195, 166, 186, 255,
-    195, 166, 187, 255, 193, 165, 187, 255, 177, 164, 187, 255, 176, 164, 189, 255, 175, 165, 188, 255, 174, 166, 187, 255, 174, 167, 188, 255, 176, 170, 190,
-    255, 197, 192, 201, 255, 190, 189, 201, 255, 189, 190, 203, 255, 192, 194, 205, 255, 195, 197, 207, 255, 199, 200, 208, 255, 197, 194, 207, 255, 199, 193,
-    209, 255, 189, 186, 205, 255, 189, 187, 204, 255, 194, 191, 207, 255, 201, 197, 211, 255, 209, 203, 215, 255, 205, 201, 215, 255, 206, 203, 217, 255, 207,
-    206, 218, 255, 219, 214, 224, 255, 234, 223, 229, 255, 241, 231, 234, 255, 236, 230, 235, 255, 244, 235, 238, 255, 247, 238, 239, 255, 251, 242, 242, 255,
-    251, 244, 244, 255, 251, 244, 245, 255, 252, 246, 246, 255, 253, 248, 248, 255, 253, 249, 249, 255, 253, 249, 249, 255, 254, 250, 250, 255, 253, 251, 251,
-    255, 253, 251, 251, 255, 252, 250, 249, 255, 250, 248, 247, 255, 248, 246, 247, 255, 252, 250, 251, 255, 253, 252, 252, 255, 253, 252, 252, 255, 253, 253,
-    253, 255, 254, 253, 253, 255, 255, 254, 254, 255, 254, 254, 254, 255, 248, 247, 247, 255, 253, 253, 252, 255, 255, 254, 254, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 254, 254, 254, 255, 254, 254, 254, 255, 253, 253, 253, 255, 250, 250, 250, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 253, 253, 253, 255, 249, 249, 249, 255, 254, 254, 254, 255, 188, 188, 188, 255, 43,  43,  43,  255, 249, 249, 249,
-    255, 252, 252, 252, 255, 254, 254, 255, 255, 254, 254, 254, 255, 254, 253, 254, 255, 253, 253, 253, 255, 248, 247, 246, 255, 255, 254, 252, 255, 255, 253,
-    252, 255, 254, 253, 252, 255, 253, 250, 250, 255, 252, 249, 249, 255, 252, 249, 249, 255, 251, 247, 247, 255, 245, 241, 240, 255, 250, 245, 244, 255, 251,
-    247, 246, 255, 89,  87,  87,  255, 134, 131, 131, 255, 238, 232, 234, 255, 244, 238, 239, 255, 244, 237, 238, 255, 245, 236, 236, 255, 246, 235, 235, 255,
-    165, 170, 191, 255, 162, 162, 188, 255, 162, 161, 190, 255, 163, 162, 190, 255, 164, 163, 190, 255, 165, 164, 191, 255, 167, 163, 190, 255, 168, 162, 190,
-    255, 173, 164, 191, 255, 171, 163, 191, 255, 174, 166, 194, 255, 175, 166, 193, 255, 176, 165, 192, 255, 178, 163, 189, 255, 189, 163, 188, 255, 182, 164,
-    191, 255, 187, 165, 191, 255, 204, 168, 189, 255, 203, 168, 188, 255, 202, 168, 187, 255, 201, 168, 187, 255, 198, 167, 187, 255, 194, 164, 187, 255, 193,
-    164, 187, 255, 194, 165, 188, 255, 197, 166, 186, 255, 196, 167, 187, 255, 194, 166, 187, 255, 192, 166, 186, 255, 189, 165, 186, 255, 187, 165, 185, 255,
-    185, 165, 187, 255, 192, 176, 191, 255, 206, 190, 197, 255, 205, 190, 198, 255, 204, 190, 198, 255, 203, 190, 198, 255, 204, 190, 197, 255, 203, 191, 198,
-    255, 193, 187, 199, 255, 188, 187, 201, 255, 191, 193, 204, 255, 195, 198, 206, 255, 197, 201, 208, 255, 199, 201, 208, 255, 198, 198, 208, 255, 201, 197,
-    211, 255, 194, 196, 211, 255, 195, 197, 212, 255, 200, 202, 215, 255, 202, 205, 217, 255, 207, 205, 217, 255, 206, 203, 216, 255, 204, 203, 215, 255, 220,
-    209, 220, 255, 235, 223, 229, 255, 241, 226, 230, 255, 239, 231, 235, 255, 244, 234, 235, 255, 249, 238, 238, 255, 246, 236, 237, 255, 247, 238, 240, 255,
-    250, 243, 243, 255, 252, 246, 246, 255, 252, 247, 246, 255, 253, 248, 247, 255, 253, 249, 248, 255, 254, 250, 249, 255, 254, 251, 250, 255, 254, 251, 251,
-    255, 254, 252, 251, 255, 253, 251, 250, 255, 252, 250, 250, 255, 251, 250, 251, 255, 252, 251, 252, 255, 252, 251, 252, 255, 252, 252, 252, 255, 253, 253,
-    253, 255, 254, 253, 253, 255, 254, 253, 253, 255, 254, 254, 254, 255, 254, 254, 254, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    254, 254, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 254, 254, 254, 255, 210, 210, 210, 255, 160, 160, 160, 255, 255, 254, 255,
-    255, 254, 254, 254, 255, 254, 254, 255, 255, 254, 254, 254, 255, 254, 253, 253, 255, 254, 253, 253, 255, 255, 254, 253, 255, 254, 253, 252, 255, 254, 253,
-    252, 255, 254, 253, 252, 255, 254, 252, 251, 255, 252, 250, 250, 255, 252, 249, 249, 255, 251, 247, 247, 255, 251, 247, 246, 255, 250, 245, 245, 255, 251,
-    246, 246, 255, 158, 155, 155, 255, 203, 199, 199, 255, 245, 240, 241, 255, 244, 238, 239, 255, 244, 237, 238, 255, 245, 237, 237, 255, 246, 235, 235, 255,
-    166, 166, 190, 255, 167, 168, 192, 255, 168, 169, 193, 255, 170, 173, 194, 255, 172, 176, 195, 255, 172, 175, 195, 255, 171, 170, 193, 255, 173, 170, 193,
-    255, 179, 177, 196, 255, 182, 180, 198, 255, 187, 186, 200, 255, 190, 189, 202, 255, 191, 188, 202, 255, 188, 182, 199, 255, 181, 168, 192, 255, 178, 161,
-    189, 255, 178, 162, 189, 255, 180, 162, 191, 255, 181, 163, 191, 255, 186, 170, 191, 255, 192, 179, 196, 255, 197, 188, 200, 255, 193, 183, 198, 255, 187,
-    166, 191, 255, 193, 182, 199, 255, 197, 188, 202, 255, 198, 189, 202, 255, 196, 184, 199, 255, 190, 176, 194, 255, 181, 166, 190, 255, 184, 166, 189, 255,
-    182, 164, 188, 255, 181, 166, 187, 255, 183, 167, 189, 255, 183, 168, 189, 255, 183, 167, 190, 255, 184, 168, 190, 255, 183, 169, 191, 255, 182, 169, 192,
-    255, 184, 175, 196, 255, 191, 191, 202, 255, 194, 196, 204, 255, 196, 198, 206, 255, 198, 201, 207, 255, 197, 201, 208, 255, 199, 200, 209, 255, 198, 194,
-    210, 255, 190, 199, 215, 255, 191, 202, 218, 255, 194, 206, 220, 255, 197, 208, 222, 255, 200, 207, 221, 255, 201, 205, 218, 255, 207, 206, 219, 255, 227,
-    213, 224, 255, 222, 215, 225, 255, 239, 223, 229, 255, 243, 232, 234, 255, 238, 229, 233, 255, 232, 227, 233, 255, 243, 231, 235, 255, 249, 240, 241, 255,
-    247, 241, 242, 255, 244, 239, 241, 255, 243, 239, 242, 255, 244, 241, 244, 255, 248, 244, 245, 255, 252, 247, 248, 255, 252, 248, 249, 255, 253, 250, 249,
-    255, 252, 249, 250, 255, 250, 249, 250, 255, 250, 249, 250, 255, 251, 250, 251, 255, 251, 251, 252, 255, 252, 252, 252, 255, 252, 252, 252, 255, 253, 252,
-    253, 255, 253, 253, 253, 255, 253, 253, 253, 255, 254, 254, 254, 255, 254, 254, 254, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254,
-    254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 254, 254, 254, 255, 254, 254, 254, 255, 255, 254, 254, 255, 254, 254, 254, 255, 254, 253, 253, 255, 255, 254, 253, 255, 254, 253, 252, 255, 253, 252,
-    252, 255, 253, 252, 251, 255, 254, 253, 251, 255, 253, 251, 250, 255, 252, 249, 249, 255, 251, 248, 248, 255, 251, 247, 246, 255, 250, 246, 245, 255, 251,
-    246, 245, 255, 250, 245, 245, 255, 248, 243, 243, 255, 245, 240, 241, 255, 244, 238, 239, 255, 244, 236, 238, 255, 246, 237, 237, 255, 246, 235, 234, 255,
-    184, 193, 202, 255, 183, 191, 201, 255, 177, 184, 198, 255, 172, 178, 196, 255, 171, 175, 196, 255, 175, 180, 198, 255, 180, 187, 201, 255, 184, 191, 203,
-    255, 188, 192, 204, 255, 189, 193, 204, 255, 190, 192, 204, 255, 195, 196, 205, 255, 204, 209, 212, 255, 209, 214, 215, 255, 207, 210, 213, 255, 178, 164,
-    187, 255, 177, 161, 187, 255, 178, 161, 189, 255, 189, 179, 198, 255, 192, 182, 199, 255, 188, 178, 196, 255, 189, 176, 196, 255, 185, 168, 193, 255, 181,
-    162, 186, 255, 184, 172, 194, 255, 186, 177, 196, 255, 187, 178, 195, 255, 189, 182, 196, 255, 192, 184, 197, 255, 196, 187, 199, 255, 196, 185, 197, 255,
-    190, 176, 194, 255, 185, 174, 192, 255, 180, 170, 191, 255, 177, 167, 190, 255, 175, 167, 190, 255, 175, 168, 190, 255, 175, 169, 192, 255, 175, 171, 193,
-    255, 178, 175, 195, 255, 182, 181, 199, 255, 185, 187, 202, 255, 192, 195, 206, 255, 192, 194, 205, 255, 194, 196, 206, 255, 195, 197, 208, 255, 197, 195,
-    209, 255, 193, 195, 213, 255, 200, 199, 215, 255, 197, 199, 216, 255, 196, 200, 216, 255, 204, 207, 221, 255, 206, 208, 222, 255, 214, 213, 226, 255, 225,
-    220, 229, 255, 219, 216, 226, 255, 224, 220, 229, 255, 235, 228, 234, 255, 233, 228, 234, 255, 239, 234, 238, 255, 243, 238, 241, 255, 245, 240, 242, 255,
-    245, 241, 243, 255, 245, 242, 245, 255, 247, 243, 246, 255, 248, 245, 247, 255, 249, 247, 248, 255, 251, 248, 249, 255, 251, 249, 250, 255, 251, 249, 250,
-    255, 252, 250, 251, 255, 252, 251, 252, 255, 251, 251, 252, 255, 252, 252, 253, 255, 253, 252, 253, 255, 253, 253, 253, 255, 253, 252, 253, 255, 253, 253,
-    253, 255, 254, 253, 254, 255, 253, 253, 253, 255, 254, 254, 254, 255, 254, 254, 254, 255, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254,
-    254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 254, 254, 254, 255, 254, 254, 254, 255, 254, 254, 253, 255, 254, 254, 253, 255, 255, 254, 253, 255, 253, 253, 252, 255, 252, 252,
-    252, 255, 251, 251, 252, 255, 253, 252, 251, 255, 254, 252, 250, 255, 252, 249, 249, 255, 251, 248, 248, 255, 250, 247, 247, 255, 250, 245, 245, 255, 250,
-    245, 245, 255, 251, 246, 245, 255, 249, 243, 243, 255, 246, 240, 241, 255, 245, 238, 239, 255, 244, 236, 237, 255, 245, 235, 236, 255, 246, 235, 234, 255,
-    169, 174, 195, 255, 169, 177, 196, 255, 172, 184, 199, 255, 180, 194, 203, 255, 187, 202, 208, 255, 192, 207, 210, 255, 198, 211, 213, 255, 204, 215, 215,
-    255, 209, 218, 217, 255, 213, 221, 218, 255, 216, 222, 220, 255, 215, 218, 217, 255, 210, 210, 213, 255, 211, 210, 213, 255, 212, 210, 213, 255, 187, 176,
-    193, 255, 175, 160, 185, 255, 176, 160, 184, 255, 197, 190, 201, 255, 200, 196, 206, 255, 184, 170, 193, 255, 179, 161, 189, 255, 179, 160, 187, 255, 181,
-    160, 187, 255, 183, 163, 191, 255, 182, 166, 190, 255, 186, 175, 194, 255, 195, 194, 204, 255, 196, 196, 204, 255, 195, 191, 201, 255, 190, 182, 197, 255,
-    187, 179, 196, 255, 186, 181, 196, 255, 188, 184, 197, 255, 189, 186, 199, 255, 188, 185, 198, 255, 188, 186, 199, 255, 190, 189, 200, 255, 193, 194, 202,
-    255, 197, 198, 204, 255, 198, 199, 205, 255, 195, 195, 204, 255, 193, 195, 206, 255, 189, 191, 206, 255, 182, 183, 202, 255, 183, 182, 203, 255, 185, 185,
-    205, 255, 185, 184, 206, 255, 188, 188, 208, 255, 191, 192, 211, 255, 194, 198, 215, 255, 198, 201, 218, 255, 201, 203, 218, 255, 209, 206, 220, 255, 214,
-    211, 223, 255, 216, 214, 225, 255, 219, 217, 227, 255, 226, 222, 230, 255, 227, 223, 231, 255, 234, 231, 236, 255, 241, 240, 241, 255, 245, 244, 244, 255,
-    243, 242, 244, 255, 243, 242, 245, 255, 245, 245, 248, 255, 246, 246, 249, 255, 244, 247, 250, 255, 244, 248, 250, 255, 246, 249, 251, 255, 247, 249, 251,
-    255, 248, 250, 252, 255, 248, 250, 252, 255, 249, 251, 252, 255, 251, 251, 252, 255, 251, 251, 253, 255, 252, 252, 253, 255, 252, 252, 252, 255, 253, 253,
-    253, 255, 253, 253, 254, 255, 253, 253, 254, 255, 254, 254, 254, 255, 254, 254, 254, 255, 254, 254, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 254,
-    254, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 254, 254, 255, 255, 255, 255, 255, 255, 255, 255,
-    255, 255, 255, 255, 255, 254, 254, 254, 255, 254, 254, 254, 255, 254, 253, 253, 255, 254, 254, 253, 255, 254, 253, 253, 255, 253, 253, 253, 255, 253, 252,
-    252, 255, 253, 251, 252, 255, 253, 251, 251, 255, 253, 252, 251, 255, 253, 250, 250, 255, 251, 248, 249, 255, 251, 247, 248, 255, 250, 246, 246, 255, 250,
-    245, 245, 255, 251, 246, 245, 255, 249, 243, 243, 255, 246, 240, 241, 255, 245, 238, 239, 255, 245, 237, 238, 255, 244, 235, 236, 255, 246, 235, 234, 255};
+     15, 218, 221, 225, 228, 231, 234, 236, 239, 241, 243, 245, 246, 247, 248, 249, 250, 254, 251, 255, 252, 255, 253,   0,
+    252, 252, 253, 252, 252, 255, 251, 255, 250,   0, 249, 255, 247,  28, 245, 243, 241, 239, 236, 233, 230, 226, 221, 218,
+    214, 209, 205, 201, 197, 193, 189, 185, 183, 182, 180, 179, 191, 183, 176, 175, 174, 172, 170, 255, 171, 254, 172, 254,
+    173,   7, 218, 234, 231, 224, 212, 198, 185, 180, 255, 181,   4, 191, 186, 184, 185, 186, 253, 187, 255, 188,  10, 189,
+    195, 202, 195, 192, 190, 192, 208, 197, 190, 191, 255, 190, 255, 191, 255, 192, 255, 191, 255, 190,  19, 189, 188, 187,
+    186, 219, 223, 226, 230, 233, 236, 238, 240, 242, 244, 246, 247, 248, 249, 250, 251, 254, 252, 252, 253, 255, 254, 253,
+    253, 253, 252, 255, 251,  29, 250, 249, 248, 247, 246, 244, 243, 241, 238, 236, 233, 231, 228, 222, 221, 218, 215, 210,
+    206, 202, 197, 192, 187, 184, 182, 180, 178, 202, 193, 175, 255, 174,   0, 171, 255, 169, 251, 170,   8, 185, 236, 234,
+    230, 219, 205, 193, 184, 181, 255, 178,   5, 186, 191, 187, 184, 182, 183, 252, 184,   9, 185, 190, 196, 190, 187, 188,
+    187, 194, 206, 188, 254, 187, 255, 188, 252, 189,   0, 188, 255, 187,  15, 186, 185, 220, 224, 228, 231, 234, 237, 239,
+    242, 244, 245, 247, 248, 249, 250, 255, 251, 255, 252, 252, 253, 255, 254,   1, 253, 254, 250, 253, 255, 252, 255, 251,
+    255, 250,   7, 249, 247, 246, 245, 243, 240, 238, 233, 255, 230,  19, 226, 223, 219, 215, 210, 205, 200, 195, 190, 184,
+    182, 180, 181, 216, 195, 174, 173, 172, 169, 167, 250, 168,   8, 209, 236, 234, 228, 213, 199, 188, 181, 177, 255, 175,
+      2, 181, 200, 184, 254, 179, 253, 180,   4, 181, 182, 185, 189, 185, 254, 184,   6, 185, 204, 191, 186, 185, 184, 185,
+    255, 186, 252, 187,   0, 186, 255, 185,  10, 184, 222, 226, 229, 230, 215, 214, 216, 218, 219, 221, 255, 223,   1, 224,
+    225, 255, 226, 255, 227, 246, 228, 250, 227, 255, 226,  30, 225, 224, 223, 222, 220, 219, 217, 214, 211, 208, 206, 203,
+    200, 196, 193, 190, 198, 203, 200, 195, 190, 185, 182, 180, 185, 219, 194, 173, 172, 171, 168, 251, 166,  11, 165, 166,
+    228, 235, 232, 223, 211, 198, 189, 184, 179, 180, 255, 181,   5, 182, 178, 175, 176, 177, 176, 254, 177,   3, 178, 179,
+    180, 185, 255, 181, 254, 182,   2, 197, 191, 188, 254, 182, 255, 183,   0, 184, 252, 185, 255, 184,   5, 183, 223, 227,
+    230, 140,  14, 235,   7, 235,   6, 253,   5,   5,   6,  41, 200, 206, 202, 196, 255, 187,   3, 182, 181, 218, 195, 255,
+    172,   1, 170, 166, 253, 164, 254, 163,  18, 174, 234, 224, 217, 209, 203, 194, 190, 193, 188, 185, 178, 176, 174, 171,
+    172, 173, 174, 175, 254, 174,   5, 175, 176, 178, 182, 179, 178, 254, 179,   2, 193, 189, 182, 253, 180,   0, 181, 255,
+    182, 251, 183,   6, 182, 224, 228, 231, 143,  81,  84, 255,  86, 255,  87, 255,  88, 252,  89, 248,  90,   1,  82,  14,
+    245,   0, 255,   1,   2,   9,   8,   1, 248,   0,  14,   4, 184, 203, 198, 193, 187, 184, 180, 179, 207, 197, 173, 170,
+    169, 165, 253, 162, 255, 161,   2, 160, 185, 212, 255, 223,  10, 202, 193, 189, 191, 193, 192, 179, 177, 174, 169, 170,
+    255, 172,   4, 171, 172, 176, 171, 172, 255, 173,   1, 176, 179, 255, 176, 254, 177,   3, 187, 199, 183, 181, 254, 178,
+    255, 179,   0, 180, 255, 181, 254, 182, 255, 181,  10, 225, 229, 232, 204, 184, 232, 242, 244, 245, 246, 248, 254, 250,
+    255, 251,   1, 252, 253, 255, 252, 254, 253,   6, 252, 253, 254, 252,  82,   1,   0, 255,   1,   3,  15,  21,   5,   1,
+    254,   0,   7,   1,  19, 111, 192, 117,   1,   0,   1, 253,   2, 254,   0,  14,   4, 189, 209, 205, 200, 190, 192, 187,
+    181, 184, 180, 190, 185, 168, 163, 254, 160, 255, 159, 255, 158,  11, 174, 222, 202, 199, 202, 206, 198, 195, 193, 190,
+    176, 183, 255, 165,  11, 167, 169, 173, 171, 170, 173, 170, 169, 170, 171, 175, 176, 255, 174, 254, 175,   2, 181, 208,
+    183, 252, 176,   1, 177, 178, 255, 179, 252, 180,  20, 226, 230, 233,  99,   7, 206, 242, 245, 180, 172, 249, 251, 239,
+    140, 218, 146, 230, 248, 154, 204, 163, 255, 145,   1, 167, 250, 255, 255,  19,  86,   1,   2,  70, 181, 227, 231, 206,
+     94,   3,   0,   1,  65, 213, 248, 244, 143,   4,   8, 141, 255, 163,   2, 164, 163,  47, 255,   0,  14,   4, 192, 211,
+    206, 201, 192, 191, 184, 195, 179, 176, 184, 180, 175, 162, 250, 158,   6, 160, 221, 209, 203, 205, 221, 206, 255, 192,
+      3, 188, 181, 180, 161, 255, 162,   2, 164, 166, 171, 254, 168,   6, 167, 168, 171, 174, 173, 171, 172, 254, 173,   2,
+    174, 198, 180, 253, 174, 255, 175,   0, 176, 255, 177,   0, 178, 253, 179,  24, 227, 230, 233,  96,   1, 206, 243, 245,
+    104,  84, 249, 250, 222,   9, 189,  38, 170, 236,  22, 184,  50,  44,  77, 114, 246, 255, 255,  32,  85,   1,   4, 153,
+    251, 236, 241, 252, 246,  63,   2,  64, 234, 248, 184,  49,   1,   0,  12, 209, 233, 231, 228, 212,  39,   1,   0,   4,
+    185, 205, 201, 197, 191, 255, 190,   6, 203, 181, 179, 182, 177, 169, 165, 255, 160, 252, 161,  11, 165, 220, 222, 226,
+    230, 223, 203, 188, 192, 194, 190, 179, 254, 166,   3, 167, 168, 174, 171, 254, 169,   4, 171, 175, 177, 176, 174, 252,
+    175,   4, 185, 183, 179, 175, 174, 254, 175, 255, 176,   0, 177, 254, 178,  23, 179, 178, 227, 231, 234,  96,   1, 207,
+    243, 245, 105,  82, 249, 251, 223,   9, 207,  76, 130, 211,  23, 218,  51, 143, 255, 254, 254, 255,   0,  85, 255,   1,
+     21,  30, 110,  40,  73, 254, 253, 122,  14, 207, 249, 196,  50,  28,   2,   1,  15, 224, 235, 130,  81,  72,  10, 255,
+      0,  15,   5, 182, 204, 203, 201, 192, 198, 191, 200, 179, 178, 179, 178, 171, 169, 167, 255, 162, 253, 163,   6, 188,
+    221, 227, 236, 231, 217, 197, 255, 187,   3, 185, 183, 176, 170, 254, 169,   3, 170, 174, 172, 170, 254, 171,   5, 177,
+    179, 175, 174, 175, 176, 255, 175,   3, 176, 183, 185, 177, 250, 175, 255, 176, 253, 177,  23, 227, 231, 234,  96,   1,
+    207, 243, 245, 104,  79, 249, 251, 223,   9, 210, 125,  83, 172,  48, 244,  51, 141, 248, 251, 254, 255,   8,  85,   1,
+      0,   1,  48, 101, 161, 253, 250, 255,  77,  13, 250, 251, 245, 241, 237, 147,  11,  25, 237, 236, 131,  79,  15,   0,
+    255,   1,  12,   5, 185, 202, 197, 194, 192, 195, 190, 184, 179, 177, 178, 179, 255, 182,   0, 179, 254, 163, 255, 164,
+     10, 166, 215, 218, 228, 238, 228, 210, 195, 187, 185, 182, 255, 177,   0, 171, 254, 170,   1, 171, 174, 254, 170,   7,
+    171, 176, 179, 181, 173, 174, 176, 175, 254, 176,   4, 181, 191, 175, 174, 175, 250, 174,   0, 175, 254, 176,  24, 227,
+    231, 234,  97,   1, 207, 244, 246, 105,  76, 250, 251, 223,   9, 210, 175,  49, 133,  95, 253,  50,  22,  38, 141, 253,
+    255, 255,   5,  85,   1,   0,   1, 120, 252, 255, 253,  34, 179,  11, 135, 252, 251, 211, 193, 244, 246, 102,  41, 239,
+    235, 233, 232, 189,  31,   2,   1,   6, 191, 208, 199, 196, 195, 193, 187, 181, 178, 177, 181, 180, 203, 191, 187, 255,
+    164, 255, 165,  15, 166, 185, 223, 213, 211, 234, 226, 209, 195, 189, 187, 183, 176, 178, 175, 172, 255, 171,   0, 172,
+    255, 171,   8, 172, 170, 174, 180, 182, 180, 174, 176, 177, 255, 175,   4, 176, 177, 176, 192, 175, 253, 174,   0, 173,
+    251, 174, 255, 175,  24, 227, 231, 234,  97,   1, 207, 244, 245, 104,  72, 249, 251, 223,   9, 209, 214,  32,  68, 149,
+    253,  51, 114, 201, 226, 254, 255, 255,  43,  84,   1,   0,   1,  61, 118, 167, 253, 249, 109, 148, 253, 245,  43,  12,
+    193, 245, 161,  31, 109,  89, 142, 240, 237, 120,   3,   2,   6, 198, 218, 214, 209, 198, 193, 188, 189, 179, 178, 181,
+    182, 173, 168, 166, 165, 255, 166, 255, 167,  14, 187, 212, 204, 207, 230, 226, 213, 206, 195, 191, 189, 182, 177, 178,
+    179, 254, 176,   0, 174, 255, 173,   9, 174, 176, 179, 181, 179, 175, 184, 177, 176, 175, 255, 176,   2, 175, 191, 176,
+    253, 174, 250, 173,  25, 174, 173, 227, 231, 233,  97,   1, 207, 244, 246, 105,  69, 249, 250, 223,   9, 210, 246,  39,
+     12, 199, 253,  51, 142, 253, 254, 254, 255,   1,  84,   1, 255,   0,  14,   1,   3,  34, 251, 253, 182, 109, 251, 248,
+     63,  19, 203, 247, 146,   2, 255,   3,  21,   7, 222, 231, 136,   3,   2,   7, 190, 209, 205, 201, 194, 191, 190, 193,
+    180, 177, 182, 176, 177, 169, 166, 255, 167,   0, 168, 255, 169,   2, 171, 182, 195, 255, 231,   8, 225, 215, 220, 204,
+    197, 196, 194, 186, 181, 254, 184,   1, 181, 176, 254, 175,   9, 177, 176, 177, 183, 177, 186, 179, 181, 178, 175, 255,
+    176,   1, 189, 176, 254, 174, 253, 173, 252, 172,  25, 173, 227, 231, 234,  96,   1, 207, 244, 246, 105,  42, 150, 152,
+    212,   9, 210, 251,  87,  22, 240, 253,  51,  86, 150, 171, 250, 255, 255,  43,  84,   1,   2,  34,  39,  65, 180, 253,
+    252, 129,  30, 223, 250, 223, 203, 248, 232,  54,  14,  12,  18, 106, 238, 232,  87,   4,   3,   8, 199, 221, 218, 213,
+    203, 206, 194, 205, 182, 178, 182, 179, 186, 171, 168, 169, 254, 170,   0, 171, 255, 172,   7, 179, 225, 217, 207, 223,
+    224, 211, 201, 254, 202,   4, 199, 193, 188, 184, 180, 255, 177,   0, 178, 255, 177,   7, 180, 179, 186, 183, 187, 184,
+    186, 184, 255, 177,   3, 176, 180, 176, 175, 254, 174, 255, 173, 254, 172,   0, 171, 255, 172,   9, 171, 226, 230, 233,
+     96,   1, 206, 243, 245, 136, 255,  59,  40,  65, 208,  62, 218, 252, 162, 102, 253, 254,  91,  56,  55,  95, 246, 255,
+    254,  83,   1,   9, 191, 237, 246, 252, 251, 168,  16,   1,  46, 171, 232, 236, 183,  61,   4,  98, 218, 220, 236, 238,
+    155,  12, 255,   4,   4,   9, 196, 215, 211, 206, 255, 198,   3, 191, 192, 184, 179, 255, 178,   3, 188, 173, 170, 171,
+    255, 172,   0, 173, 255, 174,   8, 175, 176, 205, 229, 227, 234, 228, 215, 206, 255, 207,   3, 208, 202, 198, 185, 254,
+    180,   4, 181, 186, 183, 179, 182, 255, 188, 254, 187,   8, 190, 187, 179, 184, 183, 180, 178, 176, 175, 255, 174, 255,
+    173,   0, 172, 252, 171,   7, 170, 226, 230, 233,  96,   1, 205, 243, 255, 246,  10, 247, 248, 249, 251, 250, 252, 253,
+    252, 251, 253, 254, 253, 252, 254, 254,   8,  83,   1,   2, 112, 179, 177, 148,  69,   4, 255,   0, 255,   1,   1,   2,
+      5, 254,   2,  29,  35, 198, 200, 168,  89,   8,   5,   4,   5,  10, 193, 214, 210, 207, 199, 200, 194, 189, 183, 180,
+    179, 178, 183, 176, 173, 172, 173, 174, 175, 176, 255, 177,  13, 178, 194, 233, 228, 233, 229, 215, 210, 211, 209, 201,
+    196, 200, 191, 255, 183,   6, 184, 187, 195, 192, 185, 195, 203, 255, 209,   8, 204, 205, 201, 192, 184, 195, 192, 180,
+    179, 255, 176,   1, 175, 174, 255, 173, 255, 172, 255, 171, 255, 170,   9, 169, 225, 229, 232,  96,   1,  87, 133, 134,
+    135, 255, 136, 254, 138, 253, 139, 250, 140,   4, 144, 237,  82,   1,   0, 254,   1,   1,   2,   1, 251,   0, 255,   1,
+      0,   0, 255,   1,   1,   7,   9, 253,   4,  12,   5,   6,  12, 202, 223, 220, 215, 205, 207, 195, 189, 183, 181, 255,
+    180,   5, 181, 179, 174, 175, 176, 177, 255, 178,   0, 179, 255, 180,   0, 192, 255, 230,   5, 232, 225, 215, 213, 211,
+    210, 255, 212,   1, 207, 194, 255, 186,  20, 192, 195, 200, 204, 207, 225, 235, 236, 242, 244, 245, 244, 233, 203, 200,
+    199, 181, 183, 180, 182, 177, 255, 175,   2, 174, 173, 172, 255, 171, 255, 170,   4, 169, 224, 228, 231, 101, 236,   2,
+      3,  13, 217,  82,   2, 246,   1, 254,   2,   1,   1,   2, 254,   3,  15,   4,   5,   6,   7,   8,   9,  18, 195, 211,
+    207, 203, 197, 196, 194, 190, 185, 255, 182,   2, 181, 182, 184, 255, 177, 255, 179,  11, 180, 181, 182, 183, 184, 185,
+    223, 235, 227, 218, 215, 217, 255, 218,  15, 216, 213, 209, 203, 191, 196, 200, 205, 211, 222, 234, 239, 234, 232, 243,
+    246, 254, 248,   3, 244, 220, 202, 185, 254, 180,   4, 177, 176, 175, 174, 173, 255, 172,   1, 170, 169, 255, 168,   5,
+    223, 227, 231, 196, 107,  99, 255, 100, 255, 101,   2, 102, 103, 104, 255, 105, 248, 106,   3, 107, 112, 232, 152, 247,
+    107, 254, 106,   0, 105, 254, 104, 255, 103, 255, 102, 255, 101, 255, 100,   1,  99, 138, 255, 221,   6, 218, 215, 207,
+    209, 196, 191, 186, 255, 184, 255, 183,   0, 188, 255, 181,   1, 182, 183, 255, 184,   1, 185, 186, 255, 187,  11, 213,
+    232, 220, 218, 221, 223, 222, 218, 217, 215, 213, 211, 255, 208,  10, 210, 222, 229, 239, 243, 240, 235, 231, 242, 244,
+    248, 255, 249,   3, 250, 246, 227, 193, 255, 184,   8, 180, 178, 177, 176, 175, 174, 173, 172, 170, 255, 169,  14, 167,
+    222, 226, 229, 232, 235, 238, 241, 243, 244, 246, 247, 248, 249, 251, 255, 252, 253, 253, 246, 254, 255, 253,   0, 254,
+    254, 253, 254, 252, 255, 251,  22, 250, 249, 248, 246, 245, 244, 242, 239, 237, 236, 233, 230, 227, 224, 221, 217, 213,
+    204, 206, 197, 191, 187, 186, 254, 185,   4, 190, 183, 184, 185, 186, 255, 187, 255, 189,   7, 190, 191, 195, 224, 225,
+    222, 214, 206, 252, 216,   0, 217, 255, 216,  10, 230, 237, 241, 245, 244, 239, 228, 235, 241, 242, 248, 255, 249, 255,
+    250,   2, 247, 214, 186, 255, 182,   7, 180, 179, 178, 176, 175, 174, 172, 171, 255, 169,   6, 167, 221, 226, 230, 233,
+    236, 240, 255, 242,   4, 243, 245, 246, 248, 249, 255, 250,   1, 251, 252, 255, 253, 255, 254,   0, 253, 251, 254, 250,
+    253, 255, 252, 255, 251,  25, 250, 249, 248, 246, 245, 243, 241, 239, 236, 234, 232, 229, 226, 223, 221, 218, 215, 213,
+    210, 206, 200, 202, 197, 192, 189, 188, 254, 187,   0, 190, 255, 187,   4, 188, 189, 190, 191, 192, 255, 193,   8, 194,
+    195, 199, 211, 205, 197, 198, 203, 220, 255, 219,   0, 220, 255, 223,  11, 233, 240, 243, 244, 245, 244, 233, 221, 231,
+    242, 243, 248, 253, 249,  31, 250, 245, 215, 186, 184, 182, 180, 179, 177, 176, 175, 173, 172, 171, 170, 169, 220, 223,
+    227, 230, 233, 236, 239, 240, 243, 244, 245, 247, 248, 249, 250, 251, 254, 252, 245, 253,   0, 252, 254, 253, 255, 252,
+    255, 251, 255, 250,  21, 249, 248, 247, 246, 245, 243, 242, 241, 239, 238, 236, 234, 232, 230, 228, 226, 223, 220, 210,
+    214, 204, 193, 254, 190,   2, 189, 191, 194, 255, 192,  11, 191, 192, 193, 194, 195, 196, 197, 198, 199, 202, 211, 208,
+    255, 201,   2, 202, 223, 228, 255, 226,   2, 229, 233, 241, 255, 243,   5, 242, 246, 244, 229, 222, 227, 255, 243,  35,
+    247, 249, 250, 248, 249, 250, 249, 246, 211, 188, 184, 182, 181, 180, 178, 177, 175, 174, 173, 172, 170, 218, 223, 226,
+    230, 234, 236, 238, 239, 244, 245, 244, 246, 247, 249, 251, 254, 252,   2, 253, 252, 253, 251, 254, 255, 253, 254, 252,
+    255, 253, 254, 252, 255, 251,  23, 250, 249, 248, 247, 246, 244, 242, 240, 238, 236, 234, 230, 228, 225, 223, 219, 216,
+    213, 210, 208, 201, 202, 200, 195, 254, 192,   1, 193, 194, 255, 193,   6, 194, 195, 196, 197, 198, 199, 200, 255, 201,
+      4, 202, 205, 214, 211, 204, 255, 205,   5, 208, 230, 235, 234, 236, 242, 254, 243,  11, 241, 247, 244, 229, 223, 225,
+    243, 244, 246, 249, 250, 248, 255, 251,  23, 246, 250, 245, 208, 195, 198, 189, 182, 180, 179, 177, 176, 174, 173, 172,
+    217, 221, 225, 228, 231, 234, 235, 239, 241, 255, 243,   0, 246, 255, 248, 255, 250, 254, 251, 246, 252, 252, 251, 255,
+    250,  22, 249, 248, 247, 246, 245, 243, 241, 240, 238, 237, 235, 233, 231, 229, 227, 225, 223, 221, 219, 218, 216, 214,
+    206, 255, 209,   0, 203, 255, 195,   3, 196, 198, 201, 198, 255, 197,   2, 198, 199, 200, 255, 202,   6, 203, 204, 205,
+    206, 208, 216, 214, 255, 208, 255, 209,   0, 214, 255, 239,  11, 240, 244, 242, 244, 242, 238, 247, 244, 228, 225, 226,
+    242, 255, 244,   2, 248, 250, 249, 255, 251,  23, 246, 248, 249, 241, 243, 238, 225, 212, 194, 181, 179, 178, 176, 175,
+    173, 214, 218, 222, 225, 229, 231, 233, 238, 240, 255, 242,   3, 245, 247, 248, 249, 254, 250,   0, 251, 254, 252, 253,
+    253,   0, 252, 255, 253, 255, 251,   0, 250, 255, 252,   1, 251, 252, 255, 251, 255, 250,  19, 249, 248, 247, 246, 245,
+    244, 242, 241, 240, 238, 236, 234, 231, 230, 227, 225, 222, 220, 217, 210, 255, 212,  15, 210, 208, 206, 205, 204, 203,
+    202, 200, 201, 202, 203, 204, 205, 206, 207, 208, 255, 209,   3, 212, 219, 218, 211, 254, 212,  48, 213, 233, 241, 243,
+    242, 244, 241, 239, 238, 246, 243, 228, 227, 228, 242, 244, 245, 248, 249, 250, 251, 252, 251, 246, 249, 245, 244, 232,
+    215, 206, 190, 184, 182, 180, 178, 177, 175, 215, 219, 223, 227, 230, 228, 234, 240, 242, 238, 242, 246, 255, 248,   2,
+    247, 248, 250, 254, 251, 248, 252,   0, 250, 255, 249,   3, 250, 251, 250, 249, 255, 248, 255, 246,  19, 244, 243, 241,
+    239, 237, 236, 234, 231, 229, 227, 224, 222, 219, 217, 215, 212, 210, 209, 207, 203, 254, 204, 253, 203,   0, 204, 255,
+    203,   6, 204, 205, 207, 208, 209, 210, 211, 255, 212,   3, 213, 215, 222, 220, 255, 215, 255, 216,   2, 219, 237, 240,
+    255, 244,   5, 249, 236, 240, 237, 246, 242, 255, 230,   4, 231, 241, 242, 245, 247, 255, 250,   0, 251, 255, 252,  21,
+    247, 249, 247, 243, 220, 196, 192, 189, 188, 184, 182, 181, 179, 177, 210, 214, 217, 220, 224, 226, 230, 233, 255, 236,
+      1, 239, 241, 254, 244,   0, 246, 255, 248, 255, 249, 253, 250, 255, 251,   2, 250, 251, 250, 254, 248, 255, 250, 255,
+    249, 255, 248,   8, 247, 246, 245, 244, 243, 242, 241, 240, 239, 255, 237,  10, 235, 233, 231, 230, 228, 227, 225, 223,
+    222, 220, 213, 255, 216,   5, 215, 214, 213, 212, 211, 210, 254, 208,   6, 209, 210, 211, 212, 213, 214, 215, 255, 216,
+      3, 218, 225, 223, 218, 254, 219,  11, 232, 242, 243, 245, 248, 247, 235, 243, 238, 245, 242, 233, 255, 234,   6, 243,
+    241, 244, 246, 249, 250, 251, 255, 252, 254, 249,   4, 246, 242, 233, 217, 204, 255, 201,   5, 197, 185, 181, 179, 210,
+    215, 255, 218,   7, 223, 225, 233, 236, 235, 234, 237, 239, 255, 241,   4, 242, 244, 245, 249, 250, 252, 251, 255, 252,
+    254, 251,   0, 248, 255, 247, 253, 250,   2, 249, 248, 247, 255, 246,  18, 244, 243, 241, 240, 238, 236, 235, 233, 230,
+    228, 226, 224, 222, 220, 218, 216, 214, 213, 208, 252, 209,   0, 208, 253, 209,   2, 211, 212, 214, 255, 215,   0, 217,
+    255, 218,   4, 219, 220, 222, 228, 227, 254, 222,  57, 223, 243, 242, 245, 249, 250, 242, 239, 242, 238, 244, 242, 235,
+    237, 236, 243, 242, 243, 247, 249, 250, 251, 252, 253, 250, 249, 250, 247, 244, 245, 247, 241, 237, 217, 191, 185, 183,
+    181, 206, 211, 215, 217, 218, 223, 224, 226, 230, 237, 244, 237, 238, 239, 241, 242, 243, 244, 246, 247, 248, 248, 255,
+    246,   0, 245, 254, 246,  20, 245, 244, 243, 242, 241, 239, 238, 236, 235, 233, 231, 230, 228, 226, 224, 222, 221, 220,
+    218, 217, 216, 255, 214,   2, 213, 209, 211, 254, 212, 251, 213,   5, 214, 216, 217, 218, 219, 220, 255, 221, 255, 223,
+      2, 225, 231, 230, 254, 225,   5, 232, 244, 241, 242, 248, 249, 255, 240,  12, 241, 239, 245, 242, 239, 240, 238, 244,
+    245, 242, 246, 248, 251, 255, 252,  34, 253, 251, 248, 251, 248, 246, 244, 245, 215, 199, 193, 189, 187, 185, 183, 203,
+    208, 212, 214, 215, 220, 222, 224, 228, 248, 243, 238, 235, 237, 238, 240, 241, 243, 244, 247, 254, 248, 254, 249,   6,
+    248, 249, 248, 244, 245, 244, 247, 255, 248,   0, 247, 255, 246, 255, 245,   2, 243, 242, 241, 255, 240,  15, 238, 236,
+    235, 234, 232, 231, 229, 228, 226, 224, 223, 222, 221, 219, 214, 216, 255, 217, 253, 216, 255, 215,   6, 216, 217, 219,
+    220, 221, 222, 223, 255, 224,   2, 225, 226, 228, 255, 233, 254, 228,   3, 231, 240, 242, 241, 254, 242, 254, 241,  10,
+    246, 242, 244, 241, 240, 245, 246, 243, 244, 248, 250, 253, 252,  32, 249, 251, 249, 247, 245, 246, 237, 197, 198, 191,
+    189, 187, 185, 200, 203, 207, 210, 214, 216, 219, 222, 228, 242, 233, 234, 232, 234, 235, 237, 238, 240, 241, 244, 254,
+    246, 254, 247, 255, 246,  26, 245, 242, 241, 240, 243, 244, 243, 242, 240, 238, 240, 233, 235, 234, 233, 231, 228, 227,
+    225, 222, 221, 219, 217, 215, 214, 212, 211, 255, 210, 255, 209,  15, 208, 209, 210, 211, 212, 213, 214, 215, 217, 218,
+    219, 221, 222, 223, 224, 225, 255, 226,   3, 227, 228, 229, 231, 255, 235, 253, 231,   1, 234, 243, 255, 244,   0, 243,
+    255, 246,  12, 244, 243, 247, 246, 247, 243, 241, 246, 247, 245, 243, 249, 250, 253, 252,  32, 250, 251, 250, 248, 246,
+    245, 249, 222, 196, 194, 191, 189, 187, 198, 200, 204, 207, 210, 215, 216, 218, 222, 226, 227, 228, 230, 231, 233, 234,
+    236, 237, 238, 240, 255, 242, 251, 243,   3, 242, 240, 239, 238, 254, 241,  15, 243, 245, 246, 243, 229, 235, 234, 232,
+    231, 230, 228, 227, 226, 224, 223, 222, 255, 220,   1, 219, 218, 255, 217, 255, 216,   1, 213, 215, 254, 217, 255, 218,
+     10, 219, 220, 221, 223, 224, 225, 226, 227, 228, 229, 230, 255, 231,   1, 232, 233, 255, 237, 255, 233,   6, 234, 233,
+    234, 244, 245, 244, 246, 255, 248,   1, 246, 244, 254, 248,   2, 244, 242, 247, 255, 248,   0, 241, 255, 249,  35, 252,
+    253, 252, 253, 250, 251, 250, 249, 247, 246, 244, 249, 206, 196, 194, 191, 189, 194, 197, 201, 204, 207, 212, 213, 216,
+    218, 221, 223, 225, 227, 229, 231, 233, 237, 239, 240, 254, 237, 251, 238, 255, 237, 255, 236,  16, 235, 242, 245, 244,
+    240, 236, 232, 227, 224, 222, 220, 218, 216, 215, 213, 212, 210, 252, 209, 255, 210,   1, 212, 213, 255, 215,   8, 217,
+    220, 222, 223, 225, 227, 228, 230, 236, 255, 240,   0, 238, 253, 236, 255, 237, 255, 238,   0, 239, 255, 240, 253, 239,
+      3, 240, 245, 247, 246, 255, 248,   3, 249, 247, 246, 248, 255, 249,   2, 246, 243, 248, 255, 249,   2, 241, 250, 249,
+    255, 252, 255, 253,   0, 249, 255, 251,  30, 249, 248, 246, 244, 247, 234, 201, 199, 197, 193, 192, 195, 198, 202, 206,
+    211, 210, 214, 218, 224, 231, 236, 242, 246, 249, 251, 252, 253, 250, 239, 234, 254, 235, 252, 236, 255, 235, 255, 234,
+      6, 240, 236, 232, 230, 229, 228, 225, 255, 222,   7, 220, 219, 217, 216, 215, 213, 212, 211, 254, 210,   0, 211, 255,
+    212,   7, 214, 216, 217, 219, 221, 223, 225, 226, 255, 228,   2, 224, 233, 239, 255, 244,   1, 245, 243, 255, 238, 255,
+    239, 254, 240, 252, 241, 254, 242,  19, 241, 246, 247, 251, 248, 250, 248, 246, 248, 249, 250, 247, 244, 248, 249, 250,
+    242, 250, 249, 252, 254, 253,   0, 249, 255, 251,   2, 250, 249, 247, 255, 244,  13, 250, 213, 201, 200, 197, 189, 193,
+    197, 203, 212, 220, 211, 226, 246, 255, 250,   6, 249, 247, 250, 246, 241, 236, 233, 254, 231, 255, 232, 252, 233, 255,
+    232,   0, 231, 255, 230,   3, 231, 230, 227, 226, 255, 225,   3, 224, 218, 217, 216, 255, 214,   1, 213, 212, 255, 211,
+    255, 210, 255, 211,  20, 212, 213, 214, 216, 217, 219, 221, 223, 225, 227, 229, 230, 226, 233, 240, 245, 249, 248, 246,
+    244, 240, 255, 241, 254, 242, 252, 243, 253, 244,   7, 243, 244, 249, 251, 249, 251, 248, 247, 255, 249,   6, 251, 248,
+    247, 248, 249, 251, 243, 254, 250, 254, 253,   1, 250, 251, 255, 250,  28, 249, 247, 244, 242, 247, 233, 205, 203, 199,
+    187, 190, 195, 198, 203, 208, 205, 213, 218, 220, 219, 220, 221, 228, 227, 226, 228, 229, 230, 231, 255, 232,   0, 233,
+    253, 234,   0, 235, 255, 236,  12, 235, 234, 233, 230, 226, 224, 222, 223, 222, 221, 217, 222, 223, 255, 224, 255, 223,
+    252, 222, 255, 223,   3, 224, 225, 226, 228, 255, 229,  14, 231, 233, 235, 236, 232, 231, 240, 245, 249, 253, 252, 250,
+    247, 244, 242, 255, 245, 252, 246, 251, 247,   2, 246, 247, 252, 255, 250,   0, 251, 255, 249,   4, 248, 249, 251, 250,
+    248, 255, 249,   4, 252, 244, 249, 251, 250, 255, 253,   2, 252, 250, 251, 255, 250,  29, 249, 246, 243, 242, 243, 249,
+    217, 209, 207, 185, 189, 193, 194, 195, 198, 201, 205, 210, 211, 213, 215, 217, 219, 221, 223, 225, 226, 227, 228, 230,
+    255, 231,   0, 232, 252, 233,   3, 231, 230, 228, 226, 255, 225,   1, 222, 220, 255, 219,   5, 218, 216, 211, 208, 214,
+    226, 252, 227, 255, 228,   2, 226, 221, 220, 255, 218,  11, 220, 222, 223, 225, 227, 229, 232, 233, 238, 244, 251, 252,
+    255, 254,   4, 251, 249, 246, 244, 247, 253, 248, 255, 249,   0, 248, 251, 249,   1, 250, 252, 255, 250,  14, 251, 250,
+    251, 249, 250, 252, 250, 248, 250, 249, 253, 246, 248, 252, 249, 254, 253, 255, 251, 255, 250,   8, 249, 246, 243, 241,
+    242, 247, 236, 213, 209, 254, 191, 254, 195,  15, 203, 206, 210, 211, 213, 215, 218, 220, 221, 223, 225, 226, 227, 228,
+    229, 230, 255, 231, 254, 232, 253, 233,   0, 234, 255, 233,   4, 223, 219, 217, 216, 215, 255, 214,   6, 208, 203, 202,
+    209, 225, 226, 225, 254, 226,  17, 221, 202, 201, 203, 204, 206, 209, 211, 213, 216, 219, 221, 224, 228, 236, 244, 250,
+    253, 255, 255,   5, 252, 251, 247, 246, 247, 248, 255, 249,   0, 248, 248, 249, 255, 251,  12, 250, 251, 253, 252, 251,
+    249, 250, 252, 251, 249, 251, 249, 253, 255, 248,   1, 252, 251, 254, 253, 255, 251,  34, 249, 250, 249, 246, 244, 241,
+    242, 245, 250, 220, 211, 180, 182, 185, 187, 189, 192, 195, 197, 202, 203, 205, 207, 209, 211, 213, 215, 217, 219, 221,
+    222, 223, 224, 225, 226, 254, 227,  10, 235, 244, 246, 247, 248, 246, 247, 227, 216, 214, 213, 255, 212,   5, 213, 208,
+    201, 199, 201, 220, 253, 222,  18, 223, 206, 199, 201, 204, 205, 207, 209, 191, 215, 217, 205, 216, 225, 230, 237, 246,
+    250, 253, 255, 254,   1, 252, 250, 255, 247,   1, 248, 228, 255, 249, 248, 250, 253, 251, 255, 253, 255, 252,   1, 250,
+    251, 255, 252,   5, 250, 252, 251, 253, 250, 249, 255, 252,   3, 253, 254, 253, 252, 255, 249,  18, 238, 236, 231, 240,
+    243, 242, 244, 249, 237, 212, 178, 180, 182, 184, 186, 189, 192, 194, 210, 255, 200,  11, 203, 205, 206, 208, 210, 212,
+    214, 215, 216, 218, 219, 220, 255, 221, 255, 222,   1, 231, 239, 254, 241,   4, 240, 239, 228, 214, 212, 254, 209,   2,
+    210, 209, 199, 255, 197,   0, 212, 254, 214,  23, 215, 216, 201, 199, 201, 202, 205, 208, 210, 123, 179, 216,  98, 221,
+    227, 232, 236, 245, 248, 252, 255, 254, 252, 249, 255, 247,   1, 240, 142, 252, 249,   0, 163, 252, 250, 254, 251,   0,
+    252, 255, 253, 255, 252, 255, 251,   8, 253, 252, 220, 194, 252, 253, 251, 249, 252, 255, 253,   2, 254, 253, 252, 255,
+    250,  30, 166, 195, 163, 217, 244, 243, 244, 247, 251, 218, 175, 177, 180, 182, 184, 186, 189, 191, 202, 198, 197, 199,
+    202, 204, 206, 208, 210, 212, 213, 215, 217, 255, 218,   0, 220, 255, 221,   2, 220, 228, 235, 254, 237,   4, 236, 235,
+    228, 212, 209, 255, 206,   3, 205, 207, 209, 200, 255, 194,   0, 212, 254, 216, 103, 217, 218, 202, 198, 201, 203, 206,
+    208, 211, 201, 102, 127, 186, 225, 156, 116, 173, 243, 167, 250, 195, 231, 169, 145, 177, 248, 231, 186, 224, 138, 122,
+    196, 220,  62, 150, 250, 169, 125, 189, 251, 151, 110, 228, 134, 128, 179, 252, 203, 127, 156, 253, 111,  98, 226, 254,
+    244, 144, 111, 245, 138, 137, 165, 251, 177, 126,  91, 225, 167, 246, 200, 123, 145, 246, 250, 237, 173, 175, 178, 181,
+    182, 184, 186, 188, 190, 193, 195, 197, 199, 201, 203, 204, 206, 208, 210, 211, 212, 213, 214, 215, 216, 217, 216, 224,
+    230, 254, 232,   0, 231, 255, 226,   7, 211, 206, 204, 202, 203, 205, 209, 201, 255, 192,   0, 208, 255, 211,  77, 212,
+    213, 214, 201, 199, 201, 203, 206, 209, 212, 214, 100, 124, 223, 188, 133, 234,  98, 243, 113, 249, 128, 238,  97, 215,
+    248, 249, 194, 167, 181, 157, 247, 105, 251, 119, 251, 207, 151, 251, 110, 242,  77, 248, 214, 127, 254, 103, 248, 111,
+    252, 126, 236, 151, 221, 252, 254, 213, 105, 251, 142, 205, 219, 104, 228, 116, 249,  70, 248, 112, 244, 104, 244, 132,
+    214, 249, 252, 174, 173, 255, 178,  18, 180, 182, 184, 186, 188, 190, 192, 194, 196, 199, 201, 203, 204, 206, 208, 210,
+    211, 212, 214, 255, 215,   3, 216, 215, 220, 226, 255, 227,   6, 226, 225, 215, 220, 209, 204, 202, 255, 200,   6, 202,
+    208, 206, 191, 190, 209, 212, 255, 213,  41, 215, 216, 201, 198, 201, 203, 206, 209, 212, 216, 120, 199, 224, 140, 192,
+    234, 106, 222, 137, 251, 116, 252, 113, 250, 248, 249, 166, 198, 151, 211, 251, 115, 251, 117, 252, 155, 120, 140, 136,
+    212, 153, 253, 255, 183,  10, 253, 116, 217,  86, 140, 119, 241, 121, 248, 253, 254, 255, 183,  41, 253, 115, 254, 226,
+    137, 179, 187, 251, 107, 249, 113, 213, 145, 245, 137, 216, 248, 251, 175, 172, 177, 176, 178, 179, 181, 183, 186, 188,
+    190, 192, 195, 197, 199, 200, 203, 205, 207, 208, 210, 211, 212, 213, 255, 214,  45, 213, 217, 221, 222, 221, 220, 219,
+    211, 217, 203, 202, 200, 198, 197, 199, 205, 213, 191, 189, 208, 211, 212, 214, 215, 216, 201, 198, 201, 204, 207, 210,
+    213, 216, 100, 221, 225, 147, 174, 212, 116, 207, 131, 240,  88, 254, 114, 254, 250,  12, 136, 229, 119, 242, 234, 129,
+    247, 102, 251, 164, 195, 233, 194, 255, 183,  57, 253, 153, 214, 254, 114, 225, 133, 249, 178, 253, 108, 245, 253, 254,
+    153, 212, 253, 107, 241, 142, 168, 183, 163, 222,  83, 249, 114, 219, 124, 239, 102, 244, 247, 251, 181, 173, 172, 174,
+    175, 177, 179, 181, 183, 186, 188, 190, 192, 193, 196, 198, 200, 202, 203, 205, 206, 208, 209, 210, 254, 211,   0, 214,
+    255, 218,  41, 217, 215, 214, 206, 214, 195, 200, 197, 196, 195, 197, 202, 215, 196, 187, 204, 207, 208, 209, 211, 212,
+    200, 199, 201, 204, 207, 210, 213, 217, 163, 223, 227, 225, 132, 135, 229, 243, 148, 149, 182, 252, 183, 254, 249,  66,
+    186, 250, 184, 251, 232, 204, 252, 158, 206, 246, 141, 146, 243, 208, 230, 253, 193, 246, 250, 189, 253, 167, 134, 223,
+    254, 203, 163, 253, 255, 193, 244, 253, 222, 131, 165, 223, 250, 145, 156, 181, 244, 190, 249, 166, 129, 216, 244, 246,
+    250, 185, 172, 171, 172, 174, 176, 177, 180, 182, 184, 187, 189, 191, 193, 196, 199, 201, 204, 255, 205,   0, 206, 255,
+    208,   0, 209, 255, 210, 254, 209,   8, 207, 209, 206, 205, 200, 206, 193, 197, 196, 254, 194,  31, 200, 214, 201, 186,
+    208, 211, 213, 214, 215, 217, 202, 198, 201, 205, 207, 211, 215, 217, 221, 224, 228, 231, 234, 236, 238, 244, 246, 247,
+    251, 249, 248, 249, 255, 250, 254, 251, 250, 252,   1, 253, 252, 254, 253,   1, 254, 255, 255, 254, 252, 253,   0, 254,
+    255, 253,   3, 254, 255, 254, 251, 253, 254, 254, 253,   1, 252, 251, 255, 250,   2, 249, 248, 245, 255, 244,  22, 246,
+    249, 179, 168, 169, 170, 172, 174, 176, 178, 180, 182, 184, 186, 188, 190, 203, 207, 210, 213, 215, 216, 217, 255, 216,
+      6, 217, 219, 220, 219, 218, 212, 202, 255, 209,   6, 206, 194, 203, 193, 191, 195, 193, 255, 192,  26, 197, 209, 210,
+    186, 202, 205, 207, 209, 210, 212, 201, 199, 201, 205, 208, 211, 215, 218, 221, 225, 228, 231, 235, 237, 238, 244, 245,
+    255, 244,   2, 246, 248, 249, 255, 250, 255, 251, 252, 252,   1, 253, 252, 253, 253,   2, 254, 253, 254, 255, 255,   1,
+    254, 253, 254, 254, 253, 253,   3, 254, 255, 254, 252, 253, 254, 255, 253, 255, 252,   0, 251, 255, 250,  21, 249, 248,
+    246, 245, 243, 245, 249, 169, 166, 168, 169, 171, 173, 175, 177, 179, 182, 184, 187, 189, 198, 196, 255, 195, 255, 196,
+      0, 197, 255, 198,   2, 197, 199, 201, 255, 199,  11, 202, 203, 206, 204, 194, 201, 191, 199, 191, 188, 194, 193, 255,
+    192,  31, 195, 203, 215, 190, 203, 207, 208, 210, 212, 213, 201, 198, 202, 205, 209, 211, 215, 218, 222, 225, 228, 232,
+    235, 237, 239, 244, 245, 244, 247, 249, 248, 249, 255, 250, 254, 251, 254, 252, 248, 253, 253, 254, 248, 253,   6, 254,
+    255, 252, 253, 254, 255, 254, 255, 253,   3, 251, 252, 251, 250, 255, 248,   5, 247, 246, 245, 244, 245, 248, 255, 165,
+     34, 166, 168, 170, 172, 174, 176, 178, 181, 183, 185, 187, 197, 191, 223, 231, 206, 229, 220, 231, 223, 196, 229, 247,
+    233, 225, 250, 240, 253, 252, 223, 199, 189, 196, 188, 184, 253, 192,  31, 194, 200, 212, 197, 202, 207, 209, 210, 212,
+    214, 201, 199, 202, 206, 209, 212, 215, 219, 222, 225, 229, 231, 235, 237, 239, 244, 246, 244, 249, 251, 248, 250, 255,
+    251,   2, 252, 251, 252, 252, 253, 254, 254,   0, 253, 252, 254,   1, 253, 254, 247, 253,   0, 254, 255, 253, 255, 255,
+      7, 254, 253, 252, 250, 252, 251, 250, 249, 255, 248,   1, 247, 246, 255, 244,  17, 247, 163, 165, 166, 167, 169, 171,
+    172, 175, 176, 178, 181, 183, 184, 196, 222, 252, 251, 255, 246,  18, 250, 245, 233, 193, 237, 254, 250, 226, 254, 243,
+    254, 242, 237, 201, 186, 193, 185, 182, 189, 254, 192,  31, 194, 198, 208, 202, 196, 200, 201, 203, 205, 207, 200, 199,
+    202, 206, 209, 213, 216, 219, 223, 228, 232, 233, 236, 239, 240, 243, 246, 244, 249, 251, 248, 250, 255, 251, 254, 252,
+    253, 253, 249, 254,   3, 255, 254, 212, 225, 254, 254, 255, 253,   0, 254, 250, 253, 255, 254,   7, 153, 166, 252, 250,
+    251, 252, 250, 249, 255, 248,  48, 247, 246, 243, 244, 247, 163, 165, 166, 167, 170, 171, 174, 176, 178, 179, 182, 184,
+    185, 194, 229, 251, 243, 250, 246, 254, 253, 235, 192, 239, 251, 254, 231, 254, 243, 254, 252, 229, 199, 184, 189, 183,
+    180, 184, 193, 192, 193, 194, 196, 203, 255, 202,  38, 206, 207, 209, 211, 213, 201, 199, 202, 206, 209, 213, 216, 220,
+    227, 237, 239, 241, 243, 245, 248, 250, 251, 250, 251, 252, 251, 243, 203, 242, 254, 218, 231, 211, 254, 255, 227, 211,
+    255, 254, 255, 255,  33, 254, 245, 205, 240, 241,  64, 135, 246, 250, 205, 237, 254, 224, 229, 208, 252, 254, 255, 252,
+    208, 228, 254,  77, 141, 205, 249, 250, 233, 202, 245, 243, 204, 219, 217, 255, 243,  19, 246, 165, 170, 178, 166, 167,
+    169, 171, 172, 174, 176, 178, 180, 182, 192, 226, 252, 241, 250, 244, 255, 254,  17, 238, 191, 242, 241, 254, 239, 254,
+    243, 254, 246, 240, 197, 182, 186, 182, 178, 180, 192, 255, 193,   1, 194, 195, 255, 200,   5, 199, 200, 201, 203, 206,
+    208, 255, 200,  30, 203, 206, 209, 213, 221, 230, 233, 234, 235, 237, 240, 242, 244, 246, 249, 250, 251, 253, 230,  35,
+     48,  34, 246,  17,  49,   9, 166, 161,  28,  26, 141, 255, 254,  73, 255, 238,  35,  72,  25, 171,   9,  54, 218,  51,
+     49,  20, 229,  58,  31,  20, 119, 254, 255,  79,  61,  22, 200,  47,  43,  16, 133, 187,  25,  35,  89, 209,   0,  47,
+      7, 199, 243, 246, 163, 164, 166, 167, 169, 171, 173, 174, 177, 179, 181, 183, 184, 189, 223, 252, 239, 250, 244, 251,
+    254, 241, 190, 246, 251, 254, 246, 254, 244, 254, 238, 250, 196, 181, 183, 179, 255, 177,   1, 190, 193, 255, 194,   2,
+    195, 198, 199, 255, 202,  10, 203, 205, 208, 210, 201, 200, 203, 206, 211, 222, 234, 255, 229,   7, 230, 233, 237, 243,
+    248, 249, 251, 252, 255, 253,  14, 252, 128,  91, 253,  16, 191,   0, 236,  79, 144,  38,  82,  75,  70, 115, 255,  30,
+     69, 189,  15, 115, 171, 250,  14, 225, 161,  60, 255,  47, 177,  28, 184, 149,  58, 254, 255,  33,  87, 154, 239,  16,
+    205, 109, 108,  63, 154, 203,  19, 181,  28, 241,  51, 148, 243, 245, 162, 163, 164, 165, 167, 168, 170, 172, 174, 176,
+    178, 180, 181, 187, 217, 253, 241, 251, 243, 244, 248, 244, 188, 250, 233, 250, 251, 254, 242, 253, 235, 249, 195, 255,
+    180,   0, 178, 255, 176,   1, 185, 196, 255, 197,   1, 195, 196, 255, 198,   4, 203, 205, 207, 208, 207, 255, 199,   9,
+    203, 207, 216, 232, 244, 235, 239, 244, 245, 249, 255, 251,   0, 252, 253, 253,  14, 251, 104, 109, 218,  11, 194,  22,
+    253,  55, 174,  18, 150, 155, 197, 239, 255, 231,  64, 216, 167, 106,  23, 236,   0, 241, 138,  79, 236,  18, 211,   2,
+    201, 101,  95, 254, 237, 166, 143,   7, 195,   0, 241,  85, 141,  42, 173, 155,  60, 152,  43, 230,  20, 183, 243, 245,
+    163, 165, 167, 170, 168, 166, 168, 172, 175, 176, 177, 179, 180, 185, 191, 243, 249, 221, 224, 230, 219, 220, 187, 219,
+    201, 210, 209, 207, 255, 199,  26, 191, 192, 193, 178, 177, 176, 175, 174, 182, 205, 201, 194, 193, 194, 198, 196, 198,
+    196, 198, 201, 198, 197, 200, 203, 211, 217, 242, 255, 238, 255, 247,   1, 250, 251, 253, 252, 255, 253,  14, 254, 252,
+    195,  19,  20, 154, 177,  53, 253,  27, 206, 123,  13,  35, 210, 254, 255,  17, 189,  24,  34, 119, 238,  28,  89, 218,
+     26,  17, 129, 218,   8,  23,  30, 217, 254, 232, 255,  37,  35,  67, 200,  22, 252,  57, 173, 142,  12,  31, 200, 121,
+     22,   6,  86, 242, 244, 246, 174, 176, 166, 169, 180, 171, 167, 173, 190, 178, 176, 177, 181, 182, 181, 183, 186, 183,
+    184, 254, 185, 255, 186,   1, 187, 189, 255, 190,   1, 191, 193, 255, 195,   3, 193, 177, 176, 175, 255, 174,   8, 176,
+    197, 190, 189, 192, 195, 199, 197, 199, 255, 189,  11, 194, 201, 209, 205, 206, 207, 219, 234, 241, 236, 244, 247, 254,
+    251,   0, 252, 254, 253,   0, 254, 255, 253,   3, 252, 250, 248, 252, 254, 253,   4, 254, 255, 254, 248, 253, 254, 255,
+    255, 254,   1, 253, 250, 252, 255,   6, 253, 249, 254, 188,  43, 249, 252, 254, 254,   1, 253, 248, 255, 255,   1, 254,
+    253, 255, 252,   6, 251, 245, 250, 251,  89, 134, 238, 255, 244,   2, 245, 246, 165, 255, 162,  59, 163, 164, 165, 167,
+    168, 173, 171, 174, 175, 176, 178, 189, 182, 187, 204, 203, 202, 201, 198, 194, 193, 194, 197, 196, 194, 192, 189, 187,
+    185, 192, 206, 205, 204, 203, 204, 203, 193, 188, 191, 195, 197, 199, 198, 201, 194, 195, 200, 202, 207, 206, 204, 220,
+    235, 241, 239, 244, 249, 246, 247, 250, 255, 252, 255, 253, 253, 254,   2, 253, 252, 251, 254, 252,   0, 253, 252, 254,
+    254, 255,   0, 254, 248, 255, 255, 254,   2, 210, 160, 255, 252, 254,   0, 255, 253, 254, 255, 252, 255, 251,   4, 250,
+    251, 158, 203, 245, 255, 244,   5, 245, 246, 166, 167, 168, 170, 255, 172,   8, 171, 173, 179, 182, 187, 190, 191, 188,
+    181, 255, 178,  15, 180, 181, 186, 192, 197, 193, 187, 193, 197, 198, 196, 190, 181, 184, 182, 181, 254, 183,  30, 184,
+    183, 182, 184, 191, 194, 196, 198, 197, 199, 198, 190, 191, 194, 197, 200, 201, 207, 227, 222, 239, 243, 238, 232, 243,
+    249, 247, 244, 243, 244, 248, 255, 252,   1, 253, 252, 255, 250, 255, 251, 255, 252, 254, 253, 254, 254, 255, 255,   0,
+    254, 245, 255,   0, 254, 255, 255, 255, 254,   0, 255, 255, 254,   1, 255, 254, 255, 253,   2, 254, 253, 252, 255, 251,
+      4, 250, 251, 250, 248, 245, 255, 244, 255, 246,  28, 184, 183, 177, 172, 171, 175, 180, 184, 188, 189, 190, 195, 204,
+    209, 207, 178, 177, 178, 189, 192, 188, 189, 185, 181, 184, 186, 187, 189, 192, 255, 196,   3, 190, 185, 180, 177, 253,
+    175,   2, 178, 182, 185, 255, 192,  16, 194, 195, 197, 193, 200, 197, 196, 204, 206, 214, 225, 219, 224, 235, 233, 239,
+    243, 254, 245,   2, 247, 248, 249, 254, 251, 255, 252,   1, 251, 252, 253, 253,   1, 254, 253, 254, 254, 255, 255,   0,
+    254, 245, 255,   0, 254, 254, 255, 253, 254,   7, 255, 253, 252, 251, 253, 254, 252, 251, 254, 250,   6, 251, 249, 246,
+    245, 244, 245, 246, 255, 169,  18, 172, 180, 187, 192, 198, 204, 209, 213, 216, 215, 210, 211, 212, 187, 175, 176, 197,
+    200, 184, 255, 179,  11, 181, 183, 182, 186, 195, 196, 195, 190, 187, 186, 188, 189, 255, 188,   8, 190, 193, 197, 198,
+    195, 193, 189, 182, 183, 255, 185,  13, 188, 191, 194, 198, 201, 209, 214, 216, 219, 226, 227, 234, 241, 245, 255, 243,
+      1, 245, 246, 255, 244,   1, 246, 247, 255, 248,   0, 249, 255, 251, 255, 252, 254, 253, 254, 254,   0, 255, 255, 254,
+    245, 255,   0, 254, 254, 255, 252, 254, 251, 253, 255, 251, 255, 250,   2, 251, 249, 246, 255, 245,   1, 244, 246,   8,
+    240, 241, 243, 245, 246, 247, 248, 249, 250, 255, 251, 255, 252, 254, 253,   0, 254, 255, 253, 251, 254,   0, 255, 254,
+    254, 254, 253,   1, 254, 253, 255, 254,   1, 253, 254, 254, 253, 255, 252,   0, 251, 255, 250,   5, 249, 248, 247, 241,
+    230, 236, 255, 241,   4, 239, 238, 236, 235, 233, 255, 230,   7, 229, 227, 198, 220, 225, 224, 223, 222, 255, 221, 253,
+    220, 255, 219,   0, 218, 255, 222,   4, 218, 210, 198, 184, 179, 255, 180,  20, 181, 188, 185, 189, 186, 201, 194, 202,
+    216, 211, 207, 203, 192, 182, 179, 186, 193, 213, 190, 201, 204, 255, 202, 254, 201, 252, 202,  10, 201, 200, 198, 197,
+    200, 201, 240, 242, 244, 245, 247, 255, 249,   1, 250, 251, 255, 252, 255, 253,   1, 254, 253, 248, 254, 255, 255, 253,
+    254, 255, 253, 253, 254, 253, 253, 254, 252,   0, 251, 255, 250, 255, 249,   3, 242, 233, 244, 245, 255, 244, 255, 242,
+      2, 241, 239, 238, 255, 236,  11, 235, 233, 205, 208, 230, 228, 227, 225, 223, 221, 220, 219, 255, 218,  10, 217, 216,
+    217, 226, 225, 219, 205, 192, 182, 178, 175, 255, 174,  19, 182, 177, 173, 176, 195, 192, 200, 204, 214, 215, 206, 194,
+    176, 175, 185, 200, 217, 191, 194, 206, 246, 203,  11, 202, 199, 197, 201, 204, 242, 244, 245, 246, 248, 249, 250, 254,
+    251,   0, 252, 254, 253, 248, 254,   0, 255, 255, 254,   0, 255, 255, 254,   0, 253, 248, 254, 253, 253, 255, 252, 255,
+    251,   1, 244, 239, 255, 248,   7, 247, 246, 244, 243, 242, 240, 238, 236, 255, 233,   9, 231, 230, 214, 204, 225, 224,
+    222, 220, 218, 217, 255, 216, 254, 215,  30, 214, 223, 227, 226, 217, 200, 187, 178, 171, 168, 169, 171, 175, 191, 173,
+    184, 196, 182, 185, 194, 207, 215, 209, 195, 175, 173, 185, 207, 215, 190, 193, 255, 203, 253, 201,   0, 200, 253, 201,
+      7, 200, 199, 197, 195, 199, 202, 240, 242, 255, 244,   3, 226, 223, 224, 225, 255, 226, 255, 227, 252, 228, 253, 229,
+      0, 228, 255, 229, 249, 228,   0, 229, 252, 228, 251, 227,   3, 226, 225, 221, 216, 255, 222,   1, 221, 220, 255, 219,
+      0, 231, 255, 240,   1, 238, 237, 255, 234,  10, 233, 234, 217, 199, 230, 229, 228, 226, 225, 224, 223, 255, 222, 255,
+    221,  33, 220, 227, 226, 224, 212, 198, 185, 179, 174, 168, 170, 172, 167, 170, 171, 185, 194, 186, 181, 187, 201, 209,
+    210, 200, 176, 171, 186, 216, 215, 193, 197, 209, 201, 200, 252, 199, 253, 200,   9, 199, 197, 196, 200, 203, 244, 246,
+    247, 149,  15, 235,   7, 230,   6,   4,  46, 232, 243, 242, 240, 255, 238,   9, 236, 233, 218, 197, 230, 229, 227, 224,
+    222, 221, 255, 219, 255, 217,  13, 215, 217, 227, 215, 207, 198, 191, 183, 177, 180, 178, 177, 163, 164, 255, 173,  19,
+    177, 185, 189, 187, 183, 190, 203, 206, 192, 174, 168, 187, 217, 214, 193, 201, 217, 204, 203, 202, 253, 201, 255, 202,
+    255, 201,  10, 200, 198, 196, 200, 204, 242, 244, 245, 151,  85,  87, 249,  89, 245,  90,   1,  82,  14, 245,   0, 255,
+      1,   2,   9,   8,   1, 248,   0,   4,   4, 216, 241, 240, 238, 255, 235,   7, 233, 230, 208, 192, 225, 227, 225, 223,
+    255, 221, 254, 220, 255, 219,   1, 221, 200, 255, 213,   9, 191, 181, 177, 178, 180, 188, 167, 166, 168, 165, 255, 164,
+      1, 166, 177, 255, 193,  13, 188, 197, 199, 183, 169, 166, 187, 218, 208, 193, 201, 219, 204, 200, 255, 199, 252, 198,
+      0, 199, 255, 198,  10, 196, 194, 198, 202, 243, 245, 247, 215, 193, 241, 250, 254, 251,   1, 252, 253, 255, 252,   3,
+    253, 252, 253, 254, 252, 253,   6, 252, 253, 254, 252,  82,   1,   0, 255,   1,   3,  15,  21,   5,   1, 254,   0,   7,
+      1,  20, 113, 196, 120,   1,   0,   1, 253,   2,   0,   1, 255,   0,  24,   4, 217, 243, 242, 241, 238, 239, 236, 202,
+    181, 173, 189, 232, 231, 229, 227, 226, 225, 224, 223, 222, 221, 222, 210, 190, 255, 189,  29, 193, 185, 183, 182, 185,
+    166, 179, 163, 166, 165, 163, 160, 165, 184, 199, 189, 191, 192, 176, 162, 168, 195, 216, 196, 199, 202, 220, 206, 200,
+    199, 253, 198, 255, 199, 255, 200,  25, 199, 197, 194, 199, 204, 244, 246, 247, 104,   7, 214, 250, 251, 183, 175, 252,
+    253, 241, 141, 219, 147, 231, 249, 154, 204, 163, 255, 145,   1, 167, 250, 255, 255,  24,  86,   1,   2,  70, 181, 227,
+    231, 207,  95,   3,   0,   1,  66, 215, 251, 248, 145,   4,   8, 142, 166, 167, 172, 173,  50, 255,   0,   4,   4, 218,
+    243, 242, 240, 255, 237,  11, 220, 197, 175, 172, 171, 184, 204, 224, 221, 220, 219, 218, 255, 217, 254, 216,   9, 198,
+    197, 192, 209, 194, 180, 185, 181, 173, 179, 253, 166,  17, 164, 158, 168, 193, 188, 189, 188, 165, 159, 170, 197, 209,
+    189, 205, 203, 217, 205, 201, 253, 200, 255, 199, 254, 200,  10, 199, 197, 194, 198, 204, 243, 245, 246, 101,   1, 213,
+    255, 250,  16, 106,  86, 252, 253, 224,   9, 190,  38, 171, 237,  22, 184,  50,  44,  77, 114, 246, 255, 255,  43,  85,
+      1,   4, 153, 251, 237, 242, 253, 247,  64,   2,  65, 236, 250, 186,  49,   1,   0,  12, 210, 234, 231, 229, 217,  40,
+      1,   0,   4, 209, 241, 238, 237, 234, 225, 202, 203, 177, 175, 173, 177, 210, 214, 225, 226, 254, 225, 254, 224,  11,
+    213, 210, 214, 220, 211, 190, 175, 186, 192, 186, 178, 175, 253, 171,  18, 165, 168, 189, 192, 188, 183, 166, 163, 175,
+    202, 199, 190, 207, 212, 214, 203, 202, 200, 199, 254, 198,   0, 199, 255, 198,   6, 199, 197, 196, 193, 197, 203, 246,
+    255, 248,   2, 101,   1, 214, 255, 251,  13, 107,  83, 252, 253, 225,   9, 207,  76, 130, 212,  23, 218,  51, 143, 255,
+    254, 254, 255,   0,  85, 255,   1,  21,  30, 110,  40,  73, 254, 253, 122,  14, 207, 250, 196,  51,  28,   2,   1,  15,
+    228, 235, 130,  81,  72,  10, 255,   0,  20,   5, 184, 215, 219, 221, 219, 229, 202, 201, 177, 174, 173, 176, 204, 191,
+    205, 227, 226, 225, 224, 223, 255, 222,  12, 207, 214, 228, 222, 205, 185, 172, 179, 181, 179, 176, 184, 174, 254, 173,
+      2, 168, 170, 187, 255, 186,   0, 180, 255, 167,   6, 183, 206, 187, 197, 202, 214, 212, 255, 204, 255, 201, 250, 200,
+     10, 199, 197, 195, 198, 205, 243, 245, 247, 101,   1, 214, 255, 250,  15, 107,  80, 252, 253, 224,   9, 211, 125,  83,
+    172,  48, 244,  51, 141, 248, 251, 254, 255,   8,  85,   1,   0,   1,  48, 101, 162, 254, 251, 255,  77,  13, 250, 251,
+    246, 243, 240, 149,  11,  25, 242, 236, 131,  80,  16,   0, 255,   1,  15,   5, 189, 203, 198, 194, 192, 207, 202, 183,
+    177, 174, 172, 173, 192, 183, 200, 254, 223, 255, 222,  14, 221, 220, 204, 218, 231, 220, 198, 182, 171, 170, 177, 173,
+    176, 183, 180, 255, 174,   6, 173, 170, 175, 187, 183, 182, 173, 255, 169,   8, 192, 203, 181, 199, 196, 215, 216, 204,
+    206, 255, 202, 254, 201, 253, 200,  10, 199, 197, 193, 196, 203, 246, 247, 248, 102,   1, 215, 255, 251,  16, 107,  77,
+    252, 253, 224,   9, 211, 176,  49, 133,  95, 253,  50,  22,  38, 141, 253, 255, 255,   5,  85,   1,   0,   1, 120, 252,
+    255, 253,   2, 179,  11, 135, 255, 253,  24, 214, 196, 249, 251, 104,  41, 240, 235, 238, 247, 203,  33,   2,   1,   6,
+    216, 237, 222, 214, 212, 204, 193, 181, 178, 175, 255, 174,   5, 211, 202, 224, 230, 229, 228, 255, 227,  32, 226, 210,
+    199, 196, 226, 214, 195, 182, 174, 171, 176, 172, 174, 172, 176, 177, 175, 173, 174, 184, 183, 182, 176, 171, 173, 176,
+    191, 197, 181, 193, 197, 214, 221, 255, 207,   0, 200, 252, 199, 255, 198,  11, 197, 196, 195, 193, 195, 202, 245, 246,
+    248, 101,   1, 214, 255, 250,  16, 107,  73, 252, 253, 224,   9, 210, 215,  32,  69, 149, 253,  51, 114, 201, 226, 254,
+    255, 255,  43,  84,   1,   0,   1,  61, 118, 168, 254, 250, 109, 148, 254, 247,  43,  12, 194, 246, 162,  31, 111,  91,
+    147, 251, 249, 127,   3,   2,   7, 219, 245, 244, 243, 236, 212, 199, 189, 178, 176, 174, 173, 217, 202, 222, 225, 255,
+    224,   0, 223, 255, 222,  11, 195, 186, 190, 221, 215, 198, 192, 180, 175, 174, 175, 173, 255, 172, 255, 173,  18, 175,
+    181, 182, 180, 177, 179, 180, 176, 180, 190, 193, 183, 186, 195, 211, 219, 214, 212, 203, 250, 201,  29, 200, 199, 197,
+    194, 197, 205, 244, 246, 247, 101,   1, 214, 250, 251, 107,  70, 251, 252, 224,   9, 210, 247,  39,  12, 199, 253,  51,
+    142, 253, 254, 254, 255,   1,  84,   1, 255,   0,  14,   1,   3,  34, 252, 254, 182, 109, 252, 249,  63,  19, 205, 250,
+    149,   2, 255,   3,  21,   7, 236, 248, 147,   3,   2,   7, 217, 243, 242, 240, 237, 229, 211, 197, 179, 176, 175, 174,
+    190, 219, 228, 254, 227, 254, 226,   1, 216, 205, 255, 223,   7, 212, 200, 207, 190, 180, 179, 178, 177, 254, 176,  10,
+    177, 179, 185, 191, 180, 179, 184, 189, 185, 182, 194, 255, 185,   5, 181, 189, 207, 211, 216, 215, 255, 203, 255, 202,
+      0, 201, 254, 200,  11, 198, 197, 196, 193, 194, 203, 246, 248, 249, 102,   1, 215, 255, 251,  16, 107,  42, 151, 153,
+    214,   9, 211, 252,  87,  22, 240, 253,  51,  86, 150, 171, 250, 255, 255,  29,  84,   1,   2,  34,  39,  65, 181, 254,
+    253, 129,  30, 224, 251, 225, 206, 252, 237,  55,  15,  12,  20, 111, 250, 245,  92,   4,   3,   8, 220, 246, 255, 244,
+    255, 242,  10, 225, 213, 181, 177, 175, 182, 229, 233, 232, 231, 230, 255, 229, 255, 228,   9, 227, 225, 213, 202, 187,
+    209, 213, 197, 184, 185, 254, 186,  12, 182, 181, 187, 203, 209, 195, 185, 197, 204, 194, 195, 183, 195, 255, 185,   8,
+    182, 187, 204, 203, 208, 209, 203, 202, 201, 254, 200, 255, 199,  14, 198, 197, 196, 193, 194, 202, 244, 245, 247, 101,
+      1, 214, 250, 251, 138, 255,  60,   6,  66, 210,  62, 219, 253, 163, 102, 255, 254,  31,  91,  56,  55,  95, 246, 255,
+    254,  83,   1,   9, 191, 237, 246, 252, 251, 168,  16,   1,  46, 172, 234, 238, 186,  62,   4, 100, 224, 227, 245, 249,
+    165,  13, 255,   4,   4,   9, 219, 244, 243, 242, 255, 239,   8, 221, 195, 183, 178, 176, 175, 194, 228, 226, 254, 225,
+    254, 224, 255, 223,  10, 221, 217, 216, 224, 216, 200, 189, 190, 191, 194, 200, 255, 197,  19, 207, 213, 204, 186, 189,
+    201, 218, 214, 189, 184, 193, 186, 184, 186, 190, 199, 198, 203, 208, 206, 254, 204, 254, 203,  14, 202, 201, 200, 198,
+    195, 196, 204, 246, 248, 249, 102,   1, 213, 251, 252, 253, 251,   7, 253, 252, 253, 254, 252, 251, 253, 254, 253, 252,
+    254, 254,   8,  83,   1,   2, 112, 179, 177, 148,  69,   4, 255,   0, 255,   1,   1,   3,   5, 254,   2,  22,  36, 206,
+    209, 177,  94,   8,   5,   4,   5,  10, 218, 244, 243, 242, 239, 240, 207, 189, 181, 178, 177, 176, 179, 253, 232, 253,
+    231, 255, 230,  22, 228, 223, 217, 224, 217, 201, 193, 195, 201, 209, 208, 199, 197, 213, 217, 207, 186, 188, 195, 220,
+    231, 217, 201, 255, 205, 254, 198,   5, 199, 196, 204, 207, 205, 204, 254, 203,   5, 202, 201, 200, 199, 198, 197, 255,
+    194,   7, 201, 244, 246, 247, 101,   1,  90, 137, 255, 138, 248, 139, 250, 140,   4, 145, 237,  82,   1,   0, 254,   1,
+      1,   2,   1, 251,   0, 255,   1,   0,   0, 255,   1,   1,   7,   9, 253,   4,   4,   5,   6,  12, 220, 246, 255, 245,
+    255, 242,   4, 208, 189, 182, 179, 178, 255, 177,   0, 229, 255, 231,   0, 230, 255, 229, 255, 228, 255, 227,  24, 226,
+    220, 219, 223, 213, 200, 198, 205, 206, 202, 200, 197, 203, 216, 223, 199, 189, 190, 195, 213, 227, 220, 224, 232, 234,
+    255, 235,   5, 228, 210, 197, 206, 207, 206, 255, 205,   1, 204, 203, 255, 202,   3, 201, 200, 199, 198, 255, 194,   4,
+    202, 245, 246, 248, 107, 236,   2,   3,  13, 217,  82,   2, 246,   1, 254,   2,   1,   1,   2, 254,   3,  17,   4,   5,
+      6,   7,   8,   9,  19, 221, 243, 242, 241, 237, 238, 208, 190, 182, 180, 179, 255, 178,   1, 221, 229, 252, 228, 253,
+    227, 255, 226,  22, 216, 204, 199, 203, 205, 201, 200, 199, 198, 203, 215, 209, 193, 196, 200, 208, 221, 224, 219, 217,
+    229, 233, 236, 255, 237,   6, 236, 219, 212, 211, 209, 208, 207, 255, 206, 255, 205,  11, 204, 203, 202, 200, 197, 195,
+    204, 246, 247, 248, 209, 112, 255, 103,   1, 102, 101, 255, 102,   2, 103, 104, 105, 247, 106,   4, 107, 112, 232, 153,
+    108, 254, 107,   2, 108, 107, 108, 252, 107, 255, 108, 252, 107, 253, 108, 255, 109,   5, 110, 153, 244, 246, 245, 244,
+    255, 242,   4, 211, 191, 184, 181, 180, 255, 179,   0, 223, 254, 235, 254, 234, 254, 233,   8, 232, 229, 220, 206, 201,
+    204, 206, 204, 202, 255, 201,  15, 200, 201, 204, 200, 201, 209, 214, 224, 229, 224, 219, 214, 225, 228, 234, 236, 254,
+    237,   3, 226, 212, 209, 207, 255, 206,   0, 205, 255, 204,  11, 202, 201, 200, 198, 195, 193, 200, 243, 245, 246, 247,
+    248, 255, 250,   5, 247, 245, 246, 247, 248, 250, 254, 254, 253, 253, 253, 254,   0, 255, 255, 254, 255, 255, 251, 254,
+    255, 255, 254, 254,   1, 253, 254, 254, 253, 255, 252, 255, 251, 255, 250,   0, 249, 255, 248,   0, 247, 255, 246,   7,
+    245, 244, 241, 242, 213, 192, 184, 182, 255, 181,   3, 180, 216, 232, 231, 253, 230,   0, 229, 254, 228,  10, 226, 221,
+    209, 210, 217, 220, 214, 203, 202, 203, 204, 254, 206,  10, 216, 222, 226, 231, 230, 224, 213, 217, 223, 225, 235, 254,
+    236,   9, 238, 237, 223, 211, 209, 208, 207, 206, 205, 204, 255, 203,   9, 201, 199, 196, 194, 201, 246, 247, 248, 249,
+    250, 255, 251,   5, 243, 244, 245, 246, 248, 249, 255, 251,   1, 252, 253, 255, 254, 255, 255,   0, 253, 255, 254, 254,
+    255, 247, 254,   0, 253, 255, 254, 255, 253, 254, 252, 255, 251, 255, 250,   1, 249, 248, 255, 247, 255, 246,   8, 245,
+    244, 243, 242, 239, 240, 215, 192, 185, 255, 183,   3, 182, 183, 217, 234, 251, 233, 254, 232,   7, 231, 219, 210, 213,
+    227, 230, 227, 209, 255, 207,   0, 209, 255, 213,   1, 221, 226, 255, 230,   7, 234, 230, 219, 207, 214, 225, 226, 235,
+    255, 236, 255, 234,  24, 238, 237, 223, 212, 211, 210, 209, 208, 207, 206, 205, 204, 201, 199, 196, 202, 242, 244, 245,
+    246, 247, 249, 247, 241, 250, 255, 245,   3, 247, 249, 251, 252, 252, 254,   0, 253, 253, 254,   0, 255, 254, 254, 254,
+    253, 250, 254, 253, 253, 253, 252, 255, 251, 255, 250, 255, 249, 254, 248,   6, 247, 246, 245, 243, 244, 224, 192, 255,
+    185, 255, 184,   1, 185, 232, 255, 237, 254, 236, 254, 235, 255, 234,   4, 233, 221, 211, 215, 228, 255, 231,  41, 225,
+    217, 215, 217, 221, 223, 228, 231, 230, 227, 234, 232, 214, 209, 212, 226, 227, 232, 236, 237, 232, 234, 237, 238, 236,
+    220, 211, 210, 208, 207, 206, 205, 204, 202, 200, 197, 194, 199, 244, 245, 247, 248, 255, 249,   7, 243, 244, 252, 251,
+    245, 247, 249, 250, 252, 254,   0, 253, 254, 254, 253, 255,   1, 254, 255, 254, 253, 252, 254,   1, 253, 254, 254, 253,
+    254, 252,   0, 251, 255, 250, 255, 249,   0, 248, 255, 247,   2, 246, 245, 244, 255, 243,   4, 241, 238, 239, 235, 201,
+    255, 186,   3, 185, 188, 207, 233, 253, 232, 251, 231,   4, 230, 221, 214, 216, 228, 254, 230,   0, 228, 255, 225,   0,
+    227, 255, 231,  38, 230, 229, 227, 236, 233, 214, 211, 213, 226, 227, 230, 235, 237, 233, 239, 237, 228, 238, 235, 219,
+    214, 213, 211, 208, 207, 206, 205, 202, 200, 196, 201, 243, 245, 246, 247, 248, 247, 236, 248, 255, 251,   1, 244, 250,
+    252, 253, 255, 252,   0, 253, 248, 254, 254, 253,   1, 254, 253, 255, 254, 253, 253, 254, 252, 255, 251, 255, 250, 255,
+    249,   0, 248, 255, 247, 255, 246, 254, 245, 255, 243,   0, 241, 255, 242,   6, 235, 215, 210, 215, 227, 237, 238, 249,
+    237, 255, 236,   4, 235, 225, 216, 219, 232, 255, 235,  15, 234, 235, 233, 230, 232, 234, 230, 233, 229, 224, 236, 232,
+    215, 214, 215, 226, 255, 228,   2, 235, 238, 236, 255, 239,  21, 228, 232, 237, 234, 229, 223, 220, 216, 211, 208, 206,
+    205, 202, 197, 202, 240, 242, 244, 245, 246, 241, 237, 255, 250,   2, 248, 243, 252, 253, 253,   1, 251, 252, 246, 254,
+      0, 253, 255, 252, 252, 254, 252, 253, 254, 252, 254, 251,   0, 250, 254, 249, 255, 248,   0, 247, 255, 246,   2, 245,
+    244, 241, 255, 242,   0, 241, 255, 240,   0, 239, 255, 238, 254, 237, 253, 236, 253, 235,   4, 234, 226, 219, 221, 232,
+    253, 234, 255, 232,  11, 234, 231, 234, 231, 226, 224, 236, 232, 216, 217, 218, 227, 255, 228,   0, 234, 255, 237,  19,
+    238, 241, 238, 226, 237, 236, 232, 221, 216, 213, 209, 207, 206, 203, 201, 197, 200, 244, 245, 247, 255, 248,   1, 233,
+    242, 255, 251,   2, 242, 246, 252, 255, 253,   3, 251, 249, 252, 253, 246, 254,   4, 252, 251, 252, 253, 254, 253, 253,
+    254, 252, 255, 251, 254, 250,   0, 249, 255, 248, 255, 247,   2, 246, 245, 244, 255, 243,   4, 242, 241, 240, 238, 239,
+    254, 238,   0, 237, 254, 236, 245, 235,   3, 228, 221, 224, 233, 255, 235, 255, 236,   1, 226, 230, 255, 234,   8, 241,
+    225, 228, 224, 236, 232, 219, 220, 222, 255, 227,   4, 229, 233, 236, 238, 239, 255, 241,  24, 230, 236, 237, 235, 225,
+    215, 213, 212, 210, 209, 206, 204, 199, 201, 239, 241, 242, 243, 241, 228, 246, 248, 247, 237, 247, 255, 250,   2, 246,
+    247, 251, 249, 253, 255, 254, 254, 253,   2, 251, 250, 251, 252, 253, 252, 252, 253, 251, 255, 250, 254, 249, 255, 248,
+    255, 247, 254, 246,   0, 245, 252, 243,   0, 242, 253, 241, 249, 240, 254, 239,   3, 231, 224, 226, 236, 255, 239,  12,
+    238, 234, 231, 233, 236, 241, 239, 223, 232, 226, 235, 232, 223, 255, 225,  32, 230, 227, 229, 232, 236, 238, 239, 240,
+    242, 234, 233, 238, 236, 234, 226, 219, 216, 213, 212, 209, 206, 200, 202, 243, 244, 245, 239, 234, 233, 249, 250, 242,
+    237, 255, 246,   1, 244, 246, 255, 247,   0, 249, 255, 253, 250, 254,   3, 253, 254, 253, 251, 255, 250,   1, 253, 254,
+    253, 253, 254, 252, 255, 251, 254, 250, 255, 249, 255, 248,   0, 247, 255, 246, 255, 245, 255, 244, 255, 242,   0, 239,
+    255, 240, 254, 239, 254, 238, 245, 237,   3, 232, 227, 228, 235, 254, 238,  14, 236, 232, 236, 242, 243, 233, 228, 232,
+    228, 234, 232, 226, 229, 228, 231, 255, 229,  17, 233, 236, 239, 240, 241, 243, 236, 233, 238, 237, 236, 234, 226, 221,
+    222, 216, 208, 205, 255, 201,  12, 240, 242, 243, 238, 221, 240, 242, 238, 232, 242, 248, 240, 244, 253, 245,   3, 247,
+    252, 253, 252, 250, 253,   1, 252, 250, 255, 249, 251, 252, 254, 251, 255, 250,   0, 249, 255, 248, 253, 247,   0, 246,
+    255, 245,   0, 244, 254, 243, 255, 242, 250, 240, 250, 239, 250, 240,   3, 235, 229, 230, 238, 255, 241,  20, 240, 235,
+    231, 233, 240, 243, 230, 231, 232, 230, 235, 233, 231, 232, 230, 233, 232, 229, 233, 236, 240, 255, 241,   4, 242, 240,
+    231, 239, 238, 255, 236,   5, 235, 220, 215, 213, 210, 208, 255, 204,  12, 229, 237, 240, 232, 219, 238, 229, 232, 230,
+    250, 245, 242, 244, 255, 243, 255, 242,   1, 243, 248, 255, 253,   0, 252, 255, 253,   2, 252, 253, 252, 255, 253,   3,
+    249, 248, 249, 252, 255, 253, 254, 252, 252, 251, 255, 250, 254, 249,   2, 248, 249, 248, 255, 247, 255, 246, 255, 245,
+    255, 244, 255, 242,   0, 243, 254, 242, 242, 241,   3, 236, 231, 232, 239, 254, 242,   2, 234, 233, 232, 254, 234, 255,
+    233,   5, 232, 238, 234, 236, 234, 232, 255, 235,   3, 231, 232, 235, 239, 253, 242,   6, 234, 238, 239, 237, 236, 237,
+    232, 255, 215,  23, 211, 208, 204, 203, 218, 220, 236, 219, 228, 232, 226, 228, 232, 245, 235, 242, 241, 240, 239, 238,
+    239, 240, 242, 251, 248, 252,   0, 248, 255, 246, 253, 251,   3, 250, 248, 246, 242, 254, 248,   0, 247, 254, 246, 255,
+    245,   1, 244, 243, 255, 242,   0, 241, 255, 240, 254, 239,   0, 237, 255, 238, 251, 237,   1, 238, 237, 255, 238, 252,
+    239, 254, 240,   4, 237, 233, 234, 240, 241, 255, 242,  21, 241, 236, 235, 236, 235, 238, 239, 237, 235, 240, 238, 240,
+    236, 234, 238, 237, 235, 232, 237, 239, 242, 243, 255, 242,   3, 236, 239, 240, 238, 255, 236,  18, 239, 226, 213, 211,
+    209, 205, 203, 215, 220, 221, 208, 223, 230, 225, 220, 234, 230, 236, 237, 255, 236, 255, 235,   3, 236, 237, 238, 247,
+    254, 249, 252, 250,   1, 249, 246, 255, 245, 253, 249,   4, 248, 247, 244, 235, 247, 254, 246,   0, 245, 253, 244,   0,
+    243, 253, 242, 253, 241, 254, 240,   0, 241, 253, 240, 251, 241,   1, 242, 241, 255, 242, 253, 243,   3, 240, 235, 236,
+    242, 253, 244,   0, 239, 255, 237,   0, 238, 255, 241,   1, 239, 237, 254, 242,   1, 238, 236, 254, 239,  29, 232, 239,
+    238, 243, 244, 242, 243, 235, 240, 241, 239, 237, 236, 237, 239, 220, 214, 211, 207, 205, 211, 220, 214, 208, 215, 225,
+    224, 220, 228, 229, 252, 234,   3, 235, 237, 239, 241, 255, 243, 250, 244, 254, 243, 255, 242,  18, 246, 247, 245, 242,
+    239, 236, 231, 234, 233, 231, 230, 228, 227, 225, 224, 223, 221, 220, 218, 255, 217, 252, 216,   4, 218, 217, 218, 219,
+    220, 255, 222,   5, 225, 230, 235, 237, 236, 235, 254, 233,   2, 234, 235, 236, 254, 237, 255, 238,   0, 239, 254, 240,
+    254, 241,   0, 240, 255, 243,  13, 244, 241, 239, 242, 244, 243, 240, 237, 241, 240, 241, 233, 240, 237, 254, 244,  29,
+    243, 235, 240, 241, 240, 238, 237, 236, 238, 229, 208, 205, 203, 201, 209, 211, 201, 212, 218, 221, 214, 219, 225, 236,
+    241, 243, 245, 249, 251, 252, 255, 253,   2, 252, 244, 241, 250, 242, 254, 241, 255, 240,  18, 243, 239, 236, 235, 233,
+    232, 229, 231, 230, 228, 227, 225, 224, 222, 221, 219, 218, 217, 216, 249, 214,   8, 215, 217, 218, 219, 221, 224, 233,
+    236, 238, 255, 239,   5, 240, 238, 235, 234, 235, 236, 255, 237,   0, 238, 255, 239,   0, 240, 254, 241, 254, 242,  18,
+    243, 241, 246, 243, 245, 242, 241, 243, 244, 245, 242, 240, 242, 241, 243, 235, 241, 239, 243, 255, 245,   2, 244, 235,
+    240, 255, 241,   1, 239, 237, 255, 236,  13, 239, 214, 206, 204, 201, 209, 206, 199, 212, 216, 222, 214, 229, 249, 255,
+    252, 255, 251,   4, 253, 251, 248, 243, 241, 253, 239, 253, 240, 254, 239, 254, 238,  18, 237, 236, 234, 232, 231, 230,
+    229, 227, 226, 228, 226, 225, 223, 222, 221, 220, 218, 217, 216, 251, 215, 254, 216,  10, 217, 219, 220, 221, 224, 232,
+    230, 232, 234, 238, 239, 252, 237, 255, 238,   1, 239, 240, 255, 241, 255, 242, 253, 243, 254, 244,   4, 247, 243, 247,
+    243, 242, 255, 245,   1, 247, 244, 254, 242,   1, 245, 237, 255, 241,  19, 242, 245, 246, 244, 237, 239, 240, 241, 240,
+    238, 236, 235, 237, 228, 208, 206, 203, 206, 197, 202, 255, 207,   4, 211, 209, 225, 227, 229, 255, 230,   2, 231, 239,
+    237, 255, 234,   0, 235, 255, 236, 255, 237, 253, 238, 252, 237,   3, 236, 235, 234, 231, 255, 228,  12, 227, 226, 224,
+    221, 225, 224, 223, 222, 221, 220, 219, 218, 217, 254, 216,   0, 215, 253, 216, 255, 217,  15, 218, 220, 222, 223, 229,
+    228, 227, 231, 237, 247, 246, 239, 236, 235, 237, 239, 255, 240,   0, 241, 255, 242,   0, 243, 254, 244, 253, 245,   4,
+    246, 249, 246, 245, 248, 253, 245,   1, 247, 246, 255, 244,   5, 243, 247, 238, 242, 244, 241, 255, 246,   0, 244, 255,
+    239,   0, 240, 255, 241,   1, 238, 236, 255, 235,  19, 239, 213, 207, 203, 201, 191, 203, 202, 204, 199, 211, 219, 220,
+    222, 224, 226, 227, 228, 230, 231, 255, 232,   0, 233, 254, 234, 251, 235,   7, 233, 231, 230, 229, 228, 227, 229, 226,
+    254, 224,   4, 222, 218, 216, 209, 211, 255, 219, 255, 218,   1, 217, 216, 255, 215,   5, 217, 219, 216, 208, 207, 209,
+    255, 211,  12, 213, 216, 217, 220, 227, 226, 231, 247, 245, 254, 253, 245, 243, 255, 237,   2, 240, 241, 242, 255, 243,
+    255, 244,   0, 245, 253, 246, 255, 247,   1, 248, 249, 255, 246,   6, 248, 247, 248, 245, 246, 248, 246, 255, 245,   1,
+    244, 248, 255, 241,   1, 245, 242, 255, 247,   1, 245, 241, 255, 240, 255, 241,  23, 239, 237, 236, 235, 237, 228, 208,
+    204, 199, 196, 198, 205, 204, 197, 213, 215, 216, 219, 221, 223, 224, 225, 227, 228, 255, 229,   1, 230, 231, 249, 232,
+      1, 231, 230, 254, 231,  11, 232, 227, 223, 222, 221, 220, 219, 216, 214, 203, 202, 208, 255, 217,   0, 216, 255, 215,
+     22, 214, 215, 220, 216, 202, 200, 204, 207, 209, 211, 213, 215, 218, 220, 223, 226, 231, 241, 247, 255, 254, 246, 244,
+    255, 238,   2, 241, 242, 243, 255, 244, 255, 245, 255, 246, 254, 247, 253, 248, 255, 247,   0, 250, 255, 249,  14, 246,
+    247, 249, 248, 246, 247, 245, 249, 243, 242, 246, 244, 248, 247, 246, 255, 242,   0, 239, 255, 241,  22, 239, 237, 236,
+    235, 236, 239, 213, 205, 181, 193, 203, 205, 196, 199, 211, 214, 213, 217, 219, 220, 222, 223, 224, 255, 226,   0, 227,
+    255, 228, 254, 229, 254, 230,  18, 229, 232, 236, 238, 240, 241, 240, 241, 229, 221, 219, 218, 217, 216, 214, 210, 200,
+    198, 199, 255, 214, 254, 213,  18, 212, 209, 206, 201, 199, 200, 204, 208, 190, 212, 215, 202, 213, 222, 225, 227, 232,
+    238, 247, 255, 254,   5, 245, 242, 239, 240, 242, 223, 255, 244, 255, 246, 254, 247, 253, 248,   0, 249, 255, 248,   4,
+    249, 250, 251, 250, 249, 255, 248,  19, 250, 249, 247, 248, 246, 249, 245, 244, 247, 246, 247, 249, 247, 244, 240, 238,
+    228, 227, 224, 234, 254, 236,   4, 238, 228, 205, 180, 194, 255, 197,   4, 188, 201, 205, 208, 218, 255, 213,   6, 215,
+    217, 218, 219, 220, 221, 222, 255, 223, 255, 224, 253, 225,   3, 224, 227, 230, 231, 253, 232,   3, 226, 218, 216, 214,
+    255, 213,   2, 211, 208, 199, 255, 195,   0, 208, 255, 209, 254, 208,   0, 198, 255, 195,  23, 196, 199, 203, 207, 121,
+    176, 212,  96, 217, 222, 224, 226, 231, 236, 247, 255, 254, 245, 242, 240, 241, 235, 140, 245, 255, 246, 255, 247,   0,
+    161, 255, 248, 250, 249, 255, 251, 255, 250, 255, 248, 255, 250,   6, 218, 192, 248, 250, 247, 245, 247, 255, 248,   9,
+    249, 248, 244, 242, 241, 160, 188, 158, 211, 238, 255, 236,  11, 237, 239, 212, 183, 196, 198, 193, 188, 204, 206, 208,
+    214, 255, 213,   4, 214, 216, 217, 218, 220, 255, 221,   0, 222, 255, 223, 252, 224,   2, 223, 224, 225, 255, 227,   0,
+    228, 255, 227,   3, 224, 216, 213, 211, 255, 210,  11, 209, 205, 202, 192, 193, 208, 210, 209, 210, 209, 210, 198, 255,
+    195,  86, 197, 198, 202, 205, 197, 100, 124, 182, 219, 152, 112, 166, 230, 159, 241, 192, 228, 164, 141, 172, 243, 227,
+    183, 220, 136, 121, 194, 218,  62, 149, 249, 168, 124, 189, 250, 150, 109, 227, 133, 127, 178, 250, 201, 126, 155, 251,
+    110,  97, 223, 251, 240, 142, 109, 241, 135, 134, 162, 245, 171, 122,  88, 217, 161, 239, 194, 119, 140, 236, 239, 228,
+    184, 192, 194, 186, 193, 200, 201, 204, 205, 207, 208, 210, 211, 213, 214, 215, 216, 255, 217, 255, 218, 254, 219, 255,
+    220,   2, 218, 219, 220, 255, 221, 255, 222,   3, 219, 220, 213, 211, 255, 208,   1, 207, 206, 255, 203, 255, 190,   0,
+    204, 253, 206,  89, 207, 197, 194, 195, 197, 199, 201, 205, 209,  98, 121, 218, 183, 129, 226,  95, 232, 108, 239, 126,
+    232,  94, 209, 243, 244, 191, 165, 178, 156, 245, 104, 249, 118, 250, 206, 150, 250, 110, 242,  77, 247, 212, 127, 252,
+    103, 247, 111, 250, 126, 235, 149, 220, 250, 251, 210, 103, 247, 140, 201, 216, 102, 221, 113, 241,  68, 240, 108, 236,
+    100, 237, 128, 205, 238, 240, 185, 190, 192, 180, 195, 197, 200, 201, 203, 204, 206, 207, 209, 210, 212, 213, 255, 214,
+      0, 215, 255, 216, 252, 217,   0, 216, 255, 215, 255, 216,   3, 215, 216, 208, 214, 255, 208,   0, 206, 255, 205,   2,
+    204, 202, 199, 255, 188,   1, 204, 206, 255, 207,  52, 208, 209, 197, 194, 195, 197, 199, 202, 206, 209, 117, 195, 220,
+    136, 187, 227, 102, 213, 133, 244, 115, 248, 111, 245, 244, 245, 163, 196, 149, 210, 249, 114, 250, 117, 251, 154, 119,
+    139, 135, 212, 152, 252, 183, 182, 253, 116, 216,  85, 139, 119, 240, 120, 246, 255, 251, 255, 181,  34, 250, 114, 250,
+    223, 134, 174, 183, 244, 104, 242, 110, 206, 140, 238, 133, 208, 237, 239, 184, 191, 182, 183, 196, 197, 199, 201, 202,
+    203, 205, 206, 208, 209, 210, 211, 212, 255, 213, 255, 214, 252, 215,   1, 214, 212, 254, 210,   6, 209, 210, 203, 211,
+    201, 205, 203, 255, 202, 255, 201,   3, 199, 190, 186, 203, 255, 206, 255, 207,  73, 208, 198, 194, 195, 198, 201, 203,
+    206, 210,  97, 216, 221, 144, 169, 205, 113, 200, 127, 235,  87, 252, 112, 246, 245, 246, 134, 227, 118, 240, 232, 129,
+    245, 102, 250, 163, 195, 232, 193, 182, 183, 252, 153, 213, 253, 114, 224, 133, 248, 177, 252, 107, 243, 251, 252, 151,
+    210, 251, 106, 237, 141, 165, 179, 159, 216,  81, 241, 111, 212, 120, 232,  99, 235, 236, 238, 255, 185,  11, 172, 183,
+    190, 192, 194, 195, 197, 198, 199, 201, 202, 204, 255, 205,   2, 206, 207, 208, 254, 209, 253, 210,   1, 209, 207, 254,
+    205, 255, 204,   5, 198, 209, 194, 203, 201, 200, 254, 199,   3, 197, 194, 184, 200, 255, 202,   0, 203, 255, 205,  15,
+    196, 194, 196, 199, 201, 204, 207, 211, 159, 218, 222, 220, 128, 131, 222, 236, 255, 144,   2, 180, 247, 179, 255, 245,
+     46, 246, 184, 248, 182, 249, 231, 203, 251, 158, 206, 246, 141, 145, 242, 207, 229, 253, 193, 246, 249, 188, 252, 166,
+    134, 222, 253, 202, 162, 252, 253, 191, 241, 251, 220, 129, 163, 220, 245, 143, 152, 176, 237, 184, 241, 161, 124, 210,
+    255, 236,  14, 238, 188, 177, 172, 191, 193, 195, 196, 197, 199, 200, 201, 202, 203, 204, 255, 205, 252, 206, 255, 205,
+     12, 206, 205, 204, 202, 199, 195, 194, 195, 193, 196, 191, 199, 192, 254, 198, 253, 197,  26, 195, 183, 201, 205, 206,
+    207, 208, 209, 197, 194, 196, 199, 202, 205, 208, 212, 216, 219, 222, 225, 228, 230, 231, 237, 239, 240, 246, 255, 244,
+      2, 246, 247, 248, 254, 249, 253, 251, 254, 252,   1, 253, 252, 254, 253, 253, 254,   1, 253, 252, 255, 253,   1, 252,
+    253, 254, 252,   2, 253, 252, 249, 255, 252, 255, 251,   0, 249, 255, 248,   1, 246, 245, 255, 243,  25, 242, 240, 238,
+    237, 236, 235, 237, 185, 167, 175, 184, 186, 187, 189, 190, 192, 193, 195, 196, 197, 187, 188, 189, 190, 192, 193, 255,
+    194, 255, 191,   1, 192, 194, 255, 195,   2, 194, 189, 184, 255, 188,   5, 186, 185, 194, 186, 195, 197, 254, 196,  33,
+    195, 196, 194, 183, 197, 201, 202, 203, 204, 205, 197, 195, 197, 200, 203, 206, 209, 212, 216, 219, 223, 226, 229, 231,
+    232, 238, 240, 239, 240, 242, 245, 246, 247, 248, 255, 249,   0, 250, 255, 251,   1, 252, 251, 254, 252,   1, 253, 252,
+    253, 253, 255, 254, 250, 253, 255, 252,   3, 253, 254, 253, 250, 254, 252,   2, 251, 249, 248, 255, 247,   0, 245, 255,
+    243,   1, 242, 241, 255, 238, 255, 236,  14, 237, 174, 165, 180, 186, 187, 189, 190, 191, 193, 194, 195, 196, 194, 180,
+    255, 181, 255, 182, 252, 183,   1, 184, 185, 255, 184,   3, 186, 187, 191, 189, 255, 181,   4, 180, 190, 182, 184, 195,
+    253, 194,  24, 195, 193, 187, 197, 202, 203, 204, 205, 207, 198, 195, 197, 200, 204, 207, 210, 213, 217, 220, 223, 226,
+    230, 232, 233, 238, 255, 240,   4, 242, 246, 245, 247, 248, 254, 249,   0, 250, 255, 251, 254, 252, 250, 253, 254, 254,
+    245, 253, 255, 251, 254, 252,   6, 250, 248, 246, 247, 245, 243, 241, 255, 240,  36, 239, 238, 236, 235, 236, 164, 168,
+    182, 183, 185, 186, 188, 189, 190, 191, 192, 193, 191, 177, 179, 204, 212, 189, 209, 201, 211, 202, 180, 209, 229, 211,
+    205, 232, 217, 234, 231, 203, 255, 178,   2, 186, 179, 176, 255, 192, 255, 193, 255, 194,  29, 193, 191, 196, 201, 203,
+    204, 206, 207, 198, 195, 198, 202, 204, 208, 211, 214, 218, 221, 224, 226, 230, 232, 234, 240, 241, 240, 244, 247, 245,
+    248, 255, 249, 255, 250,   0, 251, 255, 252, 248, 253, 254, 254,   1, 253, 254, 246, 253, 255, 252, 255, 253,   7, 252,
+    250, 248, 246, 247, 246, 244, 242, 255, 241,  44, 240, 239, 237, 235, 236, 162, 171, 175, 177, 178, 179, 180, 181, 182,
+    184, 185, 186, 184, 174, 200, 232, 230, 224, 226, 229, 223, 210, 177, 217, 237, 229, 204, 236, 218, 234, 217, 214, 177,
+    175, 182, 176, 173, 185, 192, 191, 255, 193, 255, 194, 255, 191,   4, 195, 197, 199, 201, 202, 255, 196,  13, 199, 202,
+    205, 209, 212, 215, 220, 223, 226, 228, 231, 234, 235, 239, 255, 241,   2, 245, 248, 246, 255, 249, 255, 250, 255, 251,
+    255, 252, 251, 253, 251, 254,   1, 212, 225, 254, 254, 255, 253,   0, 254, 252, 253, 255, 252,   4, 253, 252, 152, 163,
+    248, 255, 246,  11, 247, 245, 243, 242, 241, 240, 238, 237, 235, 236, 161, 178, 255, 180, 255, 182,  35, 184, 185, 186,
+    187, 188, 189, 187, 172, 203, 229, 219, 230, 224, 236, 232, 212, 173, 219, 227, 236, 206, 235, 217, 234, 230, 206, 175,
+    172, 178, 173, 172, 178, 190, 191, 192, 194, 255, 195,  15, 190, 196, 200, 201, 203, 204, 206, 198, 196, 199, 202, 206,
+    209, 212, 216, 222, 255, 231,   7, 232, 236, 239, 241, 243, 245, 246, 247, 255, 249,  12, 242, 201, 240, 252, 216, 229,
+    210, 253, 254, 227, 210, 254, 253, 254, 254,  14, 245, 204, 240, 241,  64, 135, 246, 250, 205, 237, 254, 224, 229, 208,
+    252, 255, 254,  16, 251, 208, 227, 253,  76, 140, 203, 245, 246, 228, 198, 239, 237, 199, 212, 211, 236, 255, 235,   7,
+    165, 179, 182, 171, 172, 173, 174, 175, 255, 177, 254, 179,   5, 170, 200, 229, 216, 229, 221, 255, 235,  20, 214, 171,
+    221, 212, 235, 212, 234, 216, 233, 220, 214, 172, 170, 173, 171, 170, 173, 190, 191, 192, 194, 255, 195,   0, 190, 255,
+    194,   3, 196, 198, 200, 202, 255, 197,   5, 200, 203, 206, 210, 215, 222, 255, 225,  22, 227, 230, 232, 236, 239, 240,
+    243, 245, 247, 249, 227,  35,  47,  34, 245,  17,  49,   9, 166, 161,  28,  26, 141, 254, 254,  15, 238,  35,  72,  25,
+    171,   9,  54, 218,  51,  49,  20, 229,  58,  31,  20, 119, 255, 254,  16,  78,  61,  21, 199,  46,  42,  16, 131, 184,
+     25,  34,  87, 204,   0,  46,   7, 194, 255, 235,   3, 169, 173, 176, 178, 255, 179,   1, 180, 181, 255, 182, 255, 184,
+     22, 182, 168, 196, 229, 214, 230, 219, 227, 234, 216, 170, 224, 229, 235, 218, 234, 215, 232, 210, 223, 171, 168, 170,
+    254, 169,   3, 188, 191, 193, 194, 255, 196,   0, 193, 255, 196,   3, 198, 199, 201, 203, 255, 198,  15, 201, 204, 208,
+    216, 220, 219, 221, 224, 227, 231, 236, 241, 243, 245, 247, 249, 255, 250,  13, 127,  90, 252,  16, 190,   0, 235,  79,
+    144,  38,  81,  75,  70, 115, 255,  30,  15, 189,  15, 115, 171, 250,  14, 225, 161,  60, 255,  47, 177,  28, 184, 149,
+     58, 255, 254,  16,  33,  87, 153, 238,  16, 203, 108, 107,  62, 151, 199,  19, 178,  27, 235,  50, 144, 255, 235,   1,
+    168, 170, 255, 171,   3, 172, 173, 174, 176, 255, 177,  23, 178, 179, 177, 166, 190, 229, 215, 229, 217, 218, 226, 219,
+    168, 227, 208, 228, 224, 234, 215, 231, 208, 221, 169, 167, 254, 168,   5, 167, 180, 193, 195, 196, 195, 255, 196,  21,
+    192, 197, 198, 200, 202, 201, 196, 198, 201, 205, 211, 220, 226, 224, 230, 235, 238, 241, 243, 244, 246, 248, 255, 249,
+     15, 250, 249, 103, 109, 216,  11, 193,  22, 252,  55, 174,  18, 149, 155, 197, 239, 255, 231,  69, 216, 166, 106,  23,
+    236,   0, 241, 138,  79, 236,  18, 211,   2, 201, 101,  95, 254, 236, 165, 143,   7, 194,   0, 239,  84, 139,  42, 169,
+    153,  59, 149,  41, 224,  19, 178, 235, 234, 170, 175, 179, 178, 170, 171, 173, 174, 172, 174, 175, 176, 174, 165, 170,
+    217, 226, 196, 198, 202, 194, 193, 166, 193, 178, 186, 185, 184, 177, 179, 172, 173, 167, 253, 166,   3, 167, 176, 198,
+    196, 255, 193,   5, 195, 198, 190, 192, 193, 190, 255, 192,  11, 195, 198, 202, 208, 212, 225, 227, 228, 237, 238, 241,
+    244, 255, 246, 255, 247,  16, 248, 250, 251, 249, 193,  19,  20, 153, 176,  53, 252,  27, 205, 123,  13,  35, 210, 254,
+    255,  17, 189,  24,  34, 119, 238,  28,  89, 218,  26,  17, 129, 218,   8,  23,  30, 217, 253, 232, 255,  37,  22,  67,
+    199,  22, 250,  56, 170, 140,  12,  31, 196, 118,  21,   6,  84, 235, 236, 235, 191, 184, 168, 170, 190, 186, 254, 183,
+      7, 173, 168, 169, 177, 164, 163, 165, 167, 255, 164, 254, 165,   0, 164, 252, 165, 253, 166,   0, 165, 255, 164,  26,
+    165, 166, 167, 170, 192, 189, 190, 194, 197, 200, 194, 193, 186, 187, 191, 197, 203, 201, 203, 206, 214, 223, 231, 230,
+    235, 238, 242, 255, 244,   1, 246, 248, 255, 249,   0, 250, 255, 251,   3, 250, 248, 246, 250, 255, 252, 255, 253, 255,
+    254,   2, 247, 253, 254, 255, 255, 255, 254,   1, 253, 250, 252, 255,   6, 253, 249, 254, 188,  43, 249, 252, 255, 254,
+    255, 253,   1, 247, 254, 255, 253,   0, 250, 255, 249,  20, 247, 241, 245, 247,  87, 131, 232, 238, 237, 236, 235, 170,
+    162, 161, 162, 163, 164, 163, 162, 164, 163, 255, 166,   0, 165, 255, 163,   1, 164, 165, 253, 168,   0, 167, 255, 164,
+      2, 165, 166, 167, 255, 166, 254, 165,   0, 176, 252, 190,   0, 191, 255, 187,   1, 193, 198, 255, 201,   4, 198, 197,
+    196, 197, 202, 255, 205, 255, 203,  13, 209, 223, 226, 231, 234, 238, 236, 238, 243, 246, 247, 248, 249, 250, 255, 251,
+      1, 252, 251, 255, 250, 255, 251,   0, 252, 254, 253, 254, 254, 255, 255, 255, 254, 248, 255, 255, 254,   1, 210, 160,
+    253, 254, 255, 253,   0, 254, 254, 253,   2, 252, 250, 249, 255, 247,   5, 245, 246, 155, 199, 240, 238, 255, 237,   6,
+    235, 166, 168, 169, 173, 176, 175, 255, 170,   7, 177, 180, 186, 189, 188, 182, 168, 161, 255, 162,  10, 163, 170, 179,
+    188, 183, 166, 182, 188, 189, 184, 176, 255, 166,   5, 164, 166, 167, 168, 167, 168, 255, 169,   3, 175, 191, 196, 198,
+    255, 201,  17, 200, 194, 199, 202, 206, 208, 207, 205, 206, 213, 215, 223, 232, 229, 227, 231, 240, 241, 255, 239,   4,
+    241, 244, 247, 248, 250, 254, 249,   1, 250, 251, 254, 252, 255, 253, 254, 254, 255, 255,   0, 254, 245, 255,   0, 254,
+    255, 255, 253, 254,   2, 253, 254, 253, 255, 252,   4, 253, 251, 249, 248, 247, 255, 246,  22, 245, 243, 240, 238, 236,
+    237, 235, 193, 191, 184, 178, 175, 180, 187, 191, 192, 193, 192, 196, 209, 214, 210, 164, 255, 161,  15, 179, 182, 178,
+    176, 168, 162, 172, 177, 178, 182, 184, 187, 185, 176, 174, 170, 255, 167,   9, 168, 169, 171, 175, 181, 187, 195, 194,
+    196, 197, 255, 195, 255, 199,   6, 200, 207, 208, 213, 220, 216, 220, 255, 228,   8, 234, 238, 240, 241, 242, 243, 245,
+    247, 248, 255, 249,   0, 250, 255, 251, 255, 252,   1, 253, 252, 254, 253, 254, 254, 255, 255,   0, 254, 245, 255,   0,
+    254, 254, 255, 252, 254,   2, 253, 252, 251, 255, 252,   2, 249, 248, 247, 255, 245,   4, 246, 243, 240, 238, 236, 255,
+    235,  11, 174, 177, 184, 194, 202, 207, 211, 215, 218, 221, 222, 218, 254, 210,   0, 176, 255, 160,   3, 190, 196, 170,
+    161, 255, 160,  16, 163, 166, 175, 194, 196, 191, 182, 179, 181, 184, 186, 185, 186, 189, 194, 198, 199, 255, 195,  18,
+    191, 183, 182, 185, 184, 188, 192, 198, 201, 203, 206, 211, 214, 217, 222, 223, 231, 240, 244, 255, 242,   3, 245, 246,
+    247, 248, 255, 249, 255, 250, 254, 251, 255, 252, 254, 253, 254, 254,   0, 255, 255, 254, 245, 255,   0, 254, 254, 255,
+    255, 254,   1, 253, 254, 255, 253,   0, 252, 255, 251,  10, 252, 250, 248, 247, 246, 245, 246, 243, 240, 238, 237, 255,
+    235,   4, 246, 247, 248, 249, 250, 255, 251, 254, 252,   2, 253, 254, 253, 249, 254, 255, 255, 255, 254,   1, 255, 254,
+    255, 255,   0, 254, 255, 253, 255, 254,   0, 255, 255, 254,   0, 255, 251, 254, 254, 253, 255, 252,   2, 247, 239, 244,
+    255, 249,   2, 248, 247, 246, 255, 245,   0, 242, 255, 243,   2, 241, 216, 238, 254, 241,   0, 240, 248, 239,   4, 231,
+    224, 221, 217, 211, 255, 206, 255, 207,  20, 208, 211, 212, 217, 214, 228, 220, 227, 240, 236, 233, 228, 219, 213, 211,
+    215, 220, 236, 218, 227, 229, 254, 226, 250, 225,  10, 224, 223, 220, 219, 223, 224, 245, 247, 248, 249, 251, 255, 252,
+    253, 253, 253, 254,   0, 255, 254, 254,   0, 255, 253, 254, 255, 255, 253, 254, 255, 253, 255, 255,   1, 254, 255, 250,
+    254, 253, 253,   3, 252, 248, 241, 250, 254, 251, 254, 250, 255, 249,   0, 247, 255, 248,   3, 247, 218, 226, 245, 255,
+    244,   3, 242, 241, 240, 239, 255, 238, 255, 237,   7, 236, 234, 227, 226, 223, 215, 209, 205, 254, 204,  12, 205, 207,
+    205, 204, 207, 221, 218, 226, 230, 238, 239, 231, 220, 255, 208,   5, 214, 224, 238, 218, 220, 231, 255, 227,   1, 226,
+    227, 251, 226,  10, 225, 224, 221, 219, 224, 226, 247, 248, 249, 250, 251, 255, 252, 253, 253, 252, 254, 253, 255,   2,
+    254, 255, 254, 255, 255,   1, 254, 255, 251, 254, 255, 255,   7, 254, 255, 254, 255, 254, 255, 254, 255, 253, 254,   3,
+    249, 245, 252, 253, 254, 252,   4, 251, 250, 249, 248, 247, 255, 245,   4, 244, 243, 225, 224, 241, 255, 239,   1, 238,
+    237, 255, 236, 252, 235,   7, 232, 228, 227, 223, 212, 206, 203, 202, 255, 201,  22, 203, 204, 210, 204, 212, 222, 209,
+    212, 219, 232, 239, 234, 222, 207, 206, 213, 230, 236, 216, 217, 228, 227, 225, 254, 224, 252, 223,  11, 222, 221, 218,
+    217, 222, 224, 245, 247, 248, 247, 229, 226, 255, 227, 250, 228, 248, 229, 255, 228,   0, 229, 252, 228,   1, 229, 228,
+    254, 229, 250, 228, 255, 227,   1, 225, 220, 253, 226, 255, 225,   0, 238, 255, 249,   1, 248, 247, 254, 246,   3, 245,
+    228, 218, 245, 255, 244,   0, 243, 255, 242, 254, 241, 255, 240,   9, 239, 229, 227, 226, 219, 210, 205, 203, 202, 200,
+    255, 201,  21, 200, 202, 204, 213, 220, 214, 209, 213, 226, 233, 235, 225, 207, 204, 212, 237, 236, 217, 220, 232, 225,
+    223, 248, 222,   9, 221, 219, 217, 222, 225, 249, 250, 251, 151,  15, 235,   7, 231,   6,   5,   7,  48, 239, 252, 251,
+    250, 255, 249,  10, 248, 245, 228, 215, 245, 244, 243, 241, 240, 239, 238, 255, 237,   0, 236, 255, 235,   5, 227, 220,
+    216, 210, 207, 203, 254, 201,  23, 202, 198, 199, 203, 204, 206, 213, 216, 215, 210, 215, 228, 230, 218, 204, 203, 212,
+    238, 235, 217, 223, 238, 227, 225, 255, 224, 250, 223,  10, 221, 219, 217, 222, 227, 247, 248, 249, 152,  86,  88, 252,
+     89, 242,  90,   1,  82,  14, 245,   0, 255,   1,   2,   9,   8,   1, 248,   0,   1,   4, 222, 255, 249,   1, 248, 245,
+    255, 246,   6, 242, 223, 211, 241, 242, 241, 240, 253, 239, 254, 238,   6, 235, 210, 218, 219, 206, 201, 199, 255, 200,
+      0, 205, 255, 198, 253, 199,   1, 201, 207, 255, 220,  13, 214, 221, 223, 210, 202, 201, 213, 239, 230, 216, 224, 239,
+    227, 223, 255, 221, 255, 220,   0, 221, 253, 220,  10, 219, 217, 215, 219, 224, 248, 249, 250, 218, 195, 244, 253, 252,
+    254, 253,   4, 252, 253, 252, 253, 254, 252, 253,   6, 252, 253, 254, 252,  82,   1,   0, 255,   1,   3,  15,  21,   5,
+      1, 254,   0,   7,   1,  20, 114, 198, 121,   1,   0,   1, 253,   2,   0,   1, 255,   0,   1,   4, 223, 255, 251,   7,
+    250, 249, 250, 248, 222, 209, 204, 215, 255, 246,   1, 245, 244, 255, 243, 254, 241,   6, 240, 237, 214, 204, 205, 203,
+    205, 254, 201,   3, 204, 197, 201, 199, 255, 200,   4, 199, 197, 200, 213, 224, 255, 215,  11, 217, 205, 199, 202, 218,
+    237, 219, 221, 224, 239, 230, 222, 250, 220,   7, 221, 220, 219, 218, 215, 220, 225, 249, 255, 250,  17, 105,   7, 216,
+    252, 253, 184, 176, 253, 254, 241, 141, 220, 147, 231, 249, 154, 204, 163, 255, 145,   1, 167, 250, 255, 255,  24,  86,
+      1,   2,  70, 181, 227, 231, 207,  95,   3,   0,   1,  66, 216, 252, 248, 146,   4,   8, 145, 169, 171, 175, 176,  51,
+    255,   0,   1,   4, 224, 255, 251,   0, 250, 255, 248,   7, 233, 213, 204, 202, 203, 212, 225, 241, 255, 239,   0, 238,
+    255, 237, 254, 236,  10, 220, 208, 210, 204, 214, 205, 199, 202, 203, 199, 204, 253, 201,  17, 199, 195, 201, 220, 215,
+    214, 213, 200, 198, 202, 219, 231, 213, 226, 224, 236, 227, 223, 248, 221,  29, 219, 217, 215, 219, 225, 247, 249, 250,
+    102,   1, 215, 252, 251, 107,  86, 252, 253, 225,   9, 190,  38, 171, 237,  22, 184,  50,  44,  77, 114, 246, 255, 255,
+     29,  85,   1,   4, 153, 251, 237, 242, 253, 247,  64,   2,  65, 236, 252, 187,  50,   1,   0,  12, 214, 239, 238, 237,
+    223,  42,   1,   0,   4, 217, 249, 255, 247,   4, 245, 237, 218, 217, 205, 255, 203,   4, 207, 230, 233, 242, 243, 255,
+    242, 255, 241,  10, 242, 241, 218, 215, 218, 221, 215, 204, 198, 205, 208, 255, 205,   0, 206, 253, 204,   8, 199, 201,
+    216, 218, 212, 210, 201, 199, 205, 255, 223,   1, 214, 228, 255, 232,   3, 224, 222, 221, 220, 252, 219, 254, 218,   3,
+    216, 213, 217, 223, 254, 251,  18, 103,   1, 216, 252, 253, 107,  84, 252, 254, 225,   9, 208,  76, 130, 212,  23, 218,
+     51, 143, 255, 254, 254, 255,   0,  85, 255,   1,  21,  30, 110,  40,  73, 254, 253, 122,  14, 208, 251, 197,  51,  28,
+      2,   1,  15, 231, 240, 133,  84,  74,  10, 255,   0,   9,   5, 198, 229, 232, 235, 232, 241, 218, 214, 204, 255, 202,
+      4, 205, 225, 217, 227, 243, 255, 242,   0, 241, 255, 240,  13, 235, 212, 218, 228, 223, 212, 201, 198, 201, 203, 202,
+    203, 213, 206, 254, 205,   5, 200, 202, 214, 212, 210, 207, 255, 201,   8, 208, 226, 212, 218, 223, 233, 231, 225, 224,
+    255, 221, 250, 220,  10, 219, 218, 214, 218, 225, 248, 249, 250, 102,   1, 215, 255, 252,  15, 107,  80, 252, 253, 225,
+      9, 212, 126,  83, 172,  48, 244,  51, 141, 248, 251, 254, 255,  24,  85,   1,   0,   1,  48, 101, 162, 254, 251,  78,
+     77, 251, 252, 247, 243, 240, 150,  11,  26, 245, 241, 135,  82,  16,   0, 255,   1,  15,   5, 201, 221, 217, 214, 213,
+    222, 219, 207, 204, 202, 201, 202, 215, 208, 221, 255, 240, 253, 239,  13, 225, 210, 220, 231, 222, 207, 200, 197, 198,
+    201, 200, 202, 211, 209, 255, 205,  17, 204, 201, 205, 213, 210, 208, 204, 201, 202, 214, 223, 208, 219, 217, 233, 234,
+    224, 226, 254, 221, 252, 220,   6, 219, 218, 217, 213, 216, 224, 250, 255, 251,  21, 103,   1, 216, 253, 252, 107,  77,
+    253, 254, 225,   9, 211, 176,  49, 133,  95, 253,  50,  22,  38, 141, 253, 255, 255,   5,  85,   1,   0,   1, 120, 252,
+    255, 253,  28, 180,  11, 135, 253, 254, 214, 196, 250, 252, 105,  42, 244, 241, 243, 251, 206,  34,   2,   1,   6, 222,
+    246, 235, 228, 226, 221, 214, 207, 204, 254, 202,   3, 219, 215, 233, 245, 254, 244,   8, 243, 238, 213, 207, 205, 226,
+    218, 205, 200, 255, 198,  25, 200, 199, 200, 202, 206, 207, 205, 203, 204, 209, 210, 208, 205, 202, 203, 204, 212, 218,
+    208, 214, 218, 232, 238, 226, 227, 219, 250, 218,  30, 217, 216, 214, 212, 214, 222, 249, 250, 251, 102,   1, 216, 252,
+    251, 107,  73, 252, 253, 225,   9, 210, 215,  32,  69, 149, 253,  51, 114, 201, 226, 254, 255, 255,  36,  84,   1,   0,
+      1,  61, 118, 168, 254, 250, 109, 149, 254, 247,  43,  12, 195, 248, 164,  32, 112,  92, 148, 254, 252, 130,   3,   2,
+      7, 225, 253, 252, 251, 246, 228, 217, 210, 204, 254, 202,   3, 233, 223, 239, 241, 255, 240, 255, 239,   9, 233, 206,
+    201, 203, 223, 217, 207, 204, 200, 199, 253, 200,   4, 202, 203, 204, 205, 207, 255, 208,  14, 205, 206, 207, 204, 207,
+    211, 214, 209, 210, 216, 230, 236, 231, 230, 221, 249, 220,   5, 218, 216, 213, 215, 224, 248, 255, 250,   2, 102,   1,
+    216, 255, 252,  15, 107,  70, 252, 253, 225,   9, 211, 247,  39,  12, 199, 253,  51, 142, 253, 254, 254, 255,   1,  84,
+      1, 255,   0,  14,   1,   3,  34, 252, 254, 182, 110, 253, 250,  63,  19, 206, 252, 150,   2, 255,   3,  20,   7, 239,
+    252, 150,   3,   2,   7, 224, 251, 250, 249, 247, 241, 226, 213, 204, 202, 201, 202, 213, 236, 255, 243, 254, 242, 255,
+    241,   1, 232, 220, 255, 223,   4, 215, 208, 212, 204, 200, 255, 201, 254, 202,   4, 201, 203, 206, 210, 212, 255, 207,
+     13, 209, 213, 210, 207, 213, 209, 208, 206, 211, 225, 229, 232, 233, 221, 255, 220, 253, 219,   7, 218, 217, 216, 215,
+    212, 214, 222, 251, 255, 252,  21, 103,   1, 216, 253, 252, 108,  42, 151, 154, 215,   9, 211, 252,  87,  22, 240, 253,
+     51,  86, 150, 171, 250, 255, 255,  29,  84,   1,   2,  34,  39,  65, 181, 254, 253, 129,  30, 225, 252, 226, 207, 253,
+    238,  55,  15,  12,  20, 113, 253, 249,  93,   4,   3,   8, 225, 253, 255, 252,   4, 251, 252, 239, 221, 205, 255, 202,
+      2, 208, 243, 247, 255, 246, 255, 245, 253, 243,   7, 241, 218, 210, 200, 214, 216, 207, 202, 255, 203,  23, 204, 205,
+    204, 205, 210, 224, 226, 215, 210, 214, 219, 215, 216, 207, 214, 209, 208, 207, 209, 222, 220, 225, 227, 220, 255, 219,
+    252, 218,  11, 217, 216, 215, 211, 213, 221, 248, 249, 250, 102,   1, 216, 255, 252,   0, 139, 255,  60,   6,  66, 211,
+     62, 220, 253, 163, 102, 255, 254,  12,  91,  56,  55,  95, 246, 255, 254,  83,   1,   9, 191, 237, 246, 255, 252,  16,
+    168,  16,   1,  46, 172, 234, 238, 186,  62,   4, 101, 225, 229, 248, 252, 167,  13, 255,   4,   4,   9, 224, 252, 251,
+    250, 255, 248,   8, 233, 212, 206, 203, 201, 202, 216, 242, 241, 255, 240, 253, 239, 255, 240,   0, 230, 255, 219,   6,
+    222, 217, 209, 203, 204, 205, 208, 255, 213,  12, 215, 224, 229, 221, 210, 211, 216, 229, 227, 211, 208, 212, 209, 255,
+    208,   5, 210, 217, 216, 219, 224, 222, 254, 221, 253, 220,   6, 219, 218, 216, 213, 214, 223, 251, 255, 252,   4, 103,
+      1, 215, 252, 253, 253, 252,   5, 254, 252, 253, 254, 253, 252, 255, 254, 253, 252, 254, 254,   8,  83,   1,   2, 112,
+    179, 177, 148,  69,   4, 255,   0, 255,   1,   1,   3,   5, 254,   2,  10,  36, 207, 211, 179,  96,   8,   5,   4,   5,
+     10, 224, 255, 251,   6, 250, 249, 250, 221, 209, 205, 203, 255, 201,   0, 204, 253, 246, 251, 245,   8, 240, 225, 219,
+    223, 218, 209, 205, 207, 213, 255, 222,  11, 214, 215, 228, 232, 224, 210, 208, 213, 229, 237, 225, 216, 255, 219,   0,
+    216, 255, 215,   4, 217, 213, 219, 223, 222, 255, 220, 254, 219, 254, 218,   1, 216, 215, 255, 212,   1, 220, 249, 255,
+    250,   3, 103,   1,  91, 138, 252, 139, 244, 140,   4, 145, 237,  82,   1,   0, 254,   1,   1,   2,   1, 251,   0, 255,
+      1,   0,   0, 255,   1,   1,   7,   9, 253,   4,   3,   5,   6,  12, 226, 255, 253,   6, 252, 251, 252, 222, 209, 205,
+    203, 255, 201,   2, 202, 243, 245, 255, 244, 255, 243, 253, 242,   9, 240, 222, 220, 222, 216, 208, 210, 218, 219, 214,
+    255, 212,  11, 218, 230, 236, 217, 210, 209, 210, 221, 226, 215, 223, 232, 255, 234,   6, 235, 233, 223, 213, 221, 222,
+    223, 255, 221,   0, 220, 254, 219, 255, 218,   1, 217, 215, 255, 212,   1, 219, 250, 255, 251,   0, 109, 236,   2,   3,
+     13, 217,  82,   2, 246,   1, 254,   2,   1,   1,   2, 254,   3,   7,   4,   5,   6,   7,   8,   9,  20, 227, 255, 250,
+      6, 249, 247, 248, 222, 210, 207, 203, 254, 202,   0, 237, 254, 242,   0, 241, 255, 242, 255, 241, 255, 242,  14, 230,
+    226, 219, 211, 209, 213, 214, 211, 210, 211, 212, 217, 228, 223, 212, 255, 211,   6, 212, 215, 214, 215, 217, 227, 231,
+    254, 233,   0, 236, 255, 227,   1, 226, 224, 255, 223, 255, 222, 254, 221,   5, 220, 219, 217, 214, 213, 221, 255, 251,
+      5, 252, 212, 113, 103, 104, 103, 255, 102,   1, 103, 104, 255, 105, 254, 106,   0, 107, 253, 106, 254, 107,   2, 112,
+    232, 153, 255, 108, 255, 107, 252, 108,   2, 107, 108, 107, 255, 108,   0, 107, 253, 108, 255, 109, 255, 110,   0, 111,
+    255, 112,   1, 156, 250, 254, 252, 255, 251,   3, 224, 210, 207, 204, 254, 203,   1, 238, 248, 254, 247, 254, 246, 254,
+    245,   5, 236, 222, 213, 210, 212, 213, 254, 212, 255, 213,   3, 214, 217, 214, 213, 255, 214, 253, 215,   6, 216, 223,
+    224, 229, 231, 232, 233, 255, 235,   2, 226, 223, 222, 255, 221, 255, 220,   0, 219, 255, 218,   7, 216, 215, 212, 211,
+    217, 248, 249, 250, 255, 251,   3, 252, 253, 250, 248, 255, 249,   1, 251, 252, 253, 254,   0, 253, 254, 254, 255, 255,
+      2, 254, 255, 254, 254, 255, 253, 254, 253, 255, 255, 254,   2, 255, 254, 255, 245, 254, 255, 253, 255, 252,   7, 251,
+    250, 251, 226, 211, 207, 205, 204, 255, 203,   1, 232, 244, 254, 243, 255, 242, 253, 241,   6, 239, 225, 215, 216, 226,
+    230, 222, 254, 214,   0, 215, 255, 216,   0, 215, 255, 216, 254, 217, 255, 216,   4, 219, 222, 223, 230, 229, 255, 230,
+      4, 232, 236, 232, 224, 223, 255, 222,   0, 221, 255, 220, 255, 219,   5, 218, 216, 213, 211, 217, 251, 255, 252, 255,
+    253,   2, 254, 253, 247, 255, 248,   2, 249, 250, 251, 255, 252,   0, 253, 255, 254, 254, 255, 254, 254, 254, 255, 250,
+    254, 255, 255, 255, 254, 254, 255, 253, 254,   0, 253, 255, 254, 254, 253, 253, 252, 253, 251, 255, 249,   3, 227, 211,
+    208, 205, 255, 204,   2, 205, 233, 246, 253, 245, 252, 244,   7, 243, 230, 221, 224, 239, 241, 238, 219, 255, 217,   1,
+    218, 220, 253, 219,   5, 218, 219, 218, 217, 215, 218, 255, 223,   2, 229, 230, 229, 255, 227,   5, 233, 235, 232, 226,
+    225, 224, 255, 223, 255, 222,   7, 221, 220, 217, 214, 213, 218, 248, 249, 255, 250,  10, 251, 252, 250, 246, 252, 249,
+    248, 250, 251, 252, 253, 255, 254,   0, 255, 253, 254, 255, 255,   1, 254, 255, 251, 254, 254, 255, 255, 254, 255, 255,
+    255, 254,   0, 255, 249, 254,   0, 253, 255, 254, 251, 253,  10, 251, 252, 235, 211, 208, 206, 205, 206, 207, 244, 249,
+    255, 248, 255, 247, 255, 246, 254, 245,  12, 243, 231, 222, 225, 239, 241, 240, 229, 222, 221, 222, 224, 223, 254, 221,
+      2, 219, 221, 220, 254, 217, 255, 224,   2, 227, 229, 230, 255, 226,   6, 230, 232, 236, 230, 224, 223, 222, 255, 221,
+      6, 220, 219, 217, 216, 213, 211, 216, 255, 250,   0, 251, 255, 252,   9, 253, 247, 248, 254, 253, 248, 250, 251, 252,
+    254, 255, 255, 255, 254,   1, 253, 254, 249, 255, 255, 254,   0, 253, 255, 255, 253, 254,   0, 255, 250, 254, 253, 253,
+    253, 252, 253, 251,   5, 250, 248, 249, 245, 219, 208, 255, 207,   2, 208, 224, 244, 252, 243, 253, 242,   9, 241, 240,
+    231, 224, 227, 238, 240, 239, 238, 230, 255, 226,   1, 227, 225, 255, 223,   3, 222, 221, 223, 222, 254, 219,  11, 224,
+    225, 226, 229, 230, 227, 231, 229, 224, 233, 237, 231, 255, 227,   1, 224, 222, 255, 221,   6, 219, 218, 216, 213, 217,
+    249, 250, 255, 251,   3, 252, 251, 242, 251, 255, 253,   1, 248, 252, 252, 254, 255, 253,   0, 254, 254, 255, 251, 254,
+    254, 253,   0, 255, 247, 254, 251, 253,   1, 252, 253, 250, 252,   0, 251, 254, 250,   4, 246, 230, 226, 230, 239, 251,
+    248, 255, 247, 253, 246,   4, 244, 234, 226, 228, 241, 254, 243,   1, 242, 231, 255, 229,   6, 225, 224, 225, 224, 222,
+    225, 224, 254, 221,   5, 225, 226, 225, 229, 231, 230, 255, 231,  26, 223, 227, 233, 237, 239, 236, 233, 230, 225, 222,
+    221, 219, 217, 213, 218, 247, 248, 249, 250, 251, 247, 243, 252, 253, 251, 247, 253, 253, 254,   1, 252, 253, 255, 254,
+    255, 255, 252, 254, 255, 255, 254, 253, 254, 254, 255, 255, 242, 254, 254, 253, 253, 252,   0, 250, 255, 251, 255, 250,
+    254, 249, 255, 248,   0, 247, 254, 246, 254, 245, 254, 244,   4, 243, 235, 228, 230, 240, 253, 242,   2, 233, 231, 229,
+    255, 227,   5, 226, 225, 224, 227, 226, 222, 255, 224,   3, 226, 227, 226, 229, 254, 231,  15, 232, 230, 222, 231, 234,
+    238, 233, 229, 226, 223, 221, 220, 218, 216, 213, 215, 255, 251, 254, 252,   1, 241, 247, 255, 253,   1, 247, 250, 254,
+    254,   6, 252, 251, 253, 254, 255, 254, 255, 249, 254,   4, 253, 252, 253, 254, 255, 251, 254, 255, 253,   0, 254, 251,
+    253, 254, 252, 254, 251, 254, 250,   0, 249, 254, 247,   1, 248, 247, 254, 246, 254, 245, 248, 244,   4, 243, 236, 230,
+    231, 241, 254, 243,  11, 242, 228, 229, 230, 229, 231, 226, 227, 226, 229, 228, 225, 255, 226, 255, 227,   1, 228, 229,
+    254, 231,   8, 233, 232, 225, 229, 233, 236, 233, 227, 225, 255, 224,   6, 222, 220, 218, 215, 217, 247, 248, 255, 249,
+      6, 247, 238, 250, 251, 250, 243, 250, 255, 251,   2, 249, 250, 253, 248, 254,   0, 255, 254, 254,   2, 252, 251, 252,
+    238, 254, 249, 253, 253, 252, 254, 251, 254, 250, 253, 249, 253, 248, 255, 247,   5, 246, 239, 232, 233, 243, 246, 255,
+    245,   3, 237, 229, 230, 231, 255, 232,   5, 227, 230, 228, 230, 229, 227, 255, 228,   1, 229, 228, 255, 229, 255, 231,
+    255, 232,  18, 233, 227, 226, 233, 234, 236, 234, 230, 228, 227, 226, 223, 219, 216, 217, 250, 251, 252, 245, 255, 242,
+    255, 253,   1, 248, 243, 255, 248,   1, 247, 248, 255, 249,   0, 251, 254, 254, 255, 255, 255, 254, 255, 255, 254, 254,
+      6, 253, 251, 252, 254, 255, 254, 255, 250, 254, 254, 253,   0, 254, 254, 253, 251, 252,   0, 251, 255, 250, 253, 249,
+      0, 248, 253, 247, 255, 246, 252, 245,   0, 244, 255, 245, 255, 244,   3, 238, 233, 235, 241, 254, 244,   5, 234, 231,
+    233, 234, 235, 232, 255, 231,   0, 230, 255, 231,   3, 230, 231, 230, 231, 255, 229,   1, 230, 231, 254, 233,   4, 234,
+    229, 226, 232, 234, 255, 235,   5, 230, 228, 232, 229, 221, 219, 255, 216,  12, 248, 249, 250, 245, 233, 247, 248, 245,
+    240, 245, 249, 245, 247, 253, 248,   0, 250, 246, 254,   0, 252, 255, 251, 253, 254,   1, 253, 254, 249, 253, 253, 252,
+      1, 251, 252, 254, 251, 253, 250,   0, 248, 255, 249, 252, 248, 245, 247,   4, 246, 241, 235, 236, 244, 255, 246,   0,
+    244, 254, 233,   2, 235, 236, 232, 255, 233,   0, 232, 253, 233, 254, 232,   2, 230, 231, 232, 255, 234, 255, 233,   2,
+    231, 225, 231, 255, 234,   6, 235, 232, 228, 227, 226, 223, 221, 255, 218,  10, 238, 245, 247, 241, 232, 244, 238, 240,
+    239, 250, 248, 254, 246, 254, 247,   1, 248, 251, 252, 254,   0, 253, 253, 254,   2, 251, 249, 250, 251, 254, 254, 253,
+    255, 254,   0, 253, 252, 254, 250, 253, 255, 252, 252, 251, 254, 250, 255, 249, 254, 248,   1, 247, 248, 250, 247,   3,
+    242, 237, 238, 244, 255, 246,   3, 245, 236, 235, 234, 252, 235,   1, 234, 236, 254, 235, 254, 234, 255, 232,   0, 233,
+    254, 234, 255, 233,   1, 228, 230, 254, 234,   1, 235, 229, 255, 226,   1, 224, 221, 255, 218,  10, 229, 231, 244, 232,
+    239, 240, 236, 237, 240, 247, 242, 254, 245,   0, 244, 255, 245,   2, 246, 247, 253, 251, 254,   5, 253, 254, 253, 250,
+    248, 249, 253, 253,   3, 252, 250, 247, 246, 253, 252, 253, 251, 253, 250, 255, 249, 254, 248, 255, 247, 253, 246, 251,
+    245,   0, 244, 249, 245,   5, 246, 245, 241, 238, 239, 244, 254, 246,   0, 244, 253, 237, 255, 238,   1, 237, 236, 254,
+    238,   0, 237, 255, 236,  12, 235, 234, 233, 234, 235, 236, 235, 233, 234, 230, 231, 234, 235, 254, 234,   6, 227, 225,
+    223, 222, 219, 218, 227, 255, 232,   7, 226, 236, 239, 235, 233, 240, 239, 242, 252, 243, 255, 244,   1, 245, 250, 248,
+    252,  11, 249, 247, 248, 251, 252, 251, 249, 247, 246, 244, 241, 251, 249, 250, 247, 249,   1, 248, 249, 251, 248,   0,
+    247, 255, 248, 251, 247,   0, 248, 255, 247,   4, 248, 244, 240, 241, 246, 255, 248,   2, 247, 248, 240, 254, 239, 255,
+    240,   5, 239, 238, 239, 240, 239, 238, 254, 237,   3, 236, 234, 236, 235, 255, 236,   4, 234, 235, 229, 232, 234, 254,
+    235,  11, 236, 231, 227, 225, 224, 220, 219, 225, 233, 229, 225, 230, 255, 236,   3, 232, 237, 238, 240, 255, 241, 255,
+    242,   3, 243, 244, 245, 246, 250, 248, 253, 247, 254, 246,   7, 247, 246, 245, 243, 241, 239, 236, 240, 255, 238,   1,
+    236, 235, 255, 233,   5, 231, 230, 229, 228, 227, 226, 251, 225,   0, 227, 255, 226,   5, 227, 228, 229, 230, 232, 236,
+    254, 239,   1, 238, 237, 255, 238, 255, 239,   0, 240, 253, 241,   0, 242, 255, 243, 254, 244,   2, 242, 241, 240, 255,
+    241,   1, 242, 241, 255, 240, 254, 241, 254, 239,   9, 238, 236, 237, 236, 238, 237, 236, 235, 229, 233, 251, 235,  19,
+    226, 222, 220, 218, 216, 224, 226, 220, 227, 230, 232, 229, 231, 236, 241, 245, 247, 249, 250, 252, 254, 253,   1, 252,
+    248, 249, 246, 254, 245, 254, 244,   2, 242, 240, 239, 255, 237,  11, 235, 238, 236, 235, 233, 232, 231, 229, 228, 227,
+    226, 225, 255, 224, 250, 223,   7, 224, 225, 226, 227, 228, 231, 239, 240, 254, 241,   5, 243, 242, 239, 238, 239, 240,
+    255, 241, 255, 242, 255, 243, 255, 244, 253, 245,   3, 244, 242, 243, 242, 255, 243,   2, 241, 242, 243, 255, 242,   6,
+    241, 240, 241, 240, 237, 239, 237, 254, 238,   3, 236, 229, 233, 235, 255, 236, 254, 235,  15, 231, 223, 220, 219, 217,
+    224, 223, 219, 225, 227, 230, 228, 238, 249, 252, 253, 255, 252,   3, 254, 252, 250, 247, 255, 245,   0, 244, 251, 245,
+    255, 244, 254, 243, 255, 242,   9, 240, 239, 237, 236, 235, 234, 233, 235, 234, 233, 255, 231,   3, 230, 228, 227, 226,
+    255, 225, 255, 224, 252, 223, 255, 224,   6, 225, 226, 227, 228, 230, 238, 235, 254, 234,   1, 236, 238, 254, 240, 255,
+    241,   0, 242, 255, 243, 255, 244, 254, 245, 252, 246,   9, 244, 245, 243, 245, 244, 243, 244, 243, 244, 243, 255, 242,
+      1, 241, 242, 251, 239,  16, 237, 231, 232, 234, 237, 236, 237, 236, 235, 233, 228, 222, 220, 219, 222, 218, 220, 255,
+    224,   4, 226, 227, 235, 237, 238, 255, 239,   2, 241, 245, 243, 253, 242, 250, 243, 254, 242, 255, 241, 255, 240,   5,
+    238, 236, 235, 234, 233, 232, 255, 231,   8, 232, 230, 229, 228, 227, 226, 225, 224, 223, 254, 222,   0, 221, 253, 222,
+    255, 223,   3, 224, 225, 227, 228, 255, 233,  10, 231, 232, 233, 239, 242, 236, 237, 238, 240, 241, 242, 255, 243, 255,
+    244,   0, 245, 254, 246, 251, 247,   2, 246, 245, 246, 251, 245, 255, 244, 255, 243,   0, 240, 255, 241, 254, 240,   0,
+    238, 255, 233,  12, 235, 237, 238, 237, 236, 235, 234, 231, 223, 220, 218, 220, 213, 255, 221,   2, 224, 221, 228, 255,
+    233,   4, 235, 236, 237, 238, 239, 255, 240, 253, 241,   1, 242, 241, 255, 242, 255, 241, 255, 240,   0, 239, 255, 237,
+      1, 236, 235, 255, 234,   1, 233, 232, 254, 230,   1, 228, 229, 255, 224, 255, 225,   2, 224, 223, 222, 254, 221,   3,
+    222, 225, 223, 219, 255, 220,  16, 222, 223, 224, 225, 226, 228, 233, 231, 233, 246, 239, 254, 251, 243, 241, 238, 240,
+    255, 242,   1, 243, 244, 255, 245, 255, 246, 253, 247, 253, 248, 255, 246, 254, 247, 253, 246, 255, 245,   1, 244, 245,
+    254, 242,   3, 240, 242, 241, 239, 255, 235,   0, 236, 254, 238, 255, 237,   7, 234, 232, 227, 220, 218, 217, 215, 218,
+    255, 223,   7, 220, 228, 231, 230, 233, 234, 235, 236, 255, 237, 255, 238, 253, 239,   6, 240, 239, 240, 239, 238, 239,
+    238, 255, 235, 254, 234, 255, 233,   9, 231, 229, 230, 228, 227, 225, 227, 222, 221, 222, 255, 223, 255, 221, 255, 220,
+     12, 222, 230, 227, 219, 218, 220, 222, 223, 224, 226, 227, 229, 230, 254, 232,   4, 238, 241, 255, 252, 242, 255, 240,
+      0, 241, 255, 243, 254, 245, 255, 246,   0, 247, 253, 248, 255, 249, 255, 248,   2, 247, 248, 249, 255, 248, 255, 247,
+      0, 248, 255, 247,   9, 246, 245, 246, 243, 242, 244, 242, 243, 242, 240, 255, 237,   0, 236, 255, 238,  20, 239, 238,
+    237, 235, 233, 231, 222, 218, 206, 215, 222, 224, 218, 221, 228, 230, 229, 232, 233, 234, 235, 255, 236, 255, 237, 250,
+    238, 254, 237,   0, 235, 254, 234,   4, 235, 234, 235, 231, 228, 255, 227,   8, 226, 225, 223, 224, 220, 219, 218, 222,
+    221, 254, 220,   0, 219, 255, 220,  10, 217, 216, 219, 220, 222, 202, 225, 226, 213, 223, 231, 255, 233,   5, 232, 235,
+    243, 254, 253, 240, 255, 241,   4, 242, 243, 225, 245, 246, 255, 247, 254, 248, 252, 249,   2, 248, 249, 248, 253, 249,
+    253, 248, 255, 247,   2, 246, 247, 245, 255, 244, 254, 243,   3, 242, 239, 237, 236, 255, 225,  15, 223, 234, 237, 236,
+    234, 231, 226, 219, 205, 216, 218, 219, 214, 222, 225, 227, 255, 229,   2, 230, 231, 232, 255, 233, 255, 234, 250, 235,
+    255, 234,   1, 233, 232, 252, 230,   1, 229, 228, 255, 226,   1, 225, 223, 255, 222,   4, 221, 218, 216, 215, 219, 253,
+    218,   0, 217, 255, 215,  10, 213, 215, 218, 220, 222, 130, 186, 224, 101, 227, 232, 254, 233,   4, 236, 243, 254, 252,
+    240, 255, 242,   3, 243, 237, 140, 246, 255, 247, 255, 248,   0, 162, 255, 249, 253, 250, 254, 249, 255, 250, 251, 249,
+      4, 218, 192, 248, 247, 246, 254, 245, 255, 244,   1, 243, 240, 255, 239,  18, 158, 187, 157, 211, 237, 236, 235, 233,
+    229, 222, 207, 217, 218, 216, 215, 223, 225, 226, 228, 255, 229, 255, 231,   0, 232, 255, 233, 254, 234,   0, 235, 252,
+    234, 255, 233,   2, 230, 227, 228, 254, 227,   1, 226, 225, 255, 224,   0, 222, 255, 221,   5, 219, 218, 219, 214, 213,
+    218, 255, 219, 254, 218, 255, 215,  77, 214, 216, 217, 220, 222, 211, 106, 131, 192, 230, 159, 117, 171, 234, 159, 237,
+    188, 225, 163, 142, 174, 245, 228, 184, 221, 137, 122, 195, 219,  62, 150, 250, 169, 125, 189, 250, 150, 109, 227, 133,
+    127, 178, 250, 201, 126, 154, 250, 110,  97, 223, 249, 239, 142, 108, 238, 133, 132, 158, 241, 170, 121,  87, 216, 160,
+    238, 194, 119, 140, 233, 230, 225, 209, 214, 216, 211, 217, 221, 222, 255, 224,   2, 226, 227, 228, 255, 229, 255, 230,
+    249, 231, 254, 230,   0, 227, 253, 224,   0, 223, 254, 222,   1, 221, 220, 255, 219,   4, 217, 216, 218, 212, 211, 252,
+    216,   1, 217, 215, 255, 214,  47, 216, 217, 220, 222, 224, 104, 128, 229, 192, 134, 234,  98, 234, 108, 237, 121, 228,
+     94, 210, 245, 246, 193, 166, 180, 156, 246, 104, 250, 119, 251, 207, 151, 251, 110, 243,  77, 246, 212, 126, 251, 102,
+    247, 111, 250, 125, 234, 150, 219, 255, 249,  20, 210, 103, 246, 139, 199, 213, 100, 219, 112, 239,  68, 238, 108, 235,
+    100, 236, 128, 204, 231, 227, 208, 255, 213,   8, 207, 217, 219, 221, 222, 223, 224, 225, 226, 255, 227, 255, 228, 254,
+    229, 254, 230, 254, 229,   3, 228, 227, 224, 222, 254, 221,   1, 220, 217, 254, 219,   0, 218, 255, 217,   6, 216, 214,
+    215, 210, 209, 216, 217, 255, 216, 255, 217,  39, 215, 214, 213, 216, 218, 220, 223, 225, 125, 206, 231, 143, 194, 235,
+    105, 215, 131, 240, 110, 243, 110, 244, 245, 246, 164, 197, 150, 210, 250, 115, 250, 117, 251, 155, 120, 140, 136, 212,
+    153, 252, 255, 182,   8, 252, 116, 216,  85, 139, 119, 239, 120, 246, 255, 250,  30, 180, 181, 248, 113, 247, 219, 132,
+    173, 180, 242, 103, 240, 109, 204, 140, 237, 133, 208, 232, 228, 206, 213, 206, 209, 217, 219, 220, 221, 222, 223, 224,
+    255, 225,   1, 226, 227, 248, 228, 255, 227,   1, 226, 222, 255, 218, 254, 217,   3, 215, 218, 214, 217, 255, 215, 255,
+    214,   3, 213, 212, 210, 207, 255, 215,   0, 216, 254, 217,  21, 215, 214, 213, 217, 219, 221, 223, 225, 103, 228, 231,
+    150, 175, 212, 116, 202, 125, 229,  86, 247, 110, 246, 255, 247,  12, 135, 227, 119, 241, 233, 129, 246, 102, 251, 164,
+    195, 233, 194, 255, 183,  47, 253, 152, 213, 252, 114, 224, 133, 248, 177, 252, 107, 243, 251, 250, 150, 210, 249, 105,
+    234, 139, 163, 177, 158, 214,  80, 240, 111, 211, 119, 232,  99, 235, 233, 229, 204, 207, 200, 208, 213, 215, 216, 217,
+    218, 219, 220, 221, 222, 223, 254, 224,   4, 225, 224, 225, 224, 225, 253, 224,   3, 222, 219, 216, 215, 255, 214,   4,
+    213, 212, 217, 212, 215, 255, 214, 255, 212,   5, 211, 210, 211, 204, 212, 213, 255, 214,   1, 215, 216, 254, 214,  47,
+    217, 220, 222, 224, 226, 169, 230, 232, 229, 133, 136, 229, 239, 145, 144, 175, 244, 180, 246, 247, 248, 185, 249, 183,
+    250, 231, 204, 251, 158, 206, 246, 141, 146, 243, 208, 230, 253, 192, 245, 249, 188, 253, 167, 134, 222, 252, 202, 162,
+    255, 251,  29, 190, 242, 249, 218, 128, 161, 217, 243, 141, 151, 175, 236, 183, 240, 160, 124, 210, 236, 233, 230, 204,
+    200, 199, 213, 214, 216, 217, 218, 219, 220, 255, 221,   2, 222, 223, 222, 253, 223, 255, 222, 254, 221,   4, 219, 218,
+    217, 214, 210, 255, 209,   4, 208, 209, 208, 210, 211, 255, 212, 255, 211, 255, 210,   3, 209, 211, 202, 213, 254, 215,
+    255, 217,  12, 215, 214, 213, 217, 220, 222, 224, 227, 229, 231, 232, 234, 236, 255, 238,   0, 240, 255, 241,   5, 243,
+    244, 245, 247, 248, 249, 254, 250, 255, 251, 252, 252,   1, 253, 252, 255, 253,   0, 254, 253, 253, 255, 252, 255, 253,
+      3, 252, 253, 252, 251, 255, 252,   0, 251, 254, 250, 255, 248,   4, 246, 245, 246, 244, 243, 255, 242,  13, 241, 240,
+    238, 237, 236, 234, 231, 203, 194, 200, 209, 210, 211, 212, 255, 214, 255, 216, 255, 218,   0, 210, 255, 209, 251, 208,
+      4, 207, 208, 207, 206, 205, 254, 204, 255, 203,   3, 202, 204, 208, 204, 255, 211, 251, 209,  27, 201, 210, 212, 213,
+    214, 215, 216, 214, 215, 214, 218, 221, 223, 225, 227, 229, 231, 233, 235, 237, 238, 239, 241, 242, 243, 244, 245, 246,
+    255, 248,   0, 249, 255, 250, 254, 251, 255, 252,   0, 253, 255, 252, 254, 253,   0, 254, 255, 253, 255, 254, 251, 253,
+    252, 252, 255, 251, 255, 250, 255, 249,   0, 247, 255, 246,   1, 245, 244, 255, 242,   1, 241, 240, 255, 238,  16, 236,
+    234, 232, 197, 191, 204, 209, 210, 211, 212, 213, 214, 215, 216, 217, 215, 205, 246, 204,   0, 203, 255, 202, 255, 201,
+      6, 200, 199, 200, 201, 205, 202, 204, 255, 208,   1, 207, 208, 255, 207,  23, 206, 204, 210, 212, 213, 214, 215, 216,
+    214, 215, 214, 217, 221, 223, 225, 227, 230, 231, 234, 235, 237, 239, 240, 242, 255, 243,   0, 244, 255, 247,   1, 248,
+    249, 254, 250,   0, 251, 253, 252, 253, 253, 255, 254,   1, 253, 254, 253, 253,   1, 254, 253, 255, 254, 255, 253, 255,
+    254, 255, 253,   0, 252, 254, 251,   3, 250, 249, 247, 246, 255, 245,   2, 244, 242, 241, 255, 240,  14, 239, 238, 237,
+    235, 232, 190, 193, 206, 207, 208, 209, 210, 211, 212, 213, 255, 214,  18, 213, 202, 201, 204, 205, 202, 205, 203, 204,
+    203, 201, 204, 207, 204, 202, 206, 202, 206, 204, 255, 198,   5, 199, 203, 200, 198, 206, 207, 255, 206,   0, 207, 255,
+    206,   1, 208, 210, 255, 213,  26, 214, 215, 216, 214, 215, 214, 218, 221, 224, 226, 228, 230, 232, 234, 236, 238, 239,
+    241, 242, 243, 244, 245, 248, 247, 248, 249, 250, 255, 251, 255, 252, 253, 253, 254, 254,   0, 253, 254, 254,   0, 253,
+    254, 254, 253, 253, 252, 254,   1, 253, 252, 254, 251,   3, 250, 249, 248, 247, 254, 245,   2, 243, 242, 241, 255, 240,
+      7, 239, 237, 235, 232, 187, 195, 202, 204, 255, 205,   3, 206, 207, 208, 209, 255, 210,   0, 209, 255, 199,   2, 207,
+    206, 205, 255, 206,  17, 204, 202, 198, 204, 207, 204, 200, 205, 200, 204, 199, 197, 195, 196, 200, 198, 195, 201, 254,
+    205, 254, 206, 255, 208,   4, 210, 211, 212, 213, 215, 254, 214,  17, 218, 222, 224, 226, 228, 231, 233, 235, 237, 238,
+    240, 241, 242, 243, 245, 246, 249, 248, 254, 250, 255, 251, 255, 252, 254, 253, 247, 254,   1, 212, 225, 248, 254, 254,
+    253,   5, 252, 251, 250, 150, 162, 247, 254, 246,  11, 244, 243, 242, 241, 240, 239, 238, 236, 233, 187, 199, 204, 255,
+    205,   1, 206, 207, 255, 208,   0, 209, 255, 210,  10, 209, 197, 198, 204, 202, 205, 203, 207, 204, 200, 196, 255, 202,
+     13, 205, 197, 203, 198, 202, 200, 195, 193, 194, 199, 196, 194, 196, 204, 255, 205, 254, 206,   6, 207, 210, 211, 212,
+    214, 215, 216, 255, 214,   6, 215, 218, 222, 225, 227, 229, 232, 255, 235,   4, 237, 239, 242, 243, 246, 255, 247,   0,
+    248, 255, 250,   6, 242, 202, 240, 252, 216, 229, 210, 255, 253,   3, 227, 210, 254, 253, 254, 254,  13, 245, 204, 240,
+    241,  64, 135, 246, 250, 205, 237, 254, 224, 229, 208, 254, 253,  24, 251, 208, 226, 251,  76, 139, 203, 245, 246, 227,
+    198, 239, 237, 199, 213, 212, 238, 236, 234, 189, 198, 201, 200, 201, 202, 255, 203, 255, 204,   2, 205, 206, 204, 255,
+    195,   3, 202, 199, 203, 201, 255, 205,  14, 199, 194, 201, 197, 203, 196, 202, 196, 200, 196, 193, 191, 192, 197, 194,
+    255, 192,   0, 203, 255, 204,   8, 205, 206, 207, 205, 210, 209, 210, 211, 213, 255, 214,  31, 215, 216, 219, 223, 225,
+    228, 230, 231, 232, 233, 235, 237, 239, 241, 243, 245, 247, 248, 249, 226,  35,  47,  34, 244,  17,  49,   9, 166, 160,
+     28,  26, 141, 254, 254,  39, 238,  35,  72,  25, 171,   9,  54, 218,  51,  49,  20, 229,  58,  31,  20, 119, 254, 253,
+     78,  61,  21, 197,  46,  42,  16, 130, 184,  25,  34,  87, 204,   0,  46,   7, 195, 236, 234, 195, 199, 201, 255, 202,
+      1, 203, 204, 254, 205,   2, 206, 207, 205, 255, 193,   2, 199, 197, 202, 255, 199,   2, 203, 197, 192, 255, 200,   6,
+    202, 195, 200, 194, 199, 192, 193, 255, 190,   6, 196, 193, 191, 190, 201, 203, 204, 255, 205, 255, 206,   6, 210, 209,
+    210, 212, 214, 215, 214, 255, 215,  14, 218, 223, 226, 225, 226, 228, 231, 233, 236, 239, 242, 244, 245, 247, 248, 255,
+    249,  13, 125,  89, 250,  16, 189,   0, 235,  79, 143,  38,  81,  75,  70, 115, 255,  30,  15, 189,  15, 115, 171, 250,
+     14, 225, 161,  60, 255,  47, 177,  28, 184, 149,  59, 255, 253,  19,  32,  87, 152, 236,  16, 202, 108, 107,  62, 151,
+    198,  19, 178,  28, 236,  50, 145, 236, 234, 197, 254, 199, 254, 200, 255, 202, 255, 203,   1, 204, 202, 255, 191,  16,
+    199, 196, 200, 197, 196, 199, 196, 190, 198, 195, 199, 195, 199, 193, 197, 190, 191, 255, 189,   7, 194, 192, 190, 189,
+    196, 203, 204, 205, 255, 206,   7, 207, 208, 210, 211, 212, 213, 214, 213, 255, 215,  12, 219, 223, 224, 221, 229, 234,
+    238, 240, 241, 243, 244, 246, 248, 253, 249,  13, 102, 108, 215,  11, 192,  22, 252,  55, 173,  18, 149, 155, 197, 239,
+    255, 231,  42, 216, 166, 106,  23, 236,   0, 241, 138,  79, 236,  18, 211,   2, 201, 101,  95, 253, 236, 165, 143,   7,
+    192,   0, 238,  84, 139,  42, 169, 152,  59, 149,  42, 226,  19, 179, 236, 234, 196, 198, 200, 198, 193, 194, 255, 195,
+      1, 194, 198, 255, 202,   7, 201, 190, 189, 194, 197, 192, 191, 192, 255, 191,   1, 189, 191, 255, 190, 255, 189,   1,
+    187, 188, 255, 187, 255, 188,   1, 192, 191, 255, 189,   0, 193, 253, 204,   0, 205, 255, 207, 255, 209, 255, 207,  13,
+    208, 210, 213, 215, 220, 222, 223, 228, 233, 238, 240, 242, 245, 246, 254, 247,  16, 248, 250, 251, 250, 193,  19,  20,
+    153, 175,  53, 252,  26, 205, 123,  13,  35, 209, 255, 255,  18, 254, 189,  24,  34, 119, 238,  28,  89, 219,  26,  17,
+    129, 218,   8,  23,  30, 217, 253, 231, 255,  37,  20,  67, 198,  22, 250,  56, 170, 140,  12,  31, 196, 118,  21,   6,
+     85, 237, 236, 234, 202, 199, 190, 192, 255, 201, 255, 200,   5, 198, 194, 193, 194, 201, 189, 252, 187, 254, 188, 255,
+    187, 255, 188,   0, 187, 253, 186, 254, 187,   4, 189, 188, 187, 188, 190, 255, 201,   9, 203, 205, 207, 208, 207, 209,
+    205, 204, 207, 211, 255, 215,  12, 217, 218, 224, 229, 234, 235, 238, 239, 242, 244, 245, 246, 248, 255, 249,   0, 250,
+    255, 251,   0, 249, 255, 247,   0, 251, 255, 252, 255, 253, 255, 254,   2, 247, 252, 254, 255, 255, 255, 254,   1, 253,
+    250, 252, 255,   7, 253, 249, 254, 188,  43, 249, 252, 255, 255, 254,   1, 253, 246, 254, 252,   0, 250, 255, 249,  12,
+    247, 240, 244, 246,  87, 131, 234, 239, 238, 236, 235, 191, 188, 254, 190,   0, 191, 255, 190, 255, 191,   4, 194, 193,
+    192, 189, 188, 255, 191,   1, 189, 188, 252, 187,   1, 188, 186, 255, 187, 255, 186,   3, 185, 187, 191, 197, 254, 198,
+      5, 197, 198, 199, 201, 204, 206, 254, 208, 255, 211,   1, 212, 215, 255, 217,   4, 216, 215, 220, 229, 230, 255, 235,
+      3, 238, 237, 240, 243, 255, 246,   3, 247, 248, 249, 250, 255, 251, 255, 250,   0, 251, 254, 252, 254, 253, 254, 254,
+    255, 255, 255, 254, 248, 255, 255, 254,   5, 210, 160, 255, 254, 255, 254, 254, 253, 254, 252,  17, 251, 250, 249, 247,
+    246, 245, 246, 155, 199, 241, 239, 238, 237, 235, 190, 192, 193, 194, 255, 195, 255, 193,   2, 196, 198, 200, 255, 202,
+      1, 199, 192, 255, 189, 254, 191,   4, 196, 200, 198, 191, 199, 255, 202,   5, 199, 194, 190, 189, 188, 187, 255, 189,
+    255, 190,  20, 191, 192, 196, 202, 204, 206, 207, 208, 209, 210, 215, 218, 220, 222, 221, 218, 219, 224, 225, 229, 234,
+    255, 233,   7, 235, 241, 242, 241, 242, 244, 245, 248, 255, 249, 254, 250,   0, 251, 254, 252, 254, 253, 254, 254, 255,
+    255,   0, 254, 245, 255,   0, 254, 255, 255, 253, 254, 255, 253, 255, 252, 255, 251,   3, 250, 249, 248, 246, 254, 245,
+      8, 243, 241, 239, 238, 237, 234, 202, 201, 198, 255, 196,   2, 198, 201, 203, 254, 204,   3, 205, 212, 215, 213, 255,
+    187,   2, 189, 198, 199, 255, 196,  11, 193, 186, 194, 196, 195, 196, 197, 199, 197, 194, 192, 191, 254, 190,  11, 192,
+    193, 195, 199, 202, 206, 205, 206, 208, 209, 213, 215, 255, 216,   5, 221, 222, 226, 229, 226, 229, 255, 234,   8, 238,
+    241, 242, 243, 245, 246, 247, 248, 249, 255, 250,   0, 251, 255, 252, 252, 253,   1, 254, 253, 255, 254, 254, 255,   0,
+    254, 245, 255,   0, 254, 254, 255, 255, 254, 254, 253, 254, 252,   4, 251, 250, 249, 248, 247, 254, 245,  17, 243, 241,
+    239, 237, 236, 234, 195, 196, 199, 203, 208, 210, 213, 215, 217, 218, 220, 217, 254, 213,   6, 193, 185, 184, 201, 206,
+    193, 189, 255, 187,   2, 191, 190, 194, 255, 204,   1, 201, 197, 255, 196,   8, 197, 199, 198, 199, 200, 202, 204, 205,
+    204, 255, 206,   6, 202, 203, 205, 206, 208, 211, 215, 255, 218,   7, 220, 223, 225, 227, 230, 231, 236, 241, 255, 244,
+      2, 245, 248, 249, 255, 250, 255, 251, 253, 252, 255, 253,   1, 252, 253, 253, 254, 255, 255, 255, 254, 245, 255,   0,
+    254, 254, 255, 255, 254, 253, 253, 255, 252, 255, 251,   3, 250, 249, 248, 246, 255, 245,   5, 243, 241, 239, 238, 236,
+    234, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129,
+    255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129,
+    255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129,
+    255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129,
+    255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 129, 255, 245,
+    255};
@@ -0,0 +1,496 @@
+// loudness functions for butt
+//
+// Copyright 2007-2018 by Daniel Noethen.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+
+#include "loudness.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define LOUDNESS_SSE2
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define LOUDNESS_NEON
+#endif
+
+#define TP_HISTORY (LOUDNESS_TP_TAPS - 1)
+#define TP_DELAY (LOUDNESS_TP_TAPS / 2)
+
+enum {
+    VALUE_MOMENTARY = 0,
+    VALUE_SHORT_TERM,
+    VALUE_INTEGRATED,
+    VALUE_RANGE,
+    VALUE_TRUE_PEAK,
+};
+
+// Energy of the loudness in the middle of each histogram bin
+static double bin_energy[LOUDNESS_HIST_BINS];
+static pthread_once_t bin_energy_once = PTHREAD_ONCE_INIT;
+
+static void init_bin_energy(void)
+{
+    for (int i = 0; i < LOUDNESS_HIST_BINS; i++) {
+        double lufs = LOUDNESS_HIST_MIN + (i + 0.5) * LOUDNESS_HIST_STEP;
+        bin_energy[i] = pow(10.0, (lufs + 0.691) / 10.0);
+    }
+}
+
+static inline double energy_to_lufs(double energy)
+{
+    return energy > 0 ? -0.691 + 10.0 * log10(energy) : -HUGE_VAL;
+}
+
+static inline int lufs_to_bin(double lufs)
+{
+    int bin;
+
+    if (lufs <= LOUDNESS_HIST_MIN) {
+        return 0;
+    }
+    bin = (int)((lufs - LOUDNESS_HIST_MIN) / LOUDNESS_HIST_STEP);
+    return bin < LOUDNESS_HIST_BINS ? bin : LOUDNESS_HIST_BINS - 1;
+}
+
+static inline double bin_to_lufs(int bin)
+{
+    return LOUDNESS_HIST_MIN + (bin + 0.5) * LOUDNESS_HIST_STEP;
+}
+
+// Returns the first bin above the relative gate, which lies <gate> LU below the mean
+// loudness of all blocks in <hist>, or -1 if <hist> is empty
+static int relative_gate_bin(const uint32_t *hist, double gate)
+{
+    double sum = 0;
+    uint64_t count = 0;
+
+    for (int i = 0; i < LOUDNESS_HIST_BINS; i++) {
+        sum += hist[i] * bin_energy[i];
+        count += hist[i];
+    }
+    if (count == 0) {
+        return -1;
+    }
+
+    return lufs_to_bin(energy_to_lufs(sum / count) + gate);
+}
+
+static double integrated_loudness(const uint32_t *hist)
+{
+    double sum = 0;
+    uint64_t count = 0;
+    int start = relative_gate_bin(hist, -10.0);
+
+    if (start < 0) {
+        return -HUGE_VAL;
+    }
+
+    for (int i = start; i < LOUDNESS_HIST_BINS; i++) {
+        sum += hist[i] * bin_energy[i];
+        count += hist[i];
+    }
+
+    return count > 0 ? energy_to_lufs(sum / count) : -HUGE_VAL;
+}
+
+// EBU Tech 3342: Difference between the 95th and the 10th percentile of the short-term
+// loudness values above the relative gate of -20 LU
+static double loudness_range(const uint32_t *hist)
+{
+    uint64_t count = 0, seen = 0, lo_idx, hi_idx;
+    int lo = -1, hi = -1;
+    int start = relative_gate_bin(hist, -20.0);
+
+    if (start < 0) {
+        return 0;
+    }
+
+    for (int i = start; i < LOUDNESS_HIST_BINS; i++) {
+        count += hist[i];
+    }
+    if (count == 0) {
+        return 0;
+    }
+
+    lo_idx = (uint64_t)((count - 1) * 0.10);
+    hi_idx = (uint64_t)((count - 1) * 0.95);
+    for (int i = start; i < LOUDNESS_HIST_BINS && hi < 0; i++) {
+        seen += hist[i];
+        if (lo < 0 && seen > lo_idx) {
+            lo = i;
+        }
+        if (seen > hi_idx) {
+            hi = i;
+        }
+    }
+
+    return bin_to_lufs(hi) - bin_to_lufs(lo);
+}
+
+// Coefficients from ITU-R BS.1770-4 for 48 kHz, recalculated for other sample rates
+// the same way as libebur128 does
+static void init_k_weighting(loudness_t *l)
+{
+    double f0, G, Q, K, Vh, Vb, a0;
+
+    f0 = 1681.974450955533;
+    G = 3.999843853973347;
+    Q = 0.7071752369554196;
+    K = tan(M_PI * f0 / l->samplerate);
+    Vh = pow(10.0, G / 20.0);
+    Vb = pow(Vh, 0.4996667741545416);
+    a0 = 1.0 + K / Q + K * K;
+    l->kw_coef[0][0] = (Vh + Vb * K / Q + K * K) / a0;
+    l->kw_coef[0][1] = 2.0 * (K * K - Vh) / a0;
+    l->kw_coef[0][2] = (Vh - Vb * K / Q + K * K) / a0;
+    l->kw_coef[0][3] = 2.0 * (K * K - 1.0) / a0;
+    l->kw_coef[0][4] = (1.0 - K / Q + K * K) / a0;
+
+    f0 = 38.13547087602444;
+    Q = 0.5003270373238773;
+    K = tan(M_PI * f0 / l->samplerate);
+    a0 = 1.0 + K / Q + K * K;
+    l->kw_coef[1][0] = 1.0;
+    l->kw_coef[1][1] = -2.0;
+    l->kw_coef[1][2] = 1.0;
+    l->kw_coef[1][3] = 2.0 * (K * K - 1.0) / a0;
+    l->kw_coef[1][4] = (1.0 - K / Q + K * K) / a0;
+}
+
+// Hann windowed sinc interpolator. Phase p estimates the signal p/oversampling samples after
+// the tap in the middle, so phase 0 returns that sample unchanged. With less than 4x oversampling
+// the lanes repeat the same phases
+static void init_true_peak(loudness_t *l)
+{
+    for (int p = 0; p < LOUDNESS_TP_PHASES; p++) {
+        double offset = (double)(p % l->oversampling) / l->oversampling;
+        double sum = 0;
+
+        for (int k = 0; k < LOUDNESS_TP_TAPS; k++) {
+            double t = TP_DELAY - k - offset;
+            double sinc = t == 0 ? 1.0 : sin(M_PI * t) / (M_PI * t);
+            double window = 0.5 * (1.0 + cos(M_PI * t / TP_DELAY));
+
+            l->tp_coef[k][p] = (float)(sinc * window);
+            sum += sinc * window;
+        }
+        // Unity gain at DC for every phase
+        for (int k = 0; k < LOUDNESS_TP_TAPS; k++) {
+            l->tp_coef[k][p] = (float)(l->tp_coef[k][p] / sum);
+        }
+    }
+}
+
+// <x> holds TP_HISTORY samples before the <frames> new ones. Returns the highest absolute
+// value of the interpolated signal, at least <peak>
+static float true_peak(const float *x, int frames, const float coef[][LOUDNESS_TP_PHASES], float peak)
+{
+    int i = 0;
+
+#if defined(LOUDNESS_SSE2)
+    const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    __m128 vmax = _mm_set1_ps(peak);
+    float lanes[4];
+
+    for (; i < frames; i++) {
+        const float *newest = x + i + TP_HISTORY;
+        __m128 acc = _mm_setzero_ps();
+
+        for (int k = 0; k < LOUDNESS_TP_TAPS; k++) {
+            acc = _mm_add_ps(acc, _mm_mul_ps(_mm_load_ps(coef[k]), _mm_set1_ps(newest[-k])));
+        }
+        vmax = _mm_max_ps(vmax, _mm_and_ps(acc, abs_mask));
+    }
+
+    _mm_storeu_ps(lanes, vmax);
+    for (int p = 0; p < 4; p++) {
+        peak = lanes[p] > peak ? lanes[p] : peak;
+    }
+#elif defined(LOUDNESS_NEON)
+    float32x4_t vmax = vdupq_n_f32(peak);
+
+    for (; i < frames; i++) {
+        const float *newest = x + i + TP_HISTORY;
+        float32x4_t acc = vdupq_n_f32(0);
+
+        for (int k = 0; k < LOUDNESS_TP_TAPS; k++) {
+            acc = vmlaq_n_f32(acc, vld1q_f32(coef[k]), newest[-k]);
+        }
+        vmax = vmaxq_f32(vmax, vabsq_f32(acc));
+    }
+
+    peak = vmaxvq_f32(vmax);
+#endif
+
+    for (; i < frames; i++) {
+        const float *newest = x + i + TP_HISTORY;
+
+        for (int p = 0; p < LOUDNESS_TP_PHASES; p++) {
+            float acc = 0;
+            for (int k = 0; k < LOUDNESS_TP_TAPS; k++) {
+                acc += coef[k][p] * newest[-k];
+            }
+            acc = fabsf(acc);
+            peak = acc > peak ? acc : peak;
+        }
+    }
+
+    return peak;
+}
+
+static void k_weighting(loudness_t *l, int ch, const float *in, float *out, int frames)
+{
+    for (int s = 0; s < 2; s++) {
+        const double *c = l->kw_coef[s];
+        double *z = l->kw_state[ch][s];
+        double z1 = z[0], z2 = z[1];
+
+        for (int i = 0; i < frames; i++) {
+            double x = in[i];
+            double y = c[0] * x + z1;
+            z1 = c[1] * x - c[3] * y + z2;
+            z2 = c[2] * x - c[4] * y;
+            out[i] = (float)y;
+        }
+
+        // Keep the filters out of the denormal range during digital silence
+        z[0] = fabs(z1) < 1e-20 ? 0 : z1;
+        z[1] = fabs(z2) < 1e-20 ? 0 : z2;
+        in = out;
+    }
+}
+
+static void publish(loudness_t *l, int id, double value)
+{
+    uint64_t bits;
+
+    memcpy(&bits, &value, sizeof(bits));
+    __atomic_store_n(&l->published[id], bits, __ATOMIC_RELAXED);
+}
+
+static double window_loudness(loudness_t *l, int blocks)
+{
+    double sum = 0;
+    int idx = l->sub_idx;
+
+    for (int i = 0; i < blocks; i++) {
+        idx = idx == 0 ? LOUDNESS_SHORT_TERM_BLOCKS - 1 : idx - 1;
+        sum += l->sub_energy[idx];
+    }
+
+    return energy_to_lufs(sum / blocks);
+}
+
+static void finish_block(loudness_t *l)
+{
+    double energy = 0;
+    double momentary = -HUGE_VAL;
+    double short_term = -HUGE_VAL;
+
+    // All channel weights are 1.0 for mono and stereo
+    for (int ch = 0; ch < l->channels; ch++) {
+        energy += l->block_sum[ch] / l->block_len;
+        l->block_sum[ch] = 0;
+    }
+    l->block_pos = 0;
+
+    l->sub_energy[l->sub_idx] = energy;
+    l->sub_idx = (l->sub_idx + 1) % LOUDNESS_SHORT_TERM_BLOCKS;
+    if (l->sub_count < LOUDNESS_SHORT_TERM_BLOCKS) {
+        l->sub_count++;
+    }
+
+    // Gating blocks overlap by 75 %, so every sub-block completes one momentary and one short-term window
+    if (l->sub_count >= LOUDNESS_MOMENTARY_BLOCKS) {
+        momentary = window_loudness(l, LOUDNESS_MOMENTARY_BLOCKS);
+        if (momentary >= LOUDNESS_HIST_MIN) {
+            l->hist_integrated[lufs_to_bin(momentary)]++;
+        }
+    }
+    if (l->sub_count >= LOUDNESS_SHORT_TERM_BLOCKS) {
+        short_term = window_loudness(l, LOUDNESS_SHORT_TERM_BLOCKS);
+        if (short_term >= LOUDNESS_HIST_MIN) {
+            l->hist_range[lufs_to_bin(short_term)]++;
+        }
+    }
+
+    publish(l, VALUE_MOMENTARY, momentary);
+    publish(l, VALUE_SHORT_TERM, short_term);
+    publish(l, VALUE_INTEGRATED, integrated_loudness(l->hist_integrated));
+    publish(l, VALUE_RANGE, loudness_range(l->hist_range));
+    publish(l, VALUE_TRUE_PEAK, l->tp_peak > 0 ? 20.0 * log10(l->tp_peak) : -HUGE_VAL);
+}
+
+static void clear_measurements(loudness_t *l)
+{
+    memset(l->hist_integrated, 0, sizeof(l->hist_integrated));
+    memset(l->hist_range, 0, sizeof(l->hist_range));
+    l->tp_peak = 0;
+
+    publish(l, VALUE_INTEGRATED, -HUGE_VAL);
+    publish(l, VALUE_RANGE, 0);
+    publish(l, VALUE_TRUE_PEAK, -HUGE_VAL);
+}
+
+int loudness_init(loudness_t *l, int samplerate, int channels)
+{
+    if (samplerate < 8000 || channels < 1 || channels > LOUDNESS_MAX_CHANNELS) {
+        return -1;
+    }
+
+    pthread_once(&bin_energy_once, init_bin_energy);
+
+    loudness_free(l);
+    memset(l, 0, sizeof(loudness_t));
+
+    l->samplerate = samplerate;
+    l->channels = channels;
+    l->block_len = samplerate * LOUDNESS_BLOCK_MS / 1000;
+
+    // BS.1770-4 asks for at least 192 kHz after oversampling
+    if (samplerate < 96000) {
+        l->oversampling = 4;
+    }
+    else if (samplerate < 192000) {
+        l->oversampling = 2;
+    }
+    else {
+        l->oversampling = 1;
+    }
+
+    init_k_weighting(l);
+    init_true_peak(l);
+
+    publish(l, VALUE_MOMENTARY, -HUGE_VAL);
+    publish(l, VALUE_SHORT_TERM, -HUGE_VAL);
+    clear_measurements(l);
+
+    return 0;
+}
+
+void loudness_free(loudness_t *l)
+{
+    for (int ch = 0; ch < LOUDNESS_MAX_CHANNELS; ch++) {
+        free(l->in_buf[ch]);
+        free(l->kw_buf[ch]);
+        l->in_buf[ch] = NULL;
+        l->kw_buf[ch] = NULL;
+    }
+    l->buf_frames = 0;
+}
+
+static int grow_buffers(loudness_t *l, int frames)
+{
+    float *p;
+
+    for (int ch = 0; ch < l->channels; ch++) {
+        // realloc keeps the history at the start of the buffer
+        if ((p = (float *)realloc(l->in_buf[ch], (TP_HISTORY + frames) * sizeof(float))) == NULL) {
+            return -1;
+        }
+        if (l->buf_frames == 0) {
+            memset(p, 0, TP_HISTORY * sizeof(float));
+        }
+        l->in_buf[ch] = p;
+
+        if ((p = (float *)realloc(l->kw_buf[ch], frames * sizeof(float))) == NULL) {
+            return -1;
+        }
+        l->kw_buf[ch] = p;
+    }
+    l->buf_frames = frames;
+
+    return 0;
+}
+
+int loudness_process(loudness_t *l, const float *buf, int frames)
+{
+    int pos, n;
+    int blocks = 0;
+
+    if (l->channels == 0 || frames <= 0) {
+        return 0;
+    }
+
+    if (__atomic_exchange_n(&l->reset_requested, 0, __ATOMIC_ACQUIRE)) {
+        clear_measurements(l);
+    }
+
+    if (frames > l->buf_frames && grow_buffers(l, frames) != 0) {
+        return 0;
+    }
+
+    for (int ch = 0; ch < l->channels; ch++) {
+        float *in = l->in_buf[ch];
+
+        for (int i = 0; i < frames; i++) {
+            in[TP_HISTORY + i] = buf[i * l->channels + ch];
+        }
+
+        l->tp_peak = true_peak(in, frames, l->tp_coef, l->tp_peak);
+        k_weighting(l, ch, in + TP_HISTORY, l->kw_buf[ch], frames);
+
+        memmove(in, in + frames, TP_HISTORY * sizeof(float));
+    }
+
+    for (pos = 0; pos < frames; pos += n) {
+        n = frames - pos;
+        if (n > l->block_len - l->block_pos) {
+            n = l->block_len - l->block_pos;
+        }
+
+        for (int ch = 0; ch < l->channels; ch++) {
+            const float *kw = l->kw_buf[ch] + pos;
+            double sum = 0;
+
+            for (int i = 0; i < n; i++) {
+                sum += kw[i] * kw[i];
+            }
+            l->block_sum[ch] += sum;
+        }
+
+        l->block_pos += n;
+        if (l->block_pos == l->block_len) {
+            finish_block(l);
+            blocks++;
+        }
+    }
+
+    return blocks;
+}
+
+void loudness_reset(loudness_t *l)
+{
+    __atomic_store_n(&l->reset_requested, 1, __ATOMIC_RELEASE);
+}
+
+void loudness_get(loudness_t *l, loudness_values_t *values)
+{
+    double v[5];
+
+    for (int i = 0; i < 5; i++) {
+        uint64_t bits = __atomic_load_n(&l->published[i], __ATOMIC_RELAXED);
+        memcpy(&v[i], &bits, sizeof(bits));
+    }
+
+    values->momentary = v[VALUE_MOMENTARY];
+    values->short_term = v[VALUE_SHORT_TERM];
+    values->integrated = v[VALUE_INTEGRATED];
+    values->range = v[VALUE_RANGE];
+    values->true_peak = v[VALUE_TRUE_PEAK];
+}
@@ -0,0 +1,92 @@
+// loudness functions for butt
+//
+// Copyright 2007-2018 by Daniel Noethen.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+
+#ifndef LOUDNESS_H
+#define LOUDNESS_H
+
+#include <stdint.h>
+
+#define LOUDNESS_MAX_CHANNELS 2
+#define LOUDNESS_BLOCK_MS 100          // Sub-block length, the measurements are updated once per sub-block
+#define LOUDNESS_MOMENTARY_BLOCKS 4    // 400 ms
+#define LOUDNESS_SHORT_TERM_BLOCKS 30  // 3 s
+#define LOUDNESS_HIST_MIN -70.0        // LUFS, absolute gate of the integrated loudness and the loudness range
+#define LOUDNESS_HIST_MAX 10.0         // LUFS, louder blocks are counted in the top bin
+#define LOUDNESS_HIST_STEP 0.1         // LU per histogram bin
+#define LOUDNESS_HIST_BINS 800
+#define LOUDNESS_TP_TAPS 12            // FIR taps per oversampling phase of the true-peak interpolator
+#define LOUDNESS_TP_PHASES 4
+
+// Measurements in LUFS/LU/dBTP. Loudness values are -HUGE_VAL while there is not enough
+// signal (less than one window or everything below the absolute gate)
+typedef struct loudness_values {
+    double momentary;
+    double short_term;
+    double integrated;
+    double range;
+    double true_peak; // Highest true peak since the last reset
+} loudness_values_t;
+
+// ITU-R BS.1770-4 / EBU R128 meter. loudness_process() must always be called from the same thread,
+// loudness_get() and loudness_reset() may be called from any other thread
+typedef struct loudness {
+    int channels;
+    int samplerate;
+    int oversampling;
+    int block_len;
+    int block_pos;
+    double block_sum[LOUDNESS_MAX_CHANNELS];
+
+    // K-weighting: high shelf followed by the RLB highpass, direct form II transposed
+    double kw_coef[2][5];
+    double kw_state[LOUDNESS_MAX_CHANNELS][2][2];
+
+    double sub_energy[LOUDNESS_SHORT_TERM_BLOCKS];
+    int sub_idx;
+    int sub_count;
+
+    uint32_t hist_integrated[LOUDNESS_HIST_BINS];
+    uint32_t hist_range[LOUDNESS_HIST_BINS];
+
+    // Oversampling phases interleaved per tap, so one tap of all phases is one SIMD vector
+    float tp_coef[LOUDNESS_TP_TAPS][LOUDNESS_TP_PHASES] __attribute__((aligned(16)));
+    float tp_peak;
+
+    // Per channel work buffers: the last LOUDNESS_TP_TAPS-1 input samples followed by the
+    // current block, and the K-weighted block
+    float *in_buf[LOUDNESS_MAX_CHANNELS];
+    float *kw_buf[LOUDNESS_MAX_CHANNELS];
+    int buf_frames;
+
+    int reset_requested;
+    uint64_t published[5]; // loudness_values_t as double bits
+} loudness_t;
+
+// Sets up <l> for interleaved float audio. <l> must be zeroed before the first call,
+// calling it again frees the previous buffers. Returns 0 on success and -1 on invalid
+// parameters or if out of memory
+int loudness_init(loudness_t *l, int samplerate, int channels);
+void loudness_free(loudness_t *l);
+
+// Measures <frames> interleaved frames. Returns the number of completed sub-blocks, i.e.
+// how often the published values were updated
+int loudness_process(loudness_t *l, const float *buf, int frames);
+
+// The integrated loudness, the loudness range and the true peak start over with the next call of loudness_process()
+void loudness_reset(loudness_t *l);
+
+void loudness_get(loudness_t *l, loudness_values_t *values);
+
+#endif
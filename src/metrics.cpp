@@ -0,0 +1,400 @@
+// metrics functions for butt
+//
+// Copyright 2007-2018 by Daniel Noethen.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdarg.h>
+#include <time.h>
+#include <pthread.h>
+
+#ifdef WIN32
+#include <winsock2.h>
+#define usleep(us) Sleep(us / 1000)
+#else
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <unistd.h>
+#endif
+
+#include "config.h"
+
+#include "sockfuncs.h"
+#include "metrics.h"
+
+typedef struct metric_desc {
+    const char *name;
+    const char *labels; // Without braces, NULL if the metric has no labels
+    const char *help;
+    int type;
+} metric_desc_t;
+
+// Must be in the same order as the METRIC_* enum
+static const metric_desc_t metric_desc[] = {
+    {"butt_audio_xruns_total", "device=\"primary\",type=\"input_overflow\"", "Audio input over- and underflows reported by PortAudio", METRICS_COUNTER},
+    {"butt_audio_xruns_total", "device=\"primary\",type=\"input_underflow\"", NULL, METRICS_COUNTER},
+    {"butt_audio_xruns_total", "device=\"secondary\",type=\"input_overflow\"", NULL, METRICS_COUNTER},
+    {"butt_audio_xruns_total", "device=\"secondary\",type=\"input_underflow\"", NULL, METRICS_COUNTER},
+    {"butt_ringbuffer_fill_ratio", "buffer=\"primary_input\"", "Fill level of the audio ringbuffers (0..1)", METRICS_GAUGE},
+    {"butt_ringbuffer_fill_ratio", "buffer=\"secondary_input\"", NULL, METRICS_GAUGE},
+    {"butt_ringbuffer_fill_ratio", "buffer=\"stream\"", NULL, METRICS_GAUGE},
+    {"butt_ringbuffer_fill_ratio", "buffer=\"record\"", NULL, METRICS_GAUGE},
+    {"butt_ringbuffer_fill_ratio", "buffer=\"aes67\"", NULL, METRICS_GAUGE},
+    {"butt_ringbuffer_fill_ratio", "buffer=\"multitrack\"", NULL, METRICS_GAUGE},
+    {"butt_mixer_cycle_seconds", NULL, "Time the mixer needs to process one block of audio", METRICS_HISTOGRAM},
+    {"butt_stereo_tool_seconds", "output=\"stream\"", "StereoTool processing time per block", METRICS_HISTOGRAM},
+    {"butt_stereo_tool_seconds", "output=\"record\"", NULL, METRICS_HISTOGRAM},
+    {"butt_encoder_cpu_seconds", "encoder=\"stream\"", "Encoder CPU time per processed block", METRICS_HISTOGRAM},
+    {"butt_encoder_cpu_seconds", "encoder=\"record\"", NULL, METRICS_HISTOGRAM},
+    {"butt_encoder_queue_wait_seconds", "encoder=\"stream\"", "Time between the mixer queuing a block and the encoder picking it up", METRICS_HISTOGRAM},
+    {"butt_encoder_queue_wait_seconds", "encoder=\"record\"", NULL, METRICS_HISTOGRAM},
+    {"butt_stream_send_seconds", NULL, "Time to hand one encoded block to the server connection", METRICS_HISTOGRAM},
+    {"butt_stream_sent_bytes_total", NULL, "Encoded bytes sent to the streaming server", METRICS_COUNTER},
+    {"butt_stream_connection_lost_total", NULL, "Streaming connections that were lost", METRICS_COUNTER},
+    {"butt_stream_reconnects_total", NULL, "Automatic reconnect attempts after a lost connection", METRICS_COUNTER},
+    {"butt_stream_listeners", NULL, "Listeners reported by the streaming server, -1 if unknown", METRICS_GAUGE},
+    {"butt_aes67_packets_total", NULL, "RTP packets sent by the AES67 output", METRICS_COUNTER},
+    {"butt_aes67_bytes_total", NULL, "RTP bytes sent by the AES67 output", METRICS_COUNTER},
+    {"butt_aes67_send_errors_total", NULL, "RTP packets the AES67 output failed to send", METRICS_COUNTER},
+    {"butt_aes67_jitter_seconds", NULL, "Deviation of the AES67 packet interval from the nominal packet time", METRICS_HISTOGRAM},
+    {"butt_loudness_lufs", "window=\"momentary\"", "EBU R128 loudness of the stream, -Inf below the absolute gate", METRICS_GAUGE},
+    {"butt_loudness_lufs", "window=\"short_term\"", NULL, METRICS_GAUGE},
+    {"butt_loudness_lufs", "window=\"integrated\"", NULL, METRICS_GAUGE},
+    {"butt_loudness_range_lu", NULL, "EBU R128 loudness range of the stream since connecting", METRICS_GAUGE},
+    {"butt_true_peak_dbtp", NULL, "Highest true peak of the stream since connecting", METRICS_GAUGE},
+};
+
+typedef char metric_desc_check[sizeof(metric_desc) / sizeof(metric_desc[0]) == METRIC_COUNT ? 1 : -1];
+
+// Upper bounds in us. The last bucket is +Inf
+static const uint64_t bucket_bounds[METRICS_NUM_BUCKETS - 1] = {
+    50, 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 1000000,
+};
+
+typedef struct metric {
+    uint64_t value; // Counter value or the bits of the gauge double
+    uint64_t sum_us;
+    uint64_t buckets[METRICS_NUM_BUCKETS];
+} __attribute__((aligned(64))) metric_t;
+
+static metric_t metrics[METRIC_COUNT];
+
+static int metrics_listen_sock = -1;
+static pthread_t metrics_thread_detached;
+
+void metrics_inc(int id)
+{
+    __atomic_fetch_add(&metrics[id].value, 1, __ATOMIC_RELAXED);
+}
+
+void metrics_add(int id, uint64_t n)
+{
+    __atomic_fetch_add(&metrics[id].value, n, __ATOMIC_RELAXED);
+}
+
+void metrics_set(int id, double value)
+{
+    uint64_t bits;
+
+    memcpy(&bits, &value, sizeof(bits));
+    __atomic_store_n(&metrics[id].value, bits, __ATOMIC_RELAXED);
+}
+
+void metrics_observe_us(int id, uint64_t us)
+{
+    int b;
+
+    for (b = 0; b < METRICS_NUM_BUCKETS - 1; b++) {
+        if (us <= bucket_bounds[b]) {
+            break;
+        }
+    }
+
+    __atomic_fetch_add(&metrics[id].buckets[b], 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&metrics[id].sum_us, us, __ATOMIC_RELAXED);
+}
+
+uint64_t metrics_now_us(void)
+{
+#ifdef WIN32
+    LARGE_INTEGER freq, count;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&count);
+    return (uint64_t)(count.QuadPart / (double)freq.QuadPart * 1000000.0);
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#endif
+}
+
+typedef struct text_buf {
+    char *buf;
+    int len;
+    int size;
+    int failed;
+} text_buf_t;
+
+static void text_printf(text_buf_t *t, const char *fmt, ...)
+{
+    va_list ap;
+    int n;
+    char *new_buf;
+
+    for (;;) {
+        va_start(ap, fmt);
+        n = vsnprintf(t->buf + t->len, t->size - t->len, fmt, ap);
+        va_end(ap);
+
+        if (n < 0) {
+            t->failed = 1;
+            return;
+        }
+        if (t->len + n < t->size) {
+            t->len += n;
+            return;
+        }
+
+        new_buf = (char *)realloc(t->buf, 2 * t->size + n);
+        if (new_buf == NULL) {
+            t->failed = 1;
+            return;
+        }
+        t->buf = new_buf;
+        t->size = 2 * t->size + n;
+    }
+}
+
+// Writes <name><suffix>{<labels>,<extra>} without empty braces or dangling commas
+static void text_series(text_buf_t *t, const char *name, const char *suffix, const char *labels, const char *extra)
+{
+    if (labels == NULL && extra == NULL) {
+        text_printf(t, "%s%s ", name, suffix);
+    }
+    else {
+        text_printf(t, "%s%s{%s%s%s} ", name, suffix, labels ? labels : "", labels && extra ? "," : "", extra ? extra : "");
+    }
+}
+
+static void render_histogram(text_buf_t *t, int id)
+{
+    const metric_desc_t *d = &metric_desc[id];
+    uint64_t count = 0;
+    char le[32];
+
+    // The buckets are read one by one while other threads keep observing.
+    // _count is derived from the buckets so that it always matches the +Inf bucket
+    for (int b = 0; b < METRICS_NUM_BUCKETS; b++) {
+        count += __atomic_load_n(&metrics[id].buckets[b], __ATOMIC_RELAXED);
+
+        if (b < METRICS_NUM_BUCKETS - 1) {
+            snprintf(le, sizeof(le), "le=\"%g\"", bucket_bounds[b] / 1000000.0);
+        }
+        else {
+            snprintf(le, sizeof(le), "le=\"+Inf\"");
+        }
+        text_series(t, d->name, "_bucket", d->labels, le);
+        text_printf(t, "%llu\n", (unsigned long long)count);
+    }
+
+    text_series(t, d->name, "_sum", d->labels, NULL);
+    text_printf(t, "%.6f\n", __atomic_load_n(&metrics[id].sum_us, __ATOMIC_RELAXED) / 1000000.0);
+    text_series(t, d->name, "_count", d->labels, NULL);
+    text_printf(t, "%llu\n", (unsigned long long)count);
+}
+
+int metrics_render(char **text)
+{
+    text_buf_t t;
+    static const char *type_names[] = {"counter", "gauge", "histogram"};
+    uint64_t bits;
+    double gauge;
+
+    t.size = 16 * 1024;
+    t.len = 0;
+    t.failed = 0;
+    t.buf = (char *)malloc(t.size);
+    if (t.buf == NULL) {
+        return -1;
+    }
+
+    text_printf(&t, "# HELP butt_build_info Version of the running butt instance\n");
+    text_printf(&t, "# TYPE butt_build_info gauge\n");
+    text_printf(&t, "butt_build_info{version=\"%s\"} 1\n", VERSION);
+
+    for (int id = 0; id < METRIC_COUNT; id++) {
+        const metric_desc_t *d = &metric_desc[id];
+
+        if (d->help != NULL) {
+            text_printf(&t, "# HELP %s %s\n", d->name, d->help);
+            text_printf(&t, "# TYPE %s %s\n", d->name, type_names[d->type]);
+        }
+
+        switch (d->type) {
+        case METRICS_COUNTER:
+            text_series(&t, d->name, "", d->labels, NULL);
+            text_printf(&t, "%llu\n", (unsigned long long)__atomic_load_n(&metrics[id].value, __ATOMIC_RELAXED));
+            break;
+        case METRICS_GAUGE:
+            bits = __atomic_load_n(&metrics[id].value, __ATOMIC_RELAXED);
+            memcpy(&gauge, &bits, sizeof(gauge));
+            text_series(&t, d->name, "", d->labels, NULL);
+            if (isinf(gauge)) {
+                text_printf(&t, "%s\n", gauge > 0 ? "+Inf" : "-Inf");
+            }
+            else {
+                text_printf(&t, "%g\n", gauge);
+            }
+            break;
+        case METRICS_HISTOGRAM:
+            render_histogram(&t, id);
+            break;
+        }
+    }
+
+    if (t.failed) {
+        free(t.buf);
+        return -1;
+    }
+
+    *text = t.buf;
+    return t.len;
+}
+
+static void send_response(int s, const char *status, const char *content_type, const char *body, int body_len)
+{
+    char header[256];
+    int header_len;
+
+    header_len = snprintf(header, sizeof(header),
+                          "HTTP/1.1 %s\r\n"
+                          "Content-Type: %s\r\n"
+                          "Content-Length: %d\r\n"
+                          "Connection: close\r\n"
+                          "\r\n",
+                          status, content_type, body_len);
+
+    if (sock_send(s, header, header_len, SEND_TIMEOUT) == header_len) {
+        sock_send(s, body, body_len, SEND_TIMEOUT);
+    }
+}
+
+static void handle_client(int s)
+{
+    char req[2048];
+    int len = 0;
+    int rc;
+    char *text;
+
+    // Only the request line matters, but the whole header is read to not reset the connection
+    // by closing it with unread data
+    while (len < (int)sizeof(req) - 1) {
+        rc = sock_recv(s, req + len, sizeof(req) - 1 - len, METRICS_RECV_TIMEOUT);
+        if (rc <= 0) {
+            return;
+        }
+        len += rc;
+        req[len] = '\0';
+        if (strstr(req, "\r\n\r\n") != NULL || strstr(req, "\n\n") != NULL) {
+            break;
+        }
+    }
+
+    if (strncmp(req, "GET /metrics ", strlen("GET /metrics ")) != 0 && strncmp(req, "GET /metrics?", strlen("GET /metrics?")) != 0) {
+        send_response(s, "404 Not Found", "text/plain", "Not Found\n", strlen("Not Found\n"));
+        return;
+    }
+
+    len = metrics_render(&text);
+    if (len < 0) {
+        send_response(s, "500 Internal Server Error", "text/plain", "Error\n", strlen("Error\n"));
+        return;
+    }
+
+    send_response(s, "200 OK", "text/plain; version=0.0.4; charset=utf-8", text, len);
+    free(text);
+}
+
+static void *metrics_thread_func(void *data)
+{
+    int s;
+    (void)data;
+
+    // Detach thread (free ressources) because no one will call pthread_join() on it
+    pthread_detach(pthread_self());
+
+    // Scrapes are rare and cheap, one client at a time is enough
+    for (;;) {
+        s = accept(metrics_listen_sock, NULL, NULL);
+        if (s < 0) {
+            usleep(100 * 1000); // Don't spin if we are out of file descriptors
+            continue;
+        }
+
+        handle_client(s);
+        sock_close(s);
+    }
+
+    return NULL;
+}
+
+int metrics_start_server(int port)
+{
+    struct sockaddr_in servaddr;
+    int val = 1;
+
+    if (metrics_listen_sock != -1) {
+        return port;
+    }
+
+#ifdef WIN32
+    WSADATA wsa;
+    WSAStartup(MAKEWORD(2, 2), &wsa);
+#endif
+
+    metrics_listen_sock = socket(AF_INET, SOCK_STREAM, 0);
+    if (metrics_listen_sock == -1) {
+        return SOCK_ERR_CREATE;
+    }
+
+    memset(&servaddr, 0, sizeof(servaddr));
+    servaddr.sin_family = AF_INET;
+    servaddr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    servaddr.sin_port = htons(port);
+
+    setsockopt(metrics_listen_sock, SOL_SOCKET, SO_REUSEADDR, (const char *)&val, sizeof(int));
+
+    if (bind(metrics_listen_sock, (struct sockaddr *)&servaddr, sizeof(servaddr)) != 0) {
+        sock_close(metrics_listen_sock);
+        metrics_listen_sock = -1;
+        return SOCK_ERR_BIND;
+    }
+
+    if (listen(metrics_listen_sock, 8) != 0) {
+        sock_close(metrics_listen_sock);
+        metrics_listen_sock = -1;
+        return SOCK_ERR_LISTEN;
+    }
+
+    if (pthread_create(&metrics_thread_detached, NULL, metrics_thread_func, NULL) != 0) {
+        sock_close(metrics_listen_sock);
+        metrics_listen_sock = -1;
+        return SOCK_ERR_CREATE;
+    }
+
+    return port;
+}
@@ -0,0 +1,84 @@
+// metrics functions for butt
+//
+// Copyright 2007-2018 by Daniel Noethen.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <stdint.h>
+
+#define METRICS_NUM_BUCKETS 14 // Histogram buckets including +Inf
+#define METRICS_RECV_TIMEOUT 2000 // ms to wait for the HTTP request of a scraper
+
+enum {
+    METRICS_COUNTER = 0,
+    METRICS_GAUGE = 1,
+    METRICS_HISTOGRAM = 2,
+};
+
+// Every metric has its own cache line and is updated with relaxed atomics,
+// so the audio callbacks, the mixer and the encoder threads never wait for each other or for a scraper.
+// Metrics that share a name must stay next to each other, they are exported as one family
+enum {
+    METRIC_XRUNS_DEV1_INPUT_OVERFLOW = 0,
+    METRIC_XRUNS_DEV1_INPUT_UNDERFLOW,
+    METRIC_XRUNS_DEV2_INPUT_OVERFLOW,
+    METRIC_XRUNS_DEV2_INPUT_UNDERFLOW,
+    METRIC_RB_FILL_PCM,
+    METRIC_RB_FILL_PCM2,
+    METRIC_RB_FILL_STREAM,
+    METRIC_RB_FILL_REC,
+    METRIC_RB_FILL_AES67,
+    METRIC_RB_FILL_MULTITRACK,
+    METRIC_MIXER_CYCLE,
+    METRIC_STEREO_TOOL_STREAM,
+    METRIC_STEREO_TOOL_REC,
+    METRIC_ENCODER_STREAM,
+    METRIC_ENCODER_REC,
+    METRIC_ENCODER_WAIT_STREAM,
+    METRIC_ENCODER_WAIT_REC,
+    METRIC_STREAM_SEND,
+    METRIC_STREAM_BYTES,
+    METRIC_CONNECTION_LOST,
+    METRIC_RECONNECTS,
+    METRIC_LISTENERS,
+    METRIC_AES67_PACKETS,
+    METRIC_AES67_BYTES,
+    METRIC_AES67_SEND_ERRORS,
+    METRIC_AES67_JITTER,
+    METRIC_LOUDNESS_MOMENTARY,
+    METRIC_LOUDNESS_SHORT_TERM,
+    METRIC_LOUDNESS_INTEGRATED,
+    METRIC_LOUDNESS_RANGE,
+    METRIC_TRUE_PEAK,
+    METRIC_COUNT,
+};
+
+void metrics_inc(int id);
+void metrics_add(int id, uint64_t n);
+void metrics_set(int id, double value);
+void metrics_observe_us(int id, uint64_t us);
+
+// Monotonic time in us for timing the code paths that are observed by histograms
+uint64_t metrics_now_us(void);
+
+// Renders all metrics in the Prometheus text exposition format into a newly allocated buffer.
+// Returns the length of the text or -1 on error. The caller must free() <*text>
+int metrics_render(char **text);
+
+// Serves GET /metrics on 127.0.0.1:<port> from a background thread.
+// Returns <port> on success and a SOCK_ERR_* value on error
+int metrics_start_server(int port);
+
+#endif
@@ -0,0 +1,232 @@
+// mp3 burst-on-connect cache for butt
+//
+// Copyright 2007-2018 by Daniel Noethen.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "timer.h"
+#include "mp3_burst.h"
+
+#define MP3_MAX_BYTES_PER_SEC (320000 / 8)
+#define MP3_MAX_FRAME_SIZE (2881) // 144 * 320000 / 8000 + 1 (MPEG 2.5 at 160kbit/s is smaller)
+
+static const int layer3_bitrates[2][16] = {
+    {0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 0}, // MPEG 1
+    {0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160, 0},     // MPEG 2 and 2.5
+};
+
+static const int samplerates[3][3] = {
+    {44100, 48000, 32000}, // MPEG 1
+    {22050, 24000, 16000}, // MPEG 2
+    {11025, 12000, 8000},  // MPEG 2.5
+};
+
+// Parses the 4 byte layer III frame header at <p>.
+// Returns the frame length in bytes or 0 if <p> doesn't point to a valid header
+static int parse_frame_header(const unsigned char *p, int *samplerate, int *samples)
+{
+    int version, bitrate_idx, sr_idx, padding;
+    int mpeg1;
+
+    if (p[0] != 0xFF || (p[1] & 0xE0) != 0xE0) {
+        return 0;
+    }
+
+    version = (p[1] >> 3) & 0x03; // 0 = MPEG 2.5, 1 = reserved, 2 = MPEG 2, 3 = MPEG 1
+    if (version == 1 || ((p[1] >> 1) & 0x03) != 0x01) { // Only layer III
+        return 0;
+    }
+
+    bitrate_idx = p[2] >> 4;
+    sr_idx = (p[2] >> 2) & 0x03;
+    padding = (p[2] >> 1) & 0x01;
+    if (bitrate_idx == 0 || bitrate_idx == 15 || sr_idx == 3) {
+        return 0;
+    }
+
+    mpeg1 = (version == 3);
+    *samplerate = samplerates[version == 3 ? 0 : (version == 2 ? 1 : 2)][sr_idx];
+    *samples = mpeg1 ? 1152 : 576;
+
+    return (mpeg1 ? 144 : 72) * layer3_bitrates[mpeg1 ? 0 : 1][bitrate_idx] * 1000 / *samplerate + padding;
+}
+
+int mp3_burst_init(mp3_burst_t *burst, int duration)
+{
+    char *buf = NULL;
+    int size = 0;
+
+    if (duration > MP3_BURST_MAX_DURATION) {
+        duration = MP3_BURST_MAX_DURATION;
+    }
+
+    if (duration > 0) {
+        size = duration * MP3_MAX_BYTES_PER_SEC + 2 * MP3_MAX_FRAME_SIZE;
+        buf = (char *)malloc(size);
+        if (buf == NULL) {
+            return -1;
+        }
+    }
+
+    pthread_mutex_lock(&burst->mutex);
+    free(burst->buf);
+    burst->buf = buf;
+    burst->size = size;
+    burst->duration = duration;
+    burst->start = 0;
+    burst->end = 0;
+    burst->pending = 0;
+    burst->samples = 0;
+    burst->samplerate = 0;
+    burst->last_write = 0;
+    pthread_mutex_unlock(&burst->mutex);
+
+    return 0;
+}
+
+void mp3_burst_write(mp3_burst_t *burst, const char *data, int len)
+{
+    int frame_len;
+    int samplerate, samples;
+    unsigned char *p;
+
+    pthread_mutex_lock(&burst->mutex);
+
+    if (burst->buf == NULL || len <= 0) {
+        goto unlock;
+    }
+
+    // LAME returns at most a few frames per call. Anything bigger than the
+    // whole cache can only be partly kept; the tail is what matters
+    if (len > burst->size - MP3_MAX_FRAME_SIZE) {
+        data += len - (burst->size - MP3_MAX_FRAME_SIZE);
+        len = burst->size - MP3_MAX_FRAME_SIZE;
+        burst->start = burst->end = burst->pending = 0;
+        burst->samples = 0;
+    }
+
+    // The cache is trimmed by duration only, at high bitrates it can be almost full.
+    // Drop the oldest frames until the new data fits
+    while (burst->end - burst->start + burst->pending + len > burst->size) {
+        if (burst->start < burst->end) {
+            frame_len = parse_frame_header((unsigned char *)burst->buf + burst->start, &samplerate, &samples);
+            burst->start += frame_len;
+            burst->samples -= samples;
+        }
+        else { // Only an incomplete frame is left
+            burst->start = burst->end = burst->pending = 0;
+            burst->samples = 0;
+        }
+    }
+
+    // Move the cached frames to the front of the buffer if the new data doesn't fit behind them
+    if (burst->end + burst->pending + len > burst->size) {
+        memmove(burst->buf, burst->buf + burst->start, burst->end + burst->pending - burst->start);
+        burst->end -= burst->start;
+        burst->start = 0;
+    }
+
+    memcpy(burst->buf + burst->end + burst->pending, data, len);
+    burst->pending += len;
+
+    while (burst->pending >= 4) {
+        p = (unsigned char *)burst->buf + burst->end;
+        frame_len = parse_frame_header(p, &samplerate, &samples);
+
+        if (frame_len == 0) { // Not in sync, drop one byte
+            memmove(p, p + 1, burst->pending - 1);
+            burst->pending--;
+            continue;
+        }
+
+        if (frame_len > burst->pending) {
+            break; // Incomplete frame
+        }
+
+        // A new samplerate invalidates everything that was cached before
+        if (samplerate != burst->samplerate) {
+            burst->start = burst->end;
+            burst->samples = 0;
+            burst->samplerate = samplerate;
+        }
+
+        burst->end += frame_len;
+        burst->pending -= frame_len;
+        burst->samples += samples;
+    }
+
+    // Drop the oldest frames until the cache holds <duration> seconds
+    while (burst->start < burst->end) {
+        p = (unsigned char *)burst->buf + burst->start;
+        frame_len = parse_frame_header(p, &samplerate, &samples);
+        if (burst->samples - samples < (uint64_t)burst->duration * burst->samplerate) {
+            break;
+        }
+        burst->start += frame_len;
+        burst->samples -= samples;
+    }
+
+    burst->last_write = timer_get_cur_time();
+
+unlock:
+    pthread_mutex_unlock(&burst->mutex);
+}
+
+int mp3_burst_read(mp3_burst_t *burst, char *dest, int samplerate, uint64_t max_age_ms)
+{
+    int len = 0;
+
+    pthread_mutex_lock(&burst->mutex);
+
+    if (burst->buf == NULL || burst->samplerate != samplerate) {
+        goto unlock;
+    }
+
+    if (timer_get_cur_time() - burst->last_write > max_age_ms) {
+        goto unlock;
+    }
+
+    len = burst->end - burst->start;
+    memcpy(dest, burst->buf + burst->start, len);
+
+unlock:
+    pthread_mutex_unlock(&burst->mutex);
+    return len;
+}
+
+int mp3_burst_get_max_size(mp3_burst_t *burst)
+{
+    return burst->size;
+}
+
+void mp3_burst_clear(mp3_burst_t *burst)
+{
+    pthread_mutex_lock(&burst->mutex);
+    burst->start = 0;
+    burst->end = 0;
+    burst->pending = 0;
+    burst->samples = 0;
+    burst->samplerate = 0;
+    pthread_mutex_unlock(&burst->mutex);
+}
+
+void mp3_burst_free(mp3_burst_t *burst)
+{
+    pthread_mutex_lock(&burst->mutex);
+    free(burst->buf);
+    burst->buf = NULL;
+    burst->size = 0;
+    pthread_mutex_unlock(&burst->mutex);
+}
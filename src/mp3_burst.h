@@ -0,0 +1,56 @@
+// mp3 burst-on-connect cache for butt
+//
+// Copyright 2007-2018 by Daniel Noethen.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+
+#ifndef MP3_BURST_H
+#define MP3_BURST_H
+
+#include <stdint.h>
+#include <pthread.h>
+
+#define MP3_BURST_DEFAULT_DURATION (10) // seconds
+#define MP3_BURST_MAX_DURATION (60)
+
+#define MP3_BURST_NEW(burst) mp3_burst_t burst = {NULL, 0, 0, 0, 0, 0, 0, 0, 0, PTHREAD_MUTEX_INITIALIZER}
+
+// Keeps the last <duration> seconds of encoded mp3 frames exactly as they were
+// sent to the server. After a reconnect the cached frames are sent in one burst
+// at the beginning of the new connection.
+// Only complete frames are kept, so the burst always starts and ends at a frame boundary
+typedef struct mp3_burst {
+    char *buf;
+    int size;
+    int start;         // Offset of the oldest cached frame
+    int end;           // End of the last complete frame
+    int pending;       // Bytes of an incomplete frame following <end>
+    uint64_t samples;  // Number of samples per channel between <start> and <end>
+    int samplerate;    // Samplerate of the cached frames
+    int duration;      // seconds
+    uint64_t last_write; // ms, see timer_get_cur_time()
+    pthread_mutex_t mutex;
+} mp3_burst_t;
+
+int mp3_burst_init(mp3_burst_t *burst, int duration);
+void mp3_burst_write(mp3_burst_t *burst, const char *data, int len);
+void mp3_burst_clear(mp3_burst_t *burst);
+void mp3_burst_free(mp3_burst_t *burst);
+
+// Copies the cached frames into <dest> (at least mp3_burst_get_max_size() bytes).
+// Nothing is returned if the frames were encoded with a different samplerate
+// or if the newest frame is older than max_age_ms.
+// Returns the number of bytes copied
+int mp3_burst_read(mp3_burst_t *burst, char *dest, int samplerate, uint64_t max_age_ms);
+int mp3_burst_get_max_size(mp3_burst_t *burst);
+
+#endif
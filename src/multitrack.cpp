@@ -0,0 +1,349 @@
+// multitrack functions for butt
+//
+// Copyright 2007-2018 by Daniel Noethen.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <FL/fl_utf8.h> // for fl_fopen(...)
+
+#include "multitrack.h"
+#include "pcm_convert.h"
+#include "wav_header.h"
+
+static void default_route(mt_routing_t *r)
+{
+    for (int i = 0; i < r->channels; i++) {
+        r->route[i] = i;
+    }
+}
+
+static int parse_route(mt_routing_t *r, const char *route)
+{
+    const char *p = route;
+    int n = 0;
+
+    while (n < r->channels) {
+        int first, last, len;
+
+        while (*p == ' ' || *p == ',') {
+            p++;
+        }
+        if (*p == '\0') {
+            break;
+        }
+
+        if (sscanf(p, "%d%n", &first, &len) != 1 || first < 1 || first > MT_MAX_DEV_CHANNELS) {
+            return -1;
+        }
+        p += len;
+        last = first;
+
+        if (*p == '-') {
+            p++;
+            if (sscanf(p, "%d%n", &last, &len) != 1 || last < first || last > MT_MAX_DEV_CHANNELS) {
+                return -1;
+            }
+            p += len;
+        }
+        if (*p != '\0' && *p != ',' && *p != ' ') {
+            return -1;
+        }
+
+        for (int ch = first; ch <= last && n < r->channels; ch++) {
+            r->route[n++] = ch - 1;
+        }
+    }
+
+    for (; n < r->channels; n++) {
+        r->route[n] = n > 0 ? r->route[n - 1] + 1 : 0;
+    }
+
+    return 0;
+}
+
+static int parse_downmix(mt_routing_t *r, const char *downmix)
+{
+    const char *p = downmix;
+    int n = 0;
+
+    for (;;) {
+        float left, right;
+        int len;
+
+        while (*p == ' ' || *p == ',') {
+            p++;
+        }
+        if (*p == '\0') {
+            break;
+        }
+
+        if (n == r->channels || sscanf(p, "%f:%f%n", &left, &right, &len) != 2) {
+            return -1;
+        }
+        p += len;
+        if (*p != '\0' && *p != ',' && *p != ' ') {
+            return -1;
+        }
+
+        r->downmix[n][0] = left;
+        r->downmix[n][1] = right;
+        n++;
+    }
+
+    r->has_downmix = n > 0;
+    return 0;
+}
+
+int mt_routing_parse(mt_routing_t *r, int channels, const char *route, const char *downmix)
+{
+    int ret = 0;
+
+    memset(r, 0, sizeof(mt_routing_t));
+    r->channels = channels < 0 ? 0 : (channels > MT_MAX_CHANNELS ? MT_MAX_CHANNELS : channels);
+
+    if (route == NULL || parse_route(r, route) != 0) {
+        default_route(r);
+        ret = route == NULL ? 0 : -1;
+    }
+
+    if (downmix != NULL && parse_downmix(r, downmix) != 0) {
+        memset(r->downmix, 0, sizeof(r->downmix));
+        r->has_downmix = 0;
+        ret = -1;
+    }
+
+    return ret;
+}
+
+void mt_mix_program(const mt_routing_t *r, float *const *dev, int dev_channels, float *out, int out_channels, int frames)
+{
+    memset(out, 0, frames * out_channels * sizeof(float));
+
+    for (int b = 0; b < r->channels; b++) {
+        float left = r->downmix[b][0];
+        float right = r->downmix[b][1];
+        const float *src;
+
+        if (r->route[b] >= dev_channels || (left == 0 && right == 0)) {
+            continue;
+        }
+        src = dev[r->route[b]];
+
+        if (out_channels == 1) {
+            float gain = (left + right) / 2;
+            for (int i = 0; i < frames; i++) {
+                out[i] += gain * src[i];
+            }
+        }
+        else {
+            for (int i = 0; i < frames; i++) {
+                out[2 * i] += left * src[i];
+                out[2 * i + 1] += right * src[i];
+            }
+        }
+    }
+}
+
+void mt_interleave(const mt_routing_t *r, float *const *dev, int dev_channels, float *out, int frames)
+{
+    int channels = r->channels;
+
+    for (int b = 0; b < channels; b++) {
+        if (r->route[b] >= dev_channels) {
+            for (int i = 0; i < frames; i++) {
+                out[i * channels + b] = 0;
+            }
+        }
+        else {
+            const float *src = dev[r->route[b]];
+            for (int i = 0; i < frames; i++) {
+                out[i * channels + b] = src[i];
+            }
+        }
+    }
+}
+
+#define MT_MAX_FILE_INDEX 1000
+
+static uint32_t get_le(const uint8_t *p, int bytes)
+{
+    uint32_t v = 0;
+
+    for (int i = bytes - 1; i >= 0; i--) {
+        v = (v << 8) | p[i];
+    }
+    return v;
+}
+
+// Returns 1 if <path> is a multitrack WAV file written by wav_write_header_ext() in the given format
+static int wav_can_append(const char *path, int channels, int samplerate, int bit_depth)
+{
+    uint8_t hdr[WAV_EXT_HDR_SIZE];
+    FILE *fd;
+    off_t size;
+    int ok;
+
+    if ((fd = fl_fopen(path, "rb")) == NULL) {
+        return 0;
+    }
+
+    ok = fread(hdr, 1, sizeof(hdr), fd) == sizeof(hdr) && fseeko(fd, 0, SEEK_END) == 0 && (size = ftello(fd)) >= WAV_EXT_HDR_SIZE;
+    fclose(fd);
+
+    return ok && (!memcmp(hdr, "RIFF", 4) || !memcmp(hdr, "RF64", 4)) && !memcmp(hdr + 8, "WAVE", 4) && !memcmp(hdr + 48, "fmt ", 4) &&
+           get_le(hdr + 56, 2) == 0xFFFE && (int)get_le(hdr + 58, 2) == channels && (int)get_le(hdr + 60, 4) == samplerate &&
+           (int)get_le(hdr + 70, 2) == bit_depth && !memcmp(hdr + 96, "data", 4) &&
+           (size - WAV_EXT_HDR_SIZE) % (channels * bit_depth / 8) == 0; // An interrupted write would shift all channels
+}
+
+char *mt_file_path(const char *rec_path, int mode, int format, int channels, int samplerate, int bit_depth, int *append)
+{
+    const char *ext = format == MT_FORMAT_FLAC ? "flac" : "wav";
+    const char *dot = strrchr(rec_path, '.');
+    const char *sep = strrchr(rec_path, '/');
+    const char *sep2 = strrchr(rec_path, '\\');
+    size_t base_len, path_len;
+    char *path;
+
+    *append = 0;
+
+    if (sep2 > sep) {
+        sep = sep2;
+    }
+
+    base_len = (dot != NULL && (sep == NULL || dot > sep)) ? (size_t)(dot - rec_path) : strlen(rec_path);
+    path_len = base_len + strlen("_multitrack_1000.") + strlen(ext) + 1;
+
+    if ((path = (char *)malloc(path_len)) == NULL) {
+        return NULL;
+    }
+
+    for (int i = 1; i <= MT_MAX_FILE_INDEX; i++) {
+        if (i == 1) {
+            snprintf(path, path_len, "%.*s_multitrack.%s", (int)base_len, rec_path, ext);
+        }
+        else {
+            snprintf(path, path_len, "%.*s_multitrack_%d.%s", (int)base_len, rec_path, i, ext);
+        }
+
+        if (fl_access(path, F_OK) != 0 || (i == 1 && mode == MT_OPEN_OVERWRITE)) {
+            return path;
+        }
+        if (mode == MT_OPEN_APPEND && format == MT_FORMAT_WAV && wav_can_append(path, channels, samplerate, bit_depth)) {
+            *append = 1;
+            return path;
+        }
+    }
+
+    free(path);
+    return NULL;
+}
+
+int mt_file_open(mt_file_t *f, const char *path, int append, int format, int channels, int samplerate, int bit_depth)
+{
+    f->fd = NULL;
+    f->format = format;
+    f->channels = channels;
+    f->samplerate = samplerate;
+    f->bit_depth = bit_depth;
+    f->flac.encoder = NULL;
+
+    if (format == MT_FORMAT_FLAC && channels > FLAC__MAX_CHANNELS) {
+        return -1;
+    }
+
+    if (append && format == MT_FORMAT_WAV) {
+        // The header is derived from the file size, so it stays valid when writing continues at the end
+        if ((f->fd = fl_fopen(path, "rb+")) == NULL || fseeko(f->fd, 0, SEEK_END) != 0) {
+            if (f->fd != NULL) {
+                fclose(f->fd);
+                f->fd = NULL;
+            }
+            return -1;
+        }
+        return 0;
+    }
+
+    if ((f->fd = fl_fopen(path, "wb+")) == NULL) {
+        return -1;
+    }
+
+    if (format == MT_FORMAT_FLAC) {
+        f->flac.channel = channels;
+        f->flac.samplerate = samplerate;
+        f->flac.bit_depth = bit_depth;
+        f->flac.enc_type = FLAC_ENC_TYPE_MULTITRACK;
+        if (flac_enc_init(&f->flac) != 0 || flac_enc_init_FILE(&f->flac, f->fd) != 0) {
+            flac_enc_close(&f->flac);
+            fclose(f->fd);
+            f->fd = NULL;
+            return -1;
+        }
+    }
+    else {
+        wav_write_header_ext(f->fd, channels, samplerate, bit_depth);
+    }
+
+    return 0;
+}
+
+int mt_file_write(mt_file_t *f, float *pcm, int frames)
+{
+    size_t samples = (size_t)frames * f->channels;
+
+    if (f->fd == NULL) {
+        return -1;
+    }
+
+    if (f->format == MT_FORMAT_FLAC) {
+        return flac_enc_encode(&f->flac, pcm, frames, f->channels);
+    }
+
+    if (f->bit_depth == 16) {
+        pcm_float_to_s16(pcm, (int16_t *)pcm, samples);
+    }
+    else if (f->bit_depth == 24) {
+        pcm_float_to_s24le(pcm, (uint8_t *)pcm, samples);
+    }
+    else {
+        pcm_float_to_s32(pcm, (int32_t *)pcm, samples);
+    }
+
+    if (fwrite(pcm, f->bit_depth / 8, samples, f->fd) != samples) {
+        return -1;
+    }
+
+    // Permanently update the header, so the file stays valid if butt crashes
+    wav_write_header_ext(f->fd, f->channels, f->samplerate, f->bit_depth);
+
+    return 0;
+}
+
+void mt_file_close(mt_file_t *f)
+{
+    if (f->fd == NULL) {
+        return;
+    }
+
+    if (f->format == MT_FORMAT_FLAC) { // The flac encoder closes the file
+        flac_enc_close_file(&f->flac);
+    }
+    else {
+        wav_write_header_ext(f->fd, f->channels, f->samplerate, f->bit_depth);
+        fclose(f->fd);
+    }
+
+    f->fd = NULL;
+}
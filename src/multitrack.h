@@ -0,0 +1,86 @@
+// multitrack functions for butt
+//
+// Copyright 2007-2018 by Daniel Noethen.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+
+#ifndef MULTITRACK_H
+#define MULTITRACK_H
+
+#include <stdio.h>
+
+#include "flac_encode.h"
+
+#define MT_MAX_CHANNELS 16     // Channels of the multitrack bus
+#define MT_MAX_DEV_CHANNELS 64 // Input channels of a device that can be routed to the bus
+
+enum {
+    MT_FORMAT_WAV = 0,
+    MT_FORMAT_FLAC = 1,
+};
+
+// What happens to an existing multitrack recording, follows the choice for the program recording
+enum {
+    MT_OPEN_OVERWRITE = 0, // Truncate it
+    MT_OPEN_APPEND = 1,    // Append to it if it is a WAV file of the same format, otherwise start a numbered file
+    MT_OPEN_KEEP = 2,      // Never touch it, start a numbered file
+};
+
+// The multitrack bus carries up to MT_MAX_CHANNELS channels of the primary device next to the
+// mono/stereo program. The audio callback splits the device input into planar channels, the routing
+// picks the bus channels from them and the downmix matrix can build the program from the bus
+typedef struct {
+    int channels;                      // Bus channels, 0 = no bus
+    int route[MT_MAX_CHANNELS];        // Device channel (starting at 0) of each bus channel
+    int has_downmix;                   // 1 = the program is mixed from the bus instead of left_ch/right_ch
+    float downmix[MT_MAX_CHANNELS][2]; // Gain of each bus channel in the left and the right program channel
+} mt_routing_t;
+
+typedef struct {
+    FILE *fd;
+    int format;
+    int channels;
+    int samplerate;
+    int bit_depth;
+    flac_enc flac;
+} mt_file_t;
+
+// Fills <r> for a bus of <channels> channels.
+// <route> lists the device channels (starting at 1) of the bus channels, e.g. "1-8" or "3,4,1,2".
+// Bus channels without an entry take the device channels following the last entry, so "" is the same as "1-<channels>".
+// <downmix> lists "left:right" gains of the bus channels, e.g. "1:0,0:1,0.5:0.5", an empty string disables the downmix.
+// Returns 0 on success and -1 if one of the strings could not be parsed, <r> then holds the defaults
+int mt_routing_parse(mt_routing_t *r, int channels, const char *route, const char *downmix);
+
+// Mixes the bus into <out_channels> (1 or 2) interleaved program channels.
+// <dev> holds the planar channels of a device with <dev_channels> channels, bus channels routed beyond them are silent
+void mt_mix_program(const mt_routing_t *r, float *const *dev, int dev_channels, float *out, int out_channels, int frames);
+
+// Writes the bus channels as interleaved frames to <out>
+void mt_interleave(const mt_routing_t *r, float *const *dev, int dev_channels, float *out, int frames);
+
+// Returns the path of the multitrack recording that belongs to the recording <rec_path>,
+// e.g. "show.mp3" becomes "show_multitrack.wav". If that file exists and <mode> (MT_OPEN_*) doesn't allow
+// to overwrite or append to it, "show_multitrack_2.wav", "show_multitrack_3.wav"... are tried.
+// <append> is set to 1 if the returned WAV file has to be appended. The result must be freed
+char *mt_file_path(const char *rec_path, int mode, int format, int channels, int samplerate, int bit_depth, int *append);
+
+// WAV files are written as WAVE_FORMAT_EXTENSIBLE and become RF64 beyond 4 GiB.
+// FLAC supports up to 8 channels and can't be appended. Returns 0 on success and -1 on error
+int mt_file_open(mt_file_t *f, const char *path, int append, int format, int channels, int samplerate, int bit_depth);
+
+// Writes <frames> interleaved frames. <pcm> is converted in place
+int mt_file_write(mt_file_t *f, float *pcm, int frames);
+
+void mt_file_close(mt_file_t *f);
+
+#endif
@@ -177,6 +177,12 @@ int opus_enc_alloc(opus_enc *opus)
     opus->buffer = (unsigned char *)calloc(1, 2 * OPUS_FRAME_SIZE * sizeof(float));
     opus->last_pcm_packet = (float *)calloc(1, 2 * OPUS_FRAME_SIZE * sizeof(float));
     opus->granulepos = 0;
+    opus->page_granulepos = 0;
+    opus->flush_next_page = 1;
+
+    if (!opus_enc_is_valid_rtp_frame_size(opus->frame_size)) {
+        opus->frame_size = OPUS_RTP_DEFAULT_FRAME_SIZE;
+    }
 
     memset(opus->song_title, 0, sizeof(opus->song_title));
 
@@ -249,6 +255,12 @@ int opus_enc_init(opus_enc *opus)
 
     ret |= opus_encoder_ctl(opus->encoder, OPUS_SET_MAX_BANDWIDTH(bandwidth));
 
+    if (opus->rtp_mode) {
+        ret |= opus_encoder_ctl(opus->encoder, OPUS_SET_INBAND_FEC(opus->fec));
+        ret |= opus_encoder_ctl(opus->encoder, OPUS_SET_PACKET_LOSS_PERC(opus->fec ? opus->packet_loss : 0));
+        ret |= opus_encoder_ctl(opus->encoder, OPUS_SET_DTX(opus->dtx));
+    }
+
     opus->last_bitrate = opus->bitrate;
 
     ret |= opus_encoder_ctl(opus->encoder, OPUS_GET_LOOKAHEAD(&opus->lookahead));
@@ -350,6 +362,10 @@ void opus_enc_write_header(opus_enc *opus)
     op.packet = opus->tags;
     op.bytes = opus->tags_size;
     ogg_stream_packetin(&opus->os, &op);
+
+    // Get the first audio page out as fast as possible
+    opus->page_granulepos = 0;
+    opus->flush_next_page = 1;
 }
 
 void opus_update_song_title(opus_enc *opus, char *song_title)
@@ -364,6 +380,17 @@ int opus_enc_reinit(opus_enc *opus)
     return opus_enc_init(opus);
 }
 
+static void update_bitrate(opus_enc *opus)
+{
+    if (opus->last_bitrate != opus->bitrate) {
+        if ((opus->bitrate < 9600) || (opus->bitrate > 320000)) {
+            opus->bitrate = DEFAULT_OPUS_BITRATE;
+        }
+        opus_encoder_ctl(opus->encoder, OPUS_SET_BITRATE(opus->bitrate));
+        opus->last_bitrate = opus->bitrate;
+    }
+}
+
 int opus_enc_encode(opus_enc *opus, float *pcm_buf, char *enc_buf)
 {
     int w = 0;
@@ -375,20 +402,17 @@ int opus_enc_encode(opus_enc *opus, float *pcm_buf, char *enc_buf)
     }
 
     // Write header
-    while (ogg_stream_flush(&opus->os, &opus->og) != 0) {
-        memcpy(enc_buf + w, opus->og.header, opus->og.header_len);
-        w += opus->og.header_len;
-        memcpy(enc_buf + w, opus->og.body, opus->og.body_len);
-        w += opus->og.body_len;
-    }
-
-    if (opus->last_bitrate != opus->bitrate) {
-        if ((opus->bitrate < 9600) || (opus->bitrate > 320000)) {
-            opus->bitrate = DEFAULT_OPUS_BITRATE;
+    if (opus->flush_next_page == 1) {
+        while (ogg_stream_flush(&opus->os, &opus->og) != 0) {
+            memcpy(enc_buf + w, opus->og.header, opus->og.header_len);
+            w += opus->og.header_len;
+            memcpy(enc_buf + w, opus->og.body, opus->og.body_len);
+            w += opus->og.body_len;
         }
-        opus_encoder_ctl(opus->encoder, OPUS_SET_BITRATE(opus->bitrate));
-        opus->last_bitrate = opus->bitrate;
     }
+
+    update_bitrate(opus);
+
     if (opus->state == OPUS_STATE_NEW_STREAM) {
         opus_encoder_ctl(opus->encoder, OPUS_SET_PREDICTION_DISABLED(1));
     }
@@ -425,11 +449,25 @@ int opus_enc_encode(opus_enc *opus, float *pcm_buf, char *enc_buf)
 
     ogg_stream_packetin(&opus->os, &op);
 
-    while (ogg_stream_flush(&opus->os, &opus->og) != 0) {
-        memcpy(enc_buf + w, opus->og.header, opus->og.header_len);
-        w += opus->og.header_len;
-        memcpy(enc_buf + w, opus->og.body, opus->og.body_len);
-        w += opus->og.body_len;
+    // Collect packets until the page has reached its target duration.
+    // Pages must be flushed immediately at the start and the end of a stream
+    // (e.g. because of a new song title), otherwise the listeners would receive
+    // the new headers or the first audio data too late
+    int page_duration_ms = (int)((opus->granulepos - opus->page_granulepos) / 48);
+    if (opus->page_duration <= 0 || page_duration_ms >= opus->page_duration || opus->flush_next_page == 1 || opus->state == OPUS_STATE_LAST_FRAME ||
+        opus->state == OPUS_STATE_NEW_STREAM) {
+        w += opus_enc_flush_pages(opus, enc_buf + w);
+        opus->flush_next_page = 0;
+    }
+    else {
+        // libogg emits a page on its own if it has become too large (~4 kB)
+        while (ogg_stream_pageout(&opus->os, &opus->og) != 0) {
+            memcpy(enc_buf + w, opus->og.header, opus->og.header_len);
+            w += opus->og.header_len;
+            memcpy(enc_buf + w, opus->og.body, opus->og.body_len);
+            w += opus->og.body_len;
+            opus->page_granulepos = ogg_page_granulepos(&opus->og);
+        }
     }
 
     switch (opus->state) {
@@ -444,6 +482,50 @@ int opus_enc_encode(opus_enc *opus, float *pcm_buf, char *enc_buf)
     return w;
 }
 
+void opus_enc_set_rtp_mode(opus_enc *opus, int enable)
+{
+    opus->rtp_mode = enable;
+
+    if (opus->encoder == NULL) {
+        return;
+    }
+
+    // FEC only has an effect in the SILK and hybrid modes, i.e. at speech bitrates
+    opus_encoder_ctl(opus->encoder, OPUS_SET_INBAND_FEC(enable ? opus->fec : 0));
+    opus_encoder_ctl(opus->encoder, OPUS_SET_PACKET_LOSS_PERC(enable && opus->fec ? opus->packet_loss : 0));
+    opus_encoder_ctl(opus->encoder, OPUS_SET_DTX(enable ? opus->dtx : 0));
+}
+
+int opus_enc_encode_raw(opus_enc *opus, float *pcm_buf, char *enc_buf)
+{
+    int len;
+
+    if (opus->encoder == NULL) {
+        return -1;
+    }
+
+    update_bitrate(opus);
+
+    // RTP has no in-stream metadata. The title is only sent out-of-band
+    if (opus->state == OPUS_STATE_NEW_SONG_AVAILABLE) {
+        opus->state = OPUS_STATE_NORMAL_FRAME;
+    }
+
+    len = opus_encode_float(opus->encoder, pcm_buf, opus->frame_size, (unsigned char *)enc_buf, OPUS_MAX_PACKET_SIZE);
+    if (len < 0) {
+        return -1;
+    }
+
+    opus->granulepos += opus->frame_size;
+
+    return len;
+}
+
+bool opus_enc_is_valid_rtp_frame_size(int frame_size)
+{
+    return frame_size == 120 || frame_size == 240 || frame_size == 480 || frame_size == 960;
+}
+
 int opus_enc_flush(opus_enc *opus, char *enc_buf)
 {
     int w;
@@ -453,9 +535,26 @@ int opus_enc_flush(opus_enc *opus, char *enc_buf)
     return w;
 }
 
+// Writes all packets that are still waiting for their page to be completed
+int opus_enc_flush_pages(opus_enc *opus, char *enc_buf)
+{
+    int w = 0;
+
+    while (ogg_stream_flush(&opus->os, &opus->og) != 0) {
+        memcpy(enc_buf + w, opus->og.header, opus->og.header_len);
+        w += opus->og.header_len;
+        memcpy(enc_buf + w, opus->og.body, opus->og.body_len);
+        w += opus->og.body_len;
+    }
+    opus->page_granulepos = opus->granulepos;
+
+    return w;
+}
+
 void opus_enc_close(opus_enc *opus)
 {
     opus->granulepos = 0;
+    opus->page_granulepos = 0;
     ogg_stream_clear(&opus->os);
     opus_encoder_destroy(opus->encoder);
 }
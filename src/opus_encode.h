@@ -37,6 +37,19 @@
 // #define OPUS_FRAME_SIZE (960/2) // Must be multiple of 120 (120 = 2,5ms, 960 = 20ms)
 #define DEFAULT_OPUS_BITRATE 128000
 
+// Target duration of one Ogg page. Packets are collected until this duration is reached,
+// 0 restores the old behaviour of one page per Opus packet
+#define OPUS_DEFAULT_PAGE_DURATION_STREAM 200 // ms
+#define OPUS_DEFAULT_PAGE_DURATION_REC    1000 // ms
+#define OPUS_MAX_PAGE_DURATION            1000 // ms
+
+// RTP (WebRTC) carries raw Opus packets without the Ogg container.
+// The frame size is selectable there: 120 (2.5 ms), 240 (5 ms), 480 (10 ms) or 960 (20 ms) samples at 48 kHz
+#define OPUS_RTP_DEFAULT_FRAME_SIZE  960
+#define OPUS_RTP_DEFAULT_PACKET_LOSS 10   // Expected packet loss in percent, tunes the in-band FEC
+#define OPUS_MAX_PACKET_SIZE         1275 // Max. size of one Opus frame (RFC 6716)
+#define OPUS_DTX_PACKET_SIZE         2    // With DTX, packets up to this size carry no audio and need not be sent
+
 typedef struct {
     int version;
     int channels; /* Number of channels: 1..255 */
@@ -65,6 +78,9 @@ struct opus_enc {
 
     ogg_int64_t prev_ganule;
     ogg_int64_t granulepos;
+    ogg_int64_t page_granulepos; // granulepos of the last page that has been written
+    int page_duration;           // in ms, see OPUS_DEFAULT_PAGE_DURATION_*
+    int flush_next_page;         // Flush the next page immediately (stream start)
 
     int last_bitrate;
     int bitrate;
@@ -81,6 +97,13 @@ struct opus_enc {
     unsigned char *buffer;
     int buffer_len;
     float *last_pcm_packet;
+
+    // See opus_enc_set_rtp_mode()
+    int rtp_mode;
+    int frame_size; // Samples per RTP packet at 48 kHz
+    int fec;
+    int packet_loss;
+    int dtx;
 };
 
 enum {
@@ -96,6 +119,16 @@ int opus_enc_reinit(opus_enc *opus);
 void opus_enc_write_header(opus_enc *opus);
 int opus_enc_encode(opus_enc *opus, float *pcm_buf, char *enc_buf);
 int opus_enc_flush(opus_enc *opus, char *enc_buf);
+int opus_enc_flush_pages(opus_enc *opus, char *enc_buf);
+
+// Switches the encoder between the Ogg output of opus_enc_encode() and the raw packets of
+// opus_enc_encode_raw(). In RTP mode the in-band FEC and DTX settings are applied to the encoder
+void opus_enc_set_rtp_mode(opus_enc *opus, int enable);
+
+// Encodes one frame of opus->frame_size samples into a raw Opus packet.
+// Returns the packet size or -1 on error
+int opus_enc_encode_raw(opus_enc *opus, float *pcm_buf, char *enc_buf);
+bool opus_enc_is_valid_rtp_frame_size(int frame_size);
 void opus_enc_close(opus_enc *opus);
 
 bool opus_enc_is_valid_srate(int samplerate);
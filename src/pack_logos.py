@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+#
+# Generates logos.h from raw RGBA images, e.g.:
+#   convert radio_co.png rgba:radio_co.rgba
+#   ./pack_logos.py 124 61 radio_co_logo=radio_co.rgba live365_logo=live365.rgba > logos.h
+#
+# Every image is split into its R, G, B and A planes and each plane is PackBits compressed,
+# which is what packbits_decode_planar() in packbits.cpp expects.
+
+import sys
+
+
+def packbits(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if run >= 2:
+            out += bytes([257 - run, data[i]])
+            i += run
+            continue
+
+        start = i
+        while i < len(data) and i - start < 128:
+            if i + 1 < len(data) and data[i + 1] == data[i]:
+                break
+            i += 1
+        out += bytes([i - start - 1]) + data[start:i]
+    return out
+
+
+def main():
+    if len(sys.argv) < 4:
+        sys.exit("usage: %s <width> <height> <name>=<file.rgba> ..." % sys.argv[0])
+
+    width = int(sys.argv[1])
+    height = int(sys.argv[2])
+    pixels = width * height
+
+    print("// Generated by pack_logos.py, do not edit")
+    print("//")
+    print("// %dx%d RGBA, every channel plane is PackBits compressed" % (width, height))
+    print()
+    print("#define LOGO_WIDTH %d" % width)
+    print("#define LOGO_HEIGHT %d" % height)
+    print("#define LOGO_DEPTH 4")
+
+    for arg in sys.argv[3:]:
+        name, path = arg.split("=", 1)
+        with open(path, "rb") as f:
+            rgba = f.read()
+        if len(rgba) != pixels * 4:
+            sys.exit("%s: expected %d bytes, got %d" % (path, pixels * 4, len(rgba)))
+
+        packed = bytearray()
+        for c in range(4):
+            packed += packbits(rgba[c::4])
+
+        print()
+        print("static const unsigned char %s[] = {" % name)
+        for i in range(0, len(packed), 24):
+            line = ", ".join("%3d" % b for b in packed[i:i + 24])
+            print("    " + line + ("," if i + 24 < len(packed) else "};"))
+
+
+main()
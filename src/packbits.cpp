@@ -0,0 +1,65 @@
+// packbits functions for butt
+//
+// Copyright 2007-2018 by Daniel Noethen.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+
+#include "packbits.h"
+
+// Control byte n: 0..127 copies the next n+1 bytes, 129..255 repeats the next byte 257-n times, 128 is skipped
+int packbits_decode_planar(const unsigned char *src, int src_len, unsigned char *dst, int width, int height, int depth)
+{
+    int pixels = width * height;
+    int pos = 0;
+
+    for (int c = 0; c < depth; c++) {
+        unsigned char *out = dst + c;
+        int done = 0;
+
+        while (done < pixels) {
+            int n, count;
+
+            if (pos >= src_len) {
+                return -1;
+            }
+            n = src[pos++];
+
+            if (n < 128) {
+                count = n + 1;
+                if (pos + count > src_len || done + count > pixels) {
+                    return -1;
+                }
+                for (int i = 0; i < count; i++) {
+                    out[(done + i) * depth] = src[pos + i];
+                }
+                pos += count;
+            }
+            else if (n > 128) {
+                count = 257 - n;
+                if (pos >= src_len || done + count > pixels) {
+                    return -1;
+                }
+                for (int i = 0; i < count; i++) {
+                    out[(done + i) * depth] = src[pos];
+                }
+                pos++;
+            }
+            else {
+                count = 0;
+            }
+
+            done += count;
+        }
+    }
+
+    return pos == src_len ? 0 : -1;
+}
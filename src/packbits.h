@@ -0,0 +1,24 @@
+// packbits functions for butt
+//
+// Copyright 2007-2018 by Daniel Noethen.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+
+#ifndef PACKBITS_H
+#define PACKBITS_H
+
+// Decodes an image whose channel planes were PackBits compressed one after another (see pack_logos.py)
+// into <dst>, which must hold <width>*<height>*<depth> bytes of interleaved pixels.
+// Returns 0 on success and -1 if <src> is truncated or does not match the image size
+int packbits_decode_planar(const unsigned char *src, int src_len, unsigned char *dst, int width, int height, int depth);
+
+#endif
@@ -9,141 +9,304 @@
 #include <stdlib.h>
 #include <math.h>
 #include <string.h>
+#include <stdint.h>
 #include <FL/fl_utf8.h> // for fl_fopen(...)
 
 #include "parseconfig.h"
 
-struct CFG_ENTRIES {
+// Sections and entries are kept in open addressing hash tables. All strings live in an arena
+// that is released as a whole by cfg_free(), so lookups are O(1) and parsing a config with
+// hundreds of server and ICY sections needs only a handful of allocations
+
+struct CFG_ARENA_BLOCK {
+    struct CFG_ARENA_BLOCK *next;
+    size_t used;
+    size_t size;
+    char data[];
+};
+
+struct CFG_SECTION {
+    char *name;
+    uint32_t hash;
+    uint32_t digest; // Changes whenever an entry of the section is set, see cfg_section_digest()
     unsigned int ent_count;
-    char **ent_names;
-    char **ent_values;
+    unsigned int ent_alloc;
+    char **ent_names; // NULL terminated
+};
+
+struct CFG_ENTRY {
+    uint32_t hash;
+    unsigned int sec; // Index into sections, 0 marks an empty slot
+    char *name;
+    char *value;
 };
 
-struct CFG_SECTIONS {
-    unsigned int sec_count;
-    char **sec_names;
-    struct CFG_ENTRIES **sec_entries;
+struct CFG_STORE {
+    struct CFG_ARENA_BLOCK *arena;
+
+    unsigned int sec_count; // Including the unused section 0
+    unsigned int sec_alloc;
+    struct CFG_SECTION *sections;
+    char **sec_names; // NULL terminated
+
+    unsigned int sec_table_size; // Power of 2
+    unsigned int *sec_table;     // Section indices, 0 = empty
+
+    unsigned int ent_count;
+    unsigned int ent_table_size; // Power of 2
+    struct CFG_ENTRY *ent_table;
 };
 
 /* ------------------------------------------------------------------------ */
 
-static struct CFG_SECTIONS *c;
+static struct CFG_STORE *c;
 
 /* ------------------------------------------------------------------------ */
 
 enum {
+    ARENA_BLOCK_SIZE = 64 * 1024,
     ALLOC_SIZE = 16,
+    SEC_TABLE_SIZE = 256,
+    ENT_TABLE_SIZE = 4096,
 };
 
+static uint32_t hash_str(uint32_t h, const char *s)
+{
+    // FNV-1a
+    while (*s != '\0') {
+        h ^= (uint8_t)*s++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static uint32_t section_hash(const char *name)
+{
+    return hash_str(2166136261u, name);
+}
+
+static uint32_t entry_hash(uint32_t sec_hash, const char *name)
+{
+    return hash_str((sec_hash ^ 0xff) * 16777619u, name);
+}
+
+static void *arena_alloc(size_t size)
+{
+    struct CFG_ARENA_BLOCK *b = c->arena;
+    size_t block_size;
+
+    size = (size + 7) & ~(size_t)7;
+    if (b == NULL || b->used + size > b->size) {
+        block_size = size > (size_t)ARENA_BLOCK_SIZE ? size : (size_t)ARENA_BLOCK_SIZE;
+        b = (struct CFG_ARENA_BLOCK *)malloc(sizeof(struct CFG_ARENA_BLOCK) + block_size);
+        if (b == NULL) {
+            return NULL;
+        }
+        b->next = c->arena;
+        b->used = 0;
+        b->size = block_size;
+        c->arena = b;
+    }
+
+    b->used += size;
+    return b->data + b->used - size;
+}
+
 void cfg_free(void)
 {
-    unsigned int i, j;
-    struct CFG_ENTRIES *e;
+    struct CFG_ARENA_BLOCK *b, *next;
 
     if (c == NULL) {
         return;
     }
 
-    for (i = 0; i < c->sec_count; i++) {
-        e = c->sec_entries[i];
-        printf("ent_count: %d\n", e->ent_count);
-        for (j = 0; j < e->ent_count; j++) {
-            printf("i,j: %d,%d ", i, j);
-            printf("name,value: %s,%s\n", e->ent_names[j], e->ent_values[j]);
-            free(e->ent_names[j]);
-            free(e->ent_values[j]);
-        }
-
-        free(e->ent_names);
-        free(e->ent_values);
-        free(c->sec_entries[i]);
-        free(c->sec_names[i]);
+    for (unsigned int i = 1; i < c->sec_count; i++) {
+        free(c->sections[i].ent_names);
+    }
+    for (b = c->arena; b != NULL; b = next) {
+        next = b->next;
+        free(b);
     }
 
+    free(c->sections);
     free(c->sec_names);
-    free(c->sec_entries);
+    free(c->sec_table);
+    free(c->ent_table);
+    free(c);
 
     c = NULL;
 }
 
-static struct CFG_SECTIONS *cfg_init_sections(void)
+static struct CFG_STORE *cfg_init_store(void)
 {
-    struct CFG_SECTIONS *c;
-    c = (CFG_SECTIONS *)malloc(sizeof(struct CFG_SECTIONS));
-    memset(c, 0, sizeof(struct CFG_SECTIONS));
-    c->sec_names = (char **)malloc(ALLOC_SIZE * sizeof(char *));
-    c->sec_names[0] = NULL;
-    c->sec_entries = (CFG_ENTRIES **)malloc(ALLOC_SIZE * sizeof(struct CFG_ENTRIES *));
-    c->sec_entries[0] = NULL;
-    return c;
+    struct CFG_STORE *s;
+
+    s = (CFG_STORE *)calloc(1, sizeof(struct CFG_STORE));
+    s->sec_count = 1;
+    s->sec_alloc = ALLOC_SIZE;
+    s->sections = (CFG_SECTION *)calloc(s->sec_alloc, sizeof(struct CFG_SECTION));
+    s->sec_names = (char **)calloc(s->sec_alloc, sizeof(char *));
+    s->sec_table_size = SEC_TABLE_SIZE;
+    s->sec_table = (unsigned int *)calloc(s->sec_table_size, sizeof(unsigned int));
+    s->ent_table_size = ENT_TABLE_SIZE;
+    s->ent_table = (CFG_ENTRY *)calloc(s->ent_table_size, sizeof(struct CFG_ENTRY));
+    return s;
 }
 
-static struct CFG_ENTRIES *cfg_init_entries(void)
+static unsigned int cfg_lookup_section(const char *name, uint32_t hash)
 {
-    struct CFG_ENTRIES *e;
-    e = (CFG_ENTRIES *)malloc(sizeof(struct CFG_ENTRIES));
-    memset(e, 0, sizeof(struct CFG_ENTRIES));
-    e->ent_names = (char **)malloc(ALLOC_SIZE * sizeof(char *));
-    e->ent_names[0] = NULL;
-    e->ent_values = (char **)malloc(ALLOC_SIZE * sizeof(char *));
-    e->ent_values[0] = NULL;
-    return e;
+    unsigned int mask = c->sec_table_size - 1;
+    unsigned int i, sec;
+
+    for (i = hash & mask; (sec = c->sec_table[i]) != 0; i = (i + 1) & mask) {
+        if (c->sections[sec].hash == hash && strcmp(c->sections[sec].name, name) == 0) {
+            return sec;
+        }
+    }
+    return 0;
 }
 
-static struct CFG_ENTRIES *cfg_find_section(struct CFG_SECTIONS *c, const char *name)
+static void cfg_insert_section_slot(unsigned int sec)
 {
-    struct CFG_ENTRIES *e;
+    unsigned int mask = c->sec_table_size - 1;
     unsigned int i;
 
-    for (i = 0; i < c->sec_count; i++) {
-        if (strcmp(c->sec_names[i], name) == 0) {
-            return c->sec_entries[i];
+    for (i = c->sections[sec].hash & mask; c->sec_table[i] != 0; i = (i + 1) & mask) {
+    }
+    c->sec_table[i] = sec;
+}
+
+static struct CFG_ENTRY *cfg_lookup_entry(unsigned int sec, const char *name, uint32_t hash)
+{
+    unsigned int mask = c->ent_table_size - 1;
+    struct CFG_ENTRY *e;
+
+    for (unsigned int i = hash & mask; (e = &c->ent_table[i])->sec != 0; i = (i + 1) & mask) {
+        if (e->hash == hash && e->sec == sec && strcmp(e->name, name) == 0) {
+            return e;
+        }
+    }
+    return e; // Empty slot
+}
+
+static void cfg_grow_tables(void)
+{
+    // Keep the load factor of both tables below 1/2
+    if (c->sec_count * 2 > c->sec_table_size) {
+        free(c->sec_table);
+        c->sec_table_size *= 2;
+        c->sec_table = (unsigned int *)calloc(c->sec_table_size, sizeof(unsigned int));
+        for (unsigned int i = 1; i < c->sec_count; i++) {
+            cfg_insert_section_slot(i);
         }
     }
 
+    if ((c->ent_count + 1) * 2 > c->ent_table_size) {
+        struct CFG_ENTRY *old = c->ent_table;
+        unsigned int old_size = c->ent_table_size;
+
+        c->ent_table_size *= 2;
+        c->ent_table = (CFG_ENTRY *)calloc(c->ent_table_size, sizeof(struct CFG_ENTRY));
+        for (unsigned int i = 0; i < old_size; i++) {
+            if (old[i].sec != 0) {
+                *cfg_lookup_entry(old[i].sec, old[i].name, old[i].hash) = old[i];
+            }
+        }
+        free(old);
+    }
+}
+
+// <name> and <value> must point into the arena, they are stored without copying
+static unsigned int cfg_find_section(const char *name)
+{
+    struct CFG_SECTION *s;
+    uint32_t hash = section_hash(name);
+    unsigned int sec;
+
+    if ((sec = cfg_lookup_section(name, hash)) != 0) {
+        return sec;
+    }
+
     /* 404 not found => create a new one */
-    if ((c->sec_count % ALLOC_SIZE) == (ALLOC_SIZE - 2)) {
-        c->sec_names = (char **)realloc(c->sec_names, (c->sec_count + 2 + ALLOC_SIZE) * sizeof(char *));
-        c->sec_entries = (CFG_ENTRIES **)realloc(c->sec_entries, (c->sec_count + 2 + ALLOC_SIZE) * sizeof(struct CFG_ENTRIES *));
+    if (c->sec_count + 1 >= c->sec_alloc) {
+        c->sec_alloc *= 2;
+        c->sections = (CFG_SECTION *)realloc(c->sections, c->sec_alloc * sizeof(struct CFG_SECTION));
+        c->sec_names = (char **)realloc(c->sec_names, c->sec_alloc * sizeof(char *));
     }
-    e = cfg_init_entries();
-    c->sec_names[c->sec_count] = strdup(name);
-    c->sec_entries[c->sec_count] = e;
-    c->sec_count++;
-    c->sec_names[c->sec_count] = NULL;
-    c->sec_entries[c->sec_count] = NULL;
-    return e;
+
+    sec = c->sec_count++;
+    s = &c->sections[sec];
+    memset(s, 0, sizeof(*s));
+    s->name = (char *)name;
+    s->hash = hash;
+    s->digest = hash;
+    s->ent_alloc = ALLOC_SIZE;
+    s->ent_names = (char **)calloc(s->ent_alloc, sizeof(char *));
+
+    c->sec_names[sec - 1] = s->name;
+    c->sec_names[sec] = NULL;
+
+    cfg_grow_tables();
+    cfg_insert_section_slot(sec);
+
+    return sec;
 }
 
-static void cfg_set_entry(struct CFG_ENTRIES *e, const char *name, const char *value)
+static void cfg_set_entry(unsigned int sec, const char *name, const char *value)
 {
-    unsigned int i;
+    struct CFG_SECTION *s = &c->sections[sec];
+    uint32_t hash = entry_hash(s->hash, name);
+    struct CFG_ENTRY *e = cfg_lookup_entry(sec, name, hash);
 
-    for (i = 0; i < e->ent_count; i++) {
-        if (strcmp(e->ent_names[i], name) == 0) {
-            break;
-        }
+    s->digest = hash_str(hash_str(s->digest * 16777619u, name) ^ '=', value);
+
+    if (e->sec != 0) {
+        // Duplicate key, the last one wins
+        e->value = (char *)value;
+        return;
     }
-    if (i == e->ent_count) {
-        /* 404 not found => create a new one */
-        if ((e->ent_count % ALLOC_SIZE) == (ALLOC_SIZE - 2)) {
-            e->ent_names = (char **)realloc(e->ent_names, (e->ent_count + 2 + ALLOC_SIZE) * sizeof(char *));
-            e->ent_values = (char **)realloc(e->ent_values, (e->ent_count + 2 + ALLOC_SIZE) * sizeof(char *));
-        }
-        e->ent_count++;
-        e->ent_names[e->ent_count] = NULL;
-        e->ent_values[e->ent_count] = NULL;
+
+    e->hash = hash;
+    e->sec = sec;
+    e->name = (char *)name;
+    e->value = (char *)value;
+    c->ent_count++;
+
+    if (s->ent_count + 1 >= s->ent_alloc) {
+        s->ent_alloc *= 2;
+        s->ent_names = (char **)realloc(s->ent_names, s->ent_alloc * sizeof(char *));
+    }
+    s->ent_names[s->ent_count++] = e->name;
+    s->ent_names[s->ent_count] = NULL;
+
+    cfg_grow_tables();
+}
+
+static const char *cfg_lookup(const char *sec, const char *ent)
+{
+    unsigned int s;
+    struct CFG_ENTRY *e;
+
+    if (c == NULL || (s = cfg_lookup_section(sec, section_hash(sec))) == 0) {
+        return NULL;
     }
-    e->ent_names[i] = strdup(name);
-    e->ent_values[i] = strdup(value);
+
+    e = cfg_lookup_entry(s, ent, entry_hash(c->sections[s].hash, ent));
+    return e->sec != 0 ? e->value : NULL;
+}
+
+static int is_space(char ch)
+{
+    return ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n' || ch == '\v' || ch == '\f';
 }
 
 /* ------------------------------------------------------------------------ */
 
 int cfg_parse_file(const char *filename)
 {
-    struct CFG_ENTRIES *e = NULL;
-    char line[1024], tag[64], value[1021];
+    unsigned int sec = 0;
+    char *buf, *line, *next, *end, *tag, *value;
+    size_t len = 0, n;
     FILE *fp;
     int nr;
 
@@ -151,35 +314,77 @@ int cfg_parse_file(const char *filename)
         cfg_free();
     }
 
-    c = cfg_init_sections();
+    c = cfg_init_store();
     if ((fp = fl_fopen(filename, "rb")) == NULL) {
         return -1;
     }
 
+    // Read the whole file into the arena. Names and values are terminated in place
+    fseek(fp, 0, SEEK_END);
+    n = ftell(fp) > 0 ? (size_t)ftell(fp) : 0;
+    fseek(fp, 0, SEEK_SET);
+    buf = (char *)arena_alloc(n + 1);
+    if (buf == NULL) {
+        fclose(fp);
+        return -1;
+    }
+    len = fread(buf, 1, n, fp);
+    buf[len] = '\0';
+    fclose(fp);
+
     nr = 0;
-    while (NULL != fgets(line, 1023, fp)) {
+    for (line = buf; line < buf + len; line = next) {
         nr++;
-        if (line[0] == '\n' || line[0] == '#' || line[0] == '%' || line[0] == ';') {
+        end = (char *)memchr(line, '\n', buf + len - line);
+        if (end == NULL) {
+            end = buf + len;
+        }
+        next = end + 1;
+        *end = '\0';
+
+        if (line[0] == '\0' || line[0] == '#' || line[0] == '%' || line[0] == ';') {
             continue;
         }
-        if (1 == sscanf(line, "[%1020[^]]]", value)) {
+
+        if (line[0] == '[' && line[1] != ']' && line[1] != '\0') {
             /* section */
-            e = cfg_find_section(c, value);
+            value = line + 1;
+            value[strcspn(value, "]")] = '\0';
+            sec = cfg_find_section(value);
+            continue;
+        }
+
+        /* foo = bar */
+        tag = line;
+        while (is_space(*tag)) {
+            tag++;
+        }
+        value = tag + strcspn(tag, "= ");
+        if (value == tag) {
+            continue;
+        }
+        while (is_space(*value)) {
+            *value++ = '\0';
+        }
+        if (*value != '=') {
+            continue;
+        }
+        *value++ = '\0';
+        while (is_space(*value)) {
+            value++;
+        }
+        if (*value == '\0') { // Entries without a value are treated as missing
+            continue;
+        }
+
+        if (sec == 0) {
+            fprintf(stderr, "%s:%d: error: no section\n", filename, nr);
+        }
+        else {
+            cfg_set_entry(sec, tag, value);
         }
-        else if (2 == sscanf(line, " %63[^= ] = %1020[^\n]", tag, value)) {
-            /* foo = bar */
-            if (NULL == e) {
-                fprintf(stderr, "%s:%d: error: no section\n", filename, nr);
-            }
-            else {
-                cfg_set_entry(e, tag, value);
-            }
-        } /*else {
-        // Huh ?
-        fprintf(stderr,"%s:%d: syntax error\n",filename,nr);
-        }*/
     }
-    fclose(fp);
+
     return 0;
 }
 
@@ -192,60 +397,49 @@ char **cfg_list_sections(void)
 
 char **cfg_list_entries(const char *name)
 {
-    unsigned int i;
+    unsigned int sec = cfg_lookup_section(name, section_hash(name));
 
-    for (i = 0; i < c->sec_count; i++) {
-        if (0 == strcmp(c->sec_names[i], name)) {
-            return c->sec_entries[i]->ent_names;
-        }
-    }
-    return NULL;
+    return sec != 0 ? c->sections[sec].ent_names : NULL;
 }
 
-char *cfg_get_str(const char *sec, const char *ent, const char *def_val)
+unsigned int cfg_section_digest(const char *name)
 {
-    struct CFG_ENTRIES *e = NULL;
-    char *v = NULL;
-    unsigned int i;
+    unsigned int sec;
 
-    for (i = 0; i < c->sec_count; i++) {
-        if (strcmp(c->sec_names[i], sec) == 0) {
-            e = c->sec_entries[i];
-        }
+    if (c == NULL || (sec = cfg_lookup_section(name, section_hash(name))) == 0) {
+        return 0;
     }
-    if (e == NULL) {
-        if (def_val == NULL) {
-            return NULL;
-        }
-        else {
-            v = (char *)malloc(strlen(def_val) + 1);
-            strcpy(v, def_val);
-            return v;
-        }
-    }
-    for (i = 0; i < e->ent_count; i++) {
-        if (strcmp(e->ent_names[i], ent) == 0) {
-            v = e->ent_values[i];
-        }
+    return c->sections[sec].digest;
+}
+
+unsigned int cfg_entries_digest(const char *sec, const char **ents)
+{
+    const char *v;
+    uint32_t h = section_hash(sec);
+
+    for (int i = 0; ents[i] != NULL; i++) {
+        v = cfg_lookup(sec, ents[i]);
+        h = hash_str(h, ents[i]);
+        h = hash_str(h ^ (v != NULL ? 0x3d : 0x00), v != NULL ? v : "");
+        h = (h ^ 0xff) * 16777619u; // Keeps "a" + "bc" apart from "ab" + "c"
     }
+    return h;
+}
+
+char *cfg_get_str(const char *sec, const char *ent, const char *def_val)
+{
+    const char *v = cfg_lookup(sec, ent);
+
     if (v == NULL) {
-        if (def_val == NULL) {
-            return NULL;
-        }
-        else {
-            v = (char *)malloc(strlen(def_val) + 1);
-            strcpy(v, def_val);
-            return v;
-        }
+        v = def_val;
     }
-    return strdup(v);
+    return v != NULL ? strdup(v) : NULL;
 }
 
 int cfg_get_int(const char *sec, const char *ent, const int def_val)
 {
-    char *val;
+    const char *val = cfg_lookup(sec, ent);
 
-    val = cfg_get_str(sec, ent, NULL);
     if (val == NULL) {
         return def_val;
     }
@@ -254,9 +448,8 @@ int cfg_get_int(const char *sec, const char *ent, const int def_val)
 
 float cfg_get_float(const char *sec, const char *ent, const float def_val)
 {
-    char *val;
+    const char *val = cfg_lookup(sec, ent);
 
-    val = cfg_get_str(sec, ent, NULL);
     if (val == NULL) {
         return def_val;
     }
@@ -6,6 +6,12 @@
 int cfg_parse_file(const char *filename);
 char **cfg_list_sections(void);
 char **cfg_list_entries(const char *name);
+
+// Hash over all entries of a section in file order, 0 if the section does not exist.
+// Used to find the sections that have changed between two parses of the config file
+unsigned int cfg_section_digest(const char *name);
+// Same for the given NULL terminated list of entries of a section
+unsigned int cfg_entries_digest(const char *sec, const char **ents);
 char *cfg_get_str(const char *sec, const char *ent, const char *def_val);
 int cfg_get_int(const char *sec, const char *ent, const int def_val);
 float cfg_get_float(const char *sec, const char *ent, const float def_val);
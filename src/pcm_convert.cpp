@@ -0,0 +1,326 @@
+// pcm conversion functions for butt
+//
+// Copyright 2007-2018 by Daniel Noethen.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+
+#include <math.h>
+
+#include "pcm_convert.h"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define PCM_CONVERT_SSE2
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#define PCM_CONVERT_NEON
+#endif
+
+#define S16_MAX 32767.0f
+#define S16_MIN -32768.0f
+#define S24_MAX 8388607.0f
+#define S24_MIN -8388608.0f
+#define S32_MAX 2147483647.0
+#define S32_MIN -2147483648.0
+#define S32_SCALE 2147483648.0f // INT32_MAX and INT32_MIN both become 2^31 as float
+
+// Reference implementation. It produces exactly the same results as the
+// conversion loops the encoders had before: The product is calculated in float
+// precision, clamped and rounded in double precision.
+// NaN samples end up as the minimum value.
+static inline int32_t convert_sample(float x, float scale_pos, float scale_neg, double min, double max)
+{
+    if (x > 0) {
+        return (int32_t)round(fmin(x * scale_pos, max));
+    }
+    else {
+        return (int32_t)round(fmax(x * scale_neg, min));
+    }
+}
+
+#if defined(PCM_CONVERT_SSE2)
+// Converts 4 samples. min/max must be exactly representable as float.
+// Truncation followed by a correction of +-1 if the fractional part is >= 0.5 gives
+// the same result as round(). The subtraction is exact because |p| < 2^24
+static inline __m128i convert4(const float *in, __m128 scale_pos, __m128 scale_neg, __m128 min, __m128 max)
+{
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    const __m128i one = _mm_set1_epi32(1);
+
+    __m128 x = _mm_loadu_ps(in);
+    __m128 pos = _mm_cmpgt_ps(x, zero);
+    __m128 p = _mm_mul_ps(x, _mm_or_ps(_mm_and_ps(pos, scale_pos), _mm_andnot_ps(pos, scale_neg)));
+
+    p = _mm_max_ps(p, min); // maxps returns the second operand for NaN
+    p = _mm_min_ps(p, max);
+
+    __m128i t = _mm_cvttps_epi32(p);
+    __m128 frac = _mm_and_ps(_mm_sub_ps(p, _mm_cvtepi32_ps(t)), abs_mask);
+    __m128i round_away = _mm_castps_si128(_mm_cmpge_ps(frac, half));
+    __m128i step = _mm_or_si128(_mm_castps_si128(_mm_cmplt_ps(p, zero)), one); // -1 or +1
+
+    return _mm_add_epi32(t, _mm_and_si128(round_away, step));
+}
+
+// 32 bit needs special care because 2^31-1 has no float representation.
+// Floats >= 2^23 have no fractional part, so only the positive overflow must be handled
+static inline __m128i convert4_s32(const float *in)
+{
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    const __m128 min = _mm_set1_ps((float)S32_MIN);
+    const __m128 scale = _mm_set1_ps(S32_SCALE);
+    const __m128i one = _mm_set1_epi32(1);
+    const __m128i s32_max = _mm_set1_epi32(INT32_MAX);
+
+    __m128 x = _mm_loadu_ps(in);
+    __m128 p = _mm_max_ps(_mm_mul_ps(x, scale), min);
+    __m128i ovf = _mm_castps_si128(_mm_cmpge_ps(p, scale));
+
+    __m128i t = _mm_cvttps_epi32(p);
+    __m128 frac = _mm_and_ps(_mm_sub_ps(p, _mm_cvtepi32_ps(t)), abs_mask);
+    __m128i round_away = _mm_castps_si128(_mm_cmpge_ps(frac, half));
+    __m128i step = _mm_or_si128(_mm_castps_si128(_mm_cmplt_ps(p, zero)), one);
+    t = _mm_add_epi32(t, _mm_and_si128(round_away, step));
+
+    return _mm_or_si128(_mm_and_si128(ovf, s32_max), _mm_andnot_si128(ovf, t));
+}
+#elif defined(PCM_CONVERT_NEON)
+static inline int32x4_t convert4(const float *in, float32x4_t scale_pos, float32x4_t scale_neg, float32x4_t min, float32x4_t max)
+{
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x4_t half = vdupq_n_f32(0.5f);
+    const int32x4_t one = vdupq_n_s32(1);
+
+    float32x4_t x = vld1q_f32(in);
+    float32x4_t p = vmulq_f32(x, vbslq_f32(vcgtq_f32(x, zero), scale_pos, scale_neg));
+
+    p = vmaxnmq_f32(p, min); // maxnm returns the number for NaN
+    p = vminq_f32(p, max);
+
+    // vcvtq_s32_f32 truncates and saturates, so the 32 bit overflow is handled as well
+    int32x4_t t = vcvtq_s32_f32(p);
+    float32x4_t frac = vabsq_f32(vsubq_f32(p, vcvtq_f32_s32(t)));
+    int32x4_t round_away = vreinterpretq_s32_u32(vcgeq_f32(frac, half));
+    int32x4_t step = vorrq_s32(vreinterpretq_s32_u32(vcltq_f32(p, zero)), one);
+
+    return vaddq_s32(t, vandq_s32(round_away, step));
+}
+#endif
+
+void pcm_float_to_s16(const float *in, int16_t *out, size_t samples)
+{
+    size_t i = 0;
+
+#if defined(PCM_CONVERT_SSE2)
+    const __m128 scale_pos = _mm_set1_ps(S16_MAX);
+    const __m128 scale_neg = _mm_set1_ps(-S16_MIN);
+    const __m128 min = _mm_set1_ps(S16_MIN);
+    const __m128 max = _mm_set1_ps(S16_MAX);
+
+    for (; i + 4 <= samples; i += 4) {
+        __m128i t = convert4(in + i, scale_pos, scale_neg, min, max);
+        _mm_storel_epi64((__m128i *)(out + i), _mm_packs_epi32(t, t));
+    }
+#elif defined(PCM_CONVERT_NEON)
+    const float32x4_t scale_pos = vdupq_n_f32(S16_MAX);
+    const float32x4_t scale_neg = vdupq_n_f32(-S16_MIN);
+    const float32x4_t min = vdupq_n_f32(S16_MIN);
+    const float32x4_t max = vdupq_n_f32(S16_MAX);
+
+    for (; i + 4 <= samples; i += 4) {
+        vst1_s16(out + i, vqmovn_s32(convert4(in + i, scale_pos, scale_neg, min, max)));
+    }
+#endif
+
+    for (; i < samples; i++) {
+        out[i] = (int16_t)convert_sample(in[i], S16_MAX, -S16_MIN, S16_MIN, S16_MAX);
+    }
+}
+
+static void float_to_int32(const float *in, int32_t *out, size_t samples, float max_val, float min_val)
+{
+    size_t i = 0;
+
+#if defined(PCM_CONVERT_SSE2)
+    const __m128 scale_pos = _mm_set1_ps(max_val);
+    const __m128 scale_neg = _mm_set1_ps(-min_val);
+    const __m128 min = _mm_set1_ps(min_val);
+    const __m128 max = _mm_set1_ps(max_val);
+
+    for (; i + 4 <= samples; i += 4) {
+        _mm_storeu_si128((__m128i *)(out + i), convert4(in + i, scale_pos, scale_neg, min, max));
+    }
+#elif defined(PCM_CONVERT_NEON)
+    const float32x4_t scale_pos = vdupq_n_f32(max_val);
+    const float32x4_t scale_neg = vdupq_n_f32(-min_val);
+    const float32x4_t min = vdupq_n_f32(min_val);
+    const float32x4_t max = vdupq_n_f32(max_val);
+
+    for (; i + 4 <= samples; i += 4) {
+        vst1q_s32(out + i, convert4(in + i, scale_pos, scale_neg, min, max));
+    }
+#endif
+
+    for (; i < samples; i++) {
+        out[i] = convert_sample(in[i], max_val, -min_val, min_val, max_val);
+    }
+}
+
+void pcm_float_to_int32(const float *in, int32_t *out, size_t samples, int bit_depth)
+{
+    switch (bit_depth) {
+    case 16:
+        float_to_int32(in, out, samples, S16_MAX, S16_MIN);
+        break;
+    case 24:
+        float_to_int32(in, out, samples, S24_MAX, S24_MIN);
+        break;
+    default:
+        pcm_float_to_s32(in, out, samples);
+        break;
+    }
+}
+
+// The output is 3/4 of the input size. Each block is completely read before
+// it is written, so the conversion can be done in-place
+void pcm_float_to_s24le(const float *in, uint8_t *out, size_t samples)
+{
+    size_t i = 0;
+    int32_t s;
+
+#if defined(PCM_CONVERT_SSE2) || defined(PCM_CONVERT_NEON)
+    int32_t block[4];
+
+#if defined(PCM_CONVERT_SSE2)
+    const __m128 scale_pos = _mm_set1_ps(S24_MAX);
+    const __m128 scale_neg = _mm_set1_ps(-S24_MIN);
+    const __m128 min = _mm_set1_ps(S24_MIN);
+    const __m128 max = _mm_set1_ps(S24_MAX);
+#else
+    const float32x4_t scale_pos = vdupq_n_f32(S24_MAX);
+    const float32x4_t scale_neg = vdupq_n_f32(-S24_MIN);
+    const float32x4_t min = vdupq_n_f32(S24_MIN);
+    const float32x4_t max = vdupq_n_f32(S24_MAX);
+#endif
+
+    for (; i + 4 <= samples; i += 4) {
+#if defined(PCM_CONVERT_SSE2)
+        _mm_storeu_si128((__m128i *)block, convert4(in + i, scale_pos, scale_neg, min, max));
+#else
+        vst1q_s32(block, convert4(in + i, scale_pos, scale_neg, min, max));
+#endif
+        for (int j = 0; j < 4; j++) {
+            out[(i + j) * 3 + 0] = (uint8_t)(block[j]);       // lsb
+            out[(i + j) * 3 + 1] = (uint8_t)(block[j] >> 8);  // center byte
+            out[(i + j) * 3 + 2] = (uint8_t)(block[j] >> 16); // msb
+        }
+    }
+#endif
+
+    for (; i < samples; i++) {
+        s = convert_sample(in[i], S24_MAX, -S24_MIN, S24_MIN, S24_MAX);
+        out[i * 3 + 0] = (uint8_t)(s);
+        out[i * 3 + 1] = (uint8_t)(s >> 8);
+        out[i * 3 + 2] = (uint8_t)(s >> 16);
+    }
+}
+
+void pcm_float_to_s32(const float *in, int32_t *out, size_t samples)
+{
+    size_t i = 0;
+
+#if defined(PCM_CONVERT_SSE2)
+    for (; i + 4 <= samples; i += 4) {
+        _mm_storeu_si128((__m128i *)(out + i), convert4_s32(in + i));
+    }
+#elif defined(PCM_CONVERT_NEON)
+    const float32x4_t scale = vdupq_n_f32(S32_SCALE);
+    const float32x4_t min = vdupq_n_f32((float)S32_MIN);
+
+    for (; i + 4 <= samples; i += 4) {
+        vst1q_s32(out + i, convert4(in + i, scale, scale, min, scale)); // vcvtq_s32_f32 saturates 2^31
+    }
+#endif
+
+    for (; i < samples; i++) {
+        out[i] = convert_sample(in[i], S32_SCALE, S32_SCALE, S32_MIN, S32_MAX);
+    }
+}
+
+void pcm_deinterleave_stereo(const float *in, float *left, float *right, size_t frames)
+{
+    size_t i = 0;
+
+#if defined(PCM_CONVERT_SSE2)
+    for (; i + 4 <= frames; i += 4) {
+        __m128 a = _mm_loadu_ps(in + i * 2);     // L0 R0 L1 R1
+        __m128 b = _mm_loadu_ps(in + i * 2 + 4); // L2 R2 L3 R3
+        _mm_storeu_ps(left + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(right + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+    }
+#elif defined(PCM_CONVERT_NEON)
+    for (; i + 4 <= frames; i += 4) {
+        float32x4x2_t lr = vld2q_f32(in + i * 2);
+        vst1q_f32(left + i, lr.val[0]);
+        vst1q_f32(right + i, lr.val[1]);
+    }
+#endif
+
+    for (; i < frames; i++) {
+        left[i] = in[i * 2];
+        right[i] = in[i * 2 + 1];
+    }
+}
+
+void pcm_deinterleave(const float *in, float *const *out, int channels, size_t frames)
+{
+    int c = 0;
+
+    if (channels == 2) {
+        pcm_deinterleave_stereo(in, out[0], out[1], frames);
+        return;
+    }
+
+#if defined(PCM_CONVERT_SSE2)
+    // Transposes blocks of 4 frames x 4 channels, so every store writes 4 consecutive samples of one channel
+    for (; c + 4 <= channels; c += 4) {
+        size_t i = 0;
+        for (; i + 4 <= frames; i += 4) {
+            __m128 r0 = _mm_loadu_ps(in + (i + 0) * channels + c);
+            __m128 r1 = _mm_loadu_ps(in + (i + 1) * channels + c);
+            __m128 r2 = _mm_loadu_ps(in + (i + 2) * channels + c);
+            __m128 r3 = _mm_loadu_ps(in + (i + 3) * channels + c);
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+            _mm_storeu_ps(out[c] + i, r0);
+            _mm_storeu_ps(out[c + 1] + i, r1);
+            _mm_storeu_ps(out[c + 2] + i, r2);
+            _mm_storeu_ps(out[c + 3] + i, r3);
+        }
+        for (; i < frames; i++) {
+            for (int k = 0; k < 4; k++) {
+                out[c + k][i] = in[i * channels + c + k];
+            }
+        }
+    }
+#endif
+
+    for (; c < channels; c++) {
+        float *dst = out[c];
+        for (size_t i = 0; i < frames; i++) {
+            dst[i] = in[i * channels + c];
+        }
+    }
+}
@@ -0,0 +1,37 @@
+// pcm conversion functions for butt
+//
+// Copyright 2007-2018 by Daniel Noethen.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+
+#ifndef PCM_CONVERT_H
+#define PCM_CONVERT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Converts float samples (-1.0 ... 1.0) to integer samples.
+// Positive values are scaled by 2^(n-1)-1, negative values by 2^(n-1).
+// Values outside of the valid range are saturated and rounded half away from zero.
+// All functions may be called in-place (out <= in), which is how the encoders use them.
+void pcm_float_to_s16(const float *in, int16_t *out, size_t samples);
+void pcm_float_to_int32(const float *in, int32_t *out, size_t samples, int bit_depth); // 16/24/32 bit value in the lower bits of an int32 (FLAC)
+void pcm_float_to_s24le(const float *in, uint8_t *out, size_t samples); // Packed 3 byte little endian (WAV)
+void pcm_float_to_s32(const float *in, int32_t *out, size_t samples);
+
+// Splits interleaved stereo frames into two planar channel buffers
+void pcm_deinterleave_stereo(const float *in, float *left, float *right, size_t frames);
+
+// Splits interleaved frames of <channels> channels into one planar buffer per channel (out[0] ... out[channels - 1])
+void pcm_deinterleave(const float *in, float *const *out, int channels, size_t frames);
+
+#endif
@@ -41,6 +41,11 @@
 #include "webrtc.h"
 #include "strfuncs.h"
 #include "wav_header.h"
+#include "pcm_convert.h"
+#include "enc_stats.h"
+#include "metrics.h"
+#include "trace.h"
+#include "mp3_burst.h"
 #include "ringbuffer.h"
 #include "vu_meter.h"
 #include "flgui.h"
@@ -53,11 +58,13 @@
 #include "aes67_output.h"
 #include "blackhole_output.h"
 #include "timer.h"
+#include "loudness.h"
+#include "multitrack.h"
+#include "level_detect.h"
+#include "dev_cache.h"
 
 #define TEST_RESAMPLING 0
-
-// [PATCH SYNCHRONISATION] Déclaration de fonction pour VU-meter POST-StereoTool
-void update_vu_buffers_post_stereotool(float *stream_buffer, float *record_buffer, int frame_size);
+#define SND_DEV_CACHE_SUFFIX ".devices" // The device cache is stored next to the config file
 
 // AES67 initialization function
 void snd_init_aes67(void);
@@ -109,8 +116,111 @@ SRC_DATA srconv_dev2;
 ATOM_NEW_COND(stream_cond);
 ATOM_NEW_COND(rec_cond);
 
+ENC_STATS_NEW(stream_enc_stats, "stream", METRIC_ENCODER_STREAM, METRIC_ENCODER_WAIT_STREAM);
+ENC_STATS_NEW(rec_enc_stats, "recording", METRIC_ENCODER_REC, METRIC_ENCODER_WAIT_REC);
+
+// Encoded mp3 frames that are sent again after a reconnect
+static MP3_BURST_NEW(mp3_stream_burst);
+
+// Loudness of the streamed signal, measured by the mixer thread
+static loudness_t stream_loudness;
+
+// metrics_now_us() after the first mixed block, written by the mixer only
+static uint64_t first_block_us;
+
 ATOM_NEW_INT(close_mixer_thread, 0);
 
+static const int snd_samplerates[SND_NUM_OF_SR] = {8000, 11025, 12000, 16000, 22050, 24000, 32000, 44100, 48000, 88200, 96000};
+
+// PortAudio is not thread-safe. Held by the refresh thread while it probes a samplerate and
+// by every format check, open, start and close of a stream
+static pthread_mutex_t probe_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static PaError snd_is_format_supported(const PaStreamParameters *params, double samplerate)
+{
+    PaError err;
+
+    pthread_mutex_lock(&probe_mutex);
+    err = Pa_IsFormatSupported(params, NULL, samplerate);
+    pthread_mutex_unlock(&probe_mutex);
+
+    return err;
+}
+
+static void snd_start_stream(PaStream *s)
+{
+    pthread_mutex_lock(&probe_mutex);
+    Pa_StartStream(s);
+    pthread_mutex_unlock(&probe_mutex);
+}
+
+static void snd_abort_and_close_stream(PaStream *s)
+{
+    pthread_mutex_lock(&probe_mutex);
+    Pa_AbortStream(s);
+    Pa_CloseStream(s);
+    pthread_mutex_unlock(&probe_mutex);
+}
+
+// Background refresh of the device list. refresh_list is owned by the refresh thread while it is running
+typedef struct {
+    int dev_id;
+    int channels;
+    double latency;
+    char *key;
+    int sr_list[SND_NUM_OF_SR + 1];
+    int num_of_sr; // -1 = not probed
+} snd_refresh_t;
+
+static snd_refresh_t *refresh_list = NULL;
+static int refresh_count = 0;
+static int refresh_running = 0; // Main thread only
+static int refresh_cancel = 0;
+static const char *refresh_cache_path = NULL;
+static void (*refresh_done)(void) = NULL;
+static pthread_t refresh_thread;
+
+// The primary device writes into one of two input slots. A hot switch opens the new device on the idle slot
+// while the old one keeps running, the mixer then crossfades from one to the other within one block
+typedef struct {
+    ringbuf_t *rb;
+    float *buf;   // Conversion buffer of the callback
+    int channels; // Input channels of the device
+    float *dev_buf;  // Planar device channels for the multitrack bus, NULL if there is no bus
+    float **dev_ch;  // One pointer into dev_buf per device channel
+    float *mt_buf;   // Interleaved bus frames
+} snd_input_t;
+
+enum {
+    SND_SWITCH_IDLE = 0,
+    SND_SWITCH_PENDING = 1, // The new device is running, the mixer hands over as soon as it has delivered a block
+    SND_SWITCH_HANDOFF = 2, // The mixer is crossfading
+    SND_SWITCH_DONE = 3,    // The mixer reads from the new device, the old one can be closed
+};
+
+#define SND_SWITCH_TIMEOUT_MS 2000 // How long the new device may take to deliver its first block
+
+static ringbuf_t pa_switch_rb;
+static float *pa_switch_buf;
+static float *pa_switch_mix_buf;
+static snd_input_t primary_inputs[2];
+static int active_input = 0;              // Main thread only
+static ringbuf_t *primary_rb = &pa_pcm_rb; // Mixer thread only while the mixer is running
+static snd_input_t *switch_input = NULL; // Input slot of the device that snd_switch_primary_device() has opened
+static int switch_state = SND_SWITCH_IDLE;
+static int primary_is_asio = 0; // Two ASIO devices can not be open at the same time
+
+// Multitrack bus (see multitrack.h), set up by snd_open_streams() and constant while the streams are open.
+// The callback of the input slot mt_input feeds mt_rb, the multitrack thread sends it to the multichannel outputs
+static mt_routing_t mt_routing;
+static int mt_aes67 = 0; // 1 = AES67 carries the bus instead of the program
+static ringbuf_t mt_rb;
+static float *mt_buf;
+static snd_input_t *mt_input = NULL;
+static pthread_t mt_thread;
+static int mt_thread_running = 0;
+ATOM_NEW_INT(close_mt_thread, 0);
+
 pthread_t rec_thread_detached;
 pthread_t stream_thread_detached;
 pthread_t mixer_thread_joinable;
@@ -154,6 +264,52 @@ int snd_init(void)
     return 0;
 }
 
+// Falls back to channel 1 (and 2) if the selected channels do not exist on a device with <channels> input channels
+static void fit_input_channels(int channels, int *left_ch, int *right_ch)
+{
+    if (channels == 1) {
+        *left_ch = 1;
+        *right_ch = 1;
+    }
+    else if ((*left_ch > channels) || (*right_ch > channels)) {
+        *left_ch = 1;
+        *right_ch = 2;
+    }
+}
+
+static void free_input_bus(snd_input_t *in)
+{
+    free(in->dev_buf);
+    free(in->dev_ch);
+    free(in->mt_buf);
+    in->dev_buf = NULL;
+    in->dev_ch = NULL;
+    in->mt_buf = NULL;
+}
+
+// Sizes the multitrack buffers of an input slot for a device with <channels> channels.
+// Must not be called while a callback uses the slot
+static void alloc_input_bus(snd_input_t *in, int channels)
+{
+    free_input_bus(in);
+
+    if (mt_routing.channels == 0) {
+        return;
+    }
+
+    in->dev_buf = (float *)malloc(channels * pa_frames * sizeof(float));
+    in->dev_ch = (float **)malloc(channels * sizeof(float *));
+    in->mt_buf = (float *)malloc(mt_routing.channels * pa_frames * sizeof(float));
+    if (in->dev_buf == NULL || in->dev_ch == NULL || in->mt_buf == NULL) {
+        free_input_bus(in);
+        return;
+    }
+
+    for (int i = 0; i < channels; i++) {
+        in->dev_ch[i] = in->dev_buf + i * pa_frames;
+    }
+}
+
 int snd_reopen_streams(void)
 {
     snd_close_streams();
@@ -163,6 +319,101 @@ int snd_reopen_streams(void)
     return 0;
 }
 
+int snd_switch_primary_device(void)
+{
+    int next_input = 1 - active_input;
+    int waited_ms = 0;
+    int expected = SND_SWITCH_PENDING;
+    int flag;
+    char info_buf[256];
+    snd_input_t *in = &primary_inputs[next_input];
+    snd_dev_t *dev;
+    PaStream *new_stream;
+    PaStreamParameters pa_params;
+    PaError pa_err;
+    const PaDeviceInfo *pa_dev_info;
+
+    if (stream == NULL || Pa_IsStreamActive(stream) != 1 || __atomic_load_n(&switch_state, __ATOMIC_ACQUIRE) != SND_SWITCH_IDLE) {
+        return 1;
+    }
+
+    if (cfg.audio.dev_remember == REMEMBER_BY_NAME) {
+        cfg.audio.dev_num = snd_get_dev_num_by_name(cfg.audio.dev_name);
+    }
+    if (cfg.audio.dev_num < 0) {
+        return 1;
+    }
+
+    dev = cfg.audio.pcm_list[cfg.audio.dev_num];
+    if (dev->is_asio && primary_is_asio) {
+        return 1;
+    }
+
+    pa_dev_info = Pa_GetDeviceInfo(dev->dev_id);
+    if (pa_dev_info == NULL || pa_dev_info->maxInputChannels < 1) {
+        return 1;
+    }
+
+    pa_params.device = dev->dev_id;
+    pa_params.channelCount = pa_dev_info->maxInputChannels;
+    pa_params.sampleFormat = paFloat32;
+    pa_params.suggestedLatency = pa_dev_info->defaultHighInputLatency;
+    pa_params.hostApiSpecificStreamInfo = NULL;
+
+    // A different samplerate changes the size of everything behind the device, that needs a full reopen
+    if (snd_is_format_supported(&pa_params, cfg.audio.samplerate) != paFormatIsSupported) {
+        return 1;
+    }
+
+    fit_input_channels(pa_dev_info->maxInputChannels, &cfg.audio.left_ch, &cfg.audio.right_ch);
+    in->channels = pa_dev_info->maxInputChannels;
+    alloc_input_bus(in, in->channels);
+    rb_clear(in->rb);
+
+    flag = cfg.audio.disable_dithering == 0 ? paNoFlag : paDitherOff;
+    pthread_mutex_lock(&probe_mutex);
+    pa_err = Pa_OpenStream(&new_stream, &pa_params, NULL, cfg.audio.samplerate, pa_frames, flag, snd_callback, in);
+    pthread_mutex_unlock(&probe_mutex);
+    if (pa_err != paNoError) {
+        snprintf(info_buf, sizeof(info_buf), _("error opening sound device: %s"), Pa_GetErrorText(pa_err));
+        print_info(info_buf, 1);
+        return 1;
+    }
+
+    switch_input = in;
+    __atomic_store_n(&switch_state, SND_SWITCH_PENDING, __ATOMIC_RELEASE);
+
+    pthread_mutex_lock(&probe_mutex);
+    pa_err = Pa_StartStream(new_stream);
+    pthread_mutex_unlock(&probe_mutex);
+    if (pa_err != paNoError) {
+        waited_ms = SND_SWITCH_TIMEOUT_MS;
+    }
+
+    // The old device keeps feeding the mixer until the new one has delivered its first block
+    while (__atomic_load_n(&switch_state, __ATOMIC_ACQUIRE) != SND_SWITCH_DONE) {
+        if (waited_ms >= SND_SWITCH_TIMEOUT_MS &&
+            __atomic_compare_exchange_n(&switch_state, &expected, SND_SWITCH_IDLE, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            snd_abort_and_close_stream(new_stream);
+            print_info(_("The new audio device did not deliver any audio"), 1);
+            return 1;
+        }
+        expected = SND_SWITCH_PENDING;
+        Pa_Sleep(1); // ms
+        waited_ms++;
+    }
+
+    snd_abort_and_close_stream(stream);
+
+    stream = new_stream;
+    active_input = next_input;
+    num_of_input_channels = in->channels;
+    primary_is_asio = dev->is_asio;
+    __atomic_store_n(&switch_state, SND_SWITCH_IDLE, __ATOMIC_RELEASE);
+
+    return 0;
+}
+
 void snd_init_dsp(void)
 {
     const char* skip_st_env = getenv("BUTT_SKIP_ST");
@@ -271,14 +522,7 @@ int snd_open_streams(void)
     }
 
     num_of_input_channels = pa_dev_info->maxInputChannels;
-    if (num_of_input_channels == 1) {
-        cfg.audio.left_ch = 1;
-        cfg.audio.right_ch = 1;
-    }
-    else if ((cfg.audio.left_ch > num_of_input_channels) || (cfg.audio.right_ch > num_of_input_channels)) {
-        cfg.audio.left_ch = 1;
-        cfg.audio.right_ch = 2;
-    }
+    fit_input_channels(num_of_input_channels, &cfg.audio.left_ch, &cfg.audio.right_ch);
 
     framepacket_size = pa_frames * cfg.audio.channel;
 
@@ -321,6 +565,34 @@ int snd_open_streams(void)
     rb_init(&rec_rb, total_buffer_frames * framepacket_size * sizeof(float));
     rb_init(&stream_rb, total_buffer_frames * framepacket_size * sizeof(float));
     rb_init(&pa_pcm_rb, total_buffer_frames * framepacket_size * sizeof(float));
+
+    // Allocated up front, so switching the primary device does not allocate while audio is running
+    pa_switch_buf = (float *)malloc(2 * framepacket_size * sizeof(float));
+    pa_switch_mix_buf = (float *)malloc(2 * framepacket_size * sizeof(float));
+    rb_init(&pa_switch_rb, total_buffer_frames * framepacket_size * sizeof(float));
+
+    primary_inputs[0].rb = &pa_pcm_rb;
+    primary_inputs[0].buf = pa_pcm_buf;
+    primary_inputs[0].channels = num_of_input_channels;
+    primary_inputs[1].rb = &pa_switch_rb;
+    primary_inputs[1].buf = pa_switch_buf;
+    primary_inputs[1].channels = 0;
+
+    if (mt_routing_parse(&mt_routing, cfg.multitrack.channels, cfg.multitrack.route, cfg.multitrack.downmix) != 0) {
+        print_info(_("Multitrack: Invalid route or downmix, using the default routing"), 1);
+    }
+    mt_aes67 = mt_routing.channels > 0 && cfg.multitrack.aes67;
+    if (mt_routing.channels > 0) {
+        mt_buf = (float *)malloc(mt_routing.channels * pa_frames * sizeof(float));
+        rb_init(&mt_rb, total_buffer_frames * mt_routing.channels * pa_frames * sizeof(float));
+    }
+    alloc_input_bus(&primary_inputs[0], num_of_input_channels);
+    __atomic_store_n(&mt_input, &primary_inputs[0], __ATOMIC_RELEASE);
+
+    active_input = 0;
+    primary_is_asio = cfg.audio.pcm_list[cfg.audio.dev_num]->is_asio;
+    primary_rb = &pa_pcm_rb;
+    switch_state = SND_SWITCH_IDLE;
     
     printf("Audio Buffers: Taille ajustée à %d frames (base=%d + StereoTool=%d + marge=8)\n", 
            total_buffer_frames, base_buffer_frames, stereo_tool_latency_frames);
@@ -331,7 +603,7 @@ int snd_open_streams(void)
     pa_params.suggestedLatency = pa_dev_info->defaultHighInputLatency;
     pa_params.hostApiSpecificStreamInfo = NULL;
 
-    pa_err = Pa_IsFormatSupported(&pa_params, NULL, cfg.audio.samplerate);
+    pa_err = snd_is_format_supported(&pa_params, cfg.audio.samplerate);
     if (pa_err != paFormatIsSupported) {
         if (pa_err == paInvalidSampleRate) {
             snprintf(info_buf, sizeof(info_buf),
@@ -340,7 +612,7 @@ int snd_open_streams(void)
                      cfg.audio.samplerate, (int)pa_dev_info->defaultSampleRate);
             print_info(info_buf, 1);
 
-            if (Pa_IsFormatSupported(&pa_params, NULL, pa_dev_info->defaultSampleRate) != paFormatIsSupported) {
+            if (snd_is_format_supported(&pa_params, pa_dev_info->defaultSampleRate) != paFormatIsSupported) {
                 print_info("FAILED", 1);
                 ret = 1;
                 goto cleanup1;
@@ -360,7 +632,9 @@ int snd_open_streams(void)
     }
 
     flag = cfg.audio.disable_dithering == 0 ? paNoFlag : paDitherOff;
-    pa_err = Pa_OpenStream(&stream, &pa_params, NULL, cfg.audio.samplerate, pa_frames, flag, snd_callback, NULL);
+    pthread_mutex_lock(&probe_mutex);
+    pa_err = Pa_OpenStream(&stream, &pa_params, NULL, cfg.audio.samplerate, pa_frames, flag, snd_callback, &primary_inputs[0]);
+    pthread_mutex_unlock(&probe_mutex);
     if (pa_err != paNoError) {
         snprintf(info_buf, sizeof(info_buf), _("error opening sound device: %s"), Pa_GetErrorText(pa_err));
         print_info(info_buf, 1);
@@ -390,14 +664,7 @@ int snd_open_streams(void)
         }
 
         num_of_input_channels2 = pa_dev_info->maxInputChannels;
-        if (num_of_input_channels2 == 1) {
-            cfg.audio.left_ch2 = 1;
-            cfg.audio.right_ch2 = 1;
-        }
-        else if ((cfg.audio.left_ch2 > num_of_input_channels2) || (cfg.audio.right_ch2 > num_of_input_channels2)) {
-            cfg.audio.left_ch2 = 1;
-            cfg.audio.right_ch2 = 2;
-        }
+        fit_input_channels(num_of_input_channels2, &cfg.audio.left_ch2, &cfg.audio.right_ch2);
 
         pa_params2.device = pa_dev_id;
         pa_params2.channelCount = num_of_input_channels2;
@@ -405,7 +672,7 @@ int snd_open_streams(void)
         pa_params2.suggestedLatency = pa_dev_info->defaultHighInputLatency;
         pa_params2.hostApiSpecificStreamInfo = NULL;
 
-        pa_err = Pa_IsFormatSupported(&pa_params2, NULL, cfg.audio.samplerate);
+        pa_err = snd_is_format_supported(&pa_params2, cfg.audio.samplerate);
 #if TEST_RESAMPLING == 1
         if (pa_err == paFormatIsSupported) {
             if (pa_err != paInvalidSampleRate) {
@@ -415,10 +682,10 @@ int snd_open_streams(void)
 #endif
 
 #if TEST_RESAMPLING == 1
-                if (Pa_IsFormatSupported(&pa_params2, NULL, 44100) != paFormatIsSupported) {
+                if (snd_is_format_supported(&pa_params2, 44100) != paFormatIsSupported) {
 #else
                 // Use default sample rate of secondary audio device and resample to cfg.audio.samplerate
-                if (Pa_IsFormatSupported(&pa_params2, NULL, pa_dev_info->defaultSampleRate) != paFormatIsSupported) {
+                if (snd_is_format_supported(&pa_params2, pa_dev_info->defaultSampleRate) != paFormatIsSupported) {
 #endif
                     print_info(_("The selected secondary audio device can not be used"), 1);
                     ret = 1;
@@ -472,7 +739,9 @@ int snd_open_streams(void)
         srconv_dev2.data_in = pa_pcm_buf2;
 
         int flag = cfg.audio.disable_dithering == 0 ? paNoFlag : paDitherOff;
+        pthread_mutex_lock(&probe_mutex);
         pa_err = Pa_OpenStream(&stream2, &pa_params2, NULL, samplerate_dev2, frames_in_dev2, flag, snd_callback2, NULL);
+        pthread_mutex_unlock(&probe_mutex);
 
         if (pa_err != paNoError) {
             snprintf(info_buf, sizeof(info_buf), _("error opening secondary sound device: %s"), Pa_GetErrorText(pa_err));
@@ -481,10 +750,10 @@ int snd_open_streams(void)
             goto cleanup2;
         }
 
-        Pa_StartStream(stream2);
+        snd_start_stream(stream2);
     }
 
-    Pa_StartStream(stream);
+    snd_start_stream(stream);
 
     // Initialize StereoTool FIRST if enabled
     if (cfg.stereo_tool.enabled_stream || cfg.stereo_tool.enabled_rec) {
@@ -495,6 +764,7 @@ int snd_open_streams(void)
     
     snd_init_dsp();
     snd_start_mixer_thread();
+    snd_start_multitrack_thread();
 
     g_vu_meter_timer_is_active = 1;
     Fl::add_timeout(0.01, &vu_meter_timer);
@@ -510,9 +780,11 @@ cleanup2:
     rb_free(&pa_pcm2_rb);
 
 cleanup1:
+    pthread_mutex_lock(&probe_mutex);
     if (Pa_IsStreamStopped(&stream)) { // Primary stream has been opened but not started yet
         Pa_CloseStream(&stream);
     }
+    pthread_mutex_unlock(&probe_mutex);
     free(pa_pcm_buf);
     free(pa_mixer_buf);
     free(stream_buf);
@@ -521,9 +793,18 @@ cleanup1:
     free(srconv_opus_stream.data_out);
     free(srconv_opus_record.data_out);
     free(srconv_dev2.data_out);
+    free(pa_switch_buf);
+    free(pa_switch_mix_buf);
+    free_input_bus(&primary_inputs[0]);
+    free_input_bus(&primary_inputs[1]);
     rb_free(&rec_rb);
     rb_free(&stream_rb);
     rb_free(&pa_pcm_rb);
+    rb_free(&pa_switch_rb);
+    if (mt_routing.channels > 0) {
+        free(mt_buf);
+        rb_free(&mt_rb);
+    }
 
     return ret;
 }
@@ -533,53 +814,81 @@ int snd_callback(const void *input, void *output, unsigned long frameCount, cons
                  void *userData)
 {
     float *pcm_input = (float *)input;
+    snd_input_t *in = (snd_input_t *)userData;
+    float *pcm_buf = in->buf;
+    int channels = in->channels;
 
-    if (statusFlags != 0) {
-        printf("1 status: %lu\n", statusFlags);
+    // No printf() here, this runs in the realtime audio thread
+    if (statusFlags & paInputOverflow) {
+        metrics_inc(METRIC_XRUNS_DEV1_INPUT_OVERFLOW);
+    }
+    if (statusFlags & paInputUnderflow) {
+        metrics_inc(METRIC_XRUNS_DEV1_INPUT_UNDERFLOW);
+    }
+
+    if (in->dev_ch != NULL && frameCount <= (unsigned long)pa_frames) {
+        pcm_deinterleave(pcm_input, in->dev_ch, channels, frameCount);
+
+        // During a device switch only the device the mixer reads from feeds the bus
+        if (__atomic_load_n(&mt_input, __ATOMIC_ACQUIRE) == in) {
+            int len = mt_routing.channels * frameCount * sizeof(float);
+            mt_interleave(&mt_routing, in->dev_ch, channels, in->mt_buf, frameCount);
+            if (rb_space(&mt_rb) >= len) { // A full rb_write() would overwrite unread frames
+                rb_write(&mt_rb, (char *)in->mt_buf, len);
+            }
+        }
+
+        if (mt_routing.has_downmix) {
+            mt_mix_program(&mt_routing, in->dev_ch, channels, pcm_buf, cfg.audio.channel, frameCount);
+            rb_write(in->rb, (char *)pcm_buf, (int)(cfg.audio.channel * frameCount * sizeof(float)));
+            return paContinue;
+        }
     }
 
     if (cfg.audio.channel == 1) { // User has selected mono
         for (uint32_t i = 0; i < frameCount; i++) {
-            if (num_of_input_channels == 1) { // If the device has only one channel use that channel as mono input source
-                pa_pcm_buf[i] = pcm_input[i];
+            if (channels == 1) { // If the device has only one channel use that channel as mono input source
+                pcm_buf[i] = pcm_input[i];
             }
             else { // If the device has more than one channel, average the user selected left and right channel into a mono channel
                 float left_sample, right_sample;
                 float mono_sample;
-                left_sample = pcm_input[num_of_input_channels * i + (cfg.audio.left_ch - 1)];
-                right_sample = pcm_input[num_of_input_channels * i + (cfg.audio.right_ch - 1)];
+                left_sample = pcm_input[channels * i + (cfg.audio.left_ch - 1)];
+                right_sample = pcm_input[channels * i + (cfg.audio.right_ch - 1)];
                 mono_sample = (left_sample + right_sample) / 2.0;
-                pa_pcm_buf[i] = mono_sample;
+                pcm_buf[i] = mono_sample;
             }
         }
-        rb_write(&pa_pcm_rb, (char *)pa_pcm_buf, (int)(1 * frameCount * sizeof(float)));
+        rb_write(in->rb, (char *)pcm_buf, (int)(1 * frameCount * sizeof(float)));
     }
     else { // User has selected stereo
         for (uint32_t i = 0; i < frameCount; i++) {
-            if (num_of_input_channels == 1) { // If the device has only one channel, use the same channel for left and right
-                pa_pcm_buf[2 * i] = pcm_input[i];
-                pa_pcm_buf[2 * i + 1] = pcm_input[i];
+            if (channels == 1) { // If the device has only one channel, use the same channel for left and right
+                pcm_buf[2 * i] = pcm_input[i];
+                pcm_buf[2 * i + 1] = pcm_input[i];
             }
             else { // If the device has more than one channel, use the selected left and right channel as input source
-                pa_pcm_buf[2 * i] = pcm_input[num_of_input_channels * i + (cfg.audio.left_ch - 1)];
-                pa_pcm_buf[2 * i + 1] = pcm_input[num_of_input_channels * i + (cfg.audio.right_ch - 1)];
+                pcm_buf[2 * i] = pcm_input[channels * i + (cfg.audio.left_ch - 1)];
+                pcm_buf[2 * i + 1] = pcm_input[channels * i + (cfg.audio.right_ch - 1)];
             }
         }
         // 🔍 DIAGNOSTIC: Vérifier l'audio d'entrée dans le callback
         static int callback_debug = 0;
-        if (callback_debug < 10) {
+        if (TRACE_ON(TRACE_DEBUG) && callback_debug < 10) {
             float max_input = 0.0f;
             for (uint32_t i = 0; i < frameCount && i < 100; i++) {
-                if (fabs(pa_pcm_buf[2*i]) > max_input) max_input = fabs(pa_pcm_buf[2*i]);
-                if (fabs(pa_pcm_buf[2*i+1]) > max_input) max_input = fabs(pa_pcm_buf[2*i+1]);
+                if (fabs(pcm_buf[2*i]) > max_input) max_input = fabs(pcm_buf[2*i]);
+                if (fabs(pcm_buf[2*i+1]) > max_input) max_input = fabs(pcm_buf[2*i+1]);
+            }
+            if (callback_debug == 0) {
+                trace_set_thread_name("pa_cb");
             }
-            printf("🔍 CALLBACK AUDIO %d: frameCount=%d, max_input=%.6f\n", 
-                   callback_debug, frameCount, max_input);
+            TRACE(TRACE_DEBUG, "callback %d: frameCount=%lu, max_input=%.6f", callback_debug, frameCount, max_input);
             callback_debug++;
         }
         
-        if (rb_write(&pa_pcm_rb, (char *)pa_pcm_buf, (int)(2 * frameCount * sizeof(float))) != 0) {
-            printf("Write to pa_pcm_rb failed\n");
+        if (rb_write(in->rb, (char *)pcm_buf, (int)(2 * frameCount * sizeof(float))) != 0) {
+            TRACE(TRACE_WARN, "Write to pa_pcm_rb failed");
         }
     }
 
@@ -592,7 +901,7 @@ int snd_callback(const void *input, void *output, unsigned long frameCount, cons
             reset_compressor = false;
         }
 
-        dsp->processSamples(pa_pcm_buf);
+        dsp->processSamples(pcm_buf);
     }
 
     if (streaming) {
@@ -607,7 +916,7 @@ int snd_callback(const void *input, void *output, unsigned long frameCount, cons
             srconv_stream.input_frames = frameCount;
             srconv_stream.output_frames = frameCount * cfg.audio.channel * (srconv_stream.src_ratio + 1) * sizeof(float);
 
-            memcpy((float *)srconv_stream.data_in, pa_pcm_buf, frameCount * cfg.audio.channel * sizeof(float));
+            memcpy((float *)srconv_stream.data_in, pcm_buf, frameCount * cfg.audio.channel * sizeof(float));
 
             // The actual resample process
             src_process(srconv_state_stream, &srconv_stream);
@@ -617,7 +926,7 @@ int snd_callback(const void *input, void *output, unsigned long frameCount, cons
             rb_write(&stream_rb, (char *)stream_buf, srconv_stream.output_frames_gen * cfg.audio.channel * sizeof(float));
         }
         else {
-            rb_write(&stream_rb, (char *)pa_pcm_buf, frameCount * cfg.audio.channel * sizeof(float));
+            rb_write(&stream_rb, (char *)pcm_buf, frameCount * cfg.audio.channel * sizeof(float));
         }
 
         atom_cond_signal(&stream_cond);
@@ -635,7 +944,7 @@ int snd_callback(const void *input, void *output, unsigned long frameCount, cons
             srconv_record.input_frames = frameCount;
             srconv_record.output_frames = frameCount * cfg.audio.channel * (srconv_record.src_ratio + 1) * sizeof(float);
 
-            memcpy((float *)srconv_record.data_in, pa_pcm_buf, frameCount * cfg.audio.channel * sizeof(float));
+            memcpy((float *)srconv_record.data_in, pcm_buf, frameCount * cfg.audio.channel * sizeof(float));
 
             // The actual resample process
             src_process(srconv_state_record, &srconv_record);
@@ -645,7 +954,7 @@ int snd_callback(const void *input, void *output, unsigned long frameCount, cons
             rb_write(&rec_rb, (char *)record_buf, srconv_record.output_frames_gen * cfg.audio.channel * sizeof(float));
         }
         else {
-            rb_write(&rec_rb, (char *)pa_pcm_buf, frameCount * cfg.audio.channel * sizeof(float));
+            rb_write(&rec_rb, (char *)pcm_buf, frameCount * cfg.audio.channel * sizeof(float));
         }
 
         atom_cond_signal(&rec_cond);
@@ -662,8 +971,11 @@ int snd_callback2(const void *input, void *output, unsigned long frameCount, con
                   void *userData)
 {
     float *pcm_input = (float *)input;
-    if (statusFlags != 0) {
-        printf("2 status: %lu\n", statusFlags);
+    if (statusFlags & paInputOverflow) {
+        metrics_inc(METRIC_XRUNS_DEV2_INPUT_OVERFLOW);
+    }
+    if (statusFlags & paInputUnderflow) {
+        metrics_inc(METRIC_XRUNS_DEV2_INPUT_UNDERFLOW);
     }
 
     if (cfg.audio.channel == 1) { // User has selected mono
@@ -702,7 +1014,7 @@ int snd_callback2(const void *input, void *output, unsigned long frameCount, con
     }
 
     if (rb_write(&pa_pcm2_rb, (char *)pa_pcm_buf2, pa_frames * cfg.audio.channel * sizeof(float)) != 0) {
-        printf("Write to pa_pcm_rb2 failed\n");
+        TRACE(TRACE_WARN, "Write to pa_pcm_rb2 failed");
     }
 
     return paContinue;
@@ -714,6 +1026,7 @@ void snd_start_streaming_thread(void)
 
     kbytes_sent = 0;
     streaming = 1;
+    loudness_reset(&stream_loudness);
     if (pthread_create(&stream_thread_detached, NULL, snd_stream_thread, NULL) != 0) {
         print_info("Fatal error: Could not launch streaming thread. Please restart BUTT", 1);
         streaming = 0;
@@ -724,7 +1037,7 @@ void snd_start_streaming_thread(void)
 void snd_start_mixer_thread(void)
 {
     atom_set_int(&close_mixer_thread, 0);
-    rb_clear(&pa_pcm_rb);
+    rb_clear(primary_rb);
 
     if (cfg.audio.dev2_num >= 0) {
         rb_clear(&pa_pcm2_rb);
@@ -733,6 +1046,12 @@ void snd_start_mixer_thread(void)
     snd_reset_samplerate_conv(SND_STREAM);
     snd_reset_samplerate_conv(SND_REC);
 
+    level_detect_reset(cfg.audio.samplerate);
+
+    if (loudness_init(&stream_loudness, cfg.audio.samplerate, cfg.audio.channel) != 0) {
+        print_info(_("Loudness metering is not available for the current audio settings"), 1);
+    }
+
     if (pthread_create(&mixer_thread_joinable, NULL, snd_mixer_thread, NULL) != 0) {
         print_info("Fatal error: Could not launch mixer thread. Please restart BUTT", 1);
         return;
@@ -745,17 +1064,235 @@ void snd_stop_mixer_thread(void)
     pthread_join(mixer_thread_joinable, NULL);
 }
 
+// Sends the multitrack bus to AES67 and records it while butt is recording
+void *snd_multitrack_thread(void *data)
+{
+    mt_file_t file;
+    int open_failed = 0;
+    int block_size = mt_routing.channels * pa_frames * sizeof(float);
+    int filled;
+
+    file.fd = NULL;
+    trace_set_thread_name("multitrack");
+
+    for (;;) {
+        do {
+            filled = rb_filled(&mt_rb);
+            if (atom_get_int(&close_mt_thread) == 1) {
+                break;
+            }
+            Pa_Sleep(1); // ms
+        } while (filled < block_size);
+
+        if (atom_get_int(&close_mt_thread) == 1) {
+            break;
+        }
+
+        rb_read_len(&mt_rb, (char *)mt_buf, block_size);
+        metrics_set(METRIC_RB_FILL_MULTITRACK, (double)filled / mt_rb.size);
+
+        if (mt_aes67) {
+            aes67_output_t *aes67_output = aes67_output_get_global_instance();
+            if (aes67_output && aes67_output->initialized && aes67_output->config.active) {
+                aes67_output_send(aes67_output, mt_buf, block_size);
+            }
+        }
+
+        if (recording && cfg.multitrack.record) {
+            if (file.fd == NULL && !open_failed) {
+                int format = !strcmp(cfg.multitrack.format, "flac") && mt_routing.channels <= FLAC__MAX_CHANNELS ? MT_FORMAT_FLAC : MT_FORMAT_WAV;
+                int bit_depth = format == MT_FORMAT_FLAC ? cfg.flac_codec_rec.bit_depth : cfg.wav_codec_rec.bit_depth;
+                int append;
+                char *path = mt_file_path(cfg.rec.path, cfg.rec.mt_open_mode, format, mt_routing.channels, cfg.audio.samplerate, bit_depth, &append);
+
+                if (path == NULL || mt_file_open(&file, path, append, format, mt_routing.channels, cfg.audio.samplerate, bit_depth) != 0) {
+                    TRACE(TRACE_WARN, "Could not open multitrack recording %s", path != NULL ? path : "");
+                    open_failed = 1;
+                }
+                free(path);
+            }
+
+            // Converts mt_buf in place, so this comes after the AES67 output
+            if (file.fd != NULL && mt_file_write(&file, mt_buf, pa_frames) != 0) {
+                TRACE(TRACE_WARN, "Write to multitrack recording failed");
+            }
+        }
+        else {
+            mt_file_close(&file);
+            open_failed = 0;
+        }
+    }
+
+    mt_file_close(&file);
+
+    return NULL;
+}
+
+void snd_start_multitrack_thread(void)
+{
+    if (mt_routing.channels == 0) {
+        return;
+    }
+
+    atom_set_int(&close_mt_thread, 0);
+    rb_clear(&mt_rb);
+
+    if (pthread_create(&mt_thread, NULL, snd_multitrack_thread, NULL) != 0) {
+        print_info("Fatal error: Could not launch multitrack thread. Please restart BUTT", 1);
+        return;
+    }
+    mt_thread_running = 1;
+}
+
+void snd_stop_multitrack_thread(void)
+{
+    if (mt_thread_running == 0) {
+        return;
+    }
+
+    atom_set_int(&close_mt_thread, 1);
+    pthread_join(mt_thread, NULL);
+    mt_thread_running = 0;
+}
+
+void snd_get_loudness(loudness_values_t *values)
+{
+    loudness_get(&stream_loudness, values);
+}
+
+// Called by the mixer after it has read a block of the primary device into pa_mixer_buf.
+// Once the device that snd_switch_primary_device() has opened delivers audio, its block replaces the
+// one of the old device with an equal-power crossfade and the mixer reads from it from then on
+static void snd_handoff_primary_input(int frame_size)
+{
+    int expected = SND_SWITCH_PENDING;
+    int frame_bytes = cfg.audio.channel * sizeof(float);
+    int frame_len = frame_size / sizeof(float);
+    int filled, excess;
+
+    if (__atomic_load_n(&switch_state, __ATOMIC_ACQUIRE) != SND_SWITCH_PENDING) {
+        return;
+    }
+
+    filled = rb_filled(switch_input->rb);
+    if (filled < frame_size) {
+        return;
+    }
+
+    // The main thread gives up on the switch by moving it back to SND_SWITCH_IDLE
+    if (!__atomic_compare_exchange_n(&switch_state, &expected, SND_SWITCH_HANDOFF, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        return;
+    }
+
+    // Keep no more audio buffered than the old device had, otherwise the latency would grow with every switch
+    excess = filled - frame_size - rb_filled(primary_rb);
+    excess -= excess % frame_bytes;
+    while (excess > 0) {
+        int len = excess < frame_size ? excess : frame_size;
+        rb_read_len(switch_input->rb, (char *)pa_switch_mix_buf, len);
+        excess -= len;
+    }
+
+    rb_read_len(switch_input->rb, (char *)pa_switch_mix_buf, frame_size);
+    for (int i = 0; i < frame_len; i++) {
+        double x = ((i / cfg.audio.channel) + 0.5) / pa_frames * (M_PI / 2);
+        pa_mixer_buf[i] = (float)(pa_mixer_buf[i] * cos(x) + pa_switch_mix_buf[i] * sin(x));
+    }
+
+    primary_rb = switch_input->rb;
+    __atomic_store_n(&mt_input, switch_input, __ATOMIC_RELEASE);
+    __atomic_store_n(&switch_state, SND_SWITCH_DONE, __ATOMIC_RELEASE);
+}
+
+uint64_t snd_get_first_block_us(void)
+{
+    return __atomic_load_n(&first_block_us, __ATOMIC_RELAXED);
+}
+
+static void publish_loudness_metrics(void)
+{
+    loudness_values_t values;
+
+    loudness_get(&stream_loudness, &values);
+    metrics_set(METRIC_LOUDNESS_MOMENTARY, values.momentary);
+    metrics_set(METRIC_LOUDNESS_SHORT_TERM, values.short_term);
+    metrics_set(METRIC_LOUDNESS_INTEGRATED, values.integrated);
+    metrics_set(METRIC_LOUDNESS_RANGE, values.range);
+    metrics_set(METRIC_TRUE_PEAK, values.true_peak);
+}
+
+// Peaks for the VU meter. The mixer thread raises them for every frame packet and snd_update_vu()
+// takes them from the GUI thread. Non-negative floats sort like their bit patterns, so the maximum
+// since the last read fits into plain uint32_t atomics and neither side ever waits
+enum {
+    VU_STREAM_LEFT = 0,
+    VU_STREAM_RIGHT = 1,
+    VU_REC_LEFT = 2,
+    VU_REC_RIGHT = 3,
+    VU_PEAK_COUNT = 4,
+};
+
+static uint32_t vu_peaks[VU_PEAK_COUNT];
+
+static void vu_raise_peak(int idx, float peak)
+{
+    uint32_t bits, cur;
+
+    memcpy(&bits, &peak, sizeof(bits));
+    cur = __atomic_load_n(&vu_peaks[idx], __ATOMIC_RELAXED);
+    while (bits > cur && !__atomic_compare_exchange_n(&vu_peaks[idx], &cur, bits, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
+}
+
+static float vu_take_peak(int idx)
+{
+    uint32_t bits = __atomic_exchange_n(&vu_peaks[idx], 0, __ATOMIC_RELAXED);
+    float peak;
+
+    memcpy(&peak, &bits, sizeof(peak));
+    return peak;
+}
+
+// <left_idx> is VU_STREAM_LEFT or VU_REC_LEFT, the right channel follows it.
+// Returns the mean of both channel peaks for the silence and signal detection
+static float vu_update_peaks(const float *buf, int frame_len, int left_idx)
+{
+    int right_offset = cfg.audio.channel - 1;
+    float lpeak = 0;
+    float rpeak = 0;
+
+    for (int i = 0; i < frame_len; i += cfg.audio.channel) {
+        float left_sample = fabsf(buf[i]);
+        float right_sample = fabsf(buf[i + right_offset]);
+
+        if (left_sample > lpeak) {
+            lpeak = left_sample;
+        }
+        if (right_sample > rpeak) {
+            rpeak = right_sample;
+        }
+    }
+
+    vu_raise_peak(left_idx, lpeak);
+    vu_raise_peak(left_idx + 1, rpeak);
+
+    return lpeak / 2 + rpeak / 2;
+}
+
 void *snd_mixer_thread(void *data)
 {
     int frame_size = pa_frames * cfg.audio.channel * sizeof(float);
     int frame_len = frame_size / sizeof(float);
 
     int filled1, filled2;
+    uint64_t cycle_start, st_start;
+
+    trace_set_thread_name("mixer");
 
     for (;;) {
         if (cfg.audio.dev2_num < 0) { // Only primary audio device is active
             do {
-                filled1 = rb_filled(&pa_pcm_rb);
+                filled1 = rb_filled(primary_rb);
                 if (atom_get_int(&close_mixer_thread) == 1) {
                     break;
                 }
@@ -766,19 +1303,21 @@ void *snd_mixer_thread(void *data)
                 break;
             }
 
-            rb_read_len(&pa_pcm_rb, (char *)pa_mixer_buf, frame_size);
+            rb_read_len(primary_rb, (char *)pa_mixer_buf, frame_size);
+            snd_handoff_primary_input(frame_size);
+            cycle_start = metrics_now_us();
+            metrics_set(METRIC_RB_FILL_PCM, (double)filled1 / primary_rb->size);
 
         // 🔍 DIAGNOSTIC: Vérifier si l'audio d'entrée est présent
         static int audio_input_debug = 0;
-        if (audio_input_debug < 10) {
+        if (TRACE_ON(TRACE_DEBUG) && audio_input_debug < 10) {
             float max_audio = 0.0f;
             for (int i = 0; i < frame_len && i < 100; i++) {
                 if (fabs(pa_mixer_buf[i]) > max_audio) {
                     max_audio = fabs(pa_mixer_buf[i]);
                 }
             }
-            printf("🔍 AUDIO INPUT %d: pa_mixer_buf max=%.6f, frame_len=%d\n", 
-                   audio_input_debug, max_audio, frame_len);
+            TRACE(TRACE_DEBUG, "audio input %d: pa_mixer_buf max=%.6f, frame_len=%d", audio_input_debug, max_audio, frame_len);
             audio_input_debug++;
         }
 
@@ -799,7 +1338,7 @@ void *snd_mixer_thread(void *data)
         }
         else { // Secondary audio device is active as well
             do {
-                filled1 = rb_filled(&pa_pcm_rb);
+                filled1 = rb_filled(primary_rb);
                 filled2 = rb_filled(&pa_pcm2_rb);
                 if (atom_get_int(&close_mixer_thread) == 1) {
                     break;
@@ -817,8 +1356,12 @@ void *snd_mixer_thread(void *data)
                  cnt = 0;
              }*/
 
-            rb_read_len(&pa_pcm_rb, (char *)pa_mixer_buf, frame_size);
+            rb_read_len(primary_rb, (char *)pa_mixer_buf, frame_size);
+            snd_handoff_primary_input(frame_size);
             rb_read_len(&pa_pcm2_rb, (char *)pa_mixer_buf2, frame_size);
+            cycle_start = metrics_now_us();
+            metrics_set(METRIC_RB_FILL_PCM, (double)filled1 / primary_rb->size);
+            metrics_set(METRIC_RB_FILL_PCM2, (double)filled2 / pa_pcm2_rb.size);
 
             for (int i = 0; i < frame_len; i++) {
                 // Apply gain to primary device
@@ -890,44 +1433,45 @@ void *snd_mixer_thread(void *data)
                 }
                 
                 if (!should_bypass) {
+                    st_start = metrics_now_us();
                     stereo_tool_process_samples(&st_stream, stream_buf, pa_frames);
-            // [PATCH SYNCHRONISATION] Mettre à jour buffer VU-meter streaming
-            update_vu_buffers_post_stereotool(stream_buf, NULL, frame_size);
+                    metrics_observe_us(METRIC_STEREO_TOOL_STREAM, metrics_now_us() - st_start);
                 }
             }
         }
 
+        if (first_block_us == 0) {
+            __atomic_store_n(&first_block_us, metrics_now_us(), __ATOMIC_RELAXED);
+        }
+
+        level_detect_process(LEVEL_PATH_STREAM, vu_update_peaks(stream_buf, frame_len, VU_STREAM_LEFT), pa_frames);
+        __atomic_store_n(&silence_detected, level_detect_is_silent(LEVEL_PATH_STREAM), __ATOMIC_RELAXED);
+        __atomic_store_n(&signal_detected, level_detect_has_signal(LEVEL_PATH_STREAM), __ATOMIC_RELAXED);
+        if (loudness_process(&stream_loudness, stream_buf, pa_frames) > 0) {
+            publish_loudness_metrics();
+        }
+
         // 🔧 CORRECTION: Envoyer d'abord à AES67, puis à BlackHole pour éviter les conflits
         // Send processed audio to AES67 output FIRST
         aes67_output_t* aes67_output = aes67_output_get_global_instance();
         static int mixer_debug = 0;
-        if (mixer_debug < 5) {
-            printf("🎵 MIXER: aes67=%p, init=%d, active=%d, frame_size=%d\n",
-                   (void*)aes67_output,
-                   aes67_output ? aes67_output->initialized : -1,
-                   aes67_output ? aes67_output->config.active : -1,
-                   frame_size);
+        if (TRACE_ON(TRACE_DEBUG) && mixer_debug < 5) {
+            TRACE(TRACE_DEBUG, "aes67=%p, init=%d, active=%d, frame_size=%d", (void *)aes67_output, aes67_output ? aes67_output->initialized : -1,
+                  aes67_output ? aes67_output->config.active : -1, frame_size);
             mixer_debug++;
         }
-        if (aes67_output && aes67_output->initialized && aes67_output->config.active) {
+        if (!mt_aes67 && aes67_output && aes67_output->initialized && aes67_output->config.active) {
             aes67_output_send(aes67_output, stream_buf, frame_size);
-        } else if (mixer_debug < 5) {
-            printf("⚠️  MIXER: Skipping AES67 send (conditions not met)\n");
         }
 
         // 🔧 OPTIMISATION: Envoyer directement à BlackHole sans copie inutile
         // Les deux sorties (AES67 et BlackHole) ne modifient pas les données en lecture,
         // donc pas besoin de copie. Cela améliore les performances du thread audio temps-réel.
         if (blackhole_initialized) {
-            static int blackhole_check_count = 0;
-            if (blackhole_check_count++ < 10) {
-                printf("🔍 BLACKHOLE CHECK: initialized=%d, stream_buf=%p, pa_frames=%d\n", 
-                       blackhole_initialized, (void*)stream_buf, pa_frames);
-            }
-            
             static int blackhole_debug_count = 0;
-            if (blackhole_debug_count++ < 5) {
-                print_info("BlackHole: Sending audio data (zero-copy)...", 0);
+            if (TRACE_ON(TRACE_DEBUG) && blackhole_debug_count < 5) {
+                TRACE(TRACE_DEBUG, "BlackHole: sending audio data (zero-copy), stream_buf=%p, pa_frames=%d", (void *)stream_buf, pa_frames);
+                blackhole_debug_count++;
             }
             // Envoi direct sans copie pour performances optimales
             blackhole_output.sendInterleaved(stream_buf, pa_frames);
@@ -954,7 +1498,9 @@ void *snd_mixer_thread(void *data)
                 else {
                     rb_write(&stream_rb, (char *)stream_buf, frame_size);
                 }
+                enc_stats_queued(&stream_enc_stats);
                 atom_cond_signal(&stream_cond);
+                metrics_set(METRIC_RB_FILL_STREAM, (double)rb_filled(&stream_rb) / stream_rb.size);
             }
         }
 
@@ -1000,13 +1546,15 @@ void *snd_mixer_thread(void *data)
                 }
                 
                 if (!should_bypass) {
+                    st_start = metrics_now_us();
                     stereo_tool_process_samples(&st_record, record_buf, pa_frames);
-            // [PATCH SYNCHRONISATION] Mettre à jour buffer VU-meter recording
-            update_vu_buffers_post_stereotool(NULL, record_buf, frame_size);
+                    metrics_observe_us(METRIC_STEREO_TOOL_REC, metrics_now_us() - st_start);
                 }
             }
         }
 
+        level_detect_process(LEVEL_PATH_REC, vu_update_peaks(record_buf, frame_len, VU_REC_LEFT), pa_frames);
+
         if (recording) {
             if ((!strcmp(cfg.rec.codec, "opus")) && (cfg.audio.samplerate != 48000)) {
                 src_process(srconv_state_opus_record, &srconv_opus_record);
@@ -1015,15 +1563,34 @@ void *snd_mixer_thread(void *data)
             else {
                 rb_write(&rec_rb, (char *)record_buf, frame_size);
             }
+            enc_stats_queued(&rec_enc_stats);
             atom_cond_signal(&rec_cond);
+            metrics_set(METRIC_RB_FILL_REC, (double)rb_filled(&rec_rb) / rec_rb.size);
         }
 
         pa_new_frames = 1;
+        metrics_observe_us(METRIC_MIXER_CYCLE, metrics_now_us() - cycle_start);
     }
 
     return NULL;
 }
 
+// Points to ic_send(), sc_send() or webrtc_send() while the streaming thread is running
+static int (*stream_send_func)(char *buf, int buf_len) = NULL;
+
+static int stream_send_metered(char *buf, int buf_len)
+{
+    uint64_t start = metrics_now_us();
+    int ret = stream_send_func(buf, buf_len);
+
+    metrics_observe_us(METRIC_STREAM_SEND, metrics_now_us() - start);
+    if (ret != -1) {
+        metrics_add(METRIC_STREAM_BYTES, buf_len);
+    }
+
+    return ret;
+}
+
 void *snd_stream_thread(void *data)
 {
     int sent;
@@ -1038,26 +1605,89 @@ void *snd_stream_thread(void *data)
 
     static int new_stream = 0;
 
+    // WebRTC sends raw Opus packets in RTP instead of Ogg pages
+    int rtp_mode = 0;
+
     if (cfg.srv[cfg.selected_srv]->type == ICECAST) {
         xc_send = &ic_send;
     }
 #ifdef HAVE_LIBDATACHANNEL
     else if (cfg.srv[cfg.selected_srv]->type == WEBRTC) {
         xc_send = &webrtc_send;
+        rtp_mode = 1;
     }
 #endif
     else { // Shoutcast
         xc_send = &sc_send;
     }
+    stream_send_func = xc_send;
+    xc_send = &stream_send_metered;
+
+    if (!strcmp(cfg.audio.codec, "opus")) {
+        opus_enc_set_rtp_mode(&opus_stream, rtp_mode);
+    }
 
     set_max_thread_priority();
+    enc_stats_reset(&stream_enc_stats);
+    if (cfg.main.pin_encoder_threads == 1) {
+        enc_stats_pin_thread(SND_STREAM);
+    }
+
+    if (!strcmp(cfg.audio.codec, "mp3")) {
+        if (mp3_stream_burst.duration != cfg.mp3_codec_stream.burst_duration) {
+            mp3_burst_init(&mp3_stream_burst, cfg.mp3_codec_stream.burst_duration);
+        }
+
+        // Burst-on-connect: Resend the audio that was encoded right before the connection was lost.
+        // Frames older than the reconnect delay plus the cache duration belong to a previous session
+        if (mp3_stream_burst.duration > 0) {
+            char *burst_buf = (char *)malloc(mp3_burst_get_max_size(&mp3_stream_burst));
+            uint64_t max_age_ms = (cfg.main.reconnect_delay + mp3_stream_burst.duration) * 1000;
+
+            if (burst_buf != NULL) {
+                sent = mp3_burst_read(&mp3_stream_burst, burst_buf, lame_enc_get_samplerate(&lame_stream), max_age_ms);
+                if (sent > 0) {
+                    if (xc_send(burst_buf, sent) == -1) {
+                        connected = 0;
+                    }
+                    else {
+                        kbytes_sent += sent / 1024.0;
+                    }
+                }
+                free(burst_buf);
+            }
+        }
+    }
+
     while (connected) {
+        enc_stats_end(&stream_enc_stats);
         atom_cond_wait(&stream_cond);
         if (!connected) {
             break;
         }
+        enc_stats_begin(&stream_enc_stats);
 
-        if (!strcmp(cfg.audio.codec, "opus")) {
+        if (!strcmp(cfg.audio.codec, "opus") && rtp_mode) {
+            // One packet per frame of the selected size, without Ogg pages in between
+            bytes_to_read = opus_stream.frame_size * cfg.audio.channel * sizeof(float);
+
+            while ((rb_filled(&stream_rb)) >= bytes_to_read) {
+                rb_read_len(&stream_rb, audio_buf, bytes_to_read);
+                encode_bytes_read = opus_enc_encode_raw(&opus_stream, (float *)audio_buf, enc_buf);
+                if (encode_bytes_read < 0) {
+                    continue;
+                }
+
+                if (xc_send(enc_buf, encode_bytes_read) == -1) {
+                    connected = 0;
+                    break;
+                }
+                else {
+                    kbytes_sent += encode_bytes_read / 1024.0;
+                }
+            }
+        }
+        else if (!strcmp(cfg.audio.codec, "opus")) {
             // Read always chunks of OPUS_FRAME_SIZE frames from the audio ringbuffer to be
             // compatible with OPUS
             bytes_to_read = OPUS_FRAME_SIZE * cfg.audio.channel * sizeof(float);
@@ -1079,6 +1709,9 @@ void *snd_stream_thread(void *data)
 
                 rb_read_len(&stream_rb, audio_buf, bytes_to_read);
                 encode_bytes_read = opus_enc_encode(&opus_stream, (float *)audio_buf, enc_buf);
+                if (encode_bytes_read == 0) {
+                    continue; // Ogg page not completed yet
+                }
 
                 if (xc_send(enc_buf, encode_bytes_read) == -1) {
                     connected = 0;
@@ -1119,6 +1752,9 @@ void *snd_stream_thread(void *data)
             if (!strcmp(cfg.audio.codec, "mp3")) {
                 encode_bytes_read =
                     lame_enc_encode(&lame_stream, (float *)audio_buf, enc_buf, rb_bytes_read / (cfg.audio.channel * sizeof(float)), stream_rb.size * 10);
+
+                // Cache the frames before sending them, so frames that could not be sent are part of the next burst
+                mp3_burst_write(&mp3_stream_burst, enc_buf, encode_bytes_read);
             }
 
             if (!strcmp(cfg.audio.codec, "ogg")) {
@@ -1147,6 +1783,9 @@ void *snd_stream_thread(void *data)
         }
     }
 
+    enc_stats_end(&stream_enc_stats);
+    enc_stats_print(&stream_enc_stats);
+
     free(enc_buf);
     free(audio_buf);
 
@@ -1161,6 +1800,9 @@ void snd_stop_streaming_thread(void)
     connected = 0;
     streaming = 0;
 
+    // The user disconnected, there is nothing to resend
+    mp3_burst_clear(&mp3_stream_burst);
+
     atom_cond_signal(&stream_cond);
     atom_cond_destroy(&stream_cond);
 
@@ -1212,9 +1854,15 @@ void *snd_rec_thread(void *data)
     opus_header_written = 0;
 
     set_max_thread_priority();
+    enc_stats_reset(&rec_enc_stats);
+    if (cfg.main.pin_encoder_threads == 1) {
+        enc_stats_pin_thread(SND_REC);
+    }
 
     while (recording) {
+        enc_stats_end(&rec_enc_stats);
         atom_cond_wait(&rec_cond);
+        enc_stats_begin(&rec_enc_stats);
 
         if (next_file == 1) {
 #ifdef HAVE_LIBFDK_AAC
@@ -1338,42 +1986,18 @@ void *snd_rec_thread(void *data)
                 // so in case of a crash we still have a valid WAV file
                 wav_write_header(cfg.rec.fd, cfg.audio.channel, cfg.audio.samplerate, cfg.wav_codec_rec.bit_depth);
 
-                // Convert float to samples to int16 samples
+                // Convert float samples to int16/int24/int32 samples
                 float *pcm_float = (float *)audio_buf;
-                int16_t *pcm_int16 = (int16_t *)audio_buf;
-                int32_t *pcm_int32 = (int32_t *)audio_buf;
-
-                for (uint32_t i = 0; i < rb_bytes_read / sizeof(float); i++) {
-                    if (pcm_float[i] > 0) {
-                        if (cfg.wav_codec_rec.bit_depth == 16) {
-                            pcm_int16[i] = (int16_t)round(fmin(pcm_float[i] * INT16_MAX, INT16_MAX));
-                        }
-                        else if (cfg.wav_codec_rec.bit_depth == 24) {
-                            pcm_int32[i] = (int32_t)round(fmin(pcm_float[i] * INT24_MAX, INT24_MAX));
-
-                            audio_buf[i * 3 + 0] = audio_buf[i * 4 + 0]; // lsb
-                            audio_buf[i * 3 + 1] = audio_buf[i * 4 + 1]; // center byte
-                            audio_buf[i * 3 + 2] = audio_buf[i * 4 + 2]; // msb
-                        }
-                        else { // cfg.wav_codec_rec.bit_depth == 32
-                            pcm_int32[i] = (int32_t)round(fmin(pcm_float[i] * INT32_MAX, INT32_MAX));
-                        }
-                    }
-                    else {
-                        if (cfg.wav_codec_rec.bit_depth == 16) {
-                            pcm_int16[i] = (int16_t)round(fmax(-pcm_float[i] * INT16_MIN, INT16_MIN));
-                        }
-                        else if (cfg.wav_codec_rec.bit_depth == 24) {
-                            pcm_int32[i] = (int32_t)round(fmax(-pcm_float[i] * INT24_MIN, INT24_MIN));
-
-                            audio_buf[i * 3 + 0] = audio_buf[i * 4 + 0]; // lsb
-                            audio_buf[i * 3 + 1] = audio_buf[i * 4 + 1]; // center byte
-                            audio_buf[i * 3 + 2] = audio_buf[i * 4 + 2]; // msb
-                        }
-                        else { // cfg.wav_codec_rec.bit_depth == 32
-                            pcm_int32[i] = (int32_t)round(fmax(-pcm_float[i] * INT32_MIN, INT32_MIN));
-                        }
-                    }
+                uint32_t samples = rb_bytes_read / sizeof(float);
+
+                if (cfg.wav_codec_rec.bit_depth == 16) {
+                    pcm_float_to_s16(pcm_float, (int16_t *)audio_buf, samples);
+                }
+                else if (cfg.wav_codec_rec.bit_depth == 24) {
+                    pcm_float_to_s24le(pcm_float, (uint8_t *)audio_buf, samples);
+                }
+                else { // cfg.wav_codec_rec.bit_depth == 32
+                    pcm_float_to_s32(pcm_float, (int32_t *)audio_buf, samples);
                 }
 
                 kbytes_written += fwrite(audio_buf, cfg.wav_codec_rec.bit_depth / 8, rb_bytes_read / sizeof(float), cfg.rec.fd) / 1024.0;
@@ -1407,6 +2031,9 @@ void *snd_rec_thread(void *data)
     }
 #endif
     else if (!strcmp(cfg.rec.codec, "opus")) {
+        // Write the packets of the last incomplete Ogg page
+        enc_bytes_read = opus_enc_flush_pages(&opus_rec, enc_buf);
+        fwrite(enc_buf, 1, enc_bytes_read, cfg.rec.fd);
         opus_enc_reinit(&opus_rec);
         fclose(cfg.rec.fd);
     }
@@ -1414,6 +2041,9 @@ void *snd_rec_thread(void *data)
         fclose(cfg.rec.fd);
     }
 
+    enc_stats_end(&rec_enc_stats);
+    enc_stats_print(&rec_enc_stats);
+
     free(enc_buf);
     free(audio_buf);
 
@@ -1423,37 +2053,14 @@ void *snd_rec_thread(void *data)
     return NULL;
 }
 
-// PATCH USB AUDIO INTEL + SYNCHRONISATION VU-METER APPLIQUÉ
-// Buffers pour données POST-StereoTool
-static float *vu_stream_buf_post = NULL;
-static float *vu_record_buf_post = NULL;
-static int vu_buf_size = 0;
-
 void snd_update_vu(int reset)
 {
-    // Patch spécialisé pour USB Audio Interface (Burr-Brown TI) - 48000 Hz
-    static float usb_noise_floor = -85.0f; // dB - Plus strict pour USB
-    static int usb_stability_counter = 0;
-    static const int usb_stability_threshold = 20; // Plus long pour USB
-    static float usb_jitter_buffer[32] = {0}; // Buffer anti-jitter
-    static int usb_jitter_index = 0;
-    static bool usb_interface_detected = false;
-    
-    // CORRECTION: Désactiver la détection automatique USB Audio
-    // Le patch ne s'active plus automatiquement à 48000 Hz
-    // if (!usb_interface_detected && cfg.audio.samplerate == 48000) {
-    //     usb_interface_detected = true;
-    //     printf("BUTT: Interface USB Audio 48000Hz détectée - Patch anti-artefact activé\n");
-    // }
-    
-    int i;
     float decay = cfg.audio.samplerate < 88200 ? 0.5 : 0.7;
-    
-    // Ajustement decay pour 48000 Hz
+
     if (cfg.audio.samplerate == 48000) {
-        decay = 0.65f; // Valeur intermédiaire optimisée pour 48kHz
+        decay = 0.65f;
     }
-    
+
     static float stream_lpeak = 0;
     static float stream_rpeak = 0;
     static float rec_lpeak = 0;
@@ -1465,8 +2072,9 @@ void snd_update_vu(int reset)
     static double rec_ravg = 0;
 
     if (reset == 1) {
-        memset(stream_buf, 0, framepacket_size * sizeof(float) * cfg.audio.channel);
-        memset(record_buf, 0, framepacket_size * sizeof(float) * cfg.audio.channel);
+        for (int i = 0; i < VU_PEAK_COUNT; i++) {
+            vu_take_peak(i);
+        }
 
         vu_init(); // Reset peak indicators
         call_cnt = 1;
@@ -1478,181 +2086,24 @@ void snd_update_vu(int reset)
         stream_ravg = 0;
         rec_lavg = 0;
         rec_ravg = 0;
-        
-        // Reset USB-specific variables
-        usb_stability_counter = 0;
-        usb_jitter_index = 0;
-        memset(usb_jitter_buffer, 0, sizeof(usb_jitter_buffer));
-        
-        return;
-    }
-
-    // [PATCH SYNCHRONISATION] Utiliser les buffers POST-StereoTool si disponibles
-    float *actual_stream_buf = vu_stream_buf_post ? vu_stream_buf_post : stream_buf;
-    float *actual_record_buf = vu_record_buf_post ? vu_record_buf_post : record_buf;
-
-    // USB Audio : Filtre anti-jitter et détection de signal réel
-    if (usb_interface_detected) {
-        float peak_energy = 0.0f;
-        float rms_energy = 0.0f;
-        int active_samples = 0;
-        
-        // Calculer l'énergie RMS réelle du signal
-        for (i = 0; i < framepacket_size; i += cfg.audio.channel) {
-            float left = actual_stream_buf[i];
-            float right = actual_stream_buf[i + (cfg.audio.channel - 1)];
-            
-            // Énergie quadratique (RMS)
-            rms_energy += (left * left) + (right * right);
-            
-            // Compter les échantillons "actifs"
-            if (fabs(left) > 0.0001f || fabs(right) > 0.0001f) {
-                active_samples++;
-            }
-            
-            // Peak detection
-            float sample_peak = fabs(left) > fabs(right) ? fabs(left) : fabs(right);
-            if (sample_peak > peak_energy) {
-                peak_energy = sample_peak;
-            }
-        }
-        
-        // Calculer RMS moyen
-        if (framepacket_size > 0) {
-            rms_energy = sqrt(rms_energy / (framepacket_size * cfg.audio.channel));
-        }
-        
-        // Convertir en dB
-        float peak_db = peak_energy > 0 ? 20.0f * log10f(peak_energy) : -100.0f;
-        float rms_db = rms_energy > 0 ? 20.0f * log10f(rms_energy) : -100.0f;
-        
-        // Buffer anti-jitter : stocker les niveaux récents
-        usb_jitter_buffer[usb_jitter_index] = peak_db;
-        usb_jitter_index = (usb_jitter_index + 1) % 32;
-        
-        // Calculer la variance pour détecter le jitter
-        float variance = 0.0f;
-        float mean_level = 0.0f;
-        for (int j = 0; j < 32; j++) {
-            mean_level += usb_jitter_buffer[j];
-        }
-        mean_level /= 32.0f;
-        
-        for (int j = 0; j < 32; j++) {
-            float diff = usb_jitter_buffer[j] - mean_level;
-            variance += diff * diff;
-        }
-        variance /= 32.0f;
-        
-        // Détection d'artefact USB : niveau très faible + variance cyclique
-        bool is_usb_artifact = (
-            peak_db < usb_noise_floor &&           // Niveau très bas
-            rms_db < usb_noise_floor &&            // RMS très bas
-            variance < 0.1f &&                     // Variance très faible (pattern cyclique)
-            active_samples < (framepacket_size / 10) // Très peu d'échantillons actifs
-        );
-        
-        if (is_usb_artifact) {
-            usb_stability_counter++;
-            
-            // Si on détecte un artefact de manière stable, forcer à zéro
-            if (usb_stability_counter >= usb_stability_threshold) {
-                // Forcer VU-meter à zéro de manière douce
-                vu_meter(0.0f, 0.0f, 0.0f, 0.0f);
-                pa_new_frames = 0;
-                
-                // Réinitialiser le compteur mais pas immédiatement
-                if (usb_stability_counter > usb_stability_threshold * 2) {
-                    usb_stability_counter = usb_stability_threshold;
-                }
-                
-                return;
-            }
-        } else {
-            // Signal réel détecté, réinitialiser le compteur
-            usb_stability_counter = 0;
-        }
-    }
-
-    // Calcul des peaks avec les données POST-StereoTool
-    for (i = 0; i < framepacket_size; i += cfg.audio.channel) {
-        float left_sample = fabs(actual_stream_buf[i]);
-        float right_sample = fabs(actual_stream_buf[i + (cfg.audio.channel - 1)]);
-        
-        // Filtrage adaptatif pour USB Audio
-        if (usb_interface_detected) {
-            // Appliquer un filtre passe-haut très doux pour éliminer les composantes DC
-            static float usb_dc_filter_left = 0.0f;
-            static float usb_dc_filter_right = 0.0f;
-            
-            usb_dc_filter_left = 0.999f * usb_dc_filter_left + 0.001f * actual_stream_buf[i];
-            usb_dc_filter_right = 0.999f * usb_dc_filter_right + 0.001f * actual_stream_buf[i + (cfg.audio.channel - 1)];
-            
-            left_sample = fabs(actual_stream_buf[i] - usb_dc_filter_left);
-            right_sample = fabs(actual_stream_buf[i + (cfg.audio.channel - 1)] - usb_dc_filter_right);
-        }
-        
-        if (left_sample > stream_lpeak) {
-            stream_lpeak = left_sample;
-        }
-        if (right_sample > stream_rpeak) {
-            stream_rpeak = right_sample;
-        }
-
-        if (fabs(actual_record_buf[i]) > rec_lpeak) {
-            rec_lpeak = fabs(actual_record_buf[i]);
-        }
-        if (fabs(actual_record_buf[i + (cfg.audio.channel - 1)]) > rec_rpeak) {
-            rec_rpeak = fabs(actual_record_buf[i + (cfg.audio.channel - 1)]);
-        }
-    }
-
-    // Lissage adaptatif USB Audio
-    if (usb_interface_detected) {
-        static float usb_last_stream_lpeak = 0;
-        static float usb_last_stream_rpeak = 0;
-        static float usb_last_rec_lpeak = 0;
-        static float usb_last_rec_rpeak = 0;
-        
-        // Lissage plus fort pour USB Audio (réduire les variations)
-        float usb_smoothing = 0.85f;
-        
-        stream_lpeak = usb_smoothing * stream_lpeak + (1.0f - usb_smoothing) * usb_last_stream_lpeak;
-        stream_rpeak = usb_smoothing * stream_rpeak + (1.0f - usb_smoothing) * usb_last_stream_rpeak;
-        rec_lpeak = usb_smoothing * rec_lpeak + (1.0f - usb_smoothing) * usb_last_rec_lpeak;
-        rec_rpeak = usb_smoothing * rec_rpeak + (1.0f - usb_smoothing) * usb_last_rec_rpeak;
-        
-        usb_last_stream_lpeak = stream_lpeak;
-        usb_last_stream_rpeak = stream_rpeak;
-        usb_last_rec_lpeak = rec_lpeak;
-        usb_last_rec_rpeak = rec_rpeak;
-    }
-
-    float mean_stream_peak = stream_lpeak / 2 + stream_rpeak / 2;
-    float mean_stream_peak_dB = 20 * log10(mean_stream_peak);
 
-    if (mean_stream_peak_dB < -cfg.audio.silence_level) {
-        silence_detected = true;
-    }
-    else {
-        silence_detected = false;
+        return;
     }
 
-    if (mean_stream_peak_dB > -cfg.audio.signal_level) {
-        signal_detected = true;
-    }
-    else {
-        signal_detected = false;
-    }
+    // The mixer thread has measured the peaks of every frame packet since the last call
+    stream_lpeak = fmaxf(stream_lpeak, vu_take_peak(VU_STREAM_LEFT));
+    stream_rpeak = fmaxf(stream_rpeak, vu_take_peak(VU_STREAM_RIGHT));
+    rec_lpeak = fmaxf(rec_lpeak, vu_take_peak(VU_REC_LEFT));
+    rec_rpeak = fmaxf(rec_rpeak, vu_take_peak(VU_REC_RIGHT));
 
     stream_lavg = (decay * stream_lpeak) + (1.0 - decay) * stream_lavg;
     stream_ravg = (decay * stream_rpeak) + (1.0 - decay) * stream_ravg;
     rec_lavg = (decay * rec_lpeak) + (1.0 - decay) * rec_lavg;
     rec_ravg = (decay * rec_rpeak) + (1.0 - decay) * rec_ravg;
 
-    // Update the vu meter UI only every second call of this function.
-    // This reduces the CPU usage without not missing any samples
-    if (call_cnt == 1) {
+    // The levels are sampled on every call but handed to the widget only every VU_REFRESH_CALLS calls.
+    // The widget itself skips frames in which no bar has moved by a full pixel
+    if (call_cnt >= VU_REFRESH_CALLS) {
         if (vu_level_type == SND_STREAM) {
             vu_meter(stream_lavg, stream_ravg, stream_lpeak, stream_rpeak);
         }
@@ -1667,90 +2118,122 @@ void snd_update_vu(int reset)
             fl_g->LED_comp_threshold->set_state(recording_dsp->is_compressing == true ? LED::LED_ON : LED::LED_OFF);
         }
 
-        call_cnt = 0;
-    }
-    else {
-        call_cnt++;
+        call_cnt = 1;
         stream_lpeak = 0;
         stream_rpeak = 0;
         rec_lpeak = 0;
         rec_rpeak = 0;
     }
+    else {
+        call_cnt++;
+    }
 
     pa_new_frames = 0;
 }
 
-// [PATCH SYNCHRONISATION] Fonction pour mettre à jour les buffers POST-StereoTool
-void update_vu_buffers_post_stereotool(float *stream_buffer, float *record_buffer, int frame_size)
+
+void snd_free_device_list(snd_dev_t **dev_list, int dev_count)
 {
-    // Allouer les buffers si nécessaire
-    if (vu_buf_size < frame_size) {
-        vu_stream_buf_post = (float*)realloc(vu_stream_buf_post, frame_size);
-        vu_record_buf_post = (float*)realloc(vu_record_buf_post, frame_size);
-        vu_buf_size = frame_size;
-    }
-    
-    // Copier les données POST-StereoTool
-    if (stream_buffer && vu_stream_buf_post) {
-        memcpy(vu_stream_buf_post, stream_buffer, frame_size);
+    if (dev_list == NULL) {
+        return;
     }
-    if (record_buffer && vu_record_buf_post) {
-        memcpy(vu_record_buf_post, record_buffer, frame_size);
+
+    for (int i = 0; i < dev_count; i++) {
+        free(dev_list[i]->name);
+        free(dev_list[i]);
     }
+    free(dev_list);
 }
 
+// Identifies a device together with its driver, so a cached entry gets probed again after a driver or PortAudio update
+static char *device_cache_key(const PaDeviceInfo *p_di, const PaHostApiInfo *pa_hostapi)
+{
+    char key[512];
 
-void snd_free_device_list(snd_dev_t **dev_list, int dev_count)
+    snprintf(key, sizeof(key), "%s|%s|%d|%.0f|%d", pa_hostapi->name, p_di->name, p_di->maxInputChannels, p_di->defaultSampleRate, Pa_GetVersion());
+
+    return strdup(key);
+}
+
+static const char *device_cache_path(void)
 {
-    if (dev_count == 0) {
-        return;
+    static char *path = NULL;
+
+    if (path == NULL && cfg_path != NULL) {
+        path = (char *)malloc(strlen(cfg_path) + strlen(SND_DEV_CACHE_SUFFIX) + 1);
+        sprintf(path, "%s%s", cfg_path, SND_DEV_CACHE_SUFFIX);
+        dev_cache_load(path);
     }
 
-    for (int i = 0; i < SND_MAX_DEVICES; i++) {
-        if (i < dev_count) {
-            free(dev_list[i]->name);
-        }
+    return path;
+}
 
-        free(dev_list[i]);
+// Returns the number of samplerates in snd_samplerates[] that <dev_id> supports. Some host APIs open the device
+// to answer Pa_IsFormatSupported(), each probe holds probe_mutex like the stream calls of the main thread
+static int probe_samplerates(int dev_id, int channels, double latency, int *sr_list)
+{
+    PaStreamParameters pa_params;
+    int sr_count = 0;
+
+    pa_params.device = dev_id;
+    pa_params.channelCount = channels;
+    pa_params.sampleFormat = paFloat32;
+    pa_params.suggestedLatency = latency;
+    pa_params.hostApiSpecificStreamInfo = NULL;
+
+    for (int j = 0; j < SND_NUM_OF_SR; j++) {
+        PaError err = snd_is_format_supported(&pa_params, snd_samplerates[j]);
+
+        if (err == paFormatIsSupported) {
+            sr_list[sr_count] = snd_samplerates[j];
+            sr_count++;
+        }
     }
-    free(dev_list);
+    // Zero the whole tail, lists are compared and copied as a whole
+    memset(sr_list + sr_count, 0, (SND_NUM_OF_SR + 1 - sr_count) * sizeof(int));
+
+    return sr_count;
 }
 
-snd_dev_t **snd_get_devices(int *dev_count)
+snd_dev_t **snd_get_devices(int *dev_count, int mode)
 {
     int available_devices, sr_count, dev_num;
-    bool sr_supported = 0;
     bool has_default_input_devices = 0;
     const PaDeviceInfo *p_di;
     char info_buf[256];
-    PaStreamParameters pa_params;
+    char *key;
+    snd_dev_t *dev;
 
-    int sr[] = {8000, 11025, 12000, 16000, 22050, 24000, 32000, 44100, 48000, 88200, 96000};
-
-    snd_dev_t **dev_list;
-    dev_list = (snd_dev_t **)malloc(SND_MAX_DEVICES * sizeof(snd_dev_t *));
+    if (mode == SND_DEVICES_CACHED && device_cache_path() == NULL) {
+        mode = SND_DEVICES_PROBE;
+    }
 
-    for (int i = 0; i < SND_MAX_DEVICES; i++) {
-        dev_list[i] = (snd_dev_t *)malloc(sizeof(snd_dev_t));
+    available_devices = Pa_GetDeviceCount();
+    if (available_devices < 0) {
+        snprintf(info_buf, sizeof(info_buf), "PaError: %s", Pa_GetErrorText(available_devices));
+        print_info(info_buf, 1);
+        available_devices = 0;
     }
 
+    // One entry per PortAudio device plus the virtual default device
+    snd_dev_t **dev_list;
+    dev_list = (snd_dev_t **)calloc(available_devices + 1, sizeof(snd_dev_t *));
+
     dev_num = 0;
     if (Pa_GetDefaultInputDevice() != paNoDevice) {
-        dev_list[dev_num]->name = (char *)malloc(strlen(_("Default PCM device (default)")) + 1);
-        strcpy(dev_list[dev_num]->name, _("Default PCM device (default)"));
-        dev_list[dev_num]->dev_id = Pa_GetDefaultInputDevice();
+        dev = (snd_dev_t *)calloc(1, sizeof(snd_dev_t));
+        dev->name = (char *)malloc(strlen(_("Default PCM device (default)")) + 1);
+        strcpy(dev->name, _("Default PCM device (default)"));
+        dev->dev_id = Pa_GetDefaultInputDevice();
+        dev_list[dev_num] = dev;
         has_default_input_devices = 1;
         dev_num = 1;
     }
 
-    available_devices = Pa_GetDeviceCount();
-    if (available_devices < 0) {
-        snprintf(info_buf, sizeof(info_buf), "PaError: %s", Pa_GetErrorText(available_devices));
-        print_info(info_buf, 1);
-    }
-
     for (int i = 0; i < available_devices && i < SND_MAX_DEVICES - 1; i++) {
-        sr_count = 0;
+        int sr_list[SND_NUM_OF_SR + 1] = {0};
+        int probed = 1;
+
         p_di = Pa_GetDeviceInfo(i);
         if (p_di == NULL) {
             snprintf(info_buf, sizeof(info_buf), _("Error getting device Info (%d)"), i);
@@ -1764,67 +2247,233 @@ snd_dev_t **snd_get_devices(int *dev_count)
         }
 
         const PaHostApiInfo *pa_hostapi = Pa_GetHostApiInfo(p_di->hostApi);
-        pa_params.device = i;
-        pa_params.channelCount = p_di->maxInputChannels;
-        pa_params.sampleFormat = paFloat32;
-        pa_params.suggestedLatency = p_di->defaultHighInputLatency;
-        pa_params.hostApiSpecificStreamInfo = NULL;
+        key = device_cache_key(p_di, pa_hostapi);
 
-        // add the supported samplerates to the device structure
-        for (uint32_t j = 0; j < sizeof(sr) / sizeof(sr[0]); j++) {
-            if (Pa_IsFormatSupported(&pa_params, NULL, sr[j]) == paFormatIsSupported) {
-                dev_list[dev_num]->sr_list[sr_count] = sr[j];
-                sr_count++;
-                sr_supported = 1;
-            }
+        sr_count = mode == SND_DEVICES_CACHED ? dev_cache_lookup(key, sr_list) : -1;
+        if (sr_count < 0 && mode == SND_DEVICES_CACHED) {
+            // Unknown device: offer all samplerates until the background refresh has probed it
+            memcpy(sr_list, snd_samplerates, sizeof(snd_samplerates));
+            sr_list[SND_NUM_OF_SR] = 0;
+            sr_count = SND_NUM_OF_SR;
+            probed = 0;
+        }
+        else if (sr_count < 0) {
+            sr_count = probe_samplerates(i, p_di->maxInputChannels, p_di->defaultHighInputLatency, sr_list);
+            dev_cache_store(key, sr_list, sr_count);
         }
+        free(key);
+
         // Go to the next device if this one doesn't support at least one of our samplerates
-        if (!sr_supported) {
+        if (sr_count == 0) {
             continue;
         }
 
-        dev_list[dev_num]->num_of_sr = sr_count;
-
-        // Mark the end of the samplerate list for this device with a 0
-        dev_list[dev_num]->sr_list[sr_count] = 0;
+        dev = (snd_dev_t *)calloc(1, sizeof(snd_dev_t));
+        memcpy(dev->sr_list, sr_list, sizeof(dev->sr_list));
+        dev->num_of_sr = sr_count;
+        dev->probed = probed;
 
-        dev_list[dev_num]->name = (char *)malloc(strlen(p_di->name) + strlen(pa_hostapi->name) + 10);
-        dev_list[dev_num]->dev_id = i;
-        dev_list[dev_num]->num_of_channels = p_di->maxInputChannels;
-        dev_list[dev_num]->is_asio = pa_hostapi->type == paASIO;
-        snprintf(dev_list[dev_num]->name, strlen(p_di->name) + strlen(pa_hostapi->name) + 10, "%s [%s]", p_di->name, pa_hostapi->name);
+        dev->name = (char *)malloc(strlen(p_di->name) + strlen(pa_hostapi->name) + 10);
+        dev->dev_id = i;
+        dev->num_of_channels = p_di->maxInputChannels;
+        dev->is_asio = pa_hostapi->type == paASIO;
+        snprintf(dev->name, strlen(p_di->name) + strlen(pa_hostapi->name) + 10, "%s [%s]", p_di->name, pa_hostapi->name);
 
         // copy the sr_list from the device where the
         // virtual default device points to
         if (has_default_input_devices == 1) {
-            if (dev_list[0]->dev_id == dev_list[dev_num]->dev_id) {
-                memcpy(dev_list[0]->sr_list, dev_list[dev_num]->sr_list, sizeof(dev_list[dev_num]->sr_list));
-                dev_list[0]->num_of_sr = dev_list[dev_num]->num_of_sr;
-                dev_list[0]->num_of_channels = dev_list[dev_num]->num_of_channels;
-                dev_list[0]->is_asio = dev_list[dev_num]->is_asio;
+            if (dev_list[0]->dev_id == dev->dev_id) {
+                memcpy(dev_list[0]->sr_list, dev->sr_list, sizeof(dev->sr_list));
+                dev_list[0]->num_of_sr = dev->num_of_sr;
+                dev_list[0]->num_of_channels = dev->num_of_channels;
+                dev_list[0]->is_asio = dev->is_asio;
+                dev_list[0]->probed = dev->probed;
             }
         }
 
         // Replace  characters from the device name that have a special meaning to FLTK
-        strrpl(&dev_list[dev_num]->name, (char *)"\\", (char *)" ", MODE_ALL); // Must come first
-        strrpl(&dev_list[dev_num]->name, (char *)"/", (char *)"\\/", MODE_ALL);
-        strrpl(&dev_list[dev_num]->name, (char *)"|", (char *)" ", MODE_ALL);
-        strrpl(&dev_list[dev_num]->name, (char *)"\t", (char *)" ", MODE_ALL);
-        strrpl(&dev_list[dev_num]->name, (char *)"_", (char *)" ", MODE_ALL);
-        strrpl(&dev_list[dev_num]->name, (char *)"&", (char *)"+", MODE_ALL);
-
+        strrpl(&dev->name, (char *)"\\", (char *)" ", MODE_ALL); // Must come first
+        strrpl(&dev->name, (char *)"/", (char *)"\\/", MODE_ALL);
+        strrpl(&dev->name, (char *)"|", (char *)" ", MODE_ALL);
+        strrpl(&dev->name, (char *)"\t", (char *)" ", MODE_ALL);
+        strrpl(&dev->name, (char *)"_", (char *)" ", MODE_ALL);
+        strrpl(&dev->name, (char *)"&", (char *)"+", MODE_ALL);
+
+        dev_list[dev_num] = dev;
         dev_num++;
     } // for(i = 0; i < devcount && i < 100; i++)
 
+    if (mode == SND_DEVICES_PROBE && device_cache_path() != NULL) {
+        dev_cache_save(device_cache_path());
+    }
+
     *dev_count = dev_num;
 
     return dev_list;
 }
 
+// Runs in the background: probes the devices in refresh_list and updates the cache
+static void *snd_refresh_thread(void *data)
+{
+    trace_set_thread_name("devices");
+
+    for (int i = 0; i < refresh_count; i++) {
+        snd_refresh_t *r = &refresh_list[i];
+
+        if (__atomic_load_n(&refresh_cancel, __ATOMIC_RELAXED) == 1) {
+            return NULL;
+        }
+
+        r->num_of_sr = probe_samplerates(r->dev_id, r->channels, r->latency, r->sr_list);
+
+        // A device that is busy (e.g. opened by butt in the meantime) may refuse every samplerate,
+        // so an empty result is not trusted and the device keeps what is known about it
+        if (r->num_of_sr == 0) {
+            r->num_of_sr = -1;
+            continue;
+        }
+        dev_cache_store(r->key, r->sr_list, r->num_of_sr);
+    }
+
+    if (refresh_cache_path != NULL) {
+        dev_cache_save(refresh_cache_path);
+    }
+
+    if (refresh_done != NULL) {
+        refresh_done();
+    }
+
+    return NULL;
+}
+
+static void free_refresh_list(void)
+{
+    for (int i = 0; i < refresh_count; i++) {
+        free(refresh_list[i].key);
+    }
+    free(refresh_list);
+    refresh_list = NULL;
+    refresh_count = 0;
+}
+
+int snd_refresh_devices(void (*done)(void))
+{
+    snd_dev_t **dev_list = cfg.audio.pcm_list;
+    int dev_in_use = -1, dev2_in_use = -1;
+
+    if (refresh_running == 1 || cfg.audio.dev_count == 0) {
+        return -1;
+    }
+
+    if (cfg.audio.dev_num >= 0 && cfg.audio.dev_num < cfg.audio.dev_count) {
+        dev_in_use = dev_list[cfg.audio.dev_num]->dev_id;
+    }
+    if (cfg.audio.dev2_num >= 0 && cfg.audio.dev2_num < cfg.audio.dev_count) {
+        dev2_in_use = dev_list[cfg.audio.dev2_num]->dev_id;
+    }
+
+    refresh_list = (snd_refresh_t *)calloc(cfg.audio.dev_count, sizeof(snd_refresh_t));
+    refresh_count = 0;
+
+    for (int i = 0; i < cfg.audio.dev_count; i++) {
+        const PaDeviceInfo *p_di = Pa_GetDeviceInfo(dev_list[i]->dev_id);
+        snd_refresh_t *r;
+        int duplicate = 0;
+
+        if (p_di == NULL) {
+            continue;
+        }
+
+        // The virtual default device shares its id with a real device
+        for (int j = 0; j < refresh_count; j++) {
+            if (refresh_list[j].dev_id == dev_list[i]->dev_id) {
+                duplicate = 1;
+            }
+        }
+
+        int in_use = dev_list[i]->dev_id == dev_in_use || dev_list[i]->dev_id == dev2_in_use;
+
+        // Devices that are open are only probed if nothing is known about them yet
+        if (duplicate || (in_use && dev_list[i]->probed)) {
+            continue;
+        }
+
+        r = &refresh_list[refresh_count++];
+        r->dev_id = dev_list[i]->dev_id;
+        r->channels = p_di->maxInputChannels;
+        r->latency = p_di->defaultHighInputLatency;
+        r->num_of_sr = -1;
+        r->key = device_cache_key(p_di, Pa_GetHostApiInfo(p_di->hostApi));
+    }
+
+    refresh_cache_path = device_cache_path();
+    refresh_done = done;
+    __atomic_store_n(&refresh_cancel, 0, __ATOMIC_RELAXED);
+
+    if (pthread_create(&refresh_thread, NULL, snd_refresh_thread, NULL) != 0) {
+        free_refresh_list();
+        return -1;
+    }
+    refresh_running = 1;
+
+    return 0;
+}
+
+int snd_apply_device_refresh(void)
+{
+    int changed = 0;
+
+    if (refresh_running == 0) {
+        return 0;
+    }
+
+    pthread_join(refresh_thread, NULL);
+    refresh_running = 0;
+
+    for (int i = 0; i < refresh_count; i++) {
+        snd_refresh_t *r = &refresh_list[i];
+
+        if (r->num_of_sr < 0) {
+            continue;
+        }
+
+        for (int j = 0; j < cfg.audio.dev_count; j++) {
+            snd_dev_t *dev = cfg.audio.pcm_list[j];
+
+            if (dev->dev_id != r->dev_id) {
+                continue;
+            }
+
+            if (dev->num_of_sr != r->num_of_sr || memcmp(dev->sr_list, r->sr_list, r->num_of_sr * sizeof(int)) != 0) {
+                memcpy(dev->sr_list, r->sr_list, sizeof(dev->sr_list));
+                dev->num_of_sr = r->num_of_sr;
+                changed = 1;
+            }
+            dev->probed = 1;
+        }
+    }
+
+    free_refresh_list();
+
+    return changed;
+}
+
+void snd_cancel_device_refresh(void)
+{
+    if (refresh_running == 0) {
+        return;
+    }
+
+    __atomic_store_n(&refresh_cancel, 1, __ATOMIC_RELAXED);
+    pthread_join(refresh_thread, NULL);
+    refresh_running = 0;
+
+    free_refresh_list();
+}
+
 void snd_print_devices(void)
 {
     PaError err;
-    const PaDeviceInfo *di;
 
     if ((err = Pa_Initialize()) != paNoError) {
         printf("PortAudio init failed:\n%s\n", Pa_GetErrorText(err));
@@ -1833,10 +2482,11 @@ void snd_print_devices(void)
 
     int dev_count;
     snd_dev_t **dev_list;
-    dev_list = snd_get_devices(&dev_count);
+    dev_list = snd_get_devices(&dev_count, SND_DEVICES_PROBE);
 
     if (dev_count == 0) {
         printf("No input audio device available\n");
+        snd_free_device_list(dev_list, dev_count);
         return;
     }
 
@@ -1943,12 +2593,13 @@ int snd_get_dev_num_by_name(char *name)
 void snd_close_streams(void)
 {
     printf("BUTT: Début cleanup streams audio...\n");
+    pthread_mutex_lock(&probe_mutex);
     int stream_is_active = Pa_IsStreamActive(stream);
     int stream2_is_active = Pa_IsStreamActive(stream2);
+    pthread_mutex_unlock(&probe_mutex);
 
     if (stream2_is_active == 1) {
-        Pa_AbortStream(stream2);
-        Pa_CloseStream(stream2);
+        snd_abort_and_close_stream(stream2);
     }
 
     if (stream_is_active == 1) {
@@ -1975,9 +2626,9 @@ void snd_close_streams(void)
         
         // 3. Arrêter les streams PortAudio
         snd_stop_mixer_thread();
-        Pa_AbortStream(stream);
+        snd_stop_multitrack_thread();
+        snd_abort_and_close_stream(stream);
         printf("BUTT: Stream principal arrêté\n");
-        Pa_CloseStream(stream);
         
         // 4. Nettoyer les timers VU sans boucle bloquante
         g_stop_vu_meter_timer = 1;
@@ -1995,10 +2646,19 @@ void snd_close_streams(void)
         free(srconv_opus_stream.data_out);
         free(srconv_opus_record.data_out);
         free(srconv_dev2.data_out);
+        free(pa_switch_buf);
+        free(pa_switch_mix_buf);
+        free_input_bus(&primary_inputs[0]);
+        free_input_bus(&primary_inputs[1]);
 
         rb_free(&pa_pcm_rb);
+        rb_free(&pa_switch_rb);
         rb_free(&rec_rb);
         rb_free(&stream_rb);
+        if (mt_routing.channels > 0) {
+            free(mt_buf);
+            rb_free(&mt_rb);
+        }
         printf("BUTT: Buffers audio libérés\n");
     }
 
@@ -2026,7 +2686,9 @@ void snd_init_aes67(void)
     if (aes67_output) {
         // IMPORTANT: Configurer TOUS les paramètres AVANT d'initialiser (création du socket)
         aes67_output->config.sample_rate = cfg.audio.samplerate;
-        aes67_output->config.channels = cfg.audio.channel;
+        aes67_output->config.channels = mt_aes67 ? mt_routing.channels : cfg.audio.channel;
+        // Keep the packets of many channels within a 1500 byte MTU (AES67 also allows 250 us packets)
+        aes67_output->config.packet_duration_ms = cfg.audio.samplerate / 1000 * aes67_output->config.channels * 2 > 1440 ? 0.25f : 1.0f;
         aes67_output->config.bit_depth = 16;  // 16-bit pour compatibilité
         strncpy(aes67_output->config.destination_ip, 
                 cfg.aes67.ip ? cfg.aes67.ip : "239.69.145.58", 
@@ -2116,5 +2778,6 @@ void snd_init_aes67(void)
 
 void snd_close_portaudio(void)
 {
+    snd_cancel_device_refresh();
     Pa_Terminate();
 }
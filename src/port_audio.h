@@ -23,8 +23,12 @@
 
 #include "lame_encode.h"
 #include "dsp.hpp"
+#include "enc_stats.h"
+#include "loudness.h"
 
 #define SND_MAX_DEVICES (256)
+#define SND_NUM_OF_SR 11 // Samplerates that are probed for every device
+#define VU_REFRESH_CALLS 2 // snd_update_vu() calls per refresh of the VU meter widget
 
 #define INT24_MAX ((1 << 23) - 1)
 #define INT24_MIN (-(1 << 23))
@@ -35,8 +39,9 @@ extern DSPEffects *recording_dsp;
 typedef struct {
     char *name;
     int dev_id;
-    int sr_list[12]; // 8000, 11025, 12000, 16000, 22050, 24000, 32000, 44100, 48000, 88200, 96000, 0
+    int sr_list[SND_NUM_OF_SR + 1]; // Supported ones of 8000, 11025, 12000, 16000, 22050, 24000, 32000, 44100, 48000, 88200, 96000 and a terminating 0
     int num_of_sr;
+    int probed; // 0 if sr_list is a guess because the device is not cached yet
     int num_of_channels;
     int left_ch;
     int right_ch;
@@ -48,6 +53,11 @@ enum {
     SND_REC = 1,
 };
 
+enum {
+    SND_DEVICES_CACHED = 0, // Take the samplerates from the device cache, unknown devices are probed by snd_refresh_devices()
+    SND_DEVICES_PROBE = 1,  // Probe every device now
+};
+
 extern bool pa_new_frames;
 extern bool reconnect;
 extern bool next_file;
@@ -56,12 +66,28 @@ extern bool signal_detected;
 
 extern FILE *next_fd;
 
+extern enc_stats_t stream_enc_stats;
+extern enc_stats_t rec_enc_stats;
+
 int *snd_get_samplerates(int *sr_count);
 void snd_free_device_list(snd_dev_t **dev_list, int dev_count);
-snd_dev_t **snd_get_devices(int *dev_count);
+snd_dev_t **snd_get_devices(int *dev_count, int mode);
+
+// Probes the devices of cfg.audio.pcm_list in a background thread and updates the device cache.
+// <done> is called from that thread when it has finished, the results are then applied to
+// cfg.audio.pcm_list by snd_apply_device_refresh() on the main thread.
+// Returns 0 if the refresh was started and -1 if one is already running or there are no devices
+int snd_refresh_devices(void (*done)(void));
+
+// Returns 1 if the samplerates of a device in cfg.audio.pcm_list have changed, otherwise 0
+int snd_apply_device_refresh(void);
+
+// Stops a running refresh without applying it. Called before PortAudio is terminated
+void snd_cancel_device_refresh(void);
 void *snd_rec_thread(void *data);
 void *snd_stream_thread(void *data);
 void *snd_mixer_thread(void *data);
+void *snd_multitrack_thread(void *data);
 
 void snd_update_vu(int reset);
 void snd_start_streaming_thread(void);
@@ -70,6 +96,14 @@ void snd_start_recording_thread(void);
 void snd_stop_recording_thread(void);
 void snd_start_mixer_thread(void);
 void snd_stop_mixer_thread(void);
+void snd_start_multitrack_thread(void);
+void snd_stop_multitrack_thread(void);
+
+// Loudness of the streamed signal after the DSP and Stereo Tool, updated every LOUDNESS_BLOCK_MS
+void snd_get_loudness(loudness_values_t *values);
+
+// Time in metrics_now_us() at which the mixer finished its first block, 0 if it has not done so yet
+uint64_t snd_get_first_block_us(void);
 
 void snd_set_vu_level_type(int type);
 
@@ -77,6 +111,11 @@ int snd_init(void);
 void snd_init_dsp(void);
 int snd_open_streams(void);
 int snd_reopen_streams(void);
+
+// Switches the primary input to cfg.audio.dev_num while the mixer, encoders and connections keep running.
+// Returns 0 on success and 1 if the device needs a full snd_reopen_streams(), e.g. because it does not
+// support the current samplerate or could not be opened next to the current one
+int snd_switch_primary_device(void);
 void snd_close_streams(void);
 void snd_close_portaudio(void);
 void snd_print_devices(void);
@@ -17,6 +17,9 @@
 #include <unistd.h>
 #include <fcntl.h>
 #include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h>
 
 #ifdef WIN32
 #include <winsock2.h>
@@ -24,14 +27,17 @@
 #undef errno
 #undef EWOULDBLOCK
 #undef ECONNRESET
+#undef EINPROGRESS
 #define errno       WSAGetLastError()
 #define EWOULDBLOCK WSAEWOULDBLOCK
 #define ECONNRESET  WSAECONNRESET
+#define EINPROGRESS WSAEINPROGRESS
 #else
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <unistd.h>
 #include <netinet/in.h> //defines IPPROTO_TCP on BSD
+#include <netinet/tcp.h>
 #include <netdb.h>
 #include <sys/select.h>
 #include <errno.h>
@@ -47,62 +53,276 @@ void sock_init(void)
 #endif
 }
 
-int sock_connect(const char *addr, unsigned int port, sock_proto_t proto, int timout_ms)
+typedef struct sock_addr {
+    struct sockaddr_storage addr;
+    socklen_t addr_len;
+    int family;
+    int socktype;
+    int protocol;
+} sock_addr_t;
+
+typedef struct dns_cache_entry {
+    char host[256];
+    unsigned int port;
+    int socktype;
+    time_t expires;
+    int num_addrs;
+    sock_addr_t addrs[SOCK_MAX_ADDRS];
+} dns_cache_entry_t;
+
+static dns_cache_entry_t dns_cache[SOCK_DNS_CACHE_SIZE];
+static pthread_mutex_t dns_cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static uint64_t get_time_ms(void)
 {
-    int sock = -1;
-    int ret;
+#ifdef WIN32
+    return GetTickCount64();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+#endif
+}
+
+// Resolves addr and sorts the results as described in RFC 8305 section 4:
+// The address families alternate, starting with the family of the first (preferred) result
+static int sock_resolve(const char *addr, unsigned int port, int socktype, sock_addr_t *addrs)
+{
+    int n = 0;
+    int num_first = 0, num_other = 0;
+    int first_family;
     char port_str[8];
-    struct addrinfo hints, *infoptr, *p; // So no need to use memset global variables
+    struct addrinfo hints, *infoptr, *p;
+    sock_addr_t first[SOCK_MAX_ADDRS], other[SOCK_MAX_ADDRS];
 
     snprintf(port_str, sizeof(port_str), "%d", port);
     memset(&hints, 0, sizeof hints);
     hints.ai_family = AF_UNSPEC;
-    hints.ai_socktype = proto == SOCK_PROTO_TCP ? SOCK_STREAM : SOCK_DGRAM;
+    hints.ai_socktype = socktype;
 
     if (getaddrinfo(addr, port_str, &hints, &infoptr) != 0) {
         return SOCK_ERR_RESOLVE;
     }
 
+    first_family = infoptr->ai_family;
     for (p = infoptr; p != NULL; p = p->ai_next) {
-        sock = socket(p->ai_family, p->ai_socktype, p->ai_protocol);
-        if (sock == -1) {
+        sock_addr_t *a;
+        if (p->ai_family == first_family && num_first < SOCK_MAX_ADDRS) {
+            a = &first[num_first++];
+        }
+        else if (p->ai_family != first_family && num_other < SOCK_MAX_ADDRS) {
+            a = &other[num_other++];
+        }
+        else {
             continue;
         }
 
-        ret = connect(sock, p->ai_addr, p->ai_addrlen);
-        if (ret == -1) {
-            sock_close(sock);
-            continue;
+        memcpy(&a->addr, p->ai_addr, p->ai_addrlen);
+        a->addr_len = p->ai_addrlen;
+        a->family = p->ai_family;
+        a->socktype = p->ai_socktype;
+        a->protocol = p->ai_protocol;
+    }
+    freeaddrinfo(infoptr);
+
+    for (int i = 0; n < SOCK_MAX_ADDRS && (i < num_first || i < num_other); i++) {
+        if (i < num_first) {
+            addrs[n++] = first[i];
+        }
+        if (i < num_other && n < SOCK_MAX_ADDRS) {
+            addrs[n++] = other[i];
         }
+    }
 
-        break;
+    return n;
+}
+
+// Returns the cached addresses of addr or resolves them if the cache entry is missing or expired
+static int sock_resolve_cached(const char *addr, unsigned int port, int socktype, sock_addr_t *addrs)
+{
+    int n;
+    int oldest = 0;
+    time_t now = time(NULL);
+
+    if (strlen(addr) >= sizeof(dns_cache[0].host)) {
+        return sock_resolve(addr, port, socktype, addrs);
     }
 
-    if (sock == -1) {
-        freeaddrinfo(infoptr);
-        return SOCK_ERR_CREATE;
+    pthread_mutex_lock(&dns_cache_mutex);
+    for (int i = 0; i < SOCK_DNS_CACHE_SIZE; i++) {
+        dns_cache_entry_t *e = &dns_cache[i];
+        if (e->num_addrs > 0 && e->expires > now && e->port == port && e->socktype == socktype && !strcmp(e->host, addr)) {
+            n = e->num_addrs;
+            memcpy(addrs, e->addrs, n * sizeof(sock_addr_t));
+            pthread_mutex_unlock(&dns_cache_mutex);
+            return n;
+        }
     }
+    pthread_mutex_unlock(&dns_cache_mutex);
 
-    if (ret == -1) {
-        freeaddrinfo(infoptr);
-        return SOCK_TIMEOUT;
+    // getaddrinfo() may block for a long time, don't hold the lock meanwhile
+    n = sock_resolve(addr, port, socktype, addrs);
+    if (n <= 0) {
+        return n;
     }
 
-    sock_nonblock(sock);
-    if (sock_select(sock, timout_ms, WRITE) <= 0) {
-        sock_close(sock);
-        freeaddrinfo(infoptr);
-        return SOCK_TIMEOUT;
+    pthread_mutex_lock(&dns_cache_mutex);
+    for (int i = 0; i < SOCK_DNS_CACHE_SIZE; i++) {
+        if (dns_cache[i].expires < dns_cache[oldest].expires) {
+            oldest = i;
+        }
     }
+    dns_cache_entry_t *e = &dns_cache[oldest];
+    snprintf(e->host, sizeof(e->host), "%s", addr);
+    e->port = port;
+    e->socktype = socktype;
+    e->expires = now + SOCK_DNS_CACHE_TTL;
+    e->num_addrs = n;
+    memcpy(e->addrs, addrs, n * sizeof(sock_addr_t));
+    pthread_mutex_unlock(&dns_cache_mutex);
+
+    return n;
+}
 
-    if (!sock_isvalid(sock)) {
-        sock_close(sock);
-        freeaddrinfo(infoptr);
-        return SOCK_INVALID;
+// Forces a new lookup on the next connection attempt, e.g. because none of the cached addresses was reachable
+static void sock_dns_cache_invalidate(const char *addr, unsigned int port, int socktype)
+{
+    pthread_mutex_lock(&dns_cache_mutex);
+    for (int i = 0; i < SOCK_DNS_CACHE_SIZE; i++) {
+        dns_cache_entry_t *e = &dns_cache[i];
+        if (e->port == port && e->socktype == socktype && !strcmp(e->host, addr)) {
+            e->num_addrs = 0;
+            e->expires = 0;
+        }
     }
+    pthread_mutex_unlock(&dns_cache_mutex);
+}
 
-    freeaddrinfo(infoptr);
-    return sock;
+// Happy Eyeballs (RFC 8305): The candidates are tried with non-blocking sockets in the order
+// returned by sock_resolve(). A new attempt starts SOCK_HE_ATTEMPT_DELAY ms after the previous one
+// or immediately if the previous one failed. The first attempt that succeeds wins.
+// Every attempt is aborted after CONN_ATTEMPT_TIMEOUT ms, the whole connect after timout_ms
+int sock_connect(const char *addr, unsigned int port, sock_proto_t proto, int timout_ms)
+{
+    int n;
+    int ret;
+    int winner = -1;
+    int next = 0;
+    int num_active = 0;
+    int created = 0;
+    int socktype = proto == SOCK_PROTO_TCP ? SOCK_STREAM : SOCK_DGRAM;
+    int socks[SOCK_MAX_ADDRS];
+    uint64_t started[SOCK_MAX_ADDRS];
+    sock_addr_t addrs[SOCK_MAX_ADDRS];
+    uint64_t now, wake_up;
+    uint64_t deadline, next_start;
+
+    n = sock_resolve_cached(addr, port, socktype, addrs);
+    if (n <= 0) {
+        return SOCK_ERR_RESOLVE;
+    }
+
+    now = get_time_ms();
+    deadline = now + timout_ms;
+    next_start = now;
+
+    while (winner == -1 && (now = get_time_ms()) < deadline) {
+        // Start the next attempt
+        if (next < n && (now >= next_start || num_active == 0)) {
+            sock_addr_t *a = &addrs[next++];
+            int s = socket(a->family, a->socktype, a->protocol);
+            if (s == -1) {
+                continue;
+            }
+            created = 1;
+            sock_nonblock(s);
+
+            ret = connect(s, (struct sockaddr *)&a->addr, a->addr_len);
+            if (ret == 0) { // UDP or loopback
+                winner = s;
+                break;
+            }
+            if (errno != EINPROGRESS && errno != EWOULDBLOCK) {
+                sock_close(s);
+                next_start = now;
+                continue;
+            }
+
+            socks[num_active] = s;
+            started[num_active] = now;
+            num_active++;
+            next_start = now + SOCK_HE_ATTEMPT_DELAY;
+            continue;
+        }
+
+        if (num_active == 0) { // All candidates failed
+            break;
+        }
+
+        // Wait until an attempt finishes, times out or the next one has to be started
+        wake_up = deadline;
+        if (next < n && next_start < wake_up) {
+            wake_up = next_start;
+        }
+        for (int i = 0; i < num_active; i++) {
+            if (started[i] + CONN_ATTEMPT_TIMEOUT < wake_up) {
+                wake_up = started[i] + CONN_ATTEMPT_TIMEOUT;
+            }
+        }
+
+        struct timeval tv;
+        fd_set fd_wr, fd_ex;
+        int max_fd = 0;
+        FD_ZERO(&fd_wr);
+        FD_ZERO(&fd_ex);
+        for (int i = 0; i < num_active; i++) {
+            FD_SET(socks[i], &fd_wr);
+            FD_SET(socks[i], &fd_ex); // Windows reports failed connects as exception
+            if (socks[i] > max_fd) {
+                max_fd = socks[i];
+            }
+        }
+
+        tv.tv_sec = wake_up > now ? (wake_up - now) / 1000 : 0;
+        tv.tv_usec = wake_up > now ? ((wake_up - now) % 1000) * 1000 : 0;
+        ret = select(max_fd + 1, NULL, &fd_wr, &fd_ex, &tv);
+        if (ret < 0) {
+            break;
+        }
+
+        now = get_time_ms();
+        for (int i = 0; i < num_active; i++) {
+            int done = FD_ISSET(socks[i], &fd_wr) || FD_ISSET(socks[i], &fd_ex);
+            if (done && winner == -1 && sock_isvalid(socks[i])) {
+                winner = socks[i];
+            }
+            else if (done || now >= started[i] + CONN_ATTEMPT_TIMEOUT) {
+                sock_close(socks[i]);
+                next_start = now;
+            }
+            else {
+                continue;
+            }
+
+            // Remove the finished attempt from the list
+            socks[i] = socks[num_active - 1];
+            started[i] = started[num_active - 1];
+            num_active--;
+            i--;
+        }
+    }
+
+    // Abort the attempts that lost the race
+    for (int i = 0; i < num_active; i++) {
+        sock_close(socks[i]);
+    }
+
+    if (winner == -1) {
+        sock_dns_cache_invalidate(addr, port, socktype);
+        return created ? SOCK_TIMEOUT : SOCK_ERR_CREATE;
+    }
+
+    return winner;
 }
 
 int sock_setbufsize(int s, int send_size, int recv_size)
@@ -126,27 +346,52 @@ int sock_setbufsize(int s, int send_size, int recv_size)
     return 0;
 }
 
+// Tunes a connected TCP socket for a continuous low latency stream:
+// - <send_size> bytes of socket send buffer (0 = keep the system default)
+// - at most <notsent_lowat> bytes may wait unsent in the kernel before select() blocks (0 = keep the default)
+// - Nagle is disabled because the callers already write in large blocks
+int sock_tune_stream(int s, int send_size, int notsent_lowat)
+{
+    int val = 1;
+    int ret = 0;
+
+    if (setsockopt(s, IPPROTO_TCP, TCP_NODELAY, (const char *)&val, sizeof(val)) != 0) {
+        ret = SOCK_ERR_SET_SBUF;
+    }
+
+    if (send_size > 0 && sock_setbufsize(s, send_size, 0) != 0) {
+        ret = SOCK_ERR_SET_SBUF;
+    }
+
+#ifdef TCP_NOTSENT_LOWAT
+    if (notsent_lowat > 0 && setsockopt(s, IPPROTO_TCP, TCP_NOTSENT_LOWAT, (const char *)&notsent_lowat, sizeof(notsent_lowat)) != 0) {
+        ret = SOCK_ERR_SET_SBUF;
+    }
+#else
+    (void)notsent_lowat;
+#endif
+
+    return ret;
+}
+
 int sock_send(int s, const char *buf, int len, int timout_ms)
 {
     int rc;
     int sent = 0;
 
+    // Try to send right away and only wait for the socket if its send buffer is full.
+    // Most of the time the kernel accepts the whole block, which saves one select() per call
     while (sent < len) {
-        rc = sock_select(s, 10000, WRITE); // check if socket is connected
-
-        if (rc == 0) {
-            return SOCK_TIMEOUT;
-        }
-
-        if (rc == -1) {
-            return SOCK_TIMEOUT;
-        }
-
         if ((rc = send(s, buf + sent, len - sent, 0)) < 0) {
             if (errno != EWOULDBLOCK) {
                 return SOCK_TIMEOUT;
             }
-            rc = 0;
+
+            rc = sock_select(s, 10000, WRITE);
+            if (rc <= 0) {
+                return SOCK_TIMEOUT;
+            }
+            continue;
         }
 
         sent += rc;
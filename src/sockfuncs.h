@@ -25,6 +25,11 @@ typedef int socklen_t;
 
 #define SOCK_MAX_DATAGRAM_SIZE 65535
 
+#define SOCK_MAX_ADDRS 16        // Max. number of resolved addresses per host that are tried
+#define SOCK_DNS_CACHE_SIZE 8
+#define SOCK_DNS_CACHE_TTL 60    // seconds
+#define SOCK_HE_ATTEMPT_DELAY 250 // ms, Happy Eyeballs "Connection Attempt Delay" (RFC 8305)
+
 enum {
     READ = 0,
     WRITE = 1,
@@ -45,7 +50,8 @@ enum {
 };
 
 enum {
-    CONN_TIMEOUT = 1000,
+    CONN_TIMEOUT = 5000,
+    CONN_ATTEMPT_TIMEOUT = 2000,
     SEND_TIMEOUT = 3000,
     RECV_TIMEOUT = 1000,
 };
@@ -63,6 +69,7 @@ int sock_init_udp_server(sock_udp_conn_t *udp_conn);
 int sock_connect(const char *addr, unsigned int port, sock_proto_t proto, int timout_ms);
 int sock_listen(int port, int *listen_sock);
 int sock_setbufsize(int s, int send_size, int recv_size);
+int sock_tune_stream(int s, int send_size, int notsent_lowat);
 int sock_isdisconnected(int s);
 int sock_send(int s, const char *buf, int len, int timout_ms);
 int sock_sendto(int s, const char *buf, int len, sock_udp_conn_t *udp_conn, int timout_ms);
@@ -0,0 +1,191 @@
+// song file functions for butt
+//
+// Copyright 2007-2018 by Daniel Noethen.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "config.h"
+#include "file_watch.h"
+#include "song_file.h"
+
+static char *strip_bom(char *line)
+{
+    if ((uint8_t)line[0] == 0xEF && (uint8_t)line[1] == 0xBB && (uint8_t)line[2] == 0xBF) {
+        memmove(line, line + 3, strlen(line + 3) + 1);
+    }
+    return line;
+}
+
+static char *get_first_line(FILE *fd)
+{
+    size_t len = 0;
+    size_t size = 256;
+    int c;
+    char *line = (char *)malloc(size);
+
+    if (line == NULL) {
+        return NULL;
+    }
+
+    while ((c = getc(fd)) != EOF && c != '\n') {
+        if (len + 1 == size) {
+            char *tmp = (char *)realloc(line, size * 2);
+            if (tmp == NULL) {
+                free(line);
+                return NULL;
+            }
+            line = tmp;
+            size *= 2;
+        }
+        line[len++] = (char)c;
+    }
+
+    if (ferror(fd)) {
+        free(line);
+        return NULL;
+    }
+
+    if (len > 0 && line[len - 1] == '\r') { // Windows
+        len--;
+    }
+    line[len] = '\0';
+
+    return line;
+}
+
+// Scans backwards from the end of the file in chunks. Trailing line endings are skipped,
+// some programs end the file with a newline and some don't
+static char *get_last_line(FILE *fd)
+{
+    char buf[SONG_FILE_CHUNK_SIZE];
+    long pos, line_start = 0, line_end = -1;
+    size_t n;
+    char *line;
+
+    if (fseek(fd, 0, SEEK_END) != 0 || (pos = ftell(fd)) < 0) {
+        return NULL;
+    }
+
+    while (pos > 0) {
+        n = pos > (long)sizeof(buf) ? sizeof(buf) : (size_t)pos;
+        pos -= n;
+        if (fseek(fd, pos, SEEK_SET) != 0 || fread(buf, 1, n, fd) != n) {
+            return NULL;
+        }
+
+        for (long i = (long)n - 1; i >= 0; i--) {
+            if (line_end == -1) {
+                if (buf[i] != '\n' && buf[i] != '\r') {
+                    line_end = pos + i + 1;
+                }
+            }
+            else if (buf[i] == '\n') {
+                line_start = pos + i + 1;
+                goto found;
+            }
+        }
+    }
+
+found:
+    if (line_end == -1) { // Empty file or only line endings
+        line_start = line_end = 0;
+    }
+
+    line = (char *)malloc(line_end - line_start + 1);
+    if (line == NULL) {
+        return NULL;
+    }
+
+    n = line_end - line_start;
+    if (n > 0 && (fseek(fd, line_start, SEEK_SET) != 0 || fread(line, 1, n, fd) != n)) {
+        free(line);
+        return NULL;
+    }
+    line[n] = '\0';
+
+    return line;
+}
+
+char *song_file_read(FILE *fd, int read_last_line)
+{
+    char *line = read_last_line ? get_last_line(fd) : get_first_line(fd);
+
+    return line != NULL ? strip_bom(line) : NULL;
+}
+
+static file_watch song_watch;
+static int watch_read_last_line = 0;
+static char *last_title = NULL;
+static void (*watch_on_title)(char *title);
+
+static void song_file_changed(void *data, int forced)
+{
+    FILE *fd;
+    char *title;
+    (void)data;
+
+    // The file may be gone for a moment while a writer replaces it. It is read again on the next event
+    if ((fd = fopen(song_watch.path, "rb")) == NULL) {
+        return;
+    }
+    title = song_file_read(fd, __atomic_load_n(&watch_read_last_line, __ATOMIC_RELAXED));
+    fclose(fd);
+
+    if (title == NULL) {
+        return;
+    }
+
+    if (!forced && last_title != NULL && !strcmp(title, last_title)) {
+        free(title);
+        return;
+    }
+
+    free(last_title);
+    last_title = strdup(title);
+
+    watch_on_title(title);
+}
+
+int song_file_watch(const char *path, int read_last_line, int force_read, void (*on_title)(char *title))
+{
+    __atomic_store_n(&watch_read_last_line, read_last_line, __ATOMIC_RELAXED);
+
+    if (song_watch.running && !strcmp(path, song_watch.path)) {
+        if (force_read) {
+            return file_watch_trigger(&song_watch);
+        }
+        return 0;
+    }
+
+    song_file_watch_stop();
+
+    watch_on_title = on_title;
+    if (file_watch_start(&song_watch, path, SONG_FILE_DEBOUNCE_MS, song_file_changed, NULL) != 0) {
+        return -1;
+    }
+
+    // The current title is read right away
+    return file_watch_trigger(&song_watch);
+}
+
+void song_file_watch_stop(void)
+{
+    file_watch_stop(&song_watch);
+
+    free(last_title);
+    last_title = NULL;
+}
@@ -0,0 +1,37 @@
+// song file functions for butt
+//
+// Copyright 2007-2018 by Daniel Noethen.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+
+#ifndef SONG_FILE_H
+#define SONG_FILE_H
+
+#include <stdio.h>
+
+#define SONG_FILE_CHUNK_SIZE 4096
+#define SONG_FILE_DEBOUNCE_MS 50 // Quiet time after the last change before the file is read
+
+// Reads the first or the last line of <fd> without line endings and UTF-8 BOM.
+// Lines may have any length. Returns a newly allocated string or NULL on error. The caller must free() it
+char *song_file_read(FILE *fd, int read_last_line);
+
+// Watches <path> from a background thread and calls <on_title> with the title whenever
+// the file was written (closed after writing or renamed into place). <on_title> is called from the
+// watcher thread and takes ownership of <title>. Unchanged titles are not reported, except for the
+// first read and when <force_read> is set.
+// Calling it again with the same path only handles <force_read>, a new path restarts the watcher.
+// Returns 0 if the file is watched and -1 if it has to be polled (no inotify, invalid path)
+int song_file_watch(const char *path, int read_last_line, int force_read, void (*on_title)(char *title));
+void song_file_watch_stop(void);
+
+#endif
@@ -0,0 +1,189 @@
+// song update functions for butt
+//
+// Copyright 2007-2018 by Daniel Noethen.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#ifdef WIN32
+#include "tray_agent.h"
+#endif
+
+#include "gettext.h"
+#include "config.h"
+
+#include "atom.h"
+#include "cfg.h"
+#include "butt.h"
+#include "timer.h"
+#include "shoutcast.h"
+#include "icecast.h"
+#include "fl_funcs.h"
+#include "song_update.h"
+
+#define SONG_UPDATE_POLL_MS 50
+
+static pthread_t song_update_thread_detached;
+static pthread_mutex_t song_mutex = PTHREAD_MUTEX_INITIALIZER;
+static int song_update_thread_started = 0;
+static ATOM_NEW_COND(song_cond);
+
+// Only the latest submitted title is kept. Older titles that haven't been sent yet are dropped
+static char pending_song[512];
+static int pending = 0;
+static int pending_initial = 0;
+static uint64_t pending_due = 0;
+static uint64_t last_sent = 0;
+
+static void send_song(char *song, int initial)
+{
+    int (*xc_update_song)(char *song_name) = NULL;
+    char text_buf[512];
+
+    if (!connected) {
+        return;
+    }
+
+    // In-stream metadata
+    if (!strcmp(cfg.audio.codec, "flac")) {
+        if (initial == 0) {
+            flac_update_song_title(&flac_stream, song);
+        }
+        else {
+            flac_set_initial_song_title(&flac_stream, song);
+        }
+    }
+
+    if (!strcmp(cfg.audio.codec, "opus")) {
+        opus_update_song_title(&opus_stream, song);
+    }
+
+    // Out-of-band metadata via the servers admin interface
+    if (cfg.srv[cfg.selected_srv]->type == ICECAST) {
+        xc_update_song = &ic_update_song;
+    }
+    else { // if(cfg.srv[cfg.selected_srv]->type == SHOUTCAST)
+        xc_update_song = &sc_update_song;
+    }
+
+    if (xc_update_song(song) == 0) {
+        snprintf(text_buf, sizeof(text_buf), _("Updated songname to:\n%s\n"), song);
+
+        print_info(text_buf, 0);
+#ifdef WIN32
+        tray_agent_set_song(song);
+        tray_agent_send_cmd(TA_SONG_UPDATE);
+#endif
+    }
+    else {
+        print_info(_("Updating songname failed"), 1);
+    }
+}
+
+// Returns the number of milliseconds until the pending title may be sent
+static uint64_t get_wait_time(void)
+{
+    uint64_t now = timer_get_cur_time();
+    uint64_t send_at = pending_due;
+
+    if (pending_initial == 0 && last_sent + SONG_UPDATE_MIN_INTERVAL_MS > send_at) {
+        send_at = last_sent + SONG_UPDATE_MIN_INTERVAL_MS;
+    }
+
+    return send_at > now ? send_at - now : 0;
+}
+
+static void *song_update_thread_func(void *data)
+{
+    char song[sizeof(pending_song)];
+    int initial;
+    uint64_t wait_ms;
+    struct timespec poll_time;
+    (void)data;
+
+    // Detach thread (free ressources) because no one will call pthread_join() on it
+    pthread_detach(pthread_self());
+
+    for (;;) {
+        atom_cond_wait(&song_cond);
+
+        for (;;) {
+            pthread_mutex_lock(&song_mutex);
+            if (pending == 0) {
+                pthread_mutex_unlock(&song_mutex);
+                break;
+            }
+
+            wait_ms = get_wait_time();
+            if (wait_ms == 0) {
+                snprintf(song, sizeof(song), "%s", pending_song);
+                initial = pending_initial;
+                pending = 0;
+                pending_initial = 0;
+                pthread_mutex_unlock(&song_mutex);
+
+                send_song(song, initial);
+
+                pthread_mutex_lock(&song_mutex);
+                last_sent = timer_get_cur_time();
+                pthread_mutex_unlock(&song_mutex);
+                continue;
+            }
+            pthread_mutex_unlock(&song_mutex);
+
+            // Newer titles may arrive while we wait. They replace the pending one
+            if (wait_ms > SONG_UPDATE_POLL_MS) {
+                wait_ms = SONG_UPDATE_POLL_MS;
+            }
+            poll_time.tv_sec = 0;
+            poll_time.tv_nsec = (long)wait_ms * 1000 * 1000;
+            nanosleep(&poll_time, NULL);
+        }
+    }
+
+    return NULL;
+}
+
+int song_update_init(void)
+{
+    if (song_update_thread_started == 1) {
+        return 0;
+    }
+
+    if (pthread_create(&song_update_thread_detached, NULL, song_update_thread_func, NULL) != 0) {
+        return -1;
+    }
+
+    song_update_thread_started = 1;
+    return 0;
+}
+
+void song_update_submit(const char *song, uint64_t submitted_at, int initial)
+{
+    pthread_mutex_lock(&song_mutex);
+    snprintf(pending_song, sizeof(pending_song), "%s", song);
+    pending = 1;
+    pending_initial |= initial;
+
+    // The listeners hear the audio of <submitted_at> only after StereoTool has processed it
+    pending_due = submitted_at;
+    if (initial == 0 && cfg.stereo_tool.enabled_stream && cfg.stereo_tool.latency_ms > 0) {
+        pending_due += cfg.stereo_tool.latency_ms;
+    }
+    pthread_mutex_unlock(&song_mutex);
+
+    atom_cond_signal(&song_cond);
+}
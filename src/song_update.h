@@ -0,0 +1,34 @@
+// song update functions for butt
+//
+// Copyright 2007-2018 by Daniel Noethen.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+
+#ifndef SONG_UPDATE_H
+#define SONG_UPDATE_H
+
+#include <stdint.h>
+
+// Minimum time between two song updates sent to the server.
+// Titles that are submitted within this window are coalesced, only the latest one is sent
+#define SONG_UPDATE_MIN_INTERVAL_MS 2000
+
+// Starts the worker thread that sends song updates to the server
+int song_update_init(void);
+
+// Queues <song> for the next song update and returns immediately.
+// <submitted_at> is the time (timer_get_cur_time()) the title became current. The update
+// is sent once the audio of that moment has passed the StereoTool processing delay.
+// <initial> marks the first title after connecting, which is sent without waiting
+void song_update_submit(const char *song, uint64_t submitted_at, int initial);
+
+#endif
@@ -2,6 +2,7 @@
 #include "cfg.h"
 #include "butt.h"
 #include "util.h"
+#include "trace.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -337,14 +338,14 @@ int stereo_tool_load_preset(stereo_tool_t *st, const char *preset_file) {
     return 0;
 }
 
+// Called by the mixer thread for every block, so diagnostics go through TRACE() instead of stdio
 int stereo_tool_process_samples(stereo_tool_t *st, float *samples, int num_samples) {
     static int process_debug_counter = 0;
     
     if (!st || !samples || num_samples <= 0) {
         if (process_debug_counter == 0) {
-            printf("DEBUG: stereo_tool_process_samples() - Invalid params: st=%p, samples=%p, num_samples=%d\n", 
-                   st, samples, num_samples);
-            fflush(stdout);
+            TRACE(TRACE_ERROR, "stereo_tool_process_samples(): invalid params: st=%p, samples=%p, num_samples=%d", (void *)st, (void *)samples,
+                  num_samples);
         }
         return -1;
     }
@@ -354,9 +355,8 @@ int stereo_tool_process_samples(stereo_tool_t *st, float *samples, int num_sampl
     
     if (st->status != STEREO_TOOL_ENABLED || !st->instance || !stereoTool_Process_ptr) {
         if (process_debug_counter == 0) {
-            printf("DEBUG: stereo_tool_process_samples() - Not ready: status=%d, instance=%p, process_ptr=%p\n", 
-                   st->status, st->instance, stereoTool_Process_ptr);
-            fflush(stdout);
+            TRACE(TRACE_WARN, "stereo_tool_process_samples(): not ready: status=%d, instance=%p, process_ptr=%p", st->status, (void *)st->instance,
+                  (void *)stereoTool_Process_ptr);
         }
         pthread_mutex_unlock(&st->mutex);
         return -1;
@@ -364,8 +364,7 @@ int stereo_tool_process_samples(stereo_tool_t *st, float *samples, int num_sampl
     
     process_debug_counter++;
     if (process_debug_counter == 100) {
-        printf("DEBUG: stereo_tool_process_samples() - Processing %d samples\n", num_samples);
-        fflush(stdout);
+        TRACE(TRACE_DEBUG, "stereo_tool_process_samples(): processing %d samples", num_samples);
         process_debug_counter = 0;
     }
     
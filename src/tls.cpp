@@ -23,6 +23,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdint.h>
+#include <pthread.h>
 #ifndef WIN32
 #include <sys/select.h>
 #endif
@@ -53,6 +54,22 @@ static void key_log_cb(const SSL *ssl, const char *line)
 }
 #endif
 
+// All connections share one SSL_CTX, so the trust store is only loaded once.
+// It is rebuilt if the user changes the cert file or directory
+static SSL_CTX *shared_ctx = NULL;
+static char *shared_ctx_cert_file = NULL;
+static char *shared_ctx_cert_dir = NULL;
+
+// Client side session cache for resumption (TLS 1.2 session ids and TLS 1.3 tickets), keyed by host:port
+typedef struct tls_session {
+    char key[300];
+    SSL_SESSION *session;
+} tls_session_t;
+
+static tls_session_t session_cache[TLS_SESSION_CACHE_SIZE];
+static int session_cache_next = 0;
+static pthread_mutex_t tls_mutex = PTHREAD_MUTEX_INITIALIZER;
+
 static void set_error(tls_t *tls, const char *err_msg)
 {
     int len = (int)strlen(err_msg) + 1;
@@ -248,14 +265,98 @@ static int calc_cert_hash(tls_t *tls)
     return TLS_OK;
 }
 
-int tls_setup(tls_t *tls)
+static int str_equal(const char *a, const char *b)
 {
-    int ret = 0;
-    long ssl_opts = 0;
+    if (a == NULL || b == NULL) {
+        return a == b;
+    }
+    return !strcmp(a, b);
+}
 
-    tls->ssl = NULL;
-    tls->ssl_ctx = NULL;
-    tls->last_err = NULL;
+static void get_session_key(tls_t *tls, char *key, size_t key_size)
+{
+    snprintf(key, key_size, "%s:%d", tls->host, tls->port);
+}
+
+// Called by OpenSSL whenever the server hands out a new session.
+// With TLS 1.3 this happens after the handshake when the ticket arrives
+static int new_session_cb(SSL *ssl, SSL_SESSION *session)
+{
+    char key[sizeof(session_cache[0].key)];
+    tls_t *tls = (tls_t *)SSL_get_app_data(ssl);
+    tls_session_t *entry = NULL;
+
+    if (tls == NULL || tls->host == NULL) {
+        return 0;
+    }
+
+    get_session_key(tls, key, sizeof(key));
+
+    pthread_mutex_lock(&tls_mutex);
+    for (int i = 0; i < TLS_SESSION_CACHE_SIZE; i++) {
+        if (!strcmp(session_cache[i].key, key)) {
+            entry = &session_cache[i];
+            break;
+        }
+    }
+    if (entry == NULL) {
+        entry = &session_cache[session_cache_next];
+        session_cache_next = (session_cache_next + 1) % TLS_SESSION_CACHE_SIZE;
+    }
+
+    if (entry->session != NULL) {
+        SSL_SESSION_free(entry->session);
+    }
+    snprintf(entry->key, sizeof(entry->key), "%s", key);
+    entry->session = session;
+    pthread_mutex_unlock(&tls_mutex);
+
+    return 1; // We keep the reference
+}
+
+// Takes a reference of the cached session of the server or returns NULL
+static SSL_SESSION *get_cached_session(tls_t *tls)
+{
+    char key[sizeof(session_cache[0].key)];
+    SSL_SESSION *session = NULL;
+
+    get_session_key(tls, key, sizeof(key));
+
+    pthread_mutex_lock(&tls_mutex);
+    for (int i = 0; i < TLS_SESSION_CACHE_SIZE; i++) {
+        if (session_cache[i].session != NULL && !strcmp(session_cache[i].key, key)) {
+            session = session_cache[i].session;
+            SSL_SESSION_up_ref(session);
+            break;
+        }
+    }
+    pthread_mutex_unlock(&tls_mutex);
+
+    return session;
+}
+
+// A failed handshake must not be retried with the same session
+static void remove_cached_session(tls_t *tls)
+{
+    char key[sizeof(session_cache[0].key)];
+
+    get_session_key(tls, key, sizeof(key));
+
+    pthread_mutex_lock(&tls_mutex);
+    for (int i = 0; i < TLS_SESSION_CACHE_SIZE; i++) {
+        if (session_cache[i].session != NULL && !strcmp(session_cache[i].key, key)) {
+            SSL_SESSION_free(session_cache[i].session);
+            session_cache[i].session = NULL;
+            session_cache[i].key[0] = '\0';
+        }
+    }
+    pthread_mutex_unlock(&tls_mutex);
+}
+
+static SSL_CTX *create_ctx(tls_t *tls)
+{
+    SSL_CTX *ctx;
+    long ssl_opts = 0;
 
 // Checks for OpenSSL version < 1.1.x
 #if OPENSSL_VERSION_NUMBER < 0x10100000L
@@ -264,23 +365,32 @@ int tls_setup(tls_t *tls)
     // SSLeay_add_all_algorithms();
     // SSLeay_add_ssl_algorithms();
 
-    tls->ssl_ctx = SSL_CTX_new(TLSv1_client_method());
+    ctx = SSL_CTX_new(TLSv1_client_method());
     ssl_opts |= SSL_OP_NO_SSLv2 | SSL_OP_NO_SSLv3;
 #else
-    tls->ssl_ctx = SSL_CTX_new(TLS_client_method());
-    SSL_CTX_set_min_proto_version(tls->ssl_ctx, TLS1_VERSION);
+    ctx = SSL_CTX_new(TLS_client_method());
+    SSL_CTX_set_min_proto_version(ctx, TLS1_VERSION);
 #endif
+    if (ctx == NULL) {
+        return NULL;
+    }
 
     // Compression is dangerous -> https://en.wikipedia.org/wiki/CRIME
     ssl_opts |= SSL_OP_NO_COMPRESSION;
 
-    SSL_CTX_set_options(tls->ssl_ctx, ssl_opts);
-    SSL_CTX_set_default_verify_paths(tls->ssl_ctx);
+#if defined(__linux__) && defined(SSL_OP_ENABLE_KTLS)
+    // Let the kernel do the record encryption if it supports the negotiated cipher.
+    // OpenSSL silently falls back to user space encryption otherwise
+    ssl_opts |= SSL_OP_ENABLE_KTLS;
+#endif
+
+    SSL_CTX_set_options(ctx, ssl_opts);
+    SSL_CTX_set_default_verify_paths(ctx);
 
     // Add cert file and directory separately.
     // So in case one contains a invalid path, the other will still work
-    SSL_CTX_load_verify_locations(tls->ssl_ctx, tls->cert_file, NULL);
-    SSL_CTX_load_verify_locations(tls->ssl_ctx, NULL, tls->cert_dir);
+    SSL_CTX_load_verify_locations(ctx, tls->cert_file, NULL);
+    SSL_CTX_load_verify_locations(ctx, NULL, tls->cert_dir);
 
 #ifdef __APPLE__
     char path_to_executeable[PATH_MAX];
@@ -291,27 +401,83 @@ int tls_setup(tls_t *tls)
         char *folder_of_executable = strdup(dirname(path_to_executeable));
         snprintf(path_to_ca_file, PATH_MAX, "%s%s", folder_of_executable, "/../Resources/cacert.pem");
         free(folder_of_executable);
-        SSL_CTX_load_verify_locations(tls->ssl_ctx, path_to_ca_file, NULL);
+        SSL_CTX_load_verify_locations(ctx, path_to_ca_file, NULL);
     }
 #endif
 #ifdef WIN32
-    SSL_CTX_load_verify_locations(tls->ssl_ctx, "cacert.pem", NULL);
+    SSL_CTX_load_verify_locations(ctx, "cacert.pem", NULL);
 #endif
 
     // We verify by ourself later
-    SSL_CTX_set_verify(tls->ssl_ctx, SSL_VERIFY_NONE, NULL);
+    SSL_CTX_set_verify(ctx, SSL_VERIFY_NONE, NULL);
 
-    if (SSL_CTX_set_cipher_list(tls->ssl_ctx, ALLOWED_CIPHERS) != 1) {
-        set_error(tls, _("tls_setup: Could not set cipher list"));
-        return TLS_UNSPECIFICERR;
+    if (SSL_CTX_set_cipher_list(ctx, ALLOWED_CIPHERS) != 1) {
+        SSL_CTX_free(ctx);
+        return NULL;
     }
 
-    SSL_CTX_set_mode(tls->ssl_ctx, SSL_MODE_AUTO_RETRY);
+    SSL_CTX_set_mode(ctx, SSL_MODE_AUTO_RETRY);
+
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+    // Sessions are stored by new_session_cb() only, OpenSSL's internal cache is for servers
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+    SSL_CTX_sess_set_new_cb(ctx, new_session_cb);
+#endif
 
 #ifdef DEBUG
     fd = fopen("/Users/bip/tls_key.txt", "ab");
-    SSL_CTX_set_keylog_callback(tls->ssl_ctx, key_log_cb);
+    SSL_CTX_set_keylog_callback(ctx, key_log_cb);
+#endif
+
+    return ctx;
+}
+
+// Returns a new reference of the shared SSL_CTX
+static SSL_CTX *get_ctx(tls_t *tls)
+{
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
+    // No SSL_CTX_up_ref(). Every connection gets its own context
+    return create_ctx(tls);
+#else
+    SSL_CTX *ctx;
+
+    pthread_mutex_lock(&tls_mutex);
+    if (shared_ctx != NULL && (!str_equal(shared_ctx_cert_file, tls->cert_file) || !str_equal(shared_ctx_cert_dir, tls->cert_dir))) {
+        SSL_CTX_free(shared_ctx); // Connections that still use it hold their own reference
+        shared_ctx = NULL;
+    }
+
+    if (shared_ctx == NULL) {
+        shared_ctx = create_ctx(tls);
+        free(shared_ctx_cert_file);
+        free(shared_ctx_cert_dir);
+        shared_ctx_cert_file = tls->cert_file != NULL ? strdup(tls->cert_file) : NULL;
+        shared_ctx_cert_dir = tls->cert_dir != NULL ? strdup(tls->cert_dir) : NULL;
+    }
+
+    ctx = shared_ctx;
+    if (ctx != NULL) {
+        SSL_CTX_up_ref(ctx);
+    }
+    pthread_mutex_unlock(&tls_mutex);
+
+    return ctx;
 #endif
+}
+
+int tls_setup(tls_t *tls)
+{
+    int ret = 0;
+
+    tls->ssl = NULL;
+    tls->ssl_ctx = NULL;
+    tls->last_err = NULL;
+
+    tls->ssl_ctx = get_ctx(tls);
+    if (tls->ssl_ctx == NULL) {
+        set_error(tls, _("tls_setup: Could not create SSL context"));
+        return TLS_UNSPECIFICERR;
+    }
 
     tls->ssl = SSL_new(tls->ssl_ctx);
     if (tls->ssl == NULL) {
@@ -327,6 +493,17 @@ int tls_setup(tls_t *tls)
 
     SSL_set_tlsext_host_name(tls->ssl, tls->host);
 
+#if OPENSSL_VERSION_NUMBER >= 0x10100000L
+    SSL_set_app_data(tls->ssl, tls);
+
+    // Try to resume the last session with this server to skip the full handshake
+    SSL_SESSION *session = get_cached_session(tls);
+    if (session != NULL) {
+        SSL_set_session(tls->ssl, session);
+        SSL_SESSION_free(session);
+    }
+#endif
+
     // Set SSL to client mode
     SSL_set_connect_state(tls->ssl);
 
@@ -346,12 +523,14 @@ int tls_setup(tls_t *tls)
             }
             break;
         case SSL_ERROR_SYSCALL: // Can occour if the server goes down and a reconnection attempt fails
+            remove_cached_session(tls);
             return TLS_TIMEOUT; // Try again
             break;
         default:
             printf("SSL_connect error: %d\n", err);
             fflush(stdout);
             // print_error_stack();
+            remove_cached_session(tls);
             set_error(tls, ERR_error_string(err, NULL));
             return TLS_CONNETERR;
         }
@@ -363,6 +542,7 @@ int tls_setup(tls_t *tls)
     }
 
     if ((tls->skip_verification == 0) && ((ret = check_cert(tls)) != TLS_OK)) {
+        remove_cached_session(tls);
         return ret;
     }
 
@@ -373,6 +553,11 @@ int tls_setup(tls_t *tls)
     return TLS_OK;
 }
 
+int tls_session_reused(tls_t *tls)
+{
+    return tls->ssl != NULL && SSL_session_reused(tls->ssl);
+}
+
 int tls_send(tls_t *tls, char *buf, int len, int timeout_ms)
 {
     int ret;
@@ -446,6 +631,7 @@ void tls_close(tls_t *tls)
 
     if (tls->ssl) {
         SSL_shutdown(tls->ssl);
+        SSL_set_app_data(tls->ssl, NULL);
         SSL_free(tls->ssl);
         tls->ssl = NULL;
     }
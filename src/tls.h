@@ -23,6 +23,8 @@
 #define ALLOWED_CIPHERS                                                                                                                                        \
     "ECDHE-RSA-AES128-GCM-SHA256:ECDHE-ECDSA-AES128-GCM-SHA256:ECDHE-RSA-AES256-GCM-SHA384:ECDHE-ECDSA-AES256-GCM-SHA384:DHE-RSA-AES128-GCM-SHA256:DHE-DSS-AES128-GCM-SHA256:kEDH+AESGCM:ECDHE-RSA-AES128-SHA256:ECDHE-ECDSA-AES128-SHA256:ECDHE-RSA-AES128-SHA:ECDHE-ECDSA-AES128-SHA:ECDHE-RSA-AES256-SHA384:ECDHE-ECDSA-AES256-SHA384:ECDHE-RSA-AES256-SHA:ECDHE-ECDSA-AES256-SHA:DHE-RSA-AES128-SHA256:DHE-RSA-AES128-SHA:DHE-DSS-AES128-SHA256:DHE-RSA-AES256-SHA256:DHE-DSS-AES256-SHA:DHE-RSA-AES256-SHA:AES128-GCM-SHA256:AES256-GCM-SHA384:AES128-SHA256:AES256-SHA256:AES128-SHA:AES256-SHA:AES:CAMELLIA:DES-CBC3-SHA:!aNULL:!eNULL:!EXPORT:!DES:!RC4:!MD5:!PSK:!aECDH:!EDH-DSS-DES-CBC3-SHA:!EDH-RSA-DES-CBC3-SHA:!KRB5-DES-CBC3-SHA"
 
+#define TLS_SESSION_CACHE_SIZE 8
+
 enum err {
     TLS_OK = 0,
     TLS_MALLOC = -1,
@@ -53,11 +55,13 @@ typedef struct tls {
     char *cert_dir;
     char sha256[65];
     int socket;
+    int port; // Only used as session cache key
     int skip_verification;
     int state;
 } tls_t;
 
 int tls_setup(tls_t *tls);
+int tls_session_reused(tls_t *tls);
 int tls_send(tls_t *tls, char *buf, int len, int timeout_ms);
 int tls_recv(tls_t *tls, char *buf, int len, int timeout_ms);
 void tls_close(tls_t *tls);
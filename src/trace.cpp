@@ -0,0 +1,253 @@
+// trace functions for butt
+//
+// Copyright 2007-2018 by Daniel Noethen.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "metrics.h"
+#include "trace.h"
+
+typedef struct trace_event {
+    uint64_t time_us;
+    int level;
+    char msg[TRACE_MSG_SIZE];
+} trace_event_t;
+
+// Single producer (the owning thread), single consumer (the logger thread)
+typedef struct trace_ring {
+    int in_use;
+    char name[16];
+    uint32_t head; // Written by the owner
+    uint32_t tail; // Written by the logger
+    uint32_t dropped;
+    trace_event_t events[TRACE_RING_SIZE];
+} trace_ring_t;
+
+int trace_level = TRACE_WARN;
+
+static trace_ring_t rings[TRACE_MAX_THREADS];
+static __thread trace_ring_t *thread_ring = NULL;
+static __thread int thread_has_no_ring = 0;
+static uint32_t rings_exhausted = 0;
+
+static pthread_key_t ring_key;
+static int trace_started = 0;
+
+#ifdef BUTT_TRACE
+static pthread_t logger_thread_detached;
+static uint64_t start_us;
+
+static const char *level_names[] = {"ERROR", "WARN", "INFO", "DEBUG"};
+
+// Called when a thread that owns a ring exits. The ring is reused once the logger has emptied it
+static void release_ring(void *data)
+{
+    trace_ring_t *ring = (trace_ring_t *)data;
+    __atomic_store_n(&ring->in_use, 0, __ATOMIC_RELEASE);
+}
+#endif
+
+static trace_ring_t *get_ring(void)
+{
+    int expected;
+    trace_ring_t *ring;
+
+    if (thread_ring != NULL || thread_has_no_ring) {
+        return thread_ring;
+    }
+
+    for (int i = 0; i < TRACE_MAX_THREADS; i++) {
+        ring = &rings[i];
+        expected = 0;
+        if (__atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE) != __atomic_load_n(&ring->head, __ATOMIC_RELAXED)) {
+            continue; // The previous owner has left events that were not printed yet
+        }
+        if (__atomic_compare_exchange_n(&ring->in_use, &expected, 2, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            snprintf(ring->name, sizeof(ring->name), "thread%d", i);
+            __atomic_store_n(&ring->in_use, 1, __ATOMIC_RELEASE);
+            thread_ring = ring;
+            if (trace_started) {
+                pthread_setspecific(ring_key, ring);
+            }
+            return ring;
+        }
+    }
+
+    __atomic_fetch_add(&rings_exhausted, 1, __ATOMIC_RELAXED);
+    thread_has_no_ring = 1;
+    return NULL;
+}
+
+void trace_write(int level, const char *fmt, ...)
+{
+    va_list ap;
+    trace_ring_t *ring;
+    trace_event_t *ev;
+    uint32_t head, tail;
+
+    ring = get_ring();
+    if (ring == NULL) {
+        return;
+    }
+
+    head = ring->head;
+    tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+    if (head - tail >= TRACE_RING_SIZE) {
+        __atomic_fetch_add(&ring->dropped, 1, __ATOMIC_RELAXED);
+        return;
+    }
+
+    ev = &ring->events[head & (TRACE_RING_SIZE - 1)];
+    ev->time_us = metrics_now_us();
+    ev->level = level;
+
+    va_start(ap, fmt);
+    vsnprintf(ev->msg, sizeof(ev->msg), fmt, ap);
+    va_end(ap);
+
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+}
+
+void trace_set_thread_name(const char *name)
+{
+#ifdef BUTT_TRACE
+    trace_ring_t *ring = get_ring();
+
+    if (ring != NULL) {
+        snprintf(ring->name, sizeof(ring->name), "%s", name);
+    }
+#else
+    (void)name;
+#endif
+}
+
+void trace_set_level(int level)
+{
+    if (level < TRACE_ERROR) {
+        level = TRACE_ERROR;
+    }
+    if (level > TRACE_DEBUG) {
+        level = TRACE_DEBUG;
+    }
+    __atomic_store_n(&trace_level, level, __ATOMIC_RELAXED);
+}
+
+#ifdef BUTT_TRACE
+static int flush_rings(void)
+{
+    int printed = 0;
+    uint32_t head, tail, dropped;
+    trace_ring_t *ring;
+    trace_event_t *ev;
+
+    for (int i = 0; i < TRACE_MAX_THREADS; i++) {
+        ring = &rings[i];
+        head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+        tail = ring->tail;
+
+        while (tail != head) {
+            ev = &ring->events[tail & (TRACE_RING_SIZE - 1)];
+            printf("[%11.6f] %-8s %-5s %s\n", (ev->time_us - start_us) / 1000000.0, ring->name, level_names[ev->level], ev->msg);
+            tail++;
+            printed++;
+        }
+        __atomic_store_n(&ring->tail, tail, __ATOMIC_RELEASE);
+
+        dropped = __atomic_exchange_n(&ring->dropped, 0, __ATOMIC_RELAXED);
+        if (dropped > 0) {
+            printf("[trace] %s: %u events dropped\n", ring->name, dropped);
+            printed++;
+        }
+    }
+
+    dropped = __atomic_exchange_n(&rings_exhausted, 0, __ATOMIC_RELAXED);
+    if (dropped > 0) {
+        printf("[trace] more than %d threads, %u events dropped\n", TRACE_MAX_THREADS, dropped);
+        printed++;
+    }
+
+    return printed;
+}
+
+static void *logger_thread_func(void *data)
+{
+    struct timespec interval;
+    (void)data;
+
+    // Detach thread (free ressources) because no one will call pthread_join() on it
+    pthread_detach(pthread_self());
+
+    interval.tv_sec = 0;
+    interval.tv_nsec = TRACE_FLUSH_INTERVAL * 1000L * 1000L;
+
+    for (;;) {
+        if (flush_rings() > 0) {
+            fflush(stdout);
+        }
+        nanosleep(&interval, NULL);
+    }
+
+    return NULL;
+}
+
+static int parse_level(const char *s)
+{
+    for (int i = TRACE_ERROR; i <= TRACE_DEBUG; i++) {
+        if (!strcasecmp(s, level_names[i])) {
+            return i;
+        }
+    }
+    if (s[0] >= '0' && s[0] <= '3' && s[1] == '\0') {
+        return s[0] - '0';
+    }
+    return -1;
+}
+#endif
+
+int trace_init(void)
+{
+#ifdef BUTT_TRACE
+    const char *env;
+    int level;
+
+    if (trace_started) {
+        return 0;
+    }
+
+    env = getenv("BUTT_TRACE_LEVEL");
+    if (env != NULL && (level = parse_level(env)) != -1) {
+        trace_set_level(level);
+    }
+
+    start_us = metrics_now_us();
+
+    if (pthread_key_create(&ring_key, release_ring) != 0) {
+        return -1;
+    }
+    trace_started = 1;
+
+    if (pthread_create(&logger_thread_detached, NULL, logger_thread_func, NULL) != 0) {
+        return -1;
+    }
+
+    printf("Trace level: %s\n", level_names[trace_level]);
+#endif
+
+    return 0;
+}
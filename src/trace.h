@@ -0,0 +1,63 @@
+// trace functions for butt
+//
+// Copyright 2007-2018 by Daniel Noethen.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2, or (at your option)
+// any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "config.h"
+
+#define TRACE_MAX_THREADS 16
+#define TRACE_RING_SIZE 256    // Events per thread, must be a power of 2
+#define TRACE_MSG_SIZE 160
+#define TRACE_FLUSH_INTERVAL 100 // ms
+
+enum {
+    TRACE_ERROR = 0,
+    TRACE_WARN = 1,
+    TRACE_INFO = 2,
+    TRACE_DEBUG = 3,
+};
+
+// The trace is meant for the audio callbacks, the mixer and the sender threads, which must never block on stdio.
+// TRACE() formats the message into a ring buffer owned by the calling thread and returns.
+// A logger thread prints the rings every TRACE_FLUSH_INTERVAL ms.
+//
+// Without --enable-trace, TRACE_ON() is 0 and the compiler drops every TRACE() together with
+// the diagnostic code that is guarded by TRACE_ON()
+#ifdef BUTT_TRACE
+extern int trace_level;
+#define TRACE_ON(level) ((level) <= __atomic_load_n(&trace_level, __ATOMIC_RELAXED))
+#else
+#define TRACE_ON(level) 0
+#endif
+
+#define TRACE(level, ...)                    \
+    do {                                     \
+        if (TRACE_ON(level)) {               \
+            trace_write((level), __VA_ARGS__); \
+        }                                    \
+    } while (0)
+
+// Starts the logger thread. The initial level is read from the BUTT_TRACE_LEVEL
+// environment variable (error, warn, info, debug or 0-3), default is warn
+int trace_init(void);
+void trace_set_level(int level);
+
+// Names the ring of the calling thread in the log output, e.g. "mixer"
+void trace_set_thread_name(const char *name);
+
+void trace_write(int level, const char *fmt, ...) __attribute__((format(printf, 2, 3)));
+
+#endif
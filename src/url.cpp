@@ -10,6 +10,7 @@
 #include <string.h>
 #include <stdlib.h>
 #include <unistd.h>
+#include <pthread.h>
 #include <curl/curl.h>
 
 #include "url.h"
@@ -21,6 +22,18 @@ int print_log = 0;
 int curl_initialized = 0;
 static char log_buf[100 * 1024];
 
+// Number of idle easy handles that are kept for reuse.
+// An idle handle keeps its connections open, so a follow-up request to the
+// same host skips the TCP (and TLS) handshake
+#define URL_HANDLE_POOL_SIZE 4
+
+static CURLSH *curl_share = NULL;
+static pthread_mutex_t curl_share_mutex[CURL_LOCK_DATA_LAST];
+static pthread_mutex_t curl_init_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t handle_pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+static CURL *handle_pool[URL_HANDLE_POOL_SIZE];
+static int handle_pool_count = 0;
+
 struct MemoryStruct {
     char *memory;
     uint32_t size;
@@ -182,13 +195,91 @@ static size_t callback_for_curl(void *contents, size_t size, size_t nmemb, void
     return realsize;
 }
 
+static void share_lock(CURL *handle, curl_lock_data data, curl_lock_access access, void *userp)
+{
+    (void)handle;
+    (void)access;
+    (void)userp;
+    pthread_mutex_lock(&curl_share_mutex[data]);
+}
+
+static void share_unlock(CURL *handle, curl_lock_data data, void *userp)
+{
+    (void)handle;
+    (void)userp;
+    pthread_mutex_unlock(&curl_share_mutex[data]);
+}
+
+// Returns an idle easy handle from the pool or a new one if the pool is empty.
+// All handles share DNS results and TLS sessions. The connection cache can't be shared between threads,
+// each pooled handle keeps its own connections instead
+static CURL *url_get_handle(void)
+{
+    CURL *curl = NULL;
+
+    pthread_mutex_lock(&handle_pool_mutex);
+    if (handle_pool_count > 0) {
+        curl = handle_pool[--handle_pool_count];
+    }
+    pthread_mutex_unlock(&handle_pool_mutex);
+
+    if (curl != NULL) {
+        // Clears all options but keeps open connections and caches
+        curl_easy_reset(curl);
+    }
+    else {
+        curl = curl_easy_init();
+        if (curl == NULL) {
+            return NULL;
+        }
+    }
+
+    if (curl_share != NULL) {
+        curl_easy_setopt(curl, CURLOPT_SHARE, curl_share);
+    }
+    curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
+    curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+
+    return curl;
+}
+
+static void url_put_handle(CURL *curl)
+{
+    pthread_mutex_lock(&handle_pool_mutex);
+    if (curl_initialized == 1 && handle_pool_count < URL_HANDLE_POOL_SIZE) {
+        handle_pool[handle_pool_count++] = curl;
+        curl = NULL;
+    }
+    pthread_mutex_unlock(&handle_pool_mutex);
+
+    if (curl != NULL) {
+        curl_easy_cleanup(curl);
+    }
+}
+
 void url_init_curl(void)
 {
+    pthread_mutex_lock(&curl_init_mutex);
     if (curl_initialized == 1) {
+        pthread_mutex_unlock(&curl_init_mutex);
         return;
     }
     curl_global_init(CURL_GLOBAL_DEFAULT);
+
+    for (int i = 0; i < CURL_LOCK_DATA_LAST; i++) {
+        pthread_mutex_init(&curl_share_mutex[i], NULL);
+    }
+
+    curl_share = curl_share_init();
+    if (curl_share != NULL) {
+        curl_share_setopt(curl_share, CURLSHOPT_LOCKFUNC, share_lock);
+        curl_share_setopt(curl_share, CURLSHOPT_UNLOCKFUNC, share_unlock);
+        curl_share_setopt(curl_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+        curl_share_setopt(curl_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+    }
+
     curl_initialized = 1;
+    pthread_mutex_unlock(&curl_init_mutex);
 }
 
 uint32_t url_post_json(const char *url, char *post_data, char *answer, uint32_t max_answer_size)
@@ -213,7 +304,7 @@ uint32_t url_post_json(const char *url, char *post_data, char *answer, uint32_t
     headers = curl_slist_append(headers, "Content-Type: application/json");
     headers = curl_slist_append(headers, "charset: utf-8");
 
-    curl = curl_easy_init();
+    curl = url_get_handle();
     if (curl) {
         if (print_log || write_logfile) {
             curl_easy_setopt(curl, CURLOPT_DEBUGFUNCTION, my_trace);
@@ -262,9 +353,10 @@ uint32_t url_post_json(const char *url, char *post_data, char *answer, uint32_t
             }
         }
 
-        curl_easy_cleanup(curl);
+        url_put_handle(curl);
     }
 
+    curl_slist_free_all(headers);
     free(chunk.memory);
 
     return chunk.size;
@@ -297,7 +389,7 @@ uint32_t url_post_sdp(const char *url, const char *bearer_token, char *post_data
         headers = curl_slist_append(headers, auth_header);
     }
 
-    curl = curl_easy_init();
+    curl = url_get_handle();
     if (curl) {
         char user_agent[32];
         snprintf(user_agent, sizeof(user_agent), "butt %s", VERSION);
@@ -348,9 +440,10 @@ uint32_t url_post_sdp(const char *url, const char *bearer_token, char *post_data
             }
         }
 
-        curl_easy_cleanup(curl);
+        url_put_handle(curl);
     }
 
+    curl_slist_free_all(headers);
     free(chunk.memory);
 
     return chunk.size;
@@ -373,7 +466,7 @@ uint32_t url_post(const char *url, char *post_data, char *answer, uint32_t max_a
     struct data config;
     config.trace_ascii = 1; /* enable ascii tracing for debug */
 
-    curl = curl_easy_init();
+    curl = url_get_handle();
     if (curl) {
         if (print_log || write_logfile) {
             curl_easy_setopt(curl, CURLOPT_DEBUGFUNCTION, my_trace);
@@ -425,7 +518,7 @@ uint32_t url_post(const char *url, char *post_data, char *answer, uint32_t max_a
             }
         }
 
-        curl_easy_cleanup(curl);
+        url_put_handle(curl);
     }
 
     free(chunk.memory);
@@ -455,7 +548,7 @@ uint32_t url_get(const char *url, const char *custom_hdr, char *answer, uint32_t
         hdr = curl_slist_append(hdr, custom_hdr);
     }
 
-    curl = curl_easy_init();
+    curl = url_get_handle();
 
     if (curl) {
         char user_agent[32];
@@ -503,9 +596,10 @@ uint32_t url_get(const char *url, const char *custom_hdr, char *answer, uint32_t
             }
         }
 
-        curl_easy_cleanup(curl);
+        url_put_handle(curl);
     }
 
+    curl_slist_free_all(hdr);
     free(chunk.memory);
 
     return chunk.size;
@@ -526,7 +620,7 @@ uint32_t url_get_listener_count(const char *url, char *data, uint32_t data_size)
     CURL *curl;
     CURLcode res;
 
-    curl = curl_easy_init();
+    curl = url_get_handle();
     if (curl) {
         curl_easy_setopt(curl, CURLOPT_URL, url);
         // User Agent has to be set to "Mozilla". Otherwise Shoutcast v1 responses with 404
@@ -570,7 +664,7 @@ uint32_t url_get_listener_count(const char *url, char *data, uint32_t data_size)
             }
         }
 
-        curl_easy_cleanup(curl);
+        url_put_handle(curl);
     }
 
     free(chunk.memory);
@@ -580,5 +674,24 @@ uint32_t url_get_listener_count(const char *url, char *data, uint32_t data_size)
 
 void url_cleanup_curl(void)
 {
+    pthread_mutex_lock(&curl_init_mutex);
+    if (curl_initialized == 0) {
+        pthread_mutex_unlock(&curl_init_mutex);
+        return;
+    }
+
+    pthread_mutex_lock(&handle_pool_mutex);
+    curl_initialized = 0;
+    while (handle_pool_count > 0) {
+        curl_easy_cleanup(handle_pool[--handle_pool_count]);
+    }
+    pthread_mutex_unlock(&handle_pool_mutex);
+
+    if (curl_share != NULL) {
+        curl_share_cleanup(curl_share);
+        curl_share = NULL;
+    }
+
     curl_global_cleanup();
+    pthread_mutex_unlock(&curl_init_mutex);
 }
@@ -20,6 +20,7 @@
 #include "config.h"
 #include "cfg.h"
 #include "vorbis_encode.h"
+#include "pcm_convert.h"
 
 int vorbis_enc_init(vorbis_enc *vorbis)
 {
@@ -112,48 +113,12 @@ int vorbis_enc_reinit(vorbis_enc *vorbis)
     return 1;
 }
 
-int vorbis_enc_encode(vorbis_enc *vorbis, float *pcm_buf, char *enc_buf, int size)
+// Encodes all blocks that are available in the analysis buffer and appends the resulting pages to enc_buf
+static int vorbis_enc_blockout(vorbis_enc *vorbis, char *enc_buf)
 {
-    int i, result;
-    int flush;
+    int result;
     int eos = 0;
     int w = 0;
-    float **vorbis_buf;
-
-    flush = !size;
-
-    if (vorbis->header_written == 0) {
-        while (ogg_stream_flush(&(vorbis->os), &(vorbis->og)) != 0) {
-            memcpy(enc_buf + w, vorbis->og.header, (size_t)vorbis->og.header_len);
-            w += vorbis->og.header_len;
-            memcpy(enc_buf + w, vorbis->og.body, (size_t)vorbis->og.body_len);
-            w += vorbis->og.body_len;
-        }
-        vorbis->header_written = 1;
-    }
-
-    if (flush == 1) {
-        vorbis_analysis_wrote(&(vorbis->vd), 0);
-    }
-    else {
-        vorbis_buf = vorbis_analysis_buffer(&(vorbis->vd), size);
-
-        // deinterlace audio data
-        // stereo
-        if (vorbis->channel == 2) {
-            for (i = 0; i < size; i++) {
-                vorbis_buf[0][i] = pcm_buf[i * 2];
-                vorbis_buf[1][i] = pcm_buf[i * 2 + 1];
-            }
-        } // mono
-        else {
-            for (i = 0; i < size; i++) {
-                vorbis_buf[0][i] = pcm_buf[i];
-            }
-        }
-
-        vorbis_analysis_wrote(&(vorbis->vd), size);
-    }
 
     while (vorbis_analysis_blockout(&(vorbis->vd), &(vorbis->vb)) == 1) {
         vorbis_analysis(&(vorbis->vb), NULL);
@@ -182,6 +147,49 @@ int vorbis_enc_encode(vorbis_enc *vorbis, float *pcm_buf, char *enc_buf, int siz
     return w;
 }
 
+int vorbis_enc_encode(vorbis_enc *vorbis, float *pcm_buf, char *enc_buf, int size)
+{
+    int chunk;
+    int w = 0;
+    float **vorbis_buf;
+
+    if (vorbis->header_written == 0) {
+        while (ogg_stream_flush(&(vorbis->os), &(vorbis->og)) != 0) {
+            memcpy(enc_buf + w, vorbis->og.header, (size_t)vorbis->og.header_len);
+            w += vorbis->og.header_len;
+            memcpy(enc_buf + w, vorbis->og.body, (size_t)vorbis->og.body_len);
+            w += vorbis->og.body_len;
+        }
+        vorbis->header_written = 1;
+    }
+
+    if (size == 0) { // flush
+        vorbis_analysis_wrote(&(vorbis->vd), 0);
+        return w + vorbis_enc_blockout(vorbis, enc_buf + w);
+    }
+
+    while (size > 0) {
+        chunk = size < VORBIS_FEED_FRAMES ? size : VORBIS_FEED_FRAMES;
+        vorbis_buf = vorbis_analysis_buffer(&(vorbis->vd), chunk);
+
+        // deinterlace audio data
+        if (vorbis->channel == 2) {
+            pcm_deinterleave_stereo(pcm_buf, vorbis_buf[0], vorbis_buf[1], chunk);
+        }
+        else {
+            memcpy(vorbis_buf[0], pcm_buf, chunk * sizeof(float));
+        }
+
+        vorbis_analysis_wrote(&(vorbis->vd), chunk);
+        w += vorbis_enc_blockout(vorbis, enc_buf + w);
+
+        pcm_buf += chunk * vorbis->channel;
+        size -= chunk;
+    }
+
+    return w;
+}
+
 int vorbis_enc_get_samplerate(vorbis_enc *vorbis)
 {
     return vorbis->vi.rate;
@@ -18,6 +18,11 @@
 
 #include <vorbis/vorbisenc.h>
 
+// Number of frames handed to the analysis buffer at once.
+// vorbis_analysis_blockout() moves the remaining pcm data to the front of its buffer after
+// every block. Feeding small chunks and draining the blocks in between keeps that buffer short
+#define VORBIS_FEED_FRAMES (1024)
+
 struct vorbis_enc {
     ogg_stream_state os; /* take physical pages, weld into a logical stream of packets */
     ogg_page og;         /* one Ogg bitstream page.  Vorbis packets are inside */
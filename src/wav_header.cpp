@@ -58,3 +58,72 @@ int wav_write_header(FILE *fd, short ch, int srate, short bps)
 
     return 0;
 }
+
+static uint8_t *put_le(uint8_t *p, uint64_t val, int bytes)
+{
+    for (int i = 0; i < bytes; i++) {
+        *p++ = (uint8_t)(val >> (8 * i));
+    }
+    return p;
+}
+
+int wav_write_header_ext(FILE *fd, short ch, int srate, short bps)
+{
+    // KSDATAFORMAT_SUBTYPE_PCM
+    static const uint8_t subformat_pcm[16] = {0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71};
+    uint8_t hdr[WAV_EXT_HDR_SIZE];
+    uint8_t *p = hdr;
+    uint64_t file_size, data_size;
+    off_t pos;
+    int rf64;
+
+    pos = ftello(fd);
+    if (pos == -1) {
+        return -1;
+    }
+
+    file_size = pos >= WAV_EXT_HDR_SIZE ? (uint64_t)pos : WAV_EXT_HDR_SIZE;
+    data_size = file_size - WAV_EXT_HDR_SIZE;
+    rf64 = file_size - 8 > UINT32_MAX;
+
+    memcpy(p, rf64 ? "RF64" : "RIFF", 4);
+    p = put_le(p + 4, rf64 ? UINT32_MAX : file_size - 8, 4);
+    memcpy(p, "WAVE", 4);
+    p += 4;
+
+    memcpy(p, rf64 ? "ds64" : "JUNK", 4);
+    p = put_le(p + 4, 28, 4);
+    if (rf64) {
+        p = put_le(p, file_size - 8, 8);
+        p = put_le(p, data_size, 8);
+        p = put_le(p, data_size / (ch * bps / 8), 8);
+        p = put_le(p, 0, 4); // No table entries
+    }
+    else {
+        memset(p, 0, 28);
+        p += 28;
+    }
+
+    memcpy(p, "fmt ", 4);
+    p = put_le(p + 4, 40, 4);
+    p = put_le(p, 0xFFFE, 2); // WAVE_FORMAT_EXTENSIBLE
+    p = put_le(p, ch, 2);
+    p = put_le(p, srate, 4);
+    p = put_le(p, (uint32_t)srate * ch * bps / 8, 4);
+    p = put_le(p, ch * bps / 8, 2);
+    p = put_le(p, bps, 2);
+    p = put_le(p, 22, 2);  // Size of the extension
+    p = put_le(p, bps, 2); // Valid bits per sample
+    p = put_le(p, 0, 4);   // No speaker positions, the channels are independent tracks
+    memcpy(p, subformat_pcm, sizeof(subformat_pcm));
+    p += sizeof(subformat_pcm);
+
+    memcpy(p, "data", 4);
+    put_le(p + 4, rf64 ? UINT32_MAX : data_size, 4);
+
+    rewind(fd);
+    fwrite(hdr, 1, sizeof(hdr), fd);
+    fseeko(fd, 0, SEEK_END);
+
+    return 0;
+}
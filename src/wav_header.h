@@ -20,6 +20,7 @@
 #include <stdint.h>
 
 #define WAV_HDR_SIZE 44
+#define WAV_EXT_HDR_SIZE 104
 
 typedef union {
     char data[WAV_HDR_SIZE];
@@ -45,4 +46,9 @@ typedef union {
 
 int wav_write_header(FILE *fd, short ch, int srate, short bps);
 
+// Writes a WAVE_FORMAT_EXTENSIBLE header (WAV_EXT_HDR_SIZE bytes) for any number of channels.
+// Room for a ds64 chunk is reserved in a JUNK chunk, so a file that grows beyond 4 GiB
+// becomes an RF64 file (EBU Tech 3306) the next time the header is written
+int wav_write_header_ext(FILE *fd, short ch, int srate, short bps);
+
 #endif
@@ -18,6 +18,8 @@
 #ifdef HAVE_LIBDATACHANNEL
 
 #include <rtc/rtc.h>
+#include <time.h>
+#include <stdint.h>
 #include "butt.h"
 #include "cfg.h"
 #include "timer.h"
@@ -26,6 +28,7 @@
 #include "fl_funcs.h"
 #include "url.h"
 #include "atom.h"
+#include "metrics.h"
 
 ATOM_NEW_COND(gathering_cond);
 ATOM_NEW_COND(track_cond);
@@ -43,6 +46,11 @@ void _logFile(rtcLogLevel level, const char *message);
 int peer, track, packetiser;
 float last_sample_time, last_report_time;
 
+// Wall clock time at which the packet with RTP timestamp <pace_anchor_ts> was sent
+static uint64_t pace_anchor_us;
+static unsigned int pace_anchor_ts;
+static int pace_started;
+
 void _on_state_change(int pc, rtcState state, void *ptr);
 void _on_gathering_state_change(int pc, rtcGatheringState state, void *ptr);
 
@@ -87,7 +95,8 @@ int webrtc_connect(void)
     int is_stereo = (cfg.audio.channel == 2 ? 1 : 0);
 
     char profile[256];
-    snprintf(profile, sizeof(profile), "minptime=10;stereo=%d;sprop-stereo=%d;useinbandfec=1", is_stereo, is_stereo);
+    snprintf(profile, sizeof(profile), "minptime=10;stereo=%d;sprop-stereo=%d;useinbandfec=%d;usedtx=%d", is_stereo, is_stereo,
+             cfg.opus_codec_stream.webrtc_fec, cfg.opus_codec_stream.webrtc_dtx);
 
     // Add an audio track
     rtcTrackInit track_config = {};
@@ -148,6 +157,7 @@ int webrtc_connect(void)
     atom_cond_wait(&track_cond);
 
     connected = 1;
+    pace_started = 0;
 
     timer_init(&stream_timer, 1); // starts the "online" timer
     timer_start(&stream_timer);
@@ -156,6 +166,33 @@ int webrtc_connect(void)
     return WEBRTC_OK;
 }
 
+// The mixer hands over a whole block of audio at once, which the stream thread encodes into
+// several packets in a burst. Sending each packet at the wall clock time of its RTP timestamp
+// keeps the receiver's jitter buffer small. A packet that is late, e.g. after a stall of the mixer,
+// restarts the pacing at its own timestamp, so the added delay never exceeds one mixer block
+static void pace(unsigned int timestamp)
+{
+    uint64_t now = metrics_now_us();
+    int64_t due;
+    struct timespec wait;
+
+    if (pace_started) {
+        due = (int64_t)pace_anchor_us + (int64_t)(timestamp - pace_anchor_ts) * 1000000 / 48000;
+        if (due >= (int64_t)now && due - (int64_t)now <= WEBRTC_PACE_MAX_WAIT * 1000) {
+            if (due > (int64_t)now) {
+                wait.tv_sec = 0;
+                wait.tv_nsec = (due - now) * 1000;
+                nanosleep(&wait, NULL);
+            }
+            return;
+        }
+    }
+
+    pace_anchor_us = now;
+    pace_anchor_ts = timestamp;
+    pace_started = 1;
+}
+
 int webrtc_send(char *buf, int buf_len)
 {
     // Bail if the track isn't open
@@ -168,9 +205,17 @@ int webrtc_send(char *buf, int buf_len)
     unsigned int track_timestamp;
     rtcGetCurrentTrackTimestamp(track, &track_timestamp);
 
-    unsigned int current_timestamp = track_timestamp + OPUS_FRAME_SIZE;
+    unsigned int current_timestamp = track_timestamp + opus_stream.frame_size;
     rtcSetTrackRtpTimestamp(track, current_timestamp);
 
+    // With DTX the encoder emits packets of 1-2 bytes during silence. They are not sent,
+    // the receiver conceals the gap and the next packet continues at the right timestamp
+    if (opus_stream.dtx && buf_len <= OPUS_DTX_PACKET_SIZE) {
+        return buf_len;
+    }
+
+    pace(current_timestamp);
+
     // Work out if we need to to send another RTCP sender report
     unsigned int reported_timestamp;
     rtcGetLastTrackSenderReportTimestamp(track, &reported_timestamp);
@@ -185,12 +230,9 @@ int webrtc_send(char *buf, int buf_len)
     }
 
     // Send the audio data
-    // NOTE: Shoutcast/Icecast need the Opus data wrapped in a container, and
-    // opus_enc_encode() does it with Ogg but WebRTC and RTP in general require
-    // the raw unwrapped Opus, so we'll grab that directly from opus_stream
-    // which gets set by opus_enc_encode() separately to the Ogg wrapping.
-    buf = (char *)opus_stream.buffer;
-    buf_len = opus_stream.buffer_len;
+    // NOTE: Shoutcast/Icecast need the Opus data wrapped in a container, but
+    // WebRTC and RTP in general require the raw unwrapped Opus packets which
+    // the stream thread gets from opus_enc_encode_raw()
     if (rtcSendMessage(track, buf, buf_len) < 0) {
         return -1;
     }
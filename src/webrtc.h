@@ -16,6 +16,9 @@
 #ifndef WEBRTC_H
 #define WEBRTC_H
 
+// Packets that are due further in the future than this restart the pacing
+#define WEBRTC_PACE_MAX_WAIT 100 // ms
+
 enum {
     WEBRTC_OK = 0,
     WEBRTC_RETRY = 1,